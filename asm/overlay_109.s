@@ -2,6 +2,10 @@
 	.include "overlay_109.inc"
 	.include "global.inc"
 
+#ifdef OPTIMIZE_VRAM_TRANSFER_QUEUE
+	.public GF_DoVramTransfer
+#endif
+
 	.text
 
 	thumb_func_start ov109_021E5900
@@ -2046,7 +2050,11 @@ _021E686C:
 	bl ov109_021E6898
 	add r0, r4, #0
 	bl ov109_021E68D4
+#ifdef OPTIMIZE_VRAM_TRANSFER_QUEUE
+	bl GF_DoVramTransfer
+#else
 	bl NNS_GfdDoVramTransfer
+#endif
 	ldr r0, [r4, #0x14]
 	bl BgConfig_HandleScheduledScrollAndTransferOps
 	ldr r3, _021E6890 ; =0x027E0000
@@ -3,6 +3,10 @@
 	.include "overlay_110.inc"
 	.include "global.inc"
 
+#ifdef OPTIMIZE_VRAM_TRANSFER_QUEUE
+	.public GF_DoVramTransfer
+#endif
+
 	.text
 
 	thumb_func_start ov110_AlphPuzzle_OvyInit
@@ -1119,7 +1123,11 @@ _021E6120:
 	beq _021E612E
 	bl sub_0200D034
 _021E612E:
+#ifdef OPTIMIZE_VRAM_TRANSFER_QUEUE
+	bl GF_DoVramTransfer
+#else
 	bl NNS_GfdDoVramTransfer
+#endif
 	ldr r0, [r4, #0x14]
 	bl BgConfig_HandleScheduledScrollAndTransferOps
 	ldr r3, _021E6148 ; =0x027E0000
@@ -2,6 +2,10 @@
 	.include "overlay_17.inc"
 	.include "global.inc"
 
+#ifdef OPTIMIZE_VRAM_TRANSFER_QUEUE
+	.public GF_DoVramTransfer
+#endif
+
 	.text
 
 	thumb_func_start ov17_02201BC0
@@ -2122,7 +2126,11 @@ ov17_02202BF8: ; 0x02202BF8
 	beq _02202C0A
 	bl sub_0200D034
 _02202C0A:
+#ifdef OPTIMIZE_VRAM_TRANSFER_QUEUE
+	bl GF_DoVramTransfer
+#else
 	bl NNS_GfdDoVramTransfer
+#endif
 	add r4, #0x88
 	ldr r0, [r4]
 	bl BgConfig_HandleScheduledScrollAndTransferOps
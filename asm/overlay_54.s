@@ -2,6 +2,10 @@
 	.include "overlay_54.inc"
 	.include "global.inc"
 
+#ifdef OPTIMIZE_VRAM_TRANSFER_QUEUE
+	.public GF_DoVramTransfer
+#endif
+
 	.text
 
 	thumb_func_start ov54_021E5900
@@ -459,7 +463,11 @@ ov54_021E5C84: ; 0x021E5C84
 	str r0, [r4, #0x10]
 _021E5CB4:
 	bl sub_0200D034
+#ifdef OPTIMIZE_VRAM_TRANSFER_QUEUE
+	bl GF_DoVramTransfer
+#else
 	bl NNS_GfdDoVramTransfer
+#endif
 	ldr r0, [r4, #0x14]
 	bl BgConfig_HandleScheduledScrollAndTransferOps
 	ldr r3, _021E5CDC ; =0x027E0000
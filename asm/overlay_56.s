@@ -2,6 +2,10 @@
 	.include "overlay_56.inc"
 	.include "global.inc"
 
+#ifdef OPTIMIZE_VRAM_TRANSFER_QUEUE
+	.public GF_DoVramTransfer
+#endif
+
 	.text
 
 	thumb_func_start ov56_021E5C20
@@ -1020,7 +1024,11 @@ _021E63CE:
 	beq _021E63DC
 	bl sub_0200D034
 _021E63DC:
+#ifdef OPTIMIZE_VRAM_TRANSFER_QUEUE
+	bl GF_DoVramTransfer
+#else
 	bl NNS_GfdDoVramTransfer
+#endif
 	ldr r0, [r4, #0x18]
 	bl BgConfig_HandleScheduledScrollAndTransferOps
 	ldr r3, _021E63F4 ; =0x027E0000
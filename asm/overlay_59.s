@@ -2,6 +2,10 @@
 	.include "overlay_59.inc"
 	.include "global.inc"
 
+#ifdef OPTIMIZE_VRAM_TRANSFER_QUEUE
+	.public GF_DoVramTransfer
+#endif
+
 	.text
 
 	thumb_func_start ov59_02237D40
@@ -2922,7 +2926,11 @@ ov59_022393D4: ; 0x022393D4
 	beq _022393E6
 	bl sub_0200D034
 _022393E6:
+#ifdef OPTIMIZE_VRAM_TRANSFER_QUEUE
+	bl GF_DoVramTransfer
+#else
 	bl NNS_GfdDoVramTransfer
+#endif
 	ldr r0, [r4, #0x54]
 	bl BgConfig_HandleScheduledScrollAndTransferOps
 	ldr r3, _02239400 ; =0x027E0000
@@ -1,6 +1,10 @@
 	.include "asm/macros.inc"
 	.include "overlay_62.inc"
 	.include "global.inc"
+
+#ifdef OPTIMIZE_VRAM_TRANSFER_QUEUE
+	.public GF_DoVramTransfer
+#endif
 	.public ov60_021EAFE0
 
 	.text
@@ -503,7 +507,11 @@ _021E5CC4: .word ov62_021E66D0
 ov62_021E5CC8: ; 0x021E5CC8
 	push {r4, lr}
 	add r4, r0, #0
+#ifdef OPTIMIZE_VRAM_TRANSFER_QUEUE
+	bl GF_DoVramTransfer
+#else
 	bl NNS_GfdDoVramTransfer
+#endif
 	add r0, r4, #0
 	bl ov62_021E5FC4
 	add r4, #0xb8
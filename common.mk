@@ -42,6 +42,8 @@ ASPATCH      := $(TOOLSDIR)/mwasmarm_patcher/mwasmarm_patcher$(EXE)
 CSV2BIN      := $(TOOLSDIR)/csv2bin/csv2bin$(EXE)
 MKFXCONST    := $(TOOLSDIR)/gen_fx_consts/gen_fx_consts$(EXE)
 MOD123ENCRY  := $(TOOLSDIR)/mod123encry/mod123encry$(EXE)
+MWCACHE_TOOL := $(TOOLSDIR)/mwcache/mwcache$(EXE)
+SCRIPTASM    := $(TOOLSDIR)/scriptasm/scriptasm$(EXE)
 
 # Decompiled NitroSDK tools
 COMPSTATIC   := $(TOOLSDIR)/compstatic/compstatic$(EXE)
@@ -60,7 +62,9 @@ NATIVE_TOOLS := \
 	$(CSV2BIN) \
 	$(MKFXCONST) \
 	$(COMPSTATIC) \
-	$(MOD123ENCRY)
+	$(MOD123ENCRY) \
+	$(MWCACHE_TOOL) \
+	$(SCRIPTASM)
 
 TOOLDIRS := $(foreach tool,$(NATIVE_TOOLS),$(dir $(tool)))
 
@@ -110,14 +114,30 @@ EXCCFLAGS         := -Cpp_exceptions off
 
 MWCFLAGS           = $(DEFINES) $(OPTFLAGS) -enum int -lang c99 $(EXCCFLAGS) -gccext,on -proc $(PROC) -msgstyle gcc -gccinc -i ./include -i ./include/library -i $(WORK_DIR)/files -I$(WORK_DIR)/lib/include -ipa file -interworking -inline on,noauto -char signed -W all -W pedantic -W noimpl_signedunsigned -W noimplicitconv -W nounusedarg -W nomissingreturn -W error
 
-MWASFLAGS          = $(DEFINES) -proc $(PROC_S) -gccinc -i . -i ./include -i $(WORK_DIR)/asm/include -i $(WORK_DIR)/files -i $(WORK_DIR)/lib/asm/include -i $(WORK_DIR)/lib/NitroDWC/asm/include -i $(WORK_DIR)/lib/NitroSDK/asm/include -i $(WORK_DIR)/lib/syscall/asm/include -I$(WORK_DIR)/lib/include -DSDK_ASM
+# The OPTIMIZE_* switches turned on in include/constants/optimization.h. C
+# files see them through global.h, but no .s file includes that, so the
+# assembler gets them on its command line.
+OPTIMIZE_H        := $(WORK_DIR)/include/constants/optimization.h
+OPTIMIZE_DEFINES  := $(shell $(SED) -n 's/^[[:space:]]*\#define[[:space:]]+(OPTIMIZE_[A-Z0-9_]+).*/-D\1/p' $(OPTIMIZE_H))
+
+MWASFLAGS          = $(DEFINES) $(OPTIMIZE_DEFINES) -proc $(PROC_S) -gccinc -i . -i ./include -i $(WORK_DIR)/asm/include -i $(WORK_DIR)/files -i $(WORK_DIR)/lib/asm/include -i $(WORK_DIR)/lib/NitroDWC/asm/include -i $(WORK_DIR)/lib/NitroSDK/asm/include -i $(WORK_DIR)/lib/syscall/asm/include -I$(WORK_DIR)/lib/include -DSDK_ASM
 MWLDFLAGS         := -proc $(PROC) -nopic -nopid -interworking -map closure,unused -symtab sort -m _start -msgstyle gcc
 ARFLAGS           := rcS
 
 $(C_OBJS):   MWCFLAGS  +=          -include global.h
 
-MW_COMPILE = $(WINE) $(MWCC) $(MWCFLAGS)
-MW_ASSEMBLE = $(WINE) $(MWAS) $(MWASFLAGS)
+# Pass MWCACHE=1 to cache compiler and assembler output across builds and
+# game versions. The cache is pruned back to MWCACHE_MAXSIZE (default 1G),
+# least recently used first; make mwcache-clean empties it. Not available on
+# native Windows, where the wrapper cannot spawn processes the POSIX way.
+ifeq ($(MWCACHE)$(filter Windows_NT,$(OS)),1)
+MW_CACHE := $(MWCACHE_TOOL)
+else
+MW_CACHE :=
+endif
+
+MW_COMPILE = $(MW_CACHE) $(WINE) $(MWCC) $(MWCFLAGS)
+MW_ASSEMBLE = $(MW_CACHE) $(WINE) $(MWAS) $(MWASFLAGS)
 
 export MWCIncludes := lib/include
 
@@ -134,9 +154,23 @@ DUMMY := $(shell mkdir -p $(ALL_BUILDDIRS))
 .SECONDARY:
 .SECONDEXPANSION:
 .DELETE_ON_ERROR:
-.PHONY: all tidy clean tools clean-tools $(TOOLDIRS)
+.PHONY: all tidy clean tools clean-tools mwcache-stats mwcache-clean $(TOOLDIRS)
 .PRECIOUS: $(SBIN)
+
+# The phases of a build (tools, filesystem, main, ...) have to run one after
+# another, because their recipes use each other's outputs without naming them
+# as prerequisites. The objects have no such ordering among themselves, so
+# objs builds them in a sub-make that make -j may run in parallel. That
+# includes the GLOBAL_ASM objects, since each asm_processor job has its own
+# scratch directory.
+.PHONY: objs
+ifeq ($(OBJS_PARALLEL),)
 .NOTPARALLEL:
+objs:
+	@$(MAKE) OBJS_PARALLEL=1 objs
+else
+objs: $(ALL_OBJS)
+endif
 
 .PHONY: $(MWAS)
 $(MWAS):
@@ -171,8 +205,8 @@ $(BUILD_DIR)/%.o: %.c $(BUILD_DIR)/%.d
 	@$(call fixdep,$(BUILD_DIR)/$*.d)
 
 $(BUILD_DIR)/%.o: %.s
-$(BUILD_DIR)/%.o: %.s $(BUILD_DIR)/%.d
-	$(WINE) $(MWAS) $(MWASFLAGS) $(DEPFLAGS) -o $@ $<
+$(BUILD_DIR)/%.o: %.s $(BUILD_DIR)/%.d $(OPTIMIZE_H)
+	$(MW_ASSEMBLE) $(DEPFLAGS) -o $@ $<
 	@$(call fixdep,$(BUILD_DIR)/$*.d)
 
 include $(wildcard $(DEPFILES))
@@ -183,8 +217,8 @@ BUILD_C ?= $(MW_COMPILE) -c -o
 $(BUILD_DIR)/%.o: %.c
 	$(BUILD_C) $@ $<
 
-$(BUILD_DIR)/%.o: %.s
-	$(WINE) $(MWAS) $(MWASFLAGS) -o $@ $<
+$(BUILD_DIR)/%.o: %.s $(OPTIMIZE_H)
+	$(MW_ASSEMBLE) -o $@ $<
 endif
 
 $(NATIVE_TOOLS): tools
@@ -194,6 +228,12 @@ tools: $(TOOLDIRS) $(MWAS)
 $(TOOLDIRS):
 	@$(MAKE) -C $@
 
+mwcache-stats:
+	@$(MWCACHE_TOOL) --stats
+
+mwcache-clean:
+	$(MWCACHE_TOOL) --clear
+
 clean-tools:
 	$(foreach tool,$(TOOLDIRS),$(MAKE) -C $(tool) clean;)
 
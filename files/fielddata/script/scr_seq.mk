@@ -6,32 +6,67 @@ SCRIPT_SRCS := $(wildcard $(SCRIPT_DIR)/*.s)
 SCRIPT_OBJS := $(SCRIPT_SRCS:%.s=%.o)
 SCRIPT_BINS := $(SCRIPT_SRCS:%.s=%.bin)
 SCRIPT_HEADS := $(SCRIPT_SRCS:%.s=%.h)
+SCRIPT_DEPS := $(SCRIPT_BINS:%.bin=%.d)
+
+# scriptasm assembles the scripts natively, on all cores, straight to the
+# bytes mwasm + objcopy would produce. It keeps its own .d files and only
+# reassembles what is out of date, so it runs once per make and every .bin
+# is current afterwards. It then writes SCRIPT_STAMP, and with -MD a .d file
+# for it covering every script's prerequisites, so make only runs it when
+# something changed. The sha1 check has a stamp of its own.
+SCRIPT_STAMP        := $(SCRIPT_DIR).stamp
+SCRIPT_VERIFY_STAMP := $(SCRIPT_DIR).verified
 
-$(SCRIPT_BINS): MWASFLAGS += -DPM_ASM
+SCRIPTASMFLAGS = $(MWASFLAGS) -DPM_ASM
 ifeq ($(NODEP),)
-SCRIPT_DEPS := $(SCRIPT_BINS:%.bin=%.d)
-$(SCRIPT_DEPS):
-
-$(SCRIPT_BINS): %.bin: %.s
-$(SCRIPT_BINS): %.bin: %.s %.d
-	$(WINE) $(MWAS) $(MWASFLAGS) $(DEPFLAGS) -o $*.o $<
-	@$(call fixdep,$*.d)
-	@$(SED) -i 's/\.o/.bin/' $*.d
-	$(OBJCOPY) -O binary --file-alignment 4 $*.o $@
-
-include $(wildcard $(SCRIPT_DEPS))
-else
-$(SCRIPT_BINS): %.bin: %.s
-	$(WINE) $(MWAS) $(MWASFLAGS) -o $*.o $<
-	$(OBJCOPY) -O binary --file-alignment 4 $*.o $@
+SCRIPTASMFLAGS += -MD
 endif
 
-$(SCRIPT_NARC): $(SCRIPT_BINS) check_scripts
+$(SCRIPT_STAMP): $(SCRIPT_SRCS)
+	$(SCRIPTASM) $(SCRIPTASMFLAGS) --stamp $@ $(SCRIPT_DIR)/*.s
+
+$(SCRIPT_BINS): $(SCRIPT_STAMP) ;
+
+$(SCRIPT_NARC): $(SCRIPT_STAMP)
 
-check_scripts:
 ifeq ($(COMPARE),1)
-	@$(SHA1SUM) --quiet -c $(PROJECT_ROOT)/scr_seq.sha1
+$(SCRIPT_NARC): $(SCRIPT_VERIFY_STAMP)
+
+$(SCRIPT_VERIFY_STAMP): $(SCRIPT_STAMP) $(PROJECT_ROOT)/scr_seq.sha1
+	@$(SCRIPTASM) --verify $(PROJECT_ROOT)/scr_seq.sha1
+	@touch $@
+endif
+
+ifeq ($(NODEP),)
+include $(wildcard $(SCRIPT_STAMP).d)
+endif
+
+# The mwasm rule scriptasm replaced, kept so that scriptasm's .d files can be
+# checked against it byte for byte: make compare_script_deps. Needs Wine.
+ifeq ($(NODEP),)
+SCRIPT_CMP_DIR  := $(BUILD_DIR)/scr_seq_mwasm
+SCRIPT_CMP_DEPS := $(SCRIPT_SRCS:$(SCRIPT_DIR)/%.s=$(SCRIPT_CMP_DIR)/%.d)
+
+$(SCRIPT_CMP_DIR)/%.d: $(SCRIPT_DIR)/%.s | $(MWAS)
+	@mkdir -p $(SCRIPT_CMP_DIR)
+	$(WINE) $(MWAS) $(MWASFLAGS) -DPM_ASM $(DEPFLAGS) -o $(SCRIPT_CMP_DIR)/$*.o $<
+	@$(call fixdep,$@)
+	@$(SED) -i 's#$(SCRIPT_CMP_DIR)/$*\.o#$(SCRIPT_DIR)/$*.o#; s/\.o/.bin/' $@
+
+.PHONY: compare_script_deps
+compare_script_deps: $(SCRIPT_STAMP) $(SCRIPT_CMP_DEPS)
+	@status=0; \
+	for src in $(SCRIPT_SRCS); do \
+		name=$$(basename $$src .s); \
+		if ! cmp -s $(SCRIPT_CMP_DIR)/$$name.d $(SCRIPT_DIR)/$$name.d; then \
+			echo "$(SCRIPT_DIR)/$$name.d differs from mwasm's:"; \
+			diff $(SCRIPT_CMP_DIR)/$$name.d $(SCRIPT_DIR)/$$name.d | head -n 8; \
+			status=1; \
+		fi; \
+	done; \
+	exit $$status
 endif
 
 # Once this has been reversed, uncomment the below
-FS_CLEAN_TARGETS += $(SCRIPT_NARC) $(SCRIPT_BINS) $(SCRIPT_OBJS) $(SCRIPT_DEPS)
+FS_CLEAN_TARGETS += $(SCRIPT_NARC) $(SCRIPT_BINS) $(SCRIPT_OBJS) $(SCRIPT_DEPS) \
+	$(SCRIPT_STAMP) $(SCRIPT_STAMP).d $(SCRIPT_VERIFY_STAMP)
@@ -0,0 +1,8141 @@
+//
+// DO NOT MODIFY THIS FILE! It is auto-generated from files/poketool/trainer/trainers.json and Inja template files/poketool/trainer/trdata.json.txt
+//
+
+
+#include "trainer_data.h"
+#include "constants/items.h"
+#include "constants/trainer_class.h"
+
+typedef struct TrainerDataFile {
+    u8 trainerType;
+    u8 trainerClass;
+    u8 unk_2; // unused
+    u8 npoke;
+    u16 items[4];
+    u32 ai_flags;
+    u32 doubleBattle;
+} TRAINER_FILE;
+
+size_t __size = sizeof(TRAINER_FILE);
+
+const TRAINER_FILE __data[] = {
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_PKMN_TRAINER_ETHAN,
+		0,
+		0,
+		{
+			ITEM_NONE
+		},
+		0,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_RIVAL,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		35,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_RIVAL,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_RIVAL,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BUG_CATCHER,
+		0,
+		4,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BEAUTY,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_POLICEMAN,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_JUGGLER,
+		0,
+		4,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_YOUNGSTER,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SWIMMER_F,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_TWINS,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		2
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_KIMONO_GIRL,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_TEAM_ROCKET,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_TEAM_ROCKET_F,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BURGLAR,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_FIREBREATHER,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SWIMMER_M,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BLACK_BELT,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		33,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_FISHERMAN,
+		0,
+		4,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BIKER,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON_ITEM_MOVES,
+		TRAINERCLASS_LEADER_FALKNER,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		3,
+		0
+	},
+	{
+		TRTYPE_MON_ITEM_MOVES,
+		TRAINERCLASS_LEADER_BUGSY,
+		0,
+		3,
+		{
+			ITEM_SUPER_POTION, 
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_LASS,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_POKE_MANIAC,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		33,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SCHOOL_KID_M,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_HIKER,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		33,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_CAMPER,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_PICNICKER,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_ACE_TRAINER_M,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BIRD_KEEPER_GS,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON_ITEM_MOVES,
+		TRAINERCLASS_LEADER_WHITNEY,
+		0,
+		2,
+		{
+			ITEM_SUPER_POTION, ITEM_SUPER_POTION, 
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_ITEM_MOVES,
+		TRAINERCLASS_LEADER_MORTY,
+		0,
+		4,
+		{
+			ITEM_HYPER_POTION, ITEM_HYPER_POTION, 
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_ITEM_MOVES,
+		TRAINERCLASS_LEADER_PRYCE,
+		0,
+		3,
+		{
+			ITEM_HYPER_POTION, ITEM_FULL_RESTORE, 
+		},
+		519,
+		0
+	},
+	{
+		TRTYPE_MON_ITEM_MOVES,
+		TRAINERCLASS_LEADER_JASMINE,
+		0,
+		3,
+		{
+			ITEM_HYPER_POTION, ITEM_HYPER_POTION, 
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_ITEM_MOVES,
+		TRAINERCLASS_LEADER_CHUCK,
+		0,
+		2,
+		{
+			ITEM_HYPER_POTION, ITEM_HYPER_POTION, 
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON_ITEM_MOVES,
+		TRAINERCLASS_LEADER_CLAIR,
+		0,
+		4,
+		{
+			ITEM_HYPER_POTION, ITEM_FULL_RESTORE, 
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_ACE_TRAINER_F,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_GENTLEMAN,
+		0,
+		2,
+		{
+			ITEM_FULL_RESTORE, 
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_TEACHER,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SAILOR,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SUPER_NERD,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_GUITARIST,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_PSYCHIC_M,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SAGE,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_POKEFAN_M,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_POKEFAN,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_MEDIUM,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_YOUNGSTER,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BUG_CATCHER,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_YOUNGSTER,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BIRD_KEEPER_GS,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SAGE,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SAGE,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SAGE,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SAGE,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SAGE,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_YOUNGSTER,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_FISHERMAN,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_FISHERMAN,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_FISHERMAN,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_FISHERMAN,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_HIKER,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		33,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_YOUNGSTER,
+		0,
+		4,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_TEAM_ROCKET,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_YOUNGSTER,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_PICNICKER,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_CAMPER,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BUG_CATCHER,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BUG_CATCHER,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BUG_CATCHER,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_BEAUTY,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_LASS,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BIRD_KEEPER_GS,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BIRD_KEEPER_GS,
+		0,
+		5,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_CAMPER,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_CAMPER,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_PICNICKER,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_PICNICKER,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BUG_CATCHER,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BUG_CATCHER,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_POLICEMAN,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_TWINS,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		2
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BIRD_KEEPER_GS,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_PICNICKER,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_CAMPER,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SWIMMER_F,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_SWIMMER_M,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SAGE,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SAGE,
+		0,
+		5,
+		{
+			ITEM_NONE
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_MEDIUM,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_SWIMMER_F,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_SWIMMER_F,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SWIMMER_F,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SWIMMER_F,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_SWIMMER_F,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SWIMMER_M,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SWIMMER_M,
+		0,
+		6,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SWIMMER_M,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SWIMMER_M,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SWIMMER_M,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_HIKER,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		33,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_TEAM_ROCKET,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_ACE_TRAINER_M,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_ACE_TRAINER_M,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_ACE_TRAINER_M,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_ACE_TRAINER_M,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_ACE_TRAINER_M,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_ACE_TRAINER_M,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_ACE_TRAINER_M,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_ACE_TRAINER_M,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_ACE_TRAINER_M,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_ACE_TRAINER_M,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_ACE_TRAINER_M,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_ACE_TRAINER_F,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_ACE_TRAINER_F,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_ACE_TRAINER_F,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_ACE_TRAINER_F,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_ACE_TRAINER_F,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_ACE_TRAINER_F,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_ACE_TRAINER_F,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_ACE_TRAINER_F,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_ACE_TRAINER_F,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_FISHERMAN,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_FISHERMAN,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_FISHERMAN,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_FISHERMAN,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_FISHERMAN,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_FISHERMAN,
+		0,
+		4,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_FISHERMAN,
+		0,
+		4,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_POKE_MANIAC,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		33,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_POKE_MANIAC,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		33,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_POKE_MANIAC,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		33,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_POKE_MANIAC,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		33,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_POKE_MANIAC,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		33,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_HIKER,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		33,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SCHOOL_KID_M,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_LASS,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BIRD_KEEPER_GS,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_CAMPER,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_PICNICKER,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BUG_CATCHER,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_CAMPER,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_PICNICKER,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_HIKER,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		33,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_HIKER,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		33,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_HIKER,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		33,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_HIKER,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		33,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_CAMPER,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_CAMPER,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_CAMPER,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_CAMPER,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_PICNICKER,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_PICNICKER,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_PICNICKER,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_HIKER,
+		0,
+		5,
+		{
+			ITEM_NONE
+		},
+		33,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_HIKER,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		33,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_BLACK_BELT,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		33,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_BLACK_BELT,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		33,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BLACK_BELT,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		33,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BLACK_BELT,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		33,
+		0
+	},
+	{
+		TRTYPE_MON_ITEM_MOVES,
+		TRAINERCLASS_KIMONO_GIRL,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_ITEM_MOVES,
+		TRAINERCLASS_KIMONO_GIRL,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_ITEM_MOVES,
+		TRAINERCLASS_KIMONO_GIRL,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_ITEM_MOVES,
+		TRAINERCLASS_KIMONO_GIRL,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_ITEM_MOVES,
+		TRAINERCLASS_KIMONO_GIRL,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SWIMMER_F,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SWIMMER_F,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SWIMMER_F,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SWIMMER_M,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SWIMMER_M,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SWIMMER_M,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SWIMMER_M,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_POKE_MANIAC,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		33,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_POKE_MANIAC,
+		0,
+		4,
+		{
+			ITEM_NONE
+		},
+		33,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BIKER,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_MEDIUM,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_MEDIUM,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_MEDIUM,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SCHOOL_KID_M,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SCHOOL_KID_M,
+		0,
+		4,
+		{
+			ITEM_NONE
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BEAUTY,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_POKEFAN_M,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_POKEFAN,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_LASS,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_LASS,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_TEAM_ROCKET,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_TEAM_ROCKET,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_TEAM_ROCKET,
+		0,
+		5,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_TEAM_ROCKET,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_TEAM_ROCKET,
+		0,
+		4,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_TEAM_ROCKET,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_TEAM_ROCKET,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_TEAM_ROCKET,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_TEAM_ROCKET,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_TEAM_ROCKET,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_TEAM_ROCKET,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_TEAM_ROCKET,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_TEAM_ROCKET,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_TEAM_ROCKET_F,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_TEAM_ROCKET_F,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_TEAM_ROCKET_F,
+		0,
+		4,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_POKE_MANIAC,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		33,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_POKE_MANIAC,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		33,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_HIKER,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		33,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_HIKER,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		33,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_ACE_TRAINER_M,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_ACE_TRAINER_F,
+		0,
+		4,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BEAUTY,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BEAUTY,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BEAUTY,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BEAUTY,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SAILOR,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SAILOR,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_SAILOR,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SAILOR,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_LASS,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_TEAM_ROCKET,
+		0,
+		4,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BIRD_KEEPER_GS,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_TEAM_ROCKET,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_TEAM_ROCKET,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_TEAM_ROCKET,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_TEAM_ROCKET,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_TEAM_ROCKET,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_TEAM_ROCKET,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_TEAM_ROCKET,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_TEAM_ROCKET,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_TEAM_ROCKET,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_TEAM_ROCKET,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_TEAM_ROCKET,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_TEAM_ROCKET,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_PSYCHIC_M,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		3,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_GENTLEMAN,
+		0,
+		1,
+		{
+			ITEM_FULL_RESTORE, 
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_GUITARIST,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SUPER_NERD,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_HIKER,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		33,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_HIKER,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		33,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_ACE_TRAINER_M,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_ACE_TRAINER_F,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SAILOR,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SAILOR,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SAILOR,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SAILOR,
+		0,
+		4,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_JUGGLER,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SWIMMER_F,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON_ITEM_MOVES,
+		TRAINERCLASS_CHAMPION,
+		0,
+		6,
+		{
+			ITEM_FULL_RESTORE, ITEM_FULL_RESTORE, ITEM_FULL_RESTORE, ITEM_FULL_RESTORE, 
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_ITEM_MOVES,
+		TRAINERCLASS_ELITE_FOUR_WILL,
+		0,
+		5,
+		{
+			ITEM_FULL_RESTORE, ITEM_FULL_RESTORE, 
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_ITEM_MOVES,
+		TRAINERCLASS_ELITE_FOUR_KAREN,
+		0,
+		5,
+		{
+			ITEM_FULL_RESTORE, ITEM_FULL_RESTORE, 
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_ITEM_MOVES,
+		TRAINERCLASS_ELITE_FOUR_KOGA,
+		0,
+		5,
+		{
+			ITEM_FULL_RESTORE, ITEM_FULL_RESTORE, 
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BUG_CATCHER,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BUG_CATCHER,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BLACK_BELT,
+		0,
+		4,
+		{
+			ITEM_NONE
+		},
+		33,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_BLACK_BELT,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		33,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SWIMMER_M,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON_ITEM_MOVES,
+		TRAINERCLASS_LEADER_BROCK,
+		0,
+		5,
+		{
+			ITEM_FULL_RESTORE, ITEM_FULL_RESTORE, ITEM_FULL_RESTORE, 
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_ITEM_MOVES,
+		TRAINERCLASS_LEADER_MISTY,
+		0,
+		4,
+		{
+			ITEM_FULL_RESTORE, ITEM_FULL_RESTORE, ITEM_FULL_RESTORE, 
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_ITEM_MOVES,
+		TRAINERCLASS_LEADER_LT_SURGE,
+		0,
+		5,
+		{
+			ITEM_FULL_RESTORE, ITEM_FULL_RESTORE, ITEM_FULL_RESTORE, 
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_ITEM_MOVES,
+		TRAINERCLASS_LEADER_ERIKA,
+		0,
+		4,
+		{
+			ITEM_FULL_RESTORE, ITEM_FULL_RESTORE, ITEM_FULL_RESTORE, 
+		},
+		519,
+		0
+	},
+	{
+		TRTYPE_MON_ITEM_MOVES,
+		TRAINERCLASS_LEADER_JANINE,
+		0,
+		5,
+		{
+			ITEM_FULL_RESTORE, ITEM_FULL_RESTORE, ITEM_FULL_RESTORE, 
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_ITEM_MOVES,
+		TRAINERCLASS_LEADER_SABRINA,
+		0,
+		3,
+		{
+			ITEM_FULL_RESTORE, ITEM_FULL_RESTORE, ITEM_FULL_RESTORE, 
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_ITEM_MOVES,
+		TRAINERCLASS_LEADER_BLAINE,
+		0,
+		3,
+		{
+			ITEM_FULL_RESTORE, ITEM_FULL_RESTORE, ITEM_FULL_RESTORE, 
+		},
+		519,
+		0
+	},
+	{
+		TRTYPE_MON_ITEM_MOVES,
+		TRAINERCLASS_PKMN_TRAINER_RED,
+		0,
+		6,
+		{
+			ITEM_FULL_RESTORE, ITEM_FULL_RESTORE, ITEM_FULL_RESTORE, ITEM_FULL_RESTORE, 
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_ITEM_MOVES,
+		TRAINERCLASS_LEADER_BLUE,
+		0,
+		6,
+		{
+			ITEM_FULL_RESTORE, ITEM_FULL_RESTORE, ITEM_FULL_RESTORE, ITEM_FULL_RESTORE, 
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_TEAM_ROCKET,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_RIVAL,
+		0,
+		4,
+		{
+			ITEM_NONE
+		},
+		35,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_RIVAL,
+		0,
+		6,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_RIVAL,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_RIVAL,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		35,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_RIVAL,
+		0,
+		4,
+		{
+			ITEM_NONE
+		},
+		35,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_RIVAL,
+		0,
+		6,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_RIVAL,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		35,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_RIVAL,
+		0,
+		4,
+		{
+			ITEM_NONE
+		},
+		35,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_RIVAL,
+		0,
+		5,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_RIVAL,
+		0,
+		6,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SWIMMER_M,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_CAMPER,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_CAMPER,
+		0,
+		4,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_PICNICKER,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_PICNICKER,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BLACK_BELT,
+		0,
+		4,
+		{
+			ITEM_NONE
+		},
+		33,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_YOUNGSTER,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_YOUNGSTER,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_FIREBREATHER,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_FIREBREATHER,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_BURGLAR,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BURGLAR,
+		0,
+		4,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_RIVAL,
+		0,
+		6,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_RIVAL,
+		0,
+		6,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_RIVAL,
+		0,
+		6,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_RIVAL,
+		0,
+		5,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_RIVAL,
+		0,
+		5,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_ELDER,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SWIMMER_F,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SWIMMER_F,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SWIMMER_F,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_SWIMMER_F,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SWIMMER_F,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SWIMMER_F,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_SWIMMER_F,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_SWIMMER_F,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BIRD_KEEPER_GS,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BIRD_KEEPER_GS,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BIRD_KEEPER_GS,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BIRD_KEEPER_GS,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BIRD_KEEPER_GS,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_CAMPER,
+		0,
+		4,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_CAMPER,
+		0,
+		4,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_CAMPER,
+		0,
+		4,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_CAMPER,
+		0,
+		4,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_CAMPER,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BIKER,
+		0,
+		4,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BIKER,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BIKER,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BIKER,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BIKER,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BIKER,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BIKER,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_PSYCHIC_M,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_PSYCHIC_M,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_FIREBREATHER,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_FIREBREATHER,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_FISHERMAN,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_FISHERMAN,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_FISHERMAN,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_FISHERMAN,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_FISHERMAN,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_FISHERMAN,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_TWINS,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		2
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SCHOOL_KID_M,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_SCHOOL_KID_M,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON_ITEM,
+		TRAINERCLASS_SCHOOL_KID_M,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_ITEM,
+		TRAINERCLASS_SCHOOL_KID_M,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SCHOOL_KID_M,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_PICNICKER,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_PICNICKER,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_PICNICKER,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_PICNICKER,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_PICNICKER,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_GENTLEMAN,
+		0,
+		3,
+		{
+			ITEM_FULL_RESTORE, 
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_GENTLEMAN,
+		0,
+		1,
+		{
+			ITEM_FULL_RESTORE, 
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BLACK_BELT,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		33,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BEAUTY,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BEAUTY,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BEAUTY,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BEAUTY,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BEAUTY,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BEAUTY,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_BEAUTY,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BEAUTY,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_POKEFAN_M,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_POKEFAN_M,
+		0,
+		6,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_POKEFAN_M,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_POKEFAN_M,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_POKEFAN,
+		0,
+		5,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_TEAM_ROCKET,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON_ITEM,
+		TRAINERCLASS_LASS,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_LASS,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_LASS,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		517,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_HIKER,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		33,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_HIKER,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		33,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_HIKER,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		33,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BUG_CATCHER,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_ACE_TRAINER_M,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_ACE_TRAINER_F,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		519,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_ACE_TRAINER_F,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_ITEM,
+		TRAINERCLASS_SUPER_NERD,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SUPER_NERD,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON_ITEM_MOVES,
+		TRAINERCLASS_SUPER_NERD,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON_ITEM,
+		TRAINERCLASS_SUPER_NERD,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_MEDIUM,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		3,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_MEDIUM,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SWIMMER_M,
+		0,
+		4,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SWIMMER_M,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SWIMMER_M,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SWIMMER_M,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_SWIMMER_M,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SWIMMER_M,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SWIMMER_M,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_SWIMMER_M,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_YOUNGSTER,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_YOUNGSTER,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_YOUNGSTER,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_YOUNGSTER,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_TEACHER,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BIRD_KEEPER_GS,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_HIKER,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		33,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_TWINS,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		2
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_PSYCHIC_M,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_TWINS,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		2
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_FIREBREATHER,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_PSYCHIC_M,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_FIREBREATHER,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_POKE_MANIAC,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		33,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_POKE_MANIAC,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		33,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SUPER_NERD,
+		0,
+		4,
+		{
+			ITEM_NONE
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_ACE_TRAINER_M,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_PSYCHIC_M,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_JUGGLER,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SCHOOL_KID_M,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_BEAUTY,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_FIREBREATHER,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_LASS,
+		0,
+		2,
+		{
+			ITEM_MOOMOO_MILK, 
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_GENTLEMAN,
+		0,
+		1,
+		{
+			ITEM_FULL_RESTORE, 
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_PICNICKER,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_CAMPER,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_TEAM_ROCKET_F,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_PSYCHIC_M,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_POKE_MANIAC,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		33,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_ACE_TRAINER_M,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_ACE_TRAINER_F,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_POKEFAN_M,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_SAILOR,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_PSYCHIC_M,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_PSYCHIC_M,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_FISHERMAN,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BIRD_KEEPER_GS,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_PSYCHIC_M,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_TWINS,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		2
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_ACE_TRAINER_F,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_ITEM_MOVES,
+		TRAINERCLASS_ELITE_FOUR_BRUNO,
+		0,
+		5,
+		{
+			ITEM_FULL_RESTORE, ITEM_FULL_RESTORE, 
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_LASS,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BIRD_KEEPER_GS,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BIRD_KEEPER_GS,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_PSYCHIC_M,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_POKEFAN_M,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_POKEFAN_M,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_TWINS,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		2
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_TWINS,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		2
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_TEACHER,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SCHOOL_KID_M,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		69,
+		0
+	},
+	{
+		TRTYPE_MON_ITEM,
+		TRAINERCLASS_SCHOOL_KID_M,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SCHOOL_KID_M,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SCHOOL_KID_M,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SCHOOL_KID_M,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SCHOOL_KID_M,
+		0,
+		4,
+		{
+			ITEM_NONE
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SCHOOL_KID_M,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SCHOOL_KID_M,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_POKEFAN,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_POKEFAN,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_POKEFAN_M,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_POKEFAN_M,
+		0,
+		4,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SAILOR,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SAILOR,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_LASS,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_LASS,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_ACE_TRAINER_F,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_ACE_TRAINER_F,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BIRD_KEEPER_GS,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BIRD_KEEPER_GS,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BIRD_KEEPER_GS,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_BUG_CATCHER,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_FISHERMAN,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_HIKER,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		33,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_HIKER,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		33,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_PICNICKER,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_JUGGLER,
+		0,
+		4,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_JUGGLER,
+		0,
+		4,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_ACE_TRAINER_M,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_ACE_TRAINER_M,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_ACE_TRAINER_F,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_ACE_TRAINER_F,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_BUG_CATCHER,
+		0,
+		4,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_BUG_CATCHER,
+		0,
+		4,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_FISHERMAN,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_FISHERMAN,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_LASS,
+		0,
+		2,
+		{
+			ITEM_MOOMOO_MILK, 
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_LASS,
+		0,
+		2,
+		{
+			ITEM_MOOMOO_MILK, 
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_PICNICKER,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_PICNICKER,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SCIENTIST_GS,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SCIENTIST_GS,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SCIENTIST_GS,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SCIENTIST_GS,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_SCIENTIST_GS,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SUPER_NERD,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SUPER_NERD,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SUPER_NERD,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SUPER_NERD,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_SUPER_NERD,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_EXECUTIVE_ARIANA,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_EXECUTIVE_ARIANA,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SKIER,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SKIER,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BOARDER,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BOARDER,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_BOARDER,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_EXECUTIVE_ARCHER,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_EXECUTIVE_PROTON,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_EXECUTIVE_PETREL,
+		0,
+		6,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_EXECUTIVE_PETREL,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_RIVAL,
+		0,
+		6,
+		{
+			ITEM_FULL_RESTORE, ITEM_FULL_RESTORE, 
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_RIVAL,
+		0,
+		6,
+		{
+			ITEM_FULL_RESTORE, ITEM_FULL_RESTORE, 
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_ITEM_MOVES,
+		TRAINERCLASS_RIVAL,
+		0,
+		6,
+		{
+			ITEM_FULL_RESTORE, ITEM_FULL_RESTORE, 
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_POKEFAN_M,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_MEDIUM,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_MEDIUM,
+		0,
+		5,
+		{
+			ITEM_NONE
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_PASSERBY,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_PASSERBY,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_PASSERBY,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_MYSTERY_MAN,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_TEAM_ROCKET,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_ACE_TRAINER_M,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_ACE_TRAINER_F,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_TWINS,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		2
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_SCHOOL_KID_M,
+		0,
+		3,
+		{
+			ITEM_HYPER_POTION, 
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_SCHOOL_KID_M,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SCHOOL_KID_M,
+		0,
+		4,
+		{
+			ITEM_NONE
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_SCHOOL_KID_M,
+		0,
+		4,
+		{
+			ITEM_NONE
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_SCHOOL_KID_M,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		13,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_SCHOOL_KID_M,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_SAILOR,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_YOUNGSTER,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_YOUNGSTER,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_BUG_CATCHER,
+		0,
+		4,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_BUG_CATCHER,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_BUG_CATCHER,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_FISHERMAN,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_FISHERMAN,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_FISHERMAN,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_PICNICKER,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_PICNICKER,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_PICNICKER,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_PICNICKER,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_PICNICKER,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_HIKER,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		33,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_HIKER,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		33,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_CAMPER,
+		0,
+		4,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_CAMPER,
+		0,
+		4,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_JUGGLER,
+		0,
+		4,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_LASS,
+		0,
+		2,
+		{
+			ITEM_MOOMOO_MILK, 
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_LASS,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_POKE_MANIAC,
+		0,
+		4,
+		{
+			ITEM_NONE
+		},
+		33,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_TWINS,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		2
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_BUG_CATCHER,
+		0,
+		4,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BUG_CATCHER,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BEAUTY,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_POKEFAN,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_CAMPER,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_POKE_MANIAC,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		33,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_SUPER_NERD,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_SUPER_NERD,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_POKEFAN_M,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_POKEFAN_M,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_SAGE,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_SAGE,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_SAGE,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON_ITEM_MOVES,
+		TRAINERCLASS_ACE_TRAINER_M,
+		0,
+		2,
+		{
+			ITEM_DIRE_HIT, 
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_SCHOOL_KID_M,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		71,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_HIKER,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		33,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_BLACK_BELT,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		33,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_DOUBLE_TEAM,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		7,
+		2
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BLACK_BELT,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		33,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_HIKER,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		33,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_YOUNGSTER,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_YOUNG_COUPLE,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		2
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_GENTLEMAN,
+		0,
+		1,
+		{
+			ITEM_FULL_RESTORE, 
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BIRD_KEEPER_GS,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BIRD_KEEPER_GS,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_YOUNG_COUPLE,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		513,
+		2
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_FISHERMAN,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_YOUNG_COUPLE,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		2
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_CAMPER,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_CAMPER,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_PICNICKER,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_PICNICKER,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON_ITEM_MOVES,
+		TRAINERCLASS_TEACHER,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BIRD_KEEPER_GS,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON_ITEM_MOVES,
+		TRAINERCLASS_SCHOOL_KID_M,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SCHOOL_KID_M,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_SCHOOL_KID_M,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_TWINS,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		2
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_POKEFAN_M,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_POKEFAN,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON_ITEM,
+		TRAINERCLASS_BIKER,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BIKER,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BIKER,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BIKER,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BIKER,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BIKER,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BIKER,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BIKER,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON_ITEM_MOVES,
+		TRAINERCLASS_CAMPER,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_PICNICKER,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_PICNICKER,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BIRD_KEEPER_GS,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BIRD_KEEPER_GS,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SWIMMER_M,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SWIMMER_M,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SWIMMER_F,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SWIMMER_F,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_FISHERMAN,
+		0,
+		4,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_FISHERMAN,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_FISHERMAN,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_SWIMMER_F,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SWIMMER_F,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SWIMMER_M,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SWIMMER_M,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BIRD_KEEPER_GS,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BIRD_KEEPER_GS,
+		0,
+		4,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_TWINS,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		2
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_CAMPER,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_PICNICKER,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_TEAM_ROCKET,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BIRD_KEEPER_GS,
+		0,
+		3,
+		{
+			ITEM_X_ATTACK, 
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_PICNICKER,
+		0,
+		4,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_ACE_TRAINER_M,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BLACK_BELT,
+		0,
+		4,
+		{
+			ITEM_NONE
+		},
+		33,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_HIKER,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		33,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_ACE_TRAINER_F,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_FISHERMAN,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_ACE_TRAINER_F,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_POKEFAN_M,
+		0,
+		4,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_POKEFAN,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BIRD_KEEPER_GS,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_LASS,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_LASS,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_LASS,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_YOUNGSTER,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_YOUNGSTER,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_YOUNGSTER,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_FIREBREATHER,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_FIREBREATHER,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_FIREBREATHER,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BUG_CATCHER,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BUG_CATCHER,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BUG_CATCHER,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BUG_CATCHER,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BUG_CATCHER,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BUG_CATCHER,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_BIKER,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_BIKER,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_BIKER,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BIKER,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BIKER,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BIKER,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BIKER,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BIKER,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BIKER,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_TEACHER,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_TEACHER,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_TEACHER,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SCHOOL_KID_M,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SCHOOL_KID_M,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_SCHOOL_KID_M,
+		0,
+		4,
+		{
+			ITEM_NONE
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_TWINS,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		2
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_TWINS,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		2
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_TWINS,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		2
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BIRD_KEEPER_GS,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BIRD_KEEPER_GS,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BIRD_KEEPER_GS,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SCHOOL_KID_M,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SCHOOL_KID_M,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SCHOOL_KID_M,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_YOUNG_COUPLE,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		2
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_YOUNG_COUPLE,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		2
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_YOUNG_COUPLE,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		2
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_HIKER,
+		0,
+		4,
+		{
+			ITEM_NONE
+		},
+		33,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_HIKER,
+		0,
+		4,
+		{
+			ITEM_NONE
+		},
+		33,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_HIKER,
+		0,
+		4,
+		{
+			ITEM_NONE
+		},
+		33,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_CAMPER,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_CAMPER,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_CAMPER,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_FISHERMAN,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_FISHERMAN,
+		0,
+		4,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_FISHERMAN,
+		0,
+		4,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_FISHERMAN,
+		0,
+		4,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_FISHERMAN,
+		0,
+		5,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_FISHERMAN,
+		0,
+		6,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON_ITEM_MOVES,
+		TRAINERCLASS_PKMN_TRAINER_CHERYL,
+		0,
+		5,
+		{
+			ITEM_FULL_RESTORE, ITEM_FULL_RESTORE, 
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_ITEM_MOVES,
+		TRAINERCLASS_PKMN_TRAINER_BUCK,
+		0,
+		5,
+		{
+			ITEM_FULL_RESTORE, ITEM_FULL_RESTORE, 
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_ITEM_MOVES,
+		TRAINERCLASS_PKMN_TRAINER_MARLEY,
+		0,
+		5,
+		{
+			ITEM_FULL_RESTORE, ITEM_FULL_RESTORE, 
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_ITEM_MOVES,
+		TRAINERCLASS_PKMN_TRAINER_RILEY,
+		0,
+		5,
+		{
+			ITEM_FULL_RESTORE, ITEM_FULL_RESTORE, 
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_ITEM_MOVES,
+		TRAINERCLASS_PKMN_TRAINER_MIRA,
+		0,
+		5,
+		{
+			ITEM_FULL_RESTORE, ITEM_FULL_RESTORE, 
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_GENTLEMAN,
+		0,
+		1,
+		{
+			ITEM_FULL_RESTORE, 
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_GENTLEMAN,
+		0,
+		1,
+		{
+			ITEM_FULL_RESTORE, 
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_GENTLEMAN,
+		0,
+		1,
+		{
+			ITEM_FULL_RESTORE, 
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_PKMN_TRAINER_LANCE,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_SAILOR,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_SAILOR,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_SWIMMER_F,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_BEAUTY,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_BEAUTY,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_ACE_TRAINER_M,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_ACE_TRAINER_M,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_ITEM_MOVES,
+		TRAINERCLASS_ACE_TRAINER_F,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_ITEM_MOVES,
+		TRAINERCLASS_DOUBLE_TEAM,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		7,
+		2
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_HIKER,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		33,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BOARDER,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BOARDER,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_SKIER,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_SUPER_NERD,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_SUPER_NERD,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_SUPER_NERD,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_SCIENTIST_GS,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_SCIENTIST_GS,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_SCIENTIST_GS,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BUG_CATCHER,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BUG_CATCHER,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BUG_CATCHER,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BUG_CATCHER,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BUG_CATCHER,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON_ITEM_MOVES,
+		TRAINERCLASS_ROCKET_BOSS,
+		0,
+		4,
+		{
+			ITEM_FULL_RESTORE, 
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_ITEM_MOVES,
+		TRAINERCLASS_CHAMPION,
+		0,
+		6,
+		{
+			ITEM_FULL_RESTORE, ITEM_FULL_RESTORE, ITEM_FULL_RESTORE, ITEM_FULL_RESTORE, 
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_ITEM_MOVES,
+		TRAINERCLASS_ELITE_FOUR_WILL,
+		0,
+		6,
+		{
+			ITEM_FULL_RESTORE, ITEM_FULL_RESTORE, 
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_ITEM_MOVES,
+		TRAINERCLASS_ELITE_FOUR_KOGA,
+		0,
+		6,
+		{
+			ITEM_FULL_RESTORE, ITEM_FULL_RESTORE, 
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_ITEM_MOVES,
+		TRAINERCLASS_ELITE_FOUR_BRUNO,
+		0,
+		6,
+		{
+			ITEM_FULL_RESTORE, ITEM_FULL_RESTORE, 
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_ITEM_MOVES,
+		TRAINERCLASS_ELITE_FOUR_KAREN,
+		0,
+		6,
+		{
+			ITEM_FULL_RESTORE, ITEM_FULL_RESTORE, 
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_EXECUTIVE_PROTON,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_TOWER_TYCOON,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_HALL_MATRON,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_FACTORY_HEAD,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_ARCADE_STAR,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_CASTLE_VALET,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_ITEM_MOVES,
+		TRAINERCLASS_LEADER_FALKNER,
+		0,
+		6,
+		{
+			ITEM_FULL_RESTORE, ITEM_FULL_RESTORE, ITEM_FULL_RESTORE, 
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_ITEM_MOVES,
+		TRAINERCLASS_LEADER_BUGSY,
+		0,
+		6,
+		{
+			ITEM_FULL_RESTORE, ITEM_FULL_RESTORE, ITEM_FULL_RESTORE, 
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_ITEM_MOVES,
+		TRAINERCLASS_LEADER_WHITNEY,
+		0,
+		6,
+		{
+			ITEM_FULL_RESTORE, ITEM_FULL_RESTORE, ITEM_FULL_RESTORE, 
+		},
+		15,
+		0
+	},
+	{
+		TRTYPE_MON_ITEM_MOVES,
+		TRAINERCLASS_LEADER_MORTY,
+		0,
+		6,
+		{
+			ITEM_FULL_RESTORE, ITEM_FULL_RESTORE, ITEM_FULL_RESTORE, 
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_ITEM_MOVES,
+		TRAINERCLASS_LEADER_PRYCE,
+		0,
+		6,
+		{
+			ITEM_FULL_RESTORE, ITEM_FULL_RESTORE, ITEM_FULL_RESTORE, 
+		},
+		519,
+		0
+	},
+	{
+		TRTYPE_MON_ITEM_MOVES,
+		TRAINERCLASS_LEADER_JASMINE,
+		0,
+		6,
+		{
+			ITEM_FULL_RESTORE, ITEM_FULL_RESTORE, ITEM_FULL_RESTORE, 
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_ITEM_MOVES,
+		TRAINERCLASS_LEADER_CHUCK,
+		0,
+		6,
+		{
+			ITEM_FULL_RESTORE, ITEM_FULL_RESTORE, ITEM_FULL_RESTORE, 
+		},
+		5,
+		0
+	},
+	{
+		TRTYPE_MON_ITEM_MOVES,
+		TRAINERCLASS_LEADER_CLAIR,
+		0,
+		6,
+		{
+			ITEM_FULL_RESTORE, ITEM_FULL_RESTORE, ITEM_FULL_RESTORE, 
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_ITEM_MOVES,
+		TRAINERCLASS_LEADER_BROCK,
+		0,
+		6,
+		{
+			ITEM_FULL_RESTORE, ITEM_FULL_RESTORE, ITEM_FULL_RESTORE, 
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_ITEM_MOVES,
+		TRAINERCLASS_LEADER_MISTY,
+		0,
+		6,
+		{
+			ITEM_FULL_RESTORE, ITEM_FULL_RESTORE, ITEM_FULL_RESTORE, 
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_ITEM_MOVES,
+		TRAINERCLASS_LEADER_LT_SURGE,
+		0,
+		6,
+		{
+			ITEM_FULL_RESTORE, ITEM_FULL_RESTORE, ITEM_FULL_RESTORE, 
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_ITEM_MOVES,
+		TRAINERCLASS_LEADER_ERIKA,
+		0,
+		6,
+		{
+			ITEM_FULL_RESTORE, ITEM_FULL_RESTORE, ITEM_FULL_RESTORE, 
+		},
+		519,
+		0
+	},
+	{
+		TRTYPE_MON_ITEM_MOVES,
+		TRAINERCLASS_LEADER_JANINE,
+		0,
+		6,
+		{
+			ITEM_FULL_RESTORE, ITEM_FULL_RESTORE, ITEM_FULL_RESTORE, 
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_ITEM_MOVES,
+		TRAINERCLASS_LEADER_SABRINA,
+		0,
+		6,
+		{
+			ITEM_FULL_RESTORE, ITEM_FULL_RESTORE, ITEM_FULL_RESTORE, 
+		},
+		15,
+		0
+	},
+	{
+		TRTYPE_MON_ITEM_MOVES,
+		TRAINERCLASS_LEADER_BLAINE,
+		0,
+		6,
+		{
+			ITEM_FULL_RESTORE, ITEM_FULL_RESTORE, ITEM_FULL_RESTORE, 
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_ITEM_MOVES,
+		TRAINERCLASS_LEADER_BLUE,
+		0,
+		6,
+		{
+			ITEM_FULL_RESTORE, ITEM_FULL_RESTORE, ITEM_FULL_RESTORE, ITEM_FULL_RESTORE, 
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_BEAUTY,
+		0,
+		1,
+		{
+			ITEM_NONE
+		},
+		1,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_YOUNG_COUPLE,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		1,
+		2
+	},
+	{
+		TRTYPE_MON_MOVES,
+		TRAINERCLASS_DOUBLE_TEAM,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		7,
+		2
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_HIKER,
+		0,
+		3,
+		{
+			ITEM_NONE
+		},
+		33,
+		0
+	},
+	{
+		TRTYPE_MON,
+		TRAINERCLASS_CAMPER,
+		0,
+		2,
+		{
+			ITEM_NONE
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_ITEM_MOVES,
+		TRAINERCLASS_CHAMPION,
+		0,
+		3,
+		{
+			ITEM_FULL_RESTORE, ITEM_FULL_RESTORE, 
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_ITEM_MOVES,
+		TRAINERCLASS_LEADER_CLAIR,
+		0,
+		3,
+		{
+			ITEM_FULL_RESTORE, ITEM_FULL_RESTORE, 
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_ITEM_MOVES,
+		TRAINERCLASS_RIVAL,
+		0,
+		3,
+		{
+			ITEM_FULL_RESTORE, ITEM_FULL_RESTORE, 
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_ITEM_MOVES,
+		TRAINERCLASS_RIVAL,
+		0,
+		3,
+		{
+			ITEM_FULL_RESTORE, ITEM_FULL_RESTORE, 
+		},
+		7,
+		0
+	},
+	{
+		TRTYPE_MON_ITEM_MOVES,
+		TRAINERCLASS_RIVAL,
+		0,
+		3,
+		{
+			ITEM_FULL_RESTORE, ITEM_FULL_RESTORE, 
+		},
+		7,
+		0
+	},
+};
@@ -30,3 +30,21 @@ $(PADDED_LZ_FILES): LZ_FLAGS += -A4
 
 %.lz: %
 	$(NTRCOMP) $(LZ_FLAGS) -o $@ $<
+
+# Rebuilds every NCGR in ncgr.sha1 with each nitrogfx pixel kernel set this
+# machine supports and checks them against it. The sums are from nitrogfx
+# before its kernels were vectorised.
+NCGR_GOLDEN       := $(PROJECT_ROOT)/ncgr.sha1
+NCGR_GOLDEN_FILES  = $(shell cut -d'*' -f2 $(NCGR_GOLDEN))
+
+.PHONY: check-ncgr
+check-ncgr: $(dir $(GFX))
+	@log=$$(mktemp); status=0; \
+	for simd in scalar sse2 avx2; do \
+		if ! NITROGFX_SIMD=$$simd $(MAKE) -B -s --no-print-directory $(NCGR_GOLDEN_FILES) 2>$$log; then \
+			if grep -q "not supported on this machine" $$log; then echo "$$simd: not supported here"; continue; fi; \
+			cat $$log; status=1; break; \
+		fi; \
+		if $(SHA1SUM) --quiet -c $(NCGR_GOLDEN); then echo "$$simd: ok"; else echo "$$simd: FAILED"; status=1; fi; \
+	done; \
+	$(RM) $$log; exit $$status
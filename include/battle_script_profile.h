@@ -0,0 +1,64 @@
+#ifndef POKEHEARTGOLD_BATTLE_SCRIPT_PROFILE_H
+#define POKEHEARTGOLD_BATTLE_SCRIPT_PROFILE_H
+
+#include "battle.h"
+
+// What RunBattleScript records with OPTIMIZE_BATTLE_SCRIPT_PROFILE. The host
+// decoder in tools/bsprof finds sBattleScriptProfile in a RAM dump by its
+// magic and reads it with the same layout, so bump the version on any change.
+// Ticks are OS ticks (64 ARM9 cycles). The overlay's BSS holds the profile, so
+// it covers one battle.
+
+#define BATTLE_SCRIPT_CMD_COUNT               225 // entries in sBattleScriptCommandTable
+
+#define BATTLE_SCRIPT_PROFILE_MAGIC           0x46505342 // "BSPF"
+#define BATTLE_SCRIPT_PROFILE_VERSION         1
+#define BATTLE_SCRIPT_PROFILE_SLOTS           512
+#define BATTLE_SCRIPT_PROFILE_LOG_SIZE        512
+#define BATTLE_SCRIPT_PROFILE_SLOT_NONE       0xFFFF
+
+#define BATTLE_SCRIPT_EVENT_COMMAND           0
+#define BATTLE_SCRIPT_EVENT_ENTER             1 // script loaded by a jump or a subscript call
+#define BATTLE_SCRIPT_EVENT_RETURN            2 // caller reloaded after EndScript
+
+// One script, keyed by the NARC member it was read from
+typedef struct BattleScriptProfileSlot {
+    u16 narcId;
+    u16 fileId;
+    u32 entries;
+    u32 ticks; // spent in commands of this script, not in its subscripts
+} BattleScriptProfileSlot;
+
+// A command's event comes after the ENTER or RETURN events it caused
+typedef struct BattleScriptProfileEvent {
+    u8 kind;
+    u8 cmd;
+    u8 depth; // subscript depth, ctx->unk_B8
+    u8 unused;
+    u16 slot;
+    u16 seqNo; // of the command, or where the loaded script resumes
+    u32 ticks;
+} BattleScriptProfileEvent;
+
+typedef struct BattleScriptProfile {
+    u32 magic;
+    u16 version;
+    u16 numCmds;
+    u16 numSlots;
+    u16 logSize;
+    u16 curSlot;
+    u8 returning;
+    u8 unused;
+    u32 numSlotsUsed;
+    u32 numEvents; // ever logged; the log keeps the last logSize
+    u32 cmdCounts[BATTLE_SCRIPT_CMD_COUNT];
+    u32 cmdTicks[BATTLE_SCRIPT_CMD_COUNT];
+    BattleScriptProfileSlot slots[BATTLE_SCRIPT_PROFILE_SLOTS];
+    BattleScriptProfileEvent log[BATTLE_SCRIPT_PROFILE_LOG_SIZE];
+} BattleScriptProfile;
+
+void BattleScriptProfile_OnLoad(BATTLECONTEXT *ctx);
+void BattleScriptProfile_OnReturn(void);
+void BattleScriptProfile_Reset(void);
+
+#endif //POKEHEARTGOLD_BATTLE_SCRIPT_PROFILE_H
@@ -0,0 +1,61 @@
+#ifndef POKEHEARTGOLD_BATTLER_VAR_H
+#define POKEHEARTGOLD_BATTLER_VAR_H
+
+#include "battle.h"
+#include "constants/battle.h"
+
+// How each BMON_DATA_* value is stored in BATTLEMON, for the table-driven
+// GetBattlerVar and SetBattlerVar (OPTIMIZE_BATTLER_VAR_TABLE), and the
+// call counts OPTIMIZE_BATTLER_VAR_PROFILE keeps. The table itself is in
+// overlay_12_0224E4FC.c, which tools/battlervar builds to check every entry
+// against the old switch.
+
+#define BATTLER_VAR_COUNT           (BMON_DATA_100 + 1)
+
+// How the value is stored
+#define BATTLER_VAR_KIND_NONE       0
+#define BATTLER_VAR_KIND_U8         1
+#define BATTLER_VAR_KIND_S8         2
+#define BATTLER_VAR_KIND_U16        3
+#define BATTLER_VAR_KIND_U32        4 // also int
+#define BATTLER_VAR_KIND_BITS8      5 // bit field in a u8
+#define BATTLER_VAR_KIND_BITS32     6 // bit field in a u32
+
+// What SetBattlerVar reads from data. Not always the stored width: HP is
+// stored as an int but set from an s16, for example.
+#define BATTLER_VAR_SRC_NONE        0
+#define BATTLER_VAR_SRC_U8          1
+#define BATTLER_VAR_SRC_S8          2
+#define BATTLER_VAR_SRC_U16         3
+#define BATTLER_VAR_SRC_S16         4
+#define BATTLER_VAR_SRC_U32         5
+
+// Handled case by case instead of through the table
+#define BATTLER_VAR_GET_SPECIAL     (1 << 0)
+#define BATTLER_VAR_SET_SPECIAL     (1 << 1)
+
+typedef struct BattlerVarDesc {
+    u8 offset;
+    u8 kind;
+    u8 shift; // bit fields only
+    u8 width; // bit fields only
+    u8 src;
+    u8 flags;
+} BattlerVarDesc;
+
+// Per-field counts of GetBattlerVar and SetBattlerVar calls, and the most
+// recent calls, oldest first once the ring has wrapped
+// (OPTIMIZE_BATTLER_VAR_PROFILE). Dump sBattlerVarStats from RAM and pass it
+// to tools/battlervar to replay a real battle.
+#define BATTLER_VAR_TRACE_LEN       512
+#define BATTLER_VAR_TRACE_WRITE     (1 << 15)
+#define BATTLER_VAR_TRACE_BATTLER_SHIFT 8
+
+typedef struct BattlerVarStats {
+    u32 numReads[BATTLER_VAR_COUNT];
+    u32 numWrites[BATTLER_VAR_COUNT];
+    u32 traceCount; // total calls traced; the next one goes to traceCount % BATTLER_VAR_TRACE_LEN
+    u16 trace[BATTLER_VAR_TRACE_LEN]; // varId | battlerId << BATTLER_VAR_TRACE_BATTLER_SHIFT | BATTLER_VAR_TRACE_WRITE
+} BattlerVarStats;
+
+#endif //POKEHEARTGOLD_BATTLER_VAR_H
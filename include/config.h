@@ -44,5 +44,6 @@
 #endif
 
 #include "constants/bugfix.h"
+#include "constants/optimization.h"
 
 #endif //POKEHEARTGOLD_CONFIG_H
@@ -67,8 +67,8 @@ enum Terrain {
 #define MOVE_EFFECT_6                       (1 << 6)
 #define MOVE_EFFECT_7                       (1 << 7)
 #define MOVE_EFFECT_8                       (1 << 8)
-#define MOVE_EFFECT_9                       (1 << 9)
-#define MOVE_EFFECT_10                      (1 << 10)
+#define MOVE_EFFECT_CHARGE                  (1 << 9)
+#define MOVE_EFFECT_INGRAIN                 (1 << 10)
 #define MOVE_EFFECT_11                      (1 << 11)
 #define MOVE_EFFECT_YAWN                    (1 << 12)
 #define MOVE_EFFECT_IMPRISON_USER           (1 << 13)
@@ -90,7 +90,7 @@ enum Terrain {
 #define MOVE_EFFECT_PHANTOM_FORCE           (1 << 29)
 #define MOVE_EFFECT_IMPRISON                (1 << 30)
 
-#define MOVE_EFFECT_BATON_PASSABLE          (MOVE_EFFECT_0 | MOVE_EFFECT_1 | MOVE_EFFECT_LEECH_SEED | MOVE_EFFECT_LOCK_ON | MOVE_EFFECT_PERISH_SONG | MOVE_EFFECT_10 | MOVE_EFFECT_LUCKY_CHANT | MOVE_EFFECT_MUD_SPORT | MOVE_EFFECT_WATER_SPORT | MOVE_EFFECT_GASTRO_ACID | MOVE_EFFECT_POWER_TRICK | MOVE_EFFECT_AQUA_RING | MOVE_EFFECT_HEAL_BLOCK | MOVE_EFECT_26 | MOVE_EFFECT_MAGNET_RISE)    
+#define MOVE_EFFECT_BATON_PASSABLE          (MOVE_EFFECT_0 | MOVE_EFFECT_1 | MOVE_EFFECT_LEECH_SEED | MOVE_EFFECT_LOCK_ON | MOVE_EFFECT_PERISH_SONG | MOVE_EFFECT_INGRAIN | MOVE_EFFECT_LUCKY_CHANT | MOVE_EFFECT_MUD_SPORT | MOVE_EFFECT_WATER_SPORT | MOVE_EFFECT_GASTRO_ACID | MOVE_EFFECT_POWER_TRICK | MOVE_EFFECT_AQUA_RING | MOVE_EFFECT_HEAL_BLOCK | MOVE_EFECT_26 | MOVE_EFFECT_MAGNET_RISE)    
 
 //Field Conditions
 #define FIELD_CONDITION_RAIN                (1 << 0)
@@ -105,6 +105,7 @@ enum Terrain {
 #define FIELD_CONDITION_HAIL                (1 << 6)
 #define FIELD_CONDITION_HAIL_PERMANENT      (1 << 7)
 #define FIELD_CONDITION_HAIL_ALL            (FIELD_CONDITION_HAIL | FIELD_CONDITION_HAIL_PERMANENT)
+#define FIELD_CONDITION_GRAVITY             (7 << 12)
 #define FIELD_CONDITION_FOG                 (1 << 15)
 #define FIELD_CONDITION_WEATHER             (FIELD_CONDITION_RAIN_ALL | FIELD_CONDITION_SANDSTORM_ALL | FIELD_CONDITION_SUN_ALL | FIELD_CONDITION_HAIL_ALL | FIELD_CONDITION_FOG)
 #define FIELD_CONDITION_TRICK_ROOM          (7 << 16)
@@ -120,6 +121,7 @@ enum Terrain {
 #define SIDE_CONDITION_STEALTH_ROCKS        (1 << 7)
 #define SIDE_CONDITION_TAILWIND             (3 << 8)
 #define SIDE_CONDITION_TOXIC_SPIKES         (1 << 10)
+#define SIDE_CONDITION_LUCKY_CHANT          (7 << 12)
 
 //Status
 #define STATUS_NONE                         0
@@ -163,6 +165,7 @@ enum Terrain {
 #define STATUS2_MEAN_LOOK                   (1 << 26)
 #define STATUS2_27                          (1 << 27)
 #define STATUS2_28                          (1 << 28)
+#define STATUS2_FORESIGHT                   (1 << 29)
 #define STATUS2_DEFENCE_CURL                (1 << 30)
 
 #define STATUS2_BINDING_ALL                 (STATUS2_13 | STATUS2_14 | STATUS2_15)
@@ -172,6 +175,35 @@ enum Terrain {
 
 #define STATUS2_BATON_PASSABLE              (STATUS2_0 | STATUS2_1 | STATUS2_2 | STATUS2_FOCUS_ENERGY | STATUS2_24 | STATUS2_MEAN_LOOK | STATUS2_28)
 
+//Link Status
+#define LINK_STATUS_9                       (1 << 9)
+#define LINK_STATUS_NO_TYPE_EFFECT          (1 << 11) //skips STAB and the type chart
+#define LINK_STATUS_FIXED_DAMAGE            (1 << 15)
+
+//Move Status
+#define MOVE_STATUS_SUPER_EFFECTIVE         (1 << 1)
+#define MOVE_STATUS_NOT_EFFECTIVE           (1 << 2)
+#define MOVE_STATUS_NO_EFFECT               (1 << 3)
+#define MOVE_STATUS_LEVITATED               (1 << 11)
+#define MOVE_STATUS_WONDER_GUARD            (1 << 18)
+#define MOVE_STATUS_MAGNET_RISE             (1 << 20)
+
+//Move Class
+#define MOVE_CLASS_PHYSICAL                 0
+#define MOVE_CLASS_SPECIAL                  1
+#define MOVE_CLASS_STATUS                   2
+
+//Move Range
+#define MOVE_RANGE_BOTH_FOES                4
+#define MOVE_RANGE_ALL_ADJACENT             8
+
+//Battle Move Effects (the move data's effect field, not the flags above)
+#define BATTLE_EFFECT_HALVE_DEFENSE         7   //Selfdestruct, Explosion
+#define BATTLE_EFFECT_BRICK_BREAK           186
+
+//Stat Stages
+#define STAT_STAGE_NEUTRAL                  6
+
 //Battle Mon Data
 #define BMON_DATA_SPECIES                    0
 #define BMON_DATA_ATK                        1
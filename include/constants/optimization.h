@@ -0,0 +1,59 @@
+#ifndef POKEHEARTGOLD_CONSTANTS_OPTIMIZATION_H
+#define POKEHEARTGOLD_CONSTANTS_OPTIMIZATION_H
+
+// Runtime optimizations that do not exist in the retail game. Each of these changes the generated code, so
+// the resulting ROM will no longer match. Uncomment the ones you want; common.mk passes the ones that are on to
+// the assembler as well.
+
+// Queue VRAM transfer requests and, once per frame, sort them by destination, drop uploads that a later one
+// fully overwrites and merge contiguous ones before handing them to the NitroSystem transfer manager. The
+// overlays that called NNS_GfdDoVramTransfer directly call GF_DoVramTransfer instead, which flushes the queue.
+//#define OPTIMIZE_VRAM_TRANSFER_QUEUE
+
+// Keep the last few map matrices read from the map_matrix NARC on the field heap, so that warping back and
+// forth between a town and its buildings does not re-read the same members from the card.
+//#define OPTIMIZE_MAP_MATRIX_CACHE
+
+// Start an asynchronous read of the new map's script bank as soon as the map loads, and let every script
+// context started on that map share the copy instead of reading it again. Also replaces the linear scan of
+// the standard script bank table with a binary search.
+//#define OPTIMIZE_SCRIPT_BANK_PREFETCH
+
+// Track active map objects in an index-ordered list, free slots in a second list and active objects by id in a
+// small hash, so that object lookups and iteration cost time proportional to the number of live objects.
+//#define OPTIMIZE_MAP_OBJECT_ACTIVE_LIST
+
+// Keep the last few trainer records and parties read from the trdata/trpoke NARCs on the field heap, so that
+// spotting, battling and paying out a trainer reads each member from the card once.
+//#define OPTIMIZE_TRAINER_DATA_CACHE
+
+// Predict the next overlay from a transition graph and start reading its image in the background while its
+// RAM is free, so that HandleLoadOverlay only has to start it. Every load and its stall time is logged.
+//#define OPTIMIZE_OVERLAY_PREFETCH
+
+// Read the evo NARC into a packed species-indexed table when the field system starts, instead of reading a member
+// on every evolution check, and decrypt the mon once per check rather than once per field.
+//#define OPTIMIZE_EVOLUTION_INDEX
+
+// Track what each sound heap level holds, skip loads of data that is still resident and hold back a level
+// restore when the next load would put the same data straight back. Keeps a trace of heap usage.
+//#define OPTIMIZE_SOUND_HEAP_RESIDENCY
+
+// Fingerprint each normal data array when saving and only write the ones that differ from what the target
+// sector holds. The footer CRC is chained from cached array CRCs, and only arrays whose word sums moved are
+// re-CRCed. tools/savesim checks it against the shipped save path with a power cut at every write boundary.
+//#define OPTIMIZE_SAVE_DIRTY_CHUNKS
+
+// Look GetBattlerVar and SetBattlerVar fields up in an offset/width table built from the BATTLEMON layout
+// instead of switching over every BMON_DATA_* value.
+//#define OPTIMIZE_BATTLER_VAR_TABLE
+
+// Count GetBattlerVar and SetBattlerVar calls per field and keep a trace of the last few for tools/battlervar
+// to replay. Works with or without OPTIMIZE_BATTLER_VAR_TABLE, and costs a few stores on every call.
+//#define OPTIMIZE_BATTLER_VAR_PROFILE
+
+// Count and time every battle script command and subscript entry, and log the last few in a ring buffer that
+// tools/bsprof decodes into a hot-command report or flame graph. Adds a tick read around every command.
+//#define OPTIMIZE_BATTLE_SCRIPT_PROFILE
+
+#endif //POKEHEARTGOLD_CONSTANTS_OPTIMIZATION_H
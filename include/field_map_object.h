@@ -32,6 +32,18 @@ typedef struct SavedMapObject {
     u8 unk40[16];
 } SavedMapObject;
 
+#ifdef OPTIMIZE_MAP_OBJECT_ACTIVE_LIST
+#define MAP_OBJECT_SLOT_NONE      0xFF
+#define MAP_OBJECT_ID_BUCKETS     32
+
+typedef struct MapObjectSlotLinks {
+    u8 next;   // next slot in the active or free list, in index order
+    u8 idNext; // next active slot in the same id bucket, in index order
+    u8 active;
+    u8 padding;
+} MapObjectSlotLinks;
+#endif //OPTIMIZE_MAP_OBJECT_ACTIVE_LIST
+
 struct MapObjectMan { //declared field_system.h
     u32 flags;
     u32 object_count;
@@ -43,6 +55,12 @@ struct MapObjectMan { //declared field_system.h
     u8 unk1C[0x124-0x1C];
     LocalMapObject* objects;
     FieldSystem* fsys;
+#ifdef OPTIMIZE_MAP_OBJECT_ACTIVE_LIST
+    MapObjectSlotLinks* links;
+    u8 activeHead;
+    u8 freeHead;
+    u8 idBuckets[MAP_OBJECT_ID_BUCKETS];
+#endif //OPTIMIZE_MAP_OBJECT_ACTIVE_LIST
 }; // size: 0x12c
 
 typedef void (*LocalMapObject_UnkCallback)(LocalMapObject* object);
@@ -57,6 +57,10 @@ BOOL TryStartMapScriptByType(FieldSystem *fsys, u8 type);
 BOOL MapSceneScriptCheck(FieldSystem *fsys);
 u16 GetMapLoadScriptId(u8 *header, u8 type);
 u16 GetMapSceneScriptId(FieldSystem *fsys, u8 *header, u8 type);
+#ifdef OPTIMIZE_SCRIPT_BANK_PREFETCH
+void FieldSys_PrefetchMapScripts(u32 mapno);
+void FieldSys_FreeScriptPrefetch(void);
+#endif //OPTIMIZE_SCRIPT_BANK_PREFETCH
 void* FieldSysGetAttrAddr(FieldSystem *fsys, enum ScriptEnvField field);
 
 
@@ -20,11 +20,31 @@ typedef struct MAPMATRIXDATA {
     u8 name[MAP_MATRIX_MAX_NAME_LENGTH];
 } MAPMATRIXDATA;
 
+#ifdef OPTIMIZE_MAP_MATRIX_CACHE
+#define MAP_MATRIX_CACHE_SIZE 4
+
+typedef struct MAPMATRIXCACHEENTRY {
+    u8* buffer; // raw map_matrix member, NULL if the slot is free
+    u16 matrix_id;
+    u16 last_used;
+} MAPMATRIXCACHEENTRY;
+
+typedef struct MAPMATRIXCACHE {
+    MAPMATRIXCACHEENTRY entries[MAP_MATRIX_CACHE_SIZE];
+    u16 clock;
+    u16 hits;
+    u16 misses;
+} MAPMATRIXCACHE;
+#endif //OPTIMIZE_MAP_MATRIX_CACHE
+
 typedef struct MAPMATRIX {
     u8 width;
     u8 height;
     u8 matrix_id;
     MAPMATRIXDATA data;
+#ifdef OPTIMIZE_MAP_MATRIX_CACHE
+    MAPMATRIXCACHE cache;
+#endif //OPTIMIZE_MAP_MATRIX_CACHE
 } MAPMATRIX;
 
 MAPMATRIX* MapMatrix_New(void);
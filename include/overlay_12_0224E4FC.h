@@ -14,6 +14,10 @@ BOOL Link_QueueNotEmpty(BATTLECONTEXT *ctx);
 void ov12_0224EDC0(BATTLECONTEXT *ctx, int battlerId);
 int GetBattlerVar(BATTLECONTEXT *ctx, int battlerId, u32 varId, void *data);
 void SetBattlerVar(BATTLECONTEXT *ctx, int battlerId, u32 varId, void *data);
+#ifdef OPTIMIZE_BATTLER_VAR_PROFILE
+u32 BattlerVar_GetAccessCount(u32 varId, BOOL write);
+void BattlerVar_ResetStats(void);
+#endif //OPTIMIZE_BATTLER_VAR_PROFILE
 void ov12_0224F794(BATTLECONTEXT *ctx, int battlerId, u32 varId, int data);
 void AddBattlerVar(BATTLEMON *mon, u32 varId, int data);
 u8 ov12_0224FC48(BattleSystem *bsys, BATTLECONTEXT *ctx, int battlerId1, int battlerId2, int flag);
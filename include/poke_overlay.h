@@ -9,5 +9,8 @@ typedef enum PMOverlayLoadType {
 
 void UnloadOverlayByID(FSOverlayID ovyId);
 BOOL HandleLoadOverlay(FSOverlayID ovyId, PMOverlayLoadType loadType);
+#ifdef OPTIMIZE_OVERLAY_PREFETCH
+void HandleOverlayPrefetch(void);
+#endif //OPTIMIZE_OVERLAY_PREFETCH
 
 #endif //POKEHEARTGOLD_POKE_OVERLAY_H
@@ -182,6 +182,10 @@ u32 ChangePersonalityToNatureGenderAndAbility(u32 pid, u16 species, u8 nature, u
 void LoadMonPersonal(int species, BASE_STATS *personal);
 void LoadMonBaseStats_HandleAlternateForme(int species, int forme, BASE_STATS *personal);
 void LoadMonEvolutionTable(u16 species, struct Evolution *evo);
+#ifdef OPTIMIZE_EVOLUTION_INDEX
+void EvolutionIndex_Init(HeapID heap_id);
+void EvolutionIndex_Free(void);
+#endif //OPTIMIZE_EVOLUTION_INDEX
 void MonEncryptSegment(void *data, u32 size, u32 seed);
 void MonDecryptSegment(void *data, u32 size, u32 seed);
 u32 CalcMonChecksum(void * _data, u32 size);
@@ -61,6 +61,38 @@ struct AsyncWriteManager {
     u32 state_sub;
 };
 
+#ifdef OPTIMIZE_SAVE_DIRTY_CHUNKS
+// Two running sums over an array's words, cheap enough to take on every save, and the array's CRC. The CRC is
+// only recomputed when the sums have moved since the last save.
+struct SaveArrayFingerprint {
+    u32 sum;
+    u32 sumOfSums;
+    u16 crc;
+    u16 padding_A;
+};
+
+// What the last save did with the normal data block
+struct SaveDirtyChunkStats {
+    u32 bytesWritten;
+    u32 bytesSkipped;
+    u32 bytesCrced;
+};
+
+// Fingerprints of the normal data arrays as they are in RAM and as they are in each flash sector, so that a
+// save only writes the arrays that differ from what the target sector already holds.
+struct SaveDirtyChunks {
+    struct SaveArrayFingerprint current[SAVE_BLOCK_NUM];
+    struct SaveArrayFingerprint sector[2][SAVE_BLOCK_NUM];
+    u16 crcShift[SAVE_BLOCK_NUM]; // x^(8 * size) mod the CRC polynomial, used to chain array CRCs
+    u8 sectorKnown[2];
+    u8 currentKnown;
+    u8 numArrays;
+    u8 nextArray;
+    BOOL planned;
+    struct SaveDirtyChunkStats stats;
+};
+#endif //OPTIMIZE_SAVE_DIRTY_CHUNKS
+
 typedef struct SaveData {
     BOOL flashChipDetected;
     BOOL saveFileExists;
@@ -81,7 +113,10 @@ typedef struct SaveData {
     u16 nextBoxToWrite;
     u8 sectorCleanFlag[2];
     u16 lastGoodSector;
-} SaveData; // size=0x2330C
+#ifdef OPTIMIZE_SAVE_DIRTY_CHUNKS
+    struct SaveDirtyChunks dirtyChunks;
+#endif //OPTIMIZE_SAVE_DIRTY_CHUNKS
+} SaveData; // size=0x2330C without OPTIMIZE_SAVE_DIRTY_CHUNKS
 
 struct SaveSlotCheck {
     BOOL valid;
@@ -116,5 +151,8 @@ void *ReadExtraSaveChunk(SaveData *saveData, HeapID heapId, int idx, int *ret_p)
 void *sub_020284A4(SaveData *saveData, HeapID heapId, int idx, int *ret_p, int *ret2_p);
 BOOL SaveSubstruct_AssertCRC(int idx);
 void SaveSubstruct_UpdateCRC(int idx);
+#ifdef OPTIMIZE_SAVE_DIRTY_CHUNKS
+void Save_GetDirtyChunkStats(SaveData *saveData, struct SaveDirtyChunkStats *stats);
+#endif //OPTIMIZE_SAVE_DIRTY_CHUNKS
 
 #endif //POKEHEARTGOLD_SAVE_H
@@ -171,6 +171,9 @@ struct ScriptContext {
     MSGDATA *msgdata;
     u8 *mapScripts;
     FieldSystem *fsys;
+#ifdef OPTIMIZE_SCRIPT_BANK_PREFETCH
+    BOOL mapScriptsShared; // mapScripts belongs to the script bank prefetcher
+#endif //OPTIMIZE_SCRIPT_BANK_PREFETCH
 };
 
 void InitScriptContext(ScriptContext *ctx, const ScrCmdFunc *cmd_table, u32 cmd_count);
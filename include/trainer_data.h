@@ -110,6 +110,11 @@ void TrainerData_ReadTrPoke(u32 idx, TRPOKE * dest);
 void CreateNPCTrainerParty(BATTLE_SETUP *enemies, int party_id, HeapID heap_id);
 void TrMon_OverridePidGender(int species, int forme, int overrideParam, u32 *pid);
 void TrMon_FrustrationCheckAndSetFriendship(Pokemon *mon);
+
+#ifdef OPTIMIZE_TRAINER_DATA_CACHE
+void TrainerDataCache_Init(HeapID heap_id);
+void TrainerDataCache_Free(void);
+#endif //OPTIMIZE_TRAINER_DATA_CACHE
 #endif //PM_ASM
 
 #endif //POKEHEARTGOLD_TRAINER_DATA_H
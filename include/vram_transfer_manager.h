@@ -1,10 +1,28 @@
 #ifndef POKEHEARTGOLD_VRAM_TRANSFER_MANAGER_H
 #define POKEHEARTGOLD_VRAM_TRANSFER_MANAGER_H
 
+#ifdef OPTIMIZE_VRAM_TRANSFER_QUEUE
+typedef struct GF_VramTransferStats {
+    u32 numRequested;    // tasks submitted since the last flush
+    u32 numIssued;       // tasks handed to NNS after coalescing
+    u32 numMerged;       // tasks folded into a contiguous neighbour
+    u32 numDropped;      // tasks fully overwritten by a later one
+    u32 bytesRequested;
+    u32 bytesIssued;
+    u32 peakBytesIssued; // worst frame since the manager was created
+    u32 peakNumIssued;
+} GF_VramTransferStats;
+#endif //OPTIMIZE_VRAM_TRANSFER_QUEUE
+
 typedef struct {
     u32 nMax;
     u32 nCur;
     NNSGfdVramTransferTask *tasks;
+#ifdef OPTIMIZE_VRAM_TRANSFER_QUEUE
+    NNSGfdVramTransferTask *pending;
+    GF_VramTransferStats curFrame;
+    GF_VramTransferStats lastFrame;
+#endif //OPTIMIZE_VRAM_TRANSFER_QUEUE
 } GF_VramTransferManager;
 
 void GF_CreateVramTransferManager(u32, HeapID);
@@ -12,5 +30,9 @@ void GF_DestroyVramTransferManager(void);
 BOOL GF_CreateNewVramTransferTask(NNS_GFD_DST_TYPE type, u32 dstAddr, void *pSrc, u32 szByte);
 void GF_RunVramTransferTasks(void);
 u32 GF_GetNumPendingVramTransferTasks(void);
+#ifdef OPTIMIZE_VRAM_TRANSFER_QUEUE
+void GF_DoVramTransfer(void);
+void GF_GetVramTransferStats(GF_VramTransferStats *dest);
+#endif //OPTIMIZE_VRAM_TRANSFER_QUEUE
 
 #endif //POKEHEARTGOLD_VRAM_TRANSFER_MANAGER_H
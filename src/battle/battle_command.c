@@ -17,6 +17,10 @@
 #include "constants/moves.h"
 #include "constants/pokemon.h"
 
+#ifdef OPTIMIZE_BATTLE_SCRIPT_PROFILE
+#include "battle_script_profile.h"
+#endif //OPTIMIZE_BATTLE_SCRIPT_PROFILE
+
 int BattleScriptReadWord(BATTLECONTEXT *ctx);
 static void BattleScriptIncrementPointer(BATTLECONTEXT *ctx, int adrs);
 static void BattleScriptJump(BATTLECONTEXT *ctx, NarcId narcId, int adrs);
@@ -27,6 +31,122 @@ u8 GetBattlerIDBySide(BattleSystem *bsys, BATTLECONTEXT *ctx, u32 a2);
 
 extern BtlCmdFunc sBattleScriptCommandTable[];
 
+#ifdef OPTIMIZE_BATTLE_SCRIPT_PROFILE
+static BattleScriptProfile sBattleScriptProfile;
+
+void BattleScriptProfile_Reset(void) {
+    int i;
+    BattleScriptProfile *prof = &sBattleScriptProfile;
+
+    MI_CpuFill8(prof, 0, sizeof(BattleScriptProfile));
+    prof->magic = BATTLE_SCRIPT_PROFILE_MAGIC;
+    prof->version = BATTLE_SCRIPT_PROFILE_VERSION;
+    prof->numCmds = BATTLE_SCRIPT_CMD_COUNT;
+    prof->numSlots = BATTLE_SCRIPT_PROFILE_SLOTS;
+    prof->logSize = BATTLE_SCRIPT_PROFILE_LOG_SIZE;
+    prof->curSlot = BATTLE_SCRIPT_PROFILE_SLOT_NONE;
+    for (i = 0; i < BATTLE_SCRIPT_PROFILE_SLOTS; i++) {
+        prof->slots[i].narcId = 0xFFFF;
+    }
+}
+
+static BattleScriptProfile *BattleScriptProfile_Get(void) {
+    if (sBattleScriptProfile.magic != BATTLE_SCRIPT_PROFILE_MAGIC) {
+        BattleScriptProfile_Reset();
+    }
+    return &sBattleScriptProfile;
+}
+
+static u16 BattleScriptProfile_GetSlot(BattleScriptProfile *prof, u16 narcId, u16 fileId) {
+    int i;
+    u32 slot = (narcId * 97 + fileId) % BATTLE_SCRIPT_PROFILE_SLOTS;
+
+    for (i = 0; i < BATTLE_SCRIPT_PROFILE_SLOTS; i++) {
+        if (prof->slots[slot].narcId == narcId && prof->slots[slot].fileId == fileId) {
+            return slot;
+        }
+        if (prof->slots[slot].narcId == 0xFFFF) {
+            prof->slots[slot].narcId = narcId;
+            prof->slots[slot].fileId = fileId;
+            prof->numSlotsUsed++;
+            return slot;
+        }
+        slot = (slot + 1) % BATTLE_SCRIPT_PROFILE_SLOTS;
+    }
+    return BATTLE_SCRIPT_PROFILE_SLOT_NONE;
+}
+
+static void BattleScriptProfile_Log(BattleScriptProfile *prof, u8 kind, u8 cmd, u8 depth, u16 slot, u16 seqNo, u32 ticks) {
+    BattleScriptProfileEvent *event = &prof->log[prof->numEvents % BATTLE_SCRIPT_PROFILE_LOG_SIZE];
+
+    event->kind = kind;
+    event->cmd = cmd;
+    event->depth = depth;
+    event->slot = slot;
+    event->seqNo = seqNo;
+    event->ticks = ticks;
+    prof->numEvents++;
+}
+
+// Called by ov12_0224EC74 before it reloads the caller, so that the load
+// is logged as a return rather than a new entry
+void BattleScriptProfile_OnReturn(void) {
+    BattleScriptProfile_Get()->returning = TRUE;
+}
+
+void BattleScriptProfile_OnLoad(BATTLECONTEXT *ctx) {
+    BattleScriptProfile *prof = BattleScriptProfile_Get();
+    u16 slot = BattleScriptProfile_GetSlot(prof, ctx->scriptNarcId, ctx->scriptFileId);
+
+    if (prof->returning) {
+        prof->returning = FALSE;
+        BattleScriptProfile_Log(prof, BATTLE_SCRIPT_EVENT_RETURN, 0, ctx->unk_B8, slot, ctx->unk_DC[ctx->unk_B8], 0);
+    } else {
+        if (slot != BATTLE_SCRIPT_PROFILE_SLOT_NONE) {
+            prof->slots[slot].entries++;
+        }
+        BattleScriptProfile_Log(prof, BATTLE_SCRIPT_EVENT_ENTER, 0, ctx->unk_B8, slot, 0, 0);
+    }
+    prof->curSlot = slot;
+}
+
+static void BattleScriptProfile_OnCommand(int cmd, u8 depth, u16 slot, int seqNo, u32 ticks) {
+    BattleScriptProfile *prof = BattleScriptProfile_Get();
+
+    if (cmd >= 0 && cmd < BATTLE_SCRIPT_CMD_COUNT) {
+        prof->cmdCounts[cmd]++;
+        prof->cmdTicks[cmd] += ticks;
+    }
+    if (slot != BATTLE_SCRIPT_PROFILE_SLOT_NONE) {
+        prof->slots[slot].ticks += ticks;
+    }
+    BattleScriptProfile_Log(prof, BATTLE_SCRIPT_EVENT_COMMAND, cmd, depth, slot, seqNo, ticks);
+}
+
+BOOL RunBattleScript(BattleSystem *bsys, BATTLECONTEXT *ctx) {
+    BOOL ret;
+    int cmd;
+    int seqNo;
+    u8 depth;
+    u16 slot;
+    OSTick startTick;
+
+    do {
+        // The command may load another script, so note where it came from first
+        seqNo = ctx->scriptSeqNo;
+        cmd = ctx->battleScriptWork[seqNo];
+        depth = ctx->unk_B8;
+        slot = BattleScriptProfile_Get()->curSlot;
+        startTick = OS_GetTick();
+        ret = sBattleScriptCommandTable[cmd](bsys, ctx);
+        BattleScriptProfile_OnCommand(cmd, depth, slot, seqNo, (u32)(OS_GetTick() - startTick));
+    } while(ctx->battleContinueFlag == 0 && (BattleSys_GetBattleType(bsys) & BATTLE_TYPE_2) == 0);
+
+    ctx->battleContinueFlag = 0;
+
+    return ret;
+}
+#else
 BOOL RunBattleScript(BattleSystem *bsys, BATTLECONTEXT *ctx) {
     BOOL ret;
 
@@ -38,6 +158,7 @@ BOOL RunBattleScript(BattleSystem *bsys, BATTLECONTEXT *ctx) {
 
     return ret;
 }
+#endif //OPTIMIZE_BATTLE_SCRIPT_PROFILE
 
 BOOL BtlCmd_PlayEncounterAnimation(BattleSystem *bsys, BATTLECONTEXT *ctx) {
     BattleScriptIncrementPointer(ctx, 1);
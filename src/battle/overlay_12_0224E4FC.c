@@ -14,6 +14,13 @@
 #include "constants/moves.h"
 #include "constants/species.h"
 
+#if defined(OPTIMIZE_BATTLER_VAR_TABLE) || defined(OPTIMIZE_BATTLER_VAR_PROFILE)
+#include "battler_var.h"
+#endif
+#ifdef OPTIMIZE_BATTLE_SCRIPT_PROFILE
+#include "battle_script_profile.h"
+#endif //OPTIMIZE_BATTLE_SCRIPT_PROFILE
+
 void BattleSystem_GetBattleMon(BattleSystem *bsys, BATTLECONTEXT *ctx, int battlerId, u8 selectedMon) {
     Pokemon *mon = BattleSystem_GetPartyMon(bsys, battlerId, selectedMon);
     int i;
@@ -153,6 +160,9 @@ void ReadBattleScriptFromNarc(BATTLECONTEXT *ctx, NarcId narcId, int fileId) {
     ctx->scriptFileId = fileId;
     ctx->scriptSeqNo = 0;
     ReadWholeNarcMemberByIdPair(&ctx->battleScriptWork, narcId, fileId);
+#ifdef OPTIMIZE_BATTLE_SCRIPT_PROFILE
+    BattleScriptProfile_OnLoad(ctx);
+#endif //OPTIMIZE_BATTLE_SCRIPT_PROFILE
 }
 
 //PushBattleScriptFromNarc..?
@@ -167,12 +177,18 @@ void ov12_0224EBDC(BATTLECONTEXT *ctx, NarcId narcId, int fileId) {
     ctx->scriptFileId = fileId;
     ctx->scriptSeqNo = 0;
     ReadWholeNarcMemberByIdPair(&ctx->battleScriptWork, narcId, fileId);
+#ifdef OPTIMIZE_BATTLE_SCRIPT_PROFILE
+    BattleScriptProfile_OnLoad(ctx);
+#endif //OPTIMIZE_BATTLE_SCRIPT_PROFILE
 }
 
 //BattleScript_Pop..?
 BOOL ov12_0224EC74(BATTLECONTEXT *ctx) {
     if (ctx->unk_B8) {
         ctx->unk_B8--;
+#ifdef OPTIMIZE_BATTLE_SCRIPT_PROFILE
+        BattleScriptProfile_OnReturn();
+#endif //OPTIMIZE_BATTLE_SCRIPT_PROFILE
         ReadBattleScriptFromNarc(ctx, ctx->unk_BC[ctx->unk_B8], ctx->unk_CC[ctx->unk_B8]);
         ctx->scriptSeqNo = ctx->unk_DC[ctx->unk_B8];
         return FALSE;
@@ -244,9 +260,328 @@ void ov12_0224EDC0(BATTLECONTEXT *ctx, int battlerId) {
     }
 }
 
+#ifdef OPTIMIZE_BATTLER_VAR_PROFILE
+static BattlerVarStats sBattlerVarStats;
+
+static void BattlerVar_Record(int battlerId, u32 id, BOOL write) {
+    if (id < BATTLER_VAR_COUNT) {
+        if (write) {
+            sBattlerVarStats.numWrites[id]++;
+        } else {
+            sBattlerVarStats.numReads[id]++;
+        }
+    }
+    sBattlerVarStats.trace[sBattlerVarStats.traceCount % BATTLER_VAR_TRACE_LEN] = (id & 0xFF) | (battlerId << BATTLER_VAR_TRACE_BATTLER_SHIFT) | (write ? BATTLER_VAR_TRACE_WRITE : 0);
+    sBattlerVarStats.traceCount++;
+}
+
+u32 BattlerVar_GetAccessCount(u32 id, BOOL write) {
+    GF_ASSERT(id < BATTLER_VAR_COUNT);
+    return write ? sBattlerVarStats.numWrites[id] : sBattlerVarStats.numReads[id];
+}
+
+void BattlerVar_ResetStats(void) {
+    MI_CpuFill8(&sBattlerVarStats, 0, sizeof(BattlerVarStats));
+}
+#endif //OPTIMIZE_BATTLER_VAR_PROFILE
+
+#ifdef OPTIMIZE_BATTLER_VAR_TABLE
+// Bit fields have no offsetof, so their containers are found from the
+// field that follows them
+#define BATTLER_VAR_IV_WORD         (offsetof(BATTLEMON, statChanges) - sizeof(u32))
+#define BATTLER_VAR_FORME_BYTE      (offsetof(BATTLEMON, ability) - sizeof(u8))
+#define BATTLER_VAR_FLAGS_WORD      (offsetof(BATTLEMON, movePPCur) - sizeof(u32))
+#define BATTLER_VAR_GENDER_BYTE     (offsetof(BATTLEMON, ball) - sizeof(u8))
+#define BATTLER_VAR_SUB_WORD_0      (offsetof(BATTLEMON, unk88))
+#define BATTLER_VAR_SUB_WORD_1      (offsetof(BATTLEMON, unk88) + offsetof(UnkBattlemonSub, rechargeCount) - sizeof(u32))
+
+#define BVAR(kind, field, src)              { offsetof(BATTLEMON, field), BATTLER_VAR_KIND_##kind, 0, 0, BATTLER_VAR_SRC_##src, 0 }
+#define BVAR_BITS(kind, off, shift, width)  { off, BATTLER_VAR_KIND_##kind, shift, width, BATTLER_VAR_SRC_U8, 0 }
+#define BVAR_SUB(kind, field, src)          { offsetof(BATTLEMON, unk88) + offsetof(UnkBattlemonSub, field), BATTLER_VAR_KIND_##kind, 0, 0, BATTLER_VAR_SRC_##src, 0 }
+#define BVAR_SPECIAL(flags)                 { 0, BATTLER_VAR_KIND_NONE, 0, 0, BATTLER_VAR_SRC_NONE, flags }
+
+static const BattlerVarDesc sBattlerVarDescs[BATTLER_VAR_COUNT] = {
+    [BMON_DATA_SPECIES]                 = BVAR(U16, species, U16),
+    [BMON_DATA_ATK]                     = BVAR(U16, atk, U16),
+    [BMON_DATA_DEF]                     = BVAR(U16, def, U16),
+    [BMON_DATA_SPEED]                   = BVAR(U16, speed, U16),
+    [BMON_DATA_SPATK]                   = BVAR(U16, spAtk, U16),
+    [BMON_DATA_SPDEF]                   = BVAR(U16, spDef, U16),
+    [BMON_DATA_MOVE1]                   = BVAR(U16, moves[0], U16),
+    [BMON_DATA_MOVE2]                   = BVAR(U16, moves[1], U16),
+    [BMON_DATA_MOVE3]                   = BVAR(U16, moves[2], U16),
+    [BMON_DATA_MOVE4]                   = BVAR(U16, moves[3], U16),
+    [BMON_DATA_HP_IV]                   = BVAR_BITS(BITS32, BATTLER_VAR_IV_WORD, 0, 5),
+    [BMON_DATA_ATK_IV]                  = BVAR_BITS(BITS32, BATTLER_VAR_IV_WORD, 5, 5),
+    [BMON_DATA_DEF_IV]                  = BVAR_BITS(BITS32, BATTLER_VAR_IV_WORD, 10, 5),
+    [BMON_DATA_SPEED_IV]                = BVAR_BITS(BITS32, BATTLER_VAR_IV_WORD, 15, 5),
+    [BMON_DATA_SPATK_IV]                = BVAR_BITS(BITS32, BATTLER_VAR_IV_WORD, 20, 5),
+    [BMON_DATA_SPDEF_IV]                = BVAR_BITS(BITS32, BATTLER_VAR_IV_WORD, 25, 5),
+    [BMON_DATA_IS_EGG]                  = BVAR_BITS(BITS32, BATTLER_VAR_IV_WORD, 30, 1),
+    [BMON_DATA_HAS_NICKNAME]            = BVAR_BITS(BITS32, BATTLER_VAR_IV_WORD, 31, 1),
+    [BMON_DATA_STAT_CHANGE_HP]          = BVAR(S8, statChanges[0], S8),
+    [BMON_DATA_STAT_CHANGE_ATK]         = BVAR(S8, statChanges[1], S8),
+    [BMON_DATA_STAT_CHANGE_DEF]         = BVAR(S8, statChanges[2], S8),
+    [BMON_DATA_STAT_CHANGE_SPEED]       = BVAR(S8, statChanges[3], S8),
+    [BMON_DATA_STAT_CHANGE_SPATK]       = BVAR(S8, statChanges[4], S8),
+    [BMON_DATA_STAT_CHANGE_SPDEF]       = BVAR(S8, statChanges[5], S8),
+    [BMON_DATA_STAT_CHANGE_ACC]         = BVAR(S8, statChanges[6], S8),
+    [BMON_DATA_STAT_CHANGE_EVASION]     = BVAR(S8, statChanges[7], S8),
+    [BMON_DATA_ABILITY]                 = BVAR(U8, ability, U8),
+    // Read through ov12_022584AC, which accounts for Roost
+    [BMON_DATA_TYPE_1]                  = { offsetof(BATTLEMON, type1), BATTLER_VAR_KIND_U8, 0, 0, BATTLER_VAR_SRC_U8, BATTLER_VAR_GET_SPECIAL },
+    [BMON_DATA_TYPE_2]                  = { offsetof(BATTLEMON, type2), BATTLER_VAR_KIND_U8, 0, 0, BATTLER_VAR_SRC_U8, BATTLER_VAR_GET_SPECIAL },
+    [BMON_DATA_GENDER]                  = BVAR_BITS(BITS8, BATTLER_VAR_GENDER_BYTE, 0, 4),
+    [BMON_DATA_IS_SHINY]                = BVAR_BITS(BITS8, BATTLER_VAR_FORME_BYTE, 5, 1),
+    [BMON_DATA_MOVE1PP]                 = BVAR(U8, movePPCur[0], U8),
+    [BMON_DATA_MOVE2PP]                 = BVAR(U8, movePPCur[1], U8),
+    [BMON_DATA_MOVE3PP]                 = BVAR(U8, movePPCur[2], U8),
+    [BMON_DATA_MOVE4PP]                 = BVAR(U8, movePPCur[3], U8),
+    [BMON_DATA_MOVE1PPCUR]              = BVAR(U8, movePP[0], U8),
+    [BMON_DATA_MOVE2PPCUR]              = BVAR(U8, movePP[1], U8),
+    [BMON_DATA_MOVE3PPCUR]              = BVAR(U8, movePP[2], U8),
+    [BMON_DATA_MOVE4PPCUR]              = BVAR(U8, movePP[3], U8),
+    [BMON_DATA_MOVE1MAXPP]              = BVAR_SPECIAL(BATTLER_VAR_GET_SPECIAL | BATTLER_VAR_SET_SPECIAL),
+    [BMON_DATA_MOVE2MAXPP]              = BVAR_SPECIAL(BATTLER_VAR_GET_SPECIAL | BATTLER_VAR_SET_SPECIAL),
+    [BMON_DATA_MOVE3MAXPP]              = BVAR_SPECIAL(BATTLER_VAR_GET_SPECIAL | BATTLER_VAR_SET_SPECIAL),
+    [BMON_DATA_MOVE4MAXPP]              = BVAR_SPECIAL(BATTLER_VAR_GET_SPECIAL | BATTLER_VAR_SET_SPECIAL),
+    [BMON_DATA_LEVEL]                   = BVAR(U8, level, U8),
+    [BMON_DATA_FRIENDSHIP]              = BVAR(U8, friendship, U8),
+    [BMON_DATA_NICKNAME]                = BVAR_SPECIAL(BATTLER_VAR_GET_SPECIAL | BATTLER_VAR_SET_SPECIAL),
+    [BMON_DATA_NICKNAME2]               = BVAR_SPECIAL(BATTLER_VAR_GET_SPECIAL | BATTLER_VAR_SET_SPECIAL),
+    [BMON_DATA_HP]                      = BVAR(U32, hp, S16),
+    [BMON_DATA_MAXHP]                   = BVAR(U32, maxHp, U16),
+    [BMON_DATA_OT_NAME]                 = BVAR_SPECIAL(BATTLER_VAR_GET_SPECIAL | BATTLER_VAR_SET_SPECIAL),
+    [BMON_DATA_EXP]                     = BVAR(U32, exp, U32),
+    [BMON_DATA_PERSONALITY]             = BVAR(U32, personality, U32),
+    [BMON_DATA_STATUS]                  = BVAR(U32, status, U32),
+    [BMON_DATA_STATUS2]                 = BVAR(U32, status2, U32),
+    [BMON_DATA_OT_ID]                   = BVAR(U32, otid, U32),
+    [BMON_DATA_HELD_ITEM]               = BVAR(U16, item, U16),
+    [BMON_DATA_56]                      = BVAR(U8, unk78, U8),
+    [BMON_DATA_MSG_FLAG]                = BVAR(U8, msgFlag, U8),
+    [BMON_DATA_OT_GENDER]               = BVAR_BITS(BITS8, BATTLER_VAR_GENDER_BYTE, 4, 4),
+    [BMON_DATA_MOVE_EFFECT]             = BVAR(U32, moveEffectFlags, U32),
+    [BMON_DATA_MOVE_EFFECT_TEMP]        = BVAR(U32, unk80, U32),
+    [BMON_DATA_DISABLED_TURNS]          = BVAR_BITS(BITS32, BATTLER_VAR_SUB_WORD_0, 0, 3),
+    [BMON_DATA_ENCORED_TURNS]           = BVAR_BITS(BITS32, BATTLER_VAR_SUB_WORD_0, 3, 3),
+    [BMON_DATA_IS_CHARGED]              = BVAR_BITS(BITS32, BATTLER_VAR_SUB_WORD_0, 6, 2),
+    [BMON_DATA_TAUNT_TURNS]             = BVAR_BITS(BITS32, BATTLER_VAR_SUB_WORD_0, 8, 3),
+    [BMON_DATA_PROTECT_SUCCESS_COUNT]   = BVAR_BITS(BITS32, BATTLER_VAR_SUB_WORD_0, 11, 2),
+    [BMON_DATA_PERISH_SONG_TURNS]       = BVAR_BITS(BITS32, BATTLER_VAR_SUB_WORD_0, 13, 2),
+    [BMON_DATA_ROLLOUT_TURNS]           = BVAR_BITS(BITS32, BATTLER_VAR_SUB_WORD_0, 15, 3),
+    [BMON_DATA_FURY_CUTTER_TURNS]       = BVAR_BITS(BITS32, BATTLER_VAR_SUB_WORD_0, 18, 3),
+    [BMON_DATA_STOCKPILE_COUNT]         = BVAR_BITS(BITS32, BATTLER_VAR_SUB_WORD_0, 21, 3),
+    [BMON_DATA_STOCKPILE_DEF_BOOSTS]    = BVAR_BITS(BITS32, BATTLER_VAR_SUB_WORD_0, 24, 3),
+    [BMON_DATA_STOCKPILE_SPDEF_BOOSTS]  = BVAR_BITS(BITS32, BATTLER_VAR_SUB_WORD_0, 27, 3),
+    [BMON_DATA_TRUANT_FLAG]             = BVAR_BITS(BITS32, BATTLER_VAR_SUB_WORD_0, 30, 1),
+    [BMON_DATA_FLASH_FIRE_ACTIVE]       = BVAR_BITS(BITS32, BATTLER_VAR_SUB_WORD_0, 31, 1),
+    [BMON_DATA_LOCKED_ON_BATTLER]       = BVAR_BITS(BITS32, BATTLER_VAR_SUB_WORD_1, 0, 2),
+    [BMON_DATA_MIMICED_MOVE]            = BVAR_BITS(BITS32, BATTLER_VAR_SUB_WORD_1, 2, 4),
+    [BMON_DATA_BINDED_BATTLER]          = BVAR_BITS(BITS32, BATTLER_VAR_SUB_WORD_1, 6, 2),
+    [BMON_DATA_MEAN_LOOK_BATTLER]       = BVAR_BITS(BITS32, BATTLER_VAR_SUB_WORD_1, 8, 2),
+    [BMON_DATA_LAST_RESORT_COUNT]       = BVAR_BITS(BITS32, BATTLER_VAR_SUB_WORD_1, 10, 3),
+    [BMON_DATA_MAGNET_RISE]             = BVAR_BITS(BITS32, BATTLER_VAR_SUB_WORD_1, 13, 3),
+    [BMON_DATA_HEAL_BLOCK]              = BVAR_BITS(BITS32, BATTLER_VAR_SUB_WORD_1, 16, 3),
+    [BMON_DATA_81]                      = BVAR_BITS(BITS32, BATTLER_VAR_SUB_WORD_1, 19, 3),
+    [BMON_DATA_ITEM_KNOCKED_OFF]        = BVAR_BITS(BITS32, BATTLER_VAR_SUB_WORD_1, 22, 1),
+    [BMON_DATA_METRONOME]               = BVAR_BITS(BITS32, BATTLER_VAR_SUB_WORD_1, 23, 4),
+    [BMON_DATA_84]                      = BVAR_BITS(BITS32, BATTLER_VAR_SUB_WORD_1, 27, 1),
+    [BMON_DATA_CUSTAP_FLAG]             = BVAR_BITS(BITS32, BATTLER_VAR_SUB_WORD_1, 28, 1),
+    [BMON_DATA_QUICK_CLAW_FLAG]         = BVAR_BITS(BITS32, BATTLER_VAR_SUB_WORD_1, 29, 1),
+    [BMON_DATA_RECHARGE]                = BVAR_SUB(U32, rechargeCount, U32),
+    [BMON_DATA_FAKE_OUT]                = BVAR_SUB(U32, fakeOutCount, U32),
+    [BMON_DATA_SLOW_START_COUNT]        = BVAR_SUB(U32, slowStartTurns, U32),
+    [BMON_DATA_SUBSTITUTE_HP]           = BVAR_SUB(U32, substituteHp, U32),
+    [BMON_DATA_TRANSFORM_PERSONALITY]   = BVAR_SUB(U32, transformPersonality, U32),
+    [BMON_DATA_DISABLED_MOVE_NO]        = BVAR_SUB(U16, disabledMove, U16),
+    [BMON_DATA_ENCORED_MOVE_NO]         = BVAR_SUB(U16, encoredMove, U16),
+    [BMON_DATA_BINDING_MOVE_NO]         = BVAR_SUB(U16, bindingMove, U16),
+    [BMON_DATA_HELD_ITEM_RESTORE_HP]    = BVAR_SUB(U32, unk30, U32),
+    [BMON_DATA_SLOW_START_FLAG]         = BVAR_BITS(BITS32, BATTLER_VAR_FLAGS_WORD, 6, 1),
+    [BMON_DATA_SLOW_START_END]          = BVAR_BITS(BITS32, BATTLER_VAR_FLAGS_WORD, 7, 1),
+    [BMON_DATA_FORME]                   = BVAR_BITS(BITS8, BATTLER_VAR_FORME_BYTE, 0, 5),
+    [BMON_DATA_99]                      = BVAR_SPECIAL(BATTLER_VAR_GET_SPECIAL | BATTLER_VAR_SET_SPECIAL),
+    [BMON_DATA_100]                     = BVAR_SPECIAL(BATTLER_VAR_GET_SPECIAL | BATTLER_VAR_SET_SPECIAL),
+};
+
+#undef BVAR
+#undef BVAR_BITS
+#undef BVAR_SUB
+#undef BVAR_SPECIAL
+
+// The read path shared by every plain entry
+static inline int BattleMon_ReadVar(const BATTLEMON *mon, const BattlerVarDesc *desc) {
+    const u8 *field = (const u8 *)mon + desc->offset;
+
+    switch (desc->kind) {
+    case BATTLER_VAR_KIND_U8:
+        return *field;
+    case BATTLER_VAR_KIND_S8:
+        return *(const s8 *)field;
+    case BATTLER_VAR_KIND_U16:
+        return *(const u16 *)field;
+    case BATTLER_VAR_KIND_U32:
+        return *(const u32 *)field;
+    case BATTLER_VAR_KIND_BITS8:
+        return (*field >> desc->shift) & ((1 << desc->width) - 1);
+    case BATTLER_VAR_KIND_BITS32:
+        return (*(const u32 *)field >> desc->shift) & ((1 << desc->width) - 1);
+    }
+    return 0;
+}
+
+// The write path shared by every plain entry. Narrower stores truncate the
+// way assigning to the field does.
+static inline void BattleMon_WriteVar(BATTLEMON *mon, const BattlerVarDesc *desc, const void *data) {
+    u8 *field = (u8 *)mon + desc->offset;
+    u32 value;
+    u32 mask;
+
+    switch (desc->src) {
+    case BATTLER_VAR_SRC_U8:
+        value = *(const u8 *)data;
+        break;
+    case BATTLER_VAR_SRC_S8:
+        value = *(const s8 *)data;
+        break;
+    case BATTLER_VAR_SRC_U16:
+        value = *(const u16 *)data;
+        break;
+    case BATTLER_VAR_SRC_S16:
+        value = *(const s16 *)data;
+        break;
+    default:
+        value = *(const u32 *)data;
+        break;
+    }
+
+    switch (desc->kind) {
+    case BATTLER_VAR_KIND_U8:
+    case BATTLER_VAR_KIND_S8:
+        *field = value;
+        break;
+    case BATTLER_VAR_KIND_U16:
+        *(u16 *)field = value;
+        break;
+    case BATTLER_VAR_KIND_U32:
+        *(u32 *)field = value;
+        break;
+    case BATTLER_VAR_KIND_BITS8:
+        mask = ((1 << desc->width) - 1) << desc->shift;
+        *field = (*field & ~mask) | ((value << desc->shift) & mask);
+        break;
+    case BATTLER_VAR_KIND_BITS32:
+        mask = ((1 << desc->width) - 1) << desc->shift;
+        *(u32 *)field = (*(u32 *)field & ~mask) | ((value << desc->shift) & mask);
+        break;
+    }
+}
+
+int GetBattlerVar(BATTLECONTEXT *ctx, int battlerId, u32 id, void *data) {
+    BATTLEMON *mon = &ctx->battleMons[battlerId];
+    const BattlerVarDesc *desc;
+
+#ifdef OPTIMIZE_BATTLER_VAR_PROFILE
+    BattlerVar_Record(battlerId, id, FALSE);
+#endif //OPTIMIZE_BATTLER_VAR_PROFILE
+    if (id >= BATTLER_VAR_COUNT) {
+        GF_ASSERT(FALSE);
+        return 0;
+    }
+    desc = &sBattlerVarDescs[id];
+    if (!(desc->flags & BATTLER_VAR_GET_SPECIAL)) {
+        return BattleMon_ReadVar(mon, desc);
+    }
+
+    switch (id) {
+    case BMON_DATA_TYPE_1:
+    case BMON_DATA_TYPE_2:
+        return ov12_022584AC(ctx, battlerId, id);
+    case BMON_DATA_MOVE1MAXPP:
+    case BMON_DATA_MOVE2MAXPP:
+    case BMON_DATA_MOVE3MAXPP:
+    case BMON_DATA_MOVE4MAXPP:
+        {
+            int index = id - BMON_DATA_MOVE1MAXPP;
+            return GetMoveMaxPP(mon->moves[index], mon->movePP[index]);
+        }
+    case BMON_DATA_NICKNAME:
+        {
+            int i;
+            u16 *buffer = data;
+
+            for (i = 0; i < 11; i++) {
+                buffer[i] = mon->nickname[i];
+            }
+        }
+        break;
+    case BMON_DATA_NICKNAME2:
+        CopyU16ArrayToString((STRING *)data, mon->nickname);
+        break;
+    case BMON_DATA_OT_NAME:
+        {
+            int i;
+            u16 *buffer = data;
+            for (i = 0; i < 11; i++) {
+                //BUG: reads past unk54, as in the switch below
+                buffer[i] = mon->unk54[i];
+            }
+        }
+        break;
+    case BMON_DATA_100:
+        return GetBattlerVar(ctx, battlerId, ctx->tempWork, data);
+    default:
+        GF_ASSERT(FALSE);
+    }
+
+    return 0;
+}
+
+void SetBattlerVar(BATTLECONTEXT *ctx, int battlerId, u32 id, void *data) {
+    u16 *data16 = (u16 *)data;
+    BATTLEMON *mon = &ctx->battleMons[battlerId];
+    const BattlerVarDesc *desc;
+
+#ifdef OPTIMIZE_BATTLER_VAR_PROFILE
+    BattlerVar_Record(battlerId, id, TRUE);
+#endif //OPTIMIZE_BATTLER_VAR_PROFILE
+    if (id >= BATTLER_VAR_COUNT) {
+        GF_ASSERT(FALSE);
+        return;
+    }
+    desc = &sBattlerVarDescs[id];
+    if (!(desc->flags & BATTLER_VAR_SET_SPECIAL)) {
+        BattleMon_WriteVar(mon, desc, data);
+        return;
+    }
+
+    switch (id) {
+    case BMON_DATA_NICKNAME:
+        for (int i = 0; i < 11; i++) {
+            mon->nickname[i] = data16[i];
+        }
+        break;
+    case BMON_DATA_OT_NAME:
+        for (int i = 0; i < 11; i++) {
+            //BUG: writes past unk54 into exp, as in the switch below
+            mon->unk54[i] = data16[i];
+        }
+        break;
+    case BMON_DATA_100:
+        SetBattlerVar(ctx, battlerId, ctx->tempWork, data);
+        break;
+    default:
+        GF_ASSERT(FALSE);
+    }
+}
+#else
 int GetBattlerVar(BATTLECONTEXT *ctx, int battlerId, u32 id, void *data) {
     BATTLEMON *mon = &ctx->battleMons[battlerId];
     
+#ifdef OPTIMIZE_BATTLER_VAR_PROFILE
+    BattlerVar_Record(battlerId, id, FALSE);
+#endif //OPTIMIZE_BATTLER_VAR_PROFILE
     switch (id) {
     case BMON_DATA_SPECIES:
         return mon->species;
@@ -476,6 +811,9 @@ void SetBattlerVar(BATTLECONTEXT *ctx, int battlerId, u32 id, void *data) {
     s8 *datas8 = (s8 *)data;
     BATTLEMON *mon = &ctx->battleMons[battlerId];
     
+#ifdef OPTIMIZE_BATTLER_VAR_PROFILE
+    BattlerVar_Record(battlerId, id, TRUE);
+#endif //OPTIMIZE_BATTLER_VAR_PROFILE
     switch (id) {
     case BMON_DATA_SPECIES:
         mon->species = *data16;
@@ -759,6 +1097,7 @@ void SetBattlerVar(BATTLECONTEXT *ctx, int battlerId, u32 id, void *data) {
         GF_ASSERT(FALSE);
     }
 }
+#endif //OPTIMIZE_BATTLER_VAR_TABLE
 
 void ov12_0224F794(BATTLECONTEXT *ctx, int battlerId, u32 varId, int data) {
     AddBattlerVar(&ctx->battleMons[battlerId], varId, data);
@@ -0,0 +1,94 @@
+#ifndef POKEHEARTGOLD_DATA_OVERLAY_TRANSITIONS_H
+#define POKEHEARTGOLD_DATA_OVERLAY_TRANSITIONS_H
+
+// Generated by tools/ovyreplay ("ovyreplay graph") from the overlay ids that
+// the code in each overlay loads, registers or starts, in asm/ and src/. Do
+// not edit; "ovyreplay selftest" fails when this is out of date.
+
+FS_EXTERN_OVERLAY(field);
+FS_EXTERN_OVERLAY(OVY_2);
+FS_EXTERN_OVERLAY(OVY_3);
+FS_EXTERN_OVERLAY(OVY_6);
+FS_EXTERN_OVERLAY(OVY_7);
+FS_EXTERN_OVERLAY(OVY_12);
+FS_EXTERN_OVERLAY(OVY_14);
+FS_EXTERN_OVERLAY(OVY_15);
+FS_EXTERN_OVERLAY(OVY_16);
+FS_EXTERN_OVERLAY(bug_contest);
+FS_EXTERN_OVERLAY(OVY_26);
+FS_EXTERN_OVERLAY(OVY_36);
+FS_EXTERN_OVERLAY(OVY_40);
+FS_EXTERN_OVERLAY(OVY_41);
+FS_EXTERN_OVERLAY(OVY_42);
+FS_EXTERN_OVERLAY(OVY_43);
+FS_EXTERN_OVERLAY(OVY_44);
+FS_EXTERN_OVERLAY(OVY_45);
+FS_EXTERN_OVERLAY(trainer_card);
+FS_EXTERN_OVERLAY(trainer_card_main);
+FS_EXTERN_OVERLAY(OVY_53);
+FS_EXTERN_OVERLAY(OVY_55);
+FS_EXTERN_OVERLAY(OVY_56);
+FS_EXTERN_OVERLAY(OVY_57);
+FS_EXTERN_OVERLAY(OVY_58);
+FS_EXTERN_OVERLAY(OVY_59);
+FS_EXTERN_OVERLAY(OVY_60);
+FS_EXTERN_OVERLAY(OVY_62);
+FS_EXTERN_OVERLAY(OVY_70);
+FS_EXTERN_OVERLAY(OVY_71);
+FS_EXTERN_OVERLAY(OVY_74);
+FS_EXTERN_OVERLAY(OVY_75);
+FS_EXTERN_OVERLAY(OVY_80);
+FS_EXTERN_OVERLAY(OVY_81);
+FS_EXTERN_OVERLAY(OVY_82);
+FS_EXTERN_OVERLAY(OVY_83);
+FS_EXTERN_OVERLAY(OVY_84);
+FS_EXTERN_OVERLAY(OVY_90);
+FS_EXTERN_OVERLAY(OVY_96);
+FS_EXTERN_OVERLAY(OVY_98);
+FS_EXTERN_OVERLAY(OVY_99);
+FS_EXTERN_OVERLAY(OVY_100);
+FS_EXTERN_OVERLAY(OVY_101);
+FS_EXTERN_OVERLAY(OVY_103);
+FS_EXTERN_OVERLAY(OVY_112);
+FS_EXTERN_OVERLAY(OVY_123);
+
+// Loaded with FS_LoadOverlay rather than HandleLoadOverlay
+static const FSOverlayID sOverlaysLoadedDirectly[] = {
+    FS_OVERLAY_ID(OVY_123),
+};
+
+// For each overlay, the one its code loads at the most call sites
+static const PMiOverlayTransition sOverlayTransitionGraph[] = {
+    { FS_OVERLAY_ID(field), FS_OVERLAY_ID(OVY_3) },                      // 2 of 23
+    { FS_OVERLAY_ID(OVY_2), FS_OVERLAY_ID(bug_contest) },                // 1 of 1
+    { FS_OVERLAY_ID(OVY_12), FS_OVERLAY_ID(OVY_7) },                     // 3 of 10
+    { FS_OVERLAY_ID(OVY_14), FS_OVERLAY_ID(OVY_15) },                    // 1 of 1
+    { FS_OVERLAY_ID(OVY_16), FS_OVERLAY_ID(OVY_15) },                    // 1 of 2
+    { FS_OVERLAY_ID(OVY_40), FS_OVERLAY_ID(OVY_41) },                    // 1 of 1
+    { FS_OVERLAY_ID(OVY_43), FS_OVERLAY_ID(OVY_42) },                    // 1 of 1
+    { FS_OVERLAY_ID(OVY_44), FS_OVERLAY_ID(OVY_42) },                    // 2 of 2
+    { FS_OVERLAY_ID(OVY_45), FS_OVERLAY_ID(OVY_90) },                    // 3 of 15
+    { FS_OVERLAY_ID(trainer_card), FS_OVERLAY_ID(trainer_card_main) },   // 1 of 2
+    { FS_OVERLAY_ID(OVY_53), FS_OVERLAY_ID(OVY_36) },                    // 1 of 1
+    { FS_OVERLAY_ID(OVY_55), FS_OVERLAY_ID(OVY_56) },                    // 1 of 2
+    { FS_OVERLAY_ID(OVY_57), FS_OVERLAY_ID(OVY_6) },                     // 1 of 2
+    { FS_OVERLAY_ID(OVY_58), FS_OVERLAY_ID(OVY_59) },                    // 2 of 2
+    { FS_OVERLAY_ID(OVY_60), FS_OVERLAY_ID(OVY_62) },                    // 1 of 1
+    { FS_OVERLAY_ID(OVY_62), FS_OVERLAY_ID(OVY_60) },                    // 1 of 1
+    { FS_OVERLAY_ID(OVY_70), FS_OVERLAY_ID(OVY_71) },                    // 1 of 1
+    { FS_OVERLAY_ID(OVY_74), FS_OVERLAY_ID(OVY_60) },                    // 4 of 8
+    { FS_OVERLAY_ID(OVY_75), FS_OVERLAY_ID(OVY_44) },                    // 1 of 3
+    { FS_OVERLAY_ID(OVY_80), FS_OVERLAY_ID(OVY_81) },                    // 2 of 6
+    { FS_OVERLAY_ID(OVY_81), FS_OVERLAY_ID(OVY_80) },                    // 1 of 1
+    { FS_OVERLAY_ID(OVY_82), FS_OVERLAY_ID(OVY_80) },                    // 1 of 1
+    { FS_OVERLAY_ID(OVY_83), FS_OVERLAY_ID(OVY_80) },                    // 2 of 2
+    { FS_OVERLAY_ID(OVY_84), FS_OVERLAY_ID(OVY_80) },                    // 1 of 1
+    { FS_OVERLAY_ID(OVY_96), FS_OVERLAY_ID(OVY_98) },                    // 2 of 3
+    { FS_OVERLAY_ID(OVY_99), FS_OVERLAY_ID(OVY_98) },                    // 4 of 4
+    { FS_OVERLAY_ID(OVY_100), FS_OVERLAY_ID(OVY_101) },                  // 4 of 5
+    { FS_OVERLAY_ID(OVY_101), FS_OVERLAY_ID(OVY_26) },                   // 2 of 3
+    { FS_OVERLAY_ID(OVY_103), FS_OVERLAY_ID(OVY_55) },                   // 1 of 1
+    { FS_OVERLAY_ID(OVY_112), FS_OVERLAY_ID(OVY_60) },                   // 1 of 1
+};
+
+#endif //POKEHEARTGOLD_DATA_OVERLAY_TRANSITIONS_H
@@ -9,6 +9,12 @@ static void sub_0205E934(LocalMapObject* object);
 static void sub_0205E954(LocalMapObject* object);
 static void sub_0205ED18(LocalMapObject* object);
 static void sub_0205EF8C(LocalMapObject* object);
+#ifdef OPTIMIZE_MAP_OBJECT_ACTIVE_LIST
+static void MapObjectMan_InitSlotLists(MapObjectMan* manager, u32 object_count);
+static void MapObjectMan_LinkActive(MapObjectMan* manager, LocalMapObject* object);
+static void MapObjectMan_UnlinkActive(MapObjectMan* manager, LocalMapObject* object);
+static BOOL MapObjectMan_NextActiveWithBits(MapObjectMan* manager, LocalMapObject** object_dest, int* index, u32 bits);
+#endif //OPTIMIZE_MAP_OBJECT_ACTIVE_LIST
 
 MapObjectMan* sub_0205E0BC(FieldSystem* fsys, int object_count, HeapID heapId) {
     MapObjectMan* ret = MapObjectMan_New(object_count);
@@ -20,6 +26,9 @@ MapObjectMan* sub_0205E0BC(FieldSystem* fsys, int object_count, HeapID heapId) {
 }
 
 void MapObjectMan_Delete(MapObjectMan* manager) {
+#ifdef OPTIMIZE_MAP_OBJECT_ACTIVE_LIST
+    FreeToHeapExplicit(HEAP_ID_FIELD, manager->links);
+#endif //OPTIMIZE_MAP_OBJECT_ACTIVE_LIST
     FreeToHeapExplicit(HEAP_ID_FIELD, MapObjectMan_GetObjects(manager));
     FreeToHeapExplicit(HEAP_ID_FIELD, manager);
 }
@@ -77,10 +86,121 @@ MapObjectMan* MapObjectMan_New(u32 object_count) {
     memset(objects, 0, object_count * sizeof(LocalMapObject));
 
     MapObjectMan_SetObjects(manager, objects);
+#ifdef OPTIMIZE_MAP_OBJECT_ACTIVE_LIST
+    MapObjectMan_InitSlotLists(manager, object_count);
+#endif //OPTIMIZE_MAP_OBJECT_ACTIVE_LIST
 
     return manager;
 }
 
+#ifdef OPTIMIZE_MAP_OBJECT_ACTIVE_LIST
+static inline u32 MapObjectIdBucket(u32 id) {
+    return id % MAP_OBJECT_ID_BUCKETS;
+}
+
+static u8* SlotList_Next(MapObjectSlotLinks* links, u8 slot, BOOL byId) {
+    return byId ? &links[slot].idNext : &links[slot].next;
+}
+
+// Both lists are kept in index order, so walking them visits objects in the
+// same order as scanning the array did.
+static void SlotList_Insert(MapObjectSlotLinks* links, u8* head, u8 slot, BOOL byId) {
+    u8* cur = head;
+
+    while (*cur != MAP_OBJECT_SLOT_NONE && *cur < slot) {
+        cur = SlotList_Next(links, *cur, byId);
+    }
+    *SlotList_Next(links, slot, byId) = *cur;
+    *cur = slot;
+}
+
+static void SlotList_Remove(MapObjectSlotLinks* links, u8* head, u8 slot, BOOL byId) {
+    u8* cur = head;
+
+    while (*cur != slot) {
+        if (*cur == MAP_OBJECT_SLOT_NONE) {
+            GF_ASSERT(FALSE);
+            return;
+        }
+        cur = SlotList_Next(links, *cur, byId);
+    }
+    *cur = *SlotList_Next(links, slot, byId);
+}
+
+static void MapObjectMan_InitSlotLists(MapObjectMan* manager, u32 object_count) {
+    u32 i;
+
+    GF_ASSERT(object_count < MAP_OBJECT_SLOT_NONE);
+    manager->links = AllocFromHeap((HeapID)11, object_count * sizeof(MapObjectSlotLinks));
+    GF_ASSERT(manager->links != NULL);
+
+    for (i = 0; i < object_count; i++) {
+        manager->links[i].next = (i + 1 < object_count) ? i + 1 : MAP_OBJECT_SLOT_NONE;
+        manager->links[i].idNext = MAP_OBJECT_SLOT_NONE;
+        manager->links[i].active = FALSE;
+    }
+    manager->activeHead = MAP_OBJECT_SLOT_NONE;
+    manager->freeHead = (object_count != 0) ? 0 : MAP_OBJECT_SLOT_NONE;
+    memset(manager->idBuckets, MAP_OBJECT_SLOT_NONE, sizeof(manager->idBuckets));
+}
+
+static void MapObjectMan_LinkActive(MapObjectMan* manager, LocalMapObject* object) {
+    u8 slot = object - manager->objects;
+
+    if (manager->links[slot].active) {
+        return;
+    }
+    SlotList_Remove(manager->links, &manager->freeHead, slot, FALSE);
+    SlotList_Insert(manager->links, &manager->activeHead, slot, FALSE);
+    SlotList_Insert(manager->links, &manager->idBuckets[MapObjectIdBucket(MapObject_GetID(object))], slot, TRUE);
+    manager->links[slot].active = TRUE;
+}
+
+static void MapObjectMan_UnlinkActive(MapObjectMan* manager, LocalMapObject* object) {
+    u8 slot = object - manager->objects;
+
+    if (!manager->links[slot].active) {
+        return;
+    }
+    SlotList_Remove(manager->links, &manager->idBuckets[MapObjectIdBucket(MapObject_GetID(object))], slot, TRUE);
+    SlotList_Remove(manager->links, &manager->activeHead, slot, FALSE);
+    SlotList_Insert(manager->links, &manager->freeHead, slot, FALSE);
+    manager->links[slot].active = FALSE;
+}
+
+static BOOL MapObjectMan_NextActiveWithBits(MapObjectMan* manager, LocalMapObject** object_dest, int* index, u32 bits) {
+    MapObjectSlotLinks* links = manager->links;
+    LocalMapObject* objects = manager->objects;
+    u8 slot;
+
+    if (*index >= (int)manager->object_count) {
+        return FALSE;
+    }
+
+    // Callers resume right after the object returned last time, which is
+    // still in the list unless they removed it.
+    if (*index > 0 && links[*index - 1].active) {
+        slot = links[*index - 1].next;
+    } else {
+        slot = manager->activeHead;
+        while (slot != MAP_OBJECT_SLOT_NONE && slot < *index) {
+            slot = links[slot].next;
+        }
+    }
+
+    for (; slot != MAP_OBJECT_SLOT_NONE; slot = links[slot].next) {
+        if (bits == MapObject_GetFlagsMask(&objects[slot], bits)) {
+            *index = slot + 1;
+            *object_dest = &objects[slot];
+            return TRUE;
+        }
+    }
+
+    *index = manager->object_count;
+    return FALSE;
+}
+#endif //OPTIMIZE_MAP_OBJECT_ACTIVE_LIST
+
 #ifdef NONMATCHING
 LocalMapObject* sub_0205E1D0(MapObjectMan* manager, OBJECT_EVENT* object_events, u32 map_no) {
     OBJECT_EVENT template = *object_events;
@@ -291,6 +411,18 @@ void sub_0205E420(LocalMapObject* object) {
     sub_0205F4B8(object, sub_0205FCD0);
 }
 
+#ifdef OPTIMIZE_MAP_OBJECT_ACTIVE_LIST
+void MapObjectMan_RemoveAllActiveObjects(MapObjectMan* manager) {
+    u8 slot = manager->activeHead;
+    u8 next;
+
+    while (slot != MAP_OBJECT_SLOT_NONE) {
+        next = manager->links[slot].next;
+        MapObject_Remove(&manager->objects[slot]);
+        slot = next;
+    }
+}
+#else
 void MapObjectMan_RemoveAllActiveObjects(MapObjectMan* manager) {
     int i = 0;
     int count = MapObjectMan_GetCount(manager);
@@ -305,6 +437,7 @@ void MapObjectMan_RemoveAllActiveObjects(MapObjectMan* manager) {
         object++;
     } while (i < count);
 }
+#endif //OPTIMIZE_MAP_OBJECT_ACTIVE_LIST
 
 void sub_0205E4C8(MapObjectMan* manager) {
     GF_ASSERT(sub_0205F5D4(manager) == TRUE);
@@ -527,6 +660,9 @@ void sub_0205E8EC(MapObjectMan* manager, LocalMapObject* object) {
     sub_0205E934(object);
     sub_0205E954(object);
     sub_0205F354(object, manager);
+#ifdef OPTIMIZE_MAP_OBJECT_ACTIVE_LIST
+    MapObjectMan_LinkActive(manager, object);
+#endif //OPTIMIZE_MAP_OBJECT_ACTIVE_LIST
     sub_0205ECE0(object);
     MapObject_ClearHeldMovement(object);
     sub_0205EFB4(object);
@@ -610,6 +746,14 @@ void sub_0205EA08(struct MapObjectInitArgs* args) {
     FreeToHeapExplicit((HeapID)11, args);
 }
 
+#ifdef OPTIMIZE_MAP_OBJECT_ACTIVE_LIST
+LocalMapObject* MapObjectMan_GetFirstInactiveObject(MapObjectMan* manager) {
+    if (manager->freeHead == MAP_OBJECT_SLOT_NONE) {
+        return NULL;
+    }
+    return MapObjectMan_GetObjects(manager) + manager->freeHead;
+}
+#else
 LocalMapObject* MapObjectMan_GetFirstInactiveObject(MapObjectMan* manager) {
     int i = 0;
     int count = MapObjectMan_GetCount(manager);
@@ -626,6 +770,7 @@ LocalMapObject* MapObjectMan_GetFirstInactiveObject(MapObjectMan* manager) {
 
     return NULL;
 }
+#endif //OPTIMIZE_MAP_OBJECT_ACTIVE_LIST
 
 LocalMapObject* sub_0205EA98(MapObjectMan* manager, u32 id, u32 map_no) {
     int index = 0;
@@ -703,6 +848,9 @@ void sub_0205EC90(LocalMapObject* object, MapObjectMan* manager) {
     MapObject_ForceSetFacingDirection(object, MapObject_GetInitialFacing(object));
     MapObject_SetNextFacing(object, MapObject_GetInitialFacing(object));
     MapObject_ClearHeldMovement(object);
+#ifdef OPTIMIZE_MAP_OBJECT_ACTIVE_LIST
+    MapObjectMan_LinkActive(manager, object);
+#endif //OPTIMIZE_MAP_OBJECT_ACTIVE_LIST
 }
 
 void sub_0205ECE0(LocalMapObject* object) {
@@ -727,6 +875,11 @@ static void sub_0205ED18(LocalMapObject* object) {
 }
 
 void sub_0205ED80(LocalMapObject* object) {
+#ifdef OPTIMIZE_MAP_OBJECT_ACTIVE_LIST
+    if (object->manager != NULL) {
+        MapObjectMan_UnlinkActive(object->manager, object);
+    }
+#endif //OPTIMIZE_MAP_OBJECT_ACTIVE_LIST
     memset(object, 0, sizeof(LocalMapObject));
 }
 
@@ -766,6 +919,40 @@ LocalMapObject* sub_0205EE10(MapObjectMan* manager, u32 object_id, u32 object_fl
     return NULL;
 }
 
+#ifdef OPTIMIZE_MAP_OBJECT_ACTIVE_LIST
+LocalMapObject* GetMapObjectByID(MapObjectMan* manager, u32 id) {
+    LocalMapObject* object;
+    u8 slot;
+
+    GF_ASSERT(manager != NULL);
+
+    for (slot = manager->idBuckets[MapObjectIdBucket(id)]; slot != MAP_OBJECT_SLOT_NONE; slot = manager->links[slot].idNext) {
+        object = &manager->objects[slot];
+        if (MapObject_TestFlagsBits(object, MAPOBJECTFLAG_ACTIVE) == TRUE &&
+            MapObject_CheckFlag25(object) == FALSE &&
+            id == MapObject_GetID(object))
+        {
+            return object;
+        }
+    }
+
+    return NULL;
+}
+
+LocalMapObject* sub_0205EEB4(MapObjectMan* manager, u32 movement) {
+    LocalMapObject* object;
+    u8 slot;
+
+    for (slot = manager->activeHead; slot != MAP_OBJECT_SLOT_NONE; slot = manager->links[slot].next) {
+        object = &manager->objects[slot];
+        if (MapObject_TestFlagsBits(object, MAPOBJECTFLAG_ACTIVE) == TRUE && movement == MapObject_GetMovement(object)) {
+            return object;
+        }
+    }
+
+    return NULL;
+}
+#else
 LocalMapObject* GetMapObjectByID(MapObjectMan* manager, u32 id) {
     GF_ASSERT(manager != NULL);
 
@@ -802,8 +989,14 @@ LocalMapObject* sub_0205EEB4(MapObjectMan* manager, u32 movement) {
 
     return NULL;
 }
+#endif //OPTIMIZE_MAP_OBJECT_ACTIVE_LIST
 
 BOOL sub_0205EEF4(MapObjectMan* manager, LocalMapObject** object_dest, int* index, u32 bits) {
+#ifdef OPTIMIZE_MAP_OBJECT_ACTIVE_LIST
+    if (bits & MAPOBJECTFLAG_ACTIVE) {
+        return MapObjectMan_NextActiveWithBits(manager, object_dest, index, bits);
+    }
+#endif //OPTIMIZE_MAP_OBJECT_ACTIVE_LIST
     int count = MapObjectMan_GetCount(manager);
     if (*index >= count) {
         return FALSE;
@@ -1078,6 +1271,18 @@ u32 MapObject_GetFlags2Mask(LocalMapObject* object, u32 mask) {
 }
 
 void MapObject_SetID(LocalMapObject* object, u32 id) {
+#ifdef OPTIMIZE_MAP_OBJECT_ACTIVE_LIST
+    MapObjectMan* manager = object->manager;
+    u8 slot;
+
+    if (manager != NULL && manager->links[object - manager->objects].active) {
+        slot = object - manager->objects;
+        SlotList_Remove(manager->links, &manager->idBuckets[MapObjectIdBucket(object->id)], slot, TRUE);
+        object->id = id;
+        SlotList_Insert(manager->links, &manager->idBuckets[MapObjectIdBucket(id)], slot, TRUE);
+        return;
+    }
+#endif //OPTIMIZE_MAP_OBJECT_ACTIVE_LIST
     object->id = id;
 }
 
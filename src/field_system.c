@@ -1,5 +1,6 @@
 #include "field_warp_tasks.h"
 #include "main.h"
+#include "fieldmap.h"
 #include "map_events.h"
 #include "math_util.h"
 #include "overlay_manager.h"
@@ -18,6 +19,8 @@
 #include "overlay_01_021F3D38.h"
 #include "overlay_01_021F1AFC.h"
 #include "overlay_124.h"
+#include "pokemon.h"
+#include "trainer_data.h"
 #include "constants/maps.h"
 
 FS_EXTERN_OVERLAY(OVY_60);
@@ -150,12 +153,28 @@ FieldSystem *FieldSys_New(OVY_MANAGER *man) {
 
     UnloadOverlayByID(FS_OVERLAY_ID(OVY_124));
 
+#ifdef OPTIMIZE_TRAINER_DATA_CACHE
+    TrainerDataCache_Init(HEAP_ID_FIELD);
+#endif //OPTIMIZE_TRAINER_DATA_CACHE
+#ifdef OPTIMIZE_EVOLUTION_INDEX
+    EvolutionIndex_Init(HEAP_ID_FIELD);
+#endif //OPTIMIZE_EVOLUTION_INDEX
+
     return fsys;
 }
 
 void FieldSys_Delete(OVY_MANAGER *man) {
     FieldSystem *fsys = OverlayManager_GetData(man);
     MapMatrix_Free(fsys->mapMatrix);
+#ifdef OPTIMIZE_SCRIPT_BANK_PREFETCH
+    FieldSys_FreeScriptPrefetch();
+#endif //OPTIMIZE_SCRIPT_BANK_PREFETCH
+#ifdef OPTIMIZE_TRAINER_DATA_CACHE
+    TrainerDataCache_Free();
+#endif //OPTIMIZE_TRAINER_DATA_CACHE
+#ifdef OPTIMIZE_EVOLUTION_INDEX
+    EvolutionIndex_Free();
+#endif //OPTIMIZE_EVOLUTION_INDEX
     Field_FreeMapEvents(fsys);
     FreeToHeap(fsys->unk94);
     sub_02092BD0(fsys->unkA8);
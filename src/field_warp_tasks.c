@@ -9,6 +9,7 @@
 #include "unk_02054E00.h"
 #include "unk_0206793C.h"
 #include "unk_0203BA5C.h"
+#include "fieldmap.h"
 #include "field_map_object.h"
 #include "field_follow_poke.h"
 #include "unk_02056D7C.h"
@@ -263,6 +264,9 @@ static void sub_02053284(FieldSystem *fsys) {
     sub_02052F30(fsys);
     GF_ASSERT(fsys->unk60 == 0);
     MapMatrix_Load(fsys->location->mapId, fsys->mapMatrix);
+#ifdef OPTIMIZE_SCRIPT_BANK_PREFETCH
+    FieldSys_PrefetchMapScripts(fsys->location->mapId);
+#endif //OPTIMIZE_SCRIPT_BANK_PREFETCH
     scriptState = SaveArray_Flags_Get(fsys->savedata);
     if (sub_02066C74(scriptState, 0)) {
         RemoveMahoganyTownAntennaTree(fsys->mapMatrix);
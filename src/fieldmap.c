@@ -59,6 +59,93 @@ const struct ScriptBankMapping sScriptBankMapping[30] = {
     {_std_misc,           NARC_scr_seq_scr_seq_0003_bin, NARC_msg_msg_0040_bin},
 };
 
+#ifdef OPTIMIZE_SCRIPT_BANK_PREFETCH
+// Prefixed to every prefetched script bank so that several script
+// contexts can share the one read-only copy.
+typedef struct ScriptBankBuffer {
+    u16 refCount;
+    u16 stale; // a newer map's bank has replaced this one
+} ScriptBankBuffer;
+
+typedef struct ScriptBankPrefetch {
+    NARC *narc; // non-NULL while the async read is in flight
+    ScriptBankBuffer *buffer;
+    u16 scriptBank;
+} ScriptBankPrefetch;
+
+static ScriptBankPrefetch sScriptBankPrefetch;
+
+static void ScriptBankPrefetch_FinishRead(void) {
+    if (sScriptBankPrefetch.narc != NULL) {
+        FS_WaitAsync(&sScriptBankPrefetch.narc->file);
+        NARC_Delete(sScriptBankPrefetch.narc);
+        sScriptBankPrefetch.narc = NULL;
+    }
+}
+
+static void ScriptBankPrefetch_Retire(void) {
+    ScriptBankPrefetch_FinishRead();
+    if (sScriptBankPrefetch.buffer != NULL) {
+        if (sScriptBankPrefetch.buffer->refCount == 0) {
+            FreeToHeap(sScriptBankPrefetch.buffer);
+        } else {
+            // Still in use by a running script; the last user frees it
+            sScriptBankPrefetch.buffer->stale = TRUE;
+        }
+        sScriptBankPrefetch.buffer = NULL;
+    }
+}
+
+static u8 *ScriptBankPrefetch_Acquire(ScriptContext *ctx, u16 scriptBank) {
+    if (sScriptBankPrefetch.buffer == NULL || sScriptBankPrefetch.scriptBank != scriptBank) {
+        ctx->mapScriptsShared = FALSE;
+        return NULL;
+    }
+    ScriptBankPrefetch_FinishRead();
+    sScriptBankPrefetch.buffer->refCount++;
+    ctx->mapScriptsShared = TRUE;
+    return (u8 *)(sScriptBankPrefetch.buffer + 1);
+}
+
+static void ScriptBankPrefetch_Release(u8 *scripts) {
+    ScriptBankBuffer *buffer = (ScriptBankBuffer *)scripts - 1;
+
+    GF_ASSERT(buffer->refCount != 0);
+    buffer->refCount--;
+    if (buffer->refCount == 0 && buffer->stale) {
+        FreeToHeap(buffer);
+    }
+}
+
+void FieldSys_PrefetchMapScripts(u32 mapno) {
+    u16 scriptBank = MapHeader_GetScriptsBank(mapno);
+    u32 size;
+    u32 offset;
+
+    if (sScriptBankPrefetch.buffer != NULL && sScriptBankPrefetch.scriptBank == scriptBank) {
+        return;
+    }
+    ScriptBankPrefetch_Retire();
+
+    sScriptBankPrefetch.narc = NARC_New(NARC_fielddata_script_scr_seq, HEAP_ID_FIELD);
+    size = NARC_GetMemberSize(sScriptBankPrefetch.narc, scriptBank);
+    NARC_GetMemberImageStartOffset(sScriptBankPrefetch.narc, scriptBank, &offset);
+    // It stays for the whole visit to the map, so keep it clear of the
+    // short-lived allocations at the heap front
+    sScriptBankPrefetch.buffer = AllocFromHeapAtEnd(HEAP_ID_FIELD, sizeof(ScriptBankBuffer) + size);
+    sScriptBankPrefetch.buffer->refCount = 0;
+    sScriptBankPrefetch.buffer->stale = FALSE;
+    sScriptBankPrefetch.scriptBank = scriptBank;
+
+    FS_SeekFile(&sScriptBankPrefetch.narc->file, (s32)offset, FS_SEEK_SET);
+    FS_ReadFileAsync(&sScriptBankPrefetch.narc->file, sScriptBankPrefetch.buffer + 1, (s32)size);
+}
+
+void FieldSys_FreeScriptPrefetch(void) {
+    ScriptBankPrefetch_Retire();
+}
+#endif //OPTIMIZE_SCRIPT_BANK_PREFETCH
+
 void StartMapSceneScript(FieldSystem *fsys, u16 script, LocalMapObject *lastInteracted) {
     ScriptEnvironment *r4 = ScriptEnvironment_New();
     SetupScriptEngine(fsys, r4, script, lastInteracted, NULL);
@@ -150,7 +237,15 @@ ScriptEnvironment *ScriptEnvironment_New(void) {
 
 void DestroyScriptContext(ScriptContext *ctx) {
     DestroyMsgData(ctx->msgdata);
+#ifdef OPTIMIZE_SCRIPT_BANK_PREFETCH
+    if (ctx->mapScriptsShared) {
+        ScriptBankPrefetch_Release(ctx->mapScripts);
+    } else {
+        FreeToHeap(ctx->mapScripts);
+    }
+#else
     FreeToHeap(ctx->mapScripts);
+#endif //OPTIMIZE_SCRIPT_BANK_PREFETCH
     FreeToHeap(ctx);
 }
 
@@ -190,12 +285,31 @@ void SetUpScriptContextForMap(FieldSystem *fsys, ScriptContext *ctx, u16 scriptI
 u16 LoadScriptsAndMessagesByMapId(FieldSystem *fsys, ScriptContext *ctx, u16 scriptId) {
     const struct ScriptBankMapping *mapping_p = sScriptBankMapping;
     int i;
+#ifdef OPTIMIZE_SCRIPT_BANK_PREFETCH
+    int lo = 0;
+    int hi = NELEMS(sScriptBankMapping);
+
+    // sScriptBankMapping is sorted by descending scriptIdLo; find the first entry at or below scriptId
+    while (lo < hi) {
+        i = (lo + hi) / 2;
+        if (scriptId >= mapping_p[i].scriptIdLo) {
+            hi = i;
+        } else {
+            lo = i + 1;
+        }
+    }
+    if (lo < NELEMS(sScriptBankMapping)) {
+        LoadScriptsAndMessagesParameterized(fsys, ctx, mapping_p[lo].scriptBank, mapping_p[lo].msgBank);
+        return scriptId - mapping_p[lo].scriptIdLo;
+    }
+#else
     for (i = 0; i < NELEMS(sScriptBankMapping); i++) {
         if (scriptId >= mapping_p[i].scriptIdLo) {
             LoadScriptsAndMessagesParameterized(fsys, ctx, mapping_p[i].scriptBank, mapping_p[i].msgBank);
             return scriptId - mapping_p[i].scriptIdLo;
         }
     }
+#endif //OPTIMIZE_SCRIPT_BANK_PREFETCH
     if (scriptId >= 1) {
         LoadScriptsAndMessagesForCurrentMap(fsys, ctx);
         return scriptId - 1;
@@ -206,12 +320,26 @@ u16 LoadScriptsAndMessagesByMapId(FieldSystem *fsys, ScriptContext *ctx, u16 scr
 }
 
 void LoadScriptsAndMessagesParameterized(FieldSystem *fsys, ScriptContext *ctx, int scriptBank, u32 msgBank) {
+#ifdef OPTIMIZE_SCRIPT_BANK_PREFETCH
+    ctx->mapScripts = ScriptBankPrefetch_Acquire(ctx, scriptBank);
+    if (ctx->mapScripts == NULL) {
+        ctx->mapScripts = AllocAndReadWholeNarcMemberByIdPair(NARC_fielddata_script_scr_seq, scriptBank, HEAP_ID_FIELD);
+    }
+#else
     ctx->mapScripts = AllocAndReadWholeNarcMemberByIdPair(NARC_fielddata_script_scr_seq, scriptBank, HEAP_ID_FIELD);
+#endif //OPTIMIZE_SCRIPT_BANK_PREFETCH
     ctx->msgdata = NewMsgDataFromNarc(MSGDATA_LOAD_LAZY, NARC_msgdata_msg, msgBank, HEAP_ID_FIELD);
 }
 
 void LoadScriptsAndMessagesForCurrentMap(FieldSystem *fsys, ScriptContext *ctx) {
+#ifdef OPTIMIZE_SCRIPT_BANK_PREFETCH
+    ctx->mapScripts = ScriptBankPrefetch_Acquire(ctx, MapHeader_GetScriptsBank(fsys->location->mapId));
+    if (ctx->mapScripts == NULL) {
+        ctx->mapScripts = LoadScriptsForCurrentMap(fsys->location->mapId);
+    }
+#else
     ctx->mapScripts = LoadScriptsForCurrentMap(fsys->location->mapId);
+#endif //OPTIMIZE_SCRIPT_BANK_PREFETCH
     ctx->msgdata = NewMsgDataFromNarc(MSGDATA_LOAD_LAZY, NARC_msgdata_msg, GetCurrentMapMessageBank(fsys->location->mapId), HEAP_ID_FIELD);
 }
 
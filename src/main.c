@@ -105,6 +105,9 @@ void NitroMain(void) {
             OS_GetTick();
             Main_RunOverlayManager();
             OS_GetTick();
+#ifdef OPTIMIZE_OVERLAY_PREFETCH
+            HandleOverlayPrefetch();
+#endif //OPTIMIZE_OVERLAY_PREFETCH
             sub_0201F880(gSystem.unk18);
             sub_0201F880(gSystem.unk24);
             if (!gSystem.unk30) {
@@ -9,6 +9,79 @@
 #include "event_data.h"
 #include "sys_vars.h"
 
+#ifdef OPTIMIZE_MAP_MATRIX_CACHE
+static u8* MapMatrixCache_GetBuffer(MAPMATRIXCACHE* cache, u16 matrix_id) {
+    s32 i;
+    MAPMATRIXCACHEENTRY* entry;
+    MAPMATRIXCACHEENTRY* victim = NULL;
+
+    cache->clock++;
+
+    for (i = 0; i < MAP_MATRIX_CACHE_SIZE; i++) {
+        entry = &cache->entries[i];
+        if (entry->buffer == NULL) {
+            if (victim == NULL || victim->buffer != NULL) {
+                victim = entry;
+            }
+        } else if (entry->matrix_id == matrix_id) {
+            entry->last_used = cache->clock;
+            cache->hits++;
+            return entry->buffer;
+        } else if (victim == NULL || (victim->buffer != NULL && (u16)(cache->clock - entry->last_used) > (u16)(cache->clock - victim->last_used))) {
+            victim = entry;
+        }
+    }
+
+    // Miss: evict the least recently used matrix
+    if (victim->buffer != NULL) {
+        FreeToHeap(victim->buffer);
+    }
+    victim->buffer = AllocAtEndAndReadWholeNarcMemberByIdPair(NARC_fielddata_mapmatrix_map_matrix, matrix_id, HEAP_ID_FIELD);
+    victim->matrix_id = matrix_id;
+    victim->last_used = cache->clock;
+    cache->misses++;
+
+    return victim->buffer;
+}
+
+static void MapMatrix_MapMatrixData_Load(MAPMATRIXDATA* map_matrix_data, MAPMATRIXCACHE* cache, u16 matrix_id, u32 map_no) {
+    u8* cursor = MapMatrixCache_GetBuffer(cache, matrix_id);
+
+    map_matrix_data->width = *(cursor++);
+    map_matrix_data->height = *(cursor++);
+
+    u8 has_headers_section = *(cursor++);
+    u8 has_altitudes_section = *(cursor++);
+
+    u8 name_length = *(cursor++);
+    GF_ASSERT(name_length <= MAP_MATRIX_MAX_NAME_LENGTH);
+
+    s32 size = map_matrix_data->width * map_matrix_data->height;
+    GF_ASSERT(size <= MAP_MATRIX_MAX_SIZE);
+
+    // Every section below rewrites all width * height cells, so only the
+    // name and a missing altitudes section need clearing.
+    MI_CpuClear8(map_matrix_data->name, MAP_MATRIX_MAX_NAME_LENGTH);
+    MI_CpuCopy8(cursor, &map_matrix_data->name, name_length);
+    cursor += name_length;
+
+    if (has_headers_section) {
+        MI_CpuCopy8(cursor, &map_matrix_data->headers, size * sizeof(u16));
+        cursor += size * sizeof(u16);
+    } else {
+        MIi_CpuClear16((u16)map_no, (u16*)&map_matrix_data->headers, size * sizeof(u16));
+    }
+
+    if (has_altitudes_section) {
+        MI_CpuCopy8(cursor, &map_matrix_data->altitudes, size * sizeof(u8));
+        cursor += size * sizeof(u8);
+    } else {
+        MI_CpuClear8(&map_matrix_data->altitudes, size * sizeof(u8));
+    }
+
+    MI_CpuCopy8(cursor, map_matrix_data->maps.models, size * sizeof(u16));
+}
+#else
 static void MapMatrix_MapMatrixData_Load(MAPMATRIXDATA* map_matrix_data, u16 matrix_id, u32 map_no) {
     map_matrix_data->width = 0;
     map_matrix_data->height = 0;
@@ -55,12 +128,16 @@ static void MapMatrix_MapMatrixData_Load(MAPMATRIXDATA* map_matrix_data, u16 mat
     MI_CpuCopy8(cursor, map_matrix_data->maps.models, map_matrix_data->width * map_matrix_data->height * sizeof(u16));
     FreeToHeap(buffer);
 }
+#endif //OPTIMIZE_MAP_MATRIX_CACHE
 
 MAPMATRIX* MapMatrix_New(void) {
     MAPMATRIX* map_matrix = AllocFromHeap(HEAP_ID_FIELD, sizeof(MAPMATRIX));
     map_matrix->width = 0;
     map_matrix->height = 0;
     map_matrix->matrix_id = 0;
+#ifdef OPTIMIZE_MAP_MATRIX_CACHE
+    MI_CpuClear8(&map_matrix->cache, sizeof(MAPMATRIXCACHE));
+#endif //OPTIMIZE_MAP_MATRIX_CACHE
 
     return map_matrix;
 }
@@ -68,7 +145,11 @@ MAPMATRIX* MapMatrix_New(void) {
 void MapMatrix_Load(u32 map_no, MAPMATRIX* map_matrix) {
     u16 matrix_id = MapHeader_GetMatrixId(map_no);
 
+#ifdef OPTIMIZE_MAP_MATRIX_CACHE
+    MapMatrix_MapMatrixData_Load(&map_matrix->data, &map_matrix->cache, matrix_id, map_no);
+#else
     MapMatrix_MapMatrixData_Load(&map_matrix->data, matrix_id, map_no);
+#endif //OPTIMIZE_MAP_MATRIX_CACHE
 
     map_matrix->matrix_id = matrix_id;
     map_matrix->height = map_matrix->data.height;
@@ -76,6 +157,15 @@ void MapMatrix_Load(u32 map_no, MAPMATRIX* map_matrix) {
 }
 
 void MapMatrix_Free(MAPMATRIX* map_matrix) {
+#ifdef OPTIMIZE_MAP_MATRIX_CACHE
+    s32 i;
+
+    for (i = 0; i < MAP_MATRIX_CACHE_SIZE; i++) {
+        if (map_matrix->cache.entries[i].buffer != NULL) {
+            FreeToHeap(map_matrix->cache.entries[i].buffer);
+        }
+    }
+#endif //OPTIMIZE_MAP_MATRIX_CACHE
     FreeToHeap(map_matrix);
 }
 
@@ -1,5 +1,6 @@
 #include "poke_overlay.h"
 #include "global.h"
+#include "overlay_manager.h"
 
 #define OVY_MAX_PER_REGION            (8)
 
@@ -25,6 +26,187 @@ static BOOL LoadOverlayNoInit(MIProcessor proc, FSOverlayID ovyId);
 static BOOL LoadOverlayNoInitAsync(MIProcessor proc, FSOverlayID ovyId);
 static BOOL GetOverlayRamBounds(FSOverlayID ovyId, void **start, void **end);
 
+#ifdef OPTIMIZE_OVERLAY_PREFETCH
+#define OVY_LEARNED_TRANSITIONS_MAX   (16)
+#define OVY_LOAD_LOG_SIZE             (32)
+
+typedef struct PMiOverlayTransition {
+    FSOverlayID from;
+    FSOverlayID to;
+} PMiOverlayTransition;
+
+typedef struct PMiOverlayPrefetch {
+    FSOverlayID id;
+    BOOL active; // image requested but the overlay has not been started
+    FSOverlayInfo info;
+    FSFile file;
+} PMiOverlayPrefetch;
+
+typedef struct PMiOverlayLoadRecord {
+    FSOverlayID id;
+    u32 stallTicks;
+    u8 loadType;
+    u8 prefetched;
+} PMiOverlayLoadRecord;
+
+typedef struct PMiOverlayLoadStats {
+    u32 loads;
+    u32 prefetchHits;
+    u32 prefetchDrops;
+    u32 stallTicks;
+    PMiOverlayLoadRecord log[OVY_LOAD_LOG_SIZE];
+    u8 logPos;
+} PMiOverlayLoadStats;
+
+// The transition graph, and the overlays that are loaded without going
+// through HandleLoadOverlay, taken from the call sites by tools/ovyreplay.
+// Transitions seen at run time take priority over the graph.
+#include "data/overlay_transitions.h"
+
+static PMiOverlayTransition sLearnedTransitions[OVY_LEARNED_TRANSITIONS_MAX];
+static u8 sNumLearnedTransitions;
+static u8 sLearnedTransitionsPos;
+static FSOverlayID sLastLoadedOverlay = FS_OVERLAY_ID_NONE;
+static PMiOverlayPrefetch sOverlayPrefetch;
+static PMiOverlayLoadStats sOverlayLoadStats;
+
+static BOOL OverlaysOverlap(FSOverlayID ovyId1, FSOverlayID ovyId2) {
+    void *start1, *end1;
+    void *start2, *end2;
+
+    if (!GetOverlayRamBounds(ovyId1, &start1, &end1) || !GetOverlayRamBounds(ovyId2, &start2, &end2)) {
+        return TRUE;
+    }
+    return start1 < end2 && start2 < end1;
+}
+
+static BOOL IsOverlayLoaded(FSOverlayID ovyId) {
+    int i;
+    PMiLoadedOverlay *table = GetLoadedOverlaysInRegion(GetOverlayLoadDestination(ovyId));
+    for (i = 0; i < OVY_MAX_PER_REGION; i++) {
+        if (table[i].active == TRUE && table[i].id == ovyId) {
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
+
+// FS_LoadOverlay does not know about an image being read in, so nothing that
+// shares RAM with an overlay loaded that way is ever prefetched
+static BOOL SharesRamWithDirectLoad(FSOverlayID ovyId) {
+    int i;
+
+    for (i = 0; i < NELEMS(sOverlaysLoadedDirectly); i++) {
+        if (OverlaysOverlap(ovyId, sOverlaysLoadedDirectly[i])) {
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
+
+static FSOverlayID PredictNextOverlay(FSOverlayID ovyId) {
+    int i;
+
+    if (ovyId == FS_OVERLAY_ID_NONE) {
+        return FS_OVERLAY_ID_NONE;
+    }
+    for (i = 0; i < sNumLearnedTransitions; i++) {
+        if (sLearnedTransitions[i].from == ovyId) {
+            return sLearnedTransitions[i].to;
+        }
+    }
+    for (i = 0; i < NELEMS(sOverlayTransitionGraph); i++) {
+        if (sOverlayTransitionGraph[i].from == ovyId) {
+            return sOverlayTransitionGraph[i].to;
+        }
+    }
+    return FS_OVERLAY_ID_NONE;
+}
+
+static void LearnOverlayTransition(FSOverlayID from, FSOverlayID to) {
+    int i;
+
+    if (from == FS_OVERLAY_ID_NONE || from == to) {
+        return;
+    }
+    for (i = 0; i < sNumLearnedTransitions; i++) {
+        if (sLearnedTransitions[i].from == from) {
+            sLearnedTransitions[i].to = to;
+            return;
+        }
+    }
+    // Once the table is full, replace the oldest entry
+    if (sNumLearnedTransitions < OVY_LEARNED_TRANSITIONS_MAX) {
+        sNumLearnedTransitions++;
+    }
+    sLearnedTransitions[sLearnedTransitionsPos].from = from;
+    sLearnedTransitions[sLearnedTransitionsPos].to = to;
+    sLearnedTransitionsPos = (sLearnedTransitionsPos + 1) % OVY_LEARNED_TRANSITIONS_MAX;
+}
+
+// Waits for the prefetched image. It is only started if start is TRUE; otherwise
+// its memory is simply handed back for another overlay to overwrite.
+static BOOL FinishOverlayPrefetch(BOOL start) {
+    BOOL result;
+
+    GF_ASSERT(sOverlayPrefetch.active == TRUE);
+    result = FS_WaitAsync(&sOverlayPrefetch.file);
+    FS_CloseFile(&sOverlayPrefetch.file);
+    sOverlayPrefetch.active = FALSE;
+    if (result && start) {
+        FS_StartOverlay(&sOverlayPrefetch.info);
+    }
+    return result;
+}
+
+static void LogOverlayLoad(FSOverlayID ovyId, PMOverlayLoadType loadType, OSTick startTick, BOOL prefetched) {
+    PMiOverlayLoadRecord *record = &sOverlayLoadStats.log[sOverlayLoadStats.logPos];
+
+    record->id = ovyId;
+    record->stallTicks = (u32)(OS_GetTick() - startTick);
+    record->loadType = loadType;
+    record->prefetched = prefetched;
+    sOverlayLoadStats.logPos = (sOverlayLoadStats.logPos + 1) % OVY_LOAD_LOG_SIZE;
+    sOverlayLoadStats.loads++;
+    sOverlayLoadStats.stallTicks += record->stallTicks;
+    if (prefetched) {
+        sOverlayLoadStats.prefetchHits++;
+    }
+}
+
+void HandleOverlayPrefetch(void) {
+    FSOverlayID nextId = PredictNextOverlay(sLastLoadedOverlay);
+
+    if (sOverlayPrefetch.active) {
+        // Give up on an image the prediction has moved away from, but never wait for it
+        if (sOverlayPrefetch.id == nextId || FS_IsBusy(&sOverlayPrefetch.file)) {
+            return;
+        }
+        FinishOverlayPrefetch(FALSE);
+        sOverlayLoadStats.prefetchDrops++;
+    }
+    if (nextId == FS_OVERLAY_ID_NONE || IsOverlayLoaded(nextId)) {
+        return;
+    }
+    // TCM overlays need the card DMA switched off, so they are left to load on demand
+    if (GetOverlayLoadDestination(nextId) != OVY_REGION_MAIN || !CanOverlayBeLoaded(nextId)) {
+        return;
+    }
+    if (SharesRamWithDirectLoad(nextId)) {
+        return;
+    }
+    if (!FS_LoadOverlayInfo(&sOverlayPrefetch.info, MI_PROCESSOR_ARM9, nextId)) {
+        return;
+    }
+    FS_InitFile(&sOverlayPrefetch.file);
+    if (!FS_LoadOverlayImageAsync(&sOverlayPrefetch.info, &sOverlayPrefetch.file)) {
+        return;
+    }
+    sOverlayPrefetch.id = nextId;
+    sOverlayPrefetch.active = TRUE;
+}
+#endif //OPTIMIZE_OVERLAY_PREFETCH
+
 static void FreeOverlayAllocation(PMiLoadedOverlay *ovload) {
     GF_ASSERT(ovload->active == TRUE);
     GF_ASSERT(FS_UnloadOverlay(MI_PROCESSOR_ARM9, ovload->id) == TRUE);
@@ -66,6 +248,15 @@ BOOL HandleLoadOverlay(FSOverlayID ovyId, PMOverlayLoadType loadType) {
     PMiOverlayRegion overlayRegion;
     PMiLoadedOverlay *loadedOverlays;
     int i;
+#ifdef OPTIMIZE_OVERLAY_PREFETCH
+    OSTick startTick = OS_GetTick();
+    BOOL prefetched = FALSE;
+
+    if (sOverlayPrefetch.active && sOverlayPrefetch.id != ovyId && OverlaysOverlap(ovyId, sOverlayPrefetch.id)) {
+        FinishOverlayPrefetch(FALSE);
+        sOverlayLoadStats.prefetchDrops++;
+    }
+#endif //OPTIMIZE_OVERLAY_PREFETCH
 
     if (!CanOverlayBeLoaded(ovyId)) {
         return FALSE;
@@ -90,6 +281,14 @@ BOOL HandleLoadOverlay(FSOverlayID ovyId, PMOverlayLoadType loadType) {
         dmaBak = FS_SetDefaultDMA(FS_DMA_NOT_USE);
     }
 
+#ifdef OPTIMIZE_OVERLAY_PREFETCH
+    if (sOverlayPrefetch.active && sOverlayPrefetch.id == ovyId) {
+        prefetched = FinishOverlayPrefetch(TRUE);
+    }
+    if (prefetched) {
+        result = TRUE;
+    } else
+#endif //OPTIMIZE_OVERLAY_PREFETCH
     switch (loadType) {
     case OVY_LOAD_NORMAL:
         result = LoadOverlayNormal(MI_PROCESSOR_ARM9, ovyId);
@@ -114,6 +313,12 @@ BOOL HandleLoadOverlay(FSOverlayID ovyId, PMOverlayLoadType loadType) {
         return FALSE;
     }
 
+#ifdef OPTIMIZE_OVERLAY_PREFETCH
+    LogOverlayLoad(ovyId, loadType, startTick, prefetched);
+    LearnOverlayTransition(sLastLoadedOverlay, ovyId);
+    sLastLoadedOverlay = ovyId;
+#endif //OPTIMIZE_OVERLAY_PREFETCH
+
     return TRUE;
 }
 
@@ -2783,6 +2783,97 @@ BOOL Pokemon_TryLevelUp(Pokemon *mon) {
     return FALSE;
 }
 
+#ifdef OPTIMIZE_EVOLUTION_INDEX
+// Every species' evolutions, packed without the EVO_NONE padding of the evo
+// NARC. One block holds the header, the offsets and the entries; it lives
+// from EvolutionIndex_Init to EvolutionIndex_Free.
+typedef struct EvolutionIndex {
+    u16 numSpecies;
+    u16 numEvos;
+    struct Evolution *evos;
+    u16 start[0]; // numSpecies + 1 offsets into evos
+} EvolutionIndex;
+
+// Layout of a member of the evo NARC
+typedef struct EvolutionFile {
+    struct Evolution evos[MAX_EVOS_PER_POKE];
+    u16 padding;
+} EvolutionFile;
+
+static EvolutionIndex *sEvolutionIndex;
+
+void EvolutionIndex_Init(HeapID heap_id) {
+    NARC *narc;
+    EvolutionFile file;
+    u16 numSpecies;
+    u32 count;
+    u32 size;
+    int species;
+    int i;
+
+    GF_ASSERT(sEvolutionIndex == NULL);
+    narc = NARC_New(NARC_poketool_personal_evo, heap_id);
+    numSpecies = NARC_GetFileCount(narc);
+
+    // Size the table first, so that it takes one block and never grows
+    count = 0;
+    for (species = 0; species < numSpecies; species++) {
+        GF_ASSERT(NARC_GetMemberSize(narc, species) <= sizeof(EvolutionFile));
+        NARC_ReadWholeMember(narc, species, &file);
+        for (i = 0; i < MAX_EVOS_PER_POKE; i++) {
+            if (file.evos[i].method != EVO_NONE) {
+                count++;
+            }
+        }
+    }
+    size = sizeof(EvolutionIndex) + (numSpecies + 1) * sizeof(u16);
+    size = (size + 3) & ~3;
+    sEvolutionIndex = AllocFromHeap(heap_id, size + count * sizeof(struct Evolution));
+    sEvolutionIndex->numSpecies = numSpecies;
+    sEvolutionIndex->numEvos = count;
+    sEvolutionIndex->evos = (struct Evolution *)((u8 *)sEvolutionIndex + size);
+
+    count = 0;
+    for (species = 0; species < numSpecies; species++) {
+        NARC_ReadWholeMember(narc, species, &file);
+        sEvolutionIndex->start[species] = count;
+        for (i = 0; i < MAX_EVOS_PER_POKE; i++) {
+            if (file.evos[i].method != EVO_NONE) {
+                sEvolutionIndex->evos[count++] = file.evos[i];
+            }
+        }
+    }
+    GF_ASSERT(count == sEvolutionIndex->numEvos);
+    sEvolutionIndex->start[species] = count;
+    NARC_Delete(narc);
+}
+
+void EvolutionIndex_Free(void) {
+    if (sEvolutionIndex != NULL) {
+        FreeToHeap(sEvolutionIndex);
+        sEvolutionIndex = NULL;
+    }
+}
+
+// Fills evoTable the way LoadMonEvolutionTable would, minus the EVO_NONE gaps.
+// Outside the index's lifetime it reads the member; the member is two bytes
+// longer than evoTable, so it goes through an EvolutionFile.
+static void EvolutionIndex_GetTable(u16 species, struct Evolution *evoTable) {
+    EvolutionFile file;
+    int n;
+
+    if (sEvolutionIndex == NULL) {
+        LoadMonEvolutionTable(species, file.evos);
+        MI_CpuCopy8(file.evos, evoTable, sizeof(file.evos));
+        return;
+    }
+    GF_ASSERT(species < sEvolutionIndex->numSpecies);
+    n = sEvolutionIndex->start[species + 1] - sEvolutionIndex->start[species];
+    MI_CpuCopy8(&sEvolutionIndex->evos[sEvolutionIndex->start[species]], evoTable, n * sizeof(struct Evolution));
+    MI_CpuClear8(&evoTable[n], (MAX_EVOS_PER_POKE - n) * sizeof(struct Evolution));
+}
+#endif //OPTIMIZE_EVOLUTION_INDEX
+
 u16 GetMonEvolution(PARTY *party, Pokemon *mon, u8 context, u16 usedItem, int *method_ret) {
     u16 species;
     u16 heldItem;
@@ -2796,6 +2887,11 @@ u16 GetMonEvolution(PARTY *party, Pokemon *mon, u8 context, u16 usedItem, int *m
     u16 pid_hi = 0;
     struct Evolution *evoTable;
     int method_local;
+#ifdef OPTIMIZE_EVOLUTION_INDEX
+    struct Evolution evoTableBuf[MAX_EVOS_PER_POKE];
+    // Decrypt the mon once for every field read below
+    BOOL decry = AcquireMonLock(mon);
+#endif //OPTIMIZE_EVOLUTION_INDEX
 
     species = GetMonData(mon, MON_DATA_SPECIES, NULL);
     heldItem = GetMonData(mon, MON_DATA_HELD_ITEM, NULL);
@@ -2805,17 +2901,28 @@ u16 GetMonEvolution(PARTY *party, Pokemon *mon, u8 context, u16 usedItem, int *m
     holdEffect = GetItemAttr(heldItem, ITEMATTR_HOLD_EFFECT, HEAP_ID_0);
     // Kadabra bypasses Everstone because he's just that broken.
     if (species != SPECIES_KADABRA && holdEffect == HOLD_EFFECT_NO_EVOLVE && context != EVOCTX_ITEM_USE) {
+#ifdef OPTIMIZE_EVOLUTION_INDEX
+        ReleaseMonLock(mon, decry);
+#endif //OPTIMIZE_EVOLUTION_INDEX
         return SPECIES_NONE;
     }
     // Spiky-ear Pichu cannot evolve
     if (species == SPECIES_PICHU && GetMonData(mon, MON_DATA_FORME, 0) == 1) {
+#ifdef OPTIMIZE_EVOLUTION_INDEX
+        ReleaseMonLock(mon, decry);
+#endif //OPTIMIZE_EVOLUTION_INDEX
         return SPECIES_NONE;
     }
     if (method_ret == NULL) {
         method_ret = &method_local;
     }
+#ifdef OPTIMIZE_EVOLUTION_INDEX
+    evoTable = evoTableBuf;
+    EvolutionIndex_GetTable(species, evoTable);
+#else
     evoTable = AllocFromHeap(HEAP_ID_0, MAX_EVOS_PER_POKE * sizeof(struct Evolution));
     LoadMonEvolutionTable(species, evoTable);
+#endif //OPTIMIZE_EVOLUTION_INDEX
     switch (context) {
     case EVOCTX_LEVELUP:
         level = (u8)GetMonData(mon, MON_DATA_LEVEL, NULL);
@@ -3003,7 +3110,11 @@ u16 GetMonEvolution(PARTY *party, Pokemon *mon, u8 context, u16 usedItem, int *m
         }
         break;
     }
+#ifdef OPTIMIZE_EVOLUTION_INDEX
+    ReleaseMonLock(mon, decry);
+#else
     FreeToHeap(evoTable);
+#endif //OPTIMIZE_EVOLUTION_INDEX
     return target;
 }
 
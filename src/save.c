@@ -62,6 +62,16 @@ static int Save_WritePCFooter(SaveData *saveData, struct SaveSlotSpec *spec, u8
 static u32 Save_CalcPCBoxModifiedFlags(SaveData *saveData);
 static u32 PCModifiedFlags_CountModifiedBoxes(u32 flags);
 static u32 PCModifiedFlags_GetIndexOfNthModifiedBox(u32 flags, u8 last);
+#ifdef OPTIMIZE_SAVE_DIRTY_CHUNKS
+static u16 SaveCRC16_MulMod(u16 a, u16 b);
+static void SaveDirtyChunks_Init(SaveData *saveData);
+static void SaveDirtyChunks_Sum(const u32 *words, u32 size, struct SaveArrayFingerprint *fingerprint);
+static void SaveDirtyChunks_Refresh(SaveData *saveData, const u8 *data);
+static u16 SaveDirtyChunks_ChainCRC(SaveData *saveData, const struct SaveArrayFingerprint *fingerprints);
+static void SaveDirtyChunks_RecordSector(SaveData *saveData, int sector, const u8 *data);
+static BOOL SaveDirtyChunks_ArrayIsDirty(SaveData *saveData, int idx, u8 slot);
+static int Save_WriteNextDirtyRunAsync(SaveData *saveData, struct AsyncWriteManager *writeMan, u8 slot);
+#endif //OPTIMIZE_SAVE_DIRTY_CHUNKS
 
 SaveData *SaveData_New(void) {
     SaveData *ret;
@@ -81,6 +91,9 @@ SaveData *SaveData_New(void) {
 
     SaveData_InitSubstructs(ret->arrayHeaders);
     SaveData_InitSlotSpecs(ret->saveSlotSpecs, ret->arrayHeaders);
+#ifdef OPTIMIZE_SAVE_DIRTY_CHUNKS
+    SaveDirtyChunks_Init(ret);
+#endif //OPTIMIZE_SAVE_DIRTY_CHUNKS
 
     status = Save_GetSaveFilesStatus(ret);
     ret->statusFlags = 0;
@@ -369,10 +382,178 @@ static void SaveSlot_BuildFooter(SaveData *saveData, void *data, int idx) {
     footer->size = spec->size;
     footer->magic = SAVE_CHUNK_MAGIC;
     footer->slot = idx;
+#ifdef OPTIMIZE_SAVE_DIRTY_CHUNKS
+    if (idx == 0) {
+        SaveDirtyChunks_Refresh(saveData, data);
+        footer->crc = SaveDirtyChunks_ChainCRC(saveData, saveData->dirtyChunks.current);
+    } else {
+        footer->crc = SaveArray_CalcCRC16MinusFooter(saveData, (u8 *)data + offset, spec->size);
+    }
+#else
     footer->crc = SaveArray_CalcCRC16MinusFooter(saveData, (u8 *)data + offset, spec->size);
+#endif //OPTIMIZE_SAVE_DIRTY_CHUNKS
     SaveFooterDebugPrn(footer);
 }
 
+#ifdef OPTIMIZE_SAVE_DIRTY_CHUNKS
+// Multiplies two polynomials mod the CRC-16/CCITT polynomial
+static u16 SaveCRC16_MulMod(u16 a, u16 b) {
+    int i;
+    u16 ret = 0;
+
+    for (i = 15; i >= 0; i--) {
+        if (ret & 0x8000) {
+            ret = (ret << 1) ^ 0x1021;
+        } else {
+            ret <<= 1;
+        }
+        if (b & (1 << i)) {
+            ret ^= a;
+        }
+    }
+    return ret;
+}
+
+static void SaveDirtyChunks_Init(SaveData *saveData) {
+    struct SaveDirtyChunks *tracker = &saveData->dirtyChunks;
+    int i;
+    u32 n;
+    u16 base;
+    u16 shift;
+
+    // Normal data is the run of arrays at the start of the region that belong to slot 0
+    tracker->numArrays = 0;
+    for (i = 0; i < SAVE_BLOCK_NUM && saveData->arrayHeaders[i].slot == 0; i++) {
+        tracker->numArrays++;
+        // Feeding n zero bytes through the CRC register multiplies it by x^(8n)
+        shift = 1;
+        base = 1 << 8;
+        for (n = saveData->arrayHeaders[i].size; n != 0; n >>= 1) {
+            if (n & 1) {
+                shift = SaveCRC16_MulMod(shift, base);
+            }
+            base = SaveCRC16_MulMod(base, base);
+        }
+        tracker->crcShift[i] = shift;
+    }
+    tracker->sectorKnown[0] = FALSE;
+    tracker->sectorKnown[1] = FALSE;
+    tracker->currentKnown = FALSE;
+    tracker->planned = FALSE;
+}
+
+// Each step of the rotating sum is a bijection, so a change to any single word always shows up in it
+static void SaveDirtyChunks_Sum(const u32 *words, u32 size, struct SaveArrayFingerprint *fingerprint) {
+    u32 i;
+    u32 sum = 0;
+    u32 sumOfSums = 0;
+
+    for (i = 0; i < size / 4; i++) {
+        sum = ((sum << 1) | (sum >> 31)) + words[i];
+        sumOfSums += sum;
+    }
+    fingerprint->sum = sum;
+    fingerprint->sumOfSums = sumOfSums;
+}
+
+// Brings the fingerprints of what is in RAM up to date. Arrays whose sums have not moved keep their cached CRC.
+static void SaveDirtyChunks_Refresh(SaveData *saveData, const u8 *data) {
+    struct SaveDirtyChunks *tracker = &saveData->dirtyChunks;
+    struct SaveArrayFingerprint fingerprint;
+    const u8 *array;
+    int i;
+
+    for (i = 0; i < tracker->numArrays; i++) {
+        array = data + saveData->arrayHeaders[i].offset;
+        SaveDirtyChunks_Sum((const u32 *)array, saveData->arrayHeaders[i].size, &fingerprint);
+        if (!tracker->currentKnown || fingerprint.sum != tracker->current[i].sum || fingerprint.sumOfSums != tracker->current[i].sumOfSums) {
+            tracker->current[i].sum = fingerprint.sum;
+            tracker->current[i].sumOfSums = fingerprint.sumOfSums;
+            tracker->current[i].crc = GF_CalcCRC16(array, saveData->arrayHeaders[i].size);
+            tracker->stats.bytesCrced += saveData->arrayHeaders[i].size;
+        }
+    }
+    tracker->currentKnown = TRUE;
+}
+
+// The arrays fill the block up to its footer, so the block CRC is the array CRCs chained together
+static u16 SaveDirtyChunks_ChainCRC(SaveData *saveData, const struct SaveArrayFingerprint *fingerprints) {
+    int i;
+    u16 crc = 0xFFFF;
+
+    for (i = 0; i < saveData->dirtyChunks.numArrays; i++) {
+        crc = SaveCRC16_MulMod(crc ^ 0xFFFF, saveData->dirtyChunks.crcShift[i]) ^ fingerprints[i].crc;
+    }
+    return crc;
+}
+
+static void SaveDirtyChunks_RecordSector(SaveData *saveData, int sector, const u8 *data) {
+    struct SaveArrayFingerprint *fingerprints = saveData->dirtyChunks.sector[sector];
+    const u8 *array;
+    int i;
+
+    for (i = 0; i < saveData->dirtyChunks.numArrays; i++) {
+        array = data + saveData->arrayHeaders[i].offset;
+        SaveDirtyChunks_Sum((const u32 *)array, saveData->arrayHeaders[i].size, &fingerprints[i]);
+        fingerprints[i].crc = GF_CalcCRC16(array, saveData->arrayHeaders[i].size);
+    }
+    saveData->dirtyChunks.sectorKnown[sector] = TRUE;
+}
+
+static BOOL SaveDirtyChunks_ArrayIsDirty(SaveData *saveData, int idx, u8 slot) {
+    struct SaveDirtyChunks *tracker = &saveData->dirtyChunks;
+
+    if (saveData->sectorCleanFlag[slot] || !tracker->sectorKnown[slot]) {
+        return TRUE;
+    }
+    return tracker->current[idx].sum != tracker->sector[slot][idx].sum
+        || tracker->current[idx].sumOfSums != tracker->sector[slot][idx].sumOfSums
+        || tracker->current[idx].crc != tracker->sector[slot][idx].crc;
+}
+
+// Starts writing the next run of arrays that differ from what the target sector holds.
+// Returns -1 once there is nothing left to write.
+static int Save_WriteNextDirtyRunAsync(SaveData *saveData, struct AsyncWriteManager *writeMan, u8 slot) {
+    struct SaveDirtyChunks *tracker;
+    struct SaveSlotSpec *spec;
+    int i;
+    int first;
+    u32 offset;
+    u32 size;
+
+    tracker = &saveData->dirtyChunks;
+    spec = &saveData->saveSlotSpecs[writeMan->curSector];
+    if (!tracker->planned) {
+        MI_CpuClear8(&tracker->stats, sizeof(struct SaveDirtyChunkStats));
+        SaveSlot_BuildFooter(saveData, saveData->dynamic_region, writeMan->curSector);
+        tracker->planned = TRUE;
+        tracker->nextArray = 0;
+    }
+    i = tracker->nextArray;
+    while (i < tracker->numArrays && !SaveDirtyChunks_ArrayIsDirty(saveData, i, slot)) {
+        tracker->stats.bytesSkipped += saveData->arrayHeaders[i].size;
+        i++;
+    }
+    if (i == tracker->numArrays) {
+        tracker->nextArray = i;
+        return -1;
+    }
+    first = i;
+    while (i < tracker->numArrays && SaveDirtyChunks_ArrayIsDirty(saveData, i, slot)) {
+        i++;
+    }
+    tracker->nextArray = i;
+    offset = saveData->arrayHeaders[first].offset;
+    size = saveData->arrayHeaders[i - 1].offset + saveData->arrayHeaders[i - 1].size - offset;
+    tracker->stats.bytesWritten += size;
+    return FlashWriteChunkInternal(GetChunkOffsetFromCurrentSaveSlot(slot, spec) + offset - spec->offset, saveData->dynamic_region + offset, size);
+}
+
+void Save_GetDirtyChunkStats(SaveData *saveData, struct SaveDirtyChunkStats *stats) {
+    *stats = saveData->dirtyChunks.stats;
+}
+#endif //OPTIMIZE_SAVE_DIRTY_CHUNKS
+
 static int SaveCounterCompare(u32 stat1, u32 stat2) {
     if (stat1 == -1 && stat2 == 0) {
         return -1;
@@ -444,6 +625,11 @@ static int Save_GetSaveFilesStatus(SaveData *saveData) {
     if (FlashLoadChunk(0 * 0x40000, data1, SAVE_PAGE_MAX * SAVE_SECTOR_SIZE)) {
         SaveSlotCheck_InitFromSavedat(&checks_main[0], saveData, data1, 0);
         SaveSlotCheck_InitFromSavedat(&checks_sub[0], saveData, data1, 1);
+#ifdef OPTIMIZE_SAVE_DIRTY_CHUNKS
+        if (checks_main[0].valid) {
+            SaveDirtyChunks_RecordSector(saveData, 0, data1);
+        }
+#endif //OPTIMIZE_SAVE_DIRTY_CHUNKS
     } else {
         SaveSlotCheck_InitDummy(&checks_main[0]);
         SaveSlotCheck_InitDummy(&checks_sub[0]);
@@ -451,6 +637,11 @@ static int Save_GetSaveFilesStatus(SaveData *saveData) {
     if (FlashLoadChunk(1 * 0x40000, data2, SAVE_PAGE_MAX * SAVE_SECTOR_SIZE)) {
         SaveSlotCheck_InitFromSavedat(&checks_main[1], saveData, data2, 0);
         SaveSlotCheck_InitFromSavedat(&checks_sub[1], saveData, data2, 1);
+#ifdef OPTIMIZE_SAVE_DIRTY_CHUNKS
+        if (checks_main[1].valid) {
+            SaveDirtyChunks_RecordSector(saveData, 1, data2);
+        }
+#endif //OPTIMIZE_SAVE_DIRTY_CHUNKS
     } else {
         SaveSlotCheck_InitDummy(&checks_main[1]);
         SaveSlotCheck_InitDummy(&checks_sub[1]);
@@ -586,6 +777,13 @@ static BOOL Save_LoadDynamicRegion(SaveData *saveData) {
     pc_offs = saveData->saveSlotSpecs[1].offset;
     pc_size = PCStorage_GetSizeOfBox() * PCStorage_GetNumBoxes();
     saveData->pcStorageLastCRC = GF_CalcCRC16(data + pc_offs, pc_size);
+#ifdef OPTIMIZE_SAVE_DIRTY_CHUNKS
+    // RAM now holds what the sector holds, so its CRCs can seed the cache
+    if (saveData->dirtyChunks.sectorKnown[saveData->lastGoodSector]) {
+        MI_CpuCopy8(saveData->dirtyChunks.sector[saveData->lastGoodSector], saveData->dirtyChunks.current, sizeof(saveData->dirtyChunks.current));
+        saveData->dirtyChunks.currentKnown = TRUE;
+    }
+#endif //OPTIMIZE_SAVE_DIRTY_CHUNKS
     sub_020310A0(saveData);
     sub_0202C6FC(saveData);
     return TRUE;
@@ -623,6 +821,9 @@ static void Save_WriteManInit(SaveData *saveData, struct AsyncWriteManager *writ
     writeMan->unk_4 = 0;
     writeMan->curSector = 0;
     writeMan->numSectors = 2;
+#ifdef OPTIMIZE_SAVE_DIRTY_CHUNKS
+    saveData->dirtyChunks.planned = FALSE;
+#endif //OPTIMIZE_SAVE_DIRTY_CHUNKS
     Sys_SetSleepDisableFlag(1);
 }
 
@@ -630,7 +831,19 @@ static int HandleWriteSaveAsync_NormalData(SaveData *saveData, struct AsyncWrite
     BOOL result;
     switch (writeMan->state) {
     case 0:
+#ifdef OPTIMIZE_SAVE_DIRTY_CHUNKS
+        writeMan->lockId = Save_WriteNextDirtyRunAsync(saveData, writeMan, saveData->lastGoodSector == 0);
+        if (writeMan->lockId < 0) {
+            // Every array that differs from the target sector is on flash, so only the footer is left
+            writeMan->state = 2;
+            if (writeMan->curSector + 1 == writeMan->numSectors) {
+                return WRITE_STATUS_NEXT;
+            }
+            break;
+        }
+#else
         writeMan->lockId = Save_WriteSlotAsync(saveData, writeMan->curSector, saveData->lastGoodSector == 0);
+#endif //OPTIMIZE_SAVE_DIRTY_CHUNKS
         writeMan->waitingAsync = TRUE;
         writeMan->state++;
         // fallthrough
@@ -642,11 +855,17 @@ static int HandleWriteSaveAsync_NormalData(SaveData *saveData, struct AsyncWrite
         if (!result) {
             return WRITE_STATUS_TOTAL_FAIL;
         }
+#ifdef OPTIMIZE_SAVE_DIRTY_CHUNKS
+        // Go back for the next dirty run
+        writeMan->state = 0;
+        break;
+#else
         writeMan->state++;
         if (writeMan->curSector + 1 == writeMan->numSectors) {
             return WRITE_STATUS_NEXT;
         }
         // fallthrough
+#endif //OPTIMIZE_SAVE_DIRTY_CHUNKS
     case 2:
         writeMan->lockId = Save_WriteChunkFooterAsync(saveData, writeMan->curSector, saveData->lastGoodSector == 0);
         writeMan->waitingAsync = TRUE;
@@ -676,7 +895,14 @@ static void Save_WriteManFinish(SaveData *saveData, struct AsyncWriteManager *wr
         if (writeMan->rollbackCounter) {
             saveData->saveCounter = writeMan->count;
         }
+#ifdef OPTIMIZE_SAVE_DIRTY_CHUNKS
+        saveData->dirtyChunks.sectorKnown[saveData->lastGoodSector == 0] = FALSE;
+#endif //OPTIMIZE_SAVE_DIRTY_CHUNKS
     } else {
+#ifdef OPTIMIZE_SAVE_DIRTY_CHUNKS
+        MI_CpuCopy8(saveData->dirtyChunks.current, saveData->dirtyChunks.sector[saveData->lastGoodSector == 0], sizeof(saveData->dirtyChunks.current));
+        saveData->dirtyChunks.sectorKnown[saveData->lastGoodSector == 0] = TRUE;
+#endif //OPTIMIZE_SAVE_DIRTY_CHUNKS
         saveData->boxModifiedFlags = Save_GetPCBoxModifiedFlags(saveData);
         saveData->pcStorageLastCRC = saveData->pcStorageCRC;
         Save_ResetPCBoxModifiedFlags(saveData);
@@ -692,6 +918,9 @@ static void CancelAsyncSave(SaveData *saveData, struct AsyncWriteManager *writeM
     if (writeMan->rollbackCounter) {
         saveData->saveCounter = writeMan->count;
     }
+#ifdef OPTIMIZE_SAVE_DIRTY_CHUNKS
+    saveData->dirtyChunks.sectorKnown[saveData->lastGoodSector == 0] = FALSE;
+#endif //OPTIMIZE_SAVE_DIRTY_CHUNKS
     if (!CARD_TryWaitBackupAsync()) {
         CARD_CancelBackupAsync();
     }
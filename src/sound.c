@@ -77,6 +77,172 @@ void GF_SndCallback(void);
 BOOL GF_SndIsFanfarePlaying(void);
 BOOL GF_SndWorkMicCounterFull(void);
 
+#ifdef OPTIMIZE_SOUND_HEAP_RESIDENCY
+#define SND_RESIDENT_MAX       32
+#define SND_HEAP_TRACE_SIZE    64
+
+typedef enum SndHeapOp {
+    SND_HEAP_OP_GROUP,
+    SND_HEAP_OP_SEQ,
+    SND_HEAP_OP_SEQ_EX,
+    SND_HEAP_OP_WAVE_ARC,
+    SND_HEAP_OP_BANK,
+    SND_HEAP_OP_SAVE_STATE,
+    SND_HEAP_OP_LOAD_STATE,
+} SndHeapOp;
+
+// One successful GF_Snd_Load* call still on the heap
+typedef struct SndResident {
+    u8 op;
+    u8 level;
+    u16 no;
+    u32 loadFlag;
+    u32 size;
+} SndResident;
+
+typedef struct SndHeapTraceEntry {
+    u8 op;
+    u8 level;
+    u8 skipped;
+    u16 no;
+    u32 freeSize;
+} SndHeapTraceEntry;
+
+typedef struct SndHeapPlanner {
+    SndResident resident[SND_RESIDENT_MAX];
+    u8 numResident;
+    u8 level;
+    s8 pendingLevel;  // GF_Snd_LoadState not yet passed on to the heap, -1 if none
+    s8 overflowLevel; // loads from this level up were not recorded, -1 if none
+    u32 loads;
+    u32 skips;
+    u32 keptStates;
+    u32 minFreeSize;
+    SndHeapTraceEntry trace[SND_HEAP_TRACE_SIZE];
+    u8 tracePos;
+} SndHeapPlanner;
+
+static SndHeapPlanner sSndHeapPlanner;
+
+static void SndHeapPlanner_Init(void) {
+    SndHeapPlanner *planner = &sSndHeapPlanner;
+
+    MI_CpuClear8(planner, sizeof(SndHeapPlanner));
+    planner->pendingLevel = -1;
+    planner->overflowLevel = -1;
+    planner->minFreeSize = NNS_SndHeapGetFreeSize(GetSoundDataPointer()->heap);
+}
+
+static void SndHeapPlanner_Trace(SndHeapOp op, int no, BOOL skipped) {
+    SndHeapPlanner *planner = &sSndHeapPlanner;
+    SndHeapTraceEntry *entry = &planner->trace[planner->tracePos];
+
+    entry->op = op;
+    entry->level = planner->level;
+    entry->skipped = skipped;
+    entry->no = no;
+    entry->freeSize = NNS_SndHeapGetFreeSize(GetSoundDataPointer()->heap);
+    if (entry->freeSize < planner->minFreeSize) {
+        planner->minFreeSize = entry->freeSize;
+    }
+    planner->tracePos = (planner->tracePos + 1) % SND_HEAP_TRACE_SIZE;
+}
+
+static void SndHeapPlanner_DropAbove(int level) {
+    SndHeapPlanner *planner = &sSndHeapPlanner;
+
+    while (planner->numResident != 0 && planner->resident[planner->numResident - 1].level >= level) {
+        planner->numResident--;
+    }
+    if (planner->overflowLevel >= level) {
+        planner->overflowLevel = -1;
+    }
+    planner->level = level;
+}
+
+// Passes a deferred GF_Snd_LoadState on to the heap
+static void SndHeapPlanner_Flush(void) {
+    SndHeapPlanner *planner = &sSndHeapPlanner;
+
+    if (planner->pendingLevel >= 0) {
+        NNS_SndHeapLoadState(GetSoundDataPointer()->heap, planner->pendingLevel);
+        SndHeapPlanner_DropAbove(planner->pendingLevel);
+        planner->pendingLevel = -1;
+        GF_SndHeapGetFreeSize();
+    }
+}
+
+// Restoring a level usually comes right before loading the next BGM, which is
+// often the one the restore would free. If only one load sits above the level,
+// hold the restore back until the next request shows whether it is needed.
+static BOOL SndHeapPlanner_DeferLoadState(int level) {
+    SndHeapPlanner *planner = &sSndHeapPlanner;
+    int n = planner->numResident;
+
+    if (planner->overflowLevel >= 0 || planner->level != level) {
+        return FALSE;
+    }
+    if (n == 0 || planner->resident[n - 1].level < level || (n >= 2 && planner->resident[n - 2].level >= level)) {
+        return FALSE;
+    }
+    planner->pendingLevel = level;
+    return TRUE;
+}
+
+static BOOL SndResident_Matches(const SndResident *resident, SndHeapOp op, int no, u32 loadFlag) {
+    return resident->op == op && resident->no == no && resident->loadFlag == loadFlag;
+}
+
+// Returns TRUE if the heap already holds exactly what this load would add
+static BOOL SndHeapPlanner_IsResident(SndHeapOp op, int no, u32 loadFlag) {
+    SndHeapPlanner *planner = &sSndHeapPlanner;
+    int i;
+
+    if (planner->pendingLevel >= 0) {
+        if (SndResident_Matches(&planner->resident[planner->numResident - 1], op, no, loadFlag)) {
+            planner->pendingLevel = -1;
+            planner->keptStates++;
+            planner->skips++;
+            SndHeapPlanner_Trace(op, no, TRUE);
+            return TRUE;
+        }
+        SndHeapPlanner_Flush();
+    }
+    for (i = 0; i < planner->numResident; i++) {
+        if (SndResident_Matches(&planner->resident[i], op, no, loadFlag)) {
+            planner->skips++;
+            SndHeapPlanner_Trace(op, no, TRUE);
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
+
+static void SndHeapPlanner_AddResident(SndHeapOp op, int no, u32 loadFlag, BOOL loaded) {
+    SndHeapPlanner *planner = &sSndHeapPlanner;
+    SndResident *resident;
+
+    planner->loads++;
+    SndHeapPlanner_Trace(op, no, FALSE);
+    if (!loaded) {
+        return;
+    }
+    if (planner->numResident >= SND_RESIDENT_MAX) {
+        if (planner->overflowLevel < 0) {
+            planner->overflowLevel = planner->level;
+        }
+        return;
+    }
+    resident = &planner->resident[planner->numResident++];
+    resident->op = op;
+    resident->level = planner->level;
+    resident->no = no;
+    resident->loadFlag = loadFlag;
+    // sSndHeapFreeSize still holds the free size from before the load
+    resident->size = sSndHeapFreeSize - NNS_SndHeapGetFreeSize(GetSoundDataPointer()->heap);
+}
+#endif //OPTIMIZE_SOUND_HEAP_RESIDENCY
+
 void InitSoundData(SOUND_CHATOT *chatot, OPTIONS *options) {
     SND_WORK *work = GetSoundDataPointer();
     NNS_SndInit();
@@ -89,6 +255,9 @@ void InitSoundData(SOUND_CHATOT *chatot, OPTIONS *options) {
     GF_SndHandleInitAll(work);
     sSndHeapFreeSize = NNS_SndHeapGetSize(work->heap);
     GF_SndHeapGetFreeSize();
+#ifdef OPTIMIZE_SOUND_HEAP_RESIDENCY
+    SndHeapPlanner_Init();
+#endif //OPTIMIZE_SOUND_HEAP_RESIDENCY
     sub_02004898(work);
     _02111950 = 0;
     work->myChatot = chatot;
@@ -104,6 +273,11 @@ void DoSoundUpdateFrame(void) {
     void *stripped_0 = GF_SdatGetAttrPtr(18);
     void *stripped_1 = GF_SdatGetAttrPtr(32);
 
+#ifdef OPTIMIZE_SOUND_HEAP_RESIDENCY
+    // A restore that no load claimed within the frame goes through now
+    SndHeapPlanner_Flush();
+#endif //OPTIMIZE_SOUND_HEAP_RESIDENCY
+
     // Only handle fade transitions if fanfare not playing
     if (!GF_SndIsFanfarePlaying()) {
         if (work->fadeTimer > 0) {
@@ -338,8 +512,15 @@ int GF_Snd_SaveState(int *level_p) {
     int level;
 
     work = GetSoundDataPointer();
+#ifdef OPTIMIZE_SOUND_HEAP_RESIDENCY
+    SndHeapPlanner_Flush();
+#endif //OPTIMIZE_SOUND_HEAP_RESIDENCY
     level = NNS_SndHeapSaveState(work->heap);
     GF_ASSERT(level != -1);
+#ifdef OPTIMIZE_SOUND_HEAP_RESIDENCY
+    sSndHeapPlanner.level = level;
+    SndHeapPlanner_Trace(SND_HEAP_OP_SAVE_STATE, level, FALSE);
+#endif //OPTIMIZE_SOUND_HEAP_RESIDENCY
     if (level_p != NULL) {
         *level_p = level;
     }
@@ -351,7 +532,18 @@ void GF_Snd_LoadState(int level) {
     SND_WORK *work;
 
     work = GetSoundDataPointer();
+#ifdef OPTIMIZE_SOUND_HEAP_RESIDENCY
+    SndHeapPlanner_Flush();
+    if (SndHeapPlanner_DeferLoadState(level)) {
+        SndHeapPlanner_Trace(SND_HEAP_OP_LOAD_STATE, level, TRUE);
+        return;
+    }
+#endif //OPTIMIZE_SOUND_HEAP_RESIDENCY
     NNS_SndHeapLoadState(work->heap, level);
+#ifdef OPTIMIZE_SOUND_HEAP_RESIDENCY
+    SndHeapPlanner_DropAbove(level);
+    SndHeapPlanner_Trace(SND_HEAP_OP_LOAD_STATE, level, FALSE);
+#endif //OPTIMIZE_SOUND_HEAP_RESIDENCY
     GF_SndHeapGetFreeSize();
 }
 
@@ -367,7 +559,15 @@ BOOL GF_Snd_LoadGroup(int groupNo) {
     SND_WORK *work;
 
     work = GetSoundDataPointer();
+#ifdef OPTIMIZE_SOUND_HEAP_RESIDENCY
+    if (SndHeapPlanner_IsResident(SND_HEAP_OP_GROUP, groupNo, 0)) {
+        return TRUE;
+    }
+#endif //OPTIMIZE_SOUND_HEAP_RESIDENCY
     ret = NNS_SndArcLoadGroup(groupNo, work->heap);
+#ifdef OPTIMIZE_SOUND_HEAP_RESIDENCY
+    SndHeapPlanner_AddResident(SND_HEAP_OP_GROUP, groupNo, 0, ret);
+#endif //OPTIMIZE_SOUND_HEAP_RESIDENCY
     GF_SndHeapGetFreeSize();
     return ret;
 }
@@ -377,7 +577,15 @@ BOOL GF_Snd_LoadSeq(int seqNo) {
     SND_WORK *work;
 
     work = GetSoundDataPointer();
+#ifdef OPTIMIZE_SOUND_HEAP_RESIDENCY
+    if (SndHeapPlanner_IsResident(SND_HEAP_OP_SEQ, seqNo, 0)) {
+        return TRUE;
+    }
+#endif //OPTIMIZE_SOUND_HEAP_RESIDENCY
     ret = NNS_SndArcLoadSeq(seqNo, work->heap);
+#ifdef OPTIMIZE_SOUND_HEAP_RESIDENCY
+    SndHeapPlanner_AddResident(SND_HEAP_OP_SEQ, seqNo, 0, ret);
+#endif //OPTIMIZE_SOUND_HEAP_RESIDENCY
     GF_SndHeapGetFreeSize();
     return ret;
 }
@@ -387,7 +595,15 @@ BOOL GF_Snd_LoadSeqEx(int seqNo, u32 loadFlag) {
     SND_WORK *work;
 
     work = GetSoundDataPointer();
+#ifdef OPTIMIZE_SOUND_HEAP_RESIDENCY
+    if (SndHeapPlanner_IsResident(SND_HEAP_OP_SEQ_EX, seqNo, loadFlag)) {
+        return TRUE;
+    }
+#endif //OPTIMIZE_SOUND_HEAP_RESIDENCY
     ret = NNS_SndArcLoadSeqEx(seqNo, loadFlag, work->heap);
+#ifdef OPTIMIZE_SOUND_HEAP_RESIDENCY
+    SndHeapPlanner_AddResident(SND_HEAP_OP_SEQ_EX, seqNo, loadFlag, ret);
+#endif //OPTIMIZE_SOUND_HEAP_RESIDENCY
     GF_SndHeapGetFreeSize();
     return ret;
 }
@@ -397,7 +613,15 @@ BOOL GF_Snd_LoadWaveArc(int waveArcNo) {
     SND_WORK *work;
 
     work = GetSoundDataPointer();
+#ifdef OPTIMIZE_SOUND_HEAP_RESIDENCY
+    if (SndHeapPlanner_IsResident(SND_HEAP_OP_WAVE_ARC, waveArcNo, 0)) {
+        return TRUE;
+    }
+#endif //OPTIMIZE_SOUND_HEAP_RESIDENCY
     ret = NNS_SndArcLoadWaveArc(waveArcNo, work->heap);
+#ifdef OPTIMIZE_SOUND_HEAP_RESIDENCY
+    SndHeapPlanner_AddResident(SND_HEAP_OP_WAVE_ARC, waveArcNo, 0, ret);
+#endif //OPTIMIZE_SOUND_HEAP_RESIDENCY
     GF_SndHeapGetFreeSize();
     return ret;
 }
@@ -407,7 +631,15 @@ BOOL GF_Snd_LoadBank(int bankNo) {
     SND_WORK *work;
 
     work = GetSoundDataPointer();
+#ifdef OPTIMIZE_SOUND_HEAP_RESIDENCY
+    if (SndHeapPlanner_IsResident(SND_HEAP_OP_BANK, bankNo, 0)) {
+        return TRUE;
+    }
+#endif //OPTIMIZE_SOUND_HEAP_RESIDENCY
     ret = NNS_SndArcLoadBank(bankNo, work->heap);
+#ifdef OPTIMIZE_SOUND_HEAP_RESIDENCY
+    SndHeapPlanner_AddResident(SND_HEAP_OP_BANK, bankNo, 0, ret);
+#endif //OPTIMIZE_SOUND_HEAP_RESIDENCY
     GF_SndHeapGetFreeSize();
     return ret;
 }
@@ -5,6 +5,8 @@
 #include "math_util.h"
 #include "pokemon.h"
 #include "party.h"
+#include "filesystem.h"
+#include "heap.h"
 #include "constants/trainer_class.h"
 #include "constants/moves.h"
 #include "msgdata/msg.naix"
@@ -116,11 +118,112 @@ void GetTrainerMessageByIdPair(u32 trainer_idx, u32 msg_id, STRING * str, HeapID
     }
 }
 
+#ifdef OPTIMIZE_TRAINER_DATA_CACHE
+#define TRAINER_DATA_CACHE_SIZE 4
+
+typedef struct TrainerDataCacheEntry {
+    u16 trainerIdx;
+    u16 lastUsed;
+    u8 valid;
+    u8 trainerSize; // size of the trdata member in bytes; the rest of TRAINER is the caller's
+    u8 partySize; // size of the trpoke member in bytes, 0 until it is read
+    TRAINER trainer;
+    TRPOKE party[PARTY_SIZE];
+} TrainerDataCacheEntry;
+
+typedef struct TrainerDataCache {
+    TrainerDataCacheEntry entries[TRAINER_DATA_CACHE_SIZE];
+    HeapID heapId;
+    u16 clock;
+    u16 hits;
+    u16 misses;
+} TrainerDataCache;
+
+// Only exists while the field heap does; reads go straight to the NARC otherwise
+static TrainerDataCache *sTrainerDataCache;
+
+void TrainerDataCache_Init(HeapID heap_id) {
+    GF_ASSERT(sTrainerDataCache == NULL);
+    sTrainerDataCache = AllocFromHeap(heap_id, sizeof(TrainerDataCache));
+    MI_CpuClear8(sTrainerDataCache, sizeof(TrainerDataCache));
+    sTrainerDataCache->heapId = heap_id;
+}
+
+void TrainerDataCache_Free(void) {
+    if (sTrainerDataCache != NULL) {
+        FreeToHeap(sTrainerDataCache);
+        sTrainerDataCache = NULL;
+    }
+}
+
+static TrainerDataCacheEntry *TrainerDataCache_GetEntry(TrainerDataCache *cache, u32 idx) {
+    s32 i;
+    u32 size;
+    NARC *narc;
+    TrainerDataCacheEntry *entry;
+    TrainerDataCacheEntry *victim = NULL;
+
+    cache->clock++;
+
+    for (i = 0; i < TRAINER_DATA_CACHE_SIZE; i++) {
+        entry = &cache->entries[i];
+        if (!entry->valid) {
+            if (victim == NULL || victim->valid) {
+                victim = entry;
+            }
+        } else if (entry->trainerIdx == idx) {
+            entry->lastUsed = cache->clock;
+            cache->hits++;
+            return entry;
+        } else if (victim == NULL || (victim->valid && (u16)(cache->clock - entry->lastUsed) > (u16)(cache->clock - victim->lastUsed))) {
+            victim = entry;
+        }
+    }
+
+    // Miss: evict the least recently used trainer. The party is read on demand.
+    narc = NARC_New(NARC_poketool_trainer_trdata, cache->heapId);
+    size = NARC_GetMemberSize(narc, idx);
+    GF_ASSERT(size <= sizeof(victim->trainer));
+    NARC_ReadWholeMember(narc, idx, &victim->trainer);
+    NARC_Delete(narc);
+    victim->trainerSize = size;
+    victim->trainerIdx = idx;
+    victim->lastUsed = cache->clock;
+    victim->valid = TRUE;
+    victim->partySize = 0;
+    cache->misses++;
+
+    return victim;
+}
+#endif //OPTIMIZE_TRAINER_DATA_CACHE
+
 void TrainerData_ReadTrData(u32 idx, TRAINER * dest) {
+#ifdef OPTIMIZE_TRAINER_DATA_CACHE
+    if (sTrainerDataCache != NULL) {
+        TrainerDataCacheEntry *entry = TrainerDataCache_GetEntry(sTrainerDataCache, idx);
+        MI_CpuCopy8(&entry->trainer, dest, entry->trainerSize);
+        return;
+    }
+#endif //OPTIMIZE_TRAINER_DATA_CACHE
     ReadWholeNarcMemberByIdPair(dest, NARC_poketool_trainer_trdata, (s32)idx);
 }
 
 void TrainerData_ReadTrPoke(u32 idx, TRPOKE * dest) {
+#ifdef OPTIMIZE_TRAINER_DATA_CACHE
+    if (sTrainerDataCache != NULL) {
+        TrainerDataCacheEntry *entry = TrainerDataCache_GetEntry(sTrainerDataCache, idx);
+        if (entry->partySize == 0) {
+            NARC *narc = NARC_New(NARC_poketool_trainer_trpoke, sTrainerDataCache->heapId);
+            u32 size = NARC_GetMemberSize(narc, idx);
+            GF_ASSERT(size != 0 && size <= sizeof(entry->party));
+            NARC_ReadWholeMember(narc, idx, entry->party);
+            NARC_Delete(narc);
+            entry->partySize = size;
+        }
+        MI_CpuCopy8(entry->party, dest, entry->partySize);
+        return;
+    }
+#endif //OPTIMIZE_TRAINER_DATA_CACHE
     ReadWholeNarcMemberByIdPair(dest, NARC_poketool_trainer_trpoke, (s32)idx);
 }
 
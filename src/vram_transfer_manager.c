@@ -3,6 +3,11 @@
 
 static GF_VramTransferManager *sVramTransferManager;
 
+#ifdef OPTIMIZE_VRAM_TRANSFER_QUEUE
+static void VramTransferQueue_Coalesce(GF_VramTransferManager *manager);
+static void VramTransferQueue_EndFrame(GF_VramTransferManager *manager);
+#endif //OPTIMIZE_VRAM_TRANSFER_QUEUE
+
 void GF_CreateVramTransferManager(u32 taskMax, HeapID heap_id) {
     GF_ASSERT(sVramTransferManager == NULL);
 
@@ -13,15 +18,75 @@ void GF_CreateVramTransferManager(u32 taskMax, HeapID heap_id) {
     sVramTransferManager->nMax = taskMax;
     sVramTransferManager->nCur = 0;
     NNS_GfdInitVramTransferManager(sVramTransferManager->tasks, sVramTransferManager->nMax);
+#ifdef OPTIMIZE_VRAM_TRANSFER_QUEUE
+    sVramTransferManager->pending = AllocFromHeap(heap_id, taskMax * sizeof(NNSGfdVramTransferTask));
+    MI_CpuClear8(&sVramTransferManager->curFrame, sizeof(GF_VramTransferStats));
+    MI_CpuClear8(&sVramTransferManager->lastFrame, sizeof(GF_VramTransferStats));
+#endif //OPTIMIZE_VRAM_TRANSFER_QUEUE
 }
 
 void GF_DestroyVramTransferManager(void) {
     GF_ASSERT(sVramTransferManager != NULL);
+#ifdef OPTIMIZE_VRAM_TRANSFER_QUEUE
+    FreeToHeap(sVramTransferManager->pending);
+#endif //OPTIMIZE_VRAM_TRANSFER_QUEUE
     FreeToHeap(sVramTransferManager->tasks);
     FreeToHeap(sVramTransferManager);
     sVramTransferManager = NULL;
 }
 
+#ifdef OPTIMIZE_VRAM_TRANSFER_QUEUE
+BOOL GF_CreateNewVramTransferTask(NNS_GFD_DST_TYPE type, u32 dstAddr, void *pSrc, u32 szByte) {
+    NNSGfdVramTransferTask *task;
+
+    GF_ASSERT(sVramTransferManager != NULL);
+    sVramTransferManager->curFrame.numRequested++;
+    sVramTransferManager->curFrame.bytesRequested += szByte;
+
+    if (sVramTransferManager->nCur >= sVramTransferManager->nMax) {
+        // Out of slots. Fold what has been queued so far before giving up.
+        VramTransferQueue_Coalesce(sVramTransferManager);
+        if (sVramTransferManager->nCur >= sVramTransferManager->nMax) {
+            GF_ASSERT(FALSE);
+            return FALSE;
+        }
+    }
+
+    task = &sVramTransferManager->pending[sVramTransferManager->nCur++];
+    task->type = type;
+    task->dstAddr = dstAddr;
+    task->pSrc = pSrc;
+    task->szByte = szByte;
+    return TRUE;
+}
+
+void GF_RunVramTransferTasks(void) {
+    if (sVramTransferManager == NULL) return;
+
+    GF_DoVramTransfer();
+}
+
+// Stands in for NNS_GfdDoVramTransfer wherever the game called it directly, since
+// queued tasks only reach the NitroSystem transfer manager here.
+void GF_DoVramTransfer(void) {
+    u32 i;
+    NNSGfdVramTransferTask *task;
+
+    if (sVramTransferManager != NULL) {
+        VramTransferQueue_Coalesce(sVramTransferManager);
+        for (i = 0; i < sVramTransferManager->nCur; i++) {
+            task = &sVramTransferManager->pending[i];
+            NNS_GfdRegisterNewVramTransferTask(task->type, task->dstAddr, task->pSrc, task->szByte);
+            sVramTransferManager->curFrame.bytesIssued += task->szByte;
+        }
+        sVramTransferManager->curFrame.numIssued = sVramTransferManager->nCur;
+        VramTransferQueue_EndFrame(sVramTransferManager);
+        sVramTransferManager->nCur = 0;
+    }
+
+    NNS_GfdDoVramTransfer();
+}
+#else
 BOOL GF_CreateNewVramTransferTask(NNS_GFD_DST_TYPE type, u32 dstAddr, void *pSrc, u32 szByte) {
     GF_ASSERT(sVramTransferManager != NULL);
     sVramTransferManager->nCur++;
@@ -40,8 +105,123 @@ void GF_RunVramTransferTasks(void) {
     NNS_GfdDoVramTransfer();
     sVramTransferManager->nCur = 0;
 }
+#endif //OPTIMIZE_VRAM_TRANSFER_QUEUE
 
 u32 GF_GetNumPendingVramTransferTasks(void) {
     GF_ASSERT(sVramTransferManager != NULL);
     return sVramTransferManager->nCur;
 }
+
+#ifdef OPTIMIZE_VRAM_TRANSFER_QUEUE
+void GF_GetVramTransferStats(GF_VramTransferStats *dest) {
+    GF_ASSERT(sVramTransferManager != NULL);
+    *dest = sVramTransferManager->lastFrame;
+}
+
+// Rewrites the pending queue so that it produces the same VRAM contents with as few
+// transfers as possible. The queue is in submission order on entry, and later uploads
+// win wherever two of them touch the same bytes.
+static void VramTransferQueue_Coalesce(GF_VramTransferManager *manager) {
+    NNSGfdVramTransferTask *tasks = manager->pending;
+    NNSGfdVramTransferTask tmp;
+    u32 n = manager->nCur;
+    u32 i, j, k;
+    u32 iEnd, jEnd;
+    BOOL keepOrder = FALSE;
+
+    // Resolve overlaps in favour of the later upload: drop the earlier task if it is
+    // fully covered, otherwise trim the covered head or tail off it. What remains is
+    // either disjoint or a later upload strictly inside an earlier one, which sorting
+    // by start address keeps in the right order.
+    for (i = 0; i < n; i++) {
+        for (j = i + 1; j < n && tasks[i].szByte != 0; j++) {
+            if (tasks[j].type != tasks[i].type || tasks[j].szByte == 0) {
+                continue;
+            }
+            iEnd = tasks[i].dstAddr + tasks[i].szByte;
+            jEnd = tasks[j].dstAddr + tasks[j].szByte;
+            if (jEnd <= tasks[i].dstAddr || iEnd <= tasks[j].dstAddr) {
+                continue;
+            }
+            if (tasks[j].dstAddr <= tasks[i].dstAddr && jEnd >= iEnd) {
+                tasks[i].szByte = 0;
+                manager->curFrame.numDropped++;
+            } else if (tasks[j].dstAddr <= tasks[i].dstAddr) {
+                if ((jEnd - tasks[i].dstAddr) & 3) {
+                    // The DMA engine cannot start mid-word, so leave the order alone
+                    keepOrder = TRUE;
+                    continue;
+                }
+                tasks[i].pSrc = (u8 *)tasks[i].pSrc + (jEnd - tasks[i].dstAddr);
+                tasks[i].szByte = iEnd - jEnd;
+                tasks[i].dstAddr = jEnd;
+                j = i; // the shrunk task may now overlap a task it skipped
+            } else if (jEnd >= iEnd) {
+                if ((tasks[j].dstAddr - tasks[i].dstAddr) & 3) {
+                    keepOrder = TRUE;
+                    continue;
+                }
+                tasks[i].szByte = tasks[j].dstAddr - tasks[i].dstAddr;
+                j = i;
+            }
+        }
+    }
+
+    for (i = 0, k = 0; i < n; i++) {
+        if (tasks[i].szByte != 0) {
+            tasks[k++] = tasks[i];
+        }
+    }
+    n = k;
+
+    if (!keepOrder) {
+        // Stable insertion sort by destination; the queue holds a few dozen tasks at most
+        for (i = 1; i < n; i++) {
+            tmp = tasks[i];
+            for (j = i; j > 0; j--) {
+                if (tasks[j - 1].type < tmp.type || (tasks[j - 1].type == tmp.type && tasks[j - 1].dstAddr <= tmp.dstAddr)) {
+                    break;
+                }
+                tasks[j] = tasks[j - 1];
+            }
+            tasks[j] = tmp;
+        }
+
+        // Merge neighbours that are contiguous in both VRAM and main memory
+        for (i = 1, k = 0; i < n; i++) {
+            if (tasks[i].type == tasks[k].type
+                && tasks[k].dstAddr + tasks[k].szByte == tasks[i].dstAddr
+                && (u8 *)tasks[k].pSrc + tasks[k].szByte == tasks[i].pSrc) {
+                tasks[k].szByte += tasks[i].szByte;
+                manager->curFrame.numMerged++;
+            } else {
+                tasks[++k] = tasks[i];
+            }
+        }
+        if (n != 0) {
+            n = k + 1;
+        }
+    }
+
+    manager->nCur = n;
+}
+
+static void VramTransferQueue_EndFrame(GF_VramTransferManager *manager) {
+    GF_VramTransferStats *stats = &manager->curFrame;
+
+    if (stats->bytesIssued > stats->peakBytesIssued) {
+        stats->peakBytesIssued = stats->bytesIssued;
+    }
+    if (stats->numIssued > stats->peakNumIssued) {
+        stats->peakNumIssued = stats->numIssued;
+    }
+    manager->lastFrame = *stats;
+
+    stats->numRequested = 0;
+    stats->numIssued = 0;
+    stats->numMerged = 0;
+    stats->numDropped = 0;
+    stats->bytesRequested = 0;
+    stats->bytesIssued = 0;
+}
+#endif //OPTIMIZE_VRAM_TRANSFER_QUEUE
@@ -902,12 +902,9 @@ def parse_source(f, opt, framepointer, input_enc, output_enc, print_source=None)
             print_source.flush()
             if print_source != sys.stdout.buffer:
                 print_source.close()
-    out_file = open("output.txt", 'w')
-    out_file.write(str(asm_functions))
-    out_file.close()
     return asm_functions
 
-def fixup_objfile(objfile_name, functions, asm_prelude, assembler, output_enc):
+def fixup_objfile(objfile_name, functions, asm_prelude, assembler, output_enc, scratch_dir='.'):
     SECTIONS = ['.data']
     SECTIONS.extend(['.text' for i in range(0,len(functions))])
     SECTIONS.extend(['.rodata', '.bss', '.sdata', '.sdata2', '.sbss'])
@@ -981,11 +978,13 @@ def fixup_objfile(objfile_name, functions, asm_prelude, assembler, output_enc):
             asm.extend(conts)
         asm.append('glabel {}'.format(late_rodata_source_name_end))
 
-    o_file = open("asm_processor_temp.o", 'w').close() # Create temp file. tempfile module isn't working for me.
-    o_name = "asm_processor_temp.o"
+    # Keep the temporaries next to the object being built rather than in the
+    # working directory, so that parallel jobs don't overwrite each other's.
+    o_name = os.path.join(scratch_dir, "asm_processor_temp.o")
+    open(o_name, 'w').close()
 
-    s_file = open("asm_processor_temp.s", 'wb') # Ditto.
-    s_name = "asm_processor_temp.s"
+    s_name = os.path.join(scratch_dir, "asm_processor_temp.s")
+    s_file = open(s_name, 'wb')
     try:
         s_file.write(asm_prelude + b'\n')
         for line in asm:
@@ -1223,6 +1222,9 @@ def run_wrapped(argv, outfile):
     parser.add_argument('--post-process', dest='objfile', help="path to .o file to post-process")
     parser.add_argument('--assembler', dest='assembler', help="assembler command (e.g. \"mips-linux-gnu-as -march=vr4300 -mabi=32\")")
     parser.add_argument('--asm-prelude', dest='asm_prelude', help="path to a file containing a prelude to the assembly file (with .set and .macro directives, e.g.)")
+    parser.add_argument('--compile', dest='compiler', help="compiler command; pre-process, compile and post-process in one go (requires --assembler and --output)")
+    parser.add_argument('--output', dest='output', help="path to the .o file to produce with --compile")
+    parser.add_argument('--scratch-dir', dest='scratch_dir', default='.', help="directory for temporary files (default: current directory)")
     parser.add_argument('--input-enc', default='latin1', help="Input encoding (default: latin1)")
     parser.add_argument('--output-enc', default='latin1', help="Output encoding (default: latin1)")
     parser.add_argument('-framepointer', dest='framepointer', action='store_true')
@@ -1238,7 +1240,24 @@ def run_wrapped(argv, outfile):
             raise Failure("-g3 is only supported together with -O2")
         opt = 'g3'
 
-    if args.objfile is None:
+    if args.compiler is not None:
+        if args.assembler is None or args.output is None:
+            raise Failure("--compile needs --assembler and --output")
+        # Parse the source once and use the result for both halves
+        padded_src = os.path.join(args.scratch_dir, "padded.c")
+        with open(args.filename, encoding=args.input_enc) as f:
+            functions = parse_source(f, opt=opt, framepointer=args.framepointer, input_enc=args.input_enc, output_enc=args.output_enc, print_source=open(padded_src, 'wb'))
+        ret = os.system(args.compiler + " -c " + padded_src + " -o " + args.output)
+        if ret != 0:
+            raise Failure("failed to compile")
+        if not functions:
+            return
+        asm_prelude = b''
+        if args.asm_prelude:
+            with open(args.asm_prelude, 'rb') as f:
+                asm_prelude = f.read()
+        fixup_objfile(args.output, functions, asm_prelude, args.assembler, args.output_enc, args.scratch_dir)
+    elif args.objfile is None:
         with open(args.filename, encoding=args.input_enc) as f:
             parse_source(f, opt=opt, framepointer=args.framepointer, input_enc=args.input_enc, output_enc=args.output_enc, print_source=outfile)
     else:
@@ -1252,7 +1271,7 @@ def run_wrapped(argv, outfile):
         if args.asm_prelude:
             with open(args.asm_prelude, 'rb') as f:
                 asm_prelude = f.read()
-        fixup_objfile(args.objfile, functions, asm_prelude, args.assembler, args.output_enc)
+        fixup_objfile(args.objfile, functions, asm_prelude, args.assembler, args.output_enc, args.scratch_dir)
 
 def run(argv, outfile=sys.stdout.buffer):
     try:
@@ -1,5 +1,7 @@
 #!/bin/bash
 
+set -e
+
 CC="$1"
 AS="$2"
 OBJ="$3"
@@ -7,24 +9,39 @@ SRC="$4"
 
 BUILD_FILENAME=${OBJ%.o}
 
-PADDED_SRC="$(mktemp --suffix=.c padded-XXXXXX)"
-PADDED_OBJ="$(mktemp --suffix=.o padded-XXXXXX)"
-PADDED_D="$(mktemp --suffix=.d padded-XXXXXX)"
-
-# Create a .c file replacing the nonmatching function with volatile int writes, 
-# and compile.
-./tools/asm_processor/asm_processor.py "$SRC" --assembler "$AS" > "$PADDED_SRC"
-$CC -c "$PADDED_SRC" -o "$PADDED_OBJ"
+# Every job gets its own scratch directory next to its object, so that any
+# number of GLOBAL_ASM objects can be built at once under make -j. It is kept
+# relative to the working directory so Wine sees the same path. The name is
+# fixed rather than random: the padded source's path ends up in the cpp
+# linemarkers and on the command lines mwcache keys on, so it has to be the
+# same from one build to the next for the cache to hit. Make never runs two
+# jobs for one object, so the directory is never shared.
+SCRATCH="${BUILD_FILENAME}.asmproc"
+rm -rf "$SCRATCH"
+mkdir -p "$SCRATCH"
+trap 'rm -rf "$SCRATCH"' EXIT
+PADDED_OBJ="$SCRATCH/padded.o"
 
-# Inject the matching assembly into the padded obj file.
-./tools/asm_processor/asm_processor.py "$SRC" --post-process "$PADDED_OBJ" --assembler "$AS"
+# Replace the nonmatching functions with volatile int writes, compile that,
+# and inject the matching assembly into the object, parsing the source once.
+./tools/asm_processor/asm_processor.py "$SRC" --compile "$CC" --assembler "$AS" --output "$PADDED_OBJ" --scratch-dir "$SCRATCH"
 
 arm-none-eabi-objcopy --remove-section .comment "$PADDED_OBJ" "$OBJ"
 if [[ $CC == *"gccdep"* ]]; then
-    cp "$PADDED_D" "${BUILD_FILENAME}.d"
+    # The compiler names the dependency file after the padded object. Under
+    # Wine it writes backslashes, CRLF and possibly an absolute Z: path, so
+    # normalize it the way fixdep does before pointing the target and first
+    # prerequisite back at the real object and source.
+    SCRATCH_RE="$(basename "$SCRATCH" | sed 's/\./\\./g')"
+    sed -e 's/\r//g; s/\\/\//g; s/\/$/\\/g' \
+        -e "s#[^ ]*$SCRATCH_RE/padded\.o#$OBJ#g" \
+        -e "s#[^ ]*$SCRATCH_RE/padded\.c#$SRC#g" \
+        "$SCRATCH/padded.d" > "${BUILD_FILENAME}.d"
+    # A dependency on the scratch copy would be deleted with it below, and
+    # make would then stop with "No rule to make target"
+    if grep -q "$SCRATCH_RE" "${BUILD_FILENAME}.d"; then
+        echo "$0: ${BUILD_FILENAME}.d still refers to $SCRATCH" >&2
+        rm -f "$OBJ" "${BUILD_FILENAME}.d"
+        exit 1
+    fi
 fi
-
-rm padded-*
-rm output.txt
-rm asm_processor_temp.s
-rm asm_processor_temp.o
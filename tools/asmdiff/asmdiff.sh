@@ -81,6 +81,8 @@ usage () {
     echo "  -f FILE       Dump the indicated file, and use hexdump instead"
     echo "  -F FSDIR      Filesystem path on the home system"
     echo "  -t            Force THUMB instructions (default: ARM)"
+    echo "  -A            List every differing function in the ARM9 static module, autoloads and overlays"
+    echo "                as well as the files under FSDIR that differ from the ROM filesystem"
     echo "  -h            Show this message and exit"
 }
 
@@ -116,6 +118,10 @@ while [[ $# -gt 0 ]]; do
     thumb=-Mforce-thumb
     shift
     ;;
+  -A)
+    mode=all
+    shift
+    ;;
   -f)
     mode="file"
     filepath="$2"
@@ -151,6 +157,15 @@ fsdir=${fsdir:-$DEFAULT_FSDIR}
 
 [[ -f "$baserom" ]] || { echo $0: $baserom: no such file or directory >&2; exit 1; }
 
+if [ "$mode" == "all" ]; then
+  if [ -f "${builddir}/component.files" ]; then
+    compname=$(${CUT} -d '' -f1 "${builddir}/component.files")
+  else
+    compname=$( cd "${builddir}"; ls *.lcf | sed 's/lcf/sbin/' )
+  fi
+  exec "${MYDIR}"/ntrromdiff ${fsdir:+-F "$fsdir"} "$baserom" "${builddir}/${compname%.sbin}"
+fi
+
 basestem=
 [[ $proc == armv4t ]] && basestem=${basestem}.sub
 [[ $mode == overlay ]] && basestem=${basestem}.o${overlay}
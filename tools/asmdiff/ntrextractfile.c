@@ -81,6 +81,8 @@ done:
     return file_id;
 }
 
+// ntrromdiff.c includes this file for the helpers above.
+#ifndef NTR_HELPERS_ONLY
 int main(int argc, char ** argv) {
     if (argc < 3) {
         fprintf(stderr, "missing required argument: %s\n", (argc == 1) ? "BASEROM" : "FILENAME");
@@ -151,3 +153,4 @@ int main(int argc, char ** argv) {
     fclose(baserom);
     return 0;
 }
+#endif //NTR_HELPERS_ONLY
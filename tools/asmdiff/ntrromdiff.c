@@ -0,0 +1,570 @@
+/*
+ * NTRROMDIFF: Reports every function that differs between a retail ROM and
+ * a build, across the ARM9 static module, its autoloads and all overlays.
+ *
+ * Usage:
+ *     ntrromdiff [-j JOBS] [-F FSDIR] BASEROM STEM
+ *
+ * STEM is the prefix of the linker output, e.g. build/heartgold.us/main:
+ * STEM.sbin, STEM_defs.sbin, STEM.nef and the overlay .sbin files next to
+ * them must exist. Function symbols are taken from STEM.nef.
+ */
+
+#define _GNU_SOURCE
+#define NTR_HELPERS_ONLY
+#include "ntrextractfile.c"
+#include "ntruncompbw.c"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <ftw.h>
+#include <pthread.h>
+#include <stdarg.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+
+#define MODULE_PARAMS_MAGIC 0xDEC00621
+
+struct Mapping {
+    const unsigned char *data;
+    size_t size;
+};
+
+struct Section {
+    const char *name;
+    uint32_t addr;
+};
+
+struct Symbol {
+    const char *name;
+    uint32_t addr;
+    uint32_t size;
+    unsigned section;
+};
+
+struct Module {
+    char name[64];
+    uint32_t vma;
+    int section;
+    // Retail bytes, decompressed when compressed is set
+    const unsigned char *base;
+    size_t base_size;
+    unsigned char *base_owned;
+    uint32_t compressed;
+    // Build bytes
+    char build_path[512];
+    const unsigned char *build;
+    size_t build_size;
+    // Filled in by compare_module
+    char *report;
+    size_t report_size;
+    int num_funcs;
+    int num_diff;
+    int failed;
+};
+
+static struct Section *sections;
+static unsigned num_sections;
+static struct Symbol *symbols;
+static unsigned num_symbols;
+
+static struct Module *modules;
+static int num_modules;
+static int next_module;
+
+static void fatal(const char *fmt, ...) {
+    va_list va_args;
+    va_start(va_args, fmt);
+    fputs("ntrromdiff: ", stderr);
+    vfprintf(stderr, fmt, va_args);
+    fputc('\n', stderr);
+    va_end(va_args);
+    exit(2);
+}
+
+static int map_file(const char *path, struct Mapping *mapping) {
+    int fd = open(path, O_RDONLY);
+    struct stat st;
+    if (fd < 0) {
+        return -1;
+    }
+    if (fstat(fd, &st) != 0) {
+        close(fd);
+        return -1;
+    }
+    mapping->size = st.st_size;
+    mapping->data = NULL;
+    if (mapping->size != 0) {
+        void *p = mmap(NULL, mapping->size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (p == MAP_FAILED) {
+            close(fd);
+            return -1;
+        }
+        mapping->data = p;
+    }
+    close(fd);
+    return 0;
+}
+
+static uint32_t word_at(const struct Mapping *mapping, size_t offset) {
+    if (offset > mapping->size || mapping->size - offset < 4) {
+        fatal("read past the end of a %zu-byte image at 0x%zX", mapping->size, offset);
+    }
+    return READ32(mapping->data + offset);
+}
+
+static uint16_t half_at(const unsigned char *p) {
+    return p[0] | (p[1] << 8);
+}
+
+// Function symbols from the linker's ELF output. Its sections are the
+// modules: the static module under STEM's basename, each overlay under its
+// .sbin stem, and each autoload at its load address.
+static void load_symbols(const char *path) {
+    struct Mapping nef;
+    if (map_file(path, &nef) != 0) {
+        fatal("%s: %s", path, strerror(errno));
+    }
+    if (nef.size < 52 || memcmp(nef.data, "\177ELF\001\001", 6) != 0) {
+        fatal("%s: not a 32-bit little-endian ELF file", path);
+    }
+    uint32_t shoff = word_at(&nef, 32);
+    unsigned shentsize = half_at(nef.data + 46);
+    num_sections = half_at(nef.data + 48);
+    unsigned shstrndx = half_at(nef.data + 50);
+    if (shentsize < 40 || shoff > nef.size || (nef.size - shoff) / shentsize < num_sections || shstrndx >= num_sections) {
+        fatal("%s: bad section header table", path);
+    }
+
+#define SHDR(i, field) word_at(&nef, shoff + (i) * shentsize + (field))
+    uint32_t shstrtab = SHDR(shstrndx, 16);
+    sections = calloc(num_sections, sizeof(struct Section));
+    for (unsigned i = 0; i < num_sections; i++) {
+        sections[i].name = (const char *)nef.data + shstrtab + SHDR(i, 0);
+        sections[i].addr = SHDR(i, 12);
+    }
+    for (unsigned i = 0; i < num_sections; i++) {
+        if (SHDR(i, 4) != 2) { // SHT_SYMTAB
+            continue;
+        }
+        uint32_t symoff = SHDR(i, 16);
+        uint32_t count = SHDR(i, 20) / 16;
+        uint32_t link = SHDR(i, 24);
+        if (link >= num_sections || symoff > nef.size || (nef.size - symoff) / 16 < count) {
+            fatal("%s: bad symbol table", path);
+        }
+        const char *strtab = (const char *)nef.data + SHDR(link, 16);
+        symbols = calloc(count, sizeof(struct Symbol));
+        for (uint32_t j = 0; j < count; j++) {
+            const unsigned char *sym = nef.data + symoff + j * 16;
+            unsigned shndx = half_at(sym + 14);
+            if ((sym[12] & 0xF) != 2 || shndx == 0 || shndx >= num_sections || READ32(sym + 8) == 0) { // STT_FUNC
+                continue;
+            }
+            symbols[num_symbols].name = strtab + READ32(sym);
+            symbols[num_symbols].addr = READ32(sym + 4) & ~1u;
+            symbols[num_symbols].size = READ32(sym + 8);
+            symbols[num_symbols].section = shndx;
+            num_symbols++;
+        }
+    }
+#undef SHDR
+}
+
+static int find_section(const char *name) {
+    for (unsigned i = 0; i < num_sections; i++) {
+        if (strcmp(sections[i].name, name) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+// Offset of the module params (_start_ModuleParams) in a static module.
+static size_t find_module_params(const struct Mapping *image) {
+    for (size_t i = 28; i + 4 <= image->size; i += 4) {
+        if (READ32(image->data + i) == MODULE_PARAMS_MAGIC) {
+            return i - 28;
+        }
+    }
+    fatal("unable to find _start_ModuleParams");
+    return 0;
+}
+
+static struct Module *add_module(const char *name, uint32_t vma, int section) {
+    modules = realloc(modules, (num_modules + 1) * sizeof(struct Module));
+    struct Module *module = &modules[num_modules++];
+    memset(module, 0, sizeof(*module));
+    snprintf(module->name, sizeof(module->name), "%s", name);
+    module->vma = vma;
+    module->section = section;
+    return module;
+}
+
+// Splits a decompressed static module into the static code and its autoloads.
+// Returns the number of autoloads; fills in their load addresses and extents.
+static int split_static(const struct Mapping *image, uint32_t vma, size_t *static_size, uint32_t *loads, size_t *offsets, size_t *sizes, int max) {
+    size_t params = find_module_params(image);
+    uint32_t list = word_at(image, params) - vma;
+    uint32_t list_end = word_at(image, params + 4) - vma;
+    size_t data = word_at(image, params + 8) - vma;
+    int n = 0;
+
+    *static_size = data;
+    for (; list < list_end && n < max; list += 12, n++) {
+        loads[n] = word_at(image, list);
+        offsets[n] = data;
+        sizes[n] = word_at(image, list + 4);
+        data += sizes[n];
+        if (data > image->size) {
+            fatal("autoload %d runs past the end of the static module", n);
+        }
+    }
+    return n;
+}
+
+static void compare_module(struct Module *module) {
+    FILE *out = open_memstream(&module->report, &module->report_size);
+
+    if (module->compressed != 0) {
+        unsigned char *buf = malloc(module->base_size);
+        memcpy(buf, module->base, module->base_size);
+        if (module->compressed != module->base_size) {
+            fprintf(out, "  compressed size 0x%X does not match file size 0x%zX\n", module->compressed, module->base_size);
+            module->failed = 1;
+            free(buf);
+            goto done;
+        }
+        uint32_t size = MIi_UncompressBackwards(&buf, module->base_size);
+        if (size == -1u) {
+            fprintf(out, "  unable to decompress\n");
+            module->failed = 1;
+            goto done;
+        }
+        module->base_owned = buf;
+        module->base = buf;
+        module->base_size = size;
+    }
+    if (module->build == NULL) {
+        struct Mapping mapping;
+        if (map_file(module->build_path, &mapping) != 0) {
+            fprintf(out, "  %s: %s\n", module->build_path, strerror(errno));
+            module->failed = 1;
+            goto done;
+        }
+        module->build = mapping.data;
+        module->build_size = mapping.size;
+    }
+
+    size_t common = module->base_size < module->build_size ? module->base_size : module->build_size;
+    size_t total = module->base_size > module->build_size ? module->base_size : module->build_size;
+    unsigned char *covered = calloc(total + 1, 1);
+
+    if (module->base_size != module->build_size) {
+        fprintf(out, "  size differs: baserom 0x%zX, build 0x%zX\n", module->base_size, module->build_size);
+    }
+    for (unsigned i = 0; i < num_symbols; i++) {
+        const struct Symbol *sym = &symbols[i];
+        if ((int)sym->section != module->section || sym->addr < module->vma || sym->addr - module->vma >= total) {
+            continue;
+        }
+        size_t start = sym->addr - module->vma;
+        size_t end = start + sym->size > total ? total : start + sym->size;
+        module->num_funcs++;
+        memset(covered + start, 1, end - start);
+        if (end > common) {
+            module->num_diff++;
+            fprintf(out, "  %08X %-40s 0x%X bytes, past the end of the shorter image\n", sym->addr, sym->name, sym->size);
+            continue;
+        }
+        for (size_t j = start; j < end; j++) {
+            if (module->base[j] != module->build[j]) {
+                module->num_diff++;
+                fprintf(out, "  %08X %-40s 0x%X bytes, first difference at +0x%zX\n", sym->addr, sym->name, sym->size, j - start);
+                break;
+            }
+        }
+    }
+
+    size_t loose = 0, first_loose = 0;
+    for (size_t j = 0; j < common; j++) {
+        if (!covered[j] && module->base[j] != module->build[j]) {
+            if (loose++ == 0) {
+                first_loose = j;
+            }
+        }
+    }
+    if (loose != 0) {
+        fprintf(out, "  %zu bytes differ outside functions, first at %08zX\n", loose, module->vma + first_loose);
+    }
+    free(covered);
+
+done:
+    fclose(out);
+}
+
+static void *worker(void *arg) {
+    int i;
+    (void)arg;
+    while ((i = __atomic_fetch_add(&next_module, 1, __ATOMIC_RELAXED)) < num_modules) {
+        compare_module(&modules[i]);
+    }
+    return NULL;
+}
+
+// Nitro filesystem comparison against the files under FSDIR
+static const unsigned char *fs_rom;
+static size_t fs_rom_size;
+static const char *fs_root;
+static int fs_compared, fs_differ;
+
+static int compare_fs_file(const char *path, const struct stat *st, int type, struct FTW *ftw) {
+    (void)ftw;
+    if (type != FTW_F) {
+        return 0;
+    }
+    const char *rel = path + strlen(fs_root);
+    while (*rel == '/') {
+        rel++;
+    }
+    uint32_t fnt = READ32(fs_rom + 64);
+    uint32_t fat = READ32(fs_rom + 72);
+    uint32_t fat_size = READ32(fs_rom + 76);
+    if (fnt >= fs_rom_size || fat > fs_rom_size || fs_rom_size - fat < fat_size) {
+        return 1;
+    }
+    unsigned file_id = find_file((struct NtrDirHeader *)(fs_rom + fnt), rel);
+    if (file_id == FIND_FAIL || 8 * file_id >= fat_size) {
+        return 0;
+    }
+    uint32_t start = READ32(fs_rom + fat + 8 * file_id);
+    uint32_t end = READ32(fs_rom + fat + 8 * file_id + 4);
+    if (end < start || end > fs_rom_size) {
+        return 0;
+    }
+    struct Mapping file;
+    if (map_file(path, &file) != 0) {
+        return 0;
+    }
+    fs_compared++;
+    if (file.size != end - start || (file.size != 0 && memcmp(file.data, fs_rom + start, file.size) != 0)) {
+        fs_differ++;
+        printf("  %s\n", rel);
+    }
+    if (file.data != NULL) {
+        munmap((void *)file.data, file.size);
+    }
+    (void)st;
+    return 0;
+}
+
+static void usage(const char *progname) {
+    fprintf(stderr, "usage: %s [-j JOBS] [-F FSDIR] BASEROM STEM\n", progname);
+    fprintf(stderr, "\n");
+    fprintf(stderr, "BASEROM   The retail ROM\n");
+    fprintf(stderr, "STEM      Prefix of the linker output, e.g. build/heartgold.us/main\n");
+    fprintf(stderr, "-j JOBS   Number of threads (default: one per CPU)\n");
+    fprintf(stderr, "-F FSDIR  Also compare the files under FSDIR with the ROM filesystem\n");
+}
+
+int main(int argc, char **argv) {
+    int jobs = 0;
+    const char *fsdir = NULL;
+    const char *positional[2];
+    int num_positional = 0;
+    char path[512];
+    struct timespec t0, t1;
+
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-j") == 0 && i + 1 < argc) {
+            jobs = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-F") == 0 && i + 1 < argc) {
+            fsdir = argv[++i];
+        } else if (strcmp(argv[i], "-h") == 0) {
+            usage(argv[0]);
+            return 0;
+        } else if (argv[i][0] != '-' && num_positional < 2) {
+            positional[num_positional++] = argv[i];
+        } else {
+            usage(argv[0]);
+            return 2;
+        }
+    }
+    if (num_positional != 2) {
+        usage(argv[0]);
+        return 2;
+    }
+    const char *stem = positional[1];
+    const char *stem_base = strrchr(stem, '/') ? strrchr(stem, '/') + 1 : stem;
+    int dir_len = (int)(stem_base - stem);
+
+    struct Mapping rom, static_build, defs;
+    if (map_file(positional[0], &rom) != 0) {
+        fatal("%s: %s", positional[0], strerror(errno));
+    }
+    if (rom.size < 0x200) {
+        fatal("%s: too small to be a ROM", positional[0]);
+    }
+    snprintf(path, sizeof(path), "%s.sbin", stem);
+    if (map_file(path, &static_build) != 0) {
+        fatal("%s: %s", path, strerror(errno));
+    }
+    snprintf(path, sizeof(path), "%s_defs.sbin", stem);
+    if (map_file(path, &defs) != 0) {
+        fatal("%s: %s", path, strerror(errno));
+    }
+    snprintf(path, sizeof(path), "%s.nef", stem);
+    load_symbols(path);
+
+    // ARM9 static module, decompressed in place of the retail copy
+    uint32_t arm9_off = word_at(&rom, 0x20);
+    uint32_t arm9_vma = word_at(&rom, 0x28);
+    uint32_t arm9_size = word_at(&rom, 0x2C);
+    if (arm9_off > rom.size || rom.size - arm9_off < arm9_size) {
+        fatal("ARM9 module out of range");
+    }
+    unsigned char *arm9 = malloc(arm9_size);
+    memcpy(arm9, rom.data + arm9_off, arm9_size);
+    struct Mapping base_static = { arm9, arm9_size };
+    size_t params = find_module_params(&base_static);
+    uint32_t comp_end = word_at(&base_static, params + 20);
+    if (comp_end != 0) {
+        if (comp_end - arm9_vma > arm9_size) {
+            fatal("ARM9 compressed end %08X is past the end of the module", comp_end);
+        }
+        uint32_t size = MIi_UncompressBackwards(&arm9, comp_end - arm9_vma);
+        if (size == -1u) {
+            fatal("unable to decompress the ARM9 static module");
+        }
+        memset(arm9 + params + 20, 0, 4);
+        base_static.data = arm9;
+        base_static.size = size;
+    }
+
+    uint32_t base_loads[16], build_loads[16];
+    size_t base_offsets[16], build_offsets[16], base_sizes[16], build_sizes[16];
+    size_t base_static_size, build_static_size;
+    int num_autoloads = split_static(&base_static, arm9_vma, &base_static_size, base_loads, base_offsets, base_sizes, 16);
+    int num_build_autoloads = split_static(&static_build, arm9_vma, &build_static_size, build_loads, build_offsets, build_sizes, 16);
+    if (num_autoloads != num_build_autoloads) {
+        fatal("baserom has %d autoloads, build has %d", num_autoloads, num_build_autoloads);
+    }
+
+    struct Module *module = add_module(stem_base, arm9_vma, find_section(stem_base));
+    module->base = base_static.data;
+    module->base_size = base_static_size;
+    module->build = static_build.data;
+    module->build_size = build_static_size;
+
+    // Overlay sections are matched by name, so collect those first to tell
+    // autoload sections apart from them.
+    const char *names = (const char *)defs.data + 16;
+    const char *names_end = (const char *)defs.data + defs.size;
+    int num_overlays = word_at(&rom, 0x54) / 32;
+
+    for (int i = 0; i < num_autoloads; i++) {
+        int section = -1;
+        for (unsigned j = 0; j < num_sections; j++) {
+            if (sections[j].addr == base_loads[i] && strncmp(sections[j].name, "OVY_", 4) != 0 && (int)j != modules[0].section && sections[j].name[0] != '.') {
+                section = j;
+                break;
+            }
+        }
+        char name[64];
+        if (section >= 0) {
+            snprintf(name, sizeof(name), "%s", sections[section].name);
+        } else {
+            snprintf(name, sizeof(name), "autoload %d", i);
+        }
+        module = add_module(name, base_loads[i], section);
+        module->base = base_static.data + base_offsets[i];
+        module->base_size = base_sizes[i];
+        module->build = static_build.data + build_offsets[i];
+        module->build_size = build_sizes[i];
+    }
+
+    uint32_t ovt = word_at(&rom, 0x50);
+    uint32_t fat = word_at(&rom, 0x48);
+    for (int i = 0; i < num_overlays; i++) {
+        size_t entry = ovt + 32 * i;
+        uint32_t vma = word_at(&rom, entry + 4);
+        uint32_t file_id = word_at(&rom, entry + 24);
+        uint32_t flags = word_at(&rom, entry + 28);
+        uint32_t start = word_at(&rom, fat + 8 * file_id);
+        uint32_t end = word_at(&rom, fat + 8 * file_id + 4);
+        char name[64];
+
+        if (names >= names_end) {
+            fatal("%s_defs.sbin lists fewer overlays than the baserom's %d", stem, num_overlays);
+        }
+        size_t len = strnlen(names, names_end - names);
+        snprintf(name, sizeof(name), "%.*s", (int)len, names);
+        if (strrchr(name, '.') != NULL) {
+            *strrchr(name, '.') = '\0';
+        }
+        if (end < start || end > rom.size) {
+            fatal("overlay %d out of range", i);
+        }
+        module = add_module(name, vma, find_section(name));
+        snprintf(module->build_path, sizeof(module->build_path), "%.*s%.*s", dir_len, stem, (int)len, names);
+        module->base = rom.data + start;
+        module->base_size = end - start;
+        if (flags & (1 << 24)) {
+            module->compressed = flags & 0xFFFFFF;
+        }
+        names += len + 1;
+    }
+
+    if (jobs <= 0) {
+        jobs = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    }
+    if (jobs > num_modules) {
+        jobs = num_modules;
+    }
+    if (jobs < 1) {
+        jobs = 1;
+    }
+    pthread_t *threads = calloc(jobs, sizeof(pthread_t));
+    for (int i = 1; i < jobs; i++) {
+        pthread_create(&threads[i], NULL, worker, NULL);
+    }
+    worker(NULL);
+    for (int i = 1; i < jobs; i++) {
+        pthread_join(threads[i], NULL);
+    }
+
+    int total_funcs = 0, total_diff = 0, modules_differ = 0, failed = 0;
+    for (int i = 0; i < num_modules; i++) {
+        module = &modules[i];
+        total_funcs += module->num_funcs;
+        total_diff += module->num_diff;
+        failed += module->failed;
+        if (module->report_size != 0) {
+            modules_differ++;
+            printf("%s (%08X): %d of %d functions differ\n%s", module->name, module->vma, module->num_diff, module->num_funcs, module->report);
+        }
+        free(module->report);
+        free(module->base_owned);
+    }
+
+    if (fsdir != NULL) {
+        fs_rom = rom.data;
+        fs_rom_size = rom.size;
+        fs_root = fsdir;
+        printf("filesystem (%s):\n", fsdir);
+        nftw(fsdir, compare_fs_file, 16, FTW_PHYS);
+        printf("  %d of %d files differ\n", fs_differ, fs_compared);
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    printf("%d of %d modules differ, %d of %d functions, in %.0f ms on %d threads\n",
+        modules_differ, num_modules, total_diff, total_funcs,
+        (t1.tv_sec - t0.tv_sec) * 1e3 + (t1.tv_nsec - t0.tv_nsec) / 1e6, jobs);
+
+    if (failed != 0) {
+        return 2;
+    }
+    return (modules_differ != 0 || fs_differ != 0) ? 1 : 0;
+}
@@ -49,6 +49,8 @@ static uint32_t MIi_UncompressBackwards(unsigned char ** out_p, size_t compsize)
     return compsize + offset;
 }
 
+// ntrromdiff.c includes this file for the helpers above.
+#ifndef NTR_HELPERS_ONLY
 int main(int argc, char ** argv)
 {
     if (argc < 4) {
@@ -105,3 +107,4 @@ int main(int argc, char ** argv)
     free(inbuf);
     return 0;
 }
+#endif //NTR_HELPERS_ONLY
@@ -0,0 +1,65 @@
+// overlay_12_0224E4FC.c as the game builds it with OPTIMIZE_BATTLER_VAR_TABLE
+// and OPTIMIZE_BATTLER_VAR_PROFILE, for its descriptor table, the read and
+// write paths GetBattlerVar and SetBattlerVar take for plain fields, and
+// BattlerVar_Record. Everything else in the file is dropped at link time.
+#include "../../src/battle/overlay_12_0224E4FC.c"
+
+#include "layout.h"
+
+int TableGetBattlerVar(void *mon, u32 id, void *data, int *status) {
+    const BattlerVarDesc *desc;
+
+    if (id >= BATTLER_VAR_COUNT) {
+        *status = LAYOUT_INVALID;
+        return 0;
+    }
+    desc = &sBattlerVarDescs[id];
+    if (desc->flags & BATTLER_VAR_GET_SPECIAL) {
+        *status = id == BMON_DATA_99 ? LAYOUT_INVALID : LAYOUT_SPECIAL;
+        return 0;
+    }
+    return BattleMon_ReadVar(mon, desc);
+}
+
+void TableSetBattlerVar(void *mon, u32 id, void *data, int *status) {
+    const BattlerVarDesc *desc;
+
+    if (id >= BATTLER_VAR_COUNT) {
+        *status = LAYOUT_INVALID;
+        return;
+    }
+    desc = &sBattlerVarDescs[id];
+    if (desc->flags & BATTLER_VAR_SET_SPECIAL) {
+        // Of the special fields, only these are set case by case rather than asserting
+        *status = (id == BMON_DATA_NICKNAME || id == BMON_DATA_OT_NAME || id == BMON_DATA_100
+            || (id >= BMON_DATA_MOVE1MAXPP && id <= BMON_DATA_MOVE4MAXPP)) ? LAYOUT_SPECIAL : LAYOUT_INVALID;
+        return;
+    }
+    BattleMon_WriteVar(mon, desc, data);
+}
+
+int TableGetBattlerVarProfiled(void *mon, int battlerId, u32 id, void *data) {
+    int status = LAYOUT_PLAIN;
+
+    BattlerVar_Record(battlerId, id, FALSE);
+    return TableGetBattlerVar(mon, id, data, &status);
+}
+
+void TableSetBattlerVarProfiled(void *mon, int battlerId, u32 id, void *data) {
+    int status = LAYOUT_PLAIN;
+
+    BattlerVar_Record(battlerId, id, TRUE);
+    TableSetBattlerVar(mon, id, data, &status);
+}
+
+const void *Table_GetStats(void) {
+    return &sBattlerVarStats;
+}
+
+void Table_ResetStats(void) {
+    BattlerVar_ResetStats();
+}
+
+u32 Table_GetAccessCount(u32 id, BOOL write) {
+    return BattlerVar_GetAccessCount(id, write);
+}
@@ -0,0 +1,533 @@
+// Built with the game's include paths and no host headers, so that BATTLEMON
+// and BattlerVarStats are exactly what overlay 12 compiles against.
+#include "global.h"
+#include "battle.h"
+#include "battler_var.h"
+#include "constants/battle.h"
+#include "layout.h"
+
+const int kLayoutMonSize = sizeof(BATTLEMON);
+const int kLayoutNumVars = BATTLER_VAR_COUNT;
+const int kLayoutStatsSize = sizeof(BattlerVarStats);
+const int kLayoutTraceLen = BATTLER_VAR_TRACE_LEN;
+const int kLayoutTraceWrite = BATTLER_VAR_TRACE_WRITE;
+const int kLayoutTraceBattlerShift = BATTLER_VAR_TRACE_BATTLER_SHIFT;
+
+// GetBattlerVar and SetBattlerVar from src/battle/overlay_12_0224E4FC.c as
+// they were before OPTIMIZE_BATTLER_VAR_TABLE. Only the cases that need the
+// battle context or other game code are cut down to a status report.
+
+int RefGetBattlerVar(void *monPtr, u32 id, void *data, int *special) {
+    BATTLEMON *mon = monPtr;
+
+    switch (id) {
+    case BMON_DATA_SPECIES:
+        return mon->species;
+    case BMON_DATA_ATK:
+        return mon->atk;
+    case BMON_DATA_DEF:
+        return mon->def;
+    case BMON_DATA_SPEED:
+        return mon->speed;
+    case BMON_DATA_SPATK:
+        return mon->spAtk;
+    case BMON_DATA_SPDEF:
+        return mon->spDef;
+    case BMON_DATA_MOVE1:
+    case BMON_DATA_MOVE2:
+    case BMON_DATA_MOVE3:
+    case BMON_DATA_MOVE4:
+        {
+            int index = id - BMON_DATA_MOVE1; //see below
+            return mon->moves[index];
+        }
+    case BMON_DATA_HP_IV:
+        return mon->hpIV;
+    case BMON_DATA_ATK_IV:
+        return mon->atkIV;
+    case BMON_DATA_DEF_IV:
+        return mon->defIV;
+    case BMON_DATA_SPEED_IV:
+        return mon->speedIV;
+    case BMON_DATA_SPATK_IV:
+        return mon->spAtkIV;
+    case BMON_DATA_SPDEF_IV:
+        return mon->spDefIV;
+    case BMON_DATA_IS_EGG:
+        return mon->isEgg;
+    case BMON_DATA_HAS_NICKNAME:
+        return mon->hasNickname;
+    case BMON_DATA_STAT_CHANGE_HP:
+    case BMON_DATA_STAT_CHANGE_ATK:
+    case BMON_DATA_STAT_CHANGE_DEF:
+    case BMON_DATA_STAT_CHANGE_SPEED:
+    case BMON_DATA_STAT_CHANGE_SPATK:
+    case BMON_DATA_STAT_CHANGE_SPDEF:
+    case BMON_DATA_STAT_CHANGE_ACC:
+    case BMON_DATA_STAT_CHANGE_EVASION:
+        {
+            int index = id - BMON_DATA_STAT_CHANGE_HP; //see below
+            return mon->statChanges[index];
+        }
+    case BMON_DATA_ABILITY:
+        return mon->ability;
+    case BMON_DATA_TYPE_1:
+    case BMON_DATA_TYPE_2:
+        *special = LAYOUT_SPECIAL;
+        return 0;
+    case BMON_DATA_GENDER:
+        return mon->gender;
+    case BMON_DATA_IS_SHINY:
+        return mon->shiny;
+    case BMON_DATA_MOVE1PP:
+    case BMON_DATA_MOVE2PP:
+    case BMON_DATA_MOVE3PP:
+    case BMON_DATA_MOVE4PP:
+        {
+            int index = id - BMON_DATA_MOVE1PP; //annoying but required to match
+            return mon->movePPCur[index];
+        }
+    case BMON_DATA_MOVE1PPCUR:
+    case BMON_DATA_MOVE2PPCUR:
+    case BMON_DATA_MOVE3PPCUR:
+    case BMON_DATA_MOVE4PPCUR:
+        {    
+            int index = id - BMON_DATA_MOVE1PPCUR; //see above
+            return mon->movePP[index];
+        }
+    case BMON_DATA_MOVE1MAXPP:
+    case BMON_DATA_MOVE2MAXPP:
+    case BMON_DATA_MOVE3MAXPP:
+    case BMON_DATA_MOVE4MAXPP:
+        *special = LAYOUT_SPECIAL;
+        return 0;
+    case BMON_DATA_LEVEL:
+        return mon->level;
+    case BMON_DATA_FRIENDSHIP:
+        return mon->friendship;
+    case BMON_DATA_NICKNAME:
+        *special = LAYOUT_SPECIAL;
+        break;
+    case BMON_DATA_NICKNAME2:
+        *special = LAYOUT_SPECIAL;
+        break;
+    case BMON_DATA_HP:
+        return mon->hp;
+    case BMON_DATA_MAXHP:
+        return mon->maxHp;
+    case BMON_DATA_OT_NAME:
+        *special = LAYOUT_SPECIAL;
+        break;
+    case BMON_DATA_EXP:
+        return mon->exp;
+    case BMON_DATA_PERSONALITY:
+        return mon->personality;
+    case BMON_DATA_STATUS:
+        return mon->status;
+    case BMON_DATA_STATUS2:
+        return mon->status2;
+    case BMON_DATA_OT_ID:
+        return mon->otid;
+    case BMON_DATA_HELD_ITEM:
+        return mon->item;
+    case BMON_DATA_56:
+        return mon->unk78;
+    case BMON_DATA_MSG_FLAG:
+        return mon->msgFlag;
+    case BMON_DATA_OT_GENDER:
+        return mon->metGender;
+    case BMON_DATA_MOVE_EFFECT:
+        return mon->moveEffectFlags;
+    case BMON_DATA_MOVE_EFFECT_TEMP:
+        return mon->unk80;
+    case BMON_DATA_DISABLED_TURNS:
+        return mon->unk88.disabledTurns;
+    case BMON_DATA_ENCORED_TURNS:
+        return mon->unk88.encoredTurns;
+    case BMON_DATA_IS_CHARGED:
+        return mon->unk88.isCharged;
+    case BMON_DATA_TAUNT_TURNS:
+        return mon->unk88.tauntTurns;
+    case BMON_DATA_PROTECT_SUCCESS_COUNT:
+        return mon->unk88.protectSuccessTurns;
+    case BMON_DATA_PERISH_SONG_TURNS:
+        return mon->unk88.perishSongTurns;
+    case BMON_DATA_ROLLOUT_TURNS:
+        return mon->unk88.rolloutCount;
+    case BMON_DATA_FURY_CUTTER_TURNS:
+        return mon->unk88.furyCutterCount;
+    case BMON_DATA_STOCKPILE_COUNT:
+        return mon->unk88.stockpileCount;
+    case BMON_DATA_STOCKPILE_DEF_BOOSTS:
+        return mon->unk88.stockpileDefCount;
+    case BMON_DATA_STOCKPILE_SPDEF_BOOSTS:
+        return mon->unk88.stockpileSpDefCount;
+    case BMON_DATA_TRUANT_FLAG:
+        return mon->unk88.truantFlag;
+    case BMON_DATA_FLASH_FIRE_ACTIVE:
+        return mon->unk88.flashFire;
+    case BMON_DATA_LOCKED_ON_BATTLER:
+        return mon->unk88.battlerIdLockOn;
+    case BMON_DATA_MIMICED_MOVE:
+        return mon->unk88.mimicedMoveIndex;
+    case BMON_DATA_BINDED_BATTLER:
+        return mon->unk88.battlerIdBinding;
+    case BMON_DATA_MEAN_LOOK_BATTLER:
+        return mon->unk88.battlerIdMeanLook;
+    case BMON_DATA_LAST_RESORT_COUNT:
+        return mon->unk88.lastResortCount;
+    case BMON_DATA_MAGNET_RISE:
+        return mon->unk88.magnetRiseTurns;
+    case BMON_DATA_HEAL_BLOCK:
+        return mon->unk88.healBlockTurns;
+    case BMON_DATA_81:
+        return mon->unk88.unk4_13;
+    case BMON_DATA_ITEM_KNOCKED_OFF:
+        return mon->unk88.knockOffFlag;
+    case BMON_DATA_METRONOME: //refers to the actual item, not the move
+        return mon->unk88.metronomeTurns;
+    case BMON_DATA_84:
+        return mon->unk88.unk4_2B;
+    case BMON_DATA_CUSTAP_FLAG:
+        return mon->unk88.custapBerryFlag;
+    case BMON_DATA_QUICK_CLAW_FLAG:
+        return mon->unk88.quickClawFlag;
+    case BMON_DATA_RECHARGE:
+        return mon->unk88.rechargeCount;
+    case BMON_DATA_FAKE_OUT:
+        return mon->unk88.fakeOutCount;
+    case BMON_DATA_SLOW_START_COUNT:
+        return mon->unk88.slowStartTurns;
+    case BMON_DATA_SUBSTITUTE_HP:
+        return mon->unk88.substituteHp;
+    case BMON_DATA_TRANSFORM_PERSONALITY:
+        return mon->unk88.transformPersonality;
+    case BMON_DATA_DISABLED_MOVE_NO:
+        return mon->unk88.disabledMove;
+    case BMON_DATA_ENCORED_MOVE_NO:
+        return mon->unk88.encoredMove;
+    case BMON_DATA_BINDING_MOVE_NO:
+        return mon->unk88.bindingMove;
+    case BMON_DATA_HELD_ITEM_RESTORE_HP:
+        return mon->unk88.unk30;
+    case BMON_DATA_SLOW_START_FLAG:
+        return mon->slowStartFlag;
+    case BMON_DATA_SLOW_START_END:
+        return mon->slowStartEnded;
+    case BMON_DATA_FORME:
+        return mon->forme;
+    case BMON_DATA_100:
+        *special = LAYOUT_SPECIAL;
+        return 0;
+    default:
+        *special = LAYOUT_INVALID;
+    }
+    
+    return 0;
+}
+
+void RefSetBattlerVar(void *monPtr, u32 id, void *data, int *special) {
+    BATTLEMON *mon = monPtr;
+    u32 *data32 = (u32 *)data;
+    u16 *data16 = (u16 *)data;
+    s16 *datas16 = (s16 *)data;
+    u8 *data8 = (u8 *)data;
+    s8 *datas8 = (s8 *)data;
+    
+    switch (id) {
+    case BMON_DATA_SPECIES:
+        mon->species = *data16;
+        break;
+    case BMON_DATA_ATK:
+        mon->atk = *data16;
+        break;
+    case BMON_DATA_DEF:
+        mon->def = *data16;
+        break;
+    case BMON_DATA_SPEED:
+        mon->speed = *data16;
+        break;
+    case BMON_DATA_SPATK:
+        mon->spAtk = *data16;
+        break;
+    case BMON_DATA_SPDEF:
+        mon->spDef = *data16;
+        break;
+    case BMON_DATA_MOVE1:
+    case BMON_DATA_MOVE2:
+    case BMON_DATA_MOVE3:
+    case BMON_DATA_MOVE4:
+        {
+            int index = id - BMON_DATA_MOVE1;
+            mon->moves[index] = *data16;
+        }
+        break;
+    case BMON_DATA_HP_IV:
+        mon->hpIV = *data8;
+        break;
+    case BMON_DATA_ATK_IV:
+        mon->atkIV = *data8;
+        break;
+    case BMON_DATA_DEF_IV:
+        mon->defIV = *data8;
+        break;
+    case BMON_DATA_SPEED_IV:
+        mon->speedIV = *data8;
+        break;
+    case BMON_DATA_SPATK_IV:
+        mon->spAtkIV = *data8;
+        break;
+    case BMON_DATA_SPDEF_IV:
+        mon->spDefIV = *data8;
+        break;
+    case BMON_DATA_IS_EGG:
+        mon->isEgg = *data8;
+        break;
+    case BMON_DATA_HAS_NICKNAME:
+        mon->hasNickname = *data8;
+        break;
+    case BMON_DATA_STAT_CHANGE_HP:
+    case BMON_DATA_STAT_CHANGE_ATK:
+    case BMON_DATA_STAT_CHANGE_DEF:
+    case BMON_DATA_STAT_CHANGE_SPEED:
+    case BMON_DATA_STAT_CHANGE_SPATK:
+    case BMON_DATA_STAT_CHANGE_SPDEF:
+    case BMON_DATA_STAT_CHANGE_ACC:
+    case BMON_DATA_STAT_CHANGE_EVASION:
+        {
+            int index = id - BMON_DATA_STAT_CHANGE_HP;
+            mon->statChanges[index] = *datas8;
+        }
+        break;
+    case BMON_DATA_ABILITY:
+        mon->ability = *data8;
+        break;
+    case BMON_DATA_TYPE_1:
+        mon->type1 = *data8;
+        break;
+    case BMON_DATA_TYPE_2:
+        mon->type2 = *data8;
+        break;
+    case BMON_DATA_GENDER:
+        mon->gender = *data8;
+        break;
+    case BMON_DATA_IS_SHINY:
+        mon->shiny = *data8;
+        break;
+    case BMON_DATA_MOVE1PP:
+    case BMON_DATA_MOVE2PP:
+    case BMON_DATA_MOVE3PP:
+    case BMON_DATA_MOVE4PP:
+        {
+            int index = id - BMON_DATA_MOVE1PP; 
+            mon->movePPCur[index] = *data8;
+        }
+        break;
+    case BMON_DATA_MOVE1PPCUR:
+    case BMON_DATA_MOVE2PPCUR:
+    case BMON_DATA_MOVE3PPCUR:
+    case BMON_DATA_MOVE4PPCUR:
+        {    
+            int index = id - BMON_DATA_MOVE1PPCUR;
+            mon->movePP[index] = *data8;
+        }
+        break;
+    case BMON_DATA_MOVE1MAXPP:
+    case BMON_DATA_MOVE2MAXPP:
+    case BMON_DATA_MOVE3MAXPP:
+    case BMON_DATA_MOVE4MAXPP:
+        *special = LAYOUT_SPECIAL;
+        break;
+    case BMON_DATA_LEVEL:
+        mon->level = *data8;
+        break;
+    case BMON_DATA_FRIENDSHIP:
+        mon->friendship = *data8;
+        break;
+    case BMON_DATA_NICKNAME:
+        *special = LAYOUT_SPECIAL;
+        break;
+    case BMON_DATA_HP:
+        mon->hp = *datas16;
+        break;
+    case BMON_DATA_MAXHP:
+        mon->maxHp = *data16;
+        break;
+    case BMON_DATA_OT_NAME:
+        *special = LAYOUT_SPECIAL;
+        break;
+    case BMON_DATA_EXP:
+        mon->exp = *data32;
+        break;
+    case BMON_DATA_PERSONALITY:
+        mon->personality = *data32;
+        break;
+    case BMON_DATA_STATUS:
+        mon->status = *data32;
+        break;
+    case BMON_DATA_STATUS2:
+        mon->status2 = *data32;
+        break;
+    case BMON_DATA_OT_ID:
+        mon->otid = *data32;
+        break;
+    case BMON_DATA_HELD_ITEM:
+        mon->item = *data16;
+        break;
+    case BMON_DATA_56:
+        mon->unk78 = *data8;
+        break;
+    case BMON_DATA_MSG_FLAG:
+        mon->msgFlag = *data8;
+        break;
+    case BMON_DATA_OT_GENDER:
+        mon->metGender = *data8;
+        break;
+    case BMON_DATA_MOVE_EFFECT:
+        mon->moveEffectFlags = *data32;
+        break;
+    case BMON_DATA_MOVE_EFFECT_TEMP:
+        mon->unk80 = *data32;
+        break;
+    case BMON_DATA_DISABLED_TURNS:
+        mon->unk88.disabledTurns = *data8;
+        break;
+    case BMON_DATA_ENCORED_TURNS:
+        mon->unk88.encoredTurns = *data8;
+        break;
+    case BMON_DATA_IS_CHARGED:
+        mon->unk88.isCharged = *data8;
+        break;
+    case BMON_DATA_TAUNT_TURNS:
+        mon->unk88.tauntTurns = *data8;
+        break;
+    case BMON_DATA_PROTECT_SUCCESS_COUNT:
+        mon->unk88.protectSuccessTurns = *data8;
+        break;
+    case BMON_DATA_PERISH_SONG_TURNS:
+        mon->unk88.perishSongTurns = *data8;
+        break;
+    case BMON_DATA_ROLLOUT_TURNS:
+        mon->unk88.rolloutCount = *data8;
+        break;
+    case BMON_DATA_FURY_CUTTER_TURNS:
+        mon->unk88.furyCutterCount = *data8;
+        break;
+    case BMON_DATA_STOCKPILE_COUNT:
+        mon->unk88.stockpileCount = *data8;
+        break;
+    case BMON_DATA_STOCKPILE_DEF_BOOSTS:
+        mon->unk88.stockpileDefCount = *data8;
+        break;
+    case BMON_DATA_STOCKPILE_SPDEF_BOOSTS:
+        mon->unk88.stockpileSpDefCount = *data8;
+        break;
+    case BMON_DATA_TRUANT_FLAG:
+        mon->unk88.truantFlag = *data8;
+        break;
+    case BMON_DATA_FLASH_FIRE_ACTIVE:
+        mon->unk88.flashFire = *data8;
+        break;
+    case BMON_DATA_LOCKED_ON_BATTLER:
+        mon->unk88.battlerIdLockOn = *data8;
+        break;
+    case BMON_DATA_MIMICED_MOVE:
+        mon->unk88.mimicedMoveIndex = *data8;
+        break;
+    case BMON_DATA_BINDED_BATTLER:
+        mon->unk88.battlerIdBinding = *data8;
+        break;
+    case BMON_DATA_MEAN_LOOK_BATTLER:
+        mon->unk88.battlerIdMeanLook = *data8;
+        break;
+    case BMON_DATA_LAST_RESORT_COUNT:
+        mon->unk88.lastResortCount = *data8;
+        break;
+    case BMON_DATA_MAGNET_RISE:
+        mon->unk88.magnetRiseTurns = *data8;
+        break;
+    case BMON_DATA_HEAL_BLOCK:
+        mon->unk88.healBlockTurns = *data8;
+        break;
+    case BMON_DATA_81:
+        mon->unk88.unk4_13 = *data8;
+        break;
+    case BMON_DATA_ITEM_KNOCKED_OFF:
+        mon->unk88.knockOffFlag = *data8;
+        break;
+    case BMON_DATA_METRONOME: //refers to the actual item, not the move
+        mon->unk88.metronomeTurns = *data8;
+        break;
+    case BMON_DATA_84:
+        mon->unk88.unk4_2B = *data8;
+        break;
+    case BMON_DATA_CUSTAP_FLAG:
+        mon->unk88.custapBerryFlag = *data8;
+        break;
+    case BMON_DATA_QUICK_CLAW_FLAG:
+        mon->unk88.quickClawFlag = *data8;
+        break;
+    case BMON_DATA_RECHARGE:
+        mon->unk88.rechargeCount = *data32;
+        break;
+    case BMON_DATA_FAKE_OUT:
+        mon->unk88.fakeOutCount = *data32;
+        break;
+    case BMON_DATA_SLOW_START_COUNT:
+        mon->unk88.slowStartTurns = *data32;
+        break;
+    case BMON_DATA_SUBSTITUTE_HP:
+        mon->unk88.substituteHp = *data32;
+        break;
+    case BMON_DATA_TRANSFORM_PERSONALITY:
+        mon->unk88.transformPersonality = *data32;
+        break;
+    case BMON_DATA_DISABLED_MOVE_NO:
+        mon->unk88.disabledMove = *data16;
+        break;
+    case BMON_DATA_ENCORED_MOVE_NO:
+        mon->unk88.encoredMove = *data16;
+        break;
+    case BMON_DATA_BINDING_MOVE_NO:
+        mon->unk88.bindingMove = *data16;
+        break;
+    case BMON_DATA_HELD_ITEM_RESTORE_HP:
+        mon->unk88.unk30 = *data32;
+        break;
+    case BMON_DATA_SLOW_START_FLAG:
+        mon->slowStartFlag = *data8;
+        break;
+    case BMON_DATA_SLOW_START_END:
+        mon->slowStartEnded = *data8;
+        break;
+    case BMON_DATA_FORME:
+        mon->forme = *data8;
+        break;
+    case BMON_DATA_100:
+        *special = LAYOUT_SPECIAL;
+        break;
+    default:
+        *special = LAYOUT_INVALID;
+    }
+}
+
+u32 Layout_StatsReads(const void *stats, u32 id) {
+    return ((const BattlerVarStats *)stats)->numReads[id];
+}
+
+u32 Layout_StatsWrites(const void *stats, u32 id) {
+    return ((const BattlerVarStats *)stats)->numWrites[id];
+}
+
+u32 Layout_StatsTraceCount(const void *stats) {
+    return ((const BattlerVarStats *)stats)->traceCount;
+}
+
+u16 Layout_StatsTrace(const void *stats, int i) {
+    return ((const BattlerVarStats *)stats)->trace[i];
+}
+
+// The one SDK call game.c reaches, from BattlerVar_ResetStats
+void MI_CpuFill8(void *dest, u8 data, u32 size) {
+    __builtin_memset(dest, data, size);
+}
@@ -0,0 +1,46 @@
+#ifndef GUARD_BATTLERVAR_LAYOUT_H
+#define GUARD_BATTLERVAR_LAYOUT_H
+
+#include <stdint.h>
+
+// layout.c and game.c are built against the game's headers and can't include
+// the host's, so everything main.c needs from them goes through here without
+// game types.
+
+#define LAYOUT_PLAIN   0
+#define LAYOUT_SPECIAL 1 // the game handles this field case by case
+#define LAYOUT_INVALID 2 // GF_ASSERT(FALSE) in the game
+
+extern const int kLayoutMonSize;
+extern const int kLayoutNumVars;
+extern const int kLayoutStatsSize;
+extern const int kLayoutTraceLen;
+extern const int kLayoutTraceWrite;
+extern const int kLayoutTraceBattlerShift;
+
+// The switch GetBattlerVar and SetBattlerVar used before the table, on a bare
+// BATTLEMON. Fields the switch doesn't read or write in place report
+// LAYOUT_SPECIAL or LAYOUT_INVALID in *status and do nothing.
+int RefGetBattlerVar(void * mon, uint32_t id, void * data, int * status);
+void RefSetBattlerVar(void * mon, uint32_t id, void * data, int * status);
+
+// The table path from overlay_12_0224E4FC.c, built by game.c, the same way
+int TableGetBattlerVar(void * mon, uint32_t id, void * data, int * status);
+void TableSetBattlerVar(void * mon, uint32_t id, void * data, int * status);
+
+// The table path with the game's per-field counting and trace
+// (OPTIMIZE_BATTLER_VAR_PROFILE), into the game's own sBattlerVarStats
+int TableGetBattlerVarProfiled(void * mon, int battlerId, uint32_t id, void * data);
+void TableSetBattlerVarProfiled(void * mon, int battlerId, uint32_t id, void * data);
+const void * Table_GetStats(void);
+void Table_ResetStats(void);
+// BattlerVar_GetAccessCount
+uint32_t Table_GetAccessCount(uint32_t id, int write);
+
+// Fields of a BattlerVarStats dump
+uint32_t Layout_StatsReads(const void * stats, uint32_t id);
+uint32_t Layout_StatsWrites(const void * stats, uint32_t id);
+uint32_t Layout_StatsTraceCount(const void * stats);
+uint16_t Layout_StatsTrace(const void * stats, int i);
+
+#endif //GUARD_BATTLERVAR_LAYOUT_H
@@ -0,0 +1,610 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stdnoreturn.h>
+#include <stdarg.h>
+#include <errno.h>
+#include <time.h>
+#include "layout.h"
+
+// BATTLECONTEXT steps through battleMons in 0xC0 byte strides
+#define BATTLEMON_SIZE 0xC0
+
+#define MAX_BATTLERS 4
+#define SYNTHETIC_TRACE_LEN 4096
+
+typedef struct TraceEntry
+{
+    uint8_t battlerId;
+    uint8_t id;
+    bool write;
+} TraceEntry;
+
+static char * sVarNames[256];
+
+static inline noreturn __attribute__((format(printf, 1, 2))) void fatal_error(const char * message, ...)
+{
+    va_list va_args;
+    va_start(va_args, message);
+    fputs("Error: ", stderr);
+    vfprintf(stderr, message, va_args);
+    fputc('\n', stderr);
+    va_end(va_args);
+    exit(EXIT_FAILURE);
+}
+
+// GF_ASSERT in game.c, which is built with PM_KEEP_ASSERTS
+void GF_AssertFail(void)
+{
+    fatal_error("GF_ASSERT failed in the game code");
+}
+
+static uint32_t ParseU32(const char * arg)
+{
+    char * end;
+    unsigned long long val = strtoull(arg, &end, 0);
+    if (*arg == '\0' || *end != '\0' || val > 0xFFFFFFFFull)
+    {
+        fatal_error("invalid number: %s", arg);
+    }
+    return (uint32_t)val;
+}
+
+static double Now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static uint32_t Random(uint32_t * state)
+{
+    // xorshift32
+    uint32_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return *state = x;
+}
+
+// Names from include/constants/battle.h, if it can be found from here
+static void LoadVarNames(void)
+{
+    static const char * const paths[] = {
+        "include/constants/battle.h",
+        "../include/constants/battle.h",
+        "../../include/constants/battle.h",
+    };
+    FILE * file = NULL;
+    char line[512];
+
+    for (size_t i = 0; i < sizeof(paths) / sizeof(paths[0]) && file == NULL; i++)
+    {
+        file = fopen(paths[i], "r");
+    }
+    if (file == NULL)
+    {
+        return;
+    }
+    while (fgets(line, sizeof(line), file) != NULL)
+    {
+        char name[256];
+        unsigned value;
+        if (sscanf(line, "#define BMON_DATA_%255s %u", name, &value) == 2 && value < 256 && sVarNames[value] == NULL)
+        {
+            sVarNames[value] = strdup(name);
+        }
+    }
+    fclose(file);
+}
+
+static const char * VarName(int id)
+{
+    return id < 256 && sVarNames[id] != NULL ? sVarNames[id] : "?";
+}
+
+// ---------------------------------------------------------------------------
+// selftest
+
+static void RandomBytes(uint32_t * rng, uint8_t * buf, size_t size)
+{
+    for (size_t i = 0; i < size; i++)
+    {
+        buf[i] = Random(rng) >> 24;
+    }
+}
+
+static int SelfTest(int iterations)
+{
+    uint8_t mon[BATTLEMON_SIZE];
+    uint8_t monRef[BATTLEMON_SIZE];
+    uint8_t monTable[BATTLEMON_SIZE];
+    uint8_t data[8];
+    uint32_t rng = 0x12345678;
+    int numFailed = 0;
+    int numPlain[2] = { 0, 0 };
+
+    if (kLayoutMonSize != BATTLEMON_SIZE)
+    {
+        printf("FAIL: BATTLEMON is 0x%x bytes on the host, the game's is 0x%x\n", kLayoutMonSize, BATTLEMON_SIZE);
+        return EXIT_FAILURE;
+    }
+
+    // Every ID the table covers, and a few past it
+    for (int id = 0; id < kLayoutNumVars + 3; id++)
+    {
+        bool failed = false;
+        int statusRef = LAYOUT_PLAIN, statusTable = LAYOUT_PLAIN;
+
+        for (int iter = 0; iter < iterations && !failed; iter++)
+        {
+            RandomBytes(&rng, mon, sizeof(mon));
+            // Every bit once set and once clear in the first two rounds
+            if (iter < 2)
+            {
+                memset(mon, iter == 0 ? 0x00 : 0xFF, sizeof(mon));
+            }
+            statusRef = statusTable = LAYOUT_PLAIN;
+            int ref = RefGetBattlerVar(mon, id, NULL, &statusRef);
+            int table = TableGetBattlerVar(mon, id, NULL, &statusTable);
+            if (statusRef != statusTable || ref != table)
+            {
+                printf("FAIL: get %s (%d): switch %d (status %d), table %d (status %d)\n", VarName(id), id, ref, statusRef, table, statusTable);
+                failed = true;
+                break;
+            }
+            if (iter == 0 && statusRef == LAYOUT_PLAIN)
+            {
+                numPlain[0]++;
+            }
+        }
+        for (int iter = 0; iter < iterations && !failed; iter++)
+        {
+            RandomBytes(&rng, mon, sizeof(mon));
+            RandomBytes(&rng, data, sizeof(data));
+            if (iter < 2)
+            {
+                memset(mon, iter == 0 ? 0x00 : 0xFF, sizeof(mon));
+                memset(data, iter == 0 ? 0xFF : 0x00, sizeof(data));
+            }
+            memcpy(monRef, mon, sizeof(mon));
+            memcpy(monTable, mon, sizeof(mon));
+            statusRef = statusTable = LAYOUT_PLAIN;
+            RefSetBattlerVar(monRef, id, data, &statusRef);
+            TableSetBattlerVar(monTable, id, data, &statusTable);
+            if (statusRef != statusTable || memcmp(monRef, monTable, sizeof(mon)) != 0)
+            {
+                printf("FAIL: set %s (%d): status %d vs %d", VarName(id), id, statusRef, statusTable);
+                for (size_t i = 0; i < sizeof(mon); i++)
+                {
+                    if (monRef[i] != monTable[i])
+                    {
+                        printf(", +0x%02zx switch %02x table %02x", i, monRef[i], monTable[i]);
+                    }
+                }
+                printf("\n");
+                failed = true;
+                break;
+            }
+            if (iter == 0 && statusRef == LAYOUT_PLAIN)
+            {
+                numPlain[1]++;
+            }
+        }
+        if (failed)
+        {
+            numFailed++;
+        }
+    }
+
+    printf("%d of %d IDs match the switch (%d read, %d written through the table)\n",
+        kLayoutNumVars + 3 - numFailed, kLayoutNumVars + 3, numPlain[0], numPlain[1]);
+    return numFailed == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+// ---------------------------------------------------------------------------
+// stats and bench
+
+// Reads a raw dump of sBattlerVarStats
+static uint8_t * ReadStats(const char * path)
+{
+    FILE * file = fopen(path, "rb");
+    uint8_t * stats;
+    long size;
+
+    if (file == NULL)
+    {
+        fatal_error("%s: %s", path, strerror(errno));
+    }
+    fseek(file, 0, SEEK_END);
+    size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    if (size != kLayoutStatsSize)
+    {
+        fatal_error("%s: %ld bytes, expected a %d byte dump of sBattlerVarStats", path, size, kLayoutStatsSize);
+    }
+    stats = malloc(size);
+    if (stats == NULL || fread(stats, 1, size, file) != (size_t)size)
+    {
+        fatal_error("%s: read failed", path);
+    }
+    fclose(file);
+    return stats;
+}
+
+// The trace in a stats dump, oldest call first
+static TraceEntry * TraceFromStats(const uint8_t * stats, int * count)
+{
+    uint32_t total = Layout_StatsTraceCount(stats);
+    int n = total < (uint32_t)kLayoutTraceLen ? (int)total : kLayoutTraceLen;
+    int first = total < (uint32_t)kLayoutTraceLen ? 0 : (int)(total % kLayoutTraceLen);
+    TraceEntry * trace = calloc(n > 0 ? n : 1, sizeof(TraceEntry));
+
+    if (trace == NULL)
+    {
+        fatal_error("out of memory");
+    }
+    for (int i = 0; i < n; i++)
+    {
+        uint16_t raw = Layout_StatsTrace(stats, (first + i) % kLayoutTraceLen);
+        trace[i].id = raw & 0xFF;
+        trace[i].battlerId = (raw >> kLayoutTraceBattlerShift) & 0x7F & (MAX_BATTLERS - 1);
+        trace[i].write = (raw & kLayoutTraceWrite) != 0;
+    }
+    *count = n;
+    return trace;
+}
+
+// Replays a known run of calls through the game's BattlerVar_Record and
+// checks the counts and the trace it leaves behind, past a wrap of the ring
+static int CheckProfile(void)
+{
+    uint8_t mon[BATTLEMON_SIZE] = { 0 };
+    uint8_t data[8] = { 0 };
+    int numCalls = kLayoutTraceLen + 37;
+    uint32_t * reads = calloc(kLayoutNumVars, sizeof(uint32_t));
+    uint32_t * writes = calloc(kLayoutNumVars, sizeof(uint32_t));
+    int numFailed = 0;
+
+    if (reads == NULL || writes == NULL)
+    {
+        fatal_error("out of memory");
+    }
+    Table_ResetStats();
+    for (int i = 0; i < numCalls; i++)
+    {
+        int id = i % kLayoutNumVars;
+        if (i % 3 == 0)
+        {
+            TableSetBattlerVarProfiled(mon, i % MAX_BATTLERS, id, data);
+            writes[id]++;
+        }
+        else
+        {
+            TableGetBattlerVarProfiled(mon, i % MAX_BATTLERS, id, NULL);
+            reads[id]++;
+        }
+    }
+    for (int id = 0; id < kLayoutNumVars; id++)
+    {
+        if (Table_GetAccessCount(id, 0) != reads[id] || Table_GetAccessCount(id, 1) != writes[id])
+        {
+            printf("FAIL: profile counts for %s (%d): %u/%u, expected %u/%u\n", VarName(id), id,
+                Table_GetAccessCount(id, 0), Table_GetAccessCount(id, 1), reads[id], writes[id]);
+            numFailed++;
+        }
+    }
+
+    int count;
+    TraceEntry * trace = TraceFromStats(Table_GetStats(), &count);
+    if (count != kLayoutTraceLen)
+    {
+        printf("FAIL: profile trace holds %d calls, expected %d\n", count, kLayoutTraceLen);
+        numFailed++;
+    }
+    for (int i = 0; i < count && numFailed == 0; i++)
+    {
+        int call = numCalls - count + i;
+        if (trace[i].id != call % kLayoutNumVars || trace[i].battlerId != call % MAX_BATTLERS || trace[i].write != (call % 3 == 0))
+        {
+            printf("FAIL: profile trace entry %d is not call %d\n", i, call);
+            numFailed++;
+        }
+    }
+    free(trace);
+    free(reads);
+    free(writes);
+
+    printf("profile: %d calls counted and traced%s\n", numCalls, numFailed ? ", WRONG" : "");
+    return numFailed == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+// Without a dump: every field the table handles, mostly read, in a fixed
+// pseudo-random order
+static TraceEntry * SyntheticTrace(int * count)
+{
+    uint8_t mon[BATTLEMON_SIZE];
+    int plain[256][2];
+    int numPlain[2] = { 0, 0 };
+    uint32_t rng = 0xC0FFEE;
+    TraceEntry * trace = malloc(SYNTHETIC_TRACE_LEN * sizeof(TraceEntry));
+
+    if (trace == NULL)
+    {
+        fatal_error("out of memory");
+    }
+    memset(mon, 0, sizeof(mon));
+    for (int id = 0; id < kLayoutNumVars; id++)
+    {
+        uint8_t data[8] = { 0 };
+        int status = LAYOUT_PLAIN;
+        TableGetBattlerVar(mon, id, NULL, &status);
+        if (status == LAYOUT_PLAIN)
+        {
+            plain[numPlain[0]++][0] = id;
+        }
+        status = LAYOUT_PLAIN;
+        TableSetBattlerVar(mon, id, data, &status);
+        if (status == LAYOUT_PLAIN)
+        {
+            plain[numPlain[1]++][1] = id;
+        }
+    }
+    for (int i = 0; i < SYNTHETIC_TRACE_LEN; i++)
+    {
+        bool write = Random(&rng) % 5 == 0;
+        trace[i].write = write;
+        trace[i].battlerId = Random(&rng) % MAX_BATTLERS;
+        trace[i].id = plain[Random(&rng) % numPlain[write]][write];
+    }
+    *count = SYNTHETIC_TRACE_LEN;
+    return trace;
+}
+
+static int CommandStats(const char * path)
+{
+    uint8_t * stats = ReadStats(path);
+    uint64_t totals[2] = { 0, 0 };
+
+    printf("%-28s %10s %10s\n", "field", "reads", "writes");
+    for (int id = 0; id < kLayoutNumVars; id++)
+    {
+        uint32_t reads = Layout_StatsReads(stats, id);
+        uint32_t writes = Layout_StatsWrites(stats, id);
+        totals[0] += reads;
+        totals[1] += writes;
+        if (reads != 0 || writes != 0)
+        {
+            printf("%-28s %10u %10u\n", VarName(id), reads, writes);
+        }
+    }
+    printf("%-28s %10llu %10llu\n", "total", (unsigned long long)totals[0], (unsigned long long)totals[1]);
+    printf("%u calls traced, the last %u kept\n", Layout_StatsTraceCount(stats),
+        Layout_StatsTraceCount(stats) < (uint32_t)kLayoutTraceLen ? Layout_StatsTraceCount(stats) : (uint32_t)kLayoutTraceLen);
+    free(stats);
+    return EXIT_SUCCESS;
+}
+
+typedef enum BenchPath
+{
+    BENCH_SWITCH,
+    BENCH_TABLE,
+    BENCH_TABLE_PROFILED,
+    BENCH_NUM_PATHS,
+} BenchPath;
+
+static const char * const sBenchPathNames[BENCH_NUM_PATHS] = {
+    "switch",
+    "table",
+    "table + profile",
+};
+
+static uint64_t RunBench(BenchPath path, const TraceEntry * trace, int count, int rounds, uint8_t (*mons)[BATTLEMON_SIZE])
+{
+    uint64_t sink = 0;
+    uint32_t data = 0;
+
+    for (int round = 0; round < rounds; round++)
+    {
+        for (int i = 0; i < count; i++)
+        {
+            const TraceEntry * entry = &trace[i];
+            void * mon = mons[entry->battlerId];
+            int status = LAYOUT_PLAIN;
+            data = data * 1664525 + 1013904223;
+            switch (path)
+            {
+            case BENCH_SWITCH:
+                if (entry->write)
+                {
+                    RefSetBattlerVar(mon, entry->id, &data, &status);
+                }
+                else
+                {
+                    sink += RefGetBattlerVar(mon, entry->id, NULL, &status);
+                }
+                break;
+            case BENCH_TABLE:
+                if (entry->write)
+                {
+                    TableSetBattlerVar(mon, entry->id, &data, &status);
+                }
+                else
+                {
+                    sink += TableGetBattlerVar(mon, entry->id, NULL, &status);
+                }
+                break;
+            default:
+                if (entry->write)
+                {
+                    TableSetBattlerVarProfiled(mon, entry->battlerId, entry->id, &data);
+                }
+                else
+                {
+                    sink += TableGetBattlerVarProfiled(mon, entry->battlerId, entry->id, NULL);
+                }
+                break;
+            }
+        }
+    }
+    return sink;
+}
+
+static int CommandBench(const char * path, int rounds)
+{
+    TraceEntry * trace;
+    int count;
+    int numReplayed = 0;
+    uint8_t (*mons)[BATTLEMON_SIZE] = calloc(MAX_BATTLERS, BATTLEMON_SIZE);
+    uint64_t sinks[BENCH_NUM_PATHS];
+
+    if (mons == NULL)
+    {
+        fatal_error("out of memory");
+    }
+    if (path != NULL)
+    {
+        uint8_t * dump = ReadStats(path);
+        trace = TraceFromStats(dump, &count);
+        free(dump);
+    }
+    else
+    {
+        trace = SyntheticTrace(&count);
+    }
+
+    // Fields that need the battle context can't be replayed on a bare
+    // BATTLEMON; drop them
+    for (int i = 0; i < count; i++)
+    {
+        int status = LAYOUT_PLAIN;
+        uint32_t data = 0;
+        uint8_t mon[BATTLEMON_SIZE] = { 0 };
+        if (trace[i].write)
+        {
+            TableSetBattlerVar(mon, trace[i].id, &data, &status);
+        }
+        else
+        {
+            TableGetBattlerVar(mon, trace[i].id, NULL, &status);
+        }
+        if (status == LAYOUT_PLAIN)
+        {
+            trace[numReplayed++] = trace[i];
+        }
+    }
+    if (numReplayed == 0)
+    {
+        fatal_error("nothing to replay: the trace has no plain field accesses");
+    }
+    printf("replaying %d accesses (%d skipped) %d times, %s\n", numReplayed, count - numReplayed, rounds,
+        path != NULL ? path : "synthetic trace");
+
+    for (int p = 0; p < BENCH_NUM_PATHS; p++)
+    {
+        double start;
+        double elapsed;
+        memset(mons, 0, MAX_BATTLERS * BATTLEMON_SIZE);
+        // Warm up, then time
+        RunBench(p, trace, numReplayed, 1, mons);
+        memset(mons, 0, MAX_BATTLERS * BATTLEMON_SIZE);
+        start = Now();
+        sinks[p] = RunBench(p, trace, numReplayed, rounds, mons);
+        elapsed = Now() - start;
+        printf("  %-18s %7.2f ns/access\n", sBenchPathNames[p], elapsed * 1e9 / ((double)numReplayed * rounds));
+    }
+    if (sinks[BENCH_SWITCH] != sinks[BENCH_TABLE] || sinks[BENCH_SWITCH] != sinks[BENCH_TABLE_PROFILED])
+    {
+        fatal_error("the paths read different values: %llx %llx %llx", (unsigned long long)sinks[0], (unsigned long long)sinks[1], (unsigned long long)sinks[2]);
+    }
+
+    free(trace);
+    free(mons);
+    return EXIT_SUCCESS;
+}
+
+static noreturn void Usage(const char * prog)
+{
+    fprintf(stderr,
+        "Usage:\n"
+        "  %s selftest [--iterations N]           compare every field of the table with the old switch\n"
+        "  %s bench [--rounds N] [DUMP]           time the switch and the table replaying a trace\n"
+        "  %s stats DUMP                          print the per-field counts in a dump\n"
+        "\n"
+        "DUMP is a raw copy of sBattlerVarStats taken from RAM in a build with\n"
+        "OPTIMIZE_BATTLER_VAR_PROFILE. Without one, bench replays a synthetic trace.\n",
+        prog, prog, prog);
+    exit(EXIT_FAILURE);
+}
+
+int main(int argc, char ** argv)
+{
+    const char * path = NULL;
+    int iterations = 1000;
+    int rounds = 20000;
+    int status;
+
+    if (argc < 2)
+    {
+        Usage(argv[0]);
+    }
+    for (int i = 2; i < argc; i++)
+    {
+        const char * opt = argv[i];
+        if (opt[0] != '-')
+        {
+            if (path != NULL)
+            {
+                Usage(argv[0]);
+            }
+            path = opt;
+            continue;
+        }
+        if (i + 1 >= argc)
+        {
+            Usage(argv[0]);
+        }
+        const char * val = argv[++i];
+        if (strcmp(opt, "--iterations") == 0)
+        {
+            iterations = ParseU32(val);
+        }
+        else if (strcmp(opt, "--rounds") == 0)
+        {
+            rounds = ParseU32(val);
+        }
+        else
+        {
+            Usage(argv[0]);
+        }
+    }
+    LoadVarNames();
+
+    if (strcmp(argv[1], "selftest") == 0)
+    {
+        status = SelfTest(iterations);
+        if (CheckProfile() != EXIT_SUCCESS)
+        {
+            status = EXIT_FAILURE;
+        }
+    }
+    else if (strcmp(argv[1], "bench") == 0)
+    {
+        status = CommandBench(path, rounds);
+    }
+    else if (strcmp(argv[1], "stats") == 0)
+    {
+        if (path == NULL)
+        {
+            Usage(argv[0]);
+        }
+        status = CommandStats(path);
+    }
+    else
+    {
+        Usage(argv[0]);
+    }
+    return status;
+}
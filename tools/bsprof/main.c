@@ -0,0 +1,862 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <inttypes.h>
+#include "profile.h"
+
+#define SLOT_UNKNOWN 0xFFFE // a caller that left the ring before the dump
+
+// The same limits as include/battle_script_profile.h
+#define GAME_NUM_SLOTS 512
+#define GAME_LOG_SIZE  512
+
+typedef struct Options
+{
+    const char * path;
+    int top;
+    bool byCount;
+    uint32_t events;
+    uint32_t seed;
+} Options;
+
+static uint32_t ParseU32(const char * arg)
+{
+    char * end;
+    unsigned long long val = strtoull(arg, &end, 0);
+    if (*arg == '\0' || *end != '\0' || val > 0xFFFFFFFFull)
+    {
+        fatal_error("invalid number: %s", arg);
+    }
+    return (uint32_t)val;
+}
+
+static uint32_t Random(uint32_t * state)
+{
+    // xorshift32
+    uint32_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return *state = x;
+}
+
+static void SlotName(const Profile * prof, const GameScripts * scripts, uint16_t slot, char * buf, size_t size)
+{
+    if (slot == SLOT_UNKNOWN)
+    {
+        snprintf(buf, size, "?");
+    }
+    else if (slot >= prof->numSlots || prof->slots[slot].narcId == 0xFFFF)
+    {
+        snprintf(buf, size, "(untracked)");
+    }
+    else
+    {
+        GameScripts_ScriptName(scripts, prof->slots[slot].narcId, prof->slots[slot].fileId, buf, size);
+    }
+}
+
+static GameScripts * LoadScripts(GameScripts * scripts, bool required)
+{
+    const char * root = GameScripts_FindRoot();
+    if (root == NULL)
+    {
+        if (required)
+        {
+            fatal_error("run from inside the repository: %s not found", COMMAND_TABLE_PATH);
+        }
+        fprintf(stderr, "warning: %s not found, commands and scripts will not be named\n", COMMAND_TABLE_PATH);
+        return NULL;
+    }
+    GameScripts_Load(scripts, root);
+    return scripts;
+}
+
+static void LoadProfile(const char * path, Profile * prof)
+{
+    size_t size;
+    uint8_t * buf = ReadWholeFile(path, &size);
+    long offset = Profile_Find(buf, size, prof);
+    if (offset < 0)
+    {
+        fatal_error("%s: no battle script profile (version %d) found", path, PROFILE_VERSION);
+    }
+    if (offset != 0)
+    {
+        fprintf(stderr, "%s: profile found at offset 0x%lx\n", path, offset);
+    }
+    free(buf);
+}
+
+// ---------------------------------------------------------------------------
+// Walking the log
+
+// stack[0..depth-1] are the callers of the event's own script
+typedef void (*WalkFunc)(const Profile * prof, const ProfileEvent * event, const uint16_t * stack, void * arg);
+
+static void WalkLog(const Profile * prof, WalkFunc func, void * arg)
+{
+    uint16_t stack[PROFILE_MAX_DEPTH];
+
+    for (int i = 0; i < PROFILE_MAX_DEPTH; i++)
+    {
+        stack[i] = SLOT_UNKNOWN;
+    }
+    for (int i = 0; i < prof->numLog; i++)
+    {
+        const ProfileEvent * event = &prof->log[i];
+        if (event->depth >= PROFILE_MAX_DEPTH)
+        {
+            continue;
+        }
+        if (event->kind == EVENT_COMMAND)
+        {
+            func(prof, event, stack, arg);
+        }
+        else
+        {
+            // A jump replaces the script at its depth, a call or a return
+            // makes its script the innermost
+            stack[event->depth] = event->slot;
+            for (int j = event->depth + 1; j < PROFILE_MAX_DEPTH; j++)
+            {
+                stack[j] = SLOT_UNKNOWN;
+            }
+        }
+    }
+}
+
+// ---------------------------------------------------------------------------
+// folded
+
+typedef struct FoldedLine
+{
+    char * stack;
+    uint64_t weight;
+} FoldedLine;
+
+typedef struct Folded
+{
+    const GameScripts * scripts;
+    bool byCount;
+    FoldedLine * lines;
+    size_t count;
+    size_t capacity;
+} Folded;
+
+static void FoldEvent(const Profile * prof, const ProfileEvent * event, const uint16_t * stack, void * arg)
+{
+    Folded * folded = arg;
+    char line[1024];
+    size_t len = 0;
+
+    line[0] = '\0';
+    for (int i = 0; i <= event->depth; i++)
+    {
+        char name[128];
+        SlotName(prof, folded->scripts, i < event->depth ? stack[i] : event->slot, name, sizeof(name));
+        len += snprintf(line + len, sizeof(line) - len, "%s;", name);
+    }
+    snprintf(line + len, sizeof(line) - len, "%s", GameScripts_CmdName(folded->scripts, event->cmd));
+
+    if (folded->count == folded->capacity)
+    {
+        folded->capacity = folded->capacity ? folded->capacity * 2 : 1024;
+        folded->lines = realloc(folded->lines, folded->capacity * sizeof(FoldedLine));
+        if (folded->lines == NULL)
+        {
+            fatal_error("out of memory");
+        }
+    }
+    folded->lines[folded->count].stack = strdup(line);
+    folded->lines[folded->count].weight = folded->byCount ? 1 : (uint64_t)event->ticks * CYCLES_PER_TICK;
+    folded->count++;
+}
+
+static int CompareFoldedLines(const void * a, const void * b)
+{
+    return strcmp(((const FoldedLine *)a)->stack, ((const FoldedLine *)b)->stack);
+}
+
+// Collapses the log into one line per distinct stack, sorted
+static void Fold(const Profile * prof, const GameScripts * scripts, bool byCount, Folded * folded)
+{
+    size_t n = 0;
+
+    memset(folded, 0, sizeof(*folded));
+    folded->scripts = scripts;
+    folded->byCount = byCount;
+    WalkLog(prof, FoldEvent, folded);
+    qsort(folded->lines, folded->count, sizeof(FoldedLine), CompareFoldedLines);
+    for (size_t i = 0; i < folded->count; i++)
+    {
+        if (n > 0 && strcmp(folded->lines[n - 1].stack, folded->lines[i].stack) == 0)
+        {
+            folded->lines[n - 1].weight += folded->lines[i].weight;
+            free(folded->lines[i].stack);
+        }
+        else
+        {
+            folded->lines[n++] = folded->lines[i];
+        }
+    }
+    folded->count = n;
+}
+
+static void Folded_Free(Folded * folded)
+{
+    for (size_t i = 0; i < folded->count; i++)
+    {
+        free(folded->lines[i].stack);
+    }
+    free(folded->lines);
+}
+
+static int CommandFolded(const Options * opts)
+{
+    Profile prof;
+    GameScripts scripts;
+    GameScripts * names = LoadScripts(&scripts, false);
+    Folded folded;
+
+    LoadProfile(opts->path, &prof);
+    Fold(&prof, names, opts->byCount, &folded);
+    for (size_t i = 0; i < folded.count; i++)
+    {
+        // Commands under the 64-cycle tick resolution come out as 0, which
+        // flame graph tools drop
+        if (folded.lines[i].weight != 0)
+        {
+            printf("%s %" PRIu64 "\n", folded.lines[i].stack, folded.lines[i].weight);
+        }
+    }
+    Folded_Free(&folded);
+    Profile_Free(&prof);
+    if (names != NULL)
+    {
+        GameScripts_Free(names);
+    }
+    return EXIT_SUCCESS;
+}
+
+// ---------------------------------------------------------------------------
+// report
+
+typedef struct RankEntry
+{
+    int id;
+    uint64_t key;
+} RankEntry;
+
+static int CompareRankEntries(const void * a, const void * b)
+{
+    const RankEntry * ra = a;
+    const RankEntry * rb = b;
+    if (ra->key != rb->key)
+    {
+        return ra->key < rb->key ? 1 : -1;
+    }
+    return ra->id - rb->id;
+}
+
+static int CommandReport(const Options * opts)
+{
+    Profile prof;
+    GameScripts scripts;
+    GameScripts * names = LoadScripts(&scripts, false);
+    uint64_t totalCount = 0;
+    uint64_t totalTicks = 0;
+    RankEntry * ranks;
+    int n;
+
+    LoadProfile(opts->path, &prof);
+    for (int i = 0; i < prof.numCmds; i++)
+    {
+        totalCount += prof.cmdCounts[i];
+        totalTicks += prof.cmdTicks[i];
+    }
+    printf("%" PRIu64 " commands, ~%" PRIu64 " cycles; %u scripts tracked; %u events logged, last %d kept\n\n",
+        totalCount, totalTicks * CYCLES_PER_TICK, prof.numSlotsUsed, prof.numEvents, prof.numLog);
+
+    ranks = calloc(prof.numCmds > prof.numSlots ? prof.numCmds : prof.numSlots, sizeof(RankEntry));
+    if (ranks == NULL)
+    {
+        fatal_error("out of memory");
+    }
+
+    n = 0;
+    for (int i = 0; i < prof.numCmds; i++)
+    {
+        if (prof.cmdCounts[i] != 0)
+        {
+            ranks[n].id = i;
+            ranks[n].key = opts->byCount ? prof.cmdCounts[i] : ((uint64_t)prof.cmdTicks[i] << 32) | prof.cmdCounts[i];
+            n++;
+        }
+    }
+    qsort(ranks, n, sizeof(RankEntry), CompareRankEntries);
+    printf("%-32s %10s %14s %10s %6s\n", "command", "count", "cycles", "avg", "%");
+    for (int i = 0; i < n && i < opts->top; i++)
+    {
+        int cmd = ranks[i].id;
+        uint64_t cycles = (uint64_t)prof.cmdTicks[cmd] * CYCLES_PER_TICK;
+        printf("%-32s %10u %14" PRIu64 " %10.0f %6.2f\n", GameScripts_CmdName(names, cmd), prof.cmdCounts[cmd], cycles,
+            (double)cycles / prof.cmdCounts[cmd], totalTicks ? 100.0 * prof.cmdTicks[cmd] / totalTicks : 0.0);
+    }
+
+    n = 0;
+    for (int i = 0; i < prof.numSlots; i++)
+    {
+        if (prof.slots[i].narcId != 0xFFFF)
+        {
+            ranks[n].id = i;
+            ranks[n].key = opts->byCount ? prof.slots[i].entries : ((uint64_t)prof.slots[i].ticks << 32) | prof.slots[i].entries;
+            n++;
+        }
+    }
+    qsort(ranks, n, sizeof(RankEntry), CompareRankEntries);
+    printf("\n%-32s %10s %14s %10s %6s\n", "script (self)", "entries", "cycles", "avg", "%");
+    for (int i = 0; i < n && i < opts->top; i++)
+    {
+        const ProfileSlot * slot = &prof.slots[ranks[i].id];
+        char name[128];
+        uint64_t cycles = (uint64_t)slot->ticks * CYCLES_PER_TICK;
+        SlotName(&prof, names, ranks[i].id, name, sizeof(name));
+        printf("%-32s %10u %14" PRIu64 " %10.0f %6.2f\n", name, slot->entries, cycles,
+            slot->entries ? (double)cycles / slot->entries : 0.0, totalTicks ? 100.0 * slot->ticks / totalTicks : 0.0);
+    }
+
+    free(ranks);
+    Profile_Free(&prof);
+    if (names != NULL)
+    {
+        GameScripts_Free(names);
+    }
+    return EXIT_SUCCESS;
+}
+
+// ---------------------------------------------------------------------------
+// replay
+
+typedef struct ReplaySite
+{
+    uint16_t slot;
+    uint16_t seqNo;
+    uint8_t cmd;
+    uint32_t count;
+    uint64_t ticks;
+} ReplaySite;
+
+typedef struct Replay
+{
+    const GameScripts * scripts;
+    bool verbose;
+    int numCommands;
+    int numChecked;
+    int numMismatched;
+    int numMissing;
+    ReplaySite * sites;
+    int numSites;
+} Replay;
+
+// Steps each logged command over the script it was read from
+static void ReplayEvent(const Profile * prof, const ProfileEvent * event, const uint16_t * stack, void * arg)
+{
+    Replay * replay = arg;
+    int numWords;
+    const uint32_t * words = NULL;
+    ReplaySite * site = NULL;
+
+    replay->numCommands++;
+    if (event->slot < prof->numSlots && prof->slots[event->slot].narcId != 0xFFFF)
+    {
+        words = GameScripts_Script(replay->scripts, prof->slots[event->slot].narcId, prof->slots[event->slot].fileId, &numWords);
+    }
+    if (words == NULL)
+    {
+        replay->numMissing++;
+        return;
+    }
+    replay->numChecked++;
+    if (event->seqNo >= numWords || words[event->seqNo] != event->cmd)
+    {
+        if (replay->verbose && replay->numMismatched < 10)
+        {
+            char name[128];
+            SlotName(prof, replay->scripts, event->slot, name, sizeof(name));
+            printf("mismatch: %s+%u ran %s, the script has %s\n", name, event->seqNo, GameScripts_CmdName(replay->scripts, event->cmd),
+                event->seqNo < numWords ? GameScripts_CmdName(replay->scripts, words[event->seqNo]) : "(past the end)");
+        }
+        replay->numMismatched++;
+        return;
+    }
+    for (int i = 0; i < replay->numSites; i++)
+    {
+        if (replay->sites[i].slot == event->slot && replay->sites[i].seqNo == event->seqNo)
+        {
+            site = &replay->sites[i];
+            break;
+        }
+    }
+    if (site == NULL)
+    {
+        site = &replay->sites[replay->numSites++];
+        site->slot = event->slot;
+        site->seqNo = event->seqNo;
+        site->cmd = event->cmd;
+    }
+    site->count++;
+    site->ticks += event->ticks;
+}
+
+static int CompareSites(const void * a, const void * b)
+{
+    const ReplaySite * sa = a;
+    const ReplaySite * sb = b;
+    if (sa->ticks != sb->ticks)
+    {
+        return sa->ticks < sb->ticks ? 1 : -1;
+    }
+    if (sa->count != sb->count)
+    {
+        return sa->count < sb->count ? 1 : -1;
+    }
+    return sa->slot != sb->slot ? sa->slot - sb->slot : sa->seqNo - sb->seqNo;
+}
+
+static void RunReplay(const Profile * prof, const GameScripts * scripts, bool verbose, Replay * replay)
+{
+    memset(replay, 0, sizeof(*replay));
+    replay->scripts = scripts;
+    replay->verbose = verbose;
+    replay->sites = calloc(prof->numLog > 0 ? prof->numLog : 1, sizeof(ReplaySite));
+    if (replay->sites == NULL)
+    {
+        fatal_error("out of memory");
+    }
+    WalkLog(prof, ReplayEvent, replay);
+    qsort(replay->sites, replay->numSites, sizeof(ReplaySite), CompareSites);
+}
+
+static int CommandReplay(const Options * opts)
+{
+    Profile prof;
+    GameScripts scripts;
+    Replay replay;
+
+    LoadScripts(&scripts, true);
+    LoadProfile(opts->path, &prof);
+    RunReplay(&prof, &scripts, true, &replay);
+
+    printf("%d commands replayed: %d on the script bytes, %d mismatched, %d in scripts outside the tree\n\n",
+        replay.numCommands, replay.numChecked - replay.numMismatched, replay.numMismatched, replay.numMissing);
+    printf("%-40s %-28s %8s %12s\n", "site", "command", "count", "cycles");
+    for (int i = 0; i < replay.numSites && i < opts->top; i++)
+    {
+        const ReplaySite * site = &replay.sites[i];
+        char name[128];
+        char where[160];
+        SlotName(&prof, &scripts, site->slot, name, sizeof(name));
+        snprintf(where, sizeof(where), "%s+%u", name, site->seqNo);
+        printf("%-40s %-28s %8u %12" PRIu64 "\n", where, GameScripts_CmdName(&scripts, site->cmd), site->count, site->ticks * CYCLES_PER_TICK);
+    }
+
+    free(replay.sites);
+    Profile_Free(&prof);
+    GameScripts_Free(&scripts);
+    return replay.numMismatched == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+// ---------------------------------------------------------------------------
+// synth
+
+typedef struct SynthFrame
+{
+    int narcId;
+    int fileId;
+    int seqNo;
+} SynthFrame;
+
+// BattleScriptProfile_GetSlot
+static uint16_t Synth_GetSlot(Profile * prof, uint16_t narcId, uint16_t fileId)
+{
+    uint32_t slot = (narcId * 97 + fileId) % prof->numSlots;
+
+    for (int i = 0; i < prof->numSlots; i++)
+    {
+        if (prof->slots[slot].narcId == narcId && prof->slots[slot].fileId == fileId)
+        {
+            return slot;
+        }
+        if (prof->slots[slot].narcId == 0xFFFF)
+        {
+            prof->slots[slot].narcId = narcId;
+            prof->slots[slot].fileId = fileId;
+            prof->numSlotsUsed++;
+            return slot;
+        }
+        slot = (slot + 1) % prof->numSlots;
+    }
+    return PROFILE_SLOT_NONE;
+}
+
+// BattleScriptProfile_Log, keeping the ring in order
+static void Synth_Log(Profile * prof, uint8_t kind, uint8_t cmd, uint8_t depth, uint16_t slot, uint16_t seqNo, uint32_t ticks)
+{
+    ProfileEvent * event;
+
+    if (prof->numLog == prof->logSize)
+    {
+        memmove(prof->log, prof->log + 1, (prof->logSize - 1) * sizeof(ProfileEvent));
+        prof->numLog--;
+    }
+    event = &prof->log[prof->numLog++];
+    event->kind = kind;
+    event->cmd = cmd;
+    event->depth = depth;
+    event->slot = slot;
+    event->seqNo = seqNo;
+    event->ticks = ticks;
+    prof->numEvents++;
+}
+
+static void Synth_Load(Profile * prof, const SynthFrame * frame, int depth, bool returning)
+{
+    prof->curSlot = Synth_GetSlot(prof, frame->narcId, frame->fileId);
+    if (returning)
+    {
+        Synth_Log(prof, EVENT_RETURN, 0, depth, prof->curSlot, frame->seqNo, 0);
+    }
+    else
+    {
+        if (prof->curSlot != PROFILE_SLOT_NONE)
+        {
+            prof->slots[prof->curSlot].entries++;
+        }
+        Synth_Log(prof, EVENT_ENTER, 0, depth, prof->curSlot, 0, 0);
+    }
+}
+
+// A battle only touches a few moves and the subscripts they lead to
+static const int kSynthPoolSizes[NUM_SCRIPT_NARCS] = { 8, 60, 16 };
+
+typedef struct SynthPools
+{
+    int narcId[NUM_SCRIPT_NARCS];
+    int fileIds[NUM_SCRIPT_NARCS][64];
+} SynthPools;
+
+static void Synth_InitPools(const GameScripts * scripts, uint32_t * rng, SynthPools * pools)
+{
+    for (int i = 0; i < NUM_SCRIPT_NARCS; i++)
+    {
+        pools->narcId[i] = scripts->narcs[i].narcId;
+        for (int j = 0; j < kSynthPoolSizes[i]; j++)
+        {
+            pools->fileIds[i][j] = Random(rng) % scripts->narcs[i].numMembers;
+        }
+    }
+}
+
+static void Synth_PickScript(const SynthPools * pools, uint32_t * rng, int narcIndex, SynthFrame * frame)
+{
+    frame->narcId = pools->narcId[narcIndex];
+    frame->fileId = pools->fileIds[narcIndex][Random(rng) % kSynthPoolSizes[narcIndex]];
+    frame->seqNo = 0;
+}
+
+// Builds a profile with the game's own bookkeeping from a walk over the real
+// scripts. The walk only stops on words that hold a valid command number, so
+// the result is shaped like a battle rather than being one.
+static void Synthesize(const GameScripts * scripts, uint32_t numEvents, uint32_t seed, Profile * prof)
+{
+    SynthFrame stack[PROFILE_MAX_DEPTH];
+    int depth = -1;
+    uint32_t rng = seed ? seed : 1;
+    SynthPools pools;
+
+    Synth_InitPools(scripts, &rng, &pools);
+    Profile_Alloc(prof, scripts->numCmds, GAME_NUM_SLOTS, GAME_LOG_SIZE);
+    while (prof->numEvents < numEvents)
+    {
+        SynthFrame * frame;
+        int numWords;
+        const uint32_t * words;
+
+        if (depth < 0)
+        {
+            // A new action: a move script, or now and then a subscript
+            depth = 0;
+            Synth_PickScript(&pools, &rng, Random(&rng) % 4 == 0 ? 1 : 0, &stack[0]);
+            Synth_Load(prof, &stack[0], 0, false);
+        }
+        frame = &stack[depth];
+        words = GameScripts_Script(scripts, frame->narcId, frame->fileId, &numWords);
+        while (frame->seqNo < numWords && words[frame->seqNo] >= (uint32_t)scripts->numCmds)
+        {
+            frame->seqNo++;
+        }
+        if (frame->seqNo >= numWords)
+        {
+            // EndScript: back to the caller, or on to the next action
+            depth--;
+            if (depth >= 0)
+            {
+                Synth_Load(prof, &stack[depth], depth, true);
+            }
+            continue;
+        }
+
+        int seqNo = frame->seqNo;
+        int cmd = words[seqNo];
+        uint8_t cmdDepth = depth;
+        uint16_t slot = prof->curSlot;
+        uint32_t base = 1 + ((cmd * 2654435761u) >> 28);
+        uint32_t ticks = Random(&rng) % (base + 1) + (Random(&rng) % 64 == 0 ? base * 8 : 0);
+        uint32_t roll = Random(&rng) % 16;
+
+        frame->seqNo += 1 + Random(&rng) % 4;
+        if (roll == 0 && depth + 1 < PROFILE_MAX_DEPTH)
+        {
+            depth++;
+            Synth_PickScript(&pools, &rng, 1, &stack[depth]);
+            Synth_Load(prof, &stack[depth], depth, false);
+        }
+        else if (roll == 1)
+        {
+            Synth_PickScript(&pools, &rng, Random(&rng) % 2 ? 1 : 2, &stack[depth]);
+            Synth_Load(prof, &stack[depth], depth, false);
+        }
+        prof->cmdCounts[cmd]++;
+        prof->cmdTicks[cmd] += ticks;
+        if (slot != PROFILE_SLOT_NONE)
+        {
+            prof->slots[slot].ticks += ticks;
+        }
+        Synth_Log(prof, EVENT_COMMAND, cmd, cmdDepth, slot, seqNo, ticks);
+    }
+}
+
+static int CommandSynth(const Options * opts)
+{
+    Profile prof;
+    GameScripts scripts;
+    size_t size;
+
+    LoadScripts(&scripts, true);
+    Synthesize(&scripts, opts->events, opts->seed, &prof);
+    uint8_t * buf = Profile_Encode(&prof, &size);
+    WriteWholeFile(opts->path, buf, size);
+    printf("%s: %u events over %u scripts\n", opts->path, prof.numEvents, prof.numSlotsUsed);
+    free(buf);
+    Profile_Free(&prof);
+    GameScripts_Free(&scripts);
+    return EXIT_SUCCESS;
+}
+
+// ---------------------------------------------------------------------------
+// selftest
+
+#define CHECK(cond, ...)                      \
+    do                                        \
+    {                                         \
+        numChecks++;                          \
+        if (!(cond))                          \
+        {                                     \
+            printf("FAIL: " __VA_ARGS__);     \
+            printf("\n");                     \
+            numFailed++;                      \
+        }                                     \
+    } while (0)
+
+static int SelfTest(void)
+{
+    GameScripts scripts;
+    Profile prof;
+    Profile decoded;
+    Folded folded;
+    Replay replay;
+    size_t size;
+    int numChecks = 0;
+    int numFailed = 0;
+    uint32_t rng = 0x5EED;
+
+    LoadScripts(&scripts, true);
+    CHECK(scripts.numCmds == 225, "sBattleScriptCommandTable has %d entries, the game header says 225", scripts.numCmds);
+    CHECK(strcmp(GameScripts_CmdName(&scripts, scripts.numCmds - 1), "EndScript") == 0, "the last command is %s", GameScripts_CmdName(&scripts, scripts.numCmds - 1));
+
+    Synthesize(&scripts, 50000, 1, &prof);
+    CHECK(prof.numEvents == 50000 && prof.numLog == GAME_LOG_SIZE, "%u events, %d in the log", prof.numEvents, prof.numLog);
+
+    // Hidden in a RAM dump at an odd word offset
+    uint8_t * encoded = Profile_Encode(&prof, &size);
+    size_t ramSize = 1 << 20;
+    size_t at = 0x1234 * 4;
+    uint8_t * ram = malloc(ramSize);
+    for (size_t i = 0; i < ramSize; i++)
+    {
+        ram[i] = Random(&rng) >> 24;
+    }
+    memcpy(ram + at, encoded, size);
+    long found = Profile_Find(ram, ramSize, &decoded);
+    CHECK(found == (long)at, "found the profile at %ld, it was put at %zu", found, at);
+    if (found >= 0)
+    {
+        CHECK(decoded.numEvents == prof.numEvents && decoded.numLog == prof.numLog && decoded.numSlotsUsed == prof.numSlotsUsed, "the header did not round-trip");
+        CHECK(memcmp(decoded.cmdCounts, prof.cmdCounts, prof.numCmds * sizeof(uint32_t)) == 0
+            && memcmp(decoded.cmdTicks, prof.cmdTicks, prof.numCmds * sizeof(uint32_t)) == 0, "the command counters did not round-trip");
+        CHECK(memcmp(decoded.slots, prof.slots, prof.numSlots * sizeof(ProfileSlot)) == 0, "the script slots did not round-trip");
+        bool sameLog = true;
+        for (int i = 0; i < prof.numLog; i++)
+        {
+            const ProfileEvent * a = &prof.log[i];
+            const ProfileEvent * b = &decoded.log[i];
+            sameLog &= a->kind == b->kind && a->cmd == b->cmd && a->depth == b->depth && a->slot == b->slot && a->seqNo == b->seqNo && a->ticks == b->ticks;
+        }
+        CHECK(sameLog, "the ring did not unroll oldest first");
+        Profile_Free(&decoded);
+    }
+    CHECK(Profile_Find(ram, at + size - 1, &decoded) < 0, "a profile cut short was accepted");
+    free(ram);
+    free(encoded);
+
+    // Every tick is counted once in the command totals and once in the scripts
+    uint64_t cmdTicks = 0;
+    uint64_t slotTicks = 0;
+    uint64_t logTicks = 0;
+    for (int i = 0; i < prof.numCmds; i++)
+    {
+        cmdTicks += prof.cmdTicks[i];
+    }
+    for (int i = 0; i < prof.numSlots; i++)
+    {
+        slotTicks += prof.slots[i].narcId != 0xFFFF ? prof.slots[i].ticks : 0;
+    }
+    CHECK(cmdTicks == slotTicks, "%" PRIu64 " ticks by command, %" PRIu64 " by script", cmdTicks, slotTicks);
+
+    // The flame graph holds exactly the logged commands
+    Fold(&prof, &scripts, false, &folded);
+    uint64_t foldedCycles = 0;
+    bool leavesNamed = true;
+    for (int i = 0; i < prof.numLog; i++)
+    {
+        logTicks += prof.log[i].kind == EVENT_COMMAND ? prof.log[i].ticks : 0;
+    }
+    for (size_t i = 0; i < folded.count; i++)
+    {
+        const char * leaf = strrchr(folded.lines[i].stack, ';');
+        foldedCycles += folded.lines[i].weight;
+        leavesNamed &= leaf != NULL && strncmp(leaf + 1, "cmd_", 4) != 0;
+    }
+    CHECK(foldedCycles == logTicks * CYCLES_PER_TICK, "the folded stacks hold %" PRIu64 " cycles, the log %" PRIu64, foldedCycles, logTicks * CYCLES_PER_TICK);
+    CHECK(leavesNamed, "a folded stack does not end in a named command");
+    Folded_Free(&folded);
+
+    // The replay lands every logged command on the script word it came from
+    RunReplay(&prof, &scripts, false, &replay);
+    CHECK(replay.numMismatched == 0 && replay.numMissing == 0 && replay.numChecked > 0, "replay: %d checked, %d mismatched, %d missing",
+        replay.numChecked, replay.numMismatched, replay.numMissing);
+    free(replay.sites);
+
+    // And notices when the log doesn't match the scripts
+    for (int i = 0; i < prof.numLog; i++)
+    {
+        if (prof.log[i].kind == EVENT_COMMAND)
+        {
+            prof.log[i].seqNo += 1;
+        }
+    }
+    RunReplay(&prof, &scripts, false, &replay);
+    CHECK(replay.numMismatched > 0, "replay accepted a log shifted off the command words");
+    free(replay.sites);
+
+    Profile_Free(&prof);
+    GameScripts_Free(&scripts);
+    printf("%d/%d checks passed\n", numChecks - numFailed, numChecks);
+    return numFailed == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+static noreturn void Usage(const char * prog)
+{
+    fprintf(stderr,
+        "Usage:\n"
+        "  %s report DUMP [--top N] [--count]    hottest commands and scripts over the battle\n"
+        "  %s folded DUMP [--count]              folded stacks of the logged commands, for flamegraph.pl\n"
+        "  %s replay DUMP [--top N]              step the log over the scripts in the tree, hottest sites\n"
+        "  %s synth OUT [--events N] [--seed S]  write a synthetic profile built from the real scripts\n"
+        "  %s selftest\n"
+        "\n"
+        "DUMP is a RAM dump, or a copy of sBattleScriptProfile, from a build with\n"
+        "OPTIMIZE_BATTLE_SCRIPT_PROFILE. Cycles are OS ticks times %d. --count\n"
+        "weights by command count instead.\n",
+        prog, prog, prog, prog, prog, CYCLES_PER_TICK);
+    exit(EXIT_FAILURE);
+}
+
+int main(int argc, char ** argv)
+{
+    Options opts = { .path = NULL, .top = 30, .byCount = false, .events = 100000, .seed = 1 };
+
+    if (argc < 2)
+    {
+        Usage(argv[0]);
+    }
+    for (int i = 2; i < argc; i++)
+    {
+        const char * opt = argv[i];
+        if (opt[0] != '-')
+        {
+            if (opts.path != NULL)
+            {
+                Usage(argv[0]);
+            }
+            opts.path = opt;
+        }
+        else if (strcmp(opt, "--count") == 0)
+        {
+            opts.byCount = true;
+        }
+        else if (i + 1 < argc && strcmp(opt, "--top") == 0)
+        {
+            opts.top = ParseU32(argv[++i]);
+        }
+        else if (i + 1 < argc && strcmp(opt, "--events") == 0)
+        {
+            opts.events = ParseU32(argv[++i]);
+        }
+        else if (i + 1 < argc && strcmp(opt, "--seed") == 0)
+        {
+            opts.seed = ParseU32(argv[++i]);
+        }
+        else
+        {
+            Usage(argv[0]);
+        }
+    }
+
+    if (strcmp(argv[1], "selftest") == 0)
+    {
+        return SelfTest();
+    }
+    if (opts.path == NULL)
+    {
+        Usage(argv[0]);
+    }
+    if (strcmp(argv[1], "report") == 0)
+    {
+        return CommandReport(&opts);
+    }
+    if (strcmp(argv[1], "folded") == 0)
+    {
+        return CommandFolded(&opts);
+    }
+    if (strcmp(argv[1], "replay") == 0)
+    {
+        return CommandReplay(&opts);
+    }
+    if (strcmp(argv[1], "synth") == 0)
+    {
+        return CommandSynth(&opts);
+    }
+    Usage(argv[0]);
+}
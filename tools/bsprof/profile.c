@@ -0,0 +1,470 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdarg.h>
+#include <ctype.h>
+#include <errno.h>
+#include <unistd.h>
+#include "profile.h"
+
+static const struct
+{
+    int narcId;
+    const char * path;
+    const char * label;
+} kScriptNarcs[NUM_SCRIPT_NARCS] = {
+    { NARC_MOVE_SCRIPTS,   "files/a/0/0/0", "move" },
+    { NARC_SUBSCRIPTS,     "files/a/0/0/1", "subscript" },
+    { NARC_EFFECT_SCRIPTS, "files/a/0/3/0", "effect" },
+};
+
+noreturn void fatal_error(const char * message, ...)
+{
+    va_list va_args;
+    va_start(va_args, message);
+    fputs("Error: ", stderr);
+    vfprintf(stderr, message, va_args);
+    fputc('\n', stderr);
+    va_end(va_args);
+    exit(EXIT_FAILURE);
+}
+
+void * ReadWholeFile(const char * path, size_t * size)
+{
+    FILE * file = fopen(path, "rb");
+    if (file == NULL)
+    {
+        fatal_error("%s: %s", path, strerror(errno));
+    }
+    fseek(file, 0, SEEK_END);
+    long length = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    char * buffer = malloc(length + 1);
+    if (buffer == NULL)
+    {
+        fatal_error("out of memory reading %s", path);
+    }
+    if (fread(buffer, 1, length, file) != (size_t)length)
+    {
+        fatal_error("%s: short read", path);
+    }
+    fclose(file);
+    buffer[length] = '\0';
+    *size = length;
+    return buffer;
+}
+
+void WriteWholeFile(const char * path, const void * data, size_t size)
+{
+    FILE * file = fopen(path, "wb");
+    if (file == NULL)
+    {
+        fatal_error("%s: %s", path, strerror(errno));
+    }
+    if (fwrite(data, 1, size, file) != size || fclose(file) != 0)
+    {
+        fatal_error("%s: write failed", path);
+    }
+}
+
+static uint16_t Read16(const uint8_t * p)
+{
+    return p[0] | (p[1] << 8);
+}
+
+static uint32_t Read32(const uint8_t * p)
+{
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static void Write16(uint8_t * p, uint16_t val)
+{
+    p[0] = val;
+    p[1] = val >> 8;
+}
+
+static void Write32(uint8_t * p, uint32_t val)
+{
+    p[0] = val;
+    p[1] = val >> 8;
+    p[2] = val >> 16;
+    p[3] = val >> 24;
+}
+
+// ---------------------------------------------------------------------------
+// The dump
+
+size_t Profile_Size(int numCmds, int numSlots, int logSize)
+{
+    return PROFILE_HEADER_SIZE + 8 * (size_t)numCmds + PROFILE_SLOT_SIZE * (size_t)numSlots + PROFILE_EVENT_SIZE * (size_t)logSize;
+}
+
+void Profile_Alloc(Profile * prof, int numCmds, int numSlots, int logSize)
+{
+    memset(prof, 0, sizeof(*prof));
+    prof->numCmds = numCmds;
+    prof->numSlots = numSlots;
+    prof->logSize = logSize;
+    prof->curSlot = PROFILE_SLOT_NONE;
+    prof->cmdCounts = calloc(numCmds, sizeof(uint32_t));
+    prof->cmdTicks = calloc(numCmds, sizeof(uint32_t));
+    prof->slots = calloc(numSlots, sizeof(ProfileSlot));
+    prof->log = calloc(logSize, sizeof(ProfileEvent));
+    if (prof->cmdCounts == NULL || prof->cmdTicks == NULL || prof->slots == NULL || prof->log == NULL)
+    {
+        fatal_error("out of memory");
+    }
+    for (int i = 0; i < numSlots; i++)
+    {
+        prof->slots[i].narcId = 0xFFFF;
+    }
+}
+
+void Profile_Free(Profile * prof)
+{
+    free(prof->cmdCounts);
+    free(prof->cmdTicks);
+    free(prof->slots);
+    free(prof->log);
+    memset(prof, 0, sizeof(*prof));
+}
+
+// The header is believable: the right version, and sizes that fit
+static bool Profile_Plausible(const uint8_t * p, size_t avail)
+{
+    if (Read32(p) != PROFILE_MAGIC || Read16(p + 4) != PROFILE_VERSION)
+    {
+        return false;
+    }
+    int numCmds = Read16(p + 6);
+    int numSlots = Read16(p + 8);
+    int logSize = Read16(p + 10);
+    if (numCmds == 0 || numCmds > 256 || numSlots == 0 || logSize == 0 || (logSize & (logSize - 1)) != 0)
+    {
+        return false;
+    }
+    return Profile_Size(numCmds, numSlots, logSize) <= avail && Read32(p + 16) <= (uint32_t)numSlots;
+}
+
+long Profile_Find(const uint8_t * buf, size_t size, Profile * prof)
+{
+    size_t offset;
+
+    for (offset = 0; offset + PROFILE_HEADER_SIZE <= size; offset += 4)
+    {
+        if (Profile_Plausible(buf + offset, size - offset))
+        {
+            break;
+        }
+    }
+    if (offset + PROFILE_HEADER_SIZE > size)
+    {
+        return -1;
+    }
+
+    const uint8_t * p = buf + offset;
+    Profile_Alloc(prof, Read16(p + 6), Read16(p + 8), Read16(p + 10));
+    prof->curSlot = Read16(p + 12);
+    prof->numSlotsUsed = Read32(p + 16);
+    prof->numEvents = Read32(p + 20);
+    p += PROFILE_HEADER_SIZE;
+    for (int i = 0; i < prof->numCmds; i++)
+    {
+        prof->cmdCounts[i] = Read32(p + 4 * i);
+        prof->cmdTicks[i] = Read32(p + 4 * (prof->numCmds + i));
+    }
+    p += 8 * prof->numCmds;
+    for (int i = 0; i < prof->numSlots; i++, p += PROFILE_SLOT_SIZE)
+    {
+        prof->slots[i].narcId = Read16(p);
+        prof->slots[i].fileId = Read16(p + 2);
+        prof->slots[i].entries = Read32(p + 4);
+        prof->slots[i].ticks = Read32(p + 8);
+    }
+
+    // Unroll the ring so that the oldest surviving event comes first
+    uint32_t first = prof->numEvents > prof->logSize ? prof->numEvents % prof->logSize : 0;
+    prof->numLog = prof->numEvents < prof->logSize ? (int)prof->numEvents : prof->logSize;
+    for (int i = 0; i < prof->numLog; i++)
+    {
+        const uint8_t * e = p + PROFILE_EVENT_SIZE * ((first + i) % prof->logSize);
+        ProfileEvent * event = &prof->log[i];
+        event->kind = e[0];
+        event->cmd = e[1];
+        event->depth = e[2];
+        event->slot = Read16(e + 4);
+        event->seqNo = Read16(e + 6);
+        event->ticks = Read32(e + 8);
+    }
+    return (long)offset;
+}
+
+uint8_t * Profile_Encode(const Profile * prof, size_t * size)
+{
+    *size = Profile_Size(prof->numCmds, prof->numSlots, prof->logSize);
+    uint8_t * buf = calloc(1, *size);
+    uint8_t * p = buf;
+
+    if (buf == NULL)
+    {
+        fatal_error("out of memory");
+    }
+    Write32(p, PROFILE_MAGIC);
+    Write16(p + 4, PROFILE_VERSION);
+    Write16(p + 6, prof->numCmds);
+    Write16(p + 8, prof->numSlots);
+    Write16(p + 10, prof->logSize);
+    Write16(p + 12, prof->curSlot);
+    Write32(p + 16, prof->numSlotsUsed);
+    Write32(p + 20, prof->numEvents);
+    p += PROFILE_HEADER_SIZE;
+    for (int i = 0; i < prof->numCmds; i++)
+    {
+        Write32(p + 4 * i, prof->cmdCounts[i]);
+        Write32(p + 4 * (prof->numCmds + i), prof->cmdTicks[i]);
+    }
+    p += 8 * prof->numCmds;
+    for (int i = 0; i < prof->numSlots; i++, p += PROFILE_SLOT_SIZE)
+    {
+        Write16(p, prof->slots[i].narcId);
+        Write16(p + 2, prof->slots[i].fileId);
+        Write32(p + 4, prof->slots[i].entries);
+        Write32(p + 8, prof->slots[i].ticks);
+    }
+    // Put the events back where the game's ring would have them
+    uint32_t first = prof->numEvents > prof->logSize ? prof->numEvents % prof->logSize : 0;
+    for (int i = 0; i < prof->numLog; i++)
+    {
+        uint8_t * e = p + PROFILE_EVENT_SIZE * ((first + i) % prof->logSize);
+        const ProfileEvent * event = &prof->log[i];
+        e[0] = event->kind;
+        e[1] = event->cmd;
+        e[2] = event->depth;
+        Write16(e + 4, event->slot);
+        Write16(e + 6, event->seqNo);
+        Write32(e + 8, event->ticks);
+    }
+    return buf;
+}
+
+// ---------------------------------------------------------------------------
+// Names and scripts
+
+const char * GameScripts_FindRoot(void)
+{
+    static const char * const candidates[] = { ".", "..", "../.." };
+    for (size_t i = 0; i < sizeof(candidates) / sizeof(candidates[0]); i++)
+    {
+        char path[4096];
+        snprintf(path, sizeof(path), "%s/%s", candidates[i], COMMAND_TABLE_PATH);
+        if (access(path, R_OK) == 0)
+        {
+            return candidates[i];
+        }
+    }
+    return NULL;
+}
+
+static char * ReadRootFile(const char * root, const char * relPath, size_t * size)
+{
+    char path[4096];
+    snprintf(path, sizeof(path), "%s/%s", root, relPath);
+    return ReadWholeFile(path, size);
+}
+
+// sBattleScriptCommandTable, in order, with the BtlCmd_ prefix dropped
+static void LoadCommandNames(GameScripts * scripts, const char * root)
+{
+    size_t size;
+    char * text = ReadRootFile(root, COMMAND_TABLE_PATH, &size);
+    char * line = strstr(text, "\nsBattleScriptCommandTable:");
+    int capacity = 256;
+
+    if (line == NULL)
+    {
+        fatal_error("%s: sBattleScriptCommandTable not found", COMMAND_TABLE_PATH);
+    }
+    scripts->cmdNames = calloc(capacity, sizeof(char *));
+    line = strchr(line + 1, '\n');
+    while (line != NULL)
+    {
+        char name[256];
+        line++;
+        if (sscanf(line, " .word %255[A-Za-z0-9_]", name) != 1)
+        {
+            // Blank lines and comments don't end the table; anything else does
+            const char * p = line;
+            while (*p == ' ' || *p == '\t')
+            {
+                p++;
+            }
+            if (*p != '\n' && *p != ';' && *p != '\0')
+            {
+                break;
+            }
+        }
+        else
+        {
+            if (scripts->numCmds == capacity)
+            {
+                capacity *= 2;
+                scripts->cmdNames = realloc(scripts->cmdNames, capacity * sizeof(char *));
+            }
+            const char * shortName = strncmp(name, "BtlCmd_", 7) == 0 ? name + 7 : name;
+            scripts->cmdNames[scripts->numCmds++] = strdup(shortName);
+        }
+        line = strchr(line, '\n');
+    }
+    free(text);
+}
+
+static void LoadMoveNames(GameScripts * scripts, const char * root)
+{
+    size_t size;
+    char * text = ReadRootFile(root, MOVES_HEADER_PATH, &size);
+    int capacity = 1024;
+
+    scripts->moveNames = calloc(capacity, sizeof(char *));
+    for (char * line = text; line != NULL && *line != '\0'; line = strchr(line, '\n'), line = line ? line + 1 : NULL)
+    {
+        char name[256];
+        int value;
+        if (sscanf(line, "#define MOVE_%255s %i", name, &value) == 2 && value >= 0 && value < capacity)
+        {
+            if (scripts->moveNames[value] == NULL)
+            {
+                scripts->moveNames[value] = strdup(name);
+            }
+            if (value >= scripts->numMoves)
+            {
+                scripts->numMoves = value + 1;
+            }
+        }
+    }
+    free(text);
+}
+
+// NARC: header, then BTAF (start/end per member), BTNF, GMIF (member data)
+static void LoadScriptNarc(ScriptNarc * narc, int narcId, const char * root, const char * relPath)
+{
+    size_t size;
+    const uint8_t * buf = (const uint8_t *)ReadRootFile(root, relPath, &size);
+
+    narc->narcId = narcId;
+    if (size < 16 || memcmp(buf, "NARC", 4) != 0)
+    {
+        fatal_error("%s: not a NARC", relPath);
+    }
+    const uint8_t * fat = buf + Read16(buf + 12);
+    if (fat + 12 > buf + size || memcmp(fat, "BTAF", 4) != 0)
+    {
+        fatal_error("%s: no BTAF", relPath);
+    }
+    const uint8_t * fnt = fat + Read32(fat + 4);
+    if (fnt + 8 > buf + size || memcmp(fnt, "BTNF", 4) != 0)
+    {
+        fatal_error("%s: no BTNF", relPath);
+    }
+    const uint8_t * img = fnt + Read32(fnt + 4);
+    if (img + 8 > buf + size || memcmp(img, "GMIF", 4) != 0)
+    {
+        fatal_error("%s: no GMIF", relPath);
+    }
+    narc->numMembers = Read16(fat + 8);
+    narc->offsets = calloc(narc->numMembers + 1, sizeof(uint32_t));
+    narc->words = calloc((buf + size - img) / 4 + 1, sizeof(uint32_t));
+    uint32_t numWords = 0;
+    for (int i = 0; i < narc->numMembers; i++)
+    {
+        uint32_t start = Read32(fat + 12 + 8 * i);
+        uint32_t end = Read32(fat + 16 + 8 * i);
+        if (end < start || img + 8 + end > buf + size)
+        {
+            fatal_error("%s: bad member %d", relPath, i);
+        }
+        narc->offsets[i] = numWords;
+        for (uint32_t off = start; off + 4 <= end; off += 4)
+        {
+            narc->words[numWords++] = Read32(img + 8 + off);
+        }
+    }
+    narc->offsets[narc->numMembers] = numWords;
+    free((void *)buf);
+}
+
+void GameScripts_Load(GameScripts * scripts, const char * root)
+{
+    memset(scripts, 0, sizeof(*scripts));
+    LoadCommandNames(scripts, root);
+    LoadMoveNames(scripts, root);
+    for (int i = 0; i < NUM_SCRIPT_NARCS; i++)
+    {
+        LoadScriptNarc(&scripts->narcs[i], kScriptNarcs[i].narcId, root, kScriptNarcs[i].path);
+    }
+}
+
+void GameScripts_Free(GameScripts * scripts)
+{
+    for (int i = 0; i < scripts->numCmds; i++)
+    {
+        free(scripts->cmdNames[i]);
+    }
+    for (int i = 0; i < scripts->numMoves; i++)
+    {
+        free(scripts->moveNames[i]);
+    }
+    free(scripts->cmdNames);
+    free(scripts->moveNames);
+    for (int i = 0; i < NUM_SCRIPT_NARCS; i++)
+    {
+        free(scripts->narcs[i].offsets);
+        free(scripts->narcs[i].words);
+    }
+    memset(scripts, 0, sizeof(*scripts));
+}
+
+const char * GameScripts_CmdName(const GameScripts * scripts, int cmd)
+{
+    static char buf[32];
+    if (scripts != NULL && cmd >= 0 && cmd < scripts->numCmds)
+    {
+        return scripts->cmdNames[cmd];
+    }
+    snprintf(buf, sizeof(buf), "cmd_%d", cmd);
+    return buf;
+}
+
+void GameScripts_ScriptName(const GameScripts * scripts, int narcId, int fileId, char * buf, size_t size)
+{
+    for (int i = 0; i < NUM_SCRIPT_NARCS; i++)
+    {
+        if (kScriptNarcs[i].narcId != narcId)
+        {
+            continue;
+        }
+        if (narcId == NARC_MOVE_SCRIPTS && scripts != NULL && fileId < scripts->numMoves && scripts->moveNames[fileId] != NULL)
+        {
+            snprintf(buf, size, "%s:%s", kScriptNarcs[i].label, scripts->moveNames[fileId]);
+        }
+        else
+        {
+            snprintf(buf, size, "%s:%d", kScriptNarcs[i].label, fileId);
+        }
+        return;
+    }
+    snprintf(buf, size, "narc%d:%d", narcId, fileId);
+}
+
+const uint32_t * GameScripts_Script(const GameScripts * scripts, int narcId, int fileId, int * numWords)
+{
+    for (int i = 0; i < NUM_SCRIPT_NARCS; i++)
+    {
+        const ScriptNarc * narc = &scripts->narcs[i];
+        if (narc->narcId == narcId && fileId >= 0 && fileId < narc->numMembers)
+        {
+            *numWords = narc->offsets[fileId + 1] - narc->offsets[fileId];
+            return narc->words + narc->offsets[fileId];
+        }
+    }
+    return NULL;
+}
@@ -0,0 +1,111 @@
+#ifndef GUARD_BSPROF_PROFILE_H
+#define GUARD_BSPROF_PROFILE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdnoreturn.h>
+
+// struct BattleScriptProfile (include/battle_script_profile.h), as the ARM9
+// lays it out. Counts are read from the header, so only the fixed part and
+// the element sizes need to stay in step with the game.
+#define PROFILE_MAGIC           0x46505342 // "BSPF"
+#define PROFILE_VERSION         1
+#define PROFILE_HEADER_SIZE     24
+#define PROFILE_SLOT_SIZE       12
+#define PROFILE_EVENT_SIZE      12
+#define PROFILE_SLOT_NONE       0xFFFF
+#define PROFILE_MAX_DEPTH       5 // ctx->unk_B8 goes up to 4
+
+#define EVENT_COMMAND           0
+#define EVENT_ENTER             1
+#define EVENT_RETURN            2
+
+#define CYCLES_PER_TICK         64 // OS ticks run at the ARM9 clock / 64
+
+// Where the script tables are read from, relative to the repository root
+#define COMMAND_TABLE_PATH      "asm/overlay_12_battle_command.s"
+#define MOVES_HEADER_PATH       "include/constants/moves.h"
+
+// The NARCs ReadBattleScriptFromNarc is called with
+#define NARC_MOVE_SCRIPTS       0  // NARC_a_0_0_0, one per move
+#define NARC_SUBSCRIPTS         1  // NARC_a_0_0_1
+#define NARC_EFFECT_SCRIPTS     30 // NARC_a_0_3_0, one per move effect
+#define NUM_SCRIPT_NARCS        3
+
+typedef struct ProfileSlot
+{
+    uint16_t narcId;
+    uint16_t fileId;
+    uint32_t entries;
+    uint32_t ticks;
+} ProfileSlot;
+
+typedef struct ProfileEvent
+{
+    uint8_t kind;
+    uint8_t cmd;
+    uint8_t depth;
+    uint16_t slot;
+    uint16_t seqNo;
+    uint32_t ticks;
+} ProfileEvent;
+
+typedef struct Profile
+{
+    uint16_t numCmds;
+    uint16_t numSlots;
+    uint16_t logSize;
+    uint16_t curSlot;
+    uint32_t numSlotsUsed;
+    uint32_t numEvents;
+    uint32_t * cmdCounts;
+    uint32_t * cmdTicks;
+    ProfileSlot * slots;
+    ProfileEvent * log; // the ring, oldest event first
+    int numLog;
+} Profile;
+
+// A battle script NARC, as little-endian words per member
+typedef struct ScriptNarc
+{
+    int narcId;
+    int numMembers;
+    uint32_t * offsets; // numMembers + 1 word offsets into words
+    uint32_t * words;
+} ScriptNarc;
+
+// Names and scripts from the tree, for labelling and replay
+typedef struct GameScripts
+{
+    int numCmds;
+    char ** cmdNames;
+    int numMoves;
+    char ** moveNames;
+    ScriptNarc narcs[NUM_SCRIPT_NARCS];
+} GameScripts;
+
+noreturn void fatal_error(const char * message, ...) __attribute__((format(printf, 1, 2)));
+
+void * ReadWholeFile(const char * path, size_t * size);
+void WriteWholeFile(const char * path, const void * data, size_t size);
+
+size_t Profile_Size(int numCmds, int numSlots, int logSize);
+// Finds the profile in a raw copy of it or in a whole RAM dump. Returns the
+// offset it was found at, or -1.
+long Profile_Find(const uint8_t * buf, size_t size, Profile * prof);
+// The inverse, for dumps made on the host
+uint8_t * Profile_Encode(const Profile * prof, size_t * size);
+void Profile_Alloc(Profile * prof, int numCmds, int numSlots, int logSize);
+void Profile_Free(Profile * prof);
+
+const char * GameScripts_FindRoot(void);
+void GameScripts_Load(GameScripts * scripts, const char * root);
+void GameScripts_Free(GameScripts * scripts);
+const char * GameScripts_CmdName(const GameScripts * scripts, int cmd);
+// "move:TACKLE", "subscript:281", "effect:12"
+void GameScripts_ScriptName(const GameScripts * scripts, int narcId, int fileId, char * buf, size_t size);
+// The words of one script, or NULL if it isn't in the tree
+const uint32_t * GameScripts_Script(const GameScripts * scripts, int narcId, int fileId, int * numWords);
+
+#endif //GUARD_BSPROF_PROFILE_H
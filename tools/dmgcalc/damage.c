@@ -0,0 +1,1049 @@
+#include <string.h>
+#include <limits.h>
+#include "damage.h"
+#include "constants/pokemon.h"
+#include "constants/abilities.h"
+#include "constants/items.h"
+#include "constants/moves.h"
+#include "constants/species.h"
+#include "constants/battle.h"
+
+// Every weather but sun, for Solar Beam
+#define FIELD_CONDITION_NO_SUN      (FIELD_CONDITION_WEATHER & ~FIELD_CONDITION_SUN_ALL)
+
+// _s32_div_f. Division by zero can't happen with legal stats; the host
+// returns 0 rather than trapping.
+static inline int Div(int a, int b)
+{
+    if (b == 0)
+    {
+        return 0;
+    }
+    if (a == INT_MIN && b == -1)
+    {
+        return INT_MIN;
+    }
+    return a / b;
+}
+
+// ARM multiplies wrap
+static inline int Mul(int a, int b)
+{
+    return (int)((uint32_t)a * (uint32_t)b);
+}
+
+static inline int BattleSys_GetFieldSide(int battlerId)
+{
+    return battlerId & 1;
+}
+
+static inline int BattleSys_GetMaxBattlers(const DamageContext * ctx)
+{
+    return (ctx->battleType & BATTLE_TYPE_DOUBLES) ? 4 : 2;
+}
+
+void DamageContext_Init(DamageContext * ctx, const GameData * data)
+{
+    memset(ctx, 0, sizeof(*ctx));
+    ctx->data = data;
+    ctx->powerModifier = 10;
+    for (int i = 0; i < MAX_BATTLERS; i++)
+    {
+        for (int j = 0; j < 8; j++)
+        {
+            ctx->battleMons[i].statChanges[j] = STAT_STAGE_NEUTRAL;
+        }
+    }
+}
+
+uint32_t GetBattlerAbility(const DamageContext * ctx, int battlerId)
+{
+    const DamageMon * mon = &ctx->battleMons[battlerId];
+    if ((mon->moveEffectFlags & MOVE_EFFECT_GASTRO_ACID) && mon->ability != ABILITY_MULTITYPE)
+    {
+        return ABILITY_NONE;
+    }
+    if ((ctx->fieldCondition & FIELD_CONDITION_GRAVITY) && mon->ability == ABILITY_LEVITATE)
+    {
+        return ABILITY_NONE;
+    }
+    if ((mon->moveEffectFlags & MOVE_EFFECT_INGRAIN) && mon->ability == ABILITY_LEVITATE)
+    {
+        return ABILITY_NONE;
+    }
+    return mon->ability;
+}
+
+uint16_t GetBattlerHeldItem(const DamageContext * ctx, int battlerId)
+{
+    if (GetBattlerAbility(ctx, battlerId) == ABILITY_KLUTZ)
+    {
+        return ITEM_NONE;
+    }
+    if (ctx->battleMons[battlerId].embargoTurns)
+    {
+        return ITEM_NONE;
+    }
+    return ctx->battleMons[battlerId].item;
+}
+
+uint32_t GetItemHoldEffect(const DamageContext * ctx, int item, uint32_t attr)
+{
+    if (item < 0 || item >= ctx->data->numItems)
+    {
+        return 0;
+    }
+    return attr == ITEMATTR_HOLD_EFFECT ? ctx->data->items[item].holdEffect : ctx->data->items[item].holdEffectParam;
+}
+
+uint32_t GetBattlerHeldItemEffect(const DamageContext * ctx, int battlerId)
+{
+    return GetItemHoldEffect(ctx, GetBattlerHeldItem(ctx, battlerId), ITEMATTR_HOLD_EFFECT);
+}
+
+int BattleSystem_GetHeldItemDamageBoost(const DamageContext * ctx, int battlerId, int a2)
+{
+    int item;
+    switch (a2)
+    {
+    case 0:
+        item = GetBattlerHeldItem(ctx, battlerId);
+        break;
+    case 2:
+        if (ctx->battleMons[battlerId].embargoTurns)
+        {
+            return 0;
+        }
+        // fallthrough
+    case 1:
+        item = ctx->battleMons[battlerId].item;
+        break;
+    default:
+        item = a2;
+        break;
+    }
+    return GetItemHoldEffect(ctx, item, ITEMATTR_HOLD_EFFECT_PARAM);
+}
+
+bool CheckBattlerAbilityIfNotIgnored(const DamageContext * ctx, int battlerIdAttacker, int battlerIdTarget, uint32_t ability)
+{
+    // With Mold Breaker the game also raises a one-time message flag here
+    if (GetBattlerAbility(ctx, battlerIdAttacker) == ABILITY_MOLD_BREAKER)
+    {
+        return false;
+    }
+    return GetBattlerAbility(ctx, battlerIdTarget) == ability;
+}
+
+// Only the modes CalcMoveDamage uses: 1 counts live battlers on a3's side, 8
+// live battlers anywhere
+int CheckAbilityActive(const DamageContext * ctx, int a2, int a3, int ability)
+{
+    int maxBattlers = BattleSys_GetMaxBattlers(ctx);
+    int count = 0;
+    for (int i = 0; i < maxBattlers; i++)
+    {
+        if (a2 == 1 && BattleSys_GetFieldSide(i) != BattleSys_GetFieldSide(a3))
+        {
+            continue;
+        }
+        if (ctx->battleMons[i].hp != 0 && GetBattlerAbility(ctx, i) == (uint32_t)ability)
+        {
+            count++;
+        }
+    }
+    return count;
+}
+
+int GetMonsHitCount(const DamageContext * ctx, int a2, int battlerId)
+{
+    int maxBattlers = BattleSys_GetMaxBattlers(ctx);
+    int count = 0;
+    for (int i = 0; i < maxBattlers; i++)
+    {
+        if (a2 == 0 && i == battlerId)
+        {
+            continue;
+        }
+        if (a2 == 1 && BattleSys_GetFieldSide(i) != BattleSys_GetFieldSide(battlerId))
+        {
+            continue;
+        }
+        if (ctx->battleMons[i].hp != 0)
+        {
+            count++;
+        }
+    }
+    return count;
+}
+
+// ov12_02252CE8
+static bool AnyBattlerHasMoveEffect(const DamageContext * ctx, uint32_t flag)
+{
+    int maxBattlers = BattleSys_GetMaxBattlers(ctx);
+    for (int i = 0; i < maxBattlers; i++)
+    {
+        if (ctx->battleMons[i].moveEffectFlags & flag)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+int DamageDivide(int damage, int denom)
+{
+    if (damage == 0)
+    {
+        return 0;
+    }
+    int min = damage > 0 ? 1 : -1;
+    damage = Div(damage, denom);
+    return damage == 0 ? min : damage;
+}
+
+static bool WeatherActive(const DamageContext * ctx)
+{
+    return !CheckAbilityActive(ctx, 8, 0, ABILITY_CLOUD_NINE) && !CheckAbilityActive(ctx, 8, 0, ABILITY_AIR_LOCK);
+}
+
+// Applies a stat stage, numerator then denominator from sStatChangeTable
+static inline int ApplyStatStage(const GameData * data, int stat, int stage)
+{
+    return Div(Mul(data->statStageRatio[stage][0], stat), data->statStageRatio[stage][1]);
+}
+
+static inline uint16_t Scale16(uint16_t value, int num, int den)
+{
+    return (uint16_t)Div(Mul(num, value), den);
+}
+
+// CalcMoveDamage (0x02256FF8). Every u16 truncation and the order of
+// multiplications and divisions follow the asm.
+int CalcMoveDamage(const DamageContext * ctx, uint32_t moveNo, uint32_t sideCondition, uint32_t fieldCondition, uint16_t movePower, uint8_t moveType, uint8_t battlerIdAttacker, uint8_t battlerIdTarget, uint8_t criticalMultiplier)
+{
+    const GameData * data = ctx->data;
+    const DamageMon * attacker = &ctx->battleMons[battlerIdAttacker];
+    const DamageMon * target = &ctx->battleMons[battlerIdTarget];
+    const MoveTbl * move = &data->moves[moveNo];
+    int damage = 0;
+    int i;
+
+    uint16_t atk = attacker->atk;
+    uint16_t def = target->def;
+    uint16_t spatk = attacker->spatk;
+    uint16_t spdef = target->spdef;
+    int8_t atkStage = (int8_t)(attacker->statChanges[STAT_ATK] - STAT_STAGE_NEUTRAL);
+    int8_t defStage = (int8_t)(target->statChanges[STAT_DEF] - STAT_STAGE_NEUTRAL);
+    int8_t spatkStage = (int8_t)(attacker->statChanges[STAT_SPATK] - STAT_STAGE_NEUTRAL);
+    int8_t spdefStage = (int8_t)(target->statChanges[STAT_SPDEF] - STAT_STAGE_NEUTRAL);
+    uint8_t level = attacker->level;
+    uint16_t atkSpecies = attacker->species;
+    uint16_t defSpecies = target->species;
+    int16_t atkHp = (int16_t)attacker->hp;
+    uint16_t atkMaxHp = (uint16_t)attacker->maxHp;
+    uint32_t atkStatus = attacker->status;
+    uint32_t defStatus = target->status;
+    uint32_t atkAbility = GetBattlerAbility(ctx, battlerIdAttacker);
+    uint8_t atkGender = attacker->gender;
+    uint8_t defGender = target->gender;
+    uint8_t defType1 = target->type1;
+    uint8_t defType2 = target->type2;
+    uint32_t atkItemEffect = GetItemHoldEffect(ctx, GetBattlerHeldItem(ctx, battlerIdAttacker), ITEMATTR_HOLD_EFFECT);
+    uint32_t atkItemParam = GetItemHoldEffect(ctx, GetBattlerHeldItem(ctx, battlerIdAttacker), ITEMATTR_HOLD_EFFECT_PARAM);
+    uint32_t defItemEffect = GetItemHoldEffect(ctx, GetBattlerHeldItem(ctx, battlerIdTarget), ITEMATTR_HOLD_EFFECT);
+    uint32_t battleType = ctx->battleType;
+    uint8_t moveClass;
+    uint16_t moveEffect;
+    uint8_t type;
+    uint16_t power = movePower;
+
+    if (criticalMultiplier < 1)
+    {
+        fatal_error("criticalMultiplier must be at least 1");
+    }
+
+    if (power == 0)
+    {
+        power = move->power;
+    }
+    if (atkAbility == ABILITY_NORMALIZE)
+    {
+        type = TYPE_NORMAL;
+    }
+    else if (moveType == 0)
+    {
+        type = move->type;
+    }
+    else
+    {
+        type = moveType & 0x3F;
+    }
+
+    power = (uint16_t)Div(Mul(ctx->powerModifier, power), 10);
+
+    if ((attacker->moveEffectFlags & MOVE_EFFECT_CHARGE) && type == TYPE_ELECTRIC)
+    {
+        power = (uint16_t)(power << 1);
+    }
+    if (attacker->helpingHandFlag)
+    {
+        power = Scale16(power, 15, 10);
+    }
+    if (atkAbility == ABILITY_TECHNICIAN && moveNo != MOVE_STRUGGLE && power <= 60)
+    {
+        power = Scale16(power, 15, 10);
+    }
+
+    moveClass = move->class;
+    if (atkAbility == ABILITY_HUGE_POWER || atkAbility == ABILITY_PURE_POWER)
+    {
+        atk = (uint16_t)(atk << 1);
+    }
+    if (atkAbility == ABILITY_SLOW_START && ctx->totalTurns - attacker->slowStartTurns < 5)
+    {
+        atk = (uint16_t)(atk >> 1);
+    }
+
+    for (i = 0; i < NUM_TYPE_BOOST_ITEMS; i++)
+    {
+        if (atkItemEffect == data->typeBoostItems[i][0] && type == data->typeBoostItems[i][1])
+        {
+            power = (uint16_t)Div(Mul(atkItemParam + 100, power), 100);
+            break;
+        }
+    }
+
+    if (atkItemEffect == HOLD_EFFECT_CHOICE_ATK)
+    {
+        atk = Scale16(atk, 150, 100);
+    }
+    if (atkItemEffect == HOLD_EFFECT_CHOICE_SPATK)
+    {
+        spatk = Scale16(spatk, 150, 100);
+    }
+    if (atkItemEffect == HOLD_EFFECT_LATI_SPECIAL && !(battleType & BATTLE_TYPE_7) && (uint16_t)(atkSpecies - SPECIES_LATIAS) <= 1)
+    {
+        spatk = Scale16(spatk, 150, 100);
+    }
+    if (defItemEffect == HOLD_EFFECT_LATI_SPECIAL && !(battleType & BATTLE_TYPE_7) && (uint16_t)(defSpecies - SPECIES_LATIAS) <= 1)
+    {
+        spdef = Scale16(spdef, 150, 100);
+    }
+    if (atkItemEffect == HOLD_EFFECT_CLAMPERL_SPATK && atkSpecies == SPECIES_CLAMPERL)
+    {
+        spatk = (uint16_t)(spatk << 1);
+    }
+    if (defItemEffect == HOLD_EFFECT_CLAMPERL_SPDEF && defSpecies == SPECIES_CLAMPERL)
+    {
+        spdef = (uint16_t)(spdef << 1);
+    }
+    if (atkItemEffect == HOLD_EFFECT_PIKA_SPATK_UP && atkSpecies == SPECIES_PIKACHU)
+    {
+        power = (uint16_t)(power << 1);
+    }
+    if (defItemEffect == HOLD_EFFECT_DITTO_DEF_UP && defSpecies == SPECIES_DITTO)
+    {
+        def = (uint16_t)(def << 1);
+    }
+    if (atkItemEffect == HOLD_EFFECT_CUBONE_ATK_UP && (uint16_t)(atkSpecies - SPECIES_CUBONE) <= 1)
+    {
+        atk = (uint16_t)(atk << 1);
+    }
+    if (atkItemEffect == HOLD_EFFECT_DIALGA_BOOST && (type == TYPE_DRAGON || type == TYPE_STEEL) && atkSpecies == SPECIES_DIALGA)
+    {
+        power = (uint16_t)Div(Mul(atkItemParam + 100, power), 100);
+    }
+    if (atkItemEffect == HOLD_EFFECT_PALKIA_BOOST && (type == TYPE_DRAGON || type == TYPE_WATER) && atkSpecies == SPECIES_PALKIA)
+    {
+        power = (uint16_t)Div(Mul(atkItemParam + 100, power), 100);
+    }
+    if (atkItemEffect == HOLD_EFFECT_GIRATINA_BOOST && (type == TYPE_DRAGON || type == TYPE_GHOST) && !(attacker->status2 & STATUS2_TRANSFORMED) && atkSpecies == SPECIES_GIRATINA)
+    {
+        power = (uint16_t)Div(Mul(atkItemParam + 100, power), 100);
+    }
+    if (atkItemEffect == HOLD_EFFECT_POWER_UP_PHYS && moveClass == MOVE_CLASS_PHYSICAL)
+    {
+        power = (uint16_t)Div(Mul(atkItemParam + 100, power), 100);
+    }
+    if (atkItemEffect == HOLD_EFFECT_POWER_UP_SPEC && moveClass == MOVE_CLASS_SPECIAL)
+    {
+        power = (uint16_t)Div(Mul(atkItemParam + 100, power), 100);
+    }
+
+    if (CheckBattlerAbilityIfNotIgnored(ctx, battlerIdAttacker, battlerIdTarget, ABILITY_THICK_FAT) == true && (type == TYPE_FIRE || type == TYPE_ICE))
+    {
+        power = (uint16_t)(power >> 1);
+    }
+    if (atkAbility == ABILITY_HUSTLE)
+    {
+        atk = Scale16(atk, 150, 100);
+    }
+    if (atkAbility == ABILITY_GUTS && atkStatus != 0)
+    {
+        atk = Scale16(atk, 150, 100);
+    }
+    if (CheckBattlerAbilityIfNotIgnored(ctx, battlerIdAttacker, battlerIdTarget, ABILITY_MARVEL_SCALE) == true && defStatus != 0)
+    {
+        def = Scale16(def, 150, 100);
+    }
+    if (atkAbility == ABILITY_PLUS && CheckAbilityActive(ctx, 1, battlerIdAttacker, ABILITY_MINUS))
+    {
+        spatk = Scale16(spatk, 150, 100);
+    }
+    if (atkAbility == ABILITY_MINUS && CheckAbilityActive(ctx, 1, battlerIdAttacker, ABILITY_PLUS))
+    {
+        spatk = Scale16(spatk, 150, 100);
+    }
+    if (type == TYPE_ELECTRIC && AnyBattlerHasMoveEffect(ctx, MOVE_EFFECT_MUD_SPORT))
+    {
+        power = (uint16_t)(power >> 1);
+    }
+    if (type == TYPE_FIRE && AnyBattlerHasMoveEffect(ctx, MOVE_EFFECT_WATER_SPORT))
+    {
+        power = (uint16_t)(power >> 1);
+    }
+    if (type == TYPE_GRASS && atkAbility == ABILITY_OVERGROW && atkHp <= Div(atkMaxHp, 3))
+    {
+        power = Scale16(power, 150, 100);
+    }
+    if (type == TYPE_FIRE && atkAbility == ABILITY_BLAZE && atkHp <= Div(atkMaxHp, 3))
+    {
+        power = Scale16(power, 150, 100);
+    }
+    if (type == TYPE_WATER && atkAbility == ABILITY_TORRENT && atkHp <= Div(atkMaxHp, 3))
+    {
+        power = Scale16(power, 150, 100);
+    }
+    if (type == TYPE_BUG && atkAbility == ABILITY_SWARM && atkHp <= Div(atkMaxHp, 3))
+    {
+        power = Scale16(power, 150, 100);
+    }
+    if (type == TYPE_FIRE && CheckBattlerAbilityIfNotIgnored(ctx, battlerIdAttacker, battlerIdTarget, ABILITY_HEATPROOF) == true)
+    {
+        power = (uint16_t)(power >> 1);
+    }
+    if (type == TYPE_FIRE && CheckBattlerAbilityIfNotIgnored(ctx, battlerIdAttacker, battlerIdTarget, ABILITY_DRY_SKIN) == true)
+    {
+        power = Scale16(power, 125, 100);
+    }
+
+    if (atkAbility == ABILITY_SIMPLE)
+    {
+        atkStage = (int8_t)(atkStage * 2);
+        if (atkStage < -6)
+        {
+            atkStage = -6;
+        }
+        if (atkStage > 6)
+        {
+            atkStage = 6;
+        }
+        spatkStage = (int8_t)(spatkStage * 2);
+        if (spatkStage < -6)
+        {
+            spatkStage = -6;
+        }
+        if (spatkStage > 6)
+        {
+            spatkStage = 6;
+        }
+    }
+    if (CheckBattlerAbilityIfNotIgnored(ctx, battlerIdAttacker, battlerIdTarget, ABILITY_SIMPLE) == true)
+    {
+        defStage = (int8_t)(defStage * 2);
+        if (defStage < -6)
+        {
+            defStage = -6;
+        }
+        if (defStage > 6)
+        {
+            defStage = 6;
+        }
+        spdefStage = (int8_t)(spdefStage * 2);
+        if (spdefStage < -6)
+        {
+            spdefStage = -6;
+        }
+        if (spdefStage > 6)
+        {
+            spdefStage = 6;
+        }
+    }
+    if (CheckBattlerAbilityIfNotIgnored(ctx, battlerIdAttacker, battlerIdTarget, ABILITY_UNAWARE) == true)
+    {
+        atkStage = 0;
+        spatkStage = 0;
+    }
+    if (atkAbility == ABILITY_UNAWARE)
+    {
+        defStage = 0;
+        spdefStage = 0;
+    }
+    atkStage += STAT_STAGE_NEUTRAL;
+    defStage += STAT_STAGE_NEUTRAL;
+    spatkStage += STAT_STAGE_NEUTRAL;
+    spdefStage += STAT_STAGE_NEUTRAL;
+
+    if (atkAbility == ABILITY_RIVALRY && atkGender == defGender && atkGender != MON_GENDERLESS && defGender != MON_GENDERLESS)
+    {
+        power = Scale16(power, 125, 100);
+    }
+    if (atkAbility == ABILITY_RIVALRY && atkGender != defGender && atkGender != MON_GENDERLESS && defGender != MON_GENDERLESS)
+    {
+        power = Scale16(power, 75, 100);
+    }
+
+    for (i = 0; i < NUM_IRON_FIST_MOVES; i++)
+    {
+        if (moveNo == data->ironFistMoves[i] && atkAbility == ABILITY_IRON_FIST)
+        {
+            power = Scale16(power, 12, 10);
+            break;
+        }
+    }
+
+    if (WeatherActive(ctx))
+    {
+        uint32_t sun = fieldCondition & FIELD_CONDITION_SUN_ALL;
+        if (sun && atkAbility == ABILITY_SOLAR_POWER)
+        {
+            spatk = Scale16(spatk, 15, 10);
+        }
+        if ((fieldCondition & FIELD_CONDITION_SANDSTORM_ALL) && (defType1 == TYPE_ROCK || defType2 == TYPE_ROCK))
+        {
+            spdef = Scale16(spdef, 15, 10);
+        }
+        if (sun && CheckAbilityActive(ctx, 1, battlerIdAttacker, ABILITY_FLOWER_GIFT))
+        {
+            atk = Scale16(atk, 15, 10);
+        }
+        if (sun && GetBattlerAbility(ctx, battlerIdAttacker) != ABILITY_MOLD_BREAKER && CheckAbilityActive(ctx, 1, battlerIdTarget, ABILITY_FLOWER_GIFT))
+        {
+            spdef = Scale16(spdef, 15, 10);
+        }
+    }
+
+    moveEffect = move->effect;
+    if (moveEffect == BATTLE_EFFECT_HALVE_DEFENSE)
+    {
+        def = (uint16_t)(def >> 1);
+    }
+
+    if (moveClass == MOVE_CLASS_PHYSICAL)
+    {
+        int defense;
+        // A critical hit ignores the attacker's drops and the target's boosts
+        if (criticalMultiplier > 1)
+        {
+            damage = atkStage > STAT_STAGE_NEUTRAL ? ApplyStatStage(data, atk, atkStage) : atk;
+        }
+        else
+        {
+            damage = ApplyStatStage(data, atk, atkStage);
+        }
+        damage = Mul(damage, power);
+        damage = Mul(damage, Div(level * 2, 5) + 2);
+        if (criticalMultiplier > 1)
+        {
+            defense = defStage < STAT_STAGE_NEUTRAL ? ApplyStatStage(data, def, defStage) : def;
+        }
+        else
+        {
+            defense = ApplyStatStage(data, def, defStage);
+        }
+        damage = Div(damage, defense);
+        damage = Div(damage, 50);
+        if ((atkStatus & STATUS_BURN) && atkAbility != ABILITY_GUTS)
+        {
+            damage = Div(damage, 2);
+        }
+        if ((sideCondition & SIDE_CONDITION_REFLECT) && criticalMultiplier == 1 && moveEffect != BATTLE_EFFECT_BRICK_BREAK)
+        {
+            if ((battleType & BATTLE_TYPE_DOUBLES) && GetMonsHitCount(ctx, 1, battlerIdTarget) == 2)
+            {
+                damage = Div(Mul(damage, 2), 3);
+            }
+            else
+            {
+                damage = Div(damage, 2);
+            }
+        }
+    }
+    else if (moveClass == MOVE_CLASS_SPECIAL)
+    {
+        int defense;
+        if (criticalMultiplier > 1)
+        {
+            damage = spatkStage > STAT_STAGE_NEUTRAL ? ApplyStatStage(data, spatk, spatkStage) : spatk;
+        }
+        else
+        {
+            damage = ApplyStatStage(data, spatk, spatkStage);
+        }
+        damage = Mul(damage, power);
+        damage = Mul(damage, Div(level * 2, 5) + 2);
+        if (criticalMultiplier > 1)
+        {
+            defense = spdefStage < STAT_STAGE_NEUTRAL ? ApplyStatStage(data, spdef, spdefStage) : spdef;
+        }
+        else
+        {
+            defense = ApplyStatStage(data, spdef, spdefStage);
+        }
+        damage = Div(damage, defense);
+        damage = Div(damage, 50);
+        if ((sideCondition & SIDE_CONDITION_LIGHT_SCREEN) && criticalMultiplier == 1 && moveEffect != BATTLE_EFFECT_BRICK_BREAK)
+        {
+            if ((battleType & BATTLE_TYPE_DOUBLES) && GetMonsHitCount(ctx, 1, battlerIdTarget) == 2)
+            {
+                damage = Div(Mul(damage, 2), 3);
+            }
+            else
+            {
+                damage = Div(damage, 2);
+            }
+        }
+    }
+
+    if ((battleType & BATTLE_TYPE_DOUBLES) && move->range == MOVE_RANGE_BOTH_FOES && GetMonsHitCount(ctx, 1, battlerIdTarget) == 2)
+    {
+        damage = Div(Mul(damage, 3), 4);
+    }
+    if ((battleType & BATTLE_TYPE_DOUBLES) && move->range == MOVE_RANGE_ALL_ADJACENT && GetMonsHitCount(ctx, 0, battlerIdTarget) >= 2)
+    {
+        damage = Div(Mul(damage, 3), 4);
+    }
+
+    if (WeatherActive(ctx))
+    {
+        if (fieldCondition & FIELD_CONDITION_RAIN_ALL)
+        {
+            if (type == TYPE_FIRE)
+            {
+                damage = Div(damage, 2);
+            }
+            else if (type == TYPE_WATER)
+            {
+                damage = Div(Mul(damage, 15), 10);
+            }
+        }
+        if ((fieldCondition & FIELD_CONDITION_NO_SUN) && moveNo == MOVE_SOLAR_BEAM)
+        {
+            damage = Div(damage, 2);
+        }
+        if (fieldCondition & FIELD_CONDITION_SUN_ALL)
+        {
+            if (type == TYPE_FIRE)
+            {
+                damage = Div(Mul(damage, 15), 10);
+            }
+            else if (type == TYPE_WATER)
+            {
+                damage = Div(damage, 2);
+            }
+        }
+    }
+
+    if (attacker->flashFire && type == TYPE_FIRE)
+    {
+        damage = Div(Mul(damage, 15), 10);
+    }
+
+    return damage + 2;
+}
+
+// ov12_02257C30: the random 85-100% roll
+int ov12_02257C30(int damage, int roll)
+{
+    if (damage != 0)
+    {
+        damage = Div(Mul(100 - roll, damage), 100);
+        if (damage == 0)
+        {
+            damage = 1;
+        }
+    }
+    return damage;
+}
+
+// The end of ov12_02257C5C, once the critical hit roll has succeeded
+int ov12_02257C5C_Multiplier(const DamageContext * ctx, int battlerIdAttacker, int battlerIdTarget)
+{
+    int side = BattleSys_GetFieldSide(battlerIdTarget);
+    if (CheckBattlerAbilityIfNotIgnored(ctx, battlerIdAttacker, battlerIdTarget, ABILITY_BATTLE_ARMOR)
+        || CheckBattlerAbilityIfNotIgnored(ctx, battlerIdAttacker, battlerIdTarget, ABILITY_SHELL_ARMOR)
+        || (ctx->fieldSideConditionFlags[side] & SIDE_CONDITION_LUCKY_CHANT)
+        || (ctx->battleMons[battlerIdTarget].moveEffectFlags & MOVE_EFFECT_LUCKY_CHANT))
+    {
+        return 1;
+    }
+    return GetBattlerAbility(ctx, battlerIdAttacker) == ABILITY_SNIPER ? 3 : 2;
+}
+
+// ov12_02251C74: whether chart entry idx applies to the target
+static bool ov12_02251C74(const DamageContext * ctx, int battlerIdAttacker, int battlerIdTarget, int idx)
+{
+    const uint8_t * entry = ctx->data->typeChart[idx];
+    const DamageMon * target = &ctx->battleMons[battlerIdTarget];
+    bool ret = true;
+    (void)battlerIdAttacker;
+
+    if (GetBattlerHeldItemEffect(ctx, battlerIdTarget) == HOLD_EFFECT_SPEED_DOWN_GROUNDED || (target->moveEffectFlags & MOVE_EFFECT_INGRAIN))
+    {
+        if (entry[1] == TYPE_FLYING && entry[2] == TYPE_MUL_NO_EFFECT)
+        {
+            ret = false;
+        }
+    }
+    if (target->roostFlag && entry[1] == TYPE_FLYING)
+    {
+        ret = false;
+    }
+    if ((ctx->fieldCondition & FIELD_CONDITION_GRAVITY) && entry[1] == TYPE_FLYING && entry[2] == TYPE_MUL_NO_EFFECT)
+    {
+        ret = false;
+    }
+    if ((target->moveEffectFlags & MOVE_EFFECT_MIRACLE_EYE) && entry[1] == TYPE_DARK && entry[2] == TYPE_MUL_NO_EFFECT)
+    {
+        ret = false;
+    }
+    return ret;
+}
+
+// ov12_022583B4: one chart multiplier
+static int ov12_022583B4(const DamageContext * ctx, int mul, int damage, int movePower, uint32_t * statusFlag)
+{
+    if (!(ctx->linkStatus & LINK_STATUS_NO_TYPE_EFFECT) && !(ctx->linkStatus & LINK_STATUS_FIXED_DAMAGE) && damage != 0)
+    {
+        damage = DamageDivide(Mul(damage, mul), 10);
+    }
+    switch (mul)
+    {
+    case TYPE_MUL_NO_EFFECT:
+        *statusFlag |= MOVE_STATUS_NO_EFFECT;
+        *statusFlag &= ~MOVE_STATUS_NOT_EFFECTIVE;
+        *statusFlag &= ~MOVE_STATUS_SUPER_EFFECTIVE;
+        break;
+    case TYPE_MUL_NOT_EFFECTIVE:
+        if (movePower)
+        {
+            if (*statusFlag & MOVE_STATUS_SUPER_EFFECTIVE)
+            {
+                *statusFlag &= ~MOVE_STATUS_SUPER_EFFECTIVE;
+            }
+            else
+            {
+                *statusFlag |= MOVE_STATUS_NOT_EFFECTIVE;
+            }
+        }
+        break;
+    case TYPE_MUL_SUPER_EFFECTIVE:
+        if (movePower)
+        {
+            if (*statusFlag & MOVE_STATUS_NOT_EFFECTIVE)
+            {
+                *statusFlag &= ~MOVE_STATUS_NOT_EFFECTIVE;
+            }
+            else
+            {
+                *statusFlag |= MOVE_STATUS_SUPER_EFFECTIVE;
+            }
+        }
+        break;
+    }
+    return damage;
+}
+
+// ov12_02258440: 0 for the move effects Wonder Guard lets through
+static int ov12_02258440(const DamageContext * ctx, int moveNo)
+{
+    switch (ctx->data->moves[moveNo].effect)
+    {
+    case 26:
+    case 39:
+    case 75:
+    case 145:
+    case 151:
+    case 155:
+    case 255:
+    case 256:
+    case 263:
+    case 273:
+        return ctx->linkStatus & LINK_STATUS_9;
+    default:
+        return 1;
+    }
+}
+
+static int TypeEffectivenessMoveType(const DamageContext * ctx, int moveNo, int moveType, int battlerIdAttacker)
+{
+    if (GetBattlerAbility(ctx, battlerIdAttacker) == ABILITY_NORMALIZE)
+    {
+        return TYPE_NORMAL;
+    }
+    if (moveType)
+    {
+        return (uint8_t)moveType;
+    }
+    return ctx->data->moves[moveNo].type;
+}
+
+static int ApplyStab(const DamageContext * ctx, int type, int battlerIdAttacker, int damage)
+{
+    const DamageMon * attacker = &ctx->battleMons[battlerIdAttacker];
+    if (!(ctx->linkStatus & LINK_STATUS_NO_TYPE_EFFECT) && (type == attacker->type1 || type == attacker->type2))
+    {
+        if (GetBattlerAbility(ctx, battlerIdAttacker) == ABILITY_ADAPTABILITY)
+        {
+            damage = Mul(damage, 2);
+        }
+        else
+        {
+            damage = Div(Mul(damage, 15), 10);
+        }
+    }
+    return damage;
+}
+
+static bool ImmuneByLevitate(const DamageContext * ctx, int type, int battlerIdAttacker, int battlerIdTarget, uint8_t defItemEffect)
+{
+    return CheckBattlerAbilityIfNotIgnored(ctx, battlerIdAttacker, battlerIdTarget, ABILITY_LEVITATE) == true && type == TYPE_GROUND && defItemEffect != HOLD_EFFECT_SPEED_DOWN_GROUNDED;
+}
+
+static bool ImmuneByMagnetRise(const DamageContext * ctx, int type, int battlerIdTarget, uint8_t defItemEffect)
+{
+    const DamageMon * target = &ctx->battleMons[battlerIdTarget];
+    return target->magnetRiseTurns && !(target->moveEffectFlags & MOVE_EFFECT_INGRAIN) && type == TYPE_GROUND && defItemEffect != HOLD_EFFECT_SPEED_DOWN_GROUNDED;
+}
+
+// Everything after the chart walk
+static int TypeEffectivenessPost(const DamageContext * ctx, int moveNo, int battlerIdAttacker, int battlerIdTarget, int damage, int movePower, uint8_t atkItemEffect, uint8_t atkItemBoost, uint32_t * statusFlag)
+{
+    if (CheckBattlerAbilityIfNotIgnored(ctx, battlerIdAttacker, battlerIdTarget, ABILITY_WONDER_GUARD) == true && ov12_02258440(ctx, moveNo)
+        && (!(*statusFlag & MOVE_STATUS_SUPER_EFFECTIVE) || (*statusFlag & (MOVE_STATUS_SUPER_EFFECTIVE | MOVE_STATUS_NOT_EFFECTIVE)) == (MOVE_STATUS_SUPER_EFFECTIVE | MOVE_STATUS_NOT_EFFECTIVE))
+        && movePower)
+    {
+        *statusFlag |= MOVE_STATUS_WONDER_GUARD;
+        return damage;
+    }
+    if (!(ctx->linkStatus & LINK_STATUS_NO_TYPE_EFFECT) && !(ctx->linkStatus & LINK_STATUS_FIXED_DAMAGE))
+    {
+        if ((*statusFlag & MOVE_STATUS_SUPER_EFFECTIVE) && movePower)
+        {
+            if (CheckBattlerAbilityIfNotIgnored(ctx, battlerIdAttacker, battlerIdTarget, ABILITY_SOLID_ROCK) == true
+                || CheckBattlerAbilityIfNotIgnored(ctx, battlerIdAttacker, battlerIdTarget, ABILITY_FILTER) == true)
+            {
+                damage = DamageDivide(Mul(damage, 3), 4);
+            }
+            if (atkItemEffect == HOLD_EFFECT_POWER_UP_SE)
+            {
+                damage = Div(Mul(atkItemBoost + 100, damage), 100);
+            }
+        }
+        if ((*statusFlag & MOVE_STATUS_NOT_EFFECTIVE) && movePower && GetBattlerAbility(ctx, battlerIdAttacker) == ABILITY_TINTED_LENS)
+        {
+            damage = Mul(damage, 2);
+        }
+    }
+    else
+    {
+        *statusFlag &= ~MOVE_STATUS_SUPER_EFFECTIVE;
+        *statusFlag &= ~MOVE_STATUS_NOT_EFFECTIVE;
+    }
+    return damage;
+}
+
+// ov12_02251D28 (0x02251D28), as BtlCmd_TypeEffectivenessCheck calls it
+int ov12_02251D28(const DamageContext * ctx, int moveNo, int moveType, int battlerIdAttacker, int battlerIdTarget, int damage, uint32_t * statusFlag)
+{
+    const GameData * data = ctx->data;
+    const DamageMon * target = &ctx->battleMons[battlerIdTarget];
+    uint8_t atkItemEffect;
+    uint8_t atkItemBoost;
+    uint8_t defItemEffect;
+    int type;
+    int movePower;
+
+    if (moveNo == MOVE_STRUGGLE)
+    {
+        return damage;
+    }
+
+    atkItemEffect = (uint8_t)GetBattlerHeldItemEffect(ctx, battlerIdAttacker);
+    atkItemBoost = (uint8_t)BattleSystem_GetHeldItemDamageBoost(ctx, battlerIdAttacker, 0);
+    defItemEffect = (uint8_t)GetBattlerHeldItemEffect(ctx, battlerIdTarget);
+    type = TypeEffectivenessMoveType(ctx, moveNo, moveType, battlerIdAttacker);
+    movePower = data->moves[moveNo].power;
+
+    damage = ApplyStab(ctx, type, battlerIdAttacker, damage);
+
+    if (ImmuneByLevitate(ctx, type, battlerIdAttacker, battlerIdTarget, defItemEffect))
+    {
+        *statusFlag |= MOVE_STATUS_LEVITATED;
+    }
+    else if (ImmuneByMagnetRise(ctx, type, battlerIdTarget, defItemEffect))
+    {
+        *statusFlag |= MOVE_STATUS_MAGNET_RISE;
+    }
+    else
+    {
+        int i = 0;
+        while (data->typeChart[i][0] != TYPE_ENDTABLE)
+        {
+            if (data->typeChart[i][0] == TYPE_FORESIGHT)
+            {
+                if ((target->status2 & STATUS2_FORESIGHT) || GetBattlerAbility(ctx, battlerIdAttacker) == ABILITY_SCRAPPY)
+                {
+                    break;
+                }
+                i++;
+                continue;
+            }
+            if (data->typeChart[i][0] == type)
+            {
+                if (data->typeChart[i][1] == target->type1 && ov12_02251C74(ctx, battlerIdAttacker, battlerIdTarget, i) == true)
+                {
+                    damage = ov12_022583B4(ctx, data->typeChart[i][2], damage, movePower, statusFlag);
+                }
+                if (data->typeChart[i][1] == target->type2 && target->type1 != target->type2 && ov12_02251C74(ctx, battlerIdAttacker, battlerIdTarget, i) == true)
+                {
+                    damage = ov12_022583B4(ctx, data->typeChart[i][2], damage, movePower, statusFlag);
+                }
+            }
+            i++;
+        }
+    }
+
+    return TypeEffectivenessPost(ctx, moveNo, battlerIdAttacker, battlerIdTarget, damage, movePower, atkItemEffect, atkItemBoost, statusFlag);
+}
+
+void TypeChart_Lookup(const DamageContext * ctx, int moveType, int battlerIdAttacker, int battlerIdTarget, TypeChartHits * hits)
+{
+    const GameData * data = ctx->data;
+    const DamageMon * target = &ctx->battleMons[battlerIdTarget];
+    uint8_t defItemEffect = (uint8_t)GetBattlerHeldItemEffect(ctx, battlerIdTarget);
+
+    hits->immuneLevitate = ImmuneByLevitate(ctx, moveType, battlerIdAttacker, battlerIdTarget, defItemEffect);
+    hits->immuneMagnetRise = !hits->immuneLevitate && ImmuneByMagnetRise(ctx, moveType, battlerIdTarget, defItemEffect);
+    hits->numHits = 0;
+    if (hits->immuneLevitate || hits->immuneMagnetRise)
+    {
+        return;
+    }
+    for (int i = 0; data->typeChart[i][0] != TYPE_ENDTABLE; i++)
+    {
+        if (data->typeChart[i][0] == TYPE_FORESIGHT)
+        {
+            if ((target->status2 & STATUS2_FORESIGHT) || GetBattlerAbility(ctx, battlerIdAttacker) == ABILITY_SCRAPPY)
+            {
+                break;
+            }
+            continue;
+        }
+        if (data->typeChart[i][0] != moveType)
+        {
+            continue;
+        }
+        for (int j = 0; j < 2; j++)
+        {
+            uint8_t defType = j == 0 ? target->type1 : target->type2;
+            if (j == 1 && target->type1 == target->type2)
+            {
+                break;
+            }
+            if (data->typeChart[i][1] == defType && ov12_02251C74(ctx, battlerIdAttacker, battlerIdTarget, i) == true)
+            {
+                if (hits->numHits == (int)(sizeof(hits->multipliers) / sizeof(hits->multipliers[0])))
+                {
+                    fatal_error("too many type chart entries for type %d", moveType);
+                }
+                hits->multipliers[hits->numHits++] = data->typeChart[i][2];
+            }
+        }
+    }
+}
+
+int TypeChart_Apply(const DamageContext * ctx, const TypeChartHits * hits, int moveNo, int moveType, int battlerIdAttacker, int battlerIdTarget, int damage, uint32_t * statusFlag)
+{
+    int movePower;
+
+    if (moveNo == MOVE_STRUGGLE)
+    {
+        return damage;
+    }
+    movePower = ctx->data->moves[moveNo].power;
+    damage = ApplyStab(ctx, moveType, battlerIdAttacker, damage);
+    if (hits->immuneLevitate)
+    {
+        *statusFlag |= MOVE_STATUS_LEVITATED;
+    }
+    else if (hits->immuneMagnetRise)
+    {
+        *statusFlag |= MOVE_STATUS_MAGNET_RISE;
+    }
+    else
+    {
+        for (int i = 0; i < hits->numHits; i++)
+        {
+            damage = ov12_022583B4(ctx, hits->multipliers[i], damage, movePower, statusFlag);
+        }
+    }
+    return TypeEffectivenessPost(ctx, moveNo, battlerIdAttacker, battlerIdTarget, damage, movePower,
+        (uint8_t)GetBattlerHeldItemEffect(ctx, battlerIdAttacker), (uint8_t)BattleSystem_GetHeldItemDamageBoost(ctx, battlerIdAttacker, 0), statusFlag);
+}
+
+int DamageMove_Type(const DamageContext * ctx, const DamageMove * move)
+{
+    if (GetBattlerAbility(ctx, move->battlerIdAttacker) == ABILITY_NORMALIZE)
+    {
+        return TYPE_NORMAL;
+    }
+    if (move->moveType)
+    {
+        return move->moveType;
+    }
+    return ctx->data->moves[move->moveNo].type;
+}
+
+int DamageCalcDefault(DamageContext * ctx, const DamageMove * move)
+{
+    int side = BattleSys_GetFieldSide(move->battlerIdTarget);
+    DamageMon * attacker = &ctx->battleMons[move->battlerIdAttacker];
+    int damage = CalcMoveDamage(ctx, move->moveNo, ctx->fieldSideConditionFlags[side], ctx->fieldCondition, move->movePower, DamageMove_Type(ctx, move), move->battlerIdAttacker, move->battlerIdTarget, move->criticalMultiplier);
+
+    damage *= move->criticalMultiplier;
+    if (GetBattlerHeldItemEffect(ctx, move->battlerIdAttacker) == HOLD_EFFECT_HP_DRAIN_ON_ATK)
+    {
+        damage = damage * (100 + BattleSystem_GetHeldItemDamageBoost(ctx, move->battlerIdAttacker, 0)) / 100;
+    }
+    if (GetBattlerHeldItemEffect(ctx, move->battlerIdAttacker) == HOLD_EFFECT_BOOST_REPEATED)
+    {
+        damage = damage * (10 + attacker->metronomeTurns) / 10;
+    }
+    if (attacker->meFirstFlag)
+    {
+        if (ctx->meFirstTotal == attacker->meFirstCount)
+        {
+            attacker->meFirstCount--;
+        }
+        if ((ctx->meFirstTotal - attacker->meFirstCount) < 2)
+        {
+            damage = damage * 15 / 10;
+        }
+        else
+        {
+            attacker->meFirstFlag = false;
+        }
+    }
+    return damage;
+}
+
+int DamageCalc_Hit(DamageContext * ctx, const DamageMove * move, int roll, uint32_t * statusFlag)
+{
+    int damage = DamageCalcDefault(ctx, move);
+    damage = ov12_02257C30(damage, roll);
+    damage *= -1;
+    damage = ov12_02251D28(ctx, move->moveNo, move->moveType, move->battlerIdAttacker, move->battlerIdTarget, damage, statusFlag);
+    return -damage;
+}
@@ -0,0 +1,112 @@
+#ifndef GUARD_DMGCALC_DAMAGE_H
+#define GUARD_DMGCALC_DAMAGE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "gamedata.h"
+
+#define MAX_BATTLERS 4
+#define NUM_RANDOM_ROLLS 16 // BattleSys_Random() % 16 in ov12_02257C30
+
+// The parts of BATTLEMON (include/battle.h) that the damage routines read
+typedef struct DamageMon
+{
+    uint16_t species;
+    uint16_t atk;
+    uint16_t def;
+    uint16_t speed;
+    uint16_t spatk;
+    uint16_t spdef;
+    int8_t statChanges[8]; // indexed by STAT_*, 6 is neutral
+    uint8_t type1;
+    uint8_t type2;
+    uint8_t ability;
+    uint8_t level;
+    uint8_t gender;
+    int hp;
+    uint32_t maxHp;
+    uint32_t status;
+    uint32_t status2;
+    uint16_t item;
+    uint32_t moveEffectFlags;
+    // UnkBattlemonSub
+    bool flashFire;
+    uint8_t magnetRiseTurns;
+    uint8_t embargoTurns; // unk4_13
+    uint8_t metronomeTurns;
+    bool meFirstFlag;
+    int slowStartTurns;
+    int meFirstCount;
+    // TurnData
+    bool helpingHandFlag;
+    bool roostFlag; // unk0_6
+} DamageMon;
+
+// The parts of BATTLECONTEXT and BattleSystem that the damage routines read
+typedef struct DamageContext
+{
+    const GameData * data;
+    uint32_t battleType;
+    DamageMon battleMons[MAX_BATTLERS];
+    uint32_t fieldCondition;
+    uint32_t fieldSideConditionFlags[2];
+    uint32_t linkStatus;
+    int totalTurns;
+    int meFirstTotal;
+    int powerModifier; // unk_2158, in tenths
+} DamageContext;
+
+// One attack, as DamageCalcDefault and BtlCmd_TypeEffectivenessCheck see it
+typedef struct DamageMove
+{
+    uint16_t moveNo;
+    int movePower; // 0 takes it from the move table
+    int moveType;  // 0 takes it from the move table
+    int battlerIdAttacker;
+    int battlerIdTarget;
+    int criticalMultiplier;
+} DamageMove;
+
+// The type chart entries that apply to one attack, in chart order. The chart
+// walk doesn't depend on the damage, so the sweep does it once per attack and
+// then applies it to every roll.
+typedef struct TypeChartHits
+{
+    bool immuneLevitate;
+    bool immuneMagnetRise;
+    int numHits;
+    uint8_t multipliers[4];
+} TypeChartHits;
+
+void DamageContext_Init(DamageContext * ctx, const GameData * data);
+
+uint32_t GetBattlerAbility(const DamageContext * ctx, int battlerId);
+uint16_t GetBattlerHeldItem(const DamageContext * ctx, int battlerId);
+uint32_t GetItemHoldEffect(const DamageContext * ctx, int item, uint32_t attr);
+uint32_t GetBattlerHeldItemEffect(const DamageContext * ctx, int battlerId);
+int BattleSystem_GetHeldItemDamageBoost(const DamageContext * ctx, int battlerId, int a2);
+bool CheckBattlerAbilityIfNotIgnored(const DamageContext * ctx, int battlerIdAttacker, int battlerIdTarget, uint32_t ability);
+int CheckAbilityActive(const DamageContext * ctx, int a2, int a3, int ability);
+int GetMonsHitCount(const DamageContext * ctx, int a2, int battlerId);
+int DamageDivide(int damage, int denom);
+
+// Ports of the undecompiled routines in asm/overlay_12_0224E4FC_s.s
+int CalcMoveDamage(const DamageContext * ctx, uint32_t moveNo, uint32_t sideCondition, uint32_t fieldCondition, uint16_t movePower, uint8_t moveType, uint8_t battlerIdAttacker, uint8_t battlerIdTarget, uint8_t criticalMultiplier);
+int ov12_02257C30(int damage, int roll);
+int ov12_02257C5C_Multiplier(const DamageContext * ctx, int battlerIdAttacker, int battlerIdTarget);
+int ov12_02251D28(const DamageContext * ctx, int moveNo, int moveType, int battlerIdAttacker, int battlerIdTarget, int damage, uint32_t * statusFlag);
+
+// ov12_02251D28 split in two: the chart walk, then the damage arithmetic
+void TypeChart_Lookup(const DamageContext * ctx, int moveType, int battlerIdAttacker, int battlerIdTarget, TypeChartHits * hits);
+int TypeChart_Apply(const DamageContext * ctx, const TypeChartHits * hits, int moveNo, int moveType, int battlerIdAttacker, int battlerIdTarget, int damage, uint32_t * statusFlag);
+
+// DamageCalcDefault, without the roll. Updates the attacker's Me First count
+// the way the game does, so ctx isn't const.
+int DamageCalcDefault(DamageContext * ctx, const DamageMove * move);
+// The type of the move as DamageCalcDefault passes it on
+int DamageMove_Type(const DamageContext * ctx, const DamageMove * move);
+// BtlCmd_DamageCalc then BtlCmd_TypeEffectivenessCheck, for one roll in
+// [0, NUM_RANDOM_ROLLS). Returns the HP lost, positive.
+int DamageCalc_Hit(DamageContext * ctx, const DamageMove * move, int roll, uint32_t * statusFlag);
+
+#endif //GUARD_DMGCALC_DAMAGE_H
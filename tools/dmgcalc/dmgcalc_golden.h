@@ -0,0 +1,504 @@
+{
+    0xE3D15841BC30B251ULL, 0x8B5E76179DB3BBA7ULL, 0xBEACCA9AD7807A91ULL, 0xC9EFDF04FFB9FF83ULL,
+    0x5A1ACA6954CAFF68ULL, 0x5CA4EF66CFD4D971ULL, 0xCEB249BC7D585D15ULL, 0x47CFC68A4807B072ULL,
+    0xA6D61367BD9C8EC8ULL, 0xBF5D718D17CCE71CULL, 0xBFF0F19912B9B7D4ULL, 0x67B3023167AC2483ULL,
+    0x6F2CFDEF33CFFC5EULL, 0x99F3BEAB7628789DULL, 0x5878E327F69BD772ULL, 0xA309ADC19FB9C567ULL,
+    0x0AB92FD3D47388A9ULL, 0xFD3C7BAD4BA80CF3ULL, 0xE5D374AFF8D4C00BULL, 0x26CB516F2BC55356ULL,
+    0x38AC8BB5630BC122ULL, 0x17A42D74B88AAC89ULL, 0xA27982AC2106479FULL, 0x30887D224A953E40ULL,
+    0xB5F4F4F919FF6EA1ULL, 0x7E52BAED6DA81918ULL, 0xCC3A46A38C7BAE43ULL, 0xE8F552BFBF256A5FULL,
+    0x02B30E69349B62C2ULL, 0x2C7F1886E013FE25ULL, 0x234F54692CDD3815ULL, 0x21B52044BC3BE41EULL,
+    0x7446E5568ECEAE1FULL, 0xDF8B00FAB72F5109ULL, 0x92FD6B0027B09160ULL, 0x70997E9AA817D857ULL,
+    0x60F0E15B5E665867ULL, 0x0A7D8CE2FE7B8844ULL, 0x04F574EF37A7B0B2ULL, 0x3BCDA5EC982137B8ULL,
+    0xBA8F476661864D52ULL, 0x572F770A07271EB3ULL, 0xC6FC9DFCBA46ECA0ULL, 0x1E18FB40F5AE9E83ULL,
+    0xCED5A58761D98E76ULL, 0xA03DC76D2B6BC255ULL, 0x9D3DB930A8EFA9ADULL, 0x8F392C815AD1D096ULL,
+    0xF3A5A456D81BCCF4ULL, 0x1BF0F65989C0A814ULL, 0x659B82540580C6A9ULL, 0x56B3491B503F34E1ULL,
+    0x1C61C4F47F90AAD0ULL, 0xF15F378407E535FDULL, 0xE356E5CEE9980AEFULL, 0x0ED0CC6A0B80D93EULL,
+    0x4E206D80311472F8ULL, 0x5D631B02247548EBULL, 0x7FA8A9A1D99F8F3FULL, 0xF7047ADD72199C4CULL,
+    0x2D9C770A0CD506C9ULL, 0x2EE20CB5C8F635F9ULL, 0x50A757D1336F30F8ULL, 0x78971BE8C44F2B5EULL,
+    0x5EF59BB536767E0CULL, 0x0ED0CC6A0B80D93EULL, 0x83E4DA63CC2B51AAULL, 0x17E40538ED91D3F4ULL,
+    0xC31E8775CCC06190ULL, 0x288796F5B61E09F9ULL, 0x11A529BE4139E4F3ULL, 0x33716BA6A28E6403ULL,
+    0x2D0ECDE114282AD5ULL, 0x2D1A10B5F2DAED31ULL, 0x24D130CFA4C48C6AULL, 0xA9BA5A5A76F85FADULL,
+    0x4F842E45155F2A72ULL, 0x89189B971225A283ULL, 0xBC65F5FDBFD0E31FULL, 0xAC8B321C3062F64BULL,
+    0xB5AC9593CF9DC79CULL, 0x4B9B25FB9195FECAULL, 0x96681E8E3773BDC7ULL, 0x80673864D6E88757ULL,
+    0x76AF3694BEA82092ULL, 0xE0C8D180B4628833ULL, 0x4BF7376859E43AB0ULL, 0x6A3554DD2DE23913ULL,
+    0x2E86E9011C8C39E4ULL, 0xCC3023D45FE1DBE5ULL, 0x8206CE9044F4029EULL, 0x12D1846FED8C319BULL,
+    0x38518CC70242E1BAULL, 0x39286D6DE67ECA37ULL, 0xCEAB2CEB907E32F8ULL, 0xD96CD086B9ED4CAEULL,
+    0x322178486406AA6DULL, 0xA7D45BCD43072926ULL, 0x39C8B8B08E9FD563ULL, 0x65E6031D4835BCB5ULL,
+    0xF66816E8FD624FC5ULL, 0x458FAB1079212192ULL, 0x92A5318153B73959ULL, 0x0BFC16E541E55E9CULL,
+    0x659B82540580C6A9ULL, 0x28C26B63AD77AFCDULL, 0x0DF404C900894222ULL, 0x49398EB65D71EB62ULL,
+    0xCB7AAA9333A280F1ULL, 0xF3AFC13EC5C79099ULL, 0xBECB91540175F8FBULL, 0xB734F967237703BEULL,
+    0x19A4206F24363D65ULL, 0x869BE62C241EA425ULL, 0xA04DDAA3E5F4001BULL, 0xB1B2A6B839CD70EEULL,
+    0xFEEC11C17A95E8AAULL, 0x077E42D7BA054416ULL, 0x12A032FE2F50AC00ULL, 0x272C1BC9A049D9A0ULL,
+    0xAC8B321C3062F64BULL, 0x29CC2BA7D2157E24ULL, 0xB8C6FDF4DA253D3AULL, 0xB339997DEA973EDAULL,
+    0xBC1186D1208002D5ULL, 0xDE22628347675784ULL, 0x1D242CC8780EC4DAULL, 0x43A18FD92D6CC3E8ULL,
+    0x7B4A34F9873D0D35ULL, 0x8540501E93741963ULL, 0x46A9DC98E2C9E62CULL, 0xD82A094D16A83C0FULL,
+    0x0159D3B087B8F6B0ULL, 0x1B18D2B7DEBCEDFEULL, 0xA2D45854DE95B4B6ULL, 0x2E341119FEE43EF4ULL,
+    0x114F8C5CA7EED445ULL, 0x6E428F96BCE6066FULL, 0x3875C963F7F5D779ULL, 0x78576A21C5131E80ULL,
+    0x99902E41C5DBB077ULL, 0xF5DAB396F8277B84ULL, 0x496B7C6AF1321DABULL, 0x19B0F59FA1346934ULL,
+    0xC3258D2929CDF81DULL, 0xE7A1785211E102D3ULL, 0xDC1D22142000CE21ULL, 0x0F11C56D68DE5CA4ULL,
+    0x891F27084B2C462DULL, 0xD02DEE01D82FE237ULL, 0xD8BE49FE6F4DB88FULL, 0xCF20EC3C24D43D63ULL,
+    0x9E546686F37F573FULL, 0x6613E319E63F49FCULL, 0xC9EFDF04FFB9FF83ULL, 0x5A1ACA6954CAFF68ULL,
+    0x3EA44CCE87464D69ULL, 0xEC132E26EC887753ULL, 0xE696455C122B321DULL, 0x7AF4EDA635237510ULL,
+    0x21D1C18715564664ULL, 0xF306991F59847857ULL, 0x2C30190EEBAB0B48ULL, 0x8F2DFAD94FB4C497ULL,
+    0xB0CA8B3D637D41B8ULL, 0x9633BBA935FBC838ULL, 0xAB91D80E12CB5423ULL, 0x532E36035B9761C9ULL,
+    0x031FA77CCA3CF94EULL, 0x5768BEEB44E7289BULL, 0xA2A405FDC6A438F3ULL, 0xA425ED4453C15E1EULL,
+    0x8D1227AC56A50CF8ULL, 0x5BC5BA4D845A75F0ULL, 0x1D7AFB97F8DCA4FDULL, 0x828341CA21B7F14DULL,
+    0x098D8C5E67537DF8ULL, 0x2E6795D442749FEFULL, 0xC6F89F3E338AE350ULL, 0xC6BF83CF12AFA45CULL,
+    0x2E33CA3FD09F06CCULL, 0x0A17F33962A53476ULL, 0x9C93A9C00CA54552ULL, 0x2B79A7D0F6E5BEB3ULL,
+    0x42CE8CCBF7004E21ULL, 0xC07E97D26857D8A3ULL, 0xF4130034E3BCC4EBULL, 0x2A4DCEFF76FDB1FAULL,
+    0x5D1070F2D9342B91ULL, 0x9655D8CC7FF9D1D8ULL, 0xF3B96912C45E7697ULL, 0xBD5B6DCD4D717369ULL,
+    0x05DCBC60F769E415ULL, 0x365B40050180E68FULL, 0xEBAE69196B2C4E32ULL, 0xE3A6799638C6A624ULL,
+    0xE767DE3D03DFE35EULL, 0x143670E4B58C51E9ULL, 0xAC8B321C3062F64BULL, 0xE2C78B6C213C5CCCULL,
+    0xA6922C7BDB8DF6D0ULL, 0xC7407A5FEE532166ULL, 0xE64CBD80AC0C4DF4ULL, 0xB4EC6CF14F4DDA09ULL,
+    0xE4DAD21BD4953473ULL, 0x1C61C4F47F90AAD0ULL, 0xBC5BADD7F25EE278ULL, 0xA04419E090CAB299ULL,
+    0x6BFA4C49F8CF41A6ULL, 0x6CFD73564E1FCE0BULL, 0x183814D808919B02ULL, 0x7C8FA2BFB45FD6BDULL,
+    0x632C9C725D12774AULL, 0x6DEF9381D598C524ULL, 0xCFC925F908FE1250ULL, 0x289D43D26422ACFFULL,
+    0x70B621060B63216FULL, 0x10665D5038851D59ULL, 0xEBFB43777647DB19ULL, 0x7C7629B73043C1F6ULL,
+    0xC0FE5B6166AFB76DULL, 0x60F953B64A65BFCBULL, 0x7CB1B86FDF62598CULL, 0x515BBC2C16255B26ULL,
+    0x77FDAEE40DB57EDBULL, 0xD51FB03ED3EC8DDBULL, 0x61F6A98360E1AA59ULL, 0xFB53AE304EFA02C6ULL,
+    0xEBB84C097FB46DCFULL, 0x3279A731D315FC3AULL, 0x831D4D2E9D699720ULL, 0xE45B8B2828CAE798ULL,
+    0xCAA7A0C3E029EBD2ULL, 0x7D9985DC917EBBBAULL, 0x4F5BE33C8C8DCF19ULL, 0x1BC885878C61872AULL,
+    0xE1D92E49D42A3B8EULL, 0xBC6F3BEAACE3B9EAULL, 0xB3AF73574A33BCAEULL, 0x5277F61C0115C756ULL,
+    0x6BFA4C49F8CF41A6ULL, 0xA2FB54E8666BBE2DULL, 0xD9A27C4FCB9CB693ULL, 0xEAFE111C3517E3A2ULL,
+    0xC07E97D26857D8A3ULL, 0x4E2EBC6ED6930795ULL, 0x7F9C034E854803CAULL, 0xC696A2FC2A2937E1ULL,
+    0x0CA9CACA025B3EE3ULL, 0x7C6F4A603DB353B0ULL, 0xA9E8F775D070346AULL, 0x9DD09C563C15B36CULL,
+    0xB66C92E4BA2F8745ULL, 0x6833BF10DB27F996ULL, 0x97A2BB4FC2B9DDF8ULL, 0xF66876EC0EF9842EULL,
+    0xD87432DBC613B23BULL, 0xF1BCA7101BADE263ULL, 0xC203D76F38505F7EULL, 0x320619DE77699657ULL,
+    0x8CE5B21F92B2FE77ULL, 0xEDD72D26596D313FULL, 0x5DCE9CB6239BB30CULL, 0x34167329788B440AULL,
+    0xDE793402A51A17DAULL, 0xEF92267E54B3D336ULL, 0x041F954351A7FA84ULL, 0xEF92267E54B3D336ULL,
+    0x484080ECB4D1D335ULL, 0x0672D23445DA87E4ULL, 0x3ED3613689F2367AULL, 0x5D7507FAB2A5B5D2ULL,
+    0x8E2C10811279DB25ULL, 0xACF0FA17DD69DF8DULL, 0xAFF8FA03AC0FF410ULL, 0x8BDBAB45249FC6FEULL,
+    0x99F9E3CA2C09ECBBULL, 0x817ECDA96FEE0D16ULL, 0xB7CFD8081B2CCCEDULL, 0x203D6417CC56033EULL,
+    0xF1EB421386FD2512ULL, 0xA147E0E9921A88FBULL, 0xB0497FB4E2E2BD35ULL, 0x5CC92C7A74B913D3ULL,
+    0x24F950402F05B125ULL, 0xCD04E84BB1970849ULL, 0x1630A8D168DA836AULL, 0x0E666DC23AC0FC47ULL,
+    0x803BB92BFAA9891BULL, 0xB0E61FC4897F527DULL, 0x9DE000B4ADE897CCULL, 0x136522918FB6FDEEULL,
+    0x38D2992F31E4E213ULL, 0x36B69D04D56CF1D6ULL, 0x9B1FEDD5EB2C79F9ULL, 0xDF38C60CD867410BULL,
+    0xCC98D2CF8F7E522DULL, 0x4F5BE33C8C8DCF19ULL, 0x0CBA82B1ED4B813AULL, 0x9E1EC8352D143626ULL,
+    0xEE446FC301F54B43ULL, 0xB0D59D59F3C9968EULL, 0x6EADF507042265ACULL, 0x59F91F62CBFEF1DAULL,
+    0x2A22279FEA199FA7ULL, 0x293669DB02678156ULL, 0xD1BE17F2953D0EB1ULL, 0x819038030C6A1660ULL,
+    0x2A32E8C8DE8474DBULL, 0x5D5E8B4BA7B4D18AULL, 0x5A39166309E3CC8CULL, 0x8FD490930375B90FULL,
+    0x71421E530E06D476ULL, 0x4A45A130A357BA7CULL, 0x2093124E68F7569EULL, 0xF9A03EE3200A31F7ULL,
+    0xD78B2C946053FB3FULL, 0x2F8C23C09DB19340ULL, 0x1C97492D4E3130B4ULL, 0xAC66BA127070FD93ULL,
+    0x4C60BE58F178AC05ULL, 0xF1BCE37970060308ULL, 0xCDAF52C1E17CBDDFULL, 0xE4015762F6B33442ULL,
+    0x6577D31226C8B58DULL, 0x5E3EE5C4698885F3ULL, 0x2A2204317CEF4BA5ULL, 0xE8F552BFBF256A5FULL,
+    0x55306A7381C6544CULL, 0x723C35CF3A6F20B9ULL, 0x4357354D8F00FC94ULL, 0x68B7573DBE45DF8AULL,
+    0x7F24C45C6D184B98ULL, 0xBC428A9AB2C00251ULL, 0xAC2D2F805E8ED7C6ULL, 0xDFF334D94352300FULL,
+    0x188B9A34D1921B7AULL, 0x0987985EB1006053ULL, 0x3953C17FD57A59F2ULL, 0x72CFF4F128EFD48FULL,
+    0xD25868D138C8FC5DULL, 0x98C7012FBA9657CFULL, 0x3F5AA60B868525D3ULL, 0xA6716F3BDBD3B66BULL,
+    0x2BFCB1D33A5C25B5ULL, 0xC748612E4413769FULL, 0x1EC5901B7B30A282ULL, 0xE77DBCA325614187ULL,
+    0x0C90A2DBCD9BC12BULL, 0xCBF6AACF1A92AB97ULL, 0x0DCE09C12B94C439ULL, 0xFC35726133C622BEULL,
+    0x3AC28D43DFDDA502ULL, 0xE06EDEB22B94320CULL, 0x6598B670526A763EULL, 0x2DC0C164B96F2CC0ULL,
+    0x219E9034513DA4BBULL, 0xF899098DCDF21140ULL, 0xB823F4A255B5A526ULL, 0xC410714D594D5049ULL,
+    0x755BECC657A1B6FBULL, 0x215DE083471C4056ULL, 0xC0577D46B10C68C3ULL, 0xB18BB73745B7EBADULL,
+    0x4A15F096D8287CACULL, 0xF9A1B95E14B23329ULL, 0xB29F98117532F36AULL, 0xDBE3D9343F3A394BULL,
+    0xB9AF6B86763ABAC1ULL, 0x86AB714BC65636BDULL, 0xDA6A16FE6A44DFB0ULL, 0xCE8D7743E651D109ULL,
+    0x143F6EA7854CE790ULL, 0x9E79998D26EE5B6DULL, 0x9CFAC8C773D19634ULL, 0xE66AAFC6DE67302FULL,
+    0x7B0ED71024D5F039ULL, 0x139BFA2E482C480CULL, 0xAC6FD88A32443D13ULL, 0xBF7D74F9183804A5ULL,
+    0xC67E47BE0D8175E9ULL, 0x6643946CE7D7CD02ULL, 0xBD78E5ECDF21CCC0ULL, 0x08DE1A5B8CDF3B4FULL,
+    0xEA9E8EE961CD8D83ULL, 0x92391543B69008D7ULL, 0x5938D0920100CFA0ULL, 0x64F266AC71288CF7ULL,
+    0x7EDE4A25DCB2115CULL, 0xC248EAE0CE0E3C96ULL, 0x7889DE09C8C29D00ULL, 0x45F33808DC3FD3CAULL,
+    0x501BC165AF38987BULL, 0xB66EE6B258359CB0ULL, 0x3964D1C8DE06224EULL, 0x8BDBAB45249FC6FEULL,
+    0xE69FC8BBF8DB86A6ULL, 0xEE27F153479F5490ULL, 0x9E1EC8352D143626ULL, 0xF88BB79CF7CE1B51ULL,
+    0x23D6425D379EA1EEULL, 0xD0895FD368B7FF36ULL, 0x5DDEEF1E622F2265ULL, 0x4DD13ABF13C6B539ULL,
+    0xE73B47DC381876E3ULL, 0x000B6612FCF2E7FAULL, 0xAD927D4002FE1DADULL, 0x3340C3293E0C8142ULL,
+    0xFD4D100DCD979DF0ULL, 0x73B6D45AA09EFD50ULL, 0x8649310E80423A4BULL, 0xBB2F0E8A873AC737ULL,
+    0x26B36C7C2B054AD7ULL, 0x71FD2F50BEE288BAULL, 0x459954DD1DA7BE0BULL, 0x8A27EF7F3679CAD2ULL,
+    0xCC56EDD6A66BAE25ULL, 0x615A0C04B1D7AFA9ULL, 0x4E4B9B35719C68B6ULL, 0xB1E9950889FD5666ULL,
+    0x13826CFE25071EC5ULL, 0xB9A87BE5F61AE241ULL, 0x59C116E3F3B5F757ULL, 0x50ED154C10FFDCE2ULL,
+    0x9B84EB7B233709AEULL, 0x47BBCD76AD3983DDULL, 0xE31E851CAA49DD51ULL, 0x6519274671CD99CCULL,
+    0xA652E9BB3B827783ULL, 0xBBA7C54F9801DE13ULL, 0xDB0E5729CFCE1A2FULL, 0xD75E713E169A211BULL,
+    0xCA8076363DF360D6ULL, 0xD46A158613F62509ULL, 0x6B6C2FDCD50D2515ULL, 0x17F09EFB25B62F0DULL,
+    0xE78243E5702077D1ULL, 0x108F187BE93CB70AULL, 0x6577D31226C8B58DULL, 0xDA6CAE7368C1B38FULL,
+    0xADD02F9DEA96B674ULL, 0xFE307D89543CDC50ULL, 0xE38C9969E1E50C6DULL, 0x50EC6814CE8BFF64ULL,
+    0x8CF1A8751DD5CCECULL, 0x015EDCB122248DF3ULL, 0x34584105AB4A537AULL, 0x7ACEE2E6CCF24E26ULL,
+    0xE62A92239B3F10D8ULL, 0xCDEFBA0EAE0D2D17ULL, 0x7073988C6A98DCE0ULL, 0x3C6A1007DB89E095ULL,
+    0x279533B58AC5B521ULL, 0xFB96A925F71F0972ULL, 0x6CE7322D922FBE79ULL, 0xB8D981CD11A1D634ULL,
+    0x972C820066E96D05ULL, 0x17E6D7A41BC2F884ULL, 0xEED156B60B1BDD7CULL, 0xD18DDEBDB2292F68ULL,
+    0xF203A98054B9C306ULL, 0xEDED1406CEF47FFDULL, 0xB1F9AC2E08971264ULL, 0xC77A464147A2F2DBULL,
+    0x093F1DD29D3208CDULL, 0x65178246FBF2BFE6ULL, 0xB05BB331D22CE8DEULL, 0x6C4678AB786E442BULL,
+    0x3DB20464B13FDF5CULL, 0x470F9D23C8EF12D5ULL, 0x918034DD74FA5F74ULL, 0xD2D6050987ACB3A9ULL,
+    0xF4548B897C066F41ULL, 0x7A31E03D34935FF6ULL, 0xD935D6ABFB5146D4ULL, 0x26DB0C16AF8F5E00ULL,
+    0x293F91D06D7C2273ULL, 0xFA2C39FF27E845D5ULL, 0x572FCF4206389ABFULL, 0x0B8323E0696C91D5ULL,
+    0xC8C1BDB9F0A4FEBAULL, 0xF5B388E707FA4C40ULL, 0x0F5159C95A7863EEULL, 0x2E33B545DC91484AULL,
+    0x4BD0E3E28A003B42ULL, 0x05DB8A4440CCDEAEULL, 0x4C915E187033AB44ULL, 0x374ED5C4DD2A6F05ULL,
+    0x15D7B5ED8649D069ULL, 0x6ACC28DDFEC5AA93ULL, 0x7562361D12F1D7ECULL, 0x1EB4AE7DC4535E37ULL,
+    0x3E93A43E71178B12ULL,
+},
+{
+    0xB56E38EF87E6FD8BULL, 0x7DF8E9DB644EC6E6ULL, 0x445AB6EAA2328AA9ULL, 0x77BBEAED0F2525F5ULL,
+    0x0F664432247D59C3ULL, 0x33BAC979ADB3A139ULL, 0x1EDC28DA28073B1BULL, 0x4F52C085C6A4432AULL,
+    0xD500B26FE0119EE5ULL, 0x5CCEFD2499EBF5C5ULL, 0xF2FDE4A8A2891092ULL, 0xD31859EB1373A574ULL,
+    0xF3E3D90CF4C0D83DULL, 0x03561C418824D583ULL, 0xB8065AD4E8435F1EULL, 0x39344505F7021EADULL,
+    0xDD702C496450508DULL, 0x140B5E397CD79DE8ULL, 0x212CCDA2D3103838ULL, 0xE65EEC850B11E369ULL,
+    0x573C0DA53B5AE2E3ULL, 0x9EEAE6D53F5BCD7BULL, 0x30C4840ACEC2A0C3ULL, 0x14B0DB0CB4CA7CD4ULL,
+    0xB681E87312995C1EULL, 0x6601F14E782C2450ULL, 0x72CDF1FEC528BD8DULL, 0xE11FCE146006B2E8ULL,
+    0x22DDAA4F26A045BDULL, 0xD6393F6A7B088095ULL, 0x9D874E380E9C1EE2ULL, 0x2CE68F4E3D370FC0ULL,
+    0x9A7460F1D11329CEULL, 0x16520ABB109A163DULL, 0x8F44F0000C0D3179ULL, 0x03B29D4AF816C973ULL,
+    0xD99AC338E95E8A40ULL, 0x6956D1ECA48520E6ULL, 0x330A19680E208FA5ULL, 0xC2F74B57E030BD20ULL,
+    0xC48C81CC18F6C1B5ULL, 0x4E9C9B157A3B9DCCULL, 0x14EC84E1CD1EA7C0ULL, 0x0EFF3E22DAA0096BULL,
+    0x61F2BB004F0827A7ULL, 0xB1934A1EC520D49AULL, 0x5BA457143318A5ECULL, 0x344926E8AC4195AFULL,
+    0x00E5353E6BC6B86DULL, 0x5EEE548F29D2B4A1ULL, 0x3A50DDE75D1E4292ULL, 0x7C902857C62873A0ULL,
+    0x97988D75FD494D53ULL, 0xA64273D48E8E69A2ULL, 0xE0B62C5F3DB8F895ULL, 0x87D687B019BD8F93ULL,
+    0xDC5B22C877FBA1A7ULL, 0x87B5BB328BF17044ULL, 0xD52177514B8D04CEULL, 0x1F593B1650DFF188ULL,
+    0xACEA8F7F18D6CB16ULL, 0xD48BA302693C7F64ULL, 0x36CCC8B82E7DDFBAULL, 0x4BD79095AC7587DDULL,
+    0x34CD80BD26F0A18DULL, 0x87D687B019BD8F93ULL, 0x7AA85D2C1AC1C808ULL, 0x96D63E337FE6DBDEULL,
+    0xC578E7CACAE60533ULL, 0x8A664A5379AC6249ULL, 0x8FEA20747015223CULL, 0x0BAAACF2AA54FF24ULL,
+    0xB35D6DB3B49FC686ULL, 0x5970300B6E9F5408ULL, 0x7C5B80A3D4E4FA5DULL, 0x0295D8099C1E5BE0ULL,
+    0xCF32D3CF573C5287ULL, 0xA93AD4CAB0D5CE2EULL, 0x720E3953E80120DFULL, 0x81CD9A68968E4A5FULL,
+    0xC1A6616D8C74D0F0ULL, 0x873B7A279D66DCDFULL, 0x6C834A2221D690F1ULL, 0x10D7155DFF905B8EULL,
+    0x3B4B320C128A2D79ULL, 0xAC80D3104EEBED0CULL, 0xB3020C349FD33760ULL, 0x85D653DCFEFD5238ULL,
+    0xDCA84D1AACE9C2D4ULL, 0x2EE3F8030AD866A0ULL, 0x9B9500460B42E8DEULL, 0x82CB9CC6CFEAE7F8ULL,
+    0x904C5BAEC1737543ULL, 0x7BFE58486AABED61ULL, 0x9DB053720A2E4E08ULL, 0xBBA03F3EC6C9BD3FULL,
+    0x875BE488FD6BF36DULL, 0xF2E2F51ED68D3E1DULL, 0xB7F90381A750B906ULL, 0x8205F43119A1D15AULL,
+    0xADB461F5257FFE38ULL, 0xCDC0E08E208ABB45ULL, 0x2DF84FBADB9FC632ULL, 0x3951A0D14AAF1D7BULL,
+    0x3A50DDE75D1E4292ULL, 0x42E2B157ABE677D5ULL, 0x2D7B581775224990ULL, 0x41CCCA19086E3FFDULL,
+    0xB4BC29B54BA88A57ULL, 0xA0E4730A2ADF63D1ULL, 0x510AE3533ACC5818ULL, 0xA23CB6478432D67CULL,
+    0xC1A95327179B35C7ULL, 0xABD4494A099516B2ULL, 0xF0921EED6398B5BEULL, 0x9CB729D6573254FBULL,
+    0xFD1C37822B08431CULL, 0xE7C835248784F14FULL, 0x738AE959D7FEAD8FULL, 0x2B9AAF2521E01FAAULL,
+    0x81CD9A68968E4A5FULL, 0x1E38F455B167A230ULL, 0x4572DD1677DCAEBFULL, 0x50E603B2C1AE04F6ULL,
+    0x6CF55207B60B0C3BULL, 0x3C5B2F46C7AE1F3FULL, 0x9996F30B494ACC88ULL, 0xB1551B2503D7C4FDULL,
+    0xC20BD8475C91A648ULL, 0x9EF7294FB60079E2ULL, 0x4D2E643A4037965FULL, 0xAB0AE5160B11727CULL,
+    0x34DFDAF38DF82C47ULL, 0x284BC4459EB300FBULL, 0x9D4F0BDA7809889AULL, 0xC7CF5A033CB9B1C5ULL,
+    0x5223D424746A5957ULL, 0x8D4118934169BD0CULL, 0xB2257218D239C198ULL, 0xE5290E616AC016ECULL,
+    0x17CD6D3D6195B9CDULL, 0x08F039B0CA8C762AULL, 0x8B5AC1E340E66A7EULL, 0xA794516C9D063479ULL,
+    0x94BCB2C812C54363ULL, 0x9BF017D7A32D206FULL, 0xAB363949FE12913EULL, 0x72F8028D51CA0E6FULL,
+    0xBC0CD332F5B9CCECULL, 0x4B6A00EBF7E41F86ULL, 0xA5E1B60DDBD0F927ULL, 0xF11CC3746F5BA58BULL,
+    0x5BEBAAE0C5E00DCFULL, 0x3F1CE388C3C398DAULL, 0x77BBEAED0F2525F5ULL, 0x0F664432247D59C3ULL,
+    0xC80042A714EB4AA5ULL, 0x98E3897062A68A6AULL, 0xF6A105B70F604473ULL, 0x2C973917AFD1C87DULL,
+    0x0187ECC9652D4762ULL, 0xBA1653B2F1343FFEULL, 0xD99BB10FE6D7A9FBULL, 0x6754C082B4D46C00ULL,
+    0xD6772F89B1FF131DULL, 0x6EE44E5944B76281ULL, 0xEAB0F22FFC1917E6ULL, 0x3204BDE4B20AF587ULL,
+    0x47836BCA3E36290DULL, 0x686D6CAC8FBA312AULL, 0x2C86200E9A0DF076ULL, 0x0B5567966E42782DULL,
+    0x0F8DF886353000F9ULL, 0xBBE35675D4BDBCD4ULL, 0x4E10D85C9C308DC6ULL, 0x459495B486F00666ULL,
+    0x1861A4CBC7827C9BULL, 0x1A8D3867BA35F41EULL, 0xF7C08314E5DB54AAULL, 0x052EF84AED0122EBULL,
+    0x0DABCC7F0E51DFF0ULL, 0xF5F104702E9B72FEULL, 0x1C01671CAB6DE9BEULL, 0xC0B179D7BB9657C0ULL,
+    0x0C1B12C713FD5AF1ULL, 0xE05B7E5000AB6E6CULL, 0x7F56992062F98698ULL, 0x54E3AD1892BCA3ADULL,
+    0x9033112192405F6AULL, 0x367EFFC9227A9E1EULL, 0x50D3169AE1FF5EC1ULL, 0x9EE45B0A64B743F7ULL,
+    0x05C9BA6E03755DE8ULL, 0xB980D5627461823CULL, 0x7095984EBB2379D2ULL, 0x1F28EA1814D1C683ULL,
+    0x56C87F2AE537D6E4ULL, 0xBA72A282013A96C7ULL, 0x81CD9A68968E4A5FULL, 0x67AEE1062D0E423BULL,
+    0xBB0AFAD53D2628C9ULL, 0x088D67A132AC8AE5ULL, 0xB22058989FB1ADC5ULL, 0x3E9C53B135A0528DULL,
+    0x5055A81D042747E3ULL, 0xDFEFEC3D9D2FB7F5ULL, 0xB653C380C6D01D2CULL, 0x4EAD7395DE4A23E8ULL,
+    0x25C8068ABDDDB7CBULL, 0x224D74ABAFE8B8E5ULL, 0xE1EA908CA04F2EFBULL, 0x9FA8050CB35F8250ULL,
+    0xEECB05D2D6D85DF4ULL, 0x480289E58147858CULL, 0xDA22770AD6368E4DULL, 0x5C1C22A75CB48E4EULL,
+    0xDC33D471CF25A5A9ULL, 0x6C69F37B8556AD31ULL, 0x91BA497E776F9E82ULL, 0x553D1ACD53312CD3ULL,
+    0xF65D70EAFF10E8AEULL, 0xC3CDE2CE02810B16ULL, 0x24A18E59313F4A4EULL, 0xB3C99B72E075B864ULL,
+    0xC3CB06573C036538ULL, 0x0C7E6AB53E4C69C7ULL, 0xAD19BF60BA9AFB58ULL, 0xF3E0E6F6D8BC1AA2ULL,
+    0x8E0A0FE8816C6F91ULL, 0x854006B6813CCAFCULL, 0xF37E1B19783F0C55ULL, 0xDC38DEDE486CC41CULL,
+    0x179AAF0C6021188AULL, 0x29D3DDAF3E9DFD25ULL, 0xD44A424940804A68ULL, 0x0BD809DE8A93B601ULL,
+    0x1C47619C22EE806AULL, 0x8FB3BC305FD546A1ULL, 0xCCD326AD67A00958ULL, 0xDD61A50CC7A5E315ULL,
+    0x4D5F66D86B4E9851ULL, 0xAA6BA6E043A9CA86ULL, 0x21C257C5D25B3AF5ULL, 0x88502B0FFA93522FULL,
+    0xE05B7E5000AB6E6CULL, 0x3EAAA00A59B35096ULL, 0x80D82798797C96D7ULL, 0xF3C35216C6C6FBD1ULL,
+    0x81BE14BA0C1995EBULL, 0x929A8EF7068B22AAULL, 0xD184602E560B13E4ULL, 0x1455BC8E57000ADCULL,
+    0x0273F94830582E67ULL, 0x13922886067E55A6ULL, 0xAF47DA55E17C1D71ULL, 0xC5757325D683B1E8ULL,
+    0xEA3F8E9BFFEFF475ULL, 0x889B59056FF9865AULL, 0xA230B68F045013A5ULL, 0x76DBDCA4B2BDD2F3ULL,
+    0x2F5639875D90FA5BULL, 0x7893F2DFF13B6B6AULL, 0x1E14884CA11B89F9ULL, 0x95DBA1CBC98A2911ULL,
+    0x69E89EACE86EF0FFULL, 0x36A616576DEB2EFCULL, 0x948761AC7417212EULL, 0x36A616576DEB2EFCULL,
+    0xFAA0E5DDE3787DC3ULL, 0xDD2F9657616A9D6EULL, 0x8CF04328B3326E5CULL, 0x54F5AF73DA3B3E4CULL,
+    0x81FAD8DB872CB0D9ULL, 0x031522C63CF020AEULL, 0xDEE92F4A43DB5ECDULL, 0x37D95C66B393ABCCULL,
+    0x8DDD19145C414A75ULL, 0xA0143A77FE878B7DULL, 0x9BC5B0F2B6235D17ULL, 0x1AD80F1BABD3709BULL,
+    0xE36AAA054B5F0313ULL, 0x7D55666766CBE66DULL, 0x48CEA2757CDDCFB6ULL, 0x616463442FC37916ULL,
+    0xAF9162060B4C93E8ULL, 0x4F3DFAD132908220ULL, 0x42003F1A7896DEDDULL, 0x699192E073539D8DULL,
+    0x707D6F7DC6291EFFULL, 0xF71D326F1DD13698ULL, 0x8F840DF6DF37B2E0ULL, 0x320CD7C007005341ULL,
+    0x5C49A3B29D84C196ULL, 0xB650C3FD83ABFA45ULL, 0x835053E96939D729ULL, 0x9E05230B75EE0618ULL,
+    0x8E4DB8BB34A06E4BULL, 0x2911450BC39E2C94ULL, 0x4B2F2FE0EBA6690AULL, 0x7098AD4035F0A25DULL,
+    0x57BF3DFA6944BA9EULL, 0x42CD9EB95778B126ULL, 0x2C12F5B0FC12DA14ULL, 0x6394445025645F98ULL,
+    0xFF5DF50F378E049CULL, 0x9076ABD51B7A565AULL, 0x0EA9D454AA77D087ULL, 0x3E5F6602514AE12DULL,
+    0xF959770B862D0EB4ULL, 0x6CAE0A539FECB596ULL, 0x4A253EA17A3B6EE2ULL, 0x7CF5D758476F9709ULL,
+    0x7397DBB87EA64672ULL, 0x227B9035F4C5C97BULL, 0x29B3F94FA9144BEBULL, 0x7F4D0646EC6AFB13ULL,
+    0x42C28051C9AC24B0ULL, 0xFFB7E4D5CEF18417ULL, 0x31748533D6D2A1C0ULL, 0x678AD9969C4CFFD4ULL,
+    0x0E88F03542E1FB61ULL, 0xB02E384C92016C75ULL, 0x2E5452AAFE528511ULL, 0xCCA1A458F57D8EEEULL,
+    0x02433F3CB0A51505ULL, 0x4D6EC3F6B31D8E0EULL, 0x6B34BDC977335586ULL, 0xE11FCE146006B2E8ULL,
+    0xAED8729847F1CD29ULL, 0xE71F6E6E5129CF3EULL, 0x8E7327538A5BFB6DULL, 0xFF60FAD4571D27D1ULL,
+    0x5982D8642F5BDE90ULL, 0x4307E737516EAC11ULL, 0x0371321BC41F69E9ULL, 0xCAA7C2652748F167ULL,
+    0xE8F11214A2121EB2ULL, 0x5206D0315F1DC263ULL, 0xFA632A94686DD605ULL, 0x7151B46089C32597ULL,
+    0x1E627AF23814BAEDULL, 0x6337F0115D48D79BULL, 0x78231AFE7E6D64D2ULL, 0x0AE46ABE6D90D546ULL,
+    0x5605EA7F828562D5ULL, 0x73192FD7474B46D7ULL, 0x86537255798ADA63ULL, 0x0AE98BDD0B4C6C0FULL,
+    0x4FE477CD35EFFCCBULL, 0xF050FD899339F014ULL, 0xD179C1261EC68E5CULL, 0xC92B2CA4E28D0A55ULL,
+    0x21210496B54EA9D6ULL, 0x28D1FF5BA464479DULL, 0x7A57D4706CDD7F0BULL, 0x7A8EA304F3BB7FFEULL,
+    0x839BE5036B47FB9BULL, 0x155406405B8DD74DULL, 0x077B0F969FC53304ULL, 0x4070671F326CC579ULL,
+    0x55DE9628001CBD9DULL, 0x6B19E622845F8337ULL, 0x339BBC620183C1CEULL, 0xC5B74BC7F447EC5EULL,
+    0x24A416AE41559383ULL, 0x2150B6A8241D316CULL, 0xBCAC4608383CB130ULL, 0xCBE3012E9D9D6A10ULL,
+    0x8DEBA1B382EB7F46ULL, 0xE4E7A066FEF53035ULL, 0xE0F4C3338C64A320ULL, 0x87F56CF5DD4F4DDBULL,
+    0x1EF7A2900F66E9D5ULL, 0xEEED27FDDA1DEF25ULL, 0x51654914588C875AULL, 0xDFD34C98B984C1B5ULL,
+    0xAAF7D1FA0446CA17ULL, 0xA342A9ACDD6730FDULL, 0x2B012FAEFEF4F53EULL, 0x23E0210370989A02ULL,
+    0x2A753E4F62408AAFULL, 0x8B9C55F7B30C3926ULL, 0xD28B06B5CB47B55EULL, 0xA41F7A55EFF60DA2ULL,
+    0x73BC6899FFC104EEULL, 0xC900EE9F07DA6CCCULL, 0x64DD75F10C88BFC2ULL, 0x9D9CF289B1F85167ULL,
+    0xB5502AF8CB8F0357ULL, 0xB8BA91BF272BDEABULL, 0xE966457231243975ULL, 0x3BDDE355177290D6ULL,
+    0x2F94ADA1EB4C0DB2ULL, 0x7B688C6C81A811A2ULL, 0xDB0EB20250E0C952ULL, 0x37D95C66B393ABCCULL,
+    0xC5D81EE26370B547ULL, 0x63599FAB2A8FE968ULL, 0x309FA3BCDC95E33FULL, 0x14C33EF0AF513FDAULL,
+    0x0A1C93AA919B6446ULL, 0xCD4AF05C05177450ULL, 0x8C39764CA8EDBA8EULL, 0x499E8BCA06A3BB5AULL,
+    0xECFE658358C1CBB0ULL, 0x4B425B7D20F03905ULL, 0x6871177014471020ULL, 0xD46E931688C2469FULL,
+    0x6DA077C84692A2BCULL, 0xE05B3E12A3C1D9B3ULL, 0xA4E0CE7C6E6E529DULL, 0xD644D828FB70CB08ULL,
+    0x2FA5C0F4538128EAULL, 0xB93CD76FBB9EB035ULL, 0x2EA9F52EA8FF6A1DULL, 0x8C4A59095503B80EULL,
+    0x688E9258E3E13543ULL, 0x1E29DAB401B49F83ULL, 0x2A966B5BF5600C30ULL, 0xB2BF6586C71705B9ULL,
+    0x9636FB05328E36ABULL, 0x34C30411EDA9B3C1ULL, 0x5FCBB2078C7229F6ULL, 0xA17F0DD0A406AB29ULL,
+    0x70726552183F5635ULL, 0x737BA494313FD1ADULL, 0xF1CA2EE23F707DB7ULL, 0xFC50A616EFAFD134ULL,
+    0xDABBE2A244ABB877ULL, 0x8443A131053D5A1EULL, 0x82C7FC328943A09BULL, 0xFC312C77EDA807DFULL,
+    0x2A39938CE599A55BULL, 0x5E47F8B8104CF72FULL, 0x585EEB8573E1983BULL, 0x83DF538D9714732EULL,
+    0xECDBC0BF43879BAFULL, 0x6CF4051D7A097ED9ULL, 0x02433F3CB0A51505ULL, 0xCA4CD719B0BB8CC1ULL,
+    0xD9B12DCA3AE236C0ULL, 0x74ADEEFCFBE47295ULL, 0x3FBDCF2E4A85F192ULL, 0x1FE048F29DF1B323ULL,
+    0xB594196A514D1506ULL, 0x220F7B6C7FCE6B32ULL, 0x3C1C0EF5C45788E6ULL, 0xB65B017139A52E38ULL,
+    0x503836C1CB5C1475ULL, 0x5E098D60A6131AFBULL, 0x87CFCACA9CE82AF0ULL, 0xEFDC176226DC8404ULL,
+    0xFA831C9B5DE507F8ULL, 0x49C0B0B6847EA5A0ULL, 0x43E8B3CBB88EDF23ULL, 0x27B3254263F2D20EULL,
+    0x42AD655335A7F2D3ULL, 0xBB8AFAAAE88823E1ULL, 0xFBD4B2EB628D045CULL, 0xE3A7751DD0DAD9CCULL,
+    0x23FC27447EEDAA7BULL, 0x6C784669FDAAD6A5ULL, 0xADF3616F5CA8BB27ULL, 0x67240A575B72ABA6ULL,
+    0x0FA1959BD8B391CCULL, 0x2677A9602D2D4594ULL, 0xEFCA4D0BCB357816ULL, 0xFF217F16AA3AD61BULL,
+    0x9236A74739BABE0DULL, 0xE3CF991ED3423034ULL, 0x16D23AF5925940FFULL, 0xD5765736582FE78BULL,
+    0x5C92B672CC226354ULL, 0x10CD0DA1020F81D6ULL, 0x09A39517AE514678ULL, 0x034A3A256E35DF61ULL,
+    0xD6D84CC0EFDD7833ULL, 0x94141B266A4E4E54ULL, 0xBCD3FA054D847168ULL, 0x064B689CC980D8B6ULL,
+    0xCAF4B06034AA5CA0ULL, 0xC36239A09440A542ULL, 0x007541079940F5CAULL, 0x57D93DE31902330DULL,
+    0x9897492E71BDD128ULL, 0x3D7F2D6671BFB8A3ULL, 0x6841E27BCC59437BULL, 0xE3A2D438A347E540ULL,
+    0xBAB4D4EB8451B93AULL, 0x64AD6BB5959431DCULL, 0xDD0E878245997F29ULL, 0xA5598C190934279BULL,
+    0x0F60400688508979ULL,
+},
+{
+    0x7DD2B79E9E1DD7D7ULL, 0xDDCB35E8D6CBE60BULL, 0xD8C91D82E929A47CULL, 0x17BE8832AF29E2E3ULL,
+    0x40409EF099573959ULL, 0x9C4B0723CADD6A40ULL, 0xAAA06E4E8A266729ULL, 0x9306B0A3A8564EE8ULL,
+    0x546B523452602AB4ULL, 0xB537F2EB22C63B1CULL, 0x9C8A405D5F62ACAFULL, 0x9C6C8D882CEA4A31ULL,
+    0x05968F7FBADD153DULL, 0xFA01AF49E692EC07ULL, 0xF46AAB15BBBB3488ULL, 0x56448CA326A7D023ULL,
+    0x01F4E7F8250C5728ULL, 0x916910FA355C2349ULL, 0x9A34E6C9AE861C22ULL, 0xAF8153F3B97893A0ULL,
+    0x26B31E89A69F2530ULL, 0xDF0DC56638771A30ULL, 0x75210BF43E7E8BD6ULL, 0x42EA97710B7A8162ULL,
+    0x205B0905AAEE249AULL, 0x2866AEE4B66BA21CULL, 0x5D529120D6960DDDULL, 0xC332457B21D36D82ULL,
+    0x4F65A7FF9A449202ULL, 0xF468FCF544573B5DULL, 0xA22769FAE8F0DE7AULL, 0xC0DF6CECB31853E7ULL,
+    0x50D9714F1C14B72BULL, 0xA858B846978F0B10ULL, 0xAE73F9FDC94DC123ULL, 0x3D82DFD3B9C7E6B0ULL,
+    0x5914BC0949017999ULL, 0xE9C6730F178A9212ULL, 0x61D4F34FC59852B8ULL, 0xF2BBA962B87C3D91ULL,
+    0xC44C5E672B46D829ULL, 0xE4ED8BF2E27449B5ULL, 0x4CAB7AAE9B82FF47ULL, 0xEFBBFEBC7ABA25C1ULL,
+    0x5194876AAF1E5460ULL, 0xE2E6466B8CE0C9C9ULL, 0xD3D58F5686B4E9D0ULL, 0x541ACA1F184A9674ULL,
+    0x351F9C6311B62A80ULL, 0x3AE5177D94A57AA9ULL, 0x7C773A5DD10DB39FULL, 0x080021F248D714F0ULL,
+    0x87A87527CA6DB654ULL, 0x75CD57576C459404ULL, 0xFD4EA59F592756FFULL, 0xB59AFFE770B592EFULL,
+    0x02019FBFFE761CF2ULL, 0x3CB0BD73119DF1ABULL, 0x6F7EFFDA218E8BA4ULL, 0x343AC616A8838F9CULL,
+    0x9DE9109A5A40A5BBULL, 0x54E839F433963047ULL, 0xF98ACB9960EF7C20ULL, 0x4D00A68920A57686ULL,
+    0xD7188E563D77F6A6ULL, 0xB59AFFE770B592EFULL, 0xECCF6B7316972470ULL, 0x11F68495B75F3135ULL,
+    0xAC8C3A03B2E3EB0AULL, 0x2C57EC5EC5A4AD47ULL, 0xE7334DCD46BD521DULL, 0x1480C920ABFE19D1ULL,
+    0xD38532CCBF713556ULL, 0x0B7DB33B2986CDBBULL, 0x16500A6154A867A7ULL, 0x16A15B19C155DFBCULL,
+    0x64D05CD0B1E8DB71ULL, 0x581F738A2F8580BDULL, 0x41ED0149B96F5B16ULL, 0x5FC27B95C22186A4ULL,
+    0xC87F18D5EDF428CEULL, 0xB31729AF3874F981ULL, 0x36AF021B64B467B4ULL, 0x8312AA81B29A0472ULL,
+    0x6D54A236104DA22AULL, 0x0887D9A7EBF0AEFCULL, 0xCF270659916F2E4FULL, 0x8A3AFC5ED8C583E7ULL,
+    0x712B9F7A41946A60ULL, 0xEAFC50FA1E9FF320ULL, 0xCED9EA17BCB80E97ULL, 0x4CB4F9B422ABD14CULL,
+    0x62403C524EB0EF7FULL, 0xC5149FDEEF5DEFE3ULL, 0x16DAA575DC6F58C8ULL, 0x0E1BF0EE589B62E4ULL,
+    0xEF95C81840A7AA1BULL, 0xD011E8CB11655F7FULL, 0x77E46B7C56E2CFFDULL, 0x5B5CB092B894D990ULL,
+    0x8C30FC1B96C30459ULL, 0x829A1FB86BC12EEFULL, 0xAD8CA7B841CB1C5AULL, 0xDF2E52DD9BF67334ULL,
+    0x7C773A5DD10DB39FULL, 0x695E71E77C144D99ULL, 0xF8A0F0C4055EDD58ULL, 0x7276F5AF42ED83CCULL,
+    0x667C15220F193FBAULL, 0xFDC5FC62A45E2716ULL, 0x039AAC2FD0BE74E6ULL, 0x5B2161E8A3647CA4ULL,
+    0x7DDDD39DA69F3992ULL, 0xD602EF9AAFEB8768ULL, 0x7176C91554862CEDULL, 0x170DB07E62C1588CULL,
+    0x7BBDF090DE29C4FEULL, 0x5DB4353A04605FD1ULL, 0x1ADECB078BA57800ULL, 0x5A8759A315BB33F0ULL,
+    0x5FC27B95C22186A4ULL, 0x8F3ACB506786A2E7ULL, 0xABABBA2AEBC35789ULL, 0x3C8EEC3D04302C92ULL,
+    0xD0A79886AFA70132ULL, 0xB7F73E6D7FEAEE29ULL, 0x8AC01B02A13EB01DULL, 0x0BD19FA7230FE0EDULL,
+    0x4138AE5DC1CEC784ULL, 0xCF2CE00C03463C39ULL, 0x640C2B7993338206ULL, 0x0343124E6CC13354ULL,
+    0x5A3ED4657027D475ULL, 0xB19C7AD1E48D81E9ULL, 0xE33DA62ECEF8DF37ULL, 0xC7BD4E3659166A50ULL,
+    0x53DE6C8BD1399114ULL, 0x4CA8853BD5FBA96FULL, 0xE481028720932343ULL, 0x10911445BC0641BCULL,
+    0xA043589C45BDC067ULL, 0xCC8E89F4172EC0F9ULL, 0xD7AF85B4BDC07887ULL, 0x2F0A65CC93B84100ULL,
+    0xFC7041B2008ADC0AULL, 0x17C649A668512799ULL, 0x2328F4EB4A414DEDULL, 0x8C920D89176E4446ULL,
+    0x749A5801D634B8BCULL, 0x0DA15537F836BB32ULL, 0x9690CC64779BCCA5ULL, 0x6B6707F4F5EA061CULL,
+    0x1929C76892C5CA09ULL, 0xEE8859045DA81EC6ULL, 0x17BE8832AF29E2E3ULL, 0x40409EF099573959ULL,
+    0xB158B55DA45B4974ULL, 0x87B8CF8077CD0142ULL, 0xB4343BFD07AE6192ULL, 0x86738562C7E9575DULL,
+    0xE04BE7C35AEDE05EULL, 0xA120CE783F334DA5ULL, 0x6778270DD8C57D33ULL, 0xB393BB1886183383ULL,
+    0xFB786FEA523BFB36ULL, 0xB66F891ADADB9BCDULL, 0xBA8491789ED716DCULL, 0xB1FC2E05838395CBULL,
+    0x41ADD35F20D5A465ULL, 0x13E04AF8741EA7CFULL, 0x85966F8EAEAD3B85ULL, 0xC0E81C3DF8636DC1ULL,
+    0x485632F44A4CFD81ULL, 0x4E9C5A39294E515DULL, 0x4798B3348C4E6392ULL, 0xC5DA7CC9C87AD320ULL,
+    0x5E0E316FD6BF5426ULL, 0x8FE9F43DF768144FULL, 0x2BCC8FA7E32F3910ULL, 0x4C30E6A01B319A7AULL,
+    0x57327B50FFCC36B9ULL, 0xACB49DB1593F842DULL, 0x712A76D8E1FF7140ULL, 0xCE434ADB2A27882EULL,
+    0x4DE72646FE3F3DC1ULL, 0x239DEDAF9D4C61CAULL, 0x26289ED7E687C3ADULL, 0x3CE10E31FABBEEF7ULL,
+    0x04A32FD730C2A9E5ULL, 0x5118802A59C319B2ULL, 0xD32B8D68AC377C05ULL, 0x882035010DF08C55ULL,
+    0x580B53D723099DD1ULL, 0x31DC6378633DD0E4ULL, 0xC36E5B0C04E56874ULL, 0xC47DE99BE64D3C13ULL,
+    0xD8C70033F5712917ULL, 0xFACCD06C3139B5B7ULL, 0x5FC27B95C22186A4ULL, 0x2084EC1E8E44B122ULL,
+    0x4AF8B9BE636B42AEULL, 0x795444551595B41CULL, 0x2D505EF76D8B10E2ULL, 0x072BC1101F3E688CULL,
+    0xD05B6067937EB52DULL, 0x87A87527CA6DB654ULL, 0x2EE222D5485F7B0CULL, 0xE40FCAEA32A75F21ULL,
+    0x0AF2174934BBF433ULL, 0x47B9FFDC7EDAA15CULL, 0x2EC1513692C1317DULL, 0x871218B77CFD9941ULL,
+    0xF96B7A6FCE59E382ULL, 0x5519EBF91E764359ULL, 0xDE3A4EC13DD6DF89ULL, 0xAF8153F3B97893A0ULL,
+    0xF80F84ABE5275B80ULL, 0x8D12BEDBBC2DD655ULL, 0xC518EC55ED369F18ULL, 0xD8890DF307F786DDULL,
+    0x90F0D475CF90C095ULL, 0xB1A6D6A983667005ULL, 0x6FCC2A6FA97B27D6ULL, 0x00E173D06BFD88DFULL,
+    0x83E6D683B91CD8DFULL, 0x3E9B61DCA175C366ULL, 0x69A65C84D1D856B1ULL, 0x25E852821D6D2D39ULL,
+    0xF122973C858B5A43ULL, 0xEE88A25C95CD985EULL, 0x511C033B2887BAF2ULL, 0x70A6F2AE5D7701CFULL,
+    0x4EAE8E8A35A1BEDBULL, 0xCBD3B9429BE29592ULL, 0xACA8CB9097F26B4FULL, 0x3448329A15197EA4ULL,
+    0xD2D1BC6B6C39A400ULL, 0x2129CFCBC7F6B064ULL, 0xB144D7B24525F76BULL, 0x617630AE8D2F9641ULL,
+    0x0AF2174934BBF433ULL, 0x79CC8C9190BC9D2BULL, 0x6FE48856FD5C697FULL, 0x89D7980D5F929EF2ULL,
+    0x239DEDAF9D4C61CAULL, 0xC2438C3BEA0857F5ULL, 0xD39FB3D67F19FC4CULL, 0xD0565C308B3FA78BULL,
+    0xBB48BECBD6703743ULL, 0x7B6AC9891045EEF7ULL, 0x61D680171ABC0CDEULL, 0x1C8BAC4574BE74C9ULL,
+    0x8A184BA88CFDA223ULL, 0xA8A5ABB319B9CFBFULL, 0xA1C5CFEF7EE7BFD8ULL, 0x90667355EE9C3872ULL,
+    0x2982B4633EDCE82DULL, 0xA533C956530251BBULL, 0x4C7F5DDC2BD73193ULL, 0x9FFFA3BE08FDB2E8ULL,
+    0x95F78F805407A0ECULL, 0xCCC0ED84321E08CEULL, 0x65C049751517AB40ULL, 0x2E5285BFF2BEE9FDULL,
+    0x674672EEF6E387F9ULL, 0xAEE54EEF45080227ULL, 0xE2B0B84DACBBDDCDULL, 0xAEE54EEF45080227ULL,
+    0xC243847B00E3E9BAULL, 0x9A4B6BACC30BF039ULL, 0xA4AE0B873C2A64AEULL, 0x6CECA9923F139534ULL,
+    0x818DFF8964045CE9ULL, 0x2B078473D220C249ULL, 0x7D255B8CDB7A24E8ULL, 0x1ED1AB2672986451ULL,
+    0xEBE15E30B2E0507CULL, 0x69F427767E56A8A6ULL, 0x7D1D8E46F8CFD4D1ULL, 0xBB800C984C1C07FDULL,
+    0x9CDD50C7091368FFULL, 0x48885C5036A01AC6ULL, 0xD9338F1FA74570B5ULL, 0x9AA4961DED996874ULL,
+    0x85ADC35E93A50DD7ULL, 0x1AA6DCE8ABD73120ULL, 0x93F8E55903AB1CF2ULL, 0x35DC780634214B6CULL,
+    0x5F016EE11711C3FCULL, 0x67E2E3FF539AE9F0ULL, 0x1CFBDDF6DD2B7AE4ULL, 0x104FC90D03BA99C3ULL,
+    0x4BA7B7413000318DULL, 0x6FC1874171F152E6ULL, 0x37954C5F89806FB0ULL, 0xED68B868BBA1CA98ULL,
+    0x1E724CF4C2193127ULL, 0xACA8CB9097F26B4FULL, 0xFBF9195D620E9535ULL, 0xE04BE7C35AEDE05EULL,
+    0x065EE568E1078933ULL, 0xBDB49165764A4B03ULL, 0xB0872E9A263127D4ULL, 0x08C08A64596160B6ULL,
+    0x462ECF8288610ACEULL, 0x263B810C1535B08DULL, 0x2DE06864F36D4DE9ULL, 0x1952D70C9CC361C8ULL,
+    0xEDB70576901383B6ULL, 0x53A1C6A08E8E38A1ULL, 0x8E2087375017148CULL, 0x32BAA369460422B9ULL,
+    0xAB0BEB96FC0E3EDEULL, 0x41B158D3F904EA72ULL, 0xE2B856C637BCB142ULL, 0x1F28CF613D53D1BBULL,
+    0x79BDDC5340CC96FAULL, 0x7B3BA1530288D7B4ULL, 0xD8D4BB150F9420F1ULL, 0x64E6C5CD079F129DULL,
+    0xA0D6060A31F7A4BDULL, 0x3F332AEE0CADE937ULL, 0x7BA147ECD908C439ULL, 0x01EED3EC3B6CEC19ULL,
+    0xBFC45EBE1BD888C5ULL, 0xDEF519DBA37EDC3EULL, 0x785FCB963C497159ULL, 0xC332457B21D36D82ULL,
+    0x9B2460B9B8DDB9B1ULL, 0xFA529A450FBBCDE4ULL, 0xDA943FB12CA3A2F2ULL, 0xABEB5C3BB05B0825ULL,
+    0xC764625F76E0A40FULL, 0xAD18FEF561FD091DULL, 0x2F7AAA6273C79E6BULL, 0x9CA6C8031DF083A9ULL,
+    0x21212A83C842A01FULL, 0x0BE28BFD83452B03ULL, 0xD923A28A149497F7ULL, 0xA29A4FB0C1373F84ULL,
+    0x8E5FC2B3E58BC3BEULL, 0x3DDDD11270CD7FA5ULL, 0x8DB3C19475782173ULL, 0xE7F6C3137A44B33AULL,
+    0x3F75151531BD83A3ULL, 0x52D74F8B9725C4CDULL, 0x5F715CE2B71C2114ULL, 0xA8D098D388784F1FULL,
+    0xE6A736E9629D24BCULL, 0x7DC31B0BDE2289A0ULL, 0x6FC1874171F152E6ULL, 0x3757660DF18A568BULL,
+    0x9A3AB1E7D4375324ULL, 0x34DD20215E4086EEULL, 0xFB2E1E9A27628BC7ULL, 0xA568B2ADD099740EULL,
+    0xEA827B332A5AB638ULL, 0x4D93797825837335ULL, 0xEE16C364DA5F0CA8ULL, 0xDEFC1190F4418270ULL,
+    0x778D764BD52D3A76ULL, 0x5B6D4079B08A4628ULL, 0xFF741E77D0743C95ULL, 0xC313181DC8E8165DULL,
+    0x6843C3558199D9B6ULL, 0x5A6AAECAC5176E16ULL, 0x39271AA25F051D83ULL, 0x7141F2BC9A1FE331ULL,
+    0xDBCCBC958DCC4383ULL, 0xEBCD83F558F6F956ULL, 0x6D23A61E3C9B8DD5ULL, 0x1A1D62906BACCDBDULL,
+    0x08A135D4A87536DEULL, 0xC2E6E904703F5862ULL, 0x28AF6EC88CA9CDFAULL, 0xA255739F5BE868C8ULL,
+    0x1C409705A6ACA6D2ULL, 0x844B0D5122E0A91BULL, 0xD0888ACF1FFC4819ULL, 0x706273633FC5D306ULL,
+    0x899BF4A74827EA50ULL, 0x977B2449F40A2E8AULL, 0xEAE6BE975A80ED49ULL, 0x94BB453D54F1E3DBULL,
+    0x3B2F84F466300AFEULL, 0x53AA94346CA5CA85ULL, 0x87C60F903B05F775ULL, 0xDEE19C09DC33724AULL,
+    0x1332E01080C9138BULL, 0x872638EC9D7C2AD2ULL, 0x7CF6BB13378CAEFEULL, 0xA61EDE92D72834CEULL,
+    0xF5ADCD3CA003B50DULL, 0x974BB50222D9123EULL, 0xD5A584880D6F5039ULL, 0x1ED1AB2672986451ULL,
+    0xD81B965E08BE164EULL, 0xB288DEF4053D33F4ULL, 0xE04BE7C35AEDE05EULL, 0xF5530DA090FC6A3AULL,
+    0xBE507C7A80696AA8ULL, 0x2814F011D4CB7758ULL, 0x5B44D796C461381BULL, 0xCF869119A974D5E3ULL,
+    0x466863106C6CE349ULL, 0x9FC6B50D44F391EDULL, 0xF45AB9D8889398F9ULL, 0x74A40AF48509A712ULL,
+    0x1DFC6E5FC97132C0ULL, 0xA0DE2AC8F522AD89ULL, 0xF4A76BC917196F92ULL, 0x2A6FA2C0C24497F8ULL,
+    0x4F3E6E8100935DB7ULL, 0x6703FE9F4BCFFC4DULL, 0xF8CCD1823B488077ULL, 0xDAF8822DFA8F70F4ULL,
+    0xF4B10528AD5F49D6ULL, 0xE5B2DCEC6C3B4C5CULL, 0x6267899BC69D25AEULL, 0x3EC0792A05C927FBULL,
+    0x824859568B08CEBBULL, 0xBA1F6A07109A2FA4ULL, 0x3BAC29140D29F974ULL, 0x7283203B23944988ULL,
+    0x3C93A29A7F4471ACULL, 0xDA56EFD393448407ULL, 0x80867E908C25C187ULL, 0xCE73260572E99534ULL,
+    0xDF45A8777386F0CDULL, 0x7391B149C8124850ULL, 0x095EF1B745F7CB5DULL, 0x8E630D50402C52B8ULL,
+    0x47FD4ACDED4FA056ULL, 0xE3F2478581A2183CULL, 0xB10E86C9C15CF67BULL, 0x5550A7D18CB7BE5AULL,
+    0x616D902EE0286BFCULL, 0x95DEBD73DC90CD19ULL, 0xBFC45EBE1BD888C5ULL, 0x9788C69C6A6780C4ULL,
+    0xB89E8260E4A90EC9ULL, 0x7EFE0744A2A4B801ULL, 0x023E6CF9C0DE36F6ULL, 0xBDE345D92E362557ULL,
+    0xEB854DA70C562C65ULL, 0x5F432BB057A6A629ULL, 0x2974C8528EB04596ULL, 0x9CABCB7A4EBB79BDULL,
+    0x22BBFCAC07F9B064ULL, 0x50AB659149970850ULL, 0xDAEA17835458E5C5ULL, 0x577D8F4DD9E29654ULL,
+    0xD1E8F90E4A24A1FCULL, 0x0DD9250BB602B608ULL, 0xD55D76A10863B693ULL, 0x9E3710F853C6989FULL,
+    0x9C1C01F9B7806AADULL, 0x3537E5EE332D0303ULL, 0xDEA386A2DE462D32ULL, 0x9350B10C1E1FB2EDULL,
+    0xE0A38201BE961AD3ULL, 0x162A28088249343FULL, 0xA069DCDE56B901CDULL, 0x7288858AF25309F9ULL,
+    0x27185C73CB100CADULL, 0x5EE999578F344450ULL, 0x0B15FFF07FFF9E88ULL, 0xCF4DAAFCA6EA828EULL,
+    0x0772FF0B62CC6A5EULL, 0x66CE5B7E69D68CA1ULL, 0xA78BF3A06C55E7F9ULL, 0x6DBA3C7FD1A3FE05ULL,
+    0x2D6EB0D8793F1729ULL, 0x34B07DC8C7494D13ULL, 0xE17006D1E10EB953ULL, 0x5E429C36A0E64A28ULL,
+    0xD221E4788A299DCFULL, 0xDE04E0DDD5321649ULL, 0xF16455D7594C9D93ULL, 0x0B99212B92107BE8ULL,
+    0x900A269999E1161FULL, 0x2D2BE79DC477F3BDULL, 0xFD1F6BF0199DA503ULL, 0x25038B8AF012B642ULL,
+    0xB44546DAE169CBADULL, 0x5B2DEC8107BC3E64ULL, 0xFC4BB5CF15851A2EULL, 0x6E2AB5754B1DDA85ULL,
+    0xF5D348216A4D382DULL, 0x278479CCC3AC967DULL, 0xEFD7AAB24395393AULL, 0x9E1B520D810A2831ULL,
+    0x36452201B5455A66ULL,
+},
+{
+    0x8EB6B27C68919110ULL, 0xA48E6CDD00673972ULL, 0x3E6F94CAE7B079EDULL, 0x074E14CDFA5BB3A5ULL,
+    0x9E49C81E3DABD960ULL, 0xF0435C44018A5006ULL, 0x34417BBF46FA7385ULL, 0x1E582B6A92665811ULL,
+    0xDE1E7748D9F67609ULL, 0xF50CCC1CFDD061D0ULL, 0x9BC1141A80B33442ULL, 0x8B2760C510AE7943ULL,
+    0x740095FADA09A938ULL, 0xB2D660CD640FC5D8ULL, 0xAFF20516227FBA79ULL, 0x11A3D942AC5FB6FEULL,
+    0x04BEE58306F1FAE1ULL, 0xC0BFD1A3321AAD56ULL, 0xC47F6D551E76CF9DULL, 0x046DB820B10D49BAULL,
+    0x26FE7DC5B5183705ULL, 0xCAAA9BB5A44289C0ULL, 0x0C5DC79D2FB37490ULL, 0x3E3A891510174F75ULL,
+    0xF2491E3AEAF45279ULL, 0x069CCA40C1E45153ULL, 0xE927936A685F5446ULL, 0xDBFFA6A425527AA3ULL,
+    0xB3D3DE2063AAAC05ULL, 0x62B6F8E002E5F265ULL, 0xD4FA4233A58F469DULL, 0x49091232575AAFA7ULL,
+    0xCB5C04F927C2C8CEULL, 0x5A9193034B586F2DULL, 0xD4B467135C08FE84ULL, 0xE612802F7127BB69ULL,
+    0xA878C5E05DB6CFE4ULL, 0x19B9268309E42A57ULL, 0x0F427552D7BA7AC3ULL, 0xEC6FFDB3FE4C7588ULL,
+    0xFFEAC066888F1D07ULL, 0x40723CCC735ACC2AULL, 0x83872FFCF53CF6A1ULL, 0xB2EDDEE2CA770C5EULL,
+    0xA87B94CF5F38F282ULL, 0x0E02D056AE22B279ULL, 0x82D4B3E9C370FB55ULL, 0xADFC21CAC6DDAD24ULL,
+    0x6DFA1FE77FC4A967ULL, 0x4FC53A07EBF96D8FULL, 0x97D8A422E6918D4DULL, 0xDF92D4F5869ACABEULL,
+    0x80E100F23DD7F80CULL, 0x67AEA8279A031064ULL, 0xC6CD18F81F570E3BULL, 0x9035D5101CB8D820ULL,
+    0x4342A16C1C322E67ULL, 0x122C66F75EE59BA2ULL, 0x5B942A492376B7A5ULL, 0xAE3302FA123CD62DULL,
+    0x867557020A063442ULL, 0x53CC5D57A472C6CFULL, 0x97A5B93D601886ECULL, 0xE64FBE946B38E9C3ULL,
+    0xEB274B7CE3F6E7A9ULL, 0x9035D5101CB8D820ULL, 0x3D5F2FA8DC02922CULL, 0x64B5510C213A802BULL,
+    0x7A1BF910D385B6FBULL, 0xA37EB0EB7F15FE61ULL, 0x65D6B8F608EE34BEULL, 0xBA3F6F443F198597ULL,
+    0xFA34C916478A65EDULL, 0x2787BFD376760A69ULL, 0x862E8053423FE056ULL, 0xB56C76613C4D5B3BULL,
+    0x7BDC0768452FDCC9ULL, 0x53B2CE98127CE1E5ULL, 0xA363EBA5DFE8394CULL, 0x3C03443F14E59D01ULL,
+    0x2FB7D1823876B26DULL, 0x68595A22CC9D3541ULL, 0xDDE430282D281F50ULL, 0x019D336A4EE1160DULL,
+    0x0391C7D4E6333143ULL, 0x4A5E1B8E8C7EBD78ULL, 0xC0B92C801B7E354AULL, 0xD83D50E69FAB07FDULL,
+    0xAAADE5493E5F4B96ULL, 0xF295480349818453ULL, 0xC31897B3CE05A63FULL, 0x24738E6BAA66DBD7ULL,
+    0xD9C3EB0F1FBACC62ULL, 0x2DC01C5C3063E29BULL, 0xC4E6D8240141D9A8ULL, 0x6A088E14EA838FF9ULL,
+    0x30BC94E3AFB57467ULL, 0x9D42C5E641A7ACBAULL, 0x93772EB9990880DEULL, 0x97F5382186C2BF76ULL,
+    0xE755794234DA1476ULL, 0x7BD5F5CABD9A1865ULL, 0x5072F330B556F0C7ULL, 0x243E13DAE654C1ABULL,
+    0x97D8A422E6918D4DULL, 0x243AACF30B01C1CDULL, 0xF5C022228E912664ULL, 0xE9095D42A7998E5CULL,
+    0xA592A2A2E08C7A90ULL, 0x2269CB336DEB2288ULL, 0xD1DD7E0C8774CAE4ULL, 0x123F52F858F7B89AULL,
+    0xB8D6BA0E24546ABCULL, 0xEEBAA8E979EEF675ULL, 0x6E7A7F60C70A9BA8ULL, 0x6187D9FCB4C1FD3DULL,
+    0xF46058A0CD0C813BULL, 0x036522E14E049D6BULL, 0xE7AA8B9E8EFA1615ULL, 0x3994B0DFFEEB7A53ULL,
+    0x3C03443F14E59D01ULL, 0x84DC281921A6EB62ULL, 0x70B276FB8CA6043BULL, 0xFEDBFF61BF3CE061ULL,
+    0x0F095E6976835AEDULL, 0xBC1CD8E848F12A53ULL, 0x6FB853DB2DA6087BULL, 0x6B5A6ADD130F4860ULL,
+    0x0D60F8A2C794EDC8ULL, 0xA7E70CA377CA1B60ULL, 0x18BD489D6F0E0D6CULL, 0xDBBC098C31D1A094ULL,
+    0x5FEBE791A95F2FF8ULL, 0x8EAADC7E907344BBULL, 0xE70440FB93BAE169ULL, 0x0DAB43704E99E0BEULL,
+    0x4AEEBB1522885055ULL, 0xFCAF5E934F909104ULL, 0xF9E36451EA1FA431ULL, 0xDB09747DED79B793ULL,
+    0xC1A6CB06AF7F14BDULL, 0x5878EA2333BAF97AULL, 0xC784E17308C3F41DULL, 0x0E8CCA8DD95FB0B6ULL,
+    0xC6F70BD384177946ULL, 0x93EFC5B2D492E61CULL, 0x93CF1ACACAC9C718ULL, 0x114B6E1C150CAD48ULL,
+    0x76ED5FB54E4EAD6FULL, 0x2E16DCEE2A03CE87ULL, 0x364839E99AEE9A50ULL, 0xFA2A5ACAC12BCEF1ULL,
+    0x252FB13C3E679C14ULL, 0x0DF9F9211AAE5E20ULL, 0x074E14CDFA5BB3A5ULL, 0x9E49C81E3DABD960ULL,
+    0x0AECFA3E9B7AE798ULL, 0x773A32173FC97883ULL, 0xD13D90A3DE3256F8ULL, 0xB36C5AC68DFE5519ULL,
+    0x4DC8EF7E9831AD9DULL, 0x541147C0E8EDC552ULL, 0x56BD0530692AAC06ULL, 0xBD7A797AAB2CFC85ULL,
+    0xDA560C90D8C33CD2ULL, 0x46784D4D5F63A14AULL, 0x20BF707504095FBCULL, 0xC6BCDB2279D50634ULL,
+    0x4D319EB5C221563DULL, 0xEBA6F7FCBACEA4B3ULL, 0xE40C28B16E5444BCULL, 0xABF720031CB4C131ULL,
+    0x1C97E0EA1157F8D4ULL, 0x67894C49EF4B5803ULL, 0x1930A6B14E6D0631ULL, 0x913EE38F94BF5292ULL,
+    0x729AD37F04AFF3D2ULL, 0x5709719A66D5F3C3ULL, 0xF07D0B1F15E61340ULL, 0x0DA3D84838CC03F3ULL,
+    0x157D81D02A834650ULL, 0x7D0D7CCFF428694FULL, 0xF3D63E7FC0D41353ULL, 0xF68337915CCBDDFFULL,
+    0x6BEFD14431261F84ULL, 0x6347D397530A19B0ULL, 0xB5F0DB6BDD0C83CBULL, 0x40801B4916B8D41FULL,
+    0xD1CFD6555EA6EDD6ULL, 0xC6F464A567F5308FULL, 0x3C3CA472686886D8ULL, 0xC8A16D792BB62894ULL,
+    0x660BE7E5DE5BF5EFULL, 0xB374BD8FB2C4907AULL, 0x3DDEA144B5461A62ULL, 0xE948349B30826842ULL,
+    0xD328778B5389DC64ULL, 0xE637AB28CDEC8883ULL, 0x3C03443F14E59D01ULL, 0x916143E26F6E4B6EULL,
+    0xB90F28B658F9C1DDULL, 0x014B0AD27E6F19D7ULL, 0x491C339EC54F4BB0ULL, 0xD4441F18FE3AA35AULL,
+    0xC1C47A35BC7AE492ULL, 0xD842D739A23A9B53ULL, 0xCAE117F77DDFEE6BULL, 0x2289CC00AAFA385DULL,
+    0xA3723E4AF188594AULL, 0xCCD714DC2BE0F994ULL, 0x246CBF206E88FC34ULL, 0xEFE9E7FFF84C6233ULL,
+    0x8E53D327E0861EB3ULL, 0x96BDBF5F3C2C5135ULL, 0xC9110C812C8C8E7BULL, 0xC0525C6A57E52A93ULL,
+    0x596274D23871DC6DULL, 0x25381F77687B4E26ULL, 0x13527B55B1E92FD9ULL, 0x4B9088213CC1BC70ULL,
+    0xED80F677C203D4AEULL, 0x9764E61EAA8F63DEULL, 0x741CB61FB6936086ULL, 0xFCA6C5C7A9C84356ULL,
+    0xBF7E52F0B63C08CCULL, 0x85B8248B5A5162AEULL, 0x107C1523EBB762DFULL, 0x52628387B6FA1C69ULL,
+    0x46D1E552498E7AF5ULL, 0xDFD96BA5A761626BULL, 0x2203C1D0C0C85DBBULL, 0x1308F6E99A95EEF0ULL,
+    0x2FA6EC313F2F1F6EULL, 0x5979284364898541ULL, 0xCBE0C5CF2FC08682ULL, 0x8CF99403ABF802D6ULL,
+    0x71D7A0BC50677F51ULL, 0xA95F4BA9CDE4009EULL, 0x0BAD2E4189099A16ULL, 0x107B163D30EB68CEULL,
+    0x09D9EB5876682BAFULL, 0x21E641ADD402098AULL, 0x7F80EE4834888622ULL, 0xCFC59CB6C5807C38ULL,
+    0x6347D397530A19B0ULL, 0x07D11224159425B3ULL, 0xFD86EE3C7DDAB866ULL, 0xB78C483D24D8730AULL,
+    0x1BCEC41FBD09CCF3ULL, 0x1096E59F14026B96ULL, 0x1C976D991A35A2E1ULL, 0x22CD92B0EFA25AD4ULL,
+    0xF0DFEDECCB9D2BD2ULL, 0xEC09F5317C5E8762ULL, 0x0742C62C15CC1BC0ULL, 0x4874C3B349F6C6C4ULL,
+    0x655ED42FD1B2B7A6ULL, 0x173057B696577D19ULL, 0xE2ED9D54EDEB8606ULL, 0x8EE1ED590508381BULL,
+    0x89693C62AD7A9C21ULL, 0x981813C44DE655CAULL, 0xCB8BF028422E47B8ULL, 0xAEBF91E5AFC2A653ULL,
+    0x5F5821685FE4B184ULL, 0x3834FC06D2DB6DD8ULL, 0xF73BF7EEA6C6B1D0ULL, 0x3834FC06D2DB6DD8ULL,
+    0xC9150D44397FB3E8ULL, 0x2542761D75B0E427ULL, 0x2E559708741C285EULL, 0x271909F4BC0CEC5DULL,
+    0x292C7FA2046A6217ULL, 0x5925E17531149EF1ULL, 0x54610989B57F5E84ULL, 0x2FC5DD1F484D5EDBULL,
+    0x90538889CC0845D5ULL, 0x3BD994698A0086AFULL, 0x27B617D90B6BAE0AULL, 0xE820F633D047655CULL,
+    0xEA15ECD993028B00ULL, 0xBE54E3CF7444D638ULL, 0x1F33739F1976A2F9ULL, 0x5C5B25981A350561ULL,
+    0xA9F16638055B2640ULL, 0x99781F4C53192A06ULL, 0xC024E1F9B97A5609ULL, 0xB8B8A3F8447C6D5FULL,
+    0xA44B3CD385F38F02ULL, 0x9655822778D85707ULL, 0x7B4F3C1C2EAFEF11ULL, 0xC11D2200D8059CBBULL,
+    0x37FCE54BE131C213ULL, 0x4B997AFAAC59C480ULL, 0xC4603A381C34F0EEULL, 0xC764E3424C588D77ULL,
+    0x3C84E1A73396B962ULL, 0xD115BA7F1FED0A34ULL, 0x268C8E8FE14F3313ULL, 0x7A3E20EC908136B5ULL,
+    0x79C9524ED0FEAA12ULL, 0x41588FEC4F6CA6B2ULL, 0x9A6B326A917C4B49ULL, 0x382B956EE3658B81ULL,
+    0x4BA6FBEE0B683369ULL, 0x6A5F7B87C6BF4350ULL, 0x0822F71C682C5F3BULL, 0x0F56B0B2D0D66402ULL,
+    0x57073F02B4275003ULL, 0x1DC8A9B5C76988F0ULL, 0xC8E34564CE88BF94ULL, 0x9EFD3F28E6DF6D1EULL,
+    0x0636FDDE8757E144ULL, 0x7121D62BE876E49DULL, 0xE7BD3F4AF1B2B25BULL, 0xDDBC394F0B93340BULL,
+    0xE5A1EC6C26F0A24CULL, 0x8D338320168150B8ULL, 0x4DCC15CF928662F3ULL, 0xD99F40140A464AB2ULL,
+    0x28557B789ABB3799ULL, 0xE85BB7C901B12B82ULL, 0x3580A85CB2C1BDA3ULL, 0x843113A5DCB5A01BULL,
+    0x2F1F203A6E23DEF3ULL, 0x2D431AAB0C4B34F0ULL, 0x8D328E2B274A4839ULL, 0xDBFFA6A425527AA3ULL,
+    0x66FC48BB7C73408FULL, 0x717BBC42E8CD408FULL, 0x59AEEA8B2E0F5044ULL, 0xE4417D536E0BE8B9ULL,
+    0x3F964A3886E7546EULL, 0x65F04A140305C90DULL, 0x1488AA73BD4EC373ULL, 0x13105D478B609029ULL,
+    0x1A1F7CFAA0212B65ULL, 0x2B5E931878AEC683ULL, 0xACD9081780AB8B9AULL, 0xA3EC2A922A05ADADULL,
+    0x1348BCCC734E695FULL, 0x54D37120E8A73B11ULL, 0xE9CCA65C6D4231FDULL, 0x8BA56848CC9668E8ULL,
+    0x99246C3537EA615AULL, 0x2CFE5977B566B516ULL, 0xB9716C9A22AC11DEULL, 0xC66E01AF5CD7D553ULL,
+    0x2E855DF28229E4CAULL, 0x7FBB14B0B52CF3CFULL, 0x87E97D8FBB016329ULL, 0xEBA54813B69E5EC4ULL,
+    0x2FF4F701DC9E2BF7ULL, 0x31F4E4D9161B8FC0ULL, 0xD88F4BFEC909C35AULL, 0xE796AAC5C0D7370CULL,
+    0xFAD422A78F930AE5ULL, 0x9006E6A9CE4219BAULL, 0xF13945E5B1E22D5FULL, 0x6D792291D92A31FEULL,
+    0xAFDD87F99C9DCF23ULL, 0x69AF7EEFBB18ECEAULL, 0x23755FD448EFA3BAULL, 0xFA34E88917DD0C70ULL,
+    0x4A2031139FA00792ULL, 0x07A05612E31BC0CCULL, 0x0F2FEC804A071679ULL, 0x8B776373929CF22AULL,
+    0x7F77DD8D03B0873BULL, 0x982482C77DD08C2DULL, 0x059B2EB17BDF0AC8ULL, 0x91CDFC15EFA482C6ULL,
+    0x7A94040A4B8FB6F8ULL, 0xFA2C0EABAD2471A3ULL, 0x1C1A9D749AFC4DA2ULL, 0x11B756107743CCA8ULL,
+    0xC0138D8C5B487AA2ULL, 0x90D0C7C0E7D83959ULL, 0xA1465641DFF5D50AULL, 0xD4D93FE417D8F1F0ULL,
+    0x959F08DEE13B41A9ULL, 0x28C27387F593E8A6ULL, 0xE1FAC9B3E3F21327ULL, 0xA96443711188322CULL,
+    0x283E730492B2506DULL, 0x45F2687263042366ULL, 0x749C0208CE0DA6CFULL, 0x5BBAC3D645D4C7DDULL,
+    0x542DDB0A0DCA4666ULL, 0xC4BE9D8078E2CF1AULL, 0x0517375D7122806BULL, 0xC1F1305C8D721637ULL,
+    0x56219E8C0E27F6CBULL, 0x58B9ABD5F69C0D41ULL, 0x6BA08C5DF495B02FULL, 0x2FC5DD1F484D5EDBULL,
+    0x5D5F94425BD0C891ULL, 0xA61B63EE3E81E6D1ULL, 0xEE6378979D7B0846ULL, 0x6BF187FE42E1A43DULL,
+    0xF34A32491E2C91A2ULL, 0x994D5CA11BEAF0EBULL, 0xD6FD5946FAAB96A9ULL, 0xB5D47AA00317DEDDULL,
+    0x96CF4790255ED7EFULL, 0x080EB6BD993E14C9ULL, 0xAF3D75E2C6307F4AULL, 0xC243DE5AA60ADD6CULL,
+    0x18CD7C6D960CF255ULL, 0x546B5BAFE56FECA2ULL, 0x735C59782482B1BBULL, 0x177BC8604C39A660ULL,
+    0x436B9E05421D10D3ULL, 0xBCDAFD504150B08CULL, 0x46C2FD738F004D24ULL, 0x1669ACD6AEA30458ULL,
+    0x9D27DAF6A89F7783ULL, 0xDFC429A2450C9221ULL, 0x2BD82924CFC64D6EULL, 0xB6BB8542C650CE0EULL,
+    0x96F7A73EEE03A95BULL, 0xCABA769C7CDE4FEBULL, 0x11550D87B4951321ULL, 0x5CA8C9E1631DD5FCULL,
+    0x9A8C34AF8C31B301ULL, 0xEDEA191CA61AA6E1ULL, 0xC6D210AA8B7BBD2BULL, 0x6F99B75651762AA9ULL,
+    0xB394B70559FE6527ULL, 0xC90BFA86FFB6391EULL, 0x52C4518D0A9DEE3AULL, 0xDBFA42A6BA494DEFULL,
+    0xB3F4BA170A0F750BULL, 0xAAB290675A4A9993ULL, 0x538F453D3DE899B7ULL, 0xBA1CF3F34F02B6E4ULL,
+    0x164CD6D4D701DDB5ULL, 0x5F97D2AE017CD0C8ULL, 0x2F1F203A6E23DEF3ULL, 0x97A7BF1E2BB3B729ULL,
+    0xC0AD6B43A3F557C4ULL, 0x5C88B18864760119ULL, 0xFAFF003075EE8FC6ULL, 0xB75476E665E370DDULL,
+    0x499391AE22B11C95ULL, 0x89661C01B2EF48B8ULL, 0x973938D482B64006ULL, 0x1FB832521E89869DULL,
+    0x2A99378FF5403BF2ULL, 0xFC1FA38DB54A4F04ULL, 0x858C285347621D12ULL, 0x6A798486001DB359ULL,
+    0x82D7AAE85200EC48ULL, 0x1C2072BA4D095261ULL, 0x9A4DECC9154BD7C9ULL, 0xD8EB3A0CF3AFE527ULL,
+    0x33F84997D52B50CAULL, 0xAB29EB67F1C5EAFAULL, 0x3EFA554FEC291734ULL, 0x8A18701AF5E69499ULL,
+    0x72290FAD6084783DULL, 0x00728837AE9FD982ULL, 0x1979A467C5EF402DULL, 0x142A530FD12E5186ULL,
+    0xD7BB72ED7DE5104BULL, 0x88979912A5F2F539ULL, 0xCAA498D4229BF65CULL, 0x31474183F146422CULL,
+    0x14E0203B7C188C06ULL, 0x97848E0A5DB31132ULL, 0xA644C8B6F5114972ULL, 0x84EFBE884CE90219ULL,
+    0xFCCAA22E5AFF4FD3ULL, 0x74B53CBB26EF5305ULL, 0x6756241FBF11B7FFULL, 0x1BFABCBFE222CAEAULL,
+    0xD024605374AE7AE8ULL, 0xA3508D22063DDA70ULL, 0x87E5624E43EDFC26ULL, 0x6E88381EF74A1B8BULL,
+    0xA36A5BEB6F2B7BEAULL, 0x63F4FEE8CF37A6EEULL, 0x21D0100750DE131CULL, 0x4D5D979B6B808ECFULL,
+    0x5379194D41FA4A5AULL, 0xFD9C6F629538827CULL, 0x543512D0646CCB92ULL, 0x928F8499811B0814ULL,
+    0x34B1FE2B792F7BD3ULL, 0x7390A6362D69048FULL, 0x4FDDDD0BF0BB93C1ULL, 0x88094EA0BE64A9AEULL,
+    0x5C1A41CA94B4581BULL,
+},
@@ -0,0 +1,473 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdarg.h>
+#include <ctype.h>
+#include <errno.h>
+#include <unistd.h>
+#include "gamedata.h"
+
+const char * const kGameDataHeaders[GAMEDATA_NUM_HEADERS] = {
+    "include/constants/pokemon.h",
+    "include/constants/abilities.h",
+    "include/constants/items.h",
+    "include/constants/moves.h",
+    "include/constants/species.h",
+    "include/constants/battle.h",
+};
+
+noreturn void fatal_error(const char * message, ...)
+{
+    va_list va_args;
+    va_start(va_args, message);
+    fputs("Error: ", stderr);
+    vfprintf(stderr, message, va_args);
+    fputc('\n', stderr);
+    va_end(va_args);
+    exit(EXIT_FAILURE);
+}
+
+static void * ReadWholeFile(const char * root, const char * relPath, size_t * size)
+{
+    char path[4096];
+    snprintf(path, sizeof(path), "%s/%s", root, relPath);
+    FILE * file = fopen(path, "rb");
+    if (file == NULL)
+    {
+        fatal_error("%s: %s", path, strerror(errno));
+    }
+    fseek(file, 0, SEEK_END);
+    long length = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    char * buffer = malloc(length + 1);
+    if (buffer == NULL)
+    {
+        fatal_error("out of memory reading %s", path);
+    }
+    if (fread(buffer, 1, length, file) != (size_t)length)
+    {
+        fatal_error("%s: short read", path);
+    }
+    fclose(file);
+    buffer[length] = '\0';
+    *size = length;
+    return buffer;
+}
+
+void SymbolTable_Init(SymbolTable * table)
+{
+    table->entries = NULL;
+    table->count = 0;
+    table->capacity = 0;
+}
+
+void SymbolTable_Free(SymbolTable * table)
+{
+    for (size_t i = 0; i < table->count; i++)
+    {
+        free(table->entries[i].name);
+    }
+    free(table->entries);
+    SymbolTable_Init(table);
+}
+
+void SymbolTable_Add(SymbolTable * table, const char * name, int32_t value)
+{
+    if (table->count == table->capacity)
+    {
+        table->capacity = table->capacity ? table->capacity * 2 : 1024;
+        table->entries = realloc(table->entries, table->capacity * sizeof(Symbol));
+        if (table->entries == NULL)
+        {
+            fatal_error("out of memory");
+        }
+    }
+    table->entries[table->count].name = strdup(name);
+    table->entries[table->count].value = value;
+    table->count++;
+}
+
+bool SymbolTable_LoadHeader(SymbolTable * table, const char * path)
+{
+    char line[1024];
+    FILE * file = fopen(path, "r");
+    if (file == NULL)
+    {
+        return false;
+    }
+    while (fgets(line, sizeof(line), file) != NULL)
+    {
+        char name[256];
+        char value[256];
+        // Only plain integers: anything built from other macros is skipped
+        if (sscanf(line, " #define %255s %255s", name, value) == 2)
+        {
+            char * end;
+            long long val = strtoll(value, &end, 0);
+            if (end != value && (*end == '\0' || (end[0] == '/' && end[1] == '/')))
+            {
+                SymbolTable_Add(table, name, (int32_t)val);
+            }
+        }
+    }
+    fclose(file);
+    return true;
+}
+
+bool SymbolTable_Find(const SymbolTable * table, const char * name, int32_t * value)
+{
+    for (size_t i = 0; i < table->count; i++)
+    {
+        if (strcmp(table->entries[i].name, name) == 0)
+        {
+            *value = table->entries[i].value;
+            return true;
+        }
+    }
+    return false;
+}
+
+const char * SymbolTable_Name(const SymbolTable * table, const char * prefix, int32_t value)
+{
+    size_t prefixLen = strlen(prefix);
+    for (size_t i = 0; i < table->count; i++)
+    {
+        if (table->entries[i].value == value && strncmp(table->entries[i].name, prefix, prefixLen) == 0)
+        {
+            return table->entries[i].name;
+        }
+    }
+    return NULL;
+}
+
+bool GameData_ParseValue(const GameData * data, const char * arg, int32_t * value)
+{
+    char * end;
+    long long val = strtoll(arg, &end, 0);
+    if (*arg != '\0' && *end == '\0')
+    {
+        *value = (int32_t)val;
+        return true;
+    }
+    return SymbolTable_Find(&data->symbols, arg, value);
+}
+
+const char * GameData_FindRoot(void)
+{
+    static const char * const candidates[] = { ".", "..", "../.." };
+    for (size_t i = 0; i < sizeof(candidates) / sizeof(candidates[0]); i++)
+    {
+        char path[4096];
+        snprintf(path, sizeof(path), "%s/%s", candidates[i], GAMEDATA_ASM_PATH);
+        if (access(path, R_OK) == 0)
+        {
+            return candidates[i];
+        }
+    }
+    return NULL;
+}
+
+// NARC: header, then BTAF (start/end per member), BTNF, GMIF (member data)
+static const uint8_t * Narc_Member(const uint8_t * narc, size_t size, int idx, uint32_t * memberSize, int * count)
+{
+    if (size < 16 || memcmp(narc, "NARC", 4) != 0)
+    {
+        return NULL;
+    }
+    uint32_t fatOffset = narc[12] | (narc[13] << 8);
+    const uint8_t * fat = narc + fatOffset;
+    if (fatOffset + 12 > size || memcmp(fat, "BTAF", 4) != 0)
+    {
+        return NULL;
+    }
+    uint32_t fatSize = fat[4] | (fat[5] << 8) | (fat[6] << 16) | ((uint32_t)fat[7] << 24);
+    *count = fat[8] | (fat[9] << 8);
+    const uint8_t * fnt = fat + fatSize;
+    if (fnt + 8 > narc + size || memcmp(fnt, "BTNF", 4) != 0)
+    {
+        return NULL;
+    }
+    uint32_t fntSize = fnt[4] | (fnt[5] << 8) | (fnt[6] << 16) | ((uint32_t)fnt[7] << 24);
+    const uint8_t * img = fnt + fntSize;
+    if (img + 8 > narc + size || memcmp(img, "GMIF", 4) != 0 || idx >= *count)
+    {
+        return NULL;
+    }
+    const uint8_t * entry = fat + 12 + 8 * idx;
+    uint32_t start = entry[0] | (entry[1] << 8) | (entry[2] << 16) | ((uint32_t)entry[3] << 24);
+    uint32_t end = entry[4] | (entry[5] << 8) | (entry[6] << 16) | ((uint32_t)entry[7] << 24);
+    if (end < start || img + 8 + end > narc + size)
+    {
+        return NULL;
+    }
+    *memberSize = end - start;
+    return img + 8 + start;
+}
+
+static void LoadPersonal(GameData * data, const char * root)
+{
+    size_t size;
+    uint8_t * narc = ReadWholeFile(root, GAMEDATA_PERSONAL_PATH, &size);
+    uint32_t memberSize;
+    int count = 0;
+    if (Narc_Member(narc, size, 0, &memberSize, &count) == NULL)
+    {
+        fatal_error("%s: not a NARC", GAMEDATA_PERSONAL_PATH);
+    }
+    data->numPersonal = count;
+    data->personal = calloc(count, sizeof(BaseStats));
+    for (int i = 0; i < count; i++)
+    {
+        const uint8_t * p = Narc_Member(narc, size, i, &memberSize, &count);
+        if (p == NULL || memberSize < 0x18)
+        {
+            fatal_error("%s: bad member %d", GAMEDATA_PERSONAL_PATH, i);
+        }
+        BaseStats * stats = &data->personal[i];
+        stats->hp = p[0x00];
+        stats->atk = p[0x01];
+        stats->def = p[0x02];
+        stats->speed = p[0x03];
+        stats->spatk = p[0x04];
+        stats->spdef = p[0x05];
+        stats->types[0] = p[0x06];
+        stats->types[1] = p[0x07];
+        stats->genderRatio = p[0x10];
+        stats->abilities[0] = p[0x16];
+        stats->abilities[1] = p[0x17];
+    }
+    free(narc);
+}
+
+static void LoadMoves(GameData * data, const char * root)
+{
+    size_t size;
+    uint8_t * narc = ReadWholeFile(root, GAMEDATA_MOVES_PATH, &size);
+    uint32_t memberSize;
+    int count = 0;
+    if (Narc_Member(narc, size, 0, &memberSize, &count) == NULL)
+    {
+        fatal_error("%s: not a NARC", GAMEDATA_MOVES_PATH);
+    }
+    data->numMoves = count;
+    data->moves = calloc(count, sizeof(MoveTbl));
+    for (int i = 0; i < count; i++)
+    {
+        const uint8_t * p = Narc_Member(narc, size, i, &memberSize, &count);
+        if (p == NULL || memberSize < 0x0B)
+        {
+            fatal_error("%s: bad member %d", GAMEDATA_MOVES_PATH, i);
+        }
+        MoveTbl * move = &data->moves[i];
+        move->effect = p[0] | (p[1] << 8);
+        move->class = p[2];
+        move->power = p[3];
+        move->type = p[4];
+        move->accuracy = p[5];
+        move->pp = p[6];
+        move->effectChance = p[7];
+        move->range = p[8] | (p[9] << 8);
+        move->priority = (int8_t)p[10];
+    }
+    free(narc);
+}
+
+// Splits a CSV line in place. Returns the number of fields.
+static int SplitCsv(char * line, char ** fields, int maxFields)
+{
+    int n = 0;
+    char * p = line;
+    while (n < maxFields)
+    {
+        fields[n++] = p;
+        p = strchr(p, ',');
+        if (p == NULL)
+        {
+            break;
+        }
+        *p++ = '\0';
+    }
+    return n;
+}
+
+static int32_t ParseCsvValue(GameData * data, const char * field, int lineNo)
+{
+    int32_t value;
+    if (!GameData_ParseValue(data, field, &value))
+    {
+        fatal_error("%s:%d: unknown value %s", GAMEDATA_ITEMS_PATH, lineNo, field);
+    }
+    return value;
+}
+
+// item_data.csv is packed into item_data.narc in row order, and the game
+// reaches a row through sItemNarcIds (src/item.c). Each row names its item, so
+// the table here is indexed by that name's ITEM_ value instead.
+static void LoadItems(GameData * data, const char * root)
+{
+    size_t size;
+    char * csv = ReadWholeFile(root, GAMEDATA_ITEMS_PATH, &size);
+    int capacity = 1024;
+    data->items = calloc(capacity, sizeof(ItemData));
+    data->numItems = 0;
+    int lineNo = 0;
+    char * save;
+    for (char * line = strtok_r(csv, "\r\n", &save); line != NULL; line = strtok_r(NULL, "\r\n", &save))
+    {
+        char * fields[4];
+        int32_t itemId;
+        lineNo++;
+        if (lineNo == 1)
+        {
+            continue;
+        }
+        if (SplitCsv(line, fields, 4) < 4)
+        {
+            fatal_error("%s:%d: too few columns", GAMEDATA_ITEMS_PATH, lineNo);
+        }
+        if (!SymbolTable_Find(&data->symbols, fields[0], &itemId) || itemId < 0 || itemId >= 0x10000)
+        {
+            fatal_error("%s:%d: unknown item %s", GAMEDATA_ITEMS_PATH, lineNo, fields[0]);
+        }
+        while (itemId >= capacity)
+        {
+            data->items = realloc(data->items, 2 * capacity * sizeof(ItemData));
+            memset(data->items + capacity, 0, capacity * sizeof(ItemData));
+            capacity *= 2;
+        }
+        data->items[itemId].holdEffect = ParseCsvValue(data, fields[2], lineNo);
+        data->items[itemId].holdEffectParam = ParseCsvValue(data, fields[3], lineNo);
+        if (itemId >= data->numItems)
+        {
+            data->numItems = itemId + 1;
+        }
+    }
+    free(csv);
+}
+
+// Reads count bytes of .byte data starting at label, carrying on through any
+// labels in between, as the game's own tables sometimes run across them.
+static void ReadAsmBytes(GameData * data, const char * text, const char * label, uint8_t * out, int count)
+{
+    char needle[256];
+    snprintf(needle, sizeof(needle), "\n%s:", label);
+    const char * p = strstr(text, needle);
+    if (p == NULL)
+    {
+        fatal_error("%s: label %s not found", GAMEDATA_ASM_PATH, label);
+    }
+    p = strchr(p + 1, '\n');
+    int n = 0;
+    while (n < count && p != NULL && *p != '\0')
+    {
+        char line[1024];
+        const char * eol = strchr(p + 1, '\n');
+        size_t len = eol ? (size_t)(eol - p - 1) : strlen(p + 1);
+        if (len >= sizeof(line))
+        {
+            len = sizeof(line) - 1;
+        }
+        memcpy(line, p + 1, len);
+        line[len] = '\0';
+        p = eol;
+
+        char * comment = strchr(line, ';');
+        if (comment != NULL)
+        {
+            *comment = '\0';
+        }
+        char * s = line;
+        while (isspace((unsigned char)*s))
+        {
+            s++;
+        }
+        if (*s == '\0' || strncmp(s, ".public", 7) == 0 || strchr(s, ':') != NULL)
+        {
+            continue;
+        }
+        if (strncmp(s, ".byte", 5) != 0)
+        {
+            break;
+        }
+        char * save;
+        for (char * tok = strtok_r(s + 5, ", \t", &save); tok != NULL && n < count; tok = strtok_r(NULL, ", \t", &save))
+        {
+            int32_t value;
+            if (!GameData_ParseValue(data, tok, &value))
+            {
+                fatal_error("%s: %s: unknown value %s", GAMEDATA_ASM_PATH, label, tok);
+            }
+            out[n++] = (uint8_t)value;
+        }
+    }
+    if (n < count)
+    {
+        fatal_error("%s: %s: expected %d bytes, found %d", GAMEDATA_ASM_PATH, label, count, n);
+    }
+}
+
+static void LoadAsmTables(GameData * data, const char * root)
+{
+    size_t size;
+    char * text = ReadWholeFile(root, GAMEDATA_ASM_PATH, &size);
+    uint8_t bytes[MAX_TYPE_CHART * 3];
+    int32_t endTable;
+
+    if (!SymbolTable_Find(&data->symbols, "TYPE_ENDTABLE", &endTable))
+    {
+        fatal_error("TYPE_ENDTABLE is not defined");
+    }
+    // The chart's length isn't known up front: read it one entry at a time
+    data->numTypeChart = 0;
+    for (;;)
+    {
+        if (data->numTypeChart == MAX_TYPE_CHART)
+        {
+            fatal_error("%s: sTypeEffectiveness has no end marker", GAMEDATA_ASM_PATH);
+        }
+        ReadAsmBytes(data, text, "sTypeEffectiveness", bytes, (data->numTypeChart + 1) * 3);
+        memcpy(data->typeChart[data->numTypeChart], bytes + data->numTypeChart * 3, 3);
+        if (data->typeChart[data->numTypeChart++][0] == endTable)
+        {
+            break;
+        }
+    }
+
+    ReadAsmBytes(data, text, "sStatChangeTable", bytes, NUM_STAT_STAGES * 2);
+    memcpy(data->statStageRatio, bytes, NUM_STAT_STAGES * 2);
+    ReadAsmBytes(data, text, "ov12_0226CC3A", bytes, NUM_TYPE_BOOST_ITEMS * 2);
+    memcpy(data->typeBoostItems, bytes, NUM_TYPE_BOOST_ITEMS * 2);
+    ReadAsmBytes(data, text, "ov12_0226CBBE", bytes, NUM_IRON_FIST_MOVES * 2);
+    for (int i = 0; i < NUM_IRON_FIST_MOVES; i++)
+    {
+        data->ironFistMoves[i] = bytes[2 * i] | (bytes[2 * i + 1] << 8);
+    }
+    free(text);
+}
+
+void GameData_Load(GameData * data, const char * root)
+{
+    memset(data, 0, sizeof(*data));
+    SymbolTable_Init(&data->symbols);
+    for (int i = 0; i < GAMEDATA_NUM_HEADERS; i++)
+    {
+        char path[4096];
+        snprintf(path, sizeof(path), "%s/%s", root, kGameDataHeaders[i]);
+        if (!SymbolTable_LoadHeader(&data->symbols, path))
+        {
+            fatal_error("%s: %s", path, strerror(errno));
+        }
+    }
+    LoadPersonal(data, root);
+    LoadMoves(data, root);
+    LoadItems(data, root);
+    LoadAsmTables(data, root);
+}
+
+void GameData_Free(GameData * data)
+{
+    SymbolTable_Free(&data->symbols);
+    free(data->personal);
+    free(data->moves);
+    free(data->items);
+}
@@ -0,0 +1,114 @@
+#ifndef GUARD_DMGCALC_GAMEDATA_H
+#define GUARD_DMGCALC_GAMEDATA_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdnoreturn.h>
+
+// Where each table is read from, relative to the repository root
+#define GAMEDATA_ASM_PATH      "asm/overlay_12_0224E4FC_s.s"
+#define GAMEDATA_PERSONAL_PATH "files/poketool/personal/personal.narc"
+#define GAMEDATA_MOVES_PATH    "files/poketool/waza/waza_tbl.narc"
+#define GAMEDATA_ITEMS_PATH    "files/itemtool/itemdata/item_data.csv"
+
+// Headers whose integer #defines are loaded as symbols
+#define GAMEDATA_NUM_HEADERS 6
+extern const char * const kGameDataHeaders[GAMEDATA_NUM_HEADERS];
+
+#define NUM_STAT_STAGES       13
+#define NUM_TYPE_BOOST_ITEMS  33
+#define NUM_IRON_FIST_MOVES   15
+#define MAX_TYPE_CHART        256
+
+// struct BaseStats (include/pokemon_types_def.h), 44 bytes in personal.narc
+typedef struct BaseStats
+{
+    uint8_t hp;
+    uint8_t atk;
+    uint8_t def;
+    uint8_t speed;
+    uint8_t spatk;
+    uint8_t spdef;
+    uint8_t types[2];
+    uint8_t genderRatio;
+    uint8_t abilities[2];
+} BaseStats;
+
+// struct MoveTbl (include/move.h), 16 bytes in waza_tbl.narc
+typedef struct MoveTbl
+{
+    uint16_t effect;
+    uint8_t class;
+    uint8_t power;
+    uint8_t type;
+    uint8_t accuracy;
+    uint8_t pp;
+    uint8_t effectChance;
+    uint16_t range; // unk8
+    int8_t priority;
+} MoveTbl;
+
+// Hold effect columns of item_data.csv
+typedef struct ItemData
+{
+    uint8_t holdEffect;
+    uint8_t holdEffectParam;
+} ItemData;
+
+typedef struct Symbol
+{
+    char * name;
+    int32_t value;
+} Symbol;
+
+typedef struct SymbolTable
+{
+    Symbol * entries;
+    size_t count;
+    size_t capacity;
+} SymbolTable;
+
+typedef struct GameData
+{
+    SymbolTable symbols;
+    BaseStats * personal;
+    int numPersonal;
+    MoveTbl * moves;
+    int numMoves;
+    ItemData * items;
+    int numItems;
+    // sTypeEffectiveness, terminated by TYPE_ENDTABLE
+    uint8_t typeChart[MAX_TYPE_CHART][3];
+    int numTypeChart;
+    // sStatChangeTable: numerator and denominator per stage
+    uint8_t statStageRatio[NUM_STAT_STAGES][2];
+    // ov12_0226CC3A: hold effect and the move type it boosts
+    uint8_t typeBoostItems[NUM_TYPE_BOOST_ITEMS][2];
+    // ov12_0226CBBE: moves boosted by Iron Fist
+    uint16_t ironFistMoves[NUM_IRON_FIST_MOVES];
+} GameData;
+
+noreturn __attribute__((format(printf, 1, 2))) void fatal_error(const char * message, ...);
+
+void SymbolTable_Init(SymbolTable * table);
+void SymbolTable_Free(SymbolTable * table);
+void SymbolTable_Add(SymbolTable * table, const char * name, int32_t value);
+// Loads every "#define NAME <integer>" in a header. Returns false if it can't
+// be opened.
+bool SymbolTable_LoadHeader(SymbolTable * table, const char * path);
+bool SymbolTable_Find(const SymbolTable * table, const char * name, int32_t * value);
+// First symbol starting with prefix that has this value, or NULL
+const char * SymbolTable_Name(const SymbolTable * table, const char * prefix, int32_t value);
+
+// Finds the repository root from the current directory. Returns NULL if it
+// isn't ".", "..", or "../..".
+const char * GameData_FindRoot(void);
+// Exits with an error on any missing or malformed source
+void GameData_Load(GameData * data, const char * root);
+void GameData_Free(GameData * data);
+
+// Parses a number or a symbol name
+bool GameData_ParseValue(const GameData * data, const char * arg, int32_t * value);
+
+#endif //GUARD_DMGCALC_GAMEDATA_H
@@ -0,0 +1,1189 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+#include "damage.h"
+#include "constants/pokemon.h"
+#include "constants/abilities.h"
+#include "constants/items.h"
+#include "constants/moves.h"
+#include "constants/species.h"
+#include "constants/battle.h"
+
+#define GOLDEN_MAGIC   0x47474D44 // "DMGG"
+#define GOLDEN_VERSION 1
+
+#define BATTLER_ATTACKER 0
+#define BATTLER_TARGET   1
+
+// Everything a sweep holds fixed. Stored in the golden file header so that a
+// compare against a table recorded with other settings is refused.
+typedef struct Scenario
+{
+    uint32_t level;
+    uint32_t fieldCondition;
+    uint32_t abilitySlot;
+    uint32_t atkItem;
+    uint32_t defItem;
+    uint32_t firstSpecies;
+    uint32_t lastSpecies;
+    uint32_t numMoves;
+} Scenario;
+
+#define SCENARIO_NUM_FIELDS (sizeof(Scenario) / sizeof(uint32_t))
+
+typedef struct Options
+{
+    int numThreads;
+    int maxReports;
+    Scenario scenario;
+} Options;
+
+static uint32_t ParseU32(const char * arg)
+{
+    char * end;
+    unsigned long long val = strtoull(arg, &end, 0);
+    if (*arg == '\0' || *end != '\0' || val > 0xFFFFFFFFull)
+    {
+        fatal_error("invalid number: %s", arg);
+    }
+    return (uint32_t)val;
+}
+
+// A number or a symbol, which has to start with prefix
+static uint32_t ParseSymbol(const GameData * data, const char * prefix, const char * arg)
+{
+    char name[256];
+    int32_t value;
+    if (GameData_ParseValue(data, arg, &value))
+    {
+        return (uint32_t)value;
+    }
+    snprintf(name, sizeof(name), "%s%s", prefix, arg);
+    if (!SymbolTable_Find(&data->symbols, name, &value))
+    {
+        fatal_error("unknown %s value: %s", prefix, arg);
+    }
+    return (uint32_t)value;
+}
+
+static uint32_t ParseWeather(const char * arg)
+{
+    if (strcmp(arg, "none") == 0)
+    {
+        return 0;
+    }
+    if (strcmp(arg, "rain") == 0)
+    {
+        return FIELD_CONDITION_RAIN;
+    }
+    if (strcmp(arg, "sand") == 0)
+    {
+        return FIELD_CONDITION_SANDSTORM;
+    }
+    if (strcmp(arg, "sun") == 0)
+    {
+        return FIELD_CONDITION_SUN;
+    }
+    if (strcmp(arg, "hail") == 0)
+    {
+        return FIELD_CONDITION_HAIL;
+    }
+    fatal_error("unknown weather: %s (none, rain, sand, sun, hail)", arg);
+}
+
+static double Now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static const char * SpeciesName(const GameData * data, int species)
+{
+    const char * name = SymbolTable_Name(&data->symbols, "SPECIES_", species);
+    return name != NULL ? name : "?";
+}
+
+static const char * MoveName(const GameData * data, int move)
+{
+    const char * name = SymbolTable_Name(&data->symbols, "MOVE_", move);
+    return name != NULL ? name : "?";
+}
+
+// CalcMonStats with 31 IVs, no EVs and a neutral nature
+static int CalcStat(int base, int level)
+{
+    return (2 * base + 31) * level / 100 + 5;
+}
+
+static void SetupMon(const GameData * data, DamageMon * mon, int species, int level, int abilitySlot, int item)
+{
+    const BaseStats * stats = &data->personal[species];
+    int hp = (2 * stats->hp + 31) * level / 100 + level + 10;
+
+    memset(mon, 0, sizeof(*mon));
+    mon->species = species;
+    mon->level = level;
+    mon->atk = CalcStat(stats->atk, level);
+    mon->def = CalcStat(stats->def, level);
+    mon->speed = CalcStat(stats->speed, level);
+    mon->spatk = CalcStat(stats->spatk, level);
+    mon->spdef = CalcStat(stats->spdef, level);
+    for (int i = 0; i < 8; i++)
+    {
+        mon->statChanges[i] = STAT_STAGE_NEUTRAL;
+    }
+    mon->type1 = stats->types[0];
+    mon->type2 = stats->types[1];
+    mon->ability = stats->abilities[abilitySlot] != 0 ? stats->abilities[abilitySlot] : stats->abilities[0];
+    switch (stats->genderRatio)
+    {
+    case 255:
+        mon->gender = MON_GENDERLESS;
+        break;
+    case 254:
+        mon->gender = MON_FEMALE;
+        break;
+    default:
+        mon->gender = MON_MALE;
+        break;
+    }
+    mon->hp = hp;
+    mon->maxHp = hp;
+    mon->item = item;
+}
+
+static void SetupBattle(const GameData * data, DamageContext * ctx, const Scenario * scenario, int atkSpecies, int defSpecies)
+{
+    DamageContext_Init(ctx, data);
+    ctx->fieldCondition = scenario->fieldCondition;
+    SetupMon(data, &ctx->battleMons[BATTLER_ATTACKER], atkSpecies, scenario->level, scenario->abilitySlot, scenario->atkItem);
+    SetupMon(data, &ctx->battleMons[BATTLER_TARGET], defSpecies, scenario->level, scenario->abilitySlot, scenario->defItem);
+}
+
+static bool IsDamagingMove(const GameData * data, int move)
+{
+    const MoveTbl * tbl = &data->moves[move];
+    return tbl->class != MOVE_CLASS_STATUS && tbl->power != 0;
+}
+
+// ---------------------------------------------------------------------------
+// calc
+
+static int CommandCalc(const GameData * data, const char * atkArg, const char * defArg, const char * moveArg, const Options * options, uint32_t atkAbility, uint32_t defAbility, bool crit)
+{
+    const Scenario * scenario = &options->scenario;
+    DamageContext ctx;
+    DamageMove move;
+    int atkSpecies = ParseSymbol(data, "SPECIES_", atkArg);
+    int defSpecies = ParseSymbol(data, "SPECIES_", defArg);
+    int moveNo = ParseSymbol(data, "MOVE_", moveArg);
+
+    if (atkSpecies < 1 || atkSpecies >= data->numPersonal || defSpecies < 1 || defSpecies >= data->numPersonal)
+    {
+        fatal_error("species out of range");
+    }
+    if (moveNo < 1 || moveNo >= data->numMoves)
+    {
+        fatal_error("move out of range");
+    }
+    SetupBattle(data, &ctx, scenario, atkSpecies, defSpecies);
+    if (atkAbility != 0)
+    {
+        ctx.battleMons[BATTLER_ATTACKER].ability = atkAbility;
+    }
+    if (defAbility != 0)
+    {
+        ctx.battleMons[BATTLER_TARGET].ability = defAbility;
+    }
+
+    memset(&move, 0, sizeof(move));
+    move.moveNo = moveNo;
+    move.battlerIdAttacker = BATTLER_ATTACKER;
+    move.battlerIdTarget = BATTLER_TARGET;
+    move.criticalMultiplier = crit ? ov12_02257C5C_Multiplier(&ctx, BATTLER_ATTACKER, BATTLER_TARGET) : 1;
+
+    printf("%s (%s) uses %s on %s (%s), level %u%s\n",
+        SpeciesName(data, atkSpecies), SymbolTable_Name(&data->symbols, "ABILITY_", ctx.battleMons[BATTLER_ATTACKER].ability),
+        MoveName(data, moveNo),
+        SpeciesName(data, defSpecies), SymbolTable_Name(&data->symbols, "ABILITY_", ctx.battleMons[BATTLER_TARGET].ability),
+        scenario->level, crit ? ", critical hit" : "");
+    for (int roll = 0; roll < NUM_RANDOM_ROLLS; roll++)
+    {
+        uint32_t statusFlag = 0;
+        DamageContext copy = ctx;
+        int damage = DamageCalc_Hit(&copy, &move, roll, &statusFlag);
+        printf("  %3d%%  %5d  status 0x%08x\n", 100 - roll, damage, statusFlag);
+    }
+    return EXIT_SUCCESS;
+}
+
+// ---------------------------------------------------------------------------
+// sweep
+
+typedef struct SweepState
+{
+    const GameData * data;
+    const Scenario * scenario;
+    const uint16_t * moves;
+    const uint16_t * attackers;     // NULL: every species in the range
+    int numAttackers;
+    int numSpecies;
+    uint64_t * hashes;
+    _Atomic int next;
+    _Atomic uint64_t numCalcs;
+} SweepState;
+
+static inline uint64_t Fnv1a(uint64_t hash, uint32_t value)
+{
+    for (int i = 0; i < 4; i++)
+    {
+        hash ^= (value >> (8 * i)) & 0xFF;
+        hash *= 0x100000001B3ull;
+    }
+    return hash;
+}
+
+// Calls visit for every move, critical multiplier and roll of one pair. The
+// part before the roll and the type chart walk are done once and shared by
+// all 16 rolls; DamageCalc_Hit is the unshared reference the selftest checks
+// this against.
+typedef void (*SweepVisitor)(void * arg, int moveNo, int crit, int roll, int damage, uint32_t statusFlag);
+
+static uint64_t SweepPair(const SweepState * state, int atkSpecies, int defSpecies, SweepVisitor visit, void * arg)
+{
+    DamageContext ctx;
+    DamageMove move;
+    uint64_t hash = 0xCBF29CE484222325ull;
+    int crits[2];
+
+    SetupBattle(state->data, &ctx, state->scenario, atkSpecies, defSpecies);
+    crits[0] = 1;
+    crits[1] = ov12_02257C5C_Multiplier(&ctx, BATTLER_ATTACKER, BATTLER_TARGET);
+    memset(&move, 0, sizeof(move));
+    move.battlerIdAttacker = BATTLER_ATTACKER;
+    move.battlerIdTarget = BATTLER_TARGET;
+
+    for (uint32_t m = 0; m < state->scenario->numMoves; m++)
+    {
+        TypeChartHits hits;
+        move.moveNo = state->moves[m];
+        int type = DamageMove_Type(&ctx, &move);
+        TypeChart_Lookup(&ctx, type, BATTLER_ATTACKER, BATTLER_TARGET, &hits);
+        for (int c = 0; c < 2; c++)
+        {
+            move.criticalMultiplier = crits[c];
+            int base = DamageCalcDefault(&ctx, &move);
+            for (int roll = 0; roll < NUM_RANDOM_ROLLS; roll++)
+            {
+                uint32_t statusFlag = 0;
+                int damage = -ov12_02257C30(base, roll);
+                damage = -TypeChart_Apply(&ctx, &hits, move.moveNo, type, BATTLER_ATTACKER, BATTLER_TARGET, damage, &statusFlag);
+                hash = Fnv1a(Fnv1a(hash, damage), statusFlag);
+                if (visit != NULL)
+                {
+                    visit(arg, move.moveNo, crits[c], roll, damage, statusFlag);
+                }
+            }
+        }
+    }
+    return hash;
+}
+
+static void * SweepWorker(void * arg)
+{
+    SweepState * state = arg;
+    int numPairs = state->numAttackers * state->numSpecies;
+    int i;
+
+    while ((i = atomic_fetch_add(&state->next, 1)) < numPairs)
+    {
+        int row = i / state->numSpecies;
+        int atkSpecies = state->attackers != NULL ? state->attackers[row] : (int)state->scenario->firstSpecies + row;
+        int defSpecies = state->scenario->firstSpecies + i % state->numSpecies;
+        state->hashes[i] = SweepPair(state, atkSpecies, defSpecies, NULL, NULL);
+        atomic_fetch_add(&state->numCalcs, (uint64_t)state->scenario->numMoves * 2 * NUM_RANDOM_ROLLS);
+    }
+    return NULL;
+}
+
+static void RunWorkers(int numThreads, void * (*worker)(void *), void * arg)
+{
+    pthread_t * threads = malloc(numThreads * sizeof(pthread_t));
+    if (threads == NULL)
+    {
+        fatal_error("out of memory");
+    }
+    for (int i = 0; i < numThreads; i++)
+    {
+        if (pthread_create(&threads[i], NULL, worker, arg) != 0)
+        {
+            fatal_error("could not start worker thread");
+        }
+    }
+    for (int i = 0; i < numThreads; i++)
+    {
+        pthread_join(threads[i], NULL);
+    }
+    free(threads);
+}
+
+static void WriteU32(FILE * file, uint32_t value)
+{
+    uint8_t bytes[4] = { value, value >> 8, value >> 16, value >> 24 };
+    fwrite(bytes, 1, 4, file);
+}
+
+static bool ReadU32(FILE * file, uint32_t * value)
+{
+    uint8_t bytes[4];
+    if (fread(bytes, 1, 4, file) != 4)
+    {
+        return false;
+    }
+    *value = bytes[0] | (bytes[1] << 8) | (bytes[2] << 16) | ((uint32_t)bytes[3] << 24);
+    return true;
+}
+
+static void WriteGolden(const char * path, const Scenario * scenario, const uint64_t * hashes, int numPairs)
+{
+    FILE * file = fopen(path, "wb");
+    const uint32_t * fields = (const uint32_t *)scenario;
+    if (file == NULL)
+    {
+        fatal_error("%s: %s", path, strerror(errno));
+    }
+    WriteU32(file, GOLDEN_MAGIC);
+    WriteU32(file, GOLDEN_VERSION);
+    for (size_t i = 0; i < SCENARIO_NUM_FIELDS; i++)
+    {
+        WriteU32(file, fields[i]);
+    }
+    for (int i = 0; i < numPairs; i++)
+    {
+        WriteU32(file, (uint32_t)hashes[i]);
+        WriteU32(file, (uint32_t)(hashes[i] >> 32));
+    }
+    if (fclose(file) != 0)
+    {
+        fatal_error("%s: %s", path, strerror(errno));
+    }
+}
+
+// Reads a golden table and the scenario it was recorded with
+static uint64_t * ReadGolden(const char * path, Scenario * scenario)
+{
+    FILE * file = fopen(path, "rb");
+    uint32_t * fields = (uint32_t *)scenario;
+    uint32_t magic, version;
+    uint64_t * hashes;
+    int numSpecies, numPairs;
+
+    if (file == NULL)
+    {
+        fatal_error("%s: %s", path, strerror(errno));
+    }
+    if (!ReadU32(file, &magic) || !ReadU32(file, &version) || magic != GOLDEN_MAGIC)
+    {
+        fatal_error("%s: not a golden table", path);
+    }
+    if (version != GOLDEN_VERSION)
+    {
+        fatal_error("%s: version %u, expected %u", path, version, GOLDEN_VERSION);
+    }
+    for (size_t i = 0; i < SCENARIO_NUM_FIELDS; i++)
+    {
+        if (!ReadU32(file, &fields[i]))
+        {
+            fatal_error("%s: truncated header", path);
+        }
+    }
+    if (scenario->lastSpecies < scenario->firstSpecies || scenario->lastSpecies - scenario->firstSpecies >= 0x10000)
+    {
+        fatal_error("%s: bad species range", path);
+    }
+    numSpecies = scenario->lastSpecies - scenario->firstSpecies + 1;
+    numPairs = numSpecies * numSpecies;
+    hashes = malloc(numPairs * sizeof(uint64_t));
+    if (hashes == NULL)
+    {
+        fatal_error("out of memory");
+    }
+    for (int i = 0; i < numPairs; i++)
+    {
+        uint32_t lo, hi;
+        if (!ReadU32(file, &lo) || !ReadU32(file, &hi))
+        {
+            fatal_error("%s: truncated after %d of %d pairs", path, i, numPairs);
+        }
+        hashes[i] = lo | ((uint64_t)hi << 32);
+    }
+    fclose(file);
+    return hashes;
+}
+
+// The settings dmgcalc_golden.h was recorded with: level, weather, ability
+// slot and items, each over every species pair and every damaging move. The
+// first is what a plain "sweep" runs.
+#define GOLDEN_NUM_MOVES 300
+static const Scenario sGoldenScenarios[] = {
+    { 50, 0, 0, ITEM_NONE, ITEM_NONE, 1, SPECIES_ARCEUS, GOLDEN_NUM_MOVES },
+    { 100, FIELD_CONDITION_RAIN, 1, ITEM_CHOICE_BAND, ITEM_NONE, 1, SPECIES_ARCEUS, GOLDEN_NUM_MOVES },
+    { 30, FIELD_CONDITION_SUN, 0, ITEM_EXPERT_BELT, ITEM_METAL_POWDER, 1, SPECIES_ARCEUS, GOLDEN_NUM_MOVES },
+    { 75, FIELD_CONDITION_HAIL, 1, ITEM_CHOICE_SPECS, ITEM_NONE, 1, SPECIES_ARCEUS, GOLDEN_NUM_MOVES },
+};
+
+#define GOLDEN_NUM_SCENARIOS (int)(sizeof(sGoldenScenarios) / sizeof(sGoldenScenarios[0]))
+
+// From dmgcalc golden, run against damage.c and the game data as of the
+// commit that added it: for each scenario, one hash per attacker over its
+// pairs with every defender, in species order. The selftest checks every
+// GOLDEN_SELFTEST_STRIDE-th attacker; a sweep with the same settings checks
+// them all.
+#define GOLDEN_SELFTEST_STRIDE 97
+static const uint64_t sGoldenRows[GOLDEN_NUM_SCENARIOS][SPECIES_ARCEUS] = {
+#include "dmgcalc_golden.h"
+};
+
+// Reference hits worked by hand from the published Gen IV damage formula, the
+// base stats and the overlay 12 asm, not recorded from damage.c, so that a slip the port shares with
+// dmgcalc_golden.h still shows. Both sides are set up as SetupMon does, with
+// slot 0 abilities and no items; hi and lo are the 100% and 85% rolls. Rows
+// captured from the retail ROM belong here as well, once there is a way to
+// run it.
+typedef struct ReferenceHit
+{
+    uint16_t atkSpecies;
+    uint16_t defSpecies;
+    uint16_t moveNo;
+    uint8_t level;
+    uint8_t crit;
+    uint16_t hi;
+    uint16_t lo;
+    uint32_t statusFlag;
+} ReferenceHit;
+
+static const ReferenceHit sReferenceHits[] = {
+    // 70 SpA into 120 SpD: 22 * 95 * 70 / 50 / 120 + 2 = 26, STAB, 4x
+    { SPECIES_PIKACHU, SPECIES_GYARADOS, MOVE_THUNDERBOLT, 50, 0, 156, 132, MOVE_STATUS_SUPER_EFFECTIVE },
+    // 150 Atk into 85 Def: 22 * 120 * 150 / 50 / 85 + 2 = 95, STAB, 2x
+    { SPECIES_MACHAMP, SPECIES_SNORLAX, MOVE_CLOSE_COMBAT, 50, 0, 284, 240, MOVE_STATUS_SUPER_EFFECTIVE },
+    // The same, doubled after the + 2
+    { SPECIES_MACHAMP, SPECIES_SNORLAX, MOVE_CLOSE_COMBAT, 50, 1, 570, 482, MOVE_STATUS_SUPER_EFFECTIVE },
+    // 150 SpA into 105 SpD (Alakazam's Gen IV 85 base): 22 * 80 * 150 / 50 / 105 + 2 = 52, STAB, 2x
+    { SPECIES_GENGAR, SPECIES_ALAKAZAM, MOVE_SHADOW_BALL, 50, 0, 156, 132, MOVE_STATUS_SUPER_EFFECTIVE },
+    // 296 Atk into 316 Def: 42 * 80 * 296 / 50 / 316 + 2 = 64, STAB, 0.5x
+    { SPECIES_GARCHOMP, SPECIES_SKARMORY, MOVE_DRAGON_CLAW, 100, 0, 48, 40, MOVE_STATUS_NOT_EFFECTIVE },
+    // Levitate only flags the miss and skips the chart: 22 * 100 * 150 / 50 / 136 + 2 = 50, STAB
+    { SPECIES_GARCHOMP, SPECIES_BRONZONG, MOVE_EARTHQUAKE, 50, 0, 75, 63, MOVE_STATUS_LEVITATED },
+    // Ghost zeroes Tackle, and Wonder Guard flags anything not super effective on top
+    { SPECIES_PIKACHU, SPECIES_SHEDINJA, MOVE_TACKLE, 50, 0, 0, 0, MOVE_STATUS_NO_EFFECT | MOVE_STATUS_WONDER_GUARD },
+};
+
+// The built-in table for these settings, whatever the move count, or -1
+static int FindGoldenScenario(const Scenario * scenario)
+{
+    for (int i = 0; i < GOLDEN_NUM_SCENARIOS; i++)
+    {
+        Scenario golden = sGoldenScenarios[i];
+        golden.numMoves = scenario->numMoves;
+        if (memcmp(&golden, scenario, sizeof(Scenario)) == 0)
+        {
+            return i;
+        }
+    }
+    return -1;
+}
+
+// Folds the pair hashes of each attacker, numSpecies defenders a row
+static void FoldRows(const uint64_t * hashes, int numRows, int numSpecies, uint64_t * rows)
+{
+    for (int r = 0; r < numRows; r++)
+    {
+        uint64_t hash = 0xCBF29CE484222325ull;
+        for (int d = 0; d < numSpecies; d++)
+        {
+            uint64_t pair = hashes[r * numSpecies + d];
+            hash = Fnv1a(Fnv1a(hash, (uint32_t)pair), (uint32_t)(pair >> 32));
+        }
+        rows[r] = hash;
+    }
+}
+
+// The row hashes of the given attackers against every defender in the range
+static void SweepRows(const GameData * data, const Scenario * scenario, const uint16_t * moves, const uint16_t * attackers, int numAttackers, int numThreads, uint64_t * rows)
+{
+    SweepState state;
+
+    memset(&state, 0, sizeof(state));
+    state.data = data;
+    state.scenario = scenario;
+    state.moves = moves;
+    state.attackers = attackers;
+    state.numAttackers = numAttackers;
+    state.numSpecies = scenario->lastSpecies - scenario->firstSpecies + 1;
+    state.hashes = malloc(numAttackers * state.numSpecies * sizeof(uint64_t));
+    if (state.hashes == NULL)
+    {
+        fatal_error("out of memory");
+    }
+    atomic_init(&state.next, 0);
+    atomic_init(&state.numCalcs, 0);
+    RunWorkers(numThreads, SweepWorker, &state);
+    FoldRows(state.hashes, numAttackers, state.numSpecies, rows);
+    free(state.hashes);
+}
+
+static int CollectMoves(const GameData * data, uint16_t * moves)
+{
+    int numMoves = 0;
+    for (int move = 1; move < data->numMoves; move++)
+    {
+        if (IsDamagingMove(data, move))
+        {
+            moves[numMoves++] = move;
+        }
+    }
+    return numMoves;
+}
+
+static int CommandSweep(const GameData * data, const char * recordPath, const char * comparePath, Options * options)
+{
+    Scenario * scenario = &options->scenario;
+    SweepState state;
+    uint64_t * golden = NULL;
+    int numPairs, numThreads, goldenNo, numBad = 0;
+    double start, elapsed;
+    uint16_t * moves = malloc(data->numMoves * sizeof(uint16_t));
+
+    if (moves == NULL)
+    {
+        fatal_error("out of memory");
+    }
+    if (comparePath != NULL)
+    {
+        // The table decides the scenario, so a plain "sweep --compare" rechecks it
+        golden = ReadGolden(comparePath, scenario);
+    }
+    if (scenario->lastSpecies >= (uint32_t)data->numPersonal || scenario->firstSpecies < 1 || scenario->firstSpecies > scenario->lastSpecies)
+    {
+        fatal_error("species range %u-%u is out of range", scenario->firstSpecies, scenario->lastSpecies);
+    }
+    if (golden != NULL && scenario->numMoves != (uint32_t)CollectMoves(data, moves))
+    {
+        fatal_error("%s has %u damaging moves, the move table now has %d", comparePath, scenario->numMoves, CollectMoves(data, moves));
+    }
+    scenario->numMoves = CollectMoves(data, moves);
+
+    state.data = data;
+    state.scenario = scenario;
+    state.moves = moves;
+    state.attackers = NULL;
+    state.numSpecies = scenario->lastSpecies - scenario->firstSpecies + 1;
+    state.numAttackers = state.numSpecies;
+    numPairs = state.numSpecies * state.numSpecies;
+    state.hashes = malloc(numPairs * sizeof(uint64_t));
+    if (state.hashes == NULL)
+    {
+        fatal_error("out of memory");
+    }
+    atomic_init(&state.next, 0);
+    atomic_init(&state.numCalcs, 0);
+    numThreads = options->numThreads < numPairs ? options->numThreads : numPairs;
+
+    start = Now();
+    RunWorkers(numThreads, SweepWorker, &state);
+    elapsed = Now() - start;
+    fprintf(stderr, "%d x %d species, %u moves, 2 crit, %d rolls: %llu calculations in %.2fs (%.0f/s, %d threads)\n",
+        state.numSpecies, state.numSpecies, scenario->numMoves, NUM_RANDOM_ROLLS,
+        (unsigned long long)atomic_load(&state.numCalcs), elapsed, atomic_load(&state.numCalcs) / (elapsed > 0 ? elapsed : 1), numThreads);
+
+    if (recordPath != NULL)
+    {
+        WriteGolden(recordPath, scenario, state.hashes, numPairs);
+        fprintf(stderr, "wrote %s\n", recordPath);
+    }
+    if (golden != NULL)
+    {
+        for (int i = 0; i < numPairs; i++)
+        {
+            if (state.hashes[i] == golden[i])
+            {
+                continue;
+            }
+            if (numBad++ < options->maxReports)
+            {
+                printf("mismatch: %s -> %s (rerun with --dump %d %d)\n",
+                    SpeciesName(data, scenario->firstSpecies + i / state.numSpecies),
+                    SpeciesName(data, scenario->firstSpecies + i % state.numSpecies),
+                    scenario->firstSpecies + i / state.numSpecies, scenario->firstSpecies + i % state.numSpecies);
+            }
+        }
+        fprintf(stderr, "%d of %d pairs differ from %s\n", numBad, numPairs, comparePath);
+        free(golden);
+    }
+    else if ((goldenNo = FindGoldenScenario(scenario)) >= 0)
+    {
+        // Only whole rows are recorded, so a mismatch names the attacker
+        uint64_t * rows = malloc(state.numSpecies * sizeof(uint64_t));
+        if (rows == NULL)
+        {
+            fatal_error("out of memory");
+        }
+        if (scenario->numMoves != GOLDEN_NUM_MOVES)
+        {
+            fatal_error("dmgcalc_golden.h has %d damaging moves, the move table now has %u", GOLDEN_NUM_MOVES, scenario->numMoves);
+        }
+        FoldRows(state.hashes, state.numSpecies, state.numSpecies, rows);
+        for (int i = 0; i < state.numSpecies; i++)
+        {
+            if (rows[i] != sGoldenRows[goldenNo][i])
+            {
+                if (numBad++ < options->maxReports)
+                {
+                    printf("mismatch: %s against some defender\n", SpeciesName(data, scenario->firstSpecies + i));
+                }
+            }
+        }
+        fprintf(stderr, "%d of %d attackers differ from dmgcalc_golden.h\n", numBad, state.numSpecies);
+        free(rows);
+    }
+    else if (recordPath == NULL)
+    {
+        fprintf(stderr, "no built-in golden table for these settings; nothing was compared\n");
+    }
+    free(state.hashes);
+    free(moves);
+    return numBad == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+static void DumpVisitor(void * arg, int moveNo, int crit, int roll, int damage, uint32_t statusFlag)
+{
+    const GameData * data = arg;
+    printf("%-20s crit %d  %3d%%  %5d  status 0x%08x\n", MoveName(data, moveNo), crit, 100 - roll, damage, statusFlag);
+}
+
+// Every value that goes into one pair's hash, to diff against another build
+static int CommandDump(const GameData * data, const char * atkArg, const char * defArg, Options * options)
+{
+    SweepState state;
+    uint16_t * moves = malloc(data->numMoves * sizeof(uint16_t));
+    int atkSpecies = ParseSymbol(data, "SPECIES_", atkArg);
+    int defSpecies = ParseSymbol(data, "SPECIES_", defArg);
+
+    if (moves == NULL)
+    {
+        fatal_error("out of memory");
+    }
+    if (atkSpecies < 1 || atkSpecies >= data->numPersonal || defSpecies < 1 || defSpecies >= data->numPersonal)
+    {
+        fatal_error("species out of range");
+    }
+    options->scenario.numMoves = CollectMoves(data, moves);
+    memset(&state, 0, sizeof(state));
+    state.data = data;
+    state.scenario = &options->scenario;
+    state.moves = moves;
+    printf("%s -> %s\n", SpeciesName(data, atkSpecies), SpeciesName(data, defSpecies));
+    uint64_t hash = SweepPair(&state, atkSpecies, defSpecies, DumpVisitor, (void *)data);
+    printf("hash %016llx\n", (unsigned long long)hash);
+    free(moves);
+    return EXIT_SUCCESS;
+}
+
+// Prints dmgcalc_golden.h for the current damage.c and game data: every
+// attacker row of every golden scenario, in full
+static int CommandGolden(const GameData * data, int numThreads)
+{
+    uint16_t * moves = malloc(data->numMoves * sizeof(uint16_t));
+    uint64_t * rows = malloc(SPECIES_ARCEUS * sizeof(uint64_t));
+
+    if (moves == NULL || rows == NULL)
+    {
+        fatal_error("out of memory");
+    }
+    if (CollectMoves(data, moves) != GOLDEN_NUM_MOVES)
+    {
+        fatal_error("the move table has %d damaging moves; update GOLDEN_NUM_MOVES", CollectMoves(data, moves));
+    }
+    for (int i = 0; i < GOLDEN_NUM_SCENARIOS; i++)
+    {
+        double start = Now();
+        SweepRows(data, &sGoldenScenarios[i], moves, NULL, SPECIES_ARCEUS, numThreads, rows);
+        printf("{\n");
+        for (int j = 0; j < SPECIES_ARCEUS; j++)
+        {
+            printf("%s0x%016llXULL,%s", j % 4 == 0 ? "    " : " ", (unsigned long long)rows[j], j % 4 == 3 || j == SPECIES_ARCEUS - 1 ? "\n" : "");
+        }
+        printf("},\n");
+        fprintf(stderr, "scenario %d of %d in %.1fs\n", i + 1, GOLDEN_NUM_SCENARIOS, Now() - start);
+    }
+    free(rows);
+    free(moves);
+    return EXIT_SUCCESS;
+}
+
+// ---------------------------------------------------------------------------
+// selftest
+
+typedef struct SelfTestCheck
+{
+    int numFailed;
+    int numChecked;
+} SelfTestCheck;
+
+static void Expect(SelfTestCheck * check, bool ok, const char * what)
+{
+    check->numChecked++;
+    if (!ok)
+    {
+        check->numFailed++;
+        printf("FAIL: %s\n", what);
+    }
+}
+
+static uint32_t SelfTestRandom(uint32_t * state)
+{
+    *state = *state * 1103515245 + 24691;
+    return *state >> 16;
+}
+
+static int SelfTest(const GameData * data, int numThreads)
+{
+    SelfTestCheck check = { 0, 0 };
+    DamageContext ctx;
+    DamageMove move;
+    uint32_t rng = 1;
+    char what[256];
+
+    // Tables as the game uses them
+    Expect(&check, data->typeChart[data->numTypeChart - 1][0] == TYPE_ENDTABLE, "type chart ends with TYPE_ENDTABLE");
+    Expect(&check, data->statStageRatio[STAT_STAGE_NEUTRAL][0] == data->statStageRatio[STAT_STAGE_NEUTRAL][1], "stage 0 is 1:1");
+    Expect(&check, data->statStageRatio[12][0] == 4 * data->statStageRatio[12][1], "stage +6 is 4:1");
+    Expect(&check, data->moves[MOVE_TACKLE].class == MOVE_CLASS_PHYSICAL && data->moves[MOVE_TACKLE].type == TYPE_NORMAL, "Tackle is physical Normal");
+    Expect(&check, data->personal[SPECIES_PIKACHU].types[0] == TYPE_ELECTRIC, "Pikachu is Electric");
+    Expect(&check, data->items[ITEM_LIFE_ORB].holdEffect == HOLD_EFFECT_HP_DRAIN_ON_ATK, "Life Orb hold effect");
+
+    // Level 50, 100 Attack into 100 Defense, 80 power, neutral and no STAB:
+    // 100 * 80 * 22 / 100 / 50 + 2 = 37, and 85% of that is 31
+    DamageContext_Init(&ctx, data);
+    for (int i = 0; i < 2; i++)
+    {
+        DamageMon * mon = &ctx.battleMons[i];
+        mon->species = SPECIES_BULBASAUR;
+        mon->level = 50;
+        mon->atk = mon->def = mon->spatk = mon->spdef = 100;
+        mon->type1 = mon->type2 = i == 0 ? TYPE_FIRE : TYPE_WATER;
+        mon->hp = mon->maxHp = 150;
+        mon->gender = MON_GENDERLESS;
+    }
+    memset(&move, 0, sizeof(move));
+    move.moveNo = MOVE_TACKLE;
+    move.movePower = 80;
+    move.battlerIdAttacker = 0;
+    move.battlerIdTarget = 1;
+    move.criticalMultiplier = 1;
+    {
+        uint32_t flag = 0;
+        Expect(&check, DamageCalcDefault(&ctx, &move) == 37, "base damage 37");
+        Expect(&check, DamageCalc_Hit(&ctx, &move, 0, &flag) == 37 && flag == 0, "100% roll");
+        Expect(&check, DamageCalc_Hit(&ctx, &move, 15, &flag) == 31 && flag == 0, "85% roll");
+        ctx.battleMons[0].statChanges[STAT_ATK] = 0;
+        Expect(&check, DamageCalcDefault(&ctx, &move) == 100 * 2 / 8 * 80 * 22 / 100 / 50 + 2, "-6 attack");
+        move.criticalMultiplier = 2;
+        Expect(&check, DamageCalcDefault(&ctx, &move) == 37 * 2, "critical hit ignores the attack drop");
+        ctx.battleMons[0].statChanges[STAT_ATK] = 6;
+        move.criticalMultiplier = 1;
+        ctx.battleMons[1].type1 = ctx.battleMons[1].type2 = TYPE_GHOST;
+        flag = 0;
+        Expect(&check, DamageCalc_Hit(&ctx, &move, 0, &flag) == 0 && (flag & MOVE_STATUS_NO_EFFECT), "Normal into Ghost");
+        ctx.battleMons[0].ability = ABILITY_SCRAPPY;
+        flag = 0;
+        Expect(&check, DamageCalc_Hit(&ctx, &move, 0, &flag) == 37 && flag == 0, "Scrappy");
+    }
+
+    // The split chart walk against the literal one, with every immunity
+    // toggle the walk looks at
+    for (int iter = 0; iter < 200000; iter++)
+    {
+        DamageMon * atk = &ctx.battleMons[0];
+        DamageMon * def = &ctx.battleMons[1];
+        uint32_t bits = SelfTestRandom(&rng) | (SelfTestRandom(&rng) << 16);
+        uint32_t flagA = 0, flagB = 0;
+        TypeChartHits hits;
+        int damage = -(int)(SelfTestRandom(&rng) % 600);
+        int moveNo, type, a, b;
+
+        do
+        {
+            moveNo = 1 + SelfTestRandom(&rng) % (data->numMoves - 1);
+        } while (data->moves[moveNo].power == 0 && (bits & 1));
+        move.moveNo = moveNo;
+        move.moveType = (bits & 2) ? SelfTestRandom(&rng) % 18 : 0;
+        atk->type1 = SelfTestRandom(&rng) % 18;
+        atk->type2 = (bits & 4) ? atk->type1 : SelfTestRandom(&rng) % 18;
+        def->type1 = SelfTestRandom(&rng) % 18;
+        def->type2 = (bits & 8) ? def->type1 : SelfTestRandom(&rng) % 18;
+        atk->ability = (bits & 0x10) ? ABILITY_SCRAPPY : (bits & 0x20) ? ABILITY_NORMALIZE : (bits & 0x40) ? ABILITY_MOLD_BREAKER : ABILITY_NONE;
+        def->ability = (bits & 0x80) ? ABILITY_LEVITATE : (bits & 0x100) ? ABILITY_WONDER_GUARD : (bits & 0x200) ? ABILITY_FILTER : ABILITY_NONE;
+        def->status2 = (bits & 0x400) ? STATUS2_FORESIGHT : 0;
+        def->roostFlag = (bits & 0x800) != 0;
+        def->moveEffectFlags = ((bits & 0x1000) ? MOVE_EFFECT_MIRACLE_EYE : 0) | ((bits & 0x2000) ? MOVE_EFFECT_INGRAIN : 0);
+        def->magnetRiseTurns = (bits & 0x4000) ? 3 : 0;
+        def->item = (bits & 0x8000) ? ITEM_IRON_BALL : ITEM_NONE;
+        atk->item = (bits & 0x10000) ? ITEM_EXPERT_BELT : ITEM_NONE;
+        ctx.fieldCondition = (bits & 0x20000) ? FIELD_CONDITION_GRAVITY : 0;
+        ctx.linkStatus = (bits & 0x40000) ? LINK_STATUS_NO_TYPE_EFFECT : 0;
+
+        type = DamageMove_Type(&ctx, &move);
+        a = ov12_02251D28(&ctx, moveNo, move.moveType, 0, 1, damage, &flagA);
+        TypeChart_Lookup(&ctx, type, 0, 1, &hits);
+        b = TypeChart_Apply(&ctx, &hits, moveNo, type, 0, 1, damage, &flagB);
+        snprintf(what, sizeof(what), "chart walk, iteration %d: move %d type %d into %d/%d: %d/0x%x vs %d/0x%x",
+            iter, moveNo, type, def->type1, def->type2, a, flagA, b, flagB);
+        Expect(&check, a == b && flagA == flagB, what);
+    }
+
+    // The sweep's shared base damage against DamageCalc_Hit on the same pairs
+    {
+        Scenario scenario = { 50, 0, 0, ITEM_NONE, ITEM_NONE, 1, 1, 0 };
+        SweepState state;
+        uint16_t * moves = malloc(data->numMoves * sizeof(uint16_t));
+        int pairs[][2] = {
+            { SPECIES_PIKACHU, SPECIES_GYARADOS },
+            { SPECIES_MACHAMP, SPECIES_GENGAR },
+            { SPECIES_SHEDINJA, SPECIES_SHEDINJA },
+            { SPECIES_GARCHOMP, SPECIES_BRONZONG },
+            { SPECIES_KINGLER, SPECIES_SKARMORY },
+        };
+        if (moves == NULL)
+        {
+            fatal_error("out of memory");
+        }
+        scenario.numMoves = CollectMoves(data, moves);
+        memset(&state, 0, sizeof(state));
+        state.data = data;
+        state.scenario = &scenario;
+        state.moves = moves;
+        for (size_t p = 0; p < sizeof(pairs) / sizeof(pairs[0]); p++)
+        {
+            uint64_t hash = 0xCBF29CE484222325ull;
+            int crits[2];
+            SetupBattle(data, &ctx, &scenario, pairs[p][0], pairs[p][1]);
+            crits[0] = 1;
+            crits[1] = ov12_02257C5C_Multiplier(&ctx, BATTLER_ATTACKER, BATTLER_TARGET);
+            memset(&move, 0, sizeof(move));
+            move.battlerIdAttacker = BATTLER_ATTACKER;
+            move.battlerIdTarget = BATTLER_TARGET;
+            for (uint32_t m = 0; m < scenario.numMoves; m++)
+            {
+                move.moveNo = moves[m];
+                for (int c = 0; c < 2; c++)
+                {
+                    move.criticalMultiplier = crits[c];
+                    for (int roll = 0; roll < NUM_RANDOM_ROLLS; roll++)
+                    {
+                        uint32_t statusFlag = 0;
+                        int damage = DamageCalc_Hit(&ctx, &move, roll, &statusFlag);
+                        hash = Fnv1a(Fnv1a(hash, damage), statusFlag);
+                    }
+                }
+            }
+            snprintf(what, sizeof(what), "sweep path, %s -> %s", SpeciesName(data, pairs[p][0]), SpeciesName(data, pairs[p][1]));
+            Expect(&check, hash == SweepPair(&state, pairs[p][0], pairs[p][1], NULL, NULL), what);
+        }
+        free(moves);
+    }
+
+    // The hand-worked reference hits
+    for (size_t i = 0; i < sizeof(sReferenceHits) / sizeof(sReferenceHits[0]); i++)
+    {
+        const ReferenceHit * ref = &sReferenceHits[i];
+        Scenario scenario = { ref->level, 0, 0, ITEM_NONE, ITEM_NONE, 1, 1, 0 };
+        uint32_t flagHi = 0, flagLo = 0;
+        int hi, lo;
+
+        SetupBattle(data, &ctx, &scenario, ref->atkSpecies, ref->defSpecies);
+        memset(&move, 0, sizeof(move));
+        move.moveNo = ref->moveNo;
+        move.battlerIdAttacker = BATTLER_ATTACKER;
+        move.battlerIdTarget = BATTLER_TARGET;
+        move.criticalMultiplier = ref->crit ? ov12_02257C5C_Multiplier(&ctx, BATTLER_ATTACKER, BATTLER_TARGET) : 1;
+        hi = DamageCalc_Hit(&ctx, &move, 0, &flagHi);
+        lo = DamageCalc_Hit(&ctx, &move, NUM_RANDOM_ROLLS - 1, &flagLo);
+        snprintf(what, sizeof(what), "reference, %s %s into %s: %d-%d/0x%x, expected %d-%d/0x%x",
+            SpeciesName(data, ref->atkSpecies), MoveName(data, ref->moveNo), SpeciesName(data, ref->defSpecies),
+            lo, hi, flagHi, ref->lo, ref->hi, ref->statusFlag);
+        Expect(&check, hi == ref->hi && lo == ref->lo && flagHi == ref->statusFlag && flagLo == ref->statusFlag, what);
+    }
+
+    // Every GOLDEN_SELFTEST_STRIDE-th attacker of each golden scenario
+    // against every defender, as recorded in dmgcalc_golden.h
+    {
+        uint16_t * moves = malloc(data->numMoves * sizeof(uint16_t));
+        uint16_t attackers[SPECIES_ARCEUS];
+        uint64_t rows[SPECIES_ARCEUS];
+        int numAttackers = 0;
+
+        if (moves == NULL)
+        {
+            fatal_error("out of memory");
+        }
+        for (int species = 1; species <= SPECIES_ARCEUS; species += GOLDEN_SELFTEST_STRIDE)
+        {
+            attackers[numAttackers++] = species;
+        }
+        snprintf(what, sizeof(what), "%d damaging moves, as in dmgcalc_golden.h", GOLDEN_NUM_MOVES);
+        Expect(&check, CollectMoves(data, moves) == GOLDEN_NUM_MOVES, what);
+        for (int i = 0; i < GOLDEN_NUM_SCENARIOS && CollectMoves(data, moves) == GOLDEN_NUM_MOVES; i++)
+        {
+            SweepRows(data, &sGoldenScenarios[i], moves, attackers, numAttackers, numThreads, rows);
+            for (int a = 0; a < numAttackers; a++)
+            {
+                snprintf(what, sizeof(what), "golden scenario %d, %s against every defender", i, SpeciesName(data, attackers[a]));
+                Expect(&check, rows[a] == sGoldenRows[i][attackers[a] - 1], what);
+            }
+        }
+        free(moves);
+    }
+
+    printf("%d of %d checks passed\n", check.numChecked - check.numFailed, check.numChecked);
+    return check.numFailed == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+static noreturn void Usage(const char * prog)
+{
+    fprintf(stderr,
+        "Usage:\n"
+        "  %s calc [options] ATTACKER DEFENDER MOVE   print every roll of one attack\n"
+        "  %s sweep [options]                         every attacker x defender x move x crit x roll\n"
+        "  %s selftest                                check the tables, the sweep's shortcuts and\n"
+        "                                             a sample of dmgcalc_golden.h\n"
+        "  %s golden                                  print dmgcalc_golden.h for the current build\n"
+        "\n"
+        "Species, moves, items and abilities are numbers or names from include/constants,\n"
+        "with or without the SPECIES_/MOVE_/ITEM_/ABILITY_ prefix.\n"
+        "\n"
+        "common options:\n"
+        "  --level N             level of both sides (default 50)\n"
+        "  --weather W           none, rain, sand, sun or hail (default none)\n"
+        "  --ability-slot N      0 or 1: which of the species' abilities (default 0)\n"
+        "  --atk-item ITEM       attacker's held item (default none)\n"
+        "  --def-item ITEM       defender's held item (default none)\n"
+        "calc options:\n"
+        "  --atk-ability A       override the attacker's ability\n"
+        "  --def-ability A       override the defender's ability\n"
+        "  --crit                a critical hit\n"
+        "sweep options:\n"
+        "  --species A-B         species on both sides (default 1-493)\n"
+        "  --threads N           worker threads (default: all cores)\n"
+        "  --record FILE         write the golden table\n"
+        "  --compare FILE        check against a golden table, using its settings\n"
+        "  --max-reports N       mismatched pairs to list (default 50)\n"
+        "  --dump A D            print every value of one pair instead of sweeping\n"
+        "\n"
+        "Run from the repository root or from tools/dmgcalc. A sweep with the settings of\n"
+        "one of the tables in dmgcalc_golden.h (the defaults are one) is checked against\n"
+        "it. sweep and sweep --compare exit with 1 if any pair differs.\n",
+        prog, prog, prog, prog);
+    exit(EXIT_FAILURE);
+}
+
+static void ParseRange(const char * arg, uint32_t * begin, uint32_t * end)
+{
+    char buf[64];
+    const char * dash = strchr(arg, '-');
+    if (dash == NULL || (size_t)(dash - arg) >= sizeof(buf))
+    {
+        fatal_error("invalid range: %s", arg);
+    }
+    memcpy(buf, arg, dash - arg);
+    buf[dash - arg] = '\0';
+    *begin = ParseU32(buf);
+    *end = ParseU32(dash + 1);
+    if (*end < *begin)
+    {
+        fatal_error("invalid range: %s", arg);
+    }
+}
+
+int main(int argc, char ** argv)
+{
+    GameData data;
+    Options options;
+    long nproc = sysconf(_SC_NPROCESSORS_ONLN);
+    const char * root;
+    char ** args;
+    int numArgs = 0;
+    const char * recordPath = NULL;
+    const char * comparePath = NULL;
+    const char * dump[2] = { NULL, NULL };
+    uint32_t atkAbility = 0;
+    uint32_t defAbility = 0;
+    bool crit = false;
+    int status;
+
+    if (argc < 2)
+    {
+        Usage(argv[0]);
+    }
+    root = GameData_FindRoot();
+    if (root == NULL)
+    {
+        fatal_error("could not find %s; run from the repository root or tools/dmgcalc", GAMEDATA_ASM_PATH);
+    }
+    GameData_Load(&data, root);
+    if (strcmp(argv[1], "selftest") == 0 || strcmp(argv[1], "golden") == 0)
+    {
+        int numThreads = nproc > 0 ? (int)nproc : 1;
+        status = argv[1][0] == 's' ? SelfTest(&data, numThreads) : CommandGolden(&data, numThreads);
+        GameData_Free(&data);
+        return status;
+    }
+
+    memset(&options, 0, sizeof(options));
+    options.numThreads = nproc > 0 ? (int)nproc : 1;
+    options.maxReports = 50;
+    options.scenario.level = 50;
+    options.scenario.firstSpecies = 1;
+    options.scenario.lastSpecies = SPECIES_ARCEUS;
+    args = malloc(argc * sizeof(char *));
+    if (args == NULL)
+    {
+        fatal_error("out of memory");
+    }
+    for (int i = 2; i < argc; i++)
+    {
+        const char * opt = argv[i];
+        if (opt[0] != '-')
+        {
+            args[numArgs++] = argv[i];
+            continue;
+        }
+        if (strcmp(opt, "--crit") == 0)
+        {
+            crit = true;
+            continue;
+        }
+        if (i + 1 >= argc)
+        {
+            Usage(argv[0]);
+        }
+        const char * val = argv[++i];
+        if (strcmp(opt, "--threads") == 0)
+        {
+            options.numThreads = ParseU32(val);
+            if (options.numThreads < 1)
+            {
+                fatal_error("need at least one thread");
+            }
+        }
+        else if (strcmp(opt, "--level") == 0)
+        {
+            options.scenario.level = ParseU32(val);
+            if (options.scenario.level < 1 || options.scenario.level > 100)
+            {
+                fatal_error("--level must be 1-100");
+            }
+        }
+        else if (strcmp(opt, "--weather") == 0)
+        {
+            options.scenario.fieldCondition = ParseWeather(val);
+        }
+        else if (strcmp(opt, "--ability-slot") == 0)
+        {
+            options.scenario.abilitySlot = ParseU32(val);
+            if (options.scenario.abilitySlot > 1)
+            {
+                fatal_error("--ability-slot must be 0 or 1");
+            }
+        }
+        else if (strcmp(opt, "--atk-item") == 0)
+        {
+            options.scenario.atkItem = ParseSymbol(&data, "ITEM_", val);
+        }
+        else if (strcmp(opt, "--def-item") == 0)
+        {
+            options.scenario.defItem = ParseSymbol(&data, "ITEM_", val);
+        }
+        else if (strcmp(opt, "--atk-ability") == 0)
+        {
+            atkAbility = ParseSymbol(&data, "ABILITY_", val);
+        }
+        else if (strcmp(opt, "--def-ability") == 0)
+        {
+            defAbility = ParseSymbol(&data, "ABILITY_", val);
+        }
+        else if (strcmp(opt, "--species") == 0)
+        {
+            ParseRange(val, &options.scenario.firstSpecies, &options.scenario.lastSpecies);
+        }
+        else if (strcmp(opt, "--record") == 0)
+        {
+            recordPath = val;
+        }
+        else if (strcmp(opt, "--compare") == 0)
+        {
+            comparePath = val;
+        }
+        else if (strcmp(opt, "--max-reports") == 0)
+        {
+            options.maxReports = ParseU32(val);
+        }
+        else if (strcmp(opt, "--dump") == 0)
+        {
+            if (i + 1 >= argc)
+            {
+                Usage(argv[0]);
+            }
+            dump[0] = val;
+            dump[1] = argv[++i];
+        }
+        else
+        {
+            Usage(argv[0]);
+        }
+    }
+    if (options.scenario.atkItem >= (uint32_t)data.numItems || options.scenario.defItem >= (uint32_t)data.numItems)
+    {
+        fatal_error("item out of range");
+    }
+
+    if (strcmp(argv[1], "calc") == 0)
+    {
+        if (numArgs != 3)
+        {
+            Usage(argv[0]);
+        }
+        status = CommandCalc(&data, args[0], args[1], args[2], &options, atkAbility, defAbility, crit);
+    }
+    else if (strcmp(argv[1], "sweep") == 0)
+    {
+        if (numArgs != 0)
+        {
+            Usage(argv[0]);
+        }
+        if (dump[0] != NULL)
+        {
+            status = CommandDump(&data, dump[0], dump[1], &options);
+        }
+        else
+        {
+            status = CommandSweep(&data, recordPath, comparePath, &options);
+        }
+    }
+    else
+    {
+        Usage(argv[0]);
+    }
+
+    free(args);
+    GameData_Free(&data);
+    return status;
+}
@@ -0,0 +1,62 @@
+#ifndef GUARD_EGGSIM_EGGSIM_H
+#define GUARD_EGGSIM_EGGSIM_H
+
+// The boundary between the host side (main.c) and the objects built from the
+// game's sources (game.c, hostmon.c and src/). Plain C types only, so that
+// both sides can include it with their own headers.
+
+#include <stdint.h>
+
+#define EGG_NUM_STATS       6
+#define EGG_NUM_MOVES       4
+#define EGG_NUM_NATURES     25
+#define EGG_PERSONAL_SIZE   0x2C // struct BaseStats in personal.narc
+#define EGG_LEARNSET_SIZE   22   // WOTBL_MAX moves and WOTBL_END
+
+// One of the two day-care mons
+typedef struct EggParent
+{
+    uint32_t personality;
+    uint16_t species;
+    uint16_t heldItem;
+    uint16_t moves[EGG_NUM_MOVES];
+    uint8_t ivs[EGG_NUM_STATS]; // in MON_DATA_HP_IV order: HP Atk Def Spe SpA SpD
+    uint8_t forme;
+    uint8_t language;
+} EggParent;
+
+typedef struct EggResult
+{
+    uint32_t personality;
+    uint16_t species;
+    uint16_t moves[EGG_NUM_MOVES];
+    uint8_t ivs[EGG_NUM_STATS];
+    uint8_t forme;
+} EggResult;
+
+// What the stand-ins for pokemon.c read instead of the ROM's file system.
+// The host owns the memory; it must outlive every call below.
+typedef struct EggTables
+{
+    int numSpecies;
+    const uint8_t (*personal)[EGG_PERSONAL_SIZE];  // per species
+    const uint16_t (*learnsets)[EGG_LEARNSET_SIZE]; // wotbl.narc, per species
+    const uint16_t * babySpecies;                    // pms.narc, per species
+    const uint16_t * eggMoves;                       // kowaza_list.narc member 0
+    int numEggMoves;
+} EggTables;
+
+void Egg_SetTables(const EggTables * tables);
+// Fills day-care slots 0 and 1
+void Egg_SetParents(const EggParent * parent0, const EggParent * parent1);
+// PlayerProfile_GetTrainerID, which the Masuda rerolls test against
+void Egg_SetTrainerId(uint32_t otId);
+void Egg_SetLCRNGSeed(uint32_t seed);
+void Egg_SetMTRNGSeed(uint32_t seed);
+// The day-care man finding an egg (GenerateEggPID), then handing it over
+// (GiveEggToPlayer)
+void Egg_Generate(EggResult * result);
+// GetGenderBySpeciesAndPersonality, for picking parent personalities
+uint8_t Egg_GenderOf(uint16_t species, uint32_t personality);
+
+#endif //GUARD_EGGSIM_EGGSIM_H
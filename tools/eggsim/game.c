@@ -0,0 +1,55 @@
+// get_egg.c as the game builds it. It is included rather than linked so that
+// GenerateEggPID, which only HandleDayCareStep calls, can be reached without
+// a FieldSystem.
+#include "../../src/get_egg.c"
+#include "hostmon.h"
+
+static DAYCARE sDayCare;
+
+void Egg_SetParents(const EggParent *parent0, const EggParent *parent1) {
+    const EggParent *parents[2] = { parent0, parent1 };
+    int i, j;
+
+    Save_Daycare_Init(&sDayCare);
+    for (i = 0; i < 2; i++) {
+        HostMon *mon = HostMon_Get(&sDayCare.mons[i].mon);
+        mon->personality = parents[i]->personality;
+        mon->species = parents[i]->species;
+        mon->heldItem = parents[i]->heldItem;
+        mon->forme = parents[i]->forme;
+        mon->language = parents[i]->language;
+        for (j = 0; j < MAX_MON_MOVES; j++) {
+            mon->moves[j] = parents[i]->moves[j];
+        }
+        for (j = 0; j < EGG_NUM_STATS; j++) {
+            mon->ivs[j] = parents[i]->ivs[j];
+        }
+    }
+}
+
+void Egg_SetLCRNGSeed(uint32_t seed) {
+    SetLCRNGSeed(seed);
+}
+
+void Egg_SetMTRNGSeed(uint32_t seed) {
+    SetMTRNGSeed(seed);
+}
+
+void Egg_Generate(EggResult *result) {
+    const HostMon *egg;
+    int i;
+
+    GenerateEggPID(&sDayCare);
+    GiveEggToPlayer(&sDayCare, NULL, NULL);
+
+    egg = HostMon_LastAdded();
+    result->personality = egg->personality;
+    result->species = egg->species;
+    result->forme = egg->forme;
+    for (i = 0; i < MAX_MON_MOVES; i++) {
+        result->moves[i] = egg->moves[i];
+    }
+    for (i = 0; i < EGG_NUM_STATS; i++) {
+        result->ivs[i] = egg->ivs[i];
+    }
+}
@@ -0,0 +1,365 @@
+#include "global.h"
+#include "pokemon.h"
+#include "party.h"
+#include "heap.h"
+#include "msgdata.h"
+#include "pm_string.h"
+#include "player_data.h"
+#include "map_section.h"
+#include "gf_gfx_loader.h"
+#include "unk_0208E600.h"
+#include "math_util.h"
+#include "constants/items.h"
+#include "constants/moves.h"
+#include "constants/species.h"
+#include "hostmon.h"
+
+// The parts of pokemon.c and the field/heap code that get_egg.c calls on the
+// egg path. Anything that draws on the RNG does so exactly as the real
+// function does, so the LC and MT streams stay in step with the game's.
+
+#define HOST_HEAP_SIZE 0x400
+
+_Static_assert(sizeof(HostMon) <= sizeof(BoxPokemon), "HostMon must fit in a BoxPokemon");
+
+static const EggTables *sTables;
+static u32 sTrainerId;
+static HostMon sLastAdded;
+// LIFO: get_egg.c frees in the reverse order it allocates
+static u32 sHeap[HOST_HEAP_SIZE / 4];
+static u32 sHeapTop;
+
+void Egg_SetTables(const EggTables *tables) {
+    sTables = tables;
+}
+
+void Egg_SetTrainerId(uint32_t otId) {
+    sTrainerId = otId;
+}
+
+HostMon *HostMon_Get(BoxPokemon *boxMon) {
+    return (HostMon *)boxMon;
+}
+
+const HostMon *HostMon_LastAdded(void) {
+    return &sLastAdded;
+}
+
+static const u8 *GetPersonal(int species) {
+    GF_ASSERT(species >= 0 && species < sTables->numSpecies);
+    return sTables->personal[species];
+}
+
+void *AllocFromHeap(HeapID heap_id, u32 size) {
+    void *ret = (u8 *)sHeap + sHeapTop;
+    size = (size + 3) & ~3;
+    GF_ASSERT(sHeapTop + size <= HOST_HEAP_SIZE);
+    sHeapTop += size;
+    return ret;
+}
+
+void FreeToHeap(void *ptr) {
+    // Member data from GfGfxLoader_LoadFromNarc is the host's, not ours
+    if ((u8 *)ptr >= (u8 *)sHeap && (u8 *)ptr < (u8 *)sHeap + HOST_HEAP_SIZE) {
+        sHeapTop = (u8 *)ptr - (u8 *)sHeap;
+    }
+}
+
+void MIi_CpuClearFast(u32 value, u32 *dst, u32 size) {
+    u32 i;
+    for (i = 0; i < size / 4; i++) {
+        dst[i] = value;
+    }
+}
+
+void *GfGfxLoader_LoadFromNarc(NarcId narcId, s32 fileId, BOOL isCompressed, HeapID heapId, BOOL atEnd) {
+    GF_ASSERT(narcId == NARC_fielddata_sodateya_kowaza_list && fileId == 0);
+    return (void *)sTables->eggMoves;
+}
+
+void ZeroBoxMonData(BoxPokemon *boxMon) {
+    MIi_CpuClearFast(0, (u32 *)boxMon, sizeof(BoxPokemon));
+}
+
+Pokemon *AllocMonZeroed(HeapID heap_id) {
+    Pokemon *mon = AllocFromHeap(heap_id, sizeof(Pokemon));
+    MIi_CpuClearFast(0, (u32 *)mon, sizeof(Pokemon));
+    return mon;
+}
+
+u32 GetBoxMonData(BoxPokemon *boxMon, int attr, void *ptr) {
+    const HostMon *mon = HostMon_Get(boxMon);
+
+    switch (attr) {
+    case MON_DATA_PERSONALITY:
+        return mon->personality;
+    case MON_DATA_OTID:
+        return mon->otId;
+    case MON_DATA_SPECIES:
+        return mon->species;
+    case MON_DATA_SPECIES2:
+        return mon->isEgg ? SPECIES_EGG : mon->species;
+    case MON_DATA_HELD_ITEM:
+        return mon->heldItem;
+    case MON_DATA_FORME:
+        return mon->forme;
+    case MON_DATA_GAME_LANGUAGE:
+        return mon->language;
+    case MON_DATA_IS_EGG:
+        return mon->isEgg;
+    case MON_DATA_FRIENDSHIP:
+        return mon->friendship;
+    case MON_DATA_MET_LEVEL:
+        return mon->metLevel;
+    case MON_DATA_POKEBALL:
+        return mon->pokeball;
+    case MON_DATA_MOVE1:
+    case MON_DATA_MOVE2:
+    case MON_DATA_MOVE3:
+    case MON_DATA_MOVE4:
+        return mon->moves[attr - MON_DATA_MOVE1];
+    case MON_DATA_HP_IV:
+    case MON_DATA_ATK_IV:
+    case MON_DATA_DEF_IV:
+    case MON_DATA_SPEED_IV:
+    case MON_DATA_SPATK_IV:
+    case MON_DATA_SPDEF_IV:
+        return mon->ivs[attr - MON_DATA_HP_IV];
+    default:
+        return 0;
+    }
+}
+
+u32 GetMonData(Pokemon *mon, int attr, void *ptr) {
+    return GetBoxMonData(&mon->box, attr, ptr);
+}
+
+// Reads the width SetBoxMonDataInternal reads for each field
+void SetBoxMonData(BoxPokemon *boxMon, int attr, void *value) {
+    HostMon *mon = HostMon_Get(boxMon);
+
+    switch (attr) {
+    case MON_DATA_PERSONALITY:
+        mon->personality = *(const u32 *)value;
+        break;
+    case MON_DATA_OTID:
+        mon->otId = *(const u32 *)value;
+        break;
+    case MON_DATA_SPECIES:
+        mon->species = *(const u16 *)value;
+        break;
+    case MON_DATA_HELD_ITEM:
+        mon->heldItem = *(const u16 *)value;
+        break;
+    case MON_DATA_FORME:
+        mon->forme = *(const u8 *)value;
+        break;
+    case MON_DATA_GAME_LANGUAGE:
+        mon->language = *(const u8 *)value;
+        break;
+    case MON_DATA_IS_EGG:
+        mon->isEgg = *(const u8 *)value;
+        break;
+    case MON_DATA_FRIENDSHIP:
+        mon->friendship = *(const u8 *)value;
+        break;
+    case MON_DATA_MET_LEVEL:
+        mon->metLevel = *(const u8 *)value;
+        break;
+    case MON_DATA_POKEBALL:
+        mon->pokeball = *(const u8 *)value;
+        break;
+    case MON_DATA_MOVE1:
+    case MON_DATA_MOVE2:
+    case MON_DATA_MOVE3:
+    case MON_DATA_MOVE4:
+        mon->moves[attr - MON_DATA_MOVE1] = *(const u16 *)value;
+        break;
+    case MON_DATA_HP_IV:
+    case MON_DATA_ATK_IV:
+    case MON_DATA_DEF_IV:
+    case MON_DATA_SPEED_IV:
+    case MON_DATA_SPATK_IV:
+    case MON_DATA_SPDEF_IV:
+        mon->ivs[attr - MON_DATA_HP_IV] = *(const u8 *)value;
+        break;
+    default:
+        // Names, memo and contest fields: nothing on the egg path reads them
+        break;
+    }
+}
+
+void SetMonData(Pokemon *mon, int attr, void *ptr) {
+    SetBoxMonData(&mon->box, attr, ptr);
+}
+
+int GetMonBaseStat(int species, BaseStat stat_id) {
+    const u8 *personal = GetPersonal(species);
+
+    switch (stat_id) {
+    case BASE_GENDER_RATIO:
+        return personal[0x10];
+    case BASE_EGG_CYCLES:
+        return personal[0x11];
+    case BASE_FRIENDSHIP:
+        return personal[0x12];
+    case BASE_ABILITY_1:
+        return personal[0x16];
+    case BASE_ABILITY_2:
+        return personal[0x17];
+    default:
+        GF_ASSERT(0);
+        return 0;
+    }
+}
+
+u8 GetGenderBySpeciesAndPersonality(u16 species, u32 pid) {
+    u8 ratio = GetMonBaseStat(species, BASE_GENDER_RATIO);
+
+    switch (ratio) {
+    case MON_RATIO_MALE:
+        return MON_MALE;
+    case MON_RATIO_FEMALE:
+        return MON_FEMALE;
+    case MON_RATIO_UNKNOWN:
+        return MON_GENDERLESS;
+    default:
+        return ratio > (u8)pid ? MON_FEMALE : MON_MALE;
+    }
+}
+
+uint8_t Egg_GenderOf(uint16_t species, uint32_t personality) {
+    return GetGenderBySpeciesAndPersonality(species, personality);
+}
+
+u8 GetBoxMonGender(BoxPokemon *boxMon) {
+    const HostMon *mon = HostMon_Get(boxMon);
+    return GetGenderBySpeciesAndPersonality(mon->species, mon->personality);
+}
+
+u8 GetNatureFromPersonality(u32 pid) {
+    return (u8)(pid % 25);
+}
+
+u8 CalcShininessByOtIdAndPersonality(u32 otid, u32 pid) {
+    return (((otid >> 16) ^ (otid & 0xFFFF) ^ (pid >> 16) ^ (pid & 0xFFFF)) < 8);
+}
+
+u16 ReadFromPersonalPmsNarc(u16 species) {
+    GF_ASSERT(species < SPECIES_EGG);
+    return sTables->babySpecies[species];
+}
+
+// Formes share their base species' learnset and TM table here
+int Species_LoadLearnsetTable(u16 species, u32 forme, u16 *dest) {
+    const u16 *wotbl = sTables->learnsets[species];
+    int i;
+
+    for (i = 0; wotbl[i] != WOTBL_END; i++) {
+        dest[i] = WOTBL_MOVE(wotbl[i]);
+    }
+    return i;
+}
+
+BOOL GetTMHMCompatBySpeciesAndForme(u16 species, u32 forme, u8 tmhm) {
+    if (species == SPECIES_EGG) {
+        return FALSE;
+    }
+    // BASE_TMHM_1..4 are little-endian words from 0x1C
+    return (GetPersonal(species)[0x1C + tmhm / 8] >> (tmhm % 8)) & 1;
+}
+
+u32 TryAppendBoxMonMove(BoxPokemon *boxMon, u16 move) {
+    HostMon *mon = HostMon_Get(boxMon);
+    int i;
+
+    for (i = 0; i < MAX_MON_MOVES; i++) {
+        if (mon->moves[i] == MOVE_NONE) {
+            mon->moves[i] = move;
+            return move;
+        }
+        if (mon->moves[i] == move) {
+            return MOVE_APPEND_KNOWN;
+        }
+    }
+    return MOVE_APPEND_FULL;
+}
+
+void DeleteBoxMonFirstMoveAndAppend(BoxPokemon *boxMon, u16 move) {
+    HostMon *mon = HostMon_Get(boxMon);
+    int i;
+
+    for (i = 0; i < MAX_MON_MOVES - 1; i++) {
+        mon->moves[i] = mon->moves[i + 1];
+    }
+    mon->moves[MAX_MON_MOVES - 1] = move;
+}
+
+u32 TryAppendMonMove(Pokemon *mon, u16 move) {
+    return TryAppendBoxMonMove(&mon->box, move);
+}
+
+void DeleteMonFirstMoveAndAppend(Pokemon *mon, u16 move) {
+    DeleteBoxMonFirstMoveAndAppend(&mon->box, move);
+}
+
+// CreateBoxMon with the arguments SetBreedEggStats passes: a fixed
+// personality, otIdType 0 and random IVs, which is two LCRandom calls
+void CreateMon(Pokemon *mon, int species, int level, int fixedIV, int hasFixedPersonality, int fixedPersonality, int otIdType, int fixedOtId) {
+    HostMon *hostMon = HostMon_Get(&mon->box);
+    const u16 *wotbl;
+    u32 iv;
+    int i;
+
+    GF_ASSERT(hasFixedPersonality && fixedIV >= 0x20 && otIdType == OT_ID_PLAYER_ID);
+    MIi_CpuClearFast(0, (u32 *)mon, sizeof(Pokemon));
+    hostMon->personality = fixedPersonality;
+    hostMon->species = species;
+    hostMon->language = GAME_LANGUAGE;
+    hostMon->friendship = GetMonBaseStat(species, BASE_FRIENDSHIP);
+    hostMon->metLevel = level;
+    hostMon->pokeball = ITEM_POKE_BALL;
+
+    iv = LCRandom();
+    hostMon->ivs[0] = iv & 0x1F;
+    hostMon->ivs[1] = (iv & 0x3E0) >> 5;
+    hostMon->ivs[2] = (iv & 0x7C00) >> 10;
+    iv = LCRandom();
+    hostMon->ivs[3] = iv & 0x1F;
+    hostMon->ivs[4] = (iv & 0x3E0) >> 5;
+    hostMon->ivs[5] = (iv & 0x7C00) >> 10;
+
+    // InitBoxMonMoveset
+    wotbl = sTables->learnsets[species];
+    for (i = 0; wotbl[i] != WOTBL_END; i++) {
+        if ((wotbl[i] & WOTBL_LEVEL_MASK) > (level << WOTBL_LEVEL_SHIFT)) {
+            break;
+        }
+        if (TryAppendBoxMonMove(&mon->box, WOTBL_MOVE(wotbl[i])) == MOVE_APPEND_FULL) {
+            DeleteBoxMonFirstMoveAndAppend(&mon->box, WOTBL_MOVE(wotbl[i]));
+        }
+    }
+}
+
+BOOL AddMonToParty(PARTY *party, const Pokemon *mon) {
+    sLastAdded = *(const HostMon *)&mon->box;
+    return TRUE;
+}
+
+u32 PlayerProfile_GetTrainerID(PLAYERPROFILE *profile) {
+    return sTrainerId;
+}
+
+STRING *GetSpeciesName(u16 species, HeapID heap_id) {
+    return NULL;
+}
+
+void String_Delete(STRING *string) {
+}
+
+int sub_02017FE4(MapsecType type, int offset) {
+    return 0;
+}
+
+void MonSetTrainerMemo(Pokemon *mon, PLAYERPROFILE *profile, int strat, int mapsec, HeapID heapId) {
+}
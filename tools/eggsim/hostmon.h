@@ -0,0 +1,28 @@
+#ifndef GUARD_EGGSIM_HOSTMON_H
+#define GUARD_EGGSIM_HOSTMON_H
+
+#include "pokemon.h"
+#include "eggsim.h"
+
+// hostmon.c stands in for pokemon.c. A mon is kept unencrypted in the first
+// bytes of its BoxPokemon, with only the fields get_egg.c reads or writes.
+typedef struct HostMon {
+    u32 personality;
+    u32 otId;
+    u16 species;
+    u16 heldItem;
+    u16 moves[MAX_MON_MOVES];
+    u8 ivs[EGG_NUM_STATS];
+    u8 forme;
+    u8 language;
+    u8 isEgg;
+    u8 friendship;
+    u8 metLevel;
+    u8 pokeball;
+} HostMon;
+
+HostMon *HostMon_Get(BoxPokemon *boxMon);
+// The last mon AddMonToParty was given
+const HostMon *HostMon_LastAdded(void);
+
+#endif //GUARD_EGGSIM_HOSTMON_H
@@ -0,0 +1,1386 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <strings.h>
+#include <stdnoreturn.h>
+#include <stdarg.h>
+#include <ctype.h>
+#include <errno.h>
+#include <math.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#include "eggsim.h"
+
+// Where the tables are read from, relative to the repository root
+#define PERSONAL_PATH       "files/poketool/personal/personal.narc"
+#define LEARNSETS_PATH      "files/poketool/personal/wotbl.narc"
+#define BABY_SPECIES_PATH   "files/poketool/personal/pms.narc" // raw u16 per species, not a NARC
+#define EGG_MOVES_PATH      "files/fielddata/sodateya/kowaza_list.narc"
+
+#define NUM_HEADERS 5
+static const char * const kHeaders[NUM_HEADERS] = {
+    "include/constants/species.h",
+    "include/constants/items.h",
+    "include/constants/moves.h",
+    "include/constants/pokemon.h",
+    "include/config.h",
+};
+
+#define MAX_SPECIES         512
+#define MAX_MOVES           512 // WOTBL_MOVEID_MASK + 1
+#define MAX_MOVESETS        16
+#define NUM_IVS             32
+
+// Each chunk of eggs gets its own MT seed and chunks are dealt round-robin to
+// the workers, so a run's output depends on --seed and not on --jobs
+#define CHUNK_EGGS          0x100000
+
+#define DEFAULT_EGGS        10000000
+#define SELFTEST_EGGS       2000000
+#define DEFAULT_ALPHA       0.001
+
+// LCRandom() >= 0x7FFF in Daycare_EverstoneCheck means no effect
+#define EVERSTONE_CHANCE    (32767.0 / 65536.0)
+#define SHINY_CHANCE        (8.0 / 65536.0)
+// SetBreedEggStats rerolls a non-shiny PID this many times with Masuda
+#define MASUDA_REROLLS      4
+
+static const char * const kStatNames[EGG_NUM_STATS] = { "HP", "Atk", "Def", "Spe", "SpA", "SpD" };
+
+// PowerItemIdToInheritedIvIdx, in stat order
+static const char * const kPowerItems[EGG_NUM_STATS] = {
+    "ITEM_POWER_WEIGHT",
+    "ITEM_POWER_BRACER",
+    "ITEM_POWER_BELT",
+    "ITEM_POWER_ANKLET",
+    "ITEM_POWER_LENS",
+    "ITEM_POWER_BAND",
+};
+
+typedef struct Symbol
+{
+    char * name;
+    int32_t value;
+} Symbol;
+
+typedef struct GameData
+{
+    Symbol * symbols;
+    size_t numSymbols;
+    size_t capacity;
+    EggTables tables;
+    int powerItems[EGG_NUM_STATS];
+    int everstone;
+} GameData;
+
+typedef struct EggConfig
+{
+    EggParent parents[2];
+    uint32_t otId;
+    uint64_t eggs;
+    uint32_t seed;
+    int jobs;
+} EggConfig;
+
+typedef struct MovesetCount
+{
+    uint16_t species;
+    uint16_t moves[EGG_NUM_MOVES];
+    uint64_t count;
+} MovesetCount;
+
+// Everything a worker sends back. Plain counts, so the parent adds them up.
+typedef struct EggStats
+{
+    uint64_t eggs;
+    uint64_t shiny;
+    uint64_t ivs[EGG_NUM_STATS][NUM_IVS];
+    uint64_t natures[EGG_NUM_NATURES];
+    uint64_t species[MAX_SPECIES];
+    uint64_t moves[MAX_MOVES];
+    int numMovesets;
+    MovesetCount movesets[MAX_MOVESETS];
+    uint64_t otherMovesets;
+} EggStats;
+
+typedef struct ChiSquare
+{
+    double stat;
+    int dof;
+    double p;
+    double minExpected;
+} ChiSquare;
+
+static GameData sData;
+
+static inline noreturn __attribute__((format(printf, 1, 2))) void fatal_error(const char * message, ...)
+{
+    va_list va_args;
+    va_start(va_args, message);
+    fputs("Error: ", stderr);
+    vfprintf(stderr, message, va_args);
+    fputc('\n', stderr);
+    va_end(va_args);
+    exit(EXIT_FAILURE);
+}
+
+// GF_ASSERT in the game objects, which are built with PM_KEEP_ASSERTS
+void GF_AssertFail(void)
+{
+    fatal_error("GF_ASSERT failed in the game code");
+}
+
+static uint32_t ParseU32(const char * arg)
+{
+    char * end;
+    unsigned long long val = strtoull(arg, &end, 0);
+    if (*arg == '\0' || *end != '\0' || val > 0xFFFFFFFFull)
+    {
+        fatal_error("invalid number: %s", arg);
+    }
+    return (uint32_t)val;
+}
+
+static uint64_t ParseU64(const char * arg)
+{
+    char * end;
+    errno = 0;
+    unsigned long long val = strtoull(arg, &end, 0);
+    // Allow 1e8 and the like for egg counts
+    if (*end == 'e' || *end == 'E')
+    {
+        double d = strtod(arg, &end);
+        val = (unsigned long long)d;
+    }
+    if (*arg == '\0' || *end != '\0' || errno != 0)
+    {
+        fatal_error("invalid number: %s", arg);
+    }
+    return val;
+}
+
+static double Now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static uint64_t SplitMix64(uint64_t x)
+{
+    x += 0x9E3779B97F4A7C15ull;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+    return x ^ (x >> 31);
+}
+
+static bool IsShiny(uint32_t otId, uint32_t pid)
+{
+    return ((otId >> 16) ^ (otId & 0xFFFF) ^ (pid >> 16) ^ (pid & 0xFFFF)) < 8;
+}
+
+// ---------------------------------------------------------------------------
+// Game data
+
+static void * ReadWholeFile(const char * root, const char * relPath, size_t * size)
+{
+    char path[4096];
+    snprintf(path, sizeof(path), "%s/%s", root, relPath);
+    FILE * file = fopen(path, "rb");
+    if (file == NULL)
+    {
+        fatal_error("%s: %s", path, strerror(errno));
+    }
+    fseek(file, 0, SEEK_END);
+    long length = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    uint8_t * buffer = malloc(length + 1);
+    if (buffer == NULL)
+    {
+        fatal_error("out of memory reading %s", path);
+    }
+    if (fread(buffer, 1, length, file) != (size_t)length)
+    {
+        fatal_error("%s: short read", path);
+    }
+    fclose(file);
+    buffer[length] = '\0';
+    *size = length;
+    return buffer;
+}
+
+static const char * FindRoot(void)
+{
+    static const char * const candidates[] = { ".", "..", "../.." };
+    for (size_t i = 0; i < sizeof(candidates) / sizeof(candidates[0]); i++)
+    {
+        char path[4096];
+        snprintf(path, sizeof(path), "%s/%s", candidates[i], PERSONAL_PATH);
+        if (access(path, R_OK) == 0)
+        {
+            return candidates[i];
+        }
+    }
+    return NULL;
+}
+
+static void AddSymbol(const char * name, int32_t value)
+{
+    if (sData.numSymbols == sData.capacity)
+    {
+        sData.capacity = sData.capacity ? sData.capacity * 2 : 1024;
+        sData.symbols = realloc(sData.symbols, sData.capacity * sizeof(Symbol));
+        if (sData.symbols == NULL)
+        {
+            fatal_error("out of memory");
+        }
+    }
+    sData.symbols[sData.numSymbols].name = strdup(name);
+    sData.symbols[sData.numSymbols].value = value;
+    sData.numSymbols++;
+}
+
+static void LoadHeader(const char * root, const char * relPath)
+{
+    char path[4096];
+    char line[1024];
+    snprintf(path, sizeof(path), "%s/%s", root, relPath);
+    FILE * file = fopen(path, "r");
+    if (file == NULL)
+    {
+        fatal_error("%s: %s", path, strerror(errno));
+    }
+    while (fgets(line, sizeof(line), file) != NULL)
+    {
+        char name[256];
+        char value[256];
+        // Only plain integers: anything built from other macros is skipped
+        if (sscanf(line, " #define %255s %255s", name, value) == 2)
+        {
+            char * end;
+            long long val = strtoll(value, &end, 0);
+            if (end != value && (*end == '\0' || (end[0] == '/' && end[1] == '/')))
+            {
+                AddSymbol(name, (int32_t)val);
+            }
+        }
+    }
+    fclose(file);
+}
+
+static bool FindSymbol(const char * name, int32_t * value)
+{
+    for (size_t i = 0; i < sData.numSymbols; i++)
+    {
+        if (strcmp(sData.symbols[i].name, name) == 0)
+        {
+            *value = sData.symbols[i].value;
+            return true;
+        }
+    }
+    return false;
+}
+
+static int32_t RequireSymbol(const char * name)
+{
+    int32_t value;
+    if (!FindSymbol(name, &value))
+    {
+        fatal_error("%s is not defined in the headers", name);
+    }
+    return value;
+}
+
+// First symbol with this prefix and value, without the prefix
+static const char * SymbolName(const char * prefix, int32_t value)
+{
+    size_t prefixLen = strlen(prefix);
+    for (size_t i = 0; i < sData.numSymbols; i++)
+    {
+        if (sData.symbols[i].value == value && strncmp(sData.symbols[i].name, prefix, prefixLen) == 0)
+        {
+            return sData.symbols[i].name + prefixLen;
+        }
+    }
+    return "?";
+}
+
+// A number, NAME or PREFIX_NAME, in any case
+static int32_t ParseSymbol(const char * prefix, const char * arg)
+{
+    char name[256];
+    char * end;
+    long long val = strtoll(arg, &end, 0);
+    int32_t value;
+
+    if (*arg != '\0' && *end == '\0')
+    {
+        return (int32_t)val;
+    }
+    snprintf(name, sizeof(name), "%s%s", strncasecmp(arg, prefix, strlen(prefix)) == 0 ? "" : prefix, arg);
+    for (char * c = name; *c != '\0'; c++)
+    {
+        *c = toupper((unsigned char)*c);
+    }
+    if (!FindSymbol(name, &value))
+    {
+        fatal_error("unknown name: %s", arg);
+    }
+    return value;
+}
+
+static uint32_t ReadU32(const uint8_t * p)
+{
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+// NARC: header, then BTAF (start/end per member), BTNF, GMIF (member data)
+static const uint8_t * Narc_Member(const uint8_t * narc, size_t size, int idx, uint32_t * memberSize, int * count)
+{
+    if (size < 16 || memcmp(narc, "NARC", 4) != 0)
+    {
+        return NULL;
+    }
+    uint32_t fatOffset = narc[12] | (narc[13] << 8);
+    const uint8_t * fat = narc + fatOffset;
+    if (fatOffset + 12 > size || memcmp(fat, "BTAF", 4) != 0)
+    {
+        return NULL;
+    }
+    *count = fat[8] | (fat[9] << 8);
+    const uint8_t * fnt = fat + ReadU32(fat + 4);
+    if (fnt + 8 > narc + size || memcmp(fnt, "BTNF", 4) != 0)
+    {
+        return NULL;
+    }
+    const uint8_t * img = fnt + ReadU32(fnt + 4);
+    if (img + 8 > narc + size || memcmp(img, "GMIF", 4) != 0 || idx >= *count)
+    {
+        return NULL;
+    }
+    uint32_t start = ReadU32(fat + 12 + 8 * idx);
+    uint32_t end = ReadU32(fat + 12 + 8 * idx + 4);
+    if (end < start || img + 8 + end > narc + size)
+    {
+        return NULL;
+    }
+    *memberSize = end - start;
+    return img + 8 + start;
+}
+
+static void LoadGameData(const char * root)
+{
+    size_t size;
+    uint32_t memberSize;
+    int count = 0;
+    EggTables * tables = &sData.tables;
+
+    for (int i = 0; i < NUM_HEADERS; i++)
+    {
+        LoadHeader(root, kHeaders[i]);
+    }
+    for (int i = 0; i < EGG_NUM_STATS; i++)
+    {
+        sData.powerItems[i] = RequireSymbol(kPowerItems[i]);
+    }
+    sData.everstone = RequireSymbol("ITEM_EVERSTONE");
+
+    // One BaseStats per species, formes after the last species
+    uint8_t * narc = ReadWholeFile(root, PERSONAL_PATH, &size);
+    if (Narc_Member(narc, size, 0, &memberSize, &count) == NULL || count > MAX_SPECIES + 64)
+    {
+        fatal_error("%s: not a NARC", PERSONAL_PATH);
+    }
+    uint8_t (*personal)[EGG_PERSONAL_SIZE] = calloc(count, EGG_PERSONAL_SIZE);
+    for (int i = 0; i < count; i++)
+    {
+        const uint8_t * p = Narc_Member(narc, size, i, &memberSize, &count);
+        if (p == NULL || memberSize < EGG_PERSONAL_SIZE)
+        {
+            fatal_error("%s: bad member %d", PERSONAL_PATH, i);
+        }
+        memcpy(personal[i], p, EGG_PERSONAL_SIZE);
+    }
+    tables->personal = (const uint8_t (*)[EGG_PERSONAL_SIZE])personal;
+    tables->numSpecies = count;
+    free(narc);
+
+    narc = ReadWholeFile(root, LEARNSETS_PATH, &size);
+    uint16_t (*learnsets)[EGG_LEARNSET_SIZE] = calloc(tables->numSpecies, sizeof(*learnsets));
+    for (int i = 0; i < tables->numSpecies; i++)
+    {
+        const uint8_t * p = Narc_Member(narc, size, i, &memberSize, &count);
+        int n = 0;
+        // Species past the end of wotbl.narc learn nothing
+        if (p != NULL)
+        {
+            for (; n < EGG_LEARNSET_SIZE - 1 && (uint32_t)n * 2 + 1 < memberSize; n++)
+            {
+                learnsets[i][n] = p[2 * n] | (p[2 * n + 1] << 8);
+                if (learnsets[i][n] == 0xFFFF)
+                {
+                    break;
+                }
+            }
+        }
+        learnsets[i][n] = 0xFFFF;
+    }
+    tables->learnsets = (const uint16_t (*)[EGG_LEARNSET_SIZE])learnsets;
+    free(narc);
+
+    uint8_t * pms = ReadWholeFile(root, BABY_SPECIES_PATH, &size);
+    uint16_t * babySpecies = calloc(tables->numSpecies, sizeof(uint16_t));
+    for (int i = 0; i < tables->numSpecies && (size_t)i * 2 + 1 < size; i++)
+    {
+        babySpecies[i] = pms[2 * i] | (pms[2 * i + 1] << 8);
+    }
+    tables->babySpecies = babySpecies;
+    free(pms);
+
+    narc = ReadWholeFile(root, EGG_MOVES_PATH, &size);
+    const uint8_t * p = Narc_Member(narc, size, 0, &memberSize, &count);
+    if (p == NULL)
+    {
+        fatal_error("%s: not a NARC", EGG_MOVES_PATH);
+    }
+    // LoadEggMoves scans 0x7FD entries and reads up to 16 past a match
+    tables->numEggMoves = memberSize / 2;
+    uint16_t * eggMoves = calloc(tables->numEggMoves + 0x7FD + 16, sizeof(uint16_t));
+    for (int i = 0; i < tables->numEggMoves; i++)
+    {
+        eggMoves[i] = p[2 * i] | (p[2 * i + 1] << 8);
+    }
+    tables->eggMoves = eggMoves;
+    free(narc);
+
+    Egg_SetTables(tables);
+}
+
+// ---------------------------------------------------------------------------
+// Parents
+
+static void ParseList(const char * prefix, const char * arg, uint16_t * out, int max, const char * what)
+{
+    char buf[256];
+    int n = 0;
+    snprintf(buf, sizeof(buf), "%s", arg);
+    for (char * tok = strtok(buf, "/"); tok != NULL; tok = strtok(NULL, "/"))
+    {
+        if (n == max)
+        {
+            fatal_error("too many %s: %s", what, arg);
+        }
+        out[n++] = (uint16_t)ParseSymbol(prefix, tok);
+    }
+}
+
+// "species=CHARIZARD,gender=female,nature=ADAMANT,ivs=31/31/31/31/31/31,
+// item=EVERSTONE,lang=JAPANESE,moves=DRAGON_DANCE/FLAMETHROWER"
+static void ParseParent(const char * arg, EggParent * parent)
+{
+    char buf[1024];
+    int nature = 0;
+    int gender = -1;
+    bool havePid = false;
+
+    memset(parent, 0, sizeof(*parent));
+    parent->language = RequireSymbol("LANGUAGE_ENGLISH");
+    snprintf(buf, sizeof(buf), "%s", arg);
+    char * save;
+    for (char * tok = strtok_r(buf, ",", &save); tok != NULL; tok = strtok_r(NULL, ",", &save))
+    {
+        char * value = strchr(tok, '=');
+        if (value == NULL)
+        {
+            fatal_error("expected key=value: %s", tok);
+        }
+        *value++ = '\0';
+        if (strcmp(tok, "species") == 0)
+        {
+            parent->species = ParseSymbol("SPECIES_", value);
+        }
+        else if (strcmp(tok, "forme") == 0)
+        {
+            parent->forme = ParseU32(value);
+        }
+        else if (strcmp(tok, "item") == 0)
+        {
+            parent->heldItem = ParseSymbol("ITEM_", value);
+        }
+        else if (strcmp(tok, "nature") == 0)
+        {
+            nature = ParseSymbol("NATURE_", value);
+        }
+        else if (strcmp(tok, "gender") == 0)
+        {
+            if (strcmp(value, "male") == 0 || strcmp(value, "m") == 0)
+            {
+                gender = 0;
+            }
+            else if (strcmp(value, "female") == 0 || strcmp(value, "f") == 0)
+            {
+                gender = 1;
+            }
+            else
+            {
+                fatal_error("gender is male or female: %s", value);
+            }
+        }
+        else if (strcmp(tok, "lang") == 0)
+        {
+            parent->language = ParseSymbol("LANGUAGE_", value);
+        }
+        else if (strcmp(tok, "pid") == 0)
+        {
+            parent->personality = ParseU32(value);
+            havePid = true;
+        }
+        else if (strcmp(tok, "ivs") == 0)
+        {
+            uint16_t ivs[EGG_NUM_STATS] = { 0 };
+            ParseList("", value, ivs, EGG_NUM_STATS, "IVs");
+            for (int i = 0; i < EGG_NUM_STATS; i++)
+            {
+                if (ivs[i] >= NUM_IVS)
+                {
+                    fatal_error("IVs are 0 to 31: %s", value);
+                }
+                parent->ivs[i] = ivs[i];
+            }
+        }
+        else if (strcmp(tok, "moves") == 0)
+        {
+            ParseList("MOVE_", value, parent->moves, EGG_NUM_MOVES, "moves");
+        }
+        else
+        {
+            fatal_error("unknown parent key: %s", tok);
+        }
+    }
+    if (parent->species == 0 || parent->species >= sData.tables.numSpecies || parent->species >= MAX_SPECIES)
+    {
+        fatal_error("parent needs a species: %s", arg);
+    }
+    if (havePid)
+    {
+        return;
+    }
+    // The first personality with the nature and gender asked for
+    for (uint32_t pid = nature; pid < 0xFFFFFFFFu - EGG_NUM_NATURES; pid += EGG_NUM_NATURES)
+    {
+        if (gender < 0 || Egg_GenderOf(parent->species, pid) == gender)
+        {
+            parent->personality = pid;
+            return;
+        }
+    }
+    fatal_error("%s can't be that gender", SymbolName("SPECIES_", parent->species));
+}
+
+static void PrintParent(const char * label, const EggParent * parent)
+{
+    static const char * const genders[] = { "male", "female", "genderless" };
+    printf("%s: %s (%s, %s, pid 0x%08X, lang %s)", label, SymbolName("SPECIES_", parent->species),
+        genders[Egg_GenderOf(parent->species, parent->personality)],
+        SymbolName("NATURE_", parent->personality % EGG_NUM_NATURES), parent->personality,
+        SymbolName("LANGUAGE_", parent->language));
+    printf(" IVs");
+    for (int i = 0; i < EGG_NUM_STATS; i++)
+    {
+        printf("%c%d", i == 0 ? ' ' : '/', parent->ivs[i]);
+    }
+    if (parent->heldItem != 0)
+    {
+        printf(" @%s", SymbolName("ITEM_", parent->heldItem));
+    }
+    for (int i = 0; i < EGG_NUM_MOVES && parent->moves[i] != 0; i++)
+    {
+        printf("%s%s", i == 0 ? " [" : " ", SymbolName("MOVE_", parent->moves[i]));
+        if (i == EGG_NUM_MOVES - 1 || parent->moves[i + 1] == 0)
+        {
+            printf("]");
+        }
+    }
+    printf("\n");
+}
+
+// ---------------------------------------------------------------------------
+// Simulation
+
+static void RecordEgg(EggStats * stats, const EggResult * egg, uint32_t otId)
+{
+    stats->eggs++;
+    stats->shiny += IsShiny(otId, egg->personality);
+    for (int i = 0; i < EGG_NUM_STATS; i++)
+    {
+        stats->ivs[i][egg->ivs[i]]++;
+    }
+    stats->natures[egg->personality % EGG_NUM_NATURES]++;
+    stats->species[egg->species % MAX_SPECIES]++;
+    for (int i = 0; i < EGG_NUM_MOVES; i++)
+    {
+        stats->moves[egg->moves[i] % MAX_MOVES]++;
+    }
+    for (int i = 0; i < stats->numMovesets; i++)
+    {
+        if (stats->movesets[i].species == egg->species && memcmp(stats->movesets[i].moves, egg->moves, sizeof(egg->moves)) == 0)
+        {
+            stats->movesets[i].count++;
+            return;
+        }
+    }
+    if (stats->numMovesets == MAX_MOVESETS)
+    {
+        stats->otherMovesets++;
+        return;
+    }
+    stats->movesets[stats->numMovesets].species = egg->species;
+    memcpy(stats->movesets[stats->numMovesets].moves, egg->moves, sizeof(egg->moves));
+    stats->movesets[stats->numMovesets].count = 1;
+    stats->numMovesets++;
+}
+
+static void MergeStats(EggStats * dest, const EggStats * src)
+{
+    dest->eggs += src->eggs;
+    dest->shiny += src->shiny;
+    for (int i = 0; i < EGG_NUM_STATS; i++)
+    {
+        for (int j = 0; j < NUM_IVS; j++)
+        {
+            dest->ivs[i][j] += src->ivs[i][j];
+        }
+    }
+    for (int i = 0; i < EGG_NUM_NATURES; i++)
+    {
+        dest->natures[i] += src->natures[i];
+    }
+    for (int i = 0; i < MAX_SPECIES; i++)
+    {
+        dest->species[i] += src->species[i];
+    }
+    for (int i = 0; i < MAX_MOVES; i++)
+    {
+        dest->moves[i] += src->moves[i];
+    }
+    dest->otherMovesets += src->otherMovesets;
+    for (int i = 0; i < src->numMovesets; i++)
+    {
+        int j;
+        for (j = 0; j < dest->numMovesets; j++)
+        {
+            if (dest->movesets[j].species == src->movesets[i].species
+                && memcmp(dest->movesets[j].moves, src->movesets[i].moves, sizeof(src->movesets[i].moves)) == 0)
+            {
+                dest->movesets[j].count += src->movesets[i].count;
+                break;
+            }
+        }
+        if (j < dest->numMovesets)
+        {
+            continue;
+        }
+        if (dest->numMovesets == MAX_MOVESETS)
+        {
+            dest->otherMovesets += src->movesets[i].count;
+            continue;
+        }
+        dest->movesets[dest->numMovesets++] = src->movesets[i];
+    }
+}
+
+// The chunks worker handles out of jobs. The LC state is reseeded for every
+// egg: between two eggs the game draws from it an unknown number of times.
+static void RunWorker(const EggConfig * config, int worker, int jobs, EggStats * stats)
+{
+    EggResult egg;
+    uint64_t key = SplitMix64(config->seed);
+
+    memset(stats, 0, sizeof(*stats));
+    Egg_SetParents(&config->parents[0], &config->parents[1]);
+    Egg_SetTrainerId(config->otId);
+    for (uint64_t chunk = worker; chunk * CHUNK_EGGS < config->eggs; chunk += jobs)
+    {
+        uint64_t start = chunk * CHUNK_EGGS;
+        uint64_t end = start + CHUNK_EGGS < config->eggs ? start + CHUNK_EGGS : config->eggs;
+        Egg_SetMTRNGSeed((uint32_t)SplitMix64(key ^ ~chunk));
+        for (uint64_t i = start; i < end; i++)
+        {
+            Egg_SetLCRNGSeed((uint32_t)SplitMix64(key + i));
+            Egg_Generate(&egg);
+            RecordEgg(stats, &egg, config->otId);
+        }
+    }
+}
+
+static void ReadAll(int fd, void * buf, size_t size)
+{
+    uint8_t * p = buf;
+    while (size != 0)
+    {
+        ssize_t n = read(fd, p, size);
+        if (n <= 0)
+        {
+            if (n < 0 && errno == EINTR)
+            {
+                continue;
+            }
+            fatal_error("worker died before sending its counts");
+        }
+        p += n;
+        size -= n;
+    }
+}
+
+static void WriteAll(int fd, const void * buf, size_t size)
+{
+    const uint8_t * p = buf;
+    while (size != 0)
+    {
+        ssize_t n = write(fd, p, size);
+        if (n < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            _exit(EXIT_FAILURE);
+        }
+        p += n;
+        size -= n;
+    }
+}
+
+// The RNG state in math_util.c is global, so workers are processes rather than
+// threads: each one gets its own copy of the game's globals.
+static void Simulate(const EggConfig * config, EggStats * stats)
+{
+    int jobs = config->jobs;
+    uint64_t numChunks = (config->eggs + CHUNK_EGGS - 1) / CHUNK_EGGS;
+    if ((uint64_t)jobs > numChunks)
+    {
+        jobs = numChunks > 0 ? (int)numChunks : 1;
+    }
+    if (jobs == 1)
+    {
+        RunWorker(config, 0, 1, stats);
+        return;
+    }
+
+    EggStats * part = malloc(sizeof(EggStats));
+    pid_t * pids = malloc(jobs * sizeof(pid_t));
+    int * fds = malloc(jobs * sizeof(int));
+    if (part == NULL || pids == NULL || fds == NULL)
+    {
+        fatal_error("out of memory");
+    }
+    fflush(stdout);
+    for (int i = 0; i < jobs; i++)
+    {
+        int pipeFds[2];
+        if (pipe(pipeFds) != 0)
+        {
+            fatal_error("pipe: %s", strerror(errno));
+        }
+        pids[i] = fork();
+        if (pids[i] < 0)
+        {
+            fatal_error("fork: %s", strerror(errno));
+        }
+        if (pids[i] == 0)
+        {
+            close(pipeFds[0]);
+            RunWorker(config, i, jobs, part);
+            WriteAll(pipeFds[1], part, sizeof(EggStats));
+            _exit(EXIT_SUCCESS);
+        }
+        close(pipeFds[1]);
+        fds[i] = pipeFds[0];
+    }
+    memset(stats, 0, sizeof(*stats));
+    for (int i = 0; i < jobs; i++)
+    {
+        int status;
+        ReadAll(fds[i], part, sizeof(EggStats));
+        close(fds[i]);
+        waitpid(pids[i], &status, 0);
+        MergeStats(stats, part);
+    }
+    free(fds);
+    free(pids);
+    free(part);
+}
+
+// ---------------------------------------------------------------------------
+// Expected distributions
+
+static int PowerItemStat(uint16_t item)
+{
+    for (int i = 0; i < EGG_NUM_STATS; i++)
+    {
+        if (item == sData.powerItems[i])
+        {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static bool IsMasuda(const EggConfig * config)
+{
+    return config->parents[0].language != config->parents[1].language;
+}
+
+static double ShinyChance(const EggConfig * config)
+{
+    if (IsMasuda(config))
+    {
+        return 1.0 - pow(1.0 - SHINY_CHANCE, 1 + MASUDA_REROLLS);
+    }
+    return SHINY_CHANCE;
+}
+
+// InheritIVs: three different stats come from a parent picked by LCRandom() % 2
+// each, the rest keep what CreateMon rolled. A power item makes its stat the
+// first pick, from its holder; with two, LCRandom() % 2 picks the item.
+// naive ignores power items, for the selftest to check it gets rejected.
+static void ExpectedIvs(const EggConfig * config, int stat, bool naive, double * probs)
+{
+    double fromParent[2] = { 0.0, 0.0 };
+    int forced[2];
+    int numForced = 0;
+
+    for (int i = 0; i < 2; i++)
+    {
+        forced[i] = naive ? -1 : PowerItemStat(config->parents[i].heldItem);
+        numForced += forced[i] >= 0;
+    }
+    if (numForced == 0)
+    {
+        fromParent[0] = fromParent[1] = 0.5 * 0.5;
+    }
+    else
+    {
+        for (int holder = 0; holder < 2; holder++)
+        {
+            if (forced[holder] < 0)
+            {
+                continue;
+            }
+            double weight = numForced == 2 ? 0.5 : 1.0;
+            if (forced[holder] == stat)
+            {
+                fromParent[holder] += weight;
+            }
+            else
+            {
+                // Two of the five stats left, each from either parent
+                fromParent[0] += weight * 0.4 * 0.5;
+                fromParent[1] += weight * 0.4 * 0.5;
+            }
+        }
+    }
+    for (int v = 0; v < NUM_IVS; v++)
+    {
+        probs[v] = (1.0 - fromParent[0] - fromParent[1]) / NUM_IVS;
+    }
+    probs[config->parents[0].ivs[stat]] += fromParent[0];
+    probs[config->parents[1].ivs[stat]] += fromParent[1];
+}
+
+// GetNatureFromPersonality is pid % 25 of a 32-bit PID. An everstone holder's
+// nature is kept with EVERSTONE_CHANCE; with two, LCRandom() % 2 picks the
+// holder. The Masuda rerolls in SetBreedEggStats come after and change the
+// nature unless the first PID was already shiny.
+static void ExpectedNatures(const EggConfig * config, double * probs)
+{
+    double uniform[EGG_NUM_NATURES];
+    int holders[2];
+    int numHolders = 0;
+
+    for (int i = 0; i < EGG_NUM_NATURES; i++)
+    {
+        uint64_t count = (0x100000000ull - i + EGG_NUM_NATURES - 1) / EGG_NUM_NATURES;
+        uniform[i] = (double)count / 4294967296.0;
+    }
+    for (int i = 0; i < 2; i++)
+    {
+        if (config->parents[i].heldItem == sData.everstone)
+        {
+            holders[numHolders++] = i;
+        }
+    }
+    double kept = numHolders == 0 ? 0.0 : EVERSTONE_CHANCE;
+    if (IsMasuda(config))
+    {
+        kept *= SHINY_CHANCE;
+    }
+    for (int i = 0; i < EGG_NUM_NATURES; i++)
+    {
+        probs[i] = (1.0 - kept) * uniform[i];
+    }
+    for (int i = 0; i < numHolders; i++)
+    {
+        probs[config->parents[holders[i]].personality % EGG_NUM_NATURES] += kept / numHolders;
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Chi-square
+
+// Regularized upper incomplete gamma function Q(a, x)
+static double GammaQ(double a, double x)
+{
+    if (x <= 0.0)
+    {
+        return 1.0;
+    }
+    double lnPrefix = a * log(x) - x - lgamma(a);
+    if (x < a + 1.0)
+    {
+        // Series for P(a, x)
+        double term = 1.0 / a;
+        double sum = term;
+        for (int n = 1; n < 10000; n++)
+        {
+            term *= x / (a + n);
+            sum += term;
+            if (fabs(term) < fabs(sum) * 1e-15)
+            {
+                break;
+            }
+        }
+        return 1.0 - sum * exp(lnPrefix);
+    }
+    // Continued fraction for Q(a, x), modified Lentz
+    double b = x + 1.0 - a;
+    double c = 1.0 / 1e-300;
+    double d = 1.0 / b;
+    double h = d;
+    for (int n = 1; n < 10000; n++)
+    {
+        double an = -n * (n - a);
+        b += 2.0;
+        d = an * d + b;
+        if (fabs(d) < 1e-300)
+        {
+            d = 1e-300;
+        }
+        c = b + an / c;
+        if (fabs(c) < 1e-300)
+        {
+            c = 1e-300;
+        }
+        d = 1.0 / d;
+        double delta = d * c;
+        h *= delta;
+        if (fabs(delta - 1.0) < 1e-15)
+        {
+            break;
+        }
+    }
+    return exp(lnPrefix) * h;
+}
+
+// Pearson's test of observed counts against cell probabilities. A count in a
+// cell that can't happen fails outright.
+static ChiSquare ChiSquareTest(const uint64_t * observed, const double * probs, int numCells)
+{
+    ChiSquare ret = { 0.0, -1, 1.0, INFINITY };
+    uint64_t total = 0;
+
+    for (int i = 0; i < numCells; i++)
+    {
+        total += observed[i];
+    }
+    for (int i = 0; i < numCells; i++)
+    {
+        double expected = probs[i] * total;
+        if (expected <= 0.0)
+        {
+            if (observed[i] != 0)
+            {
+                ret.stat = INFINITY;
+            }
+            continue;
+        }
+        double diff = observed[i] - expected;
+        ret.stat += diff * diff / expected;
+        ret.dof++;
+        if (expected < ret.minExpected)
+        {
+            ret.minExpected = expected;
+        }
+    }
+    if (isinf(ret.stat))
+    {
+        ret.p = 0.0;
+    }
+    else if (ret.dof > 0)
+    {
+        ret.p = GammaQ(ret.dof / 2.0, ret.stat / 2.0);
+    }
+    return ret;
+}
+
+static bool ReportTest(const char * name, ChiSquare result, double alpha)
+{
+    bool pass = result.p >= alpha;
+    printf("  %-12s chi2 %12.2f  dof %3d  p %.4f  %s%s\n", name, result.stat, result.dof, result.p,
+        pass ? "ok" : "FAIL", result.minExpected < 5.0 ? " (expected counts below 5, run more eggs)" : "");
+    return pass;
+}
+
+// Runs every test against stats and returns the number that failed
+static int CheckStats(const EggConfig * config, const EggStats * stats, double alpha, bool naive)
+{
+    double probs[NUM_IVS];
+    int failures = 0;
+
+    for (int i = 0; i < EGG_NUM_STATS; i++)
+    {
+        char name[32];
+        snprintf(name, sizeof(name), "IV %s", kStatNames[i]);
+        ExpectedIvs(config, i, naive, probs);
+        failures += !ReportTest(name, ChiSquareTest(stats->ivs[i], probs, NUM_IVS), alpha);
+    }
+
+    ExpectedNatures(config, probs);
+    failures += !ReportTest("nature", ChiSquareTest(stats->natures, probs, EGG_NUM_NATURES), alpha);
+
+    uint64_t shiny[2] = { stats->shiny, stats->eggs - stats->shiny };
+    probs[0] = ShinyChance(config);
+    probs[1] = 1.0 - probs[0];
+    failures += !ReportTest("shiny", ChiSquareTest(shiny, probs, 2), alpha);
+
+    // Daycare_GetEggSpecies splits these two pairs on bit 15 of the egg PID
+    static const char * const pairs[][2] = {
+        { "SPECIES_NIDORAN_F", "SPECIES_NIDORAN_M" },
+        { "SPECIES_ILLUMISE", "SPECIES_VOLBEAT" },
+    };
+    for (size_t i = 0; i < sizeof(pairs) / sizeof(pairs[0]); i++)
+    {
+        int a = RequireSymbol(pairs[i][0]);
+        int b = RequireSymbol(pairs[i][1]);
+        if (stats->species[a] + stats->species[b] == stats->eggs)
+        {
+            uint64_t counts[2] = { stats->species[a], stats->species[b] };
+            probs[0] = probs[1] = 0.5;
+            failures += !ReportTest("species", ChiSquareTest(counts, probs, 2), alpha);
+        }
+    }
+
+    // InheritMoves draws no random numbers, so every egg of a species should
+    // know the same moves
+    int numSpecies = 0;
+    for (int i = 0; i < MAX_SPECIES; i++)
+    {
+        numSpecies += stats->species[i] != 0;
+    }
+    bool oneMoveset = stats->numMovesets == numSpecies && stats->otherMovesets == 0;
+    printf("  %-12s %d for %d species  %s\n", "movesets", stats->numMovesets + (stats->otherMovesets != 0), numSpecies, oneMoveset ? "ok" : "FAIL");
+    failures += !oneMoveset;
+    return failures;
+}
+
+static void PrintMoves(const uint16_t * moves)
+{
+    for (int i = 0; i < EGG_NUM_MOVES; i++)
+    {
+        printf("%s%s", i == 0 ? "" : " ", moves[i] == 0 ? "-" : SymbolName("MOVE_", moves[i]));
+    }
+}
+
+static void PrintStats(const EggConfig * config, const EggStats * stats)
+{
+    double probs[NUM_IVS];
+    double total = stats->eggs ? (double)stats->eggs : 1.0;
+
+    printf("\nspecies:\n");
+    for (int i = 0; i < MAX_SPECIES; i++)
+    {
+        if (stats->species[i] != 0)
+        {
+            printf("  %-12s %12llu  %7.3f%%\n", SymbolName("SPECIES_", i), (unsigned long long)stats->species[i], 100.0 * stats->species[i] / total);
+        }
+    }
+
+    printf("\nIVs, %% of eggs (expected in brackets where it differs from 1/32):\n   ");
+    for (int i = 0; i < EGG_NUM_STATS; i++)
+    {
+        printf("  %16s", kStatNames[i]);
+    }
+    printf("\n");
+    for (int v = 0; v < NUM_IVS; v++)
+    {
+        printf("%3d", v);
+        for (int i = 0; i < EGG_NUM_STATS; i++)
+        {
+            ExpectedIvs(config, i, false, probs);
+            char expected[16] = "";
+            if (fabs(probs[v] - 1.0 / NUM_IVS) > 1e-9)
+            {
+                snprintf(expected, sizeof(expected), "(%.3f)", 100.0 * probs[v]);
+            }
+            printf("  %7.3f %8s", 100.0 * stats->ivs[i][v] / total, expected);
+        }
+        printf("\n");
+    }
+
+    printf("\nnatures:\n");
+    ExpectedNatures(config, probs);
+    for (int i = 0; i < EGG_NUM_NATURES; i++)
+    {
+        printf("  %-8s %12llu  %7.3f%%  (%.3f%%)\n", SymbolName("NATURE_", i), (unsigned long long)stats->natures[i],
+            100.0 * stats->natures[i] / total, 100.0 * probs[i]);
+    }
+
+    printf("\nshiny: %llu (1 in %.1f, expected 1 in %.1f)\n", (unsigned long long)stats->shiny,
+        stats->shiny ? total / stats->shiny : INFINITY, 1.0 / ShinyChance(config));
+
+    printf("\nmovesets:\n");
+    for (int i = 0; i < stats->numMovesets; i++)
+    {
+        printf("  %-12s %12llu  %7.3f%%  ", SymbolName("SPECIES_", stats->movesets[i].species),
+            (unsigned long long)stats->movesets[i].count, 100.0 * stats->movesets[i].count / total);
+        PrintMoves(stats->movesets[i].moves);
+        printf("\n");
+    }
+    if (stats->otherMovesets != 0)
+    {
+        printf("  %-12s %12llu  %7.3f%%\n", "(others)", (unsigned long long)stats->otherMovesets, 100.0 * stats->otherMovesets / total);
+    }
+    printf("\nmoves known:\n");
+    for (int i = 1; i < MAX_MOVES; i++)
+    {
+        if (stats->moves[i] != 0)
+        {
+            printf("  %-16s %7.3f%%\n", SymbolName("MOVE_", i), 100.0 * stats->moves[i] / total);
+        }
+    }
+}
+
+static void RunTimed(const EggConfig * config, EggStats * stats)
+{
+    double start = Now();
+    Simulate(config, stats);
+    double elapsed = Now() - start;
+    printf("%llu eggs in %.2fs (%.0f/s, %d jobs)\n", (unsigned long long)stats->eggs, elapsed,
+        elapsed > 0 ? stats->eggs / elapsed : 0.0, config->jobs);
+}
+
+static int CommandRun(const EggConfig * config, bool check, double alpha)
+{
+    EggStats * stats = malloc(sizeof(EggStats));
+    if (stats == NULL)
+    {
+        fatal_error("out of memory");
+    }
+    PrintParent("parent 0", &config->parents[0]);
+    PrintParent("parent 1", &config->parents[1]);
+    RunTimed(config, stats);
+    PrintStats(config, stats);
+    int failures = 0;
+    if (check)
+    {
+        printf("\nchi-square, alpha %g:\n", alpha);
+        failures = CheckStats(config, stats, alpha, false);
+        printf("%d failed\n", failures);
+    }
+    free(stats);
+    return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+// ---------------------------------------------------------------------------
+// Self-test
+
+typedef struct SelfTestCase
+{
+    const char * name;
+    const char * parents[2];
+    const char * moveset; // what every egg should know, or NULL
+    bool naive;           // test against the model without power items, which must fail
+} SelfTestCase;
+
+#define CHARIZARD_F "species=CHARIZARD,gender=female,ivs=31/30/29/28/27/26,moves=SCARY_FACE/FLAMETHROWER"
+#define CHARIZARD_M "species=CHARIZARD,gender=male,nature=MODEST,ivs=0/1/2/3/4/5,moves=DRAGON_DANCE/FLAMETHROWER/SCARY_FACE"
+#define CHARIZARD_MOVES "GROWL/DRAGON_DANCE/FLAMETHROWER/SCARY_FACE"
+
+static const SelfTestCase kSelfTests[] = {
+    { "plain", { CHARIZARD_F ",nature=ADAMANT", CHARIZARD_M }, CHARIZARD_MOVES, false },
+    { "power item", { CHARIZARD_F, CHARIZARD_M ",item=POWER_BRACER" }, CHARIZARD_MOVES, false },
+    { "two power items", { CHARIZARD_F ",item=POWER_LENS", CHARIZARD_M ",item=POWER_BRACER" }, CHARIZARD_MOVES, false },
+    { "power items, naive model", { CHARIZARD_F ",item=POWER_LENS", CHARIZARD_M ",item=POWER_BRACER" }, NULL, true },
+    { "everstone", { CHARIZARD_F ",nature=ADAMANT,item=EVERSTONE", CHARIZARD_M }, CHARIZARD_MOVES, false },
+    { "two everstones", { CHARIZARD_F ",nature=ADAMANT,item=EVERSTONE", CHARIZARD_M ",item=EVERSTONE" }, CHARIZARD_MOVES, false },
+    { "masuda", { CHARIZARD_F ",lang=JAPANESE", CHARIZARD_M }, CHARIZARD_MOVES, false },
+    { "masuda, everstone", { CHARIZARD_F ",nature=ADAMANT,item=EVERSTONE,lang=JAPANESE", CHARIZARD_M }, CHARIZARD_MOVES, false },
+    { "nidoran", { "species=NIDORAN_F,ivs=31/31/31/31/31/31", "species=NIDORAN_M,ivs=0/0/0/0/0/0,item=POWER_WEIGHT" }, NULL, false },
+    { "ditto", { "species=DITTO,ivs=31/31/31/0/0/0,item=EVERSTONE,nature=TIMID", "species=ZUBAT,gender=male,ivs=0/0/0/31/31/31" }, NULL, false },
+};
+
+static int CommandSelfTest(uint64_t eggs, int jobs, double alpha)
+{
+    EggStats * stats = malloc(sizeof(EggStats));
+    int failed = 0;
+
+    if (stats == NULL)
+    {
+        fatal_error("out of memory");
+    }
+    for (size_t t = 0; t < sizeof(kSelfTests) / sizeof(kSelfTests[0]); t++)
+    {
+        const SelfTestCase * test = &kSelfTests[t];
+        EggConfig config = { .otId = 0x12345678, .eggs = eggs, .seed = 0x5EED0000 + t, .jobs = jobs };
+        ParseParent(test->parents[0], &config.parents[0]);
+        ParseParent(test->parents[1], &config.parents[1]);
+
+        printf("%s: ", test->name);
+        RunTimed(&config, stats);
+        int failures = CheckStats(&config, stats, alpha, test->naive);
+        if (test->moveset != NULL && stats->numMovesets > 0)
+        {
+            uint16_t moves[EGG_NUM_MOVES] = { 0 };
+            ParseList("MOVE_", test->moveset, moves, EGG_NUM_MOVES, "moves");
+            bool match = memcmp(moves, stats->movesets[0].moves, sizeof(moves)) == 0;
+            printf("  %-12s ", "egg moves");
+            PrintMoves(stats->movesets[0].moves);
+            printf("  %s\n", match ? "ok" : "FAIL");
+            failures += !match;
+        }
+        // The naive model has to be told apart from the real one
+        bool pass = test->naive ? failures > 0 : failures == 0;
+        printf("  %s\n", pass ? "passed" : "FAILED");
+        failed += !pass;
+    }
+    free(stats);
+    printf("%d of %zu scenarios failed\n", failed, sizeof(kSelfTests) / sizeof(kSelfTests[0]));
+    return failed == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+// ---------------------------------------------------------------------------
+
+static noreturn void Usage(const char * prog)
+{
+    fprintf(stderr,
+        "Usage: %s COMMAND [options]\n"
+        "Runs src/get_egg.c on the host and reports what the eggs come out as.\n"
+        "Commands:\n"
+        "  run --mother SPEC --father SPEC   breed N eggs, print IV, nature, shiny\n"
+        "                                    and move distributions\n"
+        "  selftest                          chi-square check a set of day-care\n"
+        "                                    setups against the expected odds\n"
+        "Options:\n"
+        "  --mother SPEC, --father SPEC      day-care slots 0 and 1, as key=value\n"
+        "                                    pairs: species=, gender=male|female,\n"
+        "                                    nature=, ivs=a/b/c/d/e/f, item=,\n"
+        "                                    moves=a/b/c/d, lang=, pid=, forme=\n"
+        "  --eggs N                          eggs to generate (default %d, selftest %d)\n"
+        "  --jobs N                          worker processes (default: all cores)\n"
+        "  --seed N                          seed for the LC and MT streams\n"
+        "  --tid N, --sid N                  trainer the Masuda rerolls test against\n"
+        "  --check                           run: also chi-square the results\n"
+        "  --alpha P                         fail tests with a p-value below P\n"
+        "                                    (default %g)\n",
+        prog, DEFAULT_EGGS, SELFTEST_EGGS, DEFAULT_ALPHA);
+    exit(EXIT_FAILURE);
+}
+
+int main(int argc, char ** argv)
+{
+    if (argc < 2)
+    {
+        Usage(argv[0]);
+    }
+    const char * command = argv[1];
+    const char * parentSpecs[2] = { NULL, NULL };
+    uint64_t eggs = 0;
+    long numCpus = sysconf(_SC_NPROCESSORS_ONLN);
+    int jobs = numCpus > 0 ? (int)numCpus : 1;
+    uint32_t seed = 0;
+    uint32_t tid = 0;
+    uint32_t sid = 0;
+    bool check = false;
+    double alpha = DEFAULT_ALPHA;
+
+    for (int i = 2; i < argc; i++)
+    {
+        const char * opt = argv[i];
+        if (strcmp(opt, "--check") == 0)
+        {
+            check = true;
+            continue;
+        }
+        if (i + 1 >= argc)
+        {
+            Usage(argv[0]);
+        }
+        if (strcmp(opt, "--mother") == 0)
+        {
+            parentSpecs[0] = argv[++i];
+        }
+        else if (strcmp(opt, "--father") == 0)
+        {
+            parentSpecs[1] = argv[++i];
+        }
+        else if (strcmp(opt, "--eggs") == 0)
+        {
+            eggs = ParseU64(argv[++i]);
+        }
+        else if (strcmp(opt, "--jobs") == 0)
+        {
+            jobs = ParseU32(argv[++i]);
+        }
+        else if (strcmp(opt, "--seed") == 0)
+        {
+            seed = ParseU32(argv[++i]);
+        }
+        else if (strcmp(opt, "--tid") == 0)
+        {
+            tid = ParseU32(argv[++i]) & 0xFFFF;
+        }
+        else if (strcmp(opt, "--sid") == 0)
+        {
+            sid = ParseU32(argv[++i]) & 0xFFFF;
+        }
+        else if (strcmp(opt, "--alpha") == 0)
+        {
+            alpha = strtod(argv[++i], NULL);
+        }
+        else
+        {
+            Usage(argv[0]);
+        }
+    }
+    if (jobs < 1)
+    {
+        jobs = 1;
+    }
+
+    const char * root = FindRoot();
+    if (root == NULL)
+    {
+        fatal_error("run eggsim from the repository or tools/eggsim");
+    }
+    LoadGameData(root);
+
+    if (strcmp(command, "run") == 0)
+    {
+        if (parentSpecs[0] == NULL || parentSpecs[1] == NULL)
+        {
+            Usage(argv[0]);
+        }
+        EggConfig config = { .otId = (sid << 16) | tid, .eggs = eggs ? eggs : DEFAULT_EGGS, .seed = seed, .jobs = jobs };
+        ParseParent(parentSpecs[0], &config.parents[0]);
+        ParseParent(parentSpecs[1], &config.parents[1]);
+        return CommandRun(&config, check, alpha);
+    }
+    if (strcmp(command, "selftest") == 0)
+    {
+        return CommandSelfTest(eggs ? eggs : SELFTEST_EGGS, jobs, alpha);
+    }
+    Usage(argv[0]);
+}
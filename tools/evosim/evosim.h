@@ -0,0 +1,82 @@
+#ifndef GUARD_EVOSIM_EVOSIM_H
+#define GUARD_EVOSIM_EVOSIM_H
+
+// The boundary between the host side (main.c) and the objects built from the
+// game's sources (game.c, hostevo.c and src/). Plain C types only, so that
+// both sides can include it with their own headers.
+
+#include <stdint.h>
+
+#define EVO_MON_SIZE        0xEC        // sizeof(Pokemon), as on the ARM
+#define EVO_MAX_ITEMS       1024
+#define EVO_MAX_PARTY       6
+
+// The evo and personal NARCs, as whole archive images, and the hold effect of
+// every item, which is all GetMonEvolution asks of the item data. The host
+// owns the memory; it must outlive every call below.
+typedef struct EvoData
+{
+    const uint8_t * evo;
+    uint32_t evoSize;
+    const uint8_t * personal;
+    uint32_t personalSize;
+    const uint8_t * holdEffects;  // EVO_MAX_ITEMS entries
+} EvoData;
+
+// The mon GetMonEvolution is asked about. Everything else in it is zero.
+typedef struct EvoMon
+{
+    uint32_t personality;
+    uint16_t species;
+    uint16_t heldItem;
+    uint16_t moves[4];
+    uint16_t atk;
+    uint16_t def;
+    uint8_t level;
+    uint8_t friendship;
+    uint8_t beauty;
+    uint8_t forme;
+} EvoMon;
+
+// What GetMonEvolution sees of the rest of the game
+typedef struct EvoWorld
+{
+    int nighttime;                // IsNighttime
+    int numPartySpecies;
+    uint16_t partySpecies[EVO_MAX_PARTY];
+} EvoWorld;
+
+// The card and the heap, as seen by the game code
+typedef struct EvoIo
+{
+    uint32_t opens;           // FS_OpenFile
+    uint32_t reads;           // FS_ReadFile
+    uint32_t evoReads;        // FS_ReadFile on the evo NARC
+    uint32_t bytesRead;
+    uint32_t allocs;
+    uint32_t liveBlocks;
+    uint32_t liveBytes;
+} EvoIo;
+
+void Evo_SetData(const EvoData * data);
+void Evo_SetWorld(const EvoWorld * world);
+// Clears the counters; blocks still live stay live
+void Evo_ResetIo(void);
+void Evo_GetIo(EvoIo * io);
+
+// pokemon.c is built twice, as it ships (EvoBase_) and with
+// OPTIMIZE_EVOLUTION_INDEX (EvoIndex_). Open and Close are what FieldSys_New
+// and FieldSys_Delete do with the index. GetEvolution builds the mon with
+// the game's own SetMonData, calls GetMonEvolution, with the world's party or
+// with none, and leaves the mon's bytes, encrypted as the game keeps them, in
+// monAfter.
+#define EVO_DECLARE_VARIANT(prefix)                                          \
+    void prefix##Open(void);                                                 \
+    void prefix##Close(void);                                                \
+    int prefix##GetEvolution(const EvoMon * mon, int context,                \
+        uint16_t usedItem, int withParty, int * method, uint8_t * monAfter);
+
+EVO_DECLARE_VARIANT(EvoBase_)
+EVO_DECLARE_VARIANT(EvoIndex_)
+
+#endif //GUARD_EVOSIM_EVOSIM_H
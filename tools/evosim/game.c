@@ -0,0 +1,68 @@
+// pokemon.c as the game builds it, with or without OPTIMIZE_EVOLUTION_INDEX.
+// The Makefile compiles this file once per variant with EVO_PREFIX set and
+// hides everything but the functions below, so that both copies of
+// pokemon.c can be linked into one program.
+#include "../../src/pokemon.c"
+
+#pragma GCC visibility push(default)
+#include "evosim.h"
+
+#define EVO_CAT_(a, b) a##b
+#define EVO_CAT(a, b) EVO_CAT_(a, b)
+#define EVO_FUNC(name) EVO_CAT(EVO_PREFIX, name)
+
+_Static_assert(sizeof(Pokemon) == EVO_MON_SIZE, "EVO_MON_SIZE must match sizeof(Pokemon)");
+
+// Stands in for the party; PartyHasMon in hostevo.c never looks inside it
+static PARTY *sParty = (PARTY *)&sParty;
+
+void EVO_FUNC(Open)(void) {
+#ifdef OPTIMIZE_EVOLUTION_INDEX
+    EvolutionIndex_Init(HEAP_ID_FIELD);
+#endif //OPTIMIZE_EVOLUTION_INDEX
+}
+
+void EVO_FUNC(Close)(void) {
+#ifdef OPTIMIZE_EVOLUTION_INDEX
+    EvolutionIndex_Free();
+#endif //OPTIMIZE_EVOLUTION_INDEX
+}
+
+int EVO_FUNC(GetEvolution)(const EvoMon *evoMon, int context, uint16_t usedItem, int withParty, int *method, uint8_t *monAfter) {
+    Pokemon mon;
+    u32 value;
+    int i;
+    BOOL decry;
+    int target;
+
+    ZeroMonData(&mon);
+    decry = AcquireMonLock(&mon);
+    value = evoMon->personality;
+    SetMonData(&mon, MON_DATA_PERSONALITY, &value);
+    value = evoMon->species;
+    SetMonData(&mon, MON_DATA_SPECIES, &value);
+    value = evoMon->heldItem;
+    SetMonData(&mon, MON_DATA_HELD_ITEM, &value);
+    for (i = 0; i < MAX_MON_MOVES; i++) {
+        value = evoMon->moves[i];
+        SetMonData(&mon, MON_DATA_MOVE1 + i, &value);
+    }
+    value = evoMon->atk;
+    SetMonData(&mon, MON_DATA_ATK, &value);
+    value = evoMon->def;
+    SetMonData(&mon, MON_DATA_DEF, &value);
+    value = evoMon->level;
+    SetMonData(&mon, MON_DATA_LEVEL, &value);
+    value = evoMon->friendship;
+    SetMonData(&mon, MON_DATA_FRIENDSHIP, &value);
+    value = evoMon->beauty;
+    SetMonData(&mon, MON_DATA_BEAUTY, &value);
+    value = evoMon->forme;
+    SetMonData(&mon, MON_DATA_FORME, &value);
+    ReleaseMonLock(&mon, decry);
+
+    target = GetMonEvolution(withParty ? sParty : NULL, &mon, (u8)context, usedItem, method);
+    MI_CpuCopy8(&mon, monAfter, sizeof(Pokemon));
+    return target;
+}
+#pragma GCC visibility pop
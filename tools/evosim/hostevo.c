@@ -0,0 +1,223 @@
+#include "global.h"
+#include "filesystem.h"
+#include "heap.h"
+#include "item.h"
+#include "constants/items.h"
+#include "party.h"
+#include "gf_rtc.h"
+#include "mail.h"
+#include "map_section.h"
+#include "move.h"
+#include "msgdata.h"
+#include "pm_string.h"
+#include "seal_case.h"
+#include "string_util.h"
+#include "evosim.h"
+
+// The parts of heap.c, item.c, party.c, gf_rtc.c and the NitroSDK file system
+// that GetMonEvolution reaches. filesystem.c itself is built unchanged, so
+// every NARC access goes through the same FS_OpenFile, FS_SeekFile and
+// FS_ReadFile calls as on the card; here they read the archive images the
+// host built.
+
+#define HOST_MAX_BLOCKS     64
+
+typedef struct HostBlock {
+    void *ptr;
+    u32 size;
+} HostBlock;
+
+static const EvoData *sData;
+static EvoWorld sWorld;
+static HostBlock sBlocks[HOST_MAX_BLOCKS];
+static int sNumBlocks;
+static EvoIo sIo;
+
+void Evo_SetData(const EvoData *data) {
+    sData = data;
+}
+
+void Evo_SetWorld(const EvoWorld *world) {
+    sWorld = *world;
+}
+
+void Evo_ResetIo(void) {
+    MI_CpuFill8(&sIo, 0, sizeof(EvoIo));
+}
+
+void Evo_GetIo(EvoIo *io) {
+    int i;
+
+    *io = sIo;
+    io->liveBlocks = sNumBlocks;
+    io->liveBytes = 0;
+    for (i = 0; i < sNumBlocks; i++) {
+        io->liveBytes += sBlocks[i].size;
+    }
+}
+
+void *AllocFromHeap(HeapID heap_id, u32 size) {
+    void *ptr;
+
+    GF_ASSERT(sNumBlocks < HOST_MAX_BLOCKS);
+    ptr = __builtin_malloc(size);
+    GF_ASSERT(ptr != NULL);
+    // Fresh blocks hold garbage, as the game's heap does
+    __builtin_memset(ptr, 0xA5, size);
+    sBlocks[sNumBlocks].ptr = ptr;
+    sBlocks[sNumBlocks].size = size;
+    sNumBlocks++;
+    sIo.allocs++;
+    return ptr;
+}
+
+void *AllocFromHeapAtEnd(HeapID heap_id, u32 size) {
+    return AllocFromHeap(heap_id, size);
+}
+
+void FreeToHeap(void *ptr) {
+    int i;
+
+    for (i = 0; i < sNumBlocks; i++) {
+        if (sBlocks[i].ptr == ptr) {
+            break;
+        }
+    }
+    GF_ASSERT(i < sNumBlocks);
+    __builtin_free(ptr);
+    sBlocks[i] = sBlocks[--sNumBlocks];
+}
+
+void FreeToHeapExplicit(HeapID heap_id, void *ptr) {
+    FreeToHeap(ptr);
+}
+
+BOOL IsNighttime(void) {
+    return sWorld.nighttime;
+}
+
+BOOL PartyHasMon(PARTY *party, u16 species) {
+    int i;
+
+    for (i = 0; i < sWorld.numPartySpecies; i++) {
+        if (sWorld.partySpecies[i] == species) {
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
+
+s32 GetItemAttr(u16 itemId, u16 attrno, HeapID heap_id) {
+    GF_ASSERT(attrno == ITEMATTR_HOLD_EFFECT && itemId < EVO_MAX_ITEMS);
+    return sData->holdEffects[itemId];
+}
+
+// sNarcFileList names every archive a/X/Y/Z after its NarcId
+void FS_InitFile(FSFile *p_file) {
+    MI_CpuFill8(p_file, 0, sizeof(FSFile));
+}
+
+BOOL FS_OpenFile(FSFile *p_file, const char *path) {
+    u32 narcId;
+
+    GF_ASSERT(path[0] == 'a' && path[1] == '/' && path[3] == '/' && path[5] == '/' && path[7] == '\0');
+    narcId = (path[2] - '0') * 100 + (path[4] - '0') * 10 + (path[6] - '0');
+    GF_ASSERT(narcId == NARC_poketool_personal_evo || narcId == NARC_poketool_personal_personal);
+    p_file->prop.file.own_id = narcId;
+    p_file->prop.file.top = 0;
+    p_file->prop.file.bottom = narcId == NARC_poketool_personal_evo ? sData->evoSize : sData->personalSize;
+    p_file->prop.file.pos = 0;
+    sIo.opens++;
+    return TRUE;
+}
+
+BOOL FS_CloseFile(FSFile *p_file) {
+    p_file->prop.file.own_id = 0;
+    return TRUE;
+}
+
+BOOL FS_SeekFile(FSFile *p_file, s32 offset, FSSeekFileMode origin) {
+    GF_ASSERT(origin == FS_SEEK_SET);
+    GF_ASSERT(offset >= 0 && (u32)offset <= p_file->prop.file.bottom);
+    p_file->prop.file.pos = offset;
+    return TRUE;
+}
+
+int FS_ReadFile(FSFile *p_file, void *dst, s32 len) {
+    const u8 *image = p_file->prop.file.own_id == NARC_poketool_personal_evo ? sData->evo : sData->personal;
+
+    GF_ASSERT(len >= 0 && p_file->prop.file.pos + len <= p_file->prop.file.bottom);
+    __builtin_memcpy(dst, image + p_file->prop.file.pos, len);
+    p_file->prop.file.pos += len;
+    sIo.reads++;
+    if (p_file->prop.file.own_id == NARC_poketool_personal_evo) {
+        sIo.evoReads++;
+    }
+    sIo.bytesRead += len;
+    return len;
+}
+
+void MI_CpuCopy8(const void *src, void *dest, u32 size) {
+    __builtin_memcpy(dest, src, size);
+}
+
+void MI_CpuFill8(void *dest, u8 data, u32 size) {
+    __builtin_memset(dest, data, size);
+}
+
+void MIi_CpuClearFast(u32 value, u32 *dst, u32 size) {
+    u32 i;
+
+    for (i = 0; i < size / 4; i++) {
+        dst[i] = value;
+    }
+}
+
+// Get/SetMonData reach these for fields evosim never asks about
+void CopyCapsule(const CAPSULE *src, CAPSULE *dest) {
+    GF_ASSERT(FALSE);
+}
+
+void CopyStringToU16Array(const STRING *string, u16 *dest, u32 n) {
+    GF_ASSERT(FALSE);
+}
+
+void CopyU16ArrayToString(STRING *string, const u16 *src) {
+    GF_ASSERT(FALSE);
+}
+
+u8 GetMoveMaxPP(u16 moveId, u8 ppUps) {
+    GF_ASSERT(FALSE);
+    return 0;
+}
+
+STRING *GetSpeciesName(u16 species, HeapID heap_id) {
+    GF_ASSERT(FALSE);
+    return NULL;
+}
+
+void GetSpeciesNameIntoArray(u16 species, HeapID heap_id, u16 *dest) {
+    GF_ASSERT(FALSE);
+}
+
+BOOL LocationIsDiamondPearlCompatible(mapsec_t mapsec) {
+    GF_ASSERT(FALSE);
+    return FALSE;
+}
+
+void Mail_Copy(const MAIL *src, MAIL *dest) {
+    GF_ASSERT(FALSE);
+}
+
+BOOL StringNotEqual(const u16 *a, const u16 *b) {
+    GF_ASSERT(FALSE);
+    return FALSE;
+}
+
+void String_Copy(STRING *dest, const STRING *src) {
+    GF_ASSERT(FALSE);
+}
+
+void String_Delete(STRING *string) {
+    GF_ASSERT(FALSE);
+}
@@ -0,0 +1,952 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stdnoreturn.h>
+#include <stdarg.h>
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
+#include "evosim.h"
+
+// Where the tables are read from, relative to the repository root
+#define EVO_JSON_PATH       "files/poketool/personal/evo.json"
+#define PERSONAL_NARC_PATH  "files/poketool/personal/personal.narc"
+#define ITEM_DATA_PATH      "files/itemtool/itemdata/item_data.csv"
+static const char * const kDefinePaths[] = {
+    "include/constants/species.h",
+    "include/constants/items.h",
+    "include/constants/moves.h",
+};
+
+#define MAX_SPECIES         1024
+#define MAX_DEFINES         8192
+#define MAX_NAME            64
+#define MAX_EVOS_PER_POKE   7
+#define EVO_FILE_SIZE       (MAX_EVOS_PER_POKE * 6 + 2)     // sizeof(EVOLUTION_FILE)
+#define MAX_VALUES          32
+
+#define DEFAULT_CHECKS      200000
+
+// EvoMethod and EvolveContext in constants/pokemon.h
+enum
+{
+    EVO_NONE,
+    EVO_FRIENDSHIP,
+    EVO_FRIENDSHIP_DAY,
+    EVO_FRIENDSHIP_NIGHT,
+    EVO_LEVEL,
+    EVO_TRADE,
+    EVO_TRADE_ITEM,
+    EVO_STONE,
+    EVO_LEVEL_ATK_GT_DEF,
+    EVO_LEVEL_ATK_EQ_DEF,
+    EVO_LEVEL_ATK_LT_DEF,
+    EVO_LEVEL_PID_LO,
+    EVO_LEVEL_PID_HI,
+    EVO_LEVEL_NINJASK,
+    EVO_LEVEL_SHEDINJA,
+    EVO_BEAUTY,
+    EVO_STONE_MALE,
+    EVO_STONE_FEMALE,
+    EVO_ITEM_DAY,
+    EVO_ITEM_NIGHT,
+    EVO_HAS_MOVE,
+    EVO_OTHER_PARTY_MON,
+    EVO_LEVEL_MALE,
+    EVO_LEVEL_FEMALE,
+    EVO_CORONET,
+    EVO_ETERNA,
+    EVO_ROUTE217,
+    EVO_METHOD_COUNT,
+};
+
+enum
+{
+    EVOCTX_LEVELUP,
+    EVOCTX_TRADE,
+    EVOCTX_ITEM_CHECK,
+    EVOCTX_ITEM_USE,
+    EVOCTX_COUNT,
+};
+
+static const char * const kMethodNames[EVO_METHOD_COUNT] = {
+    "EVO_NONE", "EVO_FRIENDSHIP", "EVO_FRIENDSHIP_DAY", "EVO_FRIENDSHIP_NIGHT", "EVO_LEVEL", "EVO_TRADE",
+    "EVO_TRADE_ITEM", "EVO_STONE", "EVO_LEVEL_ATK_GT_DEF", "EVO_LEVEL_ATK_EQ_DEF", "EVO_LEVEL_ATK_LT_DEF",
+    "EVO_LEVEL_PID_LO", "EVO_LEVEL_PID_HI", "EVO_LEVEL_NINJASK", "EVO_LEVEL_SHEDINJA", "EVO_BEAUTY",
+    "EVO_STONE_MALE", "EVO_STONE_FEMALE", "EVO_ITEM_DAY", "EVO_ITEM_NIGHT", "EVO_HAS_MOVE",
+    "EVO_OTHER_PARTY_MON", "EVO_LEVEL_MALE", "EVO_LEVEL_FEMALE", "EVO_CORONET", "EVO_ETERNA", "EVO_ROUTE217",
+};
+
+static const char * const kContextNames[EVOCTX_COUNT] = { "level-up", "trade", "item check", "item use" };
+
+typedef struct Define
+{
+    char name[MAX_NAME];
+    int value;
+} Define;
+
+typedef struct Evolution
+{
+    int method;
+    int param;
+    int target;
+} Evolution;
+
+typedef struct Species
+{
+    int numEvos;
+    Evolution evos[MAX_EVOS_PER_POKE];
+} Species;
+
+// The distinct values a sweep tries for one field of the mon or the world
+typedef struct Values
+{
+    int count;
+    int values[MAX_VALUES];
+} Values;
+
+typedef struct Variant
+{
+    const char * name;
+    void (*open)(void);
+    void (*close)(void);
+    int (*getEvolution)(const EvoMon * mon, int context, uint16_t usedItem, int withParty, int * method, uint8_t * monAfter);
+} Variant;
+
+static const Variant kVariants[] = {
+    { "NARC", EvoBase_Open, EvoBase_Close, EvoBase_GetEvolution },
+    { "index", EvoIndex_Open, EvoIndex_Close, EvoIndex_GetEvolution },
+};
+
+static int sNumDefines;
+static Define sDefines[MAX_DEFINES];
+static int sNumSpecies;
+static Species sSpecies[MAX_SPECIES];
+static uint8_t sHoldEffects[EVO_MAX_ITEMS];
+static EvoData sData;
+
+static inline noreturn __attribute__((format(printf, 1, 2))) void fatal_error(const char * message, ...)
+{
+    va_list va_args;
+    va_start(va_args, message);
+    fputs("Error: ", stderr);
+    vfprintf(stderr, message, va_args);
+    fputc('\n', stderr);
+    va_end(va_args);
+    exit(EXIT_FAILURE);
+}
+
+// GF_ASSERT in the game objects, which are built with PM_KEEP_ASSERTS
+void GF_AssertFail(void)
+{
+    fatal_error("GF_ASSERT failed in the game code");
+}
+
+static uint32_t ParseU32(const char * arg)
+{
+    char * end;
+    unsigned long long val = strtoull(arg, &end, 0);
+    if (*arg == '\0' || *end != '\0' || val > 0xFFFFFFFFull)
+    {
+        fatal_error("invalid number: %s", arg);
+    }
+    return (uint32_t)val;
+}
+
+static double Now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static uint32_t Random(uint32_t * state)
+{
+    uint32_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return *state = x;
+}
+
+// ---------------------------------------------------------------------------
+// Game data
+
+static void * ReadWholeFile(const char * root, const char * relPath, size_t * size)
+{
+    char path[4096];
+    snprintf(path, sizeof(path), "%s/%s", root, relPath);
+    FILE * file = fopen(path, "rb");
+    if (file == NULL)
+    {
+        fatal_error("%s: %s", path, strerror(errno));
+    }
+    fseek(file, 0, SEEK_END);
+    long length = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    uint8_t * buffer = malloc(length + 1);
+    if (buffer == NULL)
+    {
+        fatal_error("out of memory reading %s", path);
+    }
+    if (fread(buffer, 1, length, file) != (size_t)length)
+    {
+        fatal_error("%s: short read", path);
+    }
+    fclose(file);
+    buffer[length] = '\0';
+    *size = length;
+    return buffer;
+}
+
+static const char * FindRoot(void)
+{
+    static const char * const candidates[] = { ".", "..", "../.." };
+    for (size_t i = 0; i < sizeof(candidates) / sizeof(candidates[0]); i++)
+    {
+        char path[4096];
+        snprintf(path, sizeof(path), "%s/%s", candidates[i], EVO_JSON_PATH);
+        if (access(path, R_OK) == 0)
+        {
+            return candidates[i];
+        }
+    }
+    return NULL;
+}
+
+static int CompareDefines(const void * a, const void * b)
+{
+    return strcmp(((const Define *)a)->name, ((const Define *)b)->name);
+}
+
+// Every "#define NAME NUMBER" in the constants headers, where NUMBER may be
+// in parentheses
+static void LoadDefines(const char * root)
+{
+    for (size_t f = 0; f < sizeof(kDefinePaths) / sizeof(kDefinePaths[0]); f++)
+    {
+        size_t size;
+        char * text = ReadWholeFile(root, kDefinePaths[f], &size);
+        for (char * line = text; line != NULL && *line != '\0';)
+        {
+            char * next = strchr(line, '\n');
+            char name[MAX_NAME];
+            char value[MAX_NAME];
+            if (sscanf(line, "#define %63s %63[(0-9a-fA-FxX)]", name, value) == 2)
+            {
+                char * digits = value;
+                char * end;
+                while (*digits == '(')
+                {
+                    digits++;
+                }
+                long val = strtol(digits, &end, 0);
+                while (*end == ')')
+                {
+                    end++;
+                }
+                if (end != digits && *end == '\0')
+                {
+                    if (sNumDefines >= MAX_DEFINES)
+                    {
+                        fatal_error("more than %d constants", MAX_DEFINES);
+                    }
+                    strcpy(sDefines[sNumDefines].name, name);
+                    sDefines[sNumDefines].value = (int)val;
+                    sNumDefines++;
+                }
+            }
+            line = next != NULL ? next + 1 : NULL;
+        }
+        free(text);
+    }
+    qsort(sDefines, sNumDefines, sizeof(Define), CompareDefines);
+}
+
+static int LookUp(const char * name)
+{
+    Define key;
+    if (strlen(name) >= MAX_NAME)
+    {
+        fatal_error("unknown constant %s", name);
+    }
+    strcpy(key.name, name);
+    const Define * found = bsearch(&key, sDefines, sNumDefines, sizeof(Define), CompareDefines);
+    if (found == NULL)
+    {
+        fatal_error("unknown constant %s", name);
+    }
+    return found->value;
+}
+
+static int LookUpMethod(const char * name)
+{
+    for (int i = 0; i < EVO_METHOD_COUNT; i++)
+    {
+        if (strcmp(name, kMethodNames[i]) == 0)
+        {
+            return i;
+        }
+    }
+    fatal_error("unknown evolution method %s", name);
+}
+
+// A value that is a constant or a number, either of them maybe quoted
+static int ParseValue(const char * text)
+{
+    char name[MAX_NAME];
+    int value;
+    if (sscanf(text, " \"%d\"", &value) == 1)
+    {
+        return value;
+    }
+    if (sscanf(text, " \"%63[A-Z0-9_]\"", name) == 1)
+    {
+        return LookUp(name);
+    }
+    if (sscanf(text, " %d", &value) == 1)
+    {
+        return value;
+    }
+    fatal_error("%s: cannot parse %.20s", EVO_JSON_PATH, text);
+}
+
+// The text after "key": on this line
+static const char * FindKey(const char * text, const char * key)
+{
+    char quoted[MAX_NAME];
+    snprintf(quoted, sizeof(quoted), "\"%s\":", key);
+    const char * found = strstr(text, quoted);
+    if (found == NULL)
+    {
+        fatal_error("%s: no %s in %.40s", EVO_JSON_PATH, key, text);
+    }
+    return found + strlen(quoted);
+}
+
+// evo.json as jsonproc sees it: a species per line, or for a species with
+// more than one evolution, its evolutions on the lines after it. evo.json.txt
+// turns each species into a designated initializer, so a species listed
+// twice ends up with only its last entry's evolutions.
+static void LoadEvolutions(const char * root)
+{
+    size_t size;
+    char * text = ReadWholeFile(root, EVO_JSON_PATH, &size);
+    Species * entry = NULL;
+    for (char * line = text; line != NULL && *line != '\0';)
+    {
+        char * next = strchr(line, '\n');
+        if (next != NULL)
+        {
+            *next = '\0';
+        }
+        if (strstr(line, "\"baseSpecies\":") != NULL)
+        {
+            int species = ParseValue(FindKey(line, "baseSpecies"));
+            if (species < 0 || species >= sNumSpecies)
+            {
+                fatal_error("%s: species %d out of range", EVO_JSON_PATH, species);
+            }
+            entry = &sSpecies[species];
+            memset(entry, 0, sizeof(Species));
+        }
+        for (const char * evo = strstr(line, "\"method\":"); evo != NULL; evo = strstr(evo + 1, "\"method\":"))
+        {
+            char name[MAX_NAME];
+            if (entry == NULL || entry->numEvos >= MAX_EVOS_PER_POKE || sscanf(FindKey(evo, "method"), " \"%63[A-Z0-9_]\"", name) != 1)
+            {
+                fatal_error("%s: cannot parse %.40s", EVO_JSON_PATH, evo);
+            }
+            Evolution * e = &entry->evos[entry->numEvos++];
+            e->method = LookUpMethod(name);
+            e->param = ParseValue(FindKey(evo, "param"));
+            e->target = ParseValue(FindKey(evo, "target"));
+        }
+        line = next != NULL ? next + 1 : NULL;
+    }
+    free(text);
+}
+
+// item_data.csv: the item in the first column, its hold effect in the third
+static void LoadHoldEffects(const char * root)
+{
+    size_t size;
+    char * text = ReadWholeFile(root, ITEM_DATA_PATH, &size);
+    char * line = strchr(text, '\n');
+    while (line != NULL && *++line != '\0')
+    {
+        char item[MAX_NAME];
+        char holdEffect[MAX_NAME];
+        if (sscanf(line, "%63[A-Z0-9_],%*[^,],%63[A-Z0-9_],", item, holdEffect) != 2)
+        {
+            fatal_error("%s: cannot parse %.40s", ITEM_DATA_PATH, line);
+        }
+        int id = LookUp(item);
+        if (id < 0 || id >= EVO_MAX_ITEMS)
+        {
+            fatal_error("%s: item %d out of range", ITEM_DATA_PATH, id);
+        }
+        sHoldEffects[id] = LookUp(holdEffect);
+        line = strchr(line, '\n');
+    }
+    free(text);
+}
+
+// ---------------------------------------------------------------------------
+// Archives
+
+typedef struct Buffer
+{
+    uint8_t * data;
+    uint32_t size;
+    uint32_t capacity;
+} Buffer;
+
+static void Put(Buffer * buf, const void * data, uint32_t size)
+{
+    if (buf->size + size > buf->capacity)
+    {
+        buf->capacity = (buf->size + size) * 2;
+        buf->data = realloc(buf->data, buf->capacity);
+        if (buf->data == NULL)
+        {
+            fatal_error("out of memory");
+        }
+    }
+    memcpy(buf->data + buf->size, data, size);
+    buf->size += size;
+}
+
+static void Put16(Buffer * buf, uint32_t value)
+{
+    uint8_t bytes[2] = { value, value >> 8 };
+    Put(buf, bytes, 2);
+}
+
+static void Put32(Buffer * buf, uint32_t value)
+{
+    uint8_t bytes[4] = { value, value >> 8, value >> 16, value >> 24 };
+    Put(buf, bytes, 4);
+}
+
+// As evo.json.txt lays out EVOLUTION_FILE: the evolutions, then EVO_NONE up
+// to MAX_EVOS_PER_POKE, then the padding
+static void PutEvolutions(Buffer * buf, const Species * species)
+{
+    for (int i = 0; i < MAX_EVOS_PER_POKE; i++)
+    {
+        const Evolution * evo = &species->evos[i];
+        Put16(buf, i < species->numEvos ? evo->method : 0);
+        Put16(buf, i < species->numEvos ? evo->param : 0);
+        Put16(buf, i < species->numEvos ? evo->target : 0);
+    }
+    Put16(buf, 0);
+}
+
+// A NARC as o2narc writes it: members padded to words with 0, no names
+static void BuildEvoNarc(void)
+{
+    Buffer narc = { 0 };
+    uint32_t btafSize = 12 + 8 * sNumSpecies;
+    uint32_t btnfSize = 16;
+    uint32_t gmifSize = 8 + EVO_FILE_SIZE * sNumSpecies;
+
+    Put(&narc, "NARC", 4);
+    Put16(&narc, 0xFFFE);
+    Put16(&narc, 0x0100);
+    Put32(&narc, 16 + btafSize + btnfSize + gmifSize);
+    Put16(&narc, 16);
+    Put16(&narc, 3);
+    Put(&narc, "BTAF", 4);
+    Put32(&narc, btafSize);
+    Put16(&narc, sNumSpecies);
+    Put16(&narc, 0);
+    for (int i = 0; i < sNumSpecies; i++)
+    {
+        Put32(&narc, EVO_FILE_SIZE * i);
+        Put32(&narc, EVO_FILE_SIZE * (i + 1));
+    }
+    Put(&narc, "BTNF", 4);
+    Put32(&narc, btnfSize);
+    Put32(&narc, 4);
+    Put16(&narc, 0);
+    Put16(&narc, 1);
+    Put(&narc, "GMIF", 4);
+    Put32(&narc, gmifSize);
+    for (int i = 0; i < sNumSpecies; i++)
+    {
+        PutEvolutions(&narc, &sSpecies[i]);
+    }
+    sData.evo = narc.data;
+    sData.evoSize = narc.size;
+}
+
+// The evo NARC has a member for every species the personal NARC has
+static void LoadGameData(const char * root)
+{
+    size_t size;
+
+    LoadDefines(root);
+    sData.personal = ReadWholeFile(root, PERSONAL_NARC_PATH, &size);
+    sData.personalSize = size;
+    if (size < 0x1C || memcmp(sData.personal, "NARC", 4) != 0 || memcmp(sData.personal + 0x10, "BTAF", 4) != 0)
+    {
+        fatal_error("%s: not a NARC", PERSONAL_NARC_PATH);
+    }
+    sNumSpecies = sData.personal[0x18] | sData.personal[0x19] << 8;
+    if (sNumSpecies > MAX_SPECIES)
+    {
+        fatal_error("%s: more than %d species", PERSONAL_NARC_PATH, MAX_SPECIES);
+    }
+    LoadEvolutions(root);
+    LoadHoldEffects(root);
+    BuildEvoNarc();
+    sData.holdEffects = sHoldEffects;
+    Evo_SetData(&sData);
+}
+
+// ---------------------------------------------------------------------------
+// Sweep
+
+static void AddValue(Values * values, int value)
+{
+    for (int i = 0; i < values->count; i++)
+    {
+        if (values->values[i] == value)
+        {
+            return;
+        }
+    }
+    if (values->count >= MAX_VALUES)
+    {
+        fatal_error("more than %d values to sweep", MAX_VALUES);
+    }
+    values->values[values->count++] = value;
+}
+
+static void AddAround(Values * values, int value, int min, int max)
+{
+    for (int v = value - 1; v <= value + 1; v++)
+    {
+        if (v >= min && v <= max)
+        {
+            AddValue(values, v);
+        }
+    }
+}
+
+// Each method's conditions, either side of each boundary in the species'
+// table: levels and beauty around the threshold, the items and moves the
+// table names and none, the party with and without the species it names.
+// GetMonEvolution compares usedItem with the method for EVO_CORONET and
+// friends, so the method is tried as an item too.
+typedef struct Sweep
+{
+    Values levels;
+    Values beauties;
+    Values heldItems;
+    Values usedItems;
+    Values moves;
+    Values partySpecies;
+    Values formes;
+} Sweep;
+
+static void BuildSweep(int species, Sweep * sweep)
+{
+    const Species * entry = &sSpecies[species];
+
+    memset(sweep, 0, sizeof(Sweep));
+    AddValue(&sweep->levels, 1);
+    AddValue(&sweep->levels, 100);
+    AddValue(&sweep->beauties, 0);
+    AddValue(&sweep->beauties, 255);
+    AddValue(&sweep->heldItems, 0);
+    AddValue(&sweep->heldItems, LookUp("ITEM_EVERSTONE"));
+    AddValue(&sweep->usedItems, 0);
+    AddValue(&sweep->moves, 0);
+    AddValue(&sweep->partySpecies, 0);
+    AddValue(&sweep->formes, 0);
+    if (species == LookUp("SPECIES_PICHU"))
+    {
+        AddValue(&sweep->formes, 1);
+    }
+    for (int i = 0; i < entry->numEvos; i++)
+    {
+        const Evolution * evo = &entry->evos[i];
+        switch (evo->method)
+        {
+        case EVO_BEAUTY:
+            AddAround(&sweep->beauties, evo->param, 0, 255);
+            break;
+        case EVO_TRADE_ITEM:
+        case EVO_ITEM_DAY:
+        case EVO_ITEM_NIGHT:
+            AddValue(&sweep->heldItems, evo->param);
+            break;
+        case EVO_STONE:
+        case EVO_STONE_MALE:
+        case EVO_STONE_FEMALE:
+            AddValue(&sweep->usedItems, evo->param);
+            break;
+        case EVO_HAS_MOVE:
+            AddValue(&sweep->moves, evo->param);
+            break;
+        case EVO_OTHER_PARTY_MON:
+            AddValue(&sweep->partySpecies, evo->param);
+            break;
+        case EVO_CORONET:
+        case EVO_ETERNA:
+        case EVO_ROUTE217:
+            AddValue(&sweep->usedItems, evo->method);
+            AddValue(&sweep->usedItems, evo->param);
+            break;
+        default:
+            if (evo->param >= 1 && evo->param <= 100)
+            {
+                AddAround(&sweep->levels, evo->param, 1, 100);
+            }
+            break;
+        }
+    }
+}
+
+// PID high halves either side of pid_hi % 10 < 5, each with the low byte at
+// both ends, which puts the mon at either end of its species' gender ratio
+static const uint32_t kPersonalities[] = { 0x00000000, 0x000000FF, 0x00050000, 0x000500FF };
+static const uint16_t kAtkDef[][2] = { { 20, 10 }, { 15, 15 }, { 10, 20 } };
+static const uint8_t kFriendships[] = { 219, 220 };
+
+typedef struct SweepResult
+{
+    uint32_t checks;
+    uint32_t evolutions;
+    uint32_t mismatches;
+    uint32_t methodsSeen[EVO_METHOD_COUNT];
+} SweepResult;
+
+static int sReported;
+
+// Both variants are asked the same question; the answer, the method and the
+// mon's bytes afterwards must all be the same
+static void CompareOne(const EvoMon * mon, int context, int usedItem, int withParty, SweepResult * result)
+{
+    static uint8_t base[EVO_MON_SIZE], index[EVO_MON_SIZE];
+    int baseMethod = -1, indexMethod = -1;
+
+    int baseTarget = EvoBase_GetEvolution(mon, context, usedItem, withParty, &baseMethod, base);
+    int indexTarget = EvoIndex_GetEvolution(mon, context, usedItem, withParty, &indexMethod, index);
+    bool same = baseTarget == indexTarget && baseMethod == indexMethod && memcmp(base, index, EVO_MON_SIZE) == 0;
+    result->checks++;
+    if (baseTarget != 0)
+    {
+        // The item contexts report method 0; the table says which stone it was
+        const Species * entry = &sSpecies[mon->species];
+        for (int i = 0; baseMethod == 0 && i < entry->numEvos; i++)
+        {
+            if (entry->evos[i].target == baseTarget && entry->evos[i].param == usedItem)
+            {
+                baseMethod = entry->evos[i].method;
+            }
+        }
+        result->evolutions++;
+        if (baseMethod >= 0 && baseMethod < EVO_METHOD_COUNT)
+        {
+            result->methodsSeen[baseMethod]++;
+        }
+    }
+    if (!same)
+    {
+        result->mismatches++;
+        if (sReported++ < 5)
+        {
+            printf("  species %u, %s, level %u, item %u, used %u: %d/%d from the NARC, %d/%d from the index%s\n",
+                mon->species, kContextNames[context], mon->level, mon->heldItem, usedItem,
+                baseTarget, baseMethod, indexTarget, indexMethod,
+                memcmp(base, index, EVO_MON_SIZE) != 0 ? ", mon differs" : "");
+        }
+    }
+}
+
+static void SweepSpecies(int species, SweepResult * result)
+{
+    Sweep sweep;
+    EvoMon mon;
+    EvoWorld world;
+
+    BuildSweep(species, &sweep);
+    memset(&mon, 0, sizeof(mon));
+    mon.species = species;
+    for (int night = 0; night < 2; night++)
+    for (int party = 0; party <= sweep.partySpecies.count; party++)
+    {
+        // party 0 is no party at all, the rest a party of that one species
+        memset(&world, 0, sizeof(world));
+        world.nighttime = night;
+        if (party > 0 && sweep.partySpecies.values[party - 1] != 0)
+        {
+            world.numPartySpecies = 1;
+            world.partySpecies[0] = sweep.partySpecies.values[party - 1];
+        }
+        Evo_SetWorld(&world);
+        for (size_t p = 0; p < sizeof(kPersonalities) / sizeof(kPersonalities[0]); p++)
+        for (size_t s = 0; s < sizeof(kAtkDef) / sizeof(kAtkDef[0]); s++)
+        for (size_t f = 0; f < sizeof(kFriendships); f++)
+        for (int l = 0; l < sweep.levels.count; l++)
+        for (int b = 0; b < sweep.beauties.count; b++)
+        for (int h = 0; h < sweep.heldItems.count; h++)
+        for (int m = 0; m < sweep.moves.count; m++)
+        for (int fo = 0; fo < sweep.formes.count; fo++)
+        {
+            mon.personality = kPersonalities[p];
+            mon.atk = kAtkDef[s][0];
+            mon.def = kAtkDef[s][1];
+            mon.friendship = kFriendships[f];
+            mon.level = sweep.levels.values[l];
+            mon.beauty = sweep.beauties.values[b];
+            mon.heldItem = sweep.heldItems.values[h];
+            mon.moves[0] = sweep.moves.values[m];
+            mon.forme = sweep.formes.values[fo];
+            for (int context = 0; context < EVOCTX_COUNT; context++)
+            {
+                bool itemContext = context == EVOCTX_ITEM_CHECK || context == EVOCTX_ITEM_USE;
+                for (int u = 0; u < (itemContext || context == EVOCTX_LEVELUP ? sweep.usedItems.count : 1); u++)
+                {
+                    CompareOne(&mon, context, sweep.usedItems.values[u], party > 0, result);
+                }
+            }
+        }
+    }
+}
+
+static void RunSweep(SweepResult * result)
+{
+    memset(result, 0, sizeof(SweepResult));
+    for (int species = 0; species < sNumSpecies; species++)
+    {
+        SweepSpecies(species, result);
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Self-test
+
+// One level-up check of every species through one variant, for counting
+// what a variant reads on its own
+static void AskEverySpecies(const Variant * variant)
+{
+    uint8_t after[EVO_MON_SIZE];
+    EvoWorld world = { 0 };
+
+    Evo_SetWorld(&world);
+    for (int species = 0; species < sNumSpecies; species++)
+    {
+        EvoMon mon = { .species = species, .level = 100, .friendship = 255 };
+        int method;
+        variant->getEvolution(&mon, EVOCTX_LEVELUP, 0, false, &method, after);
+    }
+}
+
+static int CheckSweep(void)
+{
+    SweepResult result;
+    EvoIo io;
+    int failed = 0;
+
+    Evo_ResetIo();
+    EvoBase_Open();
+    EvoIndex_Open();
+    Evo_GetIo(&io);
+    printf("index: %u block%s, %u bytes, %u evo NARC reads to build\n",
+        io.liveBlocks, io.liveBlocks == 1 ? "" : "s", io.liveBytes, io.evoReads);
+    failed += io.liveBlocks != 1;
+
+    double start = Now();
+    RunSweep(&result);
+    double seconds = Now() - start;
+    // EVO_LEVEL_SHEDINJA only reports itself; Shedinja is made elsewhere
+    int unseen = 0;
+    for (int method = EVO_FRIENDSHIP; method < EVO_METHOD_COUNT; method++)
+    {
+        unseen += method != EVO_LEVEL_SHEDINJA && result.methodsSeen[method] == 0;
+    }
+    printf("sweep: %u checks on %d species, %u evolve, %d methods never taken, %s (%.1fs)\n",
+        result.checks, sNumSpecies, result.evolutions, unseen, result.mismatches ? "MISMATCH" : "same", seconds);
+    failed += result.mismatches != 0 || unseen != 0;
+
+    // Once built, the index is all a check reads
+    Evo_ResetIo();
+    AskEverySpecies(&kVariants[1]);
+    Evo_GetIo(&io);
+    printf("index: %u evo NARC reads for %d checks\n", io.evoReads, sNumSpecies);
+    failed += io.evoReads != 0;
+
+    EvoIndex_Close();
+    EvoBase_Close();
+    Evo_GetIo(&io);
+    printf("heap %s after the field closed\n", io.liveBlocks == 0 ? "empty" : "NOT EMPTY");
+    failed += io.liveBlocks != 0;
+    return failed;
+}
+
+// Without a field system the index is not there: checks read the NARC as
+// they always did, and still give the same answers
+static int CheckOutsideField(void)
+{
+    SweepResult result = { 0 };
+    EvoIo base, index;
+
+    Evo_ResetIo();
+    AskEverySpecies(&kVariants[0]);
+    Evo_GetIo(&base);
+    Evo_ResetIo();
+    AskEverySpecies(&kVariants[1]);
+    Evo_GetIo(&index);
+    for (int species = 0; species < sNumSpecies && result.checks < 20000; species++)
+    {
+        SweepSpecies(species, &result);
+    }
+
+    bool same = base.evoReads == index.evoReads && index.liveBlocks == 0 && result.mismatches == 0;
+    printf("outside the field: %u evo NARC reads from the NARC build, %u from the index build, %u checks %s\n",
+        base.evoReads, index.evoReads, result.checks, same ? "same" : "DIFFERENT");
+    return !same;
+}
+
+static int CommandSelfTest(void)
+{
+    int failed = 0;
+
+    failed += CheckSweep();
+    failed += CheckOutsideField();
+    printf("%d checks failed\n", failed);
+    return failed == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+// ---------------------------------------------------------------------------
+// Bench
+
+// Random mons of species that evolve, level-up checks as after a battle
+static int CommandBench(uint32_t checks, uint32_t seed)
+{
+    uint8_t after[EVO_MON_SIZE];
+    EvoWorld world = { 0 };
+    int candidates[MAX_SPECIES];
+    int numCandidates = 0;
+
+    for (int species = 0; species < sNumSpecies; species++)
+    {
+        if (sSpecies[species].numEvos != 0)
+        {
+            candidates[numCandidates++] = species;
+        }
+    }
+    Evo_SetWorld(&world);
+    for (size_t v = 0; v < sizeof(kVariants) / sizeof(kVariants[0]); v++)
+    {
+        const Variant * variant = &kVariants[v];
+        uint32_t state = seed;
+        uint32_t evolutions = 0;
+        EvoIo io;
+
+        variant->open();
+        Evo_ResetIo();
+        double start = Now();
+        for (uint32_t i = 0; i < checks; i++)
+        {
+            EvoMon mon = { 0 };
+            int method;
+            mon.species = candidates[Random(&state) % numCandidates];
+            mon.personality = Random(&state);
+            mon.level = Random(&state) % 100 + 1;
+            mon.friendship = Random(&state);
+            mon.atk = Random(&state) % 200 + 1;
+            mon.def = Random(&state) % 200 + 1;
+            evolutions += variant->getEvolution(&mon, EVOCTX_LEVELUP, 0, true, &method, after) != 0;
+        }
+        double seconds = Now() - start;
+        Evo_GetIo(&io);
+        variant->close();
+        printf("%-6s %u checks, %u evolve: %u opens, %u reads, %u bytes, %u allocations, %.0f ns/check\n",
+            variant->name, checks, evolutions, io.opens, io.reads, io.bytesRead, io.allocs, seconds * 1e9 / checks);
+    }
+    return EXIT_SUCCESS;
+}
+
+// ---------------------------------------------------------------------------
+
+static noreturn void Usage(const char * prog)
+{
+    fprintf(stderr,
+        "Usage: %s COMMAND [options]\n"
+        "Runs GetMonEvolution from src/pokemon.c on the host, with and without\n"
+        "OPTIMIZE_EVOLUTION_INDEX, over an evo archive built from evo.json and\n"
+        "the personal archive in the tree.\n"
+        "Commands:\n"
+        "  selftest              check that both builds give the same species,\n"
+        "                        method and mon for every species, context and\n"
+        "                        condition either side of every threshold, that\n"
+        "                        the index reads nothing once built and that it\n"
+        "                        is one block, freed with the field\n"
+        "  bench                 level-up checks on random mons, and what each\n"
+        "                        build reads and allocates for them\n"
+        "Options:\n"
+        "  --checks N            bench checks per build (default %d)\n"
+        "  --seed N              bench seed\n",
+        prog, DEFAULT_CHECKS);
+    exit(EXIT_FAILURE);
+}
+
+int main(int argc, char ** argv)
+{
+    if (argc < 2)
+    {
+        Usage(argv[0]);
+    }
+    const char * command = argv[1];
+    uint32_t checks = DEFAULT_CHECKS;
+    uint32_t seed = 1;
+
+    for (int i = 2; i < argc; i++)
+    {
+        const char * opt = argv[i];
+        if (i + 1 >= argc)
+        {
+            Usage(argv[0]);
+        }
+        if (strcmp(opt, "--checks") == 0)
+        {
+            checks = ParseU32(argv[++i]);
+        }
+        else if (strcmp(opt, "--seed") == 0)
+        {
+            seed = ParseU32(argv[++i]);
+        }
+        else
+        {
+            Usage(argv[0]);
+        }
+    }
+    if (checks == 0 || seed == 0)
+    {
+        Usage(argv[0]);
+    }
+
+    const char * root = FindRoot();
+    if (root == NULL)
+    {
+        fatal_error("run evosim from the repository or tools/evosim");
+    }
+    LoadGameData(root);
+
+    if (strcmp(command, "selftest") == 0)
+    {
+        return CommandSelfTest();
+    }
+    if (strcmp(command, "bench") == 0)
+    {
+        return CommandBench(checks, seed);
+    }
+    Usage(argv[0]);
+}
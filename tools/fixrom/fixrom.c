@@ -5,10 +5,23 @@
 #include <string.h>
 #include <stdnoreturn.h>
 #include <stdarg.h>
+#include <ctype.h>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 #define HEADER_SIZE 0x4000
+#define SECURE_AREA_END 0x8000
 
-uint8_t RomHeader[HEADER_SIZE];
+// The whole ROM, mapped read-write where possible, else read into memory
+// and written back. RomHeader points at its start.
+uint8_t * RomImage;
+size_t RomSize;
+uint8_t * RomHeader;
 
 static inline noreturn __attribute__((format(printf, 1, 2))) void fatal_error(const char * message, ...)
 {
@@ -60,59 +73,372 @@ static inline void HeaderWriteU32LE(int offset, uint32_t value)
     RomHeader[offset + 3] = value >> 24;
 }
 
-static uint16_t Calc_CRC16(uint8_t * data, size_t length, uint16_t crc)
-{
-    static uint16_t CrcTable[16] = {
-        0x0000,
-        0xCC01,
-        0xD801,
-        0x1400,
-        0xF001,
-        0x3C00,
-        0x2800,
-        0xE401,
-        0xA001,
-        0x6C00,
-        0x7800,
-        0xB401,
-        0x5000,
-        0x9C01,
-        0x8801,
-        0x4400,
-    };
-
-    uint16_t x = 0;
-    uint16_t y;
-    uint16_t bit = 0;
-    uint8_t * end = data + length;
-    while (data < end)
-    {
-        if (bit == 0)
-        {
-            x = data[0] | (data[1] << 8);
-        }
-        y = CrcTable[crc & 15];
-        crc >>= 4;
-        crc ^= y;
-        y = CrcTable[(x >> bit) & 15];
-        crc ^= y;
-        bit += 4;
-        if (bit == 16)
-        {
-            data += 2;
-            bit = 0;
+static uint16_t CrcTable[8][256];
+
+static void InitCrcTable(void)
+{
+    // CRC-16/ARC, reflected polynomial 0xA001. Table k advances a byte that
+    // is followed by k more bytes, so eight bytes fold in per step.
+    for (int i = 0; i < 256; i++)
+    {
+        uint16_t crc = i;
+        for (int j = 0; j < 8; j++)
+        {
+            crc = (crc & 1) ? (crc >> 1) ^ 0xA001 : crc >> 1;
         }
+        CrcTable[0][i] = crc;
+    }
+    for (int i = 0; i < 256; i++)
+    {
+        for (int k = 1; k < 8; k++)
+        {
+            CrcTable[k][i] = (CrcTable[k - 1][i] >> 8) ^ CrcTable[0][CrcTable[k - 1][i] & 0xFF];
+        }
+    }
+}
+
+static uint16_t Calc_CRC16(const uint8_t * data, size_t length, uint16_t crc)
+{
+    while (length >= 8)
+    {
+        crc = CrcTable[7][(data[0] ^ crc) & 0xFF] ^
+              CrcTable[6][data[1] ^ (crc >> 8)] ^
+              CrcTable[5][data[2]] ^
+              CrcTable[4][data[3]] ^
+              CrcTable[3][data[4]] ^
+              CrcTable[2][data[5]] ^
+              CrcTable[1][data[6]] ^
+              CrcTable[0][data[7]];
+        data += 8;
+        length -= 8;
+    }
+    while (length-- != 0)
+    {
+        crc = (crc >> 8) ^ CrcTable[0][(crc ^ *data++) & 0xFF];
     }
     return crc;
 }
 
+typedef struct
+{
+    uint32_t h[5];
+    uint64_t length;
+    uint8_t block[64];
+    size_t used;
+} Sha1Context;
+
+static inline uint32_t Rol32(uint32_t x, int n)
+{
+    return (x << n) | (x >> (32 - n));
+}
+
+static void Sha1Block(uint32_t * h, const uint8_t * block)
+{
+    uint32_t w[80];
+    for (int i = 0; i < 16; i++)
+    {
+        w[i] = (block[4 * i] << 24) | (block[4 * i + 1] << 16) | (block[4 * i + 2] << 8) | block[4 * i + 3];
+    }
+    for (int i = 16; i < 80; i++)
+    {
+        w[i] = Rol32(w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16], 1);
+    }
+    uint32_t a = h[0], b = h[1], c = h[2], d = h[3], e = h[4];
+    for (int i = 0; i < 80; i++)
+    {
+        uint32_t f, k;
+        if (i < 20)
+        {
+            f = (b & c) | (~b & d);
+            k = 0x5A827999;
+        }
+        else if (i < 40)
+        {
+            f = b ^ c ^ d;
+            k = 0x6ED9EBA1;
+        }
+        else if (i < 60)
+        {
+            f = (b & c) | (b & d) | (c & d);
+            k = 0x8F1BBCDC;
+        }
+        else
+        {
+            f = b ^ c ^ d;
+            k = 0xCA62C1D6;
+        }
+        uint32_t t = Rol32(a, 5) + f + e + k + w[i];
+        e = d;
+        d = c;
+        c = Rol32(b, 30);
+        b = a;
+        a = t;
+    }
+    h[0] += a;
+    h[1] += b;
+    h[2] += c;
+    h[3] += d;
+    h[4] += e;
+}
+
+static void Sha1Blocks_Scalar(uint32_t * h, const uint8_t * data, size_t numBlocks)
+{
+    for (; numBlocks != 0; numBlocks--, data += 64)
+    {
+        Sha1Block(h, data);
+    }
+}
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define FIXROM_SHA_NI
+
+#include <immintrin.h>
+
+// Four rounds with the SHA extensions. k is the round group (rounds 4k to
+// 4k+3); the message schedule for later groups is advanced alongside, and
+// the schedule work done in the last groups is simply unused.
+#define SHA1_ROUNDS4(k, ecur, enext, func)                          \
+    do {                                                            \
+        ecur = _mm_sha1nexte_epu32(ecur, msg[(k) % 4]);             \
+        enext = abcd;                                               \
+        msg[((k) + 1) % 4] = _mm_sha1msg2_epu32(msg[((k) + 1) % 4], msg[(k) % 4]); \
+        abcd = _mm_sha1rnds4_epu32(abcd, ecur, func);               \
+        msg[((k) + 3) % 4] = _mm_sha1msg1_epu32(msg[((k) + 3) % 4], msg[(k) % 4]); \
+        msg[((k) + 2) % 4] = _mm_xor_si128(msg[((k) + 2) % 4], msg[(k) % 4]); \
+    } while (0)
+
+__attribute__((target("sha,sse4.1,ssse3"))) static void Sha1Blocks_ShaNi(uint32_t * h, const uint8_t * data, size_t numBlocks)
+{
+    const __m128i mask = _mm_set_epi64x(0x0001020304050607ULL, 0x08090A0B0C0D0E0FULL);
+    __m128i abcd = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)h), 0x1B);
+    __m128i e0 = _mm_set_epi32(h[4], 0, 0, 0);
+    __m128i e1;
+    __m128i msg[4];
+
+    for (; numBlocks != 0; numBlocks--, data += 64)
+    {
+        __m128i abcd_save = abcd;
+        __m128i e0_save = e0;
+
+        for (int i = 0; i < 4; i++)
+        {
+            msg[i] = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + 16 * i)), mask);
+        }
+
+        // The first three groups start the message schedule.
+        e0 = _mm_add_epi32(e0, msg[0]);
+        e1 = abcd;
+        abcd = _mm_sha1rnds4_epu32(abcd, e0, 0);
+        e1 = _mm_sha1nexte_epu32(e1, msg[1]);
+        e0 = abcd;
+        abcd = _mm_sha1rnds4_epu32(abcd, e1, 0);
+        msg[0] = _mm_sha1msg1_epu32(msg[0], msg[1]);
+        e0 = _mm_sha1nexte_epu32(e0, msg[2]);
+        e1 = abcd;
+        abcd = _mm_sha1rnds4_epu32(abcd, e0, 0);
+        msg[1] = _mm_sha1msg1_epu32(msg[1], msg[2]);
+        msg[0] = _mm_xor_si128(msg[0], msg[2]);
+
+        SHA1_ROUNDS4(3, e1, e0, 0);
+        SHA1_ROUNDS4(4, e0, e1, 0);
+        SHA1_ROUNDS4(5, e1, e0, 1);
+        SHA1_ROUNDS4(6, e0, e1, 1);
+        SHA1_ROUNDS4(7, e1, e0, 1);
+        SHA1_ROUNDS4(8, e0, e1, 1);
+        SHA1_ROUNDS4(9, e1, e0, 1);
+        SHA1_ROUNDS4(10, e0, e1, 2);
+        SHA1_ROUNDS4(11, e1, e0, 2);
+        SHA1_ROUNDS4(12, e0, e1, 2);
+        SHA1_ROUNDS4(13, e1, e0, 2);
+        SHA1_ROUNDS4(14, e0, e1, 2);
+        SHA1_ROUNDS4(15, e1, e0, 3);
+        SHA1_ROUNDS4(16, e0, e1, 3);
+        SHA1_ROUNDS4(17, e1, e0, 3);
+        SHA1_ROUNDS4(18, e0, e1, 3);
+        SHA1_ROUNDS4(19, e1, e0, 3);
+
+        e0 = _mm_sha1nexte_epu32(e0, e0_save);
+        abcd = _mm_add_epi32(abcd, abcd_save);
+    }
+
+    _mm_storeu_si128((__m128i *)h, _mm_shuffle_epi32(abcd, 0x1B));
+    h[4] = _mm_extract_epi32(e0, 3);
+}
+
+#undef SHA1_ROUNDS4
+#endif // x86
+
+static void (*Sha1Blocks)(uint32_t * h, const uint8_t * data, size_t numBlocks) = Sha1Blocks_Scalar;
+
+static void Sha1Init(Sha1Context * ctx)
+{
+    static const uint32_t init[5] = { 0x67452301, 0xEFCDAB89, 0x98BADCFE, 0x10325476, 0xC3D2E1F0 };
+    memcpy(ctx->h, init, sizeof(init));
+    ctx->length = 0;
+    ctx->used = 0;
+#ifdef FIXROM_SHA_NI
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("sha") && __builtin_cpu_supports("sse4.1"))
+    {
+        Sha1Blocks = Sha1Blocks_ShaNi;
+    }
+#endif
+}
+
+static void Sha1Update(Sha1Context * ctx, const uint8_t * data, size_t length)
+{
+    ctx->length += length;
+    if (ctx->used != 0)
+    {
+        size_t n = 64 - ctx->used < length ? 64 - ctx->used : length;
+        memcpy(ctx->block + ctx->used, data, n);
+        ctx->used += n;
+        data += n;
+        length -= n;
+        if (ctx->used < 64)
+        {
+            return;
+        }
+        Sha1Blocks(ctx->h, ctx->block, 1);
+        ctx->used = 0;
+    }
+    Sha1Blocks(ctx->h, data, length / 64);
+    data += length & ~(size_t)63;
+    length &= 63;
+    memcpy(ctx->block, data, length);
+    ctx->used = length;
+}
+
+static void Sha1Final(Sha1Context * ctx, uint8_t * digest)
+{
+    uint64_t bits = ctx->length * 8;
+    uint8_t pad[72] = { 0x80 };
+    size_t padlen = (ctx->used < 56 ? 56 : 120) - ctx->used;
+    for (int i = 0; i < 8; i++)
+    {
+        pad[padlen + i] = bits >> (56 - 8 * i);
+    }
+    Sha1Update(ctx, pad, padlen + 8);
+    for (int i = 0; i < 20; i++)
+    {
+        digest[i] = ctx->h[i / 4] >> (24 - 8 * (i % 4));
+    }
+}
+
+static void MapRom(const char * path)
+{
+#ifndef _WIN32
+    int fd = open(path, O_RDWR);
+    struct stat st;
+    if (fd < 0 || fstat(fd, &st) != 0)
+    {
+        fatal_error("unable to open file '%s' for reading", path);
+    }
+    RomSize = st.st_size;
+    if (RomSize < HEADER_SIZE)
+    {
+        fatal_error("error reading the ROM header");
+    }
+    RomImage = mmap(NULL, RomSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (RomImage == MAP_FAILED)
+    {
+        fatal_error("unable to map '%s'", path);
+    }
+#else
+    FILE * rom = fopen(path, "rb");
+    if (rom == NULL)
+    {
+        fatal_error("unable to open file '%s' for reading", path);
+    }
+    fseek(rom, 0, SEEK_END);
+    RomSize = ftell(rom);
+    fseek(rom, 0, SEEK_SET);
+    RomImage = malloc(RomSize);
+    if (RomSize < HEADER_SIZE || RomImage == NULL || fread(RomImage, 1, RomSize, rom) != RomSize)
+    {
+        fatal_error("error reading the ROM header");
+    }
+    fclose(rom);
+#endif
+    RomHeader = RomImage;
+}
+
+static void UnmapRom(const char * path)
+{
+#ifndef _WIN32
+    (void)path;
+    if (munmap(RomImage, RomSize) != 0)
+    {
+        fatal_error("error writing the ROM header");
+    }
+#else
+    FILE * rom = fopen(path, "r+b");
+    if (rom == NULL || fwrite(RomHeader, 1, HEADER_SIZE, rom) != HEADER_SIZE)
+    {
+        fatal_error("error writing the ROM header");
+    }
+    fclose(rom);
+    free(RomImage);
+#endif
+}
+
+// Finds the line for rom_path in a sha1sum-style checksum file and returns
+// its digest, or exits if there is none.
+static void ReadExpectedSha1(const char * sha1_path, const char * rom_path, uint8_t * digest)
+{
+    FILE * file = fopen(sha1_path, "r");
+    char line[1024];
+    if (file == NULL)
+    {
+        fatal_error("unable to open file '%s' for reading", sha1_path);
+    }
+    while (fgets(line, sizeof(line), file) != NULL)
+    {
+        char * name = line + 40;
+        if (strlen(line) < 42 || (name[0] != ' ' && name[0] != '\t'))
+        {
+            continue;
+        }
+        name++;
+        if (*name == ' ' || *name == '*')
+        {
+            name++;
+        }
+        name[strcspn(name, "\r\n")] = '\0';
+        if (strncmp(name, "./", 2) == 0)
+        {
+            name += 2;
+        }
+        if (strcmp(name, strncmp(rom_path, "./", 2) == 0 ? rom_path + 2 : rom_path) != 0)
+        {
+            continue;
+        }
+        for (int i = 0; i < 20; i++)
+        {
+            unsigned byte;
+            if (!isxdigit((unsigned char)line[2 * i]) || !isxdigit((unsigned char)line[2 * i + 1]) || sscanf(line + 2 * i, "%2x", &byte) != 1)
+            {
+                fatal_error("%s: malformed checksum for %s", sha1_path, rom_path);
+            }
+            digest[i] = byte;
+        }
+        fclose(file);
+        return;
+    }
+    fatal_error("%s: no checksum for %s", sha1_path, rom_path);
+}
+
 int main(int argc, char ** argv)
 {
     uint16_t secure_crc = 0xFFFF;
     char game_code[4] = "NTRJ";
     int override_crc = 0;
+    int calc_secure_crc = 0;
     int override_code = 0;
-    FILE * rom = NULL;
+    int print_sha1 = 0;
+    const char * verify_path = NULL;
+    const char * rom_path = NULL;
 
     for (int i = 1; i < argc; i++) {
         if (strcmp(argv[i], "--secure-crc") == 0)
@@ -121,18 +447,25 @@ int main(int argc, char ** argv)
             {
                 fatal_error("multiple --secure-crc options specified");
             }
+            override_crc = 1;
+            if (i + 1 < argc && strcmp(argv[i + 1], "auto") == 0)
+            {
+                // Computed from the secure area below
+                calc_secure_crc = 1;
+                i++;
+                continue;
+            }
             char * endptr;
             unsigned long secure_crc_l = strtoul(argv[++i], &endptr, 0);
             if (secure_crc_l == 0 && endptr == argv[i])
             {
-                fatal_error("argument to --secure-crc must be an integer");
+                fatal_error("argument to --secure-crc must be an integer or 'auto'");
             }
             if (secure_crc_l >= 0x10000)
             {
                 fatal_error("argument to --secure-crc must be a 16-bit integer");
             }
             secure_crc = secure_crc_l;
-            override_crc = 1;
         }
         else if (strcmp(argv[i], "--game-code") == 0)
         {
@@ -147,23 +480,51 @@ int main(int argc, char ** argv)
             strncpy(game_code, argv[i], 4);
             override_code = 1;
         }
-        else
+        else if (strcmp(argv[i], "--sha1") == 0)
         {
-            if (rom != NULL)
+            print_sha1 = 1;
+        }
+        else if (strcmp(argv[i], "--verify-sha1") == 0)
+        {
+            if (verify_path != NULL)
             {
-                fatal_error("unrecognized %s argument: %s", argv[i][0] == '-' ? "flag" : "positional", argv[i]);
+                fatal_error("multiple --verify-sha1 options specified");
+            }
+            if (i + 1 >= argc)
+            {
+                fatal_error("--verify-sha1 requires a checksum file");
             }
-            rom = fopen(argv[i], "r+b");
-            if (rom == NULL)
+            verify_path = argv[++i];
+        }
+        else
+        {
+            if (rom_path != NULL || argv[i][0] == '-')
             {
-                fatal_error(argv[i][0] == '-' ? "unrecognized flag argument: %s" : "unable to open file '%s' for reading", argv[i]);
+                fatal_error("unrecognized %s argument: %s", argv[i][0] == '-' ? "flag" : "positional", argv[i]);
             }
+            rom_path = argv[i];
         }
     }
 
-    if (fread(RomHeader, 1, HEADER_SIZE, rom) != HEADER_SIZE)
+    if (rom_path == NULL)
     {
-        fatal_error("error reading the ROM header");
+        fatal_error("missing ROM argument");
+    }
+
+    InitCrcTable();
+    MapRom(rom_path);
+
+    // The header is finalised first, so that the digest below sees it as
+    // written and the image is read only once.
+    if (calc_secure_crc)
+    {
+        // From the ARM9 ROM offset to the end of the secure area
+        uint32_t arm9_offset = HeaderReadU32LE(0x20);
+        if (arm9_offset >= SECURE_AREA_END || RomSize < SECURE_AREA_END)
+        {
+            fatal_error("ROM has no secure area");
+        }
+        secure_crc = Calc_CRC16(RomImage + arm9_offset, SECURE_AREA_END - arm9_offset, 0xFFFF);
     }
 
     if (override_crc)
@@ -179,12 +540,39 @@ int main(int argc, char ** argv)
     uint16_t header_crc = Calc_CRC16((uint8_t *)RomHeader, 0x15E, 0xFFFF);
     HeaderWriteU16LE(0x15E, header_crc);
 
-    fseek(rom, 0, SEEK_SET);
-    if (fwrite(RomHeader, 1, HEADER_SIZE, rom) != HEADER_SIZE)
+    if (print_sha1 || verify_path != NULL)
     {
-        fatal_error("error writing the ROM header");
+        uint8_t expected[20];
+        uint8_t digest[20];
+        Sha1Context ctx;
+
+        if (verify_path != NULL)
+        {
+            ReadExpectedSha1(verify_path, rom_path, expected);
+        }
+        Sha1Init(&ctx);
+        Sha1Update(&ctx, RomImage, RomSize);
+        Sha1Final(&ctx, digest);
+        if (print_sha1)
+        {
+            for (int i = 0; i < 20; i++)
+            {
+                printf("%02x", digest[i]);
+            }
+            printf(" *%s\n", rom_path);
+        }
+        if (verify_path != NULL)
+        {
+            int match = memcmp(digest, expected, 20) == 0;
+            printf("%s: %s\n", rom_path, match ? "OK" : "FAILED");
+            if (!match)
+            {
+                UnmapRom(rom_path);
+                fatal_error("%s does not match %s", rom_path, verify_path);
+            }
+        }
     }
 
-    fclose(rom);
+    UnmapRom(rom_path);
     return EXIT_SUCCESS;
 }
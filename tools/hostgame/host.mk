@@ -0,0 +1,91 @@
+# Shared rules for the host harnesses under tools/ (warpbench, savesim and the
+# rest). Each builds some of the game's own sources with the host compiler,
+# against the game's headers, and links them with host stand-ins for the SDK
+# and a driver in main.c. A harness's Makefile sets
+#
+#   PROGRAM       the driver, built from main.c
+#   VARIANT_OBJS  copies of game.c, one per setting of an OPTIMIZE_* switch;
+#                 each sets VARIANT to the -D flags for its copy
+#   GAME_OBJS     game sources built once, from the harness directory or from
+#                 src/ under the same name
+#   HOST_OBJS     the harness's own stand-ins, which also get -Wall
+#   GENERATED     files the harness makes for itself, removed by clean
+#
+# and then includes this file.
+
+TOP      := ../..
+HOSTGAME := $(TOP)/tools/hostgame
+
+CC      := gcc
+CFLAGS  := -O3 -std=gnu11 -Wall
+LDFLAGS := -Wl,--gc-sections
+OBJCOPY := objcopy
+
+# The harness's own host32, if it has one, comes ahead of the shared one, and
+# both ahead of the SDK. Each function gets its own section so that
+# --gc-sections drops the ones that call into parts of the game the harness
+# does not have.
+GAMEFLAGS := -O3 -std=gnu99 -ffreestanding -fms-extensions -ffunction-sections -fdata-sections \
+	-DHEARTGOLD -DGAME_REMASTER=0 -DENGLISH -DSDK_ARM9 -DSDK_CODE_ARM -DSDK_FINALROM -DPM_KEEP_ASSERTS \
+	-Ihost32 -I$(HOSTGAME)/host32 -I. -I$(TOP)/include -I$(TOP)/files \
+	-isystem $(TOP)/include/library -isystem $(TOP)/lib/include \
+	-include global.h
+
+DEPDIR := .deps
+DEPFLAGS = -MT $@ -MMD -MP -MF $(DEPDIR)/$(basename $@).d
+
+# Files the game's headers include that the top-level build generates. Making
+# them takes only the native tools, not the ARM toolchain, so game-headers
+# asks the top-level Makefile for just those; it is a no-op once they are up
+# to date.
+GAME_HEADER_TOOLS := \
+	tools/gen_fx_consts/ \
+	tools/jsonproc/ \
+	tools/msgenc/ \
+	tools/knarc/ \
+	tools/csv2bin/
+GAME_HEADERS := \
+	lib/include/nitro/fx/fx_const.h \
+	files/msgdata/headers.done \
+	files/msgdata/msg.naix \
+	files/fielddata/mapmatrix/map_matrix.naix \
+	files/itemtool/itemdata/item_data.naix \
+	files/itemtool/itemdata/item_icon.naix
+
+OBJS := $(VARIANT_OBJS) $(GAME_OBJS) $(HOST_OBJS)
+
+.PHONY: all check clean game-headers
+
+all: $(PROGRAM)
+	@:
+
+check: $(PROGRAM)
+	./$(PROGRAM) selftest
+
+clean:
+	$(RM) -r $(PROGRAM) $(PROGRAM).exe $(OBJS) $(GENERATED) $(DEPDIR)
+
+game-headers:
+	@$(MAKE) -s -C $(TOP) $(GAME_HEADER_TOOLS)
+	@$(MAKE) -s -C $(TOP) $(GAME_HEADERS)
+
+$(PROGRAM): main.c $(OBJS) | $(DEPDIR)
+	$(CC) $(CFLAGS) $(DEPFLAGS) -o $@ main.c $(OBJS) $(LDFLAGS)
+
+# Everything in a variant except the functions game.c renames with its prefix
+# is hidden and then made local, so that the copies do not clash at link time.
+$(VARIANT_OBJS): %.o: game.c | $(DEPDIR) game-headers
+	$(CC) $(GAMEFLAGS) $(DEPFLAGS) -fvisibility=hidden $(VARIANT) -c -o $@ $<
+	$(OBJCOPY) --localize-hidden $@
+
+$(HOST_OBJS): GAMEFLAGS += -Wall
+
+%.o: %.c | $(DEPDIR) game-headers
+	$(CC) $(GAMEFLAGS) $(DEPFLAGS) -c -o $@ $<
+
+%.o: $(TOP)/src/%.c | $(DEPDIR) game-headers
+	$(CC) $(GAMEFLAGS) $(DEPFLAGS) -c -o $@ $<
+
+$(DEPDIR): ; @mkdir -p $@
+
+include $(wildcard $(DEPDIR)/*.d)
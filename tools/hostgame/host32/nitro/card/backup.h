@@ -0,0 +1,16 @@
+#ifndef NITRO_CARD_BACKUP_BACKUP_H_
+#define NITRO_CARD_BACKUP_BACKUP_H_
+
+// Stands in for the SDK's nitro/card/backup.h. Its inlines hand the buffer
+// to CARDi_RequestStreamCommand as a u32, which would cut a host pointer in
+// half, so here the calls save.c makes are plain functions, implemented by
+// the flash model in each harness's hostsave.c.
+
+BOOL CARD_TryWaitBackupAsync(void);
+void CARD_CancelBackupAsync(void);
+BOOL CARD_WaitBackupAsync(void);
+void CARD_ReadBackupAsync(u32 src, void *dst, u32 len, MIDmaCallback callback, void *arg);
+BOOL CARD_ReadBackup(u32 src, void *dst, u32 len);
+void CARD_WriteAndVerifyBackupAsync(u32 dst, const void *src, u32 len, MIDmaCallback callback, void *arg);
+
+#endif //NITRO_CARD_BACKUP_BACKUP_H_
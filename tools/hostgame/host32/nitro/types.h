@@ -0,0 +1,23 @@
+#ifndef GUARD_HOSTGAME_HOST32_TYPES_H
+#define GUARD_HOSTGAME_HOST32_TYPES_H
+
+// The NitroSDK defines u32 and s32 as long, which is 64 bits on a 64-bit
+// host and would change the layout of every game struct that holds one. Take
+// the SDK's types, then redefine those two at their ARM width. The ARM build
+// also puts u64 and s64 members on a 4-byte boundary where the host would use
+// 8, which pads out structs such as Pokemon and PC_STORAGE.
+#define u32 nitro_u32
+#define s32 nitro_s32
+#define u64 nitro_u64
+#define s64 nitro_s64
+#include_next <nitro/types.h>
+#undef u32
+#undef s32
+#undef u64
+#undef s64
+typedef unsigned int u32;
+typedef signed int s32;
+typedef unsigned long long u64 __attribute__((aligned(4)));
+typedef signed long long s64 __attribute__((aligned(4)));
+
+#endif //GUARD_HOSTGAME_HOST32_TYPES_H
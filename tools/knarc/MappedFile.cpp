@@ -0,0 +1,147 @@
+#include "MappedFile.h"
+
+#include <fstream>
+#include <utility>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+MappedFile::~MappedFile()
+{
+    Close();
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+{
+    *this = move(other);
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+{
+    if (this != &other)
+    {
+        Close();
+        buffer = move(other.buffer);
+        data = other.mapped ? other.data : buffer.data();
+        size = other.size;
+        mapped = other.mapped;
+        other.data = nullptr;
+        other.size = 0;
+        other.mapped = false;
+    }
+
+    return *this;
+}
+
+bool MappedFile::Open(const string& fileName)
+{
+    Close();
+
+#ifndef _WIN32
+    int fd = open(fileName.c_str(), O_RDONLY);
+
+    if (fd < 0) { return false; }
+
+    struct stat st;
+
+    if (fstat(fd, &st) != 0)
+    {
+        close(fd);
+
+        return false;
+    }
+
+    size = static_cast<size_t>(st.st_size);
+
+    if (size != 0)
+    {
+        void* p = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+        if (p != MAP_FAILED)
+        {
+            data = static_cast<const uint8_t*>(p);
+            mapped = true;
+        }
+    }
+
+    close(fd);
+
+    if (mapped || size == 0) { return true; }
+#endif
+
+    ifstream ifs(fileName, ios::binary | ios::ate);
+
+    if (!ifs.good()) { return false; }
+
+    size = static_cast<size_t>(ifs.tellg());
+    buffer.resize(size);
+    ifs.seekg(0);
+    ifs.read(reinterpret_cast<char*>(buffer.data()), size);
+    data = buffer.data();
+
+    return ifs.good();
+}
+
+void MappedFile::Close()
+{
+#ifndef _WIN32
+    if (mapped)
+    {
+        munmap(const_cast<uint8_t*>(data), size);
+    }
+#endif
+
+    buffer.clear();
+    data = nullptr;
+    size = 0;
+    mapped = false;
+}
+
+bool WriteWholeFile(const string& fileName, const uint8_t* data, size_t size)
+{
+#ifndef _WIN32
+    int fd = open(fileName.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0666);
+
+    if (fd < 0) { return false; }
+
+#ifdef __linux__
+    if (size != 0)
+    {
+        // Best effort; not every filesystem supports it
+        posix_fallocate(fd, 0, size);
+    }
+#endif
+
+    while (size != 0)
+    {
+        ssize_t n = write(fd, data, size);
+
+        if (n <= 0)
+        {
+            close(fd);
+
+            return false;
+        }
+
+        data += n;
+        size -= n;
+    }
+
+    return close(fd) == 0;
+#else
+    ofstream ofs(fileName, ios::binary);
+
+    if (!ofs.good()) { return false; }
+
+    ofs.write(reinterpret_cast<const char*>(data), size);
+    ofs.close();
+
+    return ofs.good();
+#endif
+}
@@ -1,20 +1,25 @@
 #include "Narc.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <fstream>
 #include <iomanip>
 #include <ios>
 #include <iostream>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <regex>
 #include <sstream>
-#include <stack>
 #include <string>
+#include <system_error>
+#include <thread>
 #include <vector>
 
+#include "MappedFile.h"
 #include "fnmatch.h"
 
 #if (__cplusplus < 201703L)
@@ -42,15 +47,6 @@ void Narc::AlignDword(ofstream& ofs, uint8_t paddingChar)
     }
 }
 
-bool Narc::Cleanup(ifstream& ifs, const NarcError& e)
-{
-    ifs.close();
-
-    error = e;
-
-    return false;
-}
-
 bool Narc::Cleanup(ofstream& ofs, const NarcError& e)
 {
     ofs.close();
@@ -193,6 +189,19 @@ NarcError Narc::GetError() const
     return error;
 }
 
+const fs::path& Narc::GetErrorFile() const
+{
+    return errorFile;
+}
+
+bool Narc::Fail(const fs::path& fileName, const NarcError& e)
+{
+    error = e;
+    errorFile = fileName;
+
+    return false;
+}
+
 class WildcardVector : public vector<string> {
 public:
     WildcardVector(fs::path fp) {
@@ -506,215 +515,256 @@ bool Narc::Pack(const fs::path& fileName, const fs::path& directory)
     return error == NarcError::None ? true : false;
 }
 
-bool Narc::Unpack(const fs::path& fileName, const fs::path& directory)
+template <typename T>
+static bool ReadAt(const MappedFile& narc, size_t offset, T& value)
 {
-    ifstream ifs(fileName, ios::binary);
+    if (offset > narc.Size() || narc.Size() - offset < sizeof(T)) { return false; }
+
+    memcpy(&value, narc.Data() + offset, sizeof(T));
 
-    if (!ifs.good()) { return Cleanup(ifs, NarcError::InvalidInputFile); }
+    return true;
+}
 
+bool Narc::PlanUnpack(const MappedFile& narc, const fs::path& fileName, const fs::path& directory, vector<UnpackedFile>& files, vector<fs::path>& directories)
+{
     Header header;
-    ifs.read(reinterpret_cast<char*>(&header), sizeof(Header));
 
-    if (header.Id != 0x4352414E) { return Cleanup(ifs, NarcError::InvalidHeaderId); }
-    if (header.ByteOrderMark != 0xFFFE) { return Cleanup(ifs, NarcError::InvalidByteOrderMark); }
-    if ((header.Version != 0x0100) && (header.Version != 0x0000)) { return Cleanup(ifs, NarcError::InvalidVersion); }
-    if (header.ChunkSize != 0x10) { return Cleanup(ifs, NarcError::InvalidHeaderSize); }
-    if (header.ChunkCount != 0x3) { return Cleanup(ifs, NarcError::InvalidChunkCount); }
+    if (!ReadAt(narc, 0, header)) { return Fail(fileName, NarcError::InvalidInputFile); }
+    if (header.Id != 0x4352414E) { return Fail(fileName, NarcError::InvalidHeaderId); }
+    if (header.ByteOrderMark != 0xFFFE) { return Fail(fileName, NarcError::InvalidByteOrderMark); }
+    if ((header.Version != 0x0100) && (header.Version != 0x0000)) { return Fail(fileName, NarcError::InvalidVersion); }
+    if (header.ChunkSize != 0x10) { return Fail(fileName, NarcError::InvalidHeaderSize); }
+    if (header.ChunkCount != 0x3) { return Fail(fileName, NarcError::InvalidChunkCount); }
 
     FileAllocationTable fat;
-    ifs.read(reinterpret_cast<char*>(&fat), sizeof(FileAllocationTable));
 
-    if (fat.Id != 0x46415442) { return Cleanup(ifs, NarcError::InvalidFileAllocationTableId); }
-    if (fat.Reserved != 0x0) { return Cleanup(ifs, NarcError::InvalidFileAllocationTableReserved); }
+    if (!ReadAt(narc, header.ChunkSize, fat)) { return Fail(fileName, NarcError::InvalidInputFile); }
+    if (fat.Id != 0x46415442) { return Fail(fileName, NarcError::InvalidFileAllocationTableId); }
+    if (fat.Reserved != 0x0) { return Fail(fileName, NarcError::InvalidFileAllocationTableReserved); }
 
-    unique_ptr<FileAllocationTableEntry[]> fatEntries = make_unique<FileAllocationTableEntry[]>(fat.FileCount);
+    size_t fatEntriesOffset = static_cast<size_t>(header.ChunkSize) + sizeof(FileAllocationTable);
+    size_t fntOffset = static_cast<size_t>(header.ChunkSize) + fat.ChunkSize;
+    FileNameTable fnt;
+
+    if (fat.ChunkSize < sizeof(FileAllocationTable) + fat.FileCount * sizeof(FileAllocationTableEntry)) { return Fail(fileName, NarcError::InvalidInputFile); }
+    if (!ReadAt(narc, fntOffset, fnt)) { return Fail(fileName, NarcError::InvalidInputFile); }
+    if (fnt.Id != 0x464E5442) { return Fail(fileName, NarcError::InvalidFileNameTableId); }
+
+    size_t fntEntriesOffset = fntOffset + sizeof(FileNameTable);
+    size_t imagesOffset = fntOffset + fnt.ChunkSize;
+    FileImages fi;
+
+    if (!ReadAt(narc, imagesOffset, fi)) { return Fail(fileName, NarcError::InvalidInputFile); }
+    if (fi.Id != 0x46494D47) { return Fail(fileName, NarcError::InvalidFileImagesId); }
+
+    size_t imagesBase = imagesOffset + sizeof(FileImages);
+    vector<FileAllocationTableEntry> fatEntries(fat.FileCount);
 
     for (uint16_t i = 0; i < fat.FileCount; ++i)
     {
-        ifs.read(reinterpret_cast<char*>(&fatEntries.get()[i]), sizeof(FileAllocationTableEntry));
+        FileAllocationTableEntry& entry = fatEntries[i];
+
+        if (!ReadAt(narc, fatEntriesOffset + i * sizeof(FileAllocationTableEntry), entry)) { return Fail(fileName, NarcError::InvalidInputFile); }
+        if (entry.Start > entry.End || imagesBase + entry.End > narc.Size()) { return Fail(fileName, NarcError::InvalidInputFile); }
     }
 
-    FileNameTable fnt;
-    vector<FileNameTableEntry> FileNameTableEntries;
-    ifs.read(reinterpret_cast<char*>(&fnt), sizeof(FileNameTable));
+    directories.push_back(directory);
+
+    if (fnt.ChunkSize == 0x10)
+    {
+        for (uint16_t i = 0; i < fat.FileCount; ++i)
+        {
+            ostringstream oss;
+            oss << fileName.stem().string() << "_" << setfill('0') << setw(8) << i << ".bin";
 
-    if (fnt.Id != 0x464E5442) { return Cleanup(ifs, NarcError::InvalidFileNameTableId); }
+            files.push_back({ directory / oss.str(), narc.Data() + imagesBase + fatEntries[i].Start, fatEntries[i].End - fatEntries[i].Start });
+        }
 
-    vector<FileNameTableEntry> fntEntries;
+        return true;
+    }
 
-    do
-    {
-        fntEntries.push_back(FileNameTableEntry());
+    FileNameTableEntry root;
 
-        ifs.read(reinterpret_cast<char*>(&fntEntries.back().Offset), sizeof(uint32_t));
-        ifs.read(reinterpret_cast<char*>(&fntEntries.back().FirstFileId), sizeof(uint16_t));
-        ifs.read(reinterpret_cast<char*>(&fntEntries.back().Utility), sizeof(uint16_t));
-    } while (static_cast<uint32_t>(ifs.tellg()) < (header.ChunkSize + fat.ChunkSize + sizeof(FileNameTable) + fntEntries[0].Offset));
+    if (!ReadAt(narc, fntEntriesOffset, root)) { return Fail(fileName, NarcError::InvalidInputFile); }
 
-    unique_ptr<string[]> fileNames = make_unique<string[]>(0xFFFF);
+    // The root entry's offset points just past the directory table
+    size_t directoryCount = root.Offset / sizeof(FileNameTableEntry);
+    vector<FileNameTableEntry> fntEntries(directoryCount);
+    vector<string> directoryNames(directoryCount);
+    vector<pair<size_t, string>> fileNames(fat.FileCount);
+    vector<bool> named(fat.FileCount, false);
 
-    for (size_t i = 0; i < fntEntries.size(); ++i)
+    if (directoryCount == 0) { return Fail(fileName, NarcError::InvalidInputFile); }
+
+    for (size_t i = 0; i < directoryCount; ++i)
     {
-        ifs.seekg(static_cast<uint64_t>(header.ChunkSize) + fat.ChunkSize + sizeof(FileNameTable) + fntEntries[i].Offset);
+        if (!ReadAt(narc, fntEntriesOffset + i * sizeof(FileNameTableEntry), fntEntries[i])) { return Fail(fileName, NarcError::InvalidInputFile); }
+    }
 
-        uint16_t fileId = 0x0000;
+    for (size_t i = 0; i < directoryCount; ++i)
+    {
+        size_t pos = fntEntriesOffset + fntEntries[i].Offset;
+        uint32_t fileId = fntEntries[i].FirstFileId;
 
-        for (uint8_t length = 0x80; length != 0x00; ifs.read(reinterpret_cast<char*>(&length), sizeof(uint8_t)))
+        for (;;)
         {
-            if (length <= 0x7F)
-            {
-                for (uint8_t j = 0; j < length; ++j)
-                {
-                    uint8_t c;
-                    ifs.read(reinterpret_cast<char*>(&c), sizeof(uint8_t));
+            if (pos >= imagesOffset) { return Fail(fileName, NarcError::InvalidInputFile); }
 
-                    fileNames.get()[fntEntries[i].FirstFileId + fileId] += c;
-                }
+            uint8_t length = narc.Data()[pos++];
+
+            if (length == 0x00)
+            {
+                break;
+            }
+            else if (length <= 0x7F)
+            {
+                if (pos + length > imagesOffset || fileId >= fat.FileCount) { return Fail(fileName, NarcError::InvalidInputFile); }
 
+                fileNames[fileId] = { i, string(reinterpret_cast<const char*>(narc.Data() + pos), length) };
+                named[fileId] = true;
+                pos += length;
                 ++fileId;
             }
             else if (length == 0x80)
             {
                 // Reserved
             }
-            else if (length <= 0xFF)
+            else
             {
                 length -= 0x80;
-                string directoryName;
 
-                for (uint8_t j = 0; j < length; ++j)
-                {
-                    uint8_t c;
-                    ifs.read(reinterpret_cast<char*>(&c), sizeof(uint8_t));
+                uint16_t directoryId;
 
-                    directoryName += c;
-                }
+                if (pos + length + sizeof(uint16_t) > imagesOffset) { return Fail(fileName, NarcError::InvalidInputFile); }
 
-                uint16_t directoryId;
-                ifs.read(reinterpret_cast<char*>(&directoryId), sizeof(uint16_t));
+                memcpy(&directoryId, narc.Data() + pos + length, sizeof(uint16_t));
 
-                fileNames.get()[directoryId] = directoryName;
-            }
-            else
-            {
-                return Cleanup(ifs, NarcError::InvalidFileNameTableEntryId);
+                if (directoryId < 0xF000 || directoryId - 0xF000u >= directoryCount) { return Fail(fileName, NarcError::InvalidFileNameTableEntryId); }
+
+                directoryNames[directoryId - 0xF000] = string(reinterpret_cast<const char*>(narc.Data() + pos), length);
+                pos += length + sizeof(uint16_t);
             }
         }
     }
 
-    if ((ifs.tellg() % 4) != 0)
+    // Resolve every directory to a path below the output directory. Each entry
+    // refers to its parent through Utility; the root's Utility is the count.
+    vector<fs::path> directoryPaths(directoryCount);
+    directoryPaths[0] = directory;
+
+    for (size_t i = 1; i < directoryCount; ++i)
     {
-        ifs.seekg(4 - (ifs.tellg() % 4), ios::cur);
-    }
+        vector<size_t> chain;
 
-    FileImages fi;
-    ifs.read(reinterpret_cast<char*>(&fi), sizeof(FileImages));
+        for (size_t j = i; j != 0 && directoryPaths[j].empty(); j = fntEntries[j].Utility - 0xF000u)
+        {
+            if (fntEntries[j].Utility < 0xF000 || fntEntries[j].Utility - 0xF000u >= directoryCount || chain.size() > directoryCount)
+            {
+                return Fail(fileName, NarcError::InvalidFileNameTableEntryId);
+            }
 
-    if (fi.Id != 0x46494D47) { return Cleanup(ifs, NarcError::InvalidFileImagesId); }
+            chain.push_back(j);
+        }
 
-    fs::create_directory(directory);
-    fs::current_path(directory);
+        for (auto it = chain.rbegin(); it != chain.rend(); ++it)
+        {
+            directoryPaths[*it] = directoryPaths[fntEntries[*it].Utility - 0xF000u] / directoryNames[*it];
+            directories.push_back(directoryPaths[*it]);
+        }
+    }
 
-    if (fnt.ChunkSize == 0x10)
+    for (uint16_t i = 0; i < fat.FileCount; ++i)
     {
-        for (uint16_t i = 0; i < fat.FileCount; ++i)
-        {
-            ifs.seekg(static_cast<uint64_t>(header.ChunkSize) + fat.ChunkSize + fnt.ChunkSize + 8 + fatEntries.get()[i].Start);
+        if (!named[i]) { continue; }
 
-            unique_ptr<char[]> buffer = make_unique<char[]>(fatEntries.get()[i].End - fatEntries.get()[i].Start);
-            ifs.read(buffer.get(), fatEntries.get()[i].End - fatEntries.get()[i].Start);
+        files.push_back({ directoryPaths[fileNames[i].first] / fileNames[i].second, narc.Data() + imagesBase + fatEntries[i].Start, fatEntries[i].End - fatEntries[i].Start });
+    }
 
-            ostringstream oss;
-            oss << fileName.stem().string() << "_" << setfill('0') << setw(8) << i << ".bin";
+    return true;
+}
 
-            ofstream ofs(oss.str(), ios::binary);
+bool Narc::WriteUnpackedFiles(const vector<UnpackedFile>& files, unsigned jobs)
+{
+    if (jobs == 0)
+    {
+        jobs = max(1u, thread::hardware_concurrency());
+    }
 
-            if (!ofs.good())
-            {
-                ofs.close();
+    jobs = static_cast<unsigned>(min<size_t>(jobs, files.size()));
 
-                return Cleanup(ifs, NarcError::InvalidOutputFile);
-            }
+    atomic<size_t> next(0);
+    atomic<bool> failed(false);
+    mutex errorMutex;
 
-            ofs.write(buffer.get(), fatEntries.get()[i].End - fatEntries.get()[i].Start);
-            ofs.close();
-        }
-    }
-    else
+    auto worker = [&]()
     {
-        fs::path absolutePath = fs::absolute(fs::current_path());
-
-        for (size_t i = 0; i < fntEntries.size(); ++i)
+        while (!failed)
         {
-            fs::current_path(absolutePath);
-            stack<string> directories;
+            size_t i = next++;
 
-            for (uint16_t j = fntEntries[i].Utility; j > 0xF000; j = fntEntries[j - 0xF000].Utility)
-            {
-                directories.push(fileNames.get()[j]);
-            }
+            if (i >= files.size()) { break; }
 
-            for (; !directories.empty(); directories.pop())
+            if (!WriteWholeFile(files[i].Path.string(), files[i].Data, files[i].Size))
             {
-                fs::create_directory(directories.top());
-                fs::current_path(directories.top());
-            }
+                lock_guard<mutex> lock(errorMutex);
 
-            if (fntEntries[i].Utility >= 0xF000)
-            {
-                fs::create_directory(fileNames.get()[0xF000 + i]);
-                fs::current_path(fileNames.get()[0xF000 + i]);
+                if (!failed.exchange(true))
+                {
+                    Fail(files[i].Path, NarcError::InvalidOutputFile);
+                }
             }
+        }
+    };
 
-            ifs.seekg(static_cast<uint64_t>(header.ChunkSize) + fat.ChunkSize + sizeof(FileNameTable) + fntEntries[i].Offset);
+    vector<thread> threads;
 
-            uint16_t fileId = 0x0000;
+    for (unsigned i = 1; i < jobs; ++i)
+    {
+        threads.emplace_back(worker);
+    }
 
-            for (uint8_t length = 0x80; length != 0x00; ifs.read(reinterpret_cast<char*>(&length), sizeof(uint8_t)))
-            {
-                if (length <= 0x7F)
-                {
-                    streampos savedPosition = ifs.tellg();
+    worker();
 
-                    ifs.seekg(static_cast<uint64_t>(header.ChunkSize) + fat.ChunkSize + fnt.ChunkSize + 8 + fatEntries.get()[fntEntries[i].FirstFileId + fileId].Start);
+    for (thread& t : threads)
+    {
+        t.join();
+    }
 
-                    unique_ptr<char[]> buffer = make_unique<char[]>(fatEntries.get()[fntEntries[i].FirstFileId + fileId].End - fatEntries.get()[fntEntries[i].FirstFileId + fileId].Start);
-                    ifs.read(buffer.get(), fatEntries.get()[fntEntries[i].FirstFileId + fileId].End - fatEntries.get()[fntEntries[i].FirstFileId + fileId].Start);
+    return !failed;
+}
 
-                    ofstream ofs(fileNames.get()[fntEntries[i].FirstFileId + fileId], ios::binary);
+bool Narc::Unpack(const fs::path& fileName, const fs::path& directory, unsigned jobs)
+{
+    return UnpackAll({ { fileName, directory } }, jobs);
+}
 
-                    if (!ofs.good())
-                    {
-                        ofs.close();
+bool Narc::UnpackAll(const vector<pair<fs::path, fs::path>>& archives, unsigned jobs)
+{
+    vector<MappedFile> narcs(archives.size());
+    vector<UnpackedFile> files;
+    vector<fs::path> directories;
 
-                        return Cleanup(ifs, NarcError::InvalidOutputFile);
-                    }
+    for (size_t i = 0; i < archives.size(); ++i)
+    {
+        if (!narcs[i].Open(archives[i].first.string())) { return Fail(archives[i].first, NarcError::InvalidInputFile); }
+        if (!PlanUnpack(narcs[i], archives[i].first, archives[i].second, files, directories)) { return false; }
+    }
 
-                    ofs.write(buffer.get(), fatEntries.get()[fntEntries[i].FirstFileId + fileId].End - fatEntries.get()[fntEntries[i].FirstFileId + fileId].Start);
-                    ofs.close();
+    // Every path is known before anything is written, so the tree can be
+    // created up front and the members written in any order.
+    for (const fs::path& dir : directories)
+    {
+        error_code ec;
 
-                    ifs.seekg(savedPosition);
-                    ifs.seekg(length, ios::cur);
+        fs::create_directories(dir, ec);
 
-                    ++fileId;
-                }
-                else if (length == 0x80)
-                {
-                    // Reserved
-                }
-                else if (length <= 0xFF)
-                {
-                    ifs.seekg(static_cast<uint64_t>(length) - 0x80 + 0x2, ios::cur);
-                }
-                else
-                {
-                    return Cleanup(ifs, NarcError::InvalidFileNameTableEntryId);
-                }
-            }
-        }
+        if (ec) { return Fail(dir, NarcError::InvalidOutputFile); }
     }
 
-    ifs.close();
+    if (debug)
+    {
+        cerr << "DEBUG: writing " << files.size() << " files from " << archives.size() << " archives" << endl;
+    }
 
-    return error == NarcError::None ? true : false;
+    return WriteUnpackedFiles(files, jobs);
 }
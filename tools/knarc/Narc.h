@@ -3,6 +3,7 @@
 #include <cstdint>
 #include <fstream>
 #include <string>
+#include <utility>
 #include <vector>
 
 #if (__cplusplus < 201703L)
@@ -73,20 +74,38 @@ struct FileImages
     uint32_t ChunkSize;
 };
 
+class MappedFile;
+
 class Narc
 {
 public:
     NarcError GetError() const;
+    const fs::path& GetErrorFile() const;
 
     bool Pack(const fs::path& fileName, const fs::path& directory);
-    bool Unpack(const fs::path& fileName, const fs::path& directory);
+    bool Unpack(const fs::path& fileName, const fs::path& directory, unsigned jobs = 0);
+
+    // Unpacks several (NARC, directory) pairs, writing members of all of them
+    // from one pool of worker threads. jobs == 0 uses every hardware thread.
+    bool UnpackAll(const std::vector<std::pair<fs::path, fs::path>>& archives, unsigned jobs = 0);
 
 private:
+    struct UnpackedFile
+    {
+        fs::path Path;
+        const uint8_t* Data;
+        uint32_t Size;
+    };
+
     NarcError error = NarcError::None;
+    fs::path errorFile;
+
+    bool Fail(const fs::path& fileName, const NarcError& e);
+    bool PlanUnpack(const MappedFile& narc, const fs::path& fileName, const fs::path& directory, std::vector<UnpackedFile>& files, std::vector<fs::path>& directories);
+    bool WriteUnpackedFiles(const std::vector<UnpackedFile>& files, unsigned jobs);
 
     void AlignDword(std::ofstream& ofs, uint8_t paddingChar);
 
-    bool Cleanup(std::ifstream& ifs, const NarcError& e);
     bool Cleanup(std::ofstream& ofs, const NarcError& e);
 
     std::vector<fs::directory_entry> KnarcOrderDirectoryIterator(const fs::path& path, bool recursive) const;
@@ -1,6 +1,9 @@
+#include <cstdlib>
 #include <cstring>
 #include <iostream>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "Narc.h"
 
@@ -33,11 +36,13 @@ void PrintError(NarcError error)
 
 static inline void usage() {
     cout << "OVERVIEW: Knarc" << endl << endl;
-    cout << "USAGE: knarc [options] -d DIRECTORY [-p TARGET | -u SOURCE]" << endl << endl;
+    cout << "USAGE: knarc [options] -d DIRECTORY [-p TARGET | -u SOURCE...]" << endl << endl;
     cout << "OPTIONS:" << endl;
     cout << "\t-d DIRECTORY\tDirectory to pack from/unpack to" << endl;
     cout << "\t-p TARGET\tPack to the target NARC" << endl;
-    cout << "\t-u SOURCE\tUnpack from the source NARC" << endl;
+    cout << "\t-u SOURCE\tUnpack from the source NARC. May be repeated, in which case" << endl;
+    cout << "\t\t\teach NARC is unpacked to DIRECTORY/<NARC name without extension>" << endl;
+    cout << "\t-j JOBS\tNumber of threads to unpack with (default: all cores)" << endl;
     cout << "\t-n\tBuild the filename table (default: discards filenames)" << endl;
     cout << "\t-D/--debug\tPrint additional debug messages" << endl;
     cout << "\t-h/--help\tPrint this message and exit" << endl;
@@ -48,6 +53,8 @@ int main(int argc, char* argv[])
 {
     string directory = "";
     string fileName = "";
+    vector<string> unpackFileNames;
+    unsigned jobs = 0;
     bool pack = false;
 
     for (int i = 1; i < argc; ++i)
@@ -76,7 +83,7 @@ int main(int argc, char* argv[])
                 return 1;
             }
 
-            if (!fileName.empty()) {
+            if (!fileName.empty() || !unpackFileNames.empty()) {
                 cerr << "ERROR: Multiple files specified" << endl;
                 return 1;
             }
@@ -92,11 +99,22 @@ int main(int argc, char* argv[])
                 return 1;
             }
 
-            if (!fileName.empty()) {
-                cerr << "ERROR: Multiple files specified" << endl;
+            if (pack) {
+                cerr << "ERROR: Cannot both pack and unpack" << endl;
                 return 1;
             }
-            fileName = argv[++i];
+            unpackFileNames.push_back(argv[++i]);
+        }
+        else if (!strcmp(argv[i], "-j"))
+        {
+            if (i == (argc - 1))
+            {
+                cerr << "ERROR: No job count specified" << endl;
+
+                return 1;
+            }
+
+            jobs = strtoul(argv[++i], nullptr, 10);
         } else if (!strcmp(argv[i], "-D") || !strcmp(argv[i], "--debug")) {
             debug = true;
         } else if (!strcmp(argv[i], "-h") || !strcmp(argv[i], "--help")) {
@@ -116,7 +134,7 @@ int main(int argc, char* argv[])
         }
     }
 
-    if (fileName.empty()) {
+    if (fileName.empty() && unpackFileNames.empty()) {
         cerr << "ERROR: Missing -u or -p" << endl;
         return 1;
     }
@@ -138,8 +156,23 @@ int main(int argc, char* argv[])
     }
     else
     {
-        if (!narc.Unpack(fileName, directory))
+        vector<pair<fs::path, fs::path>> archives;
+
+        if (unpackFileNames.size() == 1)
+        {
+            archives.emplace_back(unpackFileNames[0], directory);
+        }
+        else
+        {
+            for (const string& name : unpackFileNames)
+            {
+                archives.emplace_back(name, fs::path(directory) / fs::path(name).stem());
+            }
+        }
+
+        if (!narc.UnpackAll(archives, jobs))
         {
+            cerr << narc.GetErrorFile().string() << ": ";
             PrintError(narc.GetError());
 
             return 1;
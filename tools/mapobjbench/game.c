@@ -0,0 +1,113 @@
+// field_map_object.c as the game builds it, with or without
+// OPTIMIZE_MAP_OBJECT_ACTIVE_LIST. The Makefile compiles this file once per
+// variant with MAPOBJ_PREFIX set and hides everything but the functions
+// below, so that both copies can be linked into one program. The functions
+// that are still hand-written assembly are built from their NONMATCHING C.
+#include "../../src/field_map_object.c"
+
+#pragma GCC visibility push(default)
+#include "mapobjbench.h"
+
+#define MAPOBJ_CAT_(a, b) a##b
+#define MAPOBJ_CAT(a, b) MAPOBJ_CAT_(a, b)
+#define MAPOBJ_FUNC(name) MAPOBJ_CAT(MAPOBJ_PREFIX, name)
+
+static MapObjectMan *sManager;
+// One spare entry, since Fsys_SyncMapObjectsToSaveEx asserts it has room after
+// the last live object
+static SavedMapObject sSaved[MAPOBJ_MAX_OBJECTS + 1];
+
+static int SlotOf(LocalMapObject *object) {
+    return object != NULL ? object - MapObjectMan_GetObjects(sManager) : -1;
+}
+
+static LocalMapObject *ObjectAt(int slot) {
+    GF_ASSERT(slot >= 0 && slot < (int)MapObjectMan_GetCount(sManager));
+    return MapObjectMan_GetObjects(sManager) + slot;
+}
+
+void MAPOBJ_FUNC(Open)(uint32_t count) {
+    sManager = sub_0205E0BC(NULL, count, HEAP_ID_FIELD);
+}
+
+void MAPOBJ_FUNC(Close)(void) {
+    MapObjectMan_Delete(sManager);
+    sManager = NULL;
+}
+
+int MAPOBJ_FUNC(Create)(uint32_t id, uint32_t movement, uint32_t mapNo, uint32_t x, uint32_t y) {
+    LocalMapObject *object = CreateSpecialFieldObjectEx(sManager, x, y, 0, 0, movement, mapNo, 0, 0, 0);
+
+    if (object != NULL) {
+        MapObject_SetID(object, id);
+    }
+    return SlotOf(object);
+}
+
+void MAPOBJ_FUNC(Remove)(int slot) {
+    MapObject_Remove(ObjectAt(slot));
+}
+
+void MAPOBJ_FUNC(RemoveAll)(void) {
+    MapObjectMan_RemoveAllActiveObjects(sManager);
+}
+
+void MAPOBJ_FUNC(SaveAndRestore)(void) {
+    u32 count = MapObjectMan_GetCount(sManager);
+
+    Fsys_SyncMapObjectsToSaveEx(NULL, sManager, sSaved, count + 1);
+    MapObjectMan_RemoveAllActiveObjects(sManager);
+    MapObjectMan_RestoreFromSave(sManager, sSaved, count + 1);
+}
+
+void MAPOBJ_FUNC(SetId)(int slot, uint32_t id) {
+    MapObject_SetID(ObjectAt(slot), id);
+}
+
+void MAPOBJ_FUNC(SetFlags)(int slot, uint32_t bits, int set) {
+    if (set) {
+        MapObject_SetFlagsBits(ObjectAt(slot), bits);
+    } else {
+        MapObject_ClearFlagsBits(ObjectAt(slot), bits);
+    }
+}
+
+int MAPOBJ_FUNC(FindById)(uint32_t id) {
+    return SlotOf(GetMapObjectByID(sManager, id));
+}
+
+int MAPOBJ_FUNC(FindByMovement)(uint32_t movement) {
+    return SlotOf(sub_0205EEB4(sManager, movement));
+}
+
+int MAPOBJ_FUNC(FindByIdAndMap)(uint32_t id, uint32_t mapNo) {
+    return SlotOf(sub_0205EA98(sManager, id, mapNo));
+}
+
+int MAPOBJ_FUNC(FirstInactive)(void) {
+    return SlotOf(MapObjectMan_GetFirstInactiveObject(sManager));
+}
+
+int MAPOBJ_FUNC(Iterate)(uint32_t bits, int *slots, int max) {
+    LocalMapObject *object;
+    int index = 0;
+    int n = 0;
+
+    while (sub_0205EEF4(sManager, &object, &index, bits) == TRUE) {
+        if (n < max) {
+            slots[n] = SlotOf(object);
+        }
+        n++;
+    }
+    return n;
+}
+
+void MAPOBJ_FUNC(GetSlot)(int slot, MapObjSlot *dest) {
+    LocalMapObject *object = ObjectAt(slot);
+
+    dest->flags = MapObject_GetFlagsWord(object);
+    dest->id = MapObject_GetID(object);
+    dest->movement = MapObject_GetMovement(object);
+    dest->mapNo = sub_0205F254(object);
+}
+#pragma GCC visibility pop
@@ -0,0 +1,102 @@
+#include "global.h"
+#include "field_map_object.h"
+#include "fieldmap.h"
+#include "heap.h"
+#include "unk_0200E320.h"
+#include "unk_0205FD20.h"
+#include "mapobjbench.h"
+
+// The parts of the heap, the SysTask scheduler and overlay 1 that
+// field_map_object.c calls while objects are created, looked up and removed.
+// Movement and drawing callbacks do nothing: no SysTask ever runs here, and
+// the lookups only read flags, ids, movements and map numbers.
+
+extern void *malloc(__SIZE_TYPE__ size);
+extern void free(void *ptr);
+
+typedef struct ObjectEventGraphicsInfo {
+    u16 sprite_no;
+    u16 mmodel_no;
+    u16 unk4_0:5;
+    u16 unk4_5:5;
+    u16 unk4_10:6;
+} ObjectEventGraphicsInfo;
+
+static u32 sLiveAllocs;
+static u32 sNextTask;
+
+static void HostField_Nop(LocalMapObject *object) {
+}
+
+static UnkLMOCallbackStruct sMovementCallbacks = { 0, HostField_Nop, HostField_Nop, HostField_Nop, HostField_Nop };
+static UnkLMOCallbackStruct2 sGfxCallbacks = { HostField_Nop, HostField_Nop, HostField_Nop, HostField_Nop, HostField_Nop };
+static ObjectEventGraphicsInfo sGfxInfo;
+
+UnkLMOCallbackStruct *_020FD1F4[57] = {
+    [0 ... 56] = &sMovementCallbacks,
+};
+UnkLMOCallbackStruct2 *ov01_02209A38[20] = {
+    [0 ... 19] = &sGfxCallbacks,
+};
+const UnkLMOCallbackStruct2 ov01_0220724C = { HostField_Nop, HostField_Nop, HostField_Nop, HostField_Nop, HostField_Nop };
+
+uint32_t MapObj_LiveAllocs(void) {
+    return sLiveAllocs;
+}
+
+void *AllocFromHeap(HeapID heap_id, u32 size) {
+    void *ret = malloc(size);
+    GF_ASSERT(ret != NULL);
+    sLiveAllocs++;
+    return ret;
+}
+
+void FreeToHeapExplicit(HeapID heap_id, void *ptr) {
+    free(ptr);
+    sLiveAllocs--;
+}
+
+// The tasks are never run or dereferenced, only compared against NULL
+SysTask *CreateSysTask(SysTaskFunc func, void *data, int priority) {
+    return (SysTask *)(uintptr_t)(0x1000 + 0x10 * ++sNextTask);
+}
+
+void DestroySysTask(SysTask *task) {
+}
+
+ObjectEventGraphicsInfo *GetObjectEventGfxInfoPtr(u32 gfx_id) {
+    return &sGfxInfo;
+}
+
+u16 VarGetObjectEventGraphicsId(FieldSystem *fsys, u16 objId) {
+    return objId;
+}
+
+void MapObject_ClearHeldMovement(LocalMapObject *object) {
+}
+
+void ov01_021F92A0(LocalMapObject *object) {
+}
+
+void ov01_021FA2B8(LocalMapObject *object, BOOL set) {
+}
+
+void sub_0205FD20(LocalMapObject *object) {
+}
+
+void sub_0205FD30(LocalMapObject *object) {
+}
+
+void sub_02061070(LocalMapObject *object) {
+}
+
+void sub_020611C8(int x, int y, VecFx32 *a2) {
+    a2->x = x << 16;
+    a2->y = 0;
+    a2->z = y << 16;
+}
+
+// Nothing underfoot, so saves keep the object's own height
+BOOL sub_02061248(FieldSystem *fsys, VecFx32 *coords, BOOL a2) {
+    return FALSE;
+}
@@ -0,0 +1,490 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stdnoreturn.h>
+#include <stdarg.h>
+#include <time.h>
+#include "mapobjbench.h"
+
+#define DEFAULT_CAPACITY    64 // sub_0205E0BC in field_warp_tasks.c
+#define DEFAULT_OPS         200000
+#define DEFAULT_LOOKUPS     2000000
+#define NUM_MOVEMENTS       57 // _020FD1F4
+#define NUM_MAPS            4
+#define FLAG_UNK10          (1 << 10)
+#define FLAG_UNK25          (1 << 25)
+
+typedef struct Variant
+{
+    const char * name;
+    void (*open)(uint32_t count);
+    void (*close)(void);
+    int (*create)(uint32_t id, uint32_t movement, uint32_t mapNo, uint32_t x, uint32_t y);
+    void (*remove)(int slot);
+    void (*removeAll)(void);
+    void (*saveAndRestore)(void);
+    void (*setId)(int slot, uint32_t id);
+    void (*setFlags)(int slot, uint32_t bits, int set);
+    int (*findById)(uint32_t id);
+    int (*findByMovement)(uint32_t movement);
+    int (*findByIdAndMap)(uint32_t id, uint32_t mapNo);
+    int (*firstInactive)(void);
+    int (*iterate)(uint32_t bits, int * slots, int max);
+    void (*getSlot)(int slot, MapObjSlot * dest);
+} Variant;
+
+#define VARIANT(name, prefix)                                                           \
+    { name, prefix##Open, prefix##Close, prefix##Create, prefix##Remove, prefix##RemoveAll, \
+      prefix##SaveAndRestore, prefix##SetId, prefix##SetFlags, prefix##FindById,           \
+      prefix##FindByMovement, prefix##FindByIdAndMap, prefix##FirstInactive,               \
+      prefix##Iterate, prefix##GetSlot }
+
+static const Variant kVariants[] = {
+    VARIANT("array scan", MapObjBase_),
+    VARIANT("slot lists", MapObjList_),
+};
+
+static inline noreturn __attribute__((format(printf, 1, 2))) void fatal_error(const char * message, ...)
+{
+    va_list va_args;
+    va_start(va_args, message);
+    fputs("Error: ", stderr);
+    vfprintf(stderr, message, va_args);
+    fputc('\n', stderr);
+    va_end(va_args);
+    exit(EXIT_FAILURE);
+}
+
+// GF_ASSERT in the game objects, which are built with PM_KEEP_ASSERTS
+void GF_AssertFail(void)
+{
+    fatal_error("GF_ASSERT failed in the game code");
+}
+
+static uint32_t ParseU32(const char * arg)
+{
+    char * end;
+    unsigned long long val = strtoull(arg, &end, 0);
+    if (*arg == '\0' || *end != '\0' || val > 0xFFFFFFFFull)
+    {
+        fatal_error("invalid number: %s", arg);
+    }
+    return (uint32_t)val;
+}
+
+static double Now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static uint32_t Random(uint32_t * state)
+{
+    uint32_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return *state = x;
+}
+
+// ---------------------------------------------------------------------------
+// Stress
+
+typedef enum StressOp
+{
+    OP_CREATE,
+    OP_REMOVE,
+    OP_SET_ID,
+    OP_SET_FLAGS,
+    OP_FIND_BY_ID,
+    OP_FIND_BY_MOVEMENT,
+    OP_FIND_BY_ID_AND_MAP,
+    OP_FIRST_INACTIVE,
+    OP_ITERATE,
+    OP_SAVE_AND_RESTORE,
+    OP_REMOVE_ALL,
+    NUM_OPS
+} StressOp;
+
+static const char * const kOpNames[NUM_OPS] = {
+    "create", "remove", "set id", "set flags", "find by id", "find by movement",
+    "find by id and map", "first inactive", "iterate", "save and restore", "remove all",
+};
+
+// Out of 1000
+static const int kOpWeights[NUM_OPS] = { 250, 150, 100, 100, 150, 50, 50, 50, 80, 10, 10 };
+
+static StressOp PickOp(uint32_t * state)
+{
+    int roll = Random(state) % 1000;
+    for (int op = 0; op < NUM_OPS; op++)
+    {
+        if (roll < kOpWeights[op])
+        {
+            return op;
+        }
+        roll -= kOpWeights[op];
+    }
+    return OP_FIND_BY_ID;
+}
+
+// Any live slot, or -1
+static int PickLiveSlot(const Variant * variant, uint32_t * state)
+{
+    static int slots[MAPOBJ_MAX_OBJECTS];
+    int n = variant->iterate(MAPOBJ_FLAG_ACTIVE, slots, MAPOBJ_MAX_OBJECTS);
+    return n == 0 ? -1 : slots[Random(state) % n];
+}
+
+static bool SameSlots(uint32_t capacity, int * firstDiff)
+{
+    for (uint32_t i = 0; i < capacity; i++)
+    {
+        MapObjSlot a, b;
+        kVariants[0].getSlot(i, &a);
+        kVariants[1].getSlot(i, &b);
+        if (memcmp(&a, &b, sizeof(a)) != 0)
+        {
+            *firstDiff = i;
+            return false;
+        }
+    }
+    return true;
+}
+
+// Drives both builds with the same random calls and fails on the first
+// result or slot that differs
+static int CommandStress(uint32_t capacity, uint32_t ops, uint32_t seed, bool verbose)
+{
+    static int slotsA[MAPOBJ_MAX_OBJECTS], slotsB[MAPOBJ_MAX_OBJECTS];
+    uint32_t state = seed ? seed : 1;
+    uint64_t counts[NUM_OPS] = { 0 };
+    const Variant * a = &kVariants[0];
+    const Variant * b = &kVariants[1];
+
+    a->open(capacity);
+    b->open(capacity);
+    for (uint32_t i = 0; i < ops; i++)
+    {
+        StressOp op = PickOp(&state);
+        uint32_t id = Random(&state) % (2 * capacity);
+        uint32_t movement = Random(&state) % NUM_MOVEMENTS;
+        uint32_t mapNo = Random(&state) % NUM_MAPS;
+        int slot = PickLiveSlot(a, &state);
+        int ra = 0, rb = 0;
+        bool same = true;
+
+        counts[op]++;
+        switch (op)
+        {
+        case OP_CREATE:
+        {
+            uint32_t x = Random(&state) % 32;
+            uint32_t y = Random(&state) % 32;
+            ra = a->create(id, movement, mapNo, x, y);
+            rb = b->create(id, movement, mapNo, x, y);
+            break;
+        }
+        case OP_REMOVE:
+            if (slot >= 0)
+            {
+                a->remove(slot);
+                b->remove(slot);
+            }
+            break;
+        case OP_SET_ID:
+            if (slot >= 0)
+            {
+                a->setId(slot, id);
+                b->setId(slot, id);
+            }
+            break;
+        case OP_SET_FLAGS:
+            if (slot >= 0)
+            {
+                uint32_t bits = Random(&state) % 2 ? FLAG_UNK25 : FLAG_UNK10;
+                int set = Random(&state) % 2;
+                a->setFlags(slot, bits, set);
+                b->setFlags(slot, bits, set);
+            }
+            break;
+        case OP_FIND_BY_ID:
+            ra = a->findById(id);
+            rb = b->findById(id);
+            break;
+        case OP_FIND_BY_MOVEMENT:
+            ra = a->findByMovement(movement);
+            rb = b->findByMovement(movement);
+            break;
+        case OP_FIND_BY_ID_AND_MAP:
+            ra = a->findByIdAndMap(id, mapNo);
+            rb = b->findByIdAndMap(id, mapNo);
+            break;
+        case OP_FIRST_INACTIVE:
+            ra = a->firstInactive();
+            rb = b->firstInactive();
+            break;
+        case OP_ITERATE:
+        {
+            static const uint32_t kBits[] = { MAPOBJ_FLAG_ACTIVE, MAPOBJ_FLAG_ACTIVE | FLAG_UNK25, MAPOBJ_FLAG_ACTIVE | FLAG_UNK10, FLAG_UNK25 };
+            uint32_t bits = kBits[Random(&state) % 4];
+            ra = a->iterate(bits, slotsA, MAPOBJ_MAX_OBJECTS);
+            rb = b->iterate(bits, slotsB, MAPOBJ_MAX_OBJECTS);
+            same = ra != rb || memcmp(slotsA, slotsB, ra * sizeof(int)) == 0;
+            break;
+        }
+        case OP_SAVE_AND_RESTORE:
+            a->saveAndRestore();
+            b->saveAndRestore();
+            break;
+        case OP_REMOVE_ALL:
+            a->removeAll();
+            b->removeAll();
+            break;
+        default:
+            break;
+        }
+
+        int diff;
+        if (ra != rb || !same)
+        {
+            fatal_error("op %u (%s): array scan gave %d, slot lists gave %d", i, kOpNames[op], ra, rb);
+        }
+        if (!SameSlots(capacity, &diff))
+        {
+            fatal_error("op %u (%s): slot %d differs", i, kOpNames[op], diff);
+        }
+    }
+    a->close();
+    b->close();
+    if (MapObj_LiveAllocs() != 0)
+    {
+        fatal_error("%u allocations left after MapObjectMan_Delete", MapObj_LiveAllocs());
+    }
+
+    printf("%u ops on %u slots, seed %u: both builds agree\n", ops, capacity, seed);
+    if (verbose)
+    {
+        for (int op = 0; op < NUM_OPS; op++)
+        {
+            printf("  %-20s %10llu\n", kOpNames[op], (unsigned long long)counts[op]);
+        }
+    }
+    return EXIT_SUCCESS;
+}
+
+// ---------------------------------------------------------------------------
+// Benchmark
+
+typedef enum BenchOp
+{
+    BENCH_FIND_BY_ID,
+    BENCH_FIND_MISSING,
+    BENCH_FIND_BY_MOVEMENT,
+    BENCH_ITERATE,
+    BENCH_FIRST_INACTIVE,
+    BENCH_CHURN,
+    NUM_BENCH_OPS
+} BenchOp;
+
+static const char * const kBenchNames[NUM_BENCH_OPS] = {
+    "GetMapObjectByID", "  (id not present)", "sub_0205EEB4", "sub_0205EEF4 walk", "first inactive", "create + remove",
+};
+
+// Fills LIVE of CAPACITY slots, scattered the way objects end up after a few
+// maps' worth of creates and removes. Ids are 0..LIVE-1, movements 0..LIVE-1.
+static void Populate(const Variant * variant, uint32_t capacity, uint32_t live, uint32_t seed)
+{
+    uint32_t state = seed;
+    variant->open(capacity);
+    for (uint32_t i = 0; i < capacity; i++)
+    {
+        variant->create(1000 + i, NUM_MOVEMENTS - 1, 0, 0, 0);
+    }
+    // Keep a random LIVE of them
+    int slots[MAPOBJ_MAX_OBJECTS];
+    for (uint32_t i = 0; i < capacity; i++)
+    {
+        slots[i] = i;
+    }
+    for (uint32_t i = capacity - 1; i > 0; i--)
+    {
+        uint32_t j = Random(&state) % (i + 1);
+        int tmp = slots[i];
+        slots[i] = slots[j];
+        slots[j] = tmp;
+    }
+    for (uint32_t i = live; i < capacity; i++)
+    {
+        variant->remove(slots[i]);
+    }
+    for (uint32_t i = 0; i < live; i++)
+    {
+        variant->setId(slots[i], i);
+    }
+}
+
+static double BenchOne(const Variant * variant, BenchOp op, uint32_t capacity, uint32_t live, uint32_t lookups)
+{
+    static int slots[MAPOBJ_MAX_OBJECTS];
+    uint32_t state = 0xB0BA;
+    volatile int sink = 0;
+
+    Populate(variant, capacity, live, 0x5EED);
+    double start = Now();
+    for (uint32_t i = 0; i < lookups; i++)
+    {
+        switch (op)
+        {
+        case BENCH_FIND_BY_ID:
+            sink += variant->findById(live ? Random(&state) % live : 0);
+            break;
+        case BENCH_FIND_MISSING:
+            sink += variant->findById(capacity + 5000);
+            break;
+        case BENCH_FIND_BY_MOVEMENT:
+            sink += variant->findByMovement(NUM_MOVEMENTS - 1);
+            break;
+        case BENCH_ITERATE:
+            sink += variant->iterate(MAPOBJ_FLAG_ACTIVE, slots, MAPOBJ_MAX_OBJECTS);
+            break;
+        case BENCH_FIRST_INACTIVE:
+            sink += variant->firstInactive();
+            break;
+        case BENCH_CHURN:
+        {
+            int slot = variant->create(9999, 0, 1, 0, 0);
+            if (slot >= 0)
+            {
+                variant->remove(slot);
+            }
+            break;
+        }
+        default:
+            break;
+        }
+    }
+    double elapsed = Now() - start;
+    variant->close();
+    (void)sink;
+    return elapsed * 1e9 / lookups;
+}
+
+static int CommandBench(uint32_t capacity, uint32_t lookups)
+{
+    static const uint32_t kLive[] = { 4, 16, 32, 48 };
+
+    printf("%u slots; ns per call\n\n", capacity);
+    printf("%-20s %5s %12s %12s %8s\n", "", "live", kVariants[0].name, kVariants[1].name, "speedup");
+    for (int op = 0; op < NUM_BENCH_OPS; op++)
+    {
+        for (size_t l = 0; l < sizeof(kLive) / sizeof(kLive[0]); l++)
+        {
+            uint32_t live = kLive[l] < capacity ? kLive[l] : capacity - 1;
+            double ns[2];
+            for (int v = 0; v < 2; v++)
+            {
+                ns[v] = BenchOne(&kVariants[v], op, capacity, live, lookups);
+            }
+            printf("%-20s %5u %12.1f %12.1f %7.2fx\n", l == 0 ? kBenchNames[op] : "", live, ns[0], ns[1], ns[0] / ns[1]);
+        }
+    }
+    return EXIT_SUCCESS;
+}
+
+// ---------------------------------------------------------------------------
+
+static int CommandSelfTest(void)
+{
+    static const uint32_t kCapacities[] = { 1, 2, 8, 64, 200 };
+    for (size_t i = 0; i < sizeof(kCapacities) / sizeof(kCapacities[0]); i++)
+    {
+        CommandStress(kCapacities[i], 50000, 0x5EED0000 + i, false);
+    }
+    printf("selftest passed\n");
+    return EXIT_SUCCESS;
+}
+
+static noreturn void Usage(const char * prog)
+{
+    fprintf(stderr,
+        "Usage: %s COMMAND [options]\n"
+        "Runs src/field_map_object.c on the host, with and without\n"
+        "OPTIMIZE_MAP_OBJECT_ACTIVE_LIST.\n"
+        "Commands:\n"
+        "  stress            drive both builds with the same random creates,\n"
+        "                    removes, id changes, saves and lookups, and stop\n"
+        "                    at the first difference\n"
+        "  bench             time the lookups at several object counts\n"
+        "  selftest          stress a range of capacities\n"
+        "Options:\n"
+        "  --capacity N      object slots (default %d, at most %d)\n"
+        "  --ops N           stress: calls to make (default %d)\n"
+        "  --lookups N       bench: calls per measurement (default %d)\n"
+        "  --seed N          stress: seed\n",
+        prog, DEFAULT_CAPACITY, MAPOBJ_MAX_OBJECTS, DEFAULT_OPS, DEFAULT_LOOKUPS);
+    exit(EXIT_FAILURE);
+}
+
+int main(int argc, char ** argv)
+{
+    if (argc < 2)
+    {
+        Usage(argv[0]);
+    }
+    const char * command = argv[1];
+    uint32_t capacity = DEFAULT_CAPACITY;
+    uint32_t ops = DEFAULT_OPS;
+    uint32_t lookups = DEFAULT_LOOKUPS;
+    uint32_t seed = 1;
+
+    for (int i = 2; i < argc; i++)
+    {
+        const char * opt = argv[i];
+        if (i + 1 >= argc)
+        {
+            Usage(argv[0]);
+        }
+        if (strcmp(opt, "--capacity") == 0)
+        {
+            capacity = ParseU32(argv[++i]);
+        }
+        else if (strcmp(opt, "--ops") == 0)
+        {
+            ops = ParseU32(argv[++i]);
+        }
+        else if (strcmp(opt, "--lookups") == 0)
+        {
+            lookups = ParseU32(argv[++i]);
+        }
+        else if (strcmp(opt, "--seed") == 0)
+        {
+            seed = ParseU32(argv[++i]);
+        }
+        else
+        {
+            Usage(argv[0]);
+        }
+    }
+    if (capacity == 0 || capacity > MAPOBJ_MAX_OBJECTS || lookups == 0)
+    {
+        Usage(argv[0]);
+    }
+
+    if (strcmp(command, "stress") == 0)
+    {
+        return CommandStress(capacity, ops, seed, true);
+    }
+    if (strcmp(command, "bench") == 0)
+    {
+        return CommandBench(capacity, lookups);
+    }
+    if (strcmp(command, "selftest") == 0)
+    {
+        return CommandSelfTest();
+    }
+    Usage(argv[0]);
+}
@@ -0,0 +1,50 @@
+#ifndef GUARD_MAPOBJBENCH_MAPOBJBENCH_H
+#define GUARD_MAPOBJBENCH_MAPOBJBENCH_H
+
+// The boundary between the host side (main.c) and the objects built from the
+// game's sources (game.c, hostfield.c and src/). Plain C types only, so that
+// both sides can include it with their own headers.
+
+#include <stdint.h>
+
+#define MAPOBJ_MAX_OBJECTS      254 // MAP_OBJECT_SLOT_NONE - 1
+#define MAPOBJ_FLAG_ACTIVE      (1 << 0)  // MAPOBJECTFLAG_ACTIVE
+
+// One slot of the object array, as far as the lookups can tell
+typedef struct MapObjSlot
+{
+    uint32_t flags;
+    uint32_t id;
+    uint32_t movement;
+    uint32_t mapNo;
+} MapObjSlot;
+
+// The heap allocations the game code has outstanding
+uint32_t MapObj_LiveAllocs(void);
+
+// field_map_object.c is built twice, as it ships (MapObjBase_) and with
+// OPTIMIZE_MAP_OBJECT_ACTIVE_LIST (MapObjList_). Slots are indices into the
+// object array; lookups return -1 where the game returns NULL.
+#define MAPOBJ_DECLARE_VARIANT(prefix)                                                  \
+    void prefix##Open(uint32_t count);                                                  \
+    void prefix##Close(void);                                                           \
+    /* CreateSpecialFieldObjectEx, then MapObject_SetID to ID */                         \
+    int prefix##Create(uint32_t id, uint32_t movement, uint32_t mapNo, uint32_t x, uint32_t y); \
+    void prefix##Remove(int slot);                                                      \
+    void prefix##RemoveAll(void);                                                       \
+    /* Fsys_SyncMapObjectsToSaveEx, RemoveAll, MapObjectMan_RestoreFromSave */          \
+    void prefix##SaveAndRestore(void);                                                  \
+    void prefix##SetId(int slot, uint32_t id);                                          \
+    void prefix##SetFlags(int slot, uint32_t bits, int set);                            \
+    int prefix##FindById(uint32_t id);                                                  \
+    int prefix##FindByMovement(uint32_t movement);                                      \
+    int prefix##FindByIdAndMap(uint32_t id, uint32_t mapNo);                            \
+    int prefix##FirstInactive(void);                                                    \
+    /* sub_0205EEF4 until it returns FALSE; returns how many it visited */             \
+    int prefix##Iterate(uint32_t bits, int * slots, int max);                           \
+    void prefix##GetSlot(int slot, MapObjSlot * dest);
+
+MAPOBJ_DECLARE_VARIANT(MapObjBase_)
+MAPOBJ_DECLARE_VARIANT(MapObjList_)
+
+#endif //GUARD_MAPOBJBENCH_MAPOBJBENCH_H
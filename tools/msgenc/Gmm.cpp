@@ -111,8 +111,8 @@ void GMM::FromFile(MessagesConverter &converter) {
     }
 }
 
-// Writes decoded messages to a new GMM file
-void GMM::ToFile(MessagesConverter &converter) {
+// Builds the GMM document for the decoded messages
+void GMM::BuildDocument(MessagesConverter &converter) {
     if (!converter.GetHeaderFilename().empty()) {
         ReadGmmHeader(converter.GetHeaderFilename());
     }
@@ -161,9 +161,38 @@ void GMM::ToFile(MessagesConverter &converter) {
         }
         IncRowNoBuf();
     }
+}
+
+// Writes decoded messages to a new GMM file
+void GMM::ToFile(MessagesConverter &converter) {
+    BuildDocument(converter);
     doc.save(stream);
 }
 
+bool GMM::ToFileIfChanged(MessagesConverter &converter) {
+    BuildDocument(converter);
+    ostringstream rendered;
+    doc.save(rendered);
+    string contents = rendered.str();
+
+    if (stream.is_open()) {
+        stringstream existing;
+        existing << stream.rdbuf();
+        stream.close();
+        if (existing.str() == contents) {
+            return false;
+        }
+    }
+    stream.clear();
+    stream.open(filename, ios::out | ios::binary | ios::trunc);
+    if (!stream.good()) {
+        throw ios::failure("unable to open file \"" + filename + "\" for writing");
+    }
+    stream << contents;
+    stream.close();
+    return true;
+}
+
 // The message headers are included in script files, which can cause the
 // assembler to break if the lines are too long.
 vector<string> GMM::SplitMessage(const string &message) {
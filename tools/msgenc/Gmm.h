@@ -48,8 +48,13 @@ public:
     }
     void FromFile(MessagesConverter &converter);
     void ToFile(MessagesConverter &converter);
+    // Like ToFile, but leaves the file untouched if it already holds the same
+    // document. The GMM must have been opened for reading. Returns whether
+    // the file was written.
+    bool ToFileIfChanged(MessagesConverter &converter);
 
 private:
+    void BuildDocument(MessagesConverter &converter);
     vector<string> SplitMessage(const string &message);
 };
 
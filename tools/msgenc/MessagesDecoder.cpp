@@ -1,17 +1,18 @@
 #include <algorithm>
+#include <cstring>
 #include "MessagesDecoder.h"
 #include "Gmm.h"
 
 void MessagesDecoder::CmdmapRegisterCommand(string &command, uint16_t value)
 {
-    cmdmap[value] = command;
+    maps->cmdmap[value] = command;
     if (command.rfind("STRVAR_", 0) == 0)
-        strvar_codes.insert(value);
+        maps->strvar_codes.insert(value);
 }
 
 void MessagesDecoder::CharmapRegisterCharacter(string &code, uint16_t value)
 {
-    charmap[value] = code;
+    maps->charmap[value] = code;
 }
 
 static string ConvertIntToHexStringN(unsigned value, StrConvMode mode, int n) {
@@ -43,25 +44,42 @@ static string ConvertIntToHexStringN(unsigned value, StrConvMode mode, int n) {
 
 void MessagesDecoder::ReadMessagesFromBin(string& filename)
 {
-    ifstream infile(filename, ios_base::binary);
+    ifstream infile(filename, ios_base::binary | ios_base::ate);
     if (!infile.good()) {
         throw ifstream::failure("Unable to open file \"" + filename + "\" for reading");
     }
-    infile.read((char*)&header, sizeof(header));
+    vector<unsigned char> data(infile.tellg());
+    infile.seekg(0);
+    infile.read((char*)data.data(), (streamsize)data.size());
+    infile.close();
+    ReadMessagesFromBuffer(data.data(), data.size());
+}
+
+void MessagesDecoder::ReadMessagesFromBuffer(const unsigned char *data, size_t size)
+{
+    size_t pos = 0;
+    auto read = [&](void *dest, size_t n) {
+        if (n > size - pos) {
+            throw runtime_error("unexpected end of data in " + binfilename);
+        }
+        memcpy(dest, data + pos, n);
+        pos += n;
+    };
+
+    read(&header, sizeof(header));
     debug_printf("%d lines\n", header.count);
     alloc_table.resize(header.count);
-    infile.read((char*)alloc_table.data(), (streamsize)(sizeof(MsgAlloc) * header.count));
+    read(alloc_table.data(), sizeof(MsgAlloc) * header.count);
     int i = 1;
     for (auto & alloc : alloc_table) {
         alloc.decrypt(header.key, i);
         u16string str;
         str.resize(alloc.length);
-        infile.read((char*)str.data(), (2 * alloc.length));
+        read((char*)str.data(), (2 * (size_t)alloc.length));
         DecryptU16String(str, i);
         vec_encoded.push_back(str);
         i++;
     }
-    infile.close();
 }
 
 u16string MessagesDecoder::DecodeTrainerNameMessage(u16string const &message)
@@ -92,8 +110,9 @@ string MessagesDecoder::DecodeMessage(u16string &message, int &i) {
         uint16_t code = message[j];
         debug_printf("%04X ", code);
 
-        if (charmap.find(code) != charmap.end()) {
-            decoded += charmap[code];
+        auto charmap_it = maps->charmap.find(code);
+        if (charmap_it != maps->charmap.end()) {
+            decoded += charmap_it->second;
         }
         else if (code == (is_trname ? 0x01FF : 0xFFFF)) {
             break;
@@ -105,12 +124,13 @@ string MessagesDecoder::DecodeMessage(u16string &message, int &i) {
             debug_printf("%04X ", code);
             string command;
             bool is_strvar = false;
-            if (find(strvar_codes.cbegin(), strvar_codes.cend(), code & 0xFF00) != strvar_codes.cend()) {
+            auto cmdmap_it = maps->cmdmap.find(code);
+            if (maps->strvar_codes.count(code & 0xFF00) != 0) {
                 is_strvar = true;
                 command = "STRVAR_" + ConvertIntToHexStringN((code >> 8), STR_CONV_MODE_LEFT_ALIGN, 2);
             }
-            else if (cmdmap.find(code) != cmdmap.end()) {
-                command = cmdmap[code];
+            else if (cmdmap_it != maps->cmdmap.end()) {
+                command = cmdmap_it->second;
             } else {
                 throw runtime_error("Invalid control code in " + binfilename + ": " + ConvertIntToHexStringN(code, STR_CONV_MODE_LEADING_ZEROS, 4) + " at line " + to_string(i) + ":" + to_string(j));
             }
@@ -168,6 +188,11 @@ void MessagesDecoder::WriteMessagesToGMM(string &filename) {
     GMM(filename, std::ios::out).ToFile(*this);
 }
 
+bool MessagesDecoder::WriteOutputIfChanged()
+{
+    return GMM(textfilename, std::ios::in | std::ios::binary).ToFileIfChanged(*this);
+}
+
 // Public virtual functions
 
 void MessagesDecoder::ReadInput()
@@ -2,6 +2,7 @@
 #define GUARD_MESSAGESDECODER_H
 
 
+#include <memory>
 #include "MessagesConverter.h"
 
 enum StrConvMode {
@@ -10,13 +11,20 @@ enum StrConvMode {
     STR_CONV_MODE_LEADING_ZEROS
 };
 
-class MessagesDecoder : public MessagesConverter
-{
+// The character and command maps, read once and then only looked up, so one
+// copy can be shared by decoders running on several threads.
+struct DecoderCharmap {
     map <uint16_t, string> cmdmap;
     map <uint16_t, string> charmap;
     set<uint16_t> strvar_codes;
+};
+
+class MessagesDecoder : public MessagesConverter
+{
+    shared_ptr<DecoderCharmap> maps = make_shared<DecoderCharmap>();
 
     void ReadMessagesFromBin(string& filename);
+    void ReadMessagesFromBuffer(const unsigned char *data, size_t size);
     void WriteMessagesToText(string& filename);
     void WriteMessagesToGMM(string& filename);
     template <typename T> void WriteBinaryFile(string& filename, T& data);
@@ -30,6 +38,23 @@ public:
         textfilename = options.posargs[1];
         binfilename = options.posargs[0];
     }
+    // Decodes one bank of an archive, named binname in messages, with a
+    // charmap that has already been read.
+    MessagesDecoder(Options &options, shared_ptr<DecoderCharmap> _maps, const string &binname, const string &textname) :
+        MessagesConverter(options),
+        maps(std::move(_maps))
+    {
+        textfilename = textname;
+        binfilename = binname;
+    }
+    shared_ptr<DecoderCharmap> GetCharmap() {
+        return maps;
+    }
+    void ReadInput(const unsigned char *data, size_t size) {
+        ReadMessagesFromBuffer(data, size);
+    }
+    // Returns false if the GMM already held exactly this text.
+    bool WriteOutputIfChanged();
     void ReadInput() override;
     void Convert() override;
     void WriteOutput() override;
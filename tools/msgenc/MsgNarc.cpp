@@ -0,0 +1,64 @@
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include "MsgNarc.h"
+
+static uint32_t ReadU32(const unsigned char *p) {
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static uint16_t ReadU16(const unsigned char *p) {
+    return p[0] | (p[1] << 8);
+}
+
+MsgNarc::MsgNarc(const string &filename) {
+    ifstream file(filename, ios::binary | ios::ate);
+    if (!file.good()) {
+        throw ifstream::failure("unable to open file \"" + filename + "\" for reading");
+    }
+    image.resize(file.tellg());
+    file.seekg(0);
+    file.read((char *)image.data(), (streamsize)image.size());
+    if (!file.good()) {
+        throw ifstream::failure("unable to read file \"" + filename + "\"");
+    }
+
+    // NARC header, then the BTAF, BTNF and GMIF chunks in that order.
+    auto chunk = [&](size_t offset, const char *id) {
+        if (image.size() < 8 || offset > image.size() - 8 || memcmp(image.data() + offset, id, 4) != 0) {
+            throw runtime_error(filename + ": missing " + id + " chunk");
+        }
+        uint32_t chunk_size = ReadU32(image.data() + offset + 4);
+        if (chunk_size < 8 || chunk_size > image.size() - offset) {
+            throw runtime_error(filename + ": bad " + id + " chunk size");
+        }
+        return chunk_size;
+    };
+
+    if (image.size() < 16 || memcmp(image.data(), "NARC", 4) != 0 || ReadU16(image.data() + 4) != 0xFFFE) {
+        throw runtime_error(filename + ": not a NARC file");
+    }
+    size_t offset = ReadU16(image.data() + 12);
+    uint32_t fat_size = chunk(offset, "BTAF");
+    if (fat_size < 12) {
+        throw runtime_error(filename + ": bad BTAF chunk size");
+    }
+    uint16_t count = ReadU16(image.data() + offset + 8);
+    if (12 + count * 8ul > fat_size) {
+        throw runtime_error(filename + ": file allocation table overflows its chunk");
+    }
+    members.resize(count);
+    for (size_t i = 0; i < count; i++) {
+        members[i].start = ReadU32(image.data() + offset + 12 + i * 8);
+        members[i].end = ReadU32(image.data() + offset + 16 + i * 8);
+    }
+    offset += fat_size;
+    offset += chunk(offset, "BTNF");
+    uint32_t images_size = chunk(offset, "GMIF");
+    images_offset = offset + 8;
+    for (const auto & member : members) {
+        if (member.start > member.end || member.end > images_size - 8) {
+            throw runtime_error(filename + ": file allocation table entry out of range");
+        }
+    }
+}
@@ -0,0 +1,35 @@
+#ifndef GUARD_MSGNARC_H
+#define GUARD_MSGNARC_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+// Read-only view of a NARC archive such as msg.narc: the whole file in memory
+// and the extent of each member from the file allocation table.
+class MsgNarc {
+    struct Member {
+        uint32_t start;
+        uint32_t end;
+    };
+
+    vector<unsigned char> image;
+    vector<Member> members;
+    size_t images_offset = 0;
+
+public:
+    explicit MsgNarc(const string &filename);
+    size_t size() const {
+        return members.size();
+    }
+    const unsigned char *MemberData(size_t i) const {
+        return image.data() + images_offset + members[i].start;
+    }
+    size_t MemberSize(size_t i) const {
+        return members[i].end - members[i].start;
+    }
+};
+
+#endif //GUARD_MSGNARC_H
@@ -0,0 +1,123 @@
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <thread>
+#include "MessagesDecoder.h"
+#include "MsgNarc.h"
+#include "NarcDecoder.h"
+
+namespace fs = std::filesystem;
+
+struct BankResult {
+    string name;
+    uint16_t key = 0;
+    size_t count = 0;
+    double ms = 0;
+    bool written = false;
+    string error;
+};
+
+// Existing GMMs are named STEM_NNNN.gmm or STEM_NNNN_SUFFIX.gmm; map each
+// index to its name so that redumped banks land on the same files.
+static map<size_t, string> FindExistingBanks(const fs::path &outdir, const string &stem) {
+    map<size_t, string> names;
+    string prefix = stem + "_";
+
+    for (const auto &entry : fs::directory_iterator(outdir)) {
+        string filename = entry.path().filename().string();
+        if (entry.path().extension() != ".gmm" || filename.compare(0, prefix.size(), prefix) != 0) {
+            continue;
+        }
+        size_t digits = filename.find_first_not_of("0123456789", prefix.size());
+        if (digits != prefix.size() + 4 || (filename[digits] != '_' && filename[digits] != '.')) {
+            continue;
+        }
+        names.emplace(stoul(filename.substr(prefix.size(), 4)), filename);
+    }
+    return names;
+}
+
+void DecodeMessageNarc(Options &options) {
+    using clock = chrono::steady_clock;
+    auto start = clock::now();
+
+    MsgNarc narc(options.posargs[0]);
+    fs::path outdir(options.posargs[1]);
+    fs::create_directories(outdir);
+    string stem = fs::path(options.posargs[0]).stem().string();
+    map<size_t, string> existing = FindExistingBanks(outdir, stem);
+
+    // Every bank shares one charmap.
+    MessagesDecoder charmap_reader(options, make_shared<DecoderCharmap>(), options.charmap, "");
+    charmap_reader.ReadCharmap();
+    shared_ptr<DecoderCharmap> maps = charmap_reader.GetCharmap();
+
+    vector<BankResult> results(narc.size());
+    for (size_t i = 0; i < narc.size(); i++) {
+        auto it = existing.find(i);
+        if (it != existing.end()) {
+            results[i].name = it->second;
+        } else {
+            stringstream ss;
+            ss << stem << '_' << setw(4) << setfill('0') << i << ".gmm";
+            results[i].name = ss.str();
+        }
+    }
+
+    atomic<size_t> next(0);
+    auto worker = [&]() {
+        for (size_t i; (i = next++) < narc.size(); ) {
+            BankResult &result = results[i];
+            auto bank_start = clock::now();
+            try {
+                fs::path gmm = outdir / result.name;
+                Options bank_options = options;
+                bank_options.gmm_header = fs::path(gmm).replace_extension(".h").string();
+                MessagesDecoder decoder(bank_options, maps, options.posargs[0] + ":" + to_string(i), gmm.string());
+                decoder.ReadInput(narc.MemberData(i), narc.MemberSize(i));
+                decoder.Convert();
+                result.written = decoder.WriteOutputIfChanged();
+                result.key = decoder.GetKey();
+                result.count = decoder.GetDecodedMessages().size();
+            } catch (exception &exc) {
+                result.error = exc.what();
+            }
+            result.ms = chrono::duration<double, milli>(clock::now() - bank_start).count();
+        }
+    };
+
+    int jobs = options.jobs > 0 ? options.jobs : (int)thread::hardware_concurrency();
+    jobs = max(1, min(jobs, (int)narc.size()));
+    vector<thread> threads;
+    for (int i = 1; i < jobs; i++) {
+        threads.emplace_back(worker);
+    }
+    worker();
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    size_t written = 0, failed = 0;
+    for (const auto &result : results) {
+        cout << result.name << ": ";
+        if (!result.error.empty()) {
+            failed++;
+            cout << "FAILED: " << result.error;
+        } else {
+            written += result.written;
+            cout << dec << result.count << " messages, key " << hex << setw(4) << setfill('0') << result.key
+                 << ", " << (result.written ? "written" : "unchanged");
+        }
+        cout << ", " << fixed << setprecision(2) << result.ms << " ms" << endl;
+    }
+    double total = chrono::duration<double, milli>(clock::now() - start).count();
+    cout << dec << results.size() << " banks: " << written << " written, " << results.size() - written - failed
+         << " unchanged, " << failed << " failed in " << fixed << setprecision(2) << total << " ms on " << jobs
+         << " threads" << endl;
+    if (failed != 0) {
+        throw runtime_error(to_string(failed) + " of " + to_string(results.size()) + " banks failed to decode");
+    }
+}
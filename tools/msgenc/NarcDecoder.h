@@ -0,0 +1,13 @@
+#ifndef GUARD_NARCDECODER_H
+#define GUARD_NARCDECODER_H
+
+#include "Options.h"
+
+// Decodes every bank of a message archive (posargs[0], e.g. msg.narc) into
+// GMM files in the directory posargs[1], on options.jobs threads. Each bank
+// keeps the name of an existing GMM with its index in that directory, reads
+// the header next to it for row ids, and is only rewritten if its text
+// changed. Prints the time taken by each bank.
+void DecodeMessageNarc(Options &options);
+
+#endif //GUARD_NARCDECODER_H
@@ -26,6 +26,11 @@ Options::Options(int argc, char **argv) {
             dumpBinary = argv[++i];
         } else if (arg == "--gmm") {
             textFormat = GamefreakGMM;
+        } else if (arg == "--narc") {
+            narc = true;
+            textFormat = GamefreakGMM;
+        } else if (arg == "-j") {
+            jobs = stoi(argv[++i], nullptr, 0);
         } else if (arg[0] != '-') {
             posargs.push_back(arg);
         } else {
@@ -39,6 +44,12 @@ Options::Options(int argc, char **argv) {
     if (mode == CONV_INVALID) {
         failReason = "missing mode flag: -d or -e is required";
     }
+    if (narc && mode != CONV_DECODE) {
+        failReason = "--narc is only supported with -d";
+    }
+    if (narc && !gmm_header.empty()) {
+        failReason = "-H cannot be used with --narc; each bank uses the header next to its GMM";
+    }
     if (charmap.empty()) {
         failReason = "missing charmap file: -c CHARMAP is required";
     }
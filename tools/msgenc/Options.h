@@ -24,6 +24,8 @@ struct Options {
     bool printVersion = false;
     string dumpBinary;
     string gmm_header = "";
+    bool narc = false;
+    int jobs = 0;
     typedef int txtfmt;
     static const txtfmt PlainText = 0;
     static const txtfmt GamefreakGMM = 1;
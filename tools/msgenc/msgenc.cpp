@@ -8,6 +8,7 @@
 #include <iostream>
 #include "MessagesDecoder.h"
 #include "MessagesEncoder.h"
+#include "NarcDecoder.h"
 #include "Options.h"
 
 static const char* progname = "msgenc";
@@ -28,6 +29,9 @@ static inline void usage() {
     cout << "-v            Print the program version and exit." << endl;
     cout << "-h            Print this message and exit." << endl;
     cout << "-D DUMPNAME   Dump the intermediate binary (after decryption or before encryption)." << endl;
+    cout << "--narc        With -d: INFILE is a message archive such as msg.narc and OUTFILE a directory." << endl;
+    cout << "              Decodes every bank to GMM in parallel, rewriting only the files that changed." << endl;
+    cout << "-j JOBS       With --narc: number of threads. Default: one per CPU" << endl;
 }
 
 int do_main(MessagesConverter* &converter, int argc, char ** argv) {
@@ -44,6 +48,11 @@ int do_main(MessagesConverter* &converter, int argc, char ** argv) {
             return 0;
         }
 
+        if (options.narc) {
+            DecodeMessageNarc(options);
+            return 0;
+        }
+
         if (options.mode == CONV_DECODE) {
             converter = new MessagesDecoder(options);
         } else {
@@ -73,7 +82,7 @@ int do_main(MessagesConverter* &converter, int argc, char ** argv) {
 }
 
 int main(int argc, char ** argv) {
-    MessagesConverter *converter;
+    MessagesConverter *converter = nullptr;
     int result = do_main(converter, argc, argv);
     delete converter;
     return result;
@@ -0,0 +1,61 @@
+#!/usr/bin/env bash
+
+# Times compiling the game's C sources with and without mwcache: uncached,
+# into an empty cache, again from the warm cache, and for the other game
+# version, which shares every file whose expansion does not depend on it.
+# Uses the stand-in compiler unless MWCC is set, e.g.
+#   MWCC="wine tools/mwccarm/2.0/sp2p2/mwccarm.exe" tools/mwcache/bench.sh
+# Usage: bench.sh [MAX_FILES]
+
+MYDIR=$(cd "$(dirname "$0")" && pwd)
+ROOT=$(cd "$MYDIR/../.." && pwd)
+MWCACHE="$MYDIR/mwcache"
+read -r -a COMPILER <<< "${MWCC:-$MYDIR/mwccarm-standin.sh}"
+WORK=$(mktemp -d)
+trap 'rm -rf "$WORK"' EXIT
+
+export MWCACHE_DIR="$WORK/cache"
+export MWCIncludes=lib/include
+unset MWCACHE_VERBOSE MWCACHE_VERIFY MWCACHE_DISABLE
+
+# As MWCFLAGS in common.mk, for $(C_OBJS)
+FLAGS=(-DGAME_REMASTER=0 -DENGLISH -DPM_KEEP_ASSERTS -DSDK_ARM9 -DSDK_CODE_ARM -DSDK_FINALROM
+       -O4,p -enum int -lang c99 -Cpp_exceptions off -gccext,on -proc arm946e -msgstyle gcc -gccinc
+       -i ./include -i ./include/library -i ./files -I./lib/include -ipa file -interworking
+       -inline on,noauto -char signed -W all -W pedantic -W noimpl_signedunsigned -W noimplicitconv
+       -W nounusedarg -W nomissingreturn -W error -include global.h)
+
+cd "$ROOT" || exit 1
+mapfile -t SRCS < <(find src -name "*.c" | sort | head -n "${1:-100000}")
+
+# run NAME VERSION [mwcache]: compiles every file, prints the time per file
+run() {
+  local start end failed=0
+  start=$(date +%s%N)
+  for src in "${SRCS[@]}"; do
+    obj="$WORK/$2/${src%.c}.o"
+    mkdir -p "$(dirname "$obj")"
+    rm -f "$obj"
+    $3 "${COMPILER[@]}" -D"$2" "${FLAGS[@]}" -gccdep -MD -c "$src" -o "$obj" >/dev/null 2>&1 || failed=$((failed + 1))
+  done
+  end=$(date +%s%N)
+  printf '%-22s %8.1f ms/file' "$1" "$(awk "BEGIN { print ($end - $start) / 1000000 / ${#SRCS[@]} }")"
+  [ $failed = 0 ] || printf '  (%d failed)' $failed
+  echo
+}
+
+stats() {
+  "$MWCACHE" --stats | grep -E '^(hits|misses|uncacheable|hit rate)' | tr -s ' ' | paste -sd ',' | sed 's/^/    /'
+}
+
+echo "${#SRCS[@]} files, compiler: ${COMPILER[*]}"
+run "uncached" HEARTGOLD
+"$MWCACHE" --zero-stats
+run "cold cache" HEARTGOLD "$MWCACHE"
+stats
+"$MWCACHE" --zero-stats
+run "warm cache" HEARTGOLD "$MWCACHE"
+stats
+"$MWCACHE" --zero-stats
+run "warm, other version" SOULSILVER "$MWCACHE"
+stats
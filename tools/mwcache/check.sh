@@ -0,0 +1,138 @@
+#!/usr/bin/env bash
+
+# Checks that the key mwcache computes for a C file changes whenever the
+# compiler's output would, and only then. Each case edits a scratch project,
+# compiles through mwcache with the stand-in compiler and compares the object
+# it gets back with one the stand-in compiles directly: a hit must be
+# byte-identical, and must not be a miss where the test expects sharing.
+
+MYDIR=$(cd "$(dirname "$0")" && pwd)
+MWCACHE="$MYDIR/mwcache"
+STANDIN="$MYDIR/mwccarm-standin.sh"
+WORK=$(mktemp -d)
+trap 'rm -rf "$WORK"' EXIT
+
+export MWCACHE_DIR="$WORK/cache"
+export MWCACHE_VERBOSE=1
+export MWCIncludes=sys
+unset MWCACHE_VERIFY MWCACHE_DISABLE
+
+FAILED=0
+FLAGS=(-O4,p -proc arm946e -gccinc -i include -DHEARTGOLD)
+
+# compile OBJ [FLAGS...]: prints hit, miss or uncached
+compile() {
+  local obj="$1" out
+  shift
+  mkdir -p "$(dirname "$obj")"
+  rm -f "$obj" "${obj%.o}.d"
+  out=$("$MWCACHE" "$STANDIN" "$@" -gccdep -MD -c src/t.c -o "$obj" 2>&1 >/dev/null) || { echo "error: $out"; return; }
+  "$STANDIN" "$@" -gccdep -MD -c src/t.c -o ref/t.o
+  if ! cmp -s "$obj" ref/t.o; then
+    echo stale
+  elif [[ $out == *"mwcache: hit"* ]]; then
+    echo hit
+  elif [[ $out == *"mwcache: miss"* && $out != *"does not cover"* ]]; then
+    echo miss
+  else
+    echo uncached
+  fi
+}
+
+# expect NAME WANT GOT
+expect() {
+  if [ "$2" == "$3" ]; then
+    printf 'ok    %s\n' "$1"
+  else
+    printf 'FAIL  %s: expected %s, got %s\n' "$1" "$2" "$3"
+    FAILED=1
+  fi
+}
+
+cd "$WORK" || exit 1
+mkdir -p include sys src ref
+cat > include/a.h <<'EOF'
+#pragma opt_level 4
+#define A 1
+EOF
+cat > include/b.h <<'EOF'
+int b_user;
+EOF
+cat > src/t.c <<'EOF'
+#include "a.h"
+int t = A;
+EOF
+
+expect "cold compile" miss "$(compile build/hg/t.o "${FLAGS[@]}")"
+expect "warm compile" hit "$(compile build/hg/t.o "${FLAGS[@]}")"
+expect "other build directory" hit "$(compile build/ss/t.o "${FLAGS[@]}")"
+if grep -q 'build\\ss\\t.o\|build/ss/t.o' build/ss/t.d && ! grep -q 'build.hg' build/ss/t.d; then
+  expect "restored .d names the object" ok ok
+else
+  expect "restored .d names the object" ok "$(head -1 build/ss/t.d)"
+fi
+expect "unused -D shared across versions" hit "$(compile build/ss/t.o -O4,p -proc arm946e -gccinc -i include -DSOULSILVER)"
+expect "other optimization level" miss "$(compile build/hg/t.o -O2 -proc arm946e -gccinc -i include -DHEARTGOLD)"
+
+sed -i 's/opt_level 4/opt_level 2/' include/a.h
+expect "pragma in a header" miss "$(compile build/hg/t.o "${FLAGS[@]}")"
+
+cat >> include/a.h <<'EOF'
+#ifdef __CWCC__
+int cwcc = 1;
+#endif
+EOF
+expect "branch only mwcc compiles, before" miss "$(compile build/hg/t.o "${FLAGS[@]}")"
+sed -i 's/cwcc = 1/cwcc = 2/' include/a.h
+expect "branch only mwcc compiles, after" miss "$(compile build/hg/t.o "${FLAGS[@]}")"
+
+cat >> include/a.h <<'EOF'
+#if __option(little_endian)
+int le;
+#endif
+EOF
+expect "__option in a conditional" uncached "$(compile build/hg/t.o "${FLAGS[@]}")"
+expect "__option in a conditional, again" uncached "$(compile build/hg/t.o "${FLAGS[@]}")"
+sed -i '/__option/,/#endif/d' include/a.h
+
+# b.h in both the -i and the MWCIncludes paths: the host preprocessor and
+# the compiler resolve <b.h> to different files
+echo '#include <b.h>' >> src/t.c
+cat > sys/b.h <<'EOF'
+int b_sys;
+EOF
+expect "include resolved elsewhere" uncached "$(compile build/hg/t.o "${FLAGS[@]}")"
+echo 'int b_sys2;' >> sys/b.h
+expect "include resolved elsewhere, edited" uncached "$(compile build/hg/t.o "${FLAGS[@]}")"
+rm sys/b.h
+expect "include resolved alike" miss "$(compile build/hg/t.o "${FLAGS[@]}")"
+expect "include resolved alike, again" hit "$(compile build/hg/t.o "${FLAGS[@]}")"
+
+# A corrupted entry must be caught by MWCACHE_VERIFY
+for entry in "$MWCACHE_DIR"/*/*.o; do
+  echo corrupt >> "$entry"
+done
+if MWCACHE_VERIFY=1 "$MWCACHE" "$STANDIN" "${FLAGS[@]}" -gccdep -MD -c src/t.c -o build/hg/t.o 2>&1 | grep -q "stale entry"; then
+  expect "MWCACHE_VERIFY reports a stale entry" ok ok
+else
+  expect "MWCACHE_VERIFY reports a stale entry" ok missed
+fi
+
+# With a size limit, the least recently used entries are pruned first
+export MWCACHE_DIR="$WORK/small" MWCACHE_MAXSIZE=4K
+echo 'int v = V;' > src/t.c
+compile build/hg/t.o "${FLAGS[@]}" -DV=0 > /dev/null
+for i in $(seq 1 40); do
+  compile build/hg/t.o "${FLAGS[@]}" -DV="$i" > /dev/null
+  compile build/hg/t.o "${FLAGS[@]}" -DV=0 > /dev/null
+done
+size=$(find "$MWCACHE_DIR" -path "$MWCACHE_DIR/tmp" -prune -o -type f ! -name stats -printf '%s\n' | awk '{ n += $1 } END { print n + 0 }')
+if [ "$size" -le 4096 ]; then
+  expect "pruned to MWCACHE_MAXSIZE" ok ok
+else
+  expect "pruned to MWCACHE_MAXSIZE" ok "$size bytes"
+fi
+expect "recently used entry kept" hit "$(compile build/hg/t.o "${FLAGS[@]}" -DV=0)"
+expect "least recently used entry pruned" miss "$(compile build/hg/t.o "${FLAGS[@]}" -DV=1)"
+
+exit $FAILED
@@ -0,0 +1,1307 @@
+// nftw, flock, mkstemp, realpath
+#define _GNU_SOURCE
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdnoreturn.h>
+#include <stdarg.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <ftw.h>
+#include <unistd.h>
+#include <sys/file.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include "sha256.h"
+
+// Bump when the key or entry layout changes so that old entries are ignored
+#define CACHE_VERSION "mwcache 2"
+
+// Stands in for the object path inside cached dependency files, so that an
+// entry made for build/heartgold.us can be restored into build/soulsilver.us
+#define OBJ_PLACEHOLDER "@MWCACHE_OBJ@"
+
+typedef struct Buffer
+{
+    char * data;
+    size_t size;
+    size_t capacity;
+} Buffer;
+
+typedef struct Invocation
+{
+    char ** argv;       // full command, including wine if present
+    int compilerIdx;    // argv index of mwccarm.exe/mwasmarm.exe
+    int isAssembler;
+    const char * objPath;
+    const char * srcPath;
+    char * depPath;     // NULL unless the command writes a dependency file
+} Invocation;
+
+typedef struct Stats
+{
+    unsigned long long hits;
+    unsigned long long misses;
+    unsigned long long uncacheable;
+    unsigned long long bytes; // stored since the last prune, plus what it kept
+} Stats;
+
+// One file in the cache, for pruning
+typedef struct CacheFile
+{
+    char * path;
+    struct timespec mtime;
+    off_t size;
+} CacheFile;
+
+// Used when MWCACHE_MAXSIZE is not set
+#define DEFAULT_MAX_SIZE (1ULL << 30)
+
+static const char * sCacheDir;
+static int sVerbose;
+static int sVerify;
+static unsigned long long sMaxSize;
+
+static inline noreturn __attribute__((format(printf, 1, 2))) void fatal_error(const char * message, ...)
+{
+    va_list va_args;
+    va_start(va_args, message);
+    fputs("mwcache: ", stderr);
+    vfprintf(stderr, message, va_args);
+    fputc('\n', stderr);
+    va_end(va_args);
+    exit(EXIT_FAILURE);
+}
+
+static void Buffer_Append(Buffer * buf, const void * data, size_t size)
+{
+    if (buf->size + size + 1 > buf->capacity)
+    {
+        size_t capacity = buf->capacity ? buf->capacity : 4096;
+        while (buf->size + size + 1 > capacity)
+        {
+            capacity *= 2;
+        }
+        buf->data = realloc(buf->data, capacity);
+        if (buf->data == NULL)
+        {
+            fatal_error("out of memory");
+        }
+        buf->capacity = capacity;
+    }
+    memcpy(buf->data + buf->size, data, size);
+    buf->size += size;
+    buf->data[buf->size] = '\0';
+}
+
+static void Buffer_AppendStr(Buffer * buf, const char * str)
+{
+    Buffer_Append(buf, str, strlen(str));
+}
+
+static int ReadWholeFile(const char * path, Buffer * buf)
+{
+    char chunk[65536];
+    size_t n;
+    FILE * file = fopen(path, "rb");
+
+    if (file == NULL)
+    {
+        return 0;
+    }
+    buf->size = 0;
+    Buffer_Append(buf, "", 0);
+    while ((n = fread(chunk, 1, sizeof(chunk), file)) != 0)
+    {
+        Buffer_Append(buf, chunk, n);
+    }
+    fclose(file);
+    return 1;
+}
+
+// Writes through a temporary file and renames it into place, so that a
+// concurrent reader never sees half an entry
+static int WriteFileAtomic(const char * path, const void * data, size_t size)
+{
+    char tmpPath[4096];
+    int fd;
+
+    snprintf(tmpPath, sizeof(tmpPath), "%s.tmp%ld", path, (long)getpid());
+    fd = open(tmpPath, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0)
+    {
+        return 0;
+    }
+    const char * p = data;
+    while (size != 0)
+    {
+        ssize_t n = write(fd, p, size);
+        if (n <= 0)
+        {
+            close(fd);
+            unlink(tmpPath);
+            return 0;
+        }
+        p += n;
+        size -= n;
+    }
+    if (close(fd) != 0 || rename(tmpPath, path) != 0)
+    {
+        unlink(tmpPath);
+        return 0;
+    }
+    return 1;
+}
+
+static void DigestToHex(const uint8_t * digest, char * hex)
+{
+    for (int i = 0; i < SHA256_DIGEST_SIZE; i++)
+    {
+        sprintf(hex + 2 * i, "%02x", digest[i]);
+    }
+}
+
+static void HashString(Sha256 * ctx, const char * str)
+{
+    // Include the terminator so that "ab","c" and "a","bc" hash differently
+    Sha256_Update(ctx, str, strlen(str) + 1);
+}
+
+static int HashFile(const char * path, char * hex)
+{
+    Buffer buf = { 0 };
+    Sha256 ctx;
+    uint8_t digest[SHA256_DIGEST_SIZE];
+
+    if (!ReadWholeFile(path, &buf))
+    {
+        return 0;
+    }
+    Sha256_Init(&ctx);
+    Sha256_Update(&ctx, buf.data, buf.size);
+    Sha256_Final(&ctx, digest);
+    DigestToHex(digest, hex);
+    free(buf.data);
+    return 1;
+}
+
+static void MakeDirs(const char * path)
+{
+    char tmp[4096];
+
+    snprintf(tmp, sizeof(tmp), "%s", path);
+    for (char * p = tmp + 1; *p != '\0'; p++)
+    {
+        if (*p == '/')
+        {
+            *p = '\0';
+            mkdir(tmp, 0755);
+            *p = '/';
+        }
+    }
+    mkdir(tmp, 0755);
+}
+
+static void EntryPath(char * dest, size_t size, const char * key, const char * ext)
+{
+    snprintf(dest, size, "%s/%.2s/%s%s", sCacheDir, key, key + 2, ext);
+}
+
+// Runs argv and waits for it. If output is non-NULL, stdout is captured into
+// it and stderr is discarded.
+static int RunCommand(char ** argv, Buffer * output)
+{
+    int pipeFds[2];
+    pid_t pid;
+    int status;
+
+    if (output != NULL && pipe(pipeFds) != 0)
+    {
+        return -1;
+    }
+    pid = fork();
+    if (pid < 0)
+    {
+        return -1;
+    }
+    if (pid == 0)
+    {
+        if (output != NULL)
+        {
+            int devNull = open("/dev/null", O_WRONLY);
+            dup2(pipeFds[1], STDOUT_FILENO);
+            dup2(devNull, STDERR_FILENO);
+            close(pipeFds[0]);
+            close(pipeFds[1]);
+        }
+        execvp(argv[0], argv);
+        fprintf(stderr, "mwcache: cannot run %s: %s\n", argv[0], strerror(errno));
+        _exit(127);
+    }
+    if (output != NULL)
+    {
+        char chunk[65536];
+        ssize_t n;
+        close(pipeFds[1]);
+        output->size = 0;
+        Buffer_Append(output, "", 0);
+        while ((n = read(pipeFds[0], chunk, sizeof(chunk))) > 0)
+        {
+            Buffer_Append(output, chunk, n);
+        }
+        close(pipeFds[0]);
+    }
+    while (waitpid(pid, &status, 0) < 0)
+    {
+        if (errno != EINTR)
+        {
+            return -1;
+        }
+    }
+    return WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+}
+
+static noreturn void ExecCommand(char ** argv)
+{
+    execvp(argv[0], argv);
+    fatal_error("cannot run %s: %s", argv[0], strerror(errno));
+}
+
+// Opens the stats file and takes its lock, which also serializes pruning.
+// Returns NULL if the file cannot be opened.
+static FILE * LockStats(Stats * stats)
+{
+    char path[4096];
+    FILE * file;
+    int fd;
+
+    memset(stats, 0, sizeof(*stats));
+    snprintf(path, sizeof(path), "%s/stats", sCacheDir);
+    fd = open(path, O_RDWR | O_CREAT, 0644);
+    if (fd < 0)
+    {
+        return NULL;
+    }
+    flock(fd, LOCK_EX);
+    file = fdopen(fd, "r+");
+    if (fscanf(file, "%llu %llu %llu %llu", &stats->hits, &stats->misses, &stats->uncacheable, &stats->bytes) < 3)
+    {
+        memset(stats, 0, sizeof(*stats));
+    }
+    return file;
+}
+
+static void UnlockStats(FILE * file, const Stats * stats)
+{
+    rewind(file);
+    fprintf(file, "%llu %llu %llu %llu\n", stats->hits, stats->misses, stats->uncacheable, stats->bytes);
+    fflush(file);
+    ftruncate(fileno(file), ftell(file));
+    fclose(file); // also releases the lock
+}
+
+static void CountStat(int which)
+{
+    Stats stats;
+    FILE * file = LockStats(&stats);
+
+    if (file == NULL)
+    {
+        return;
+    }
+    if (which == 0)
+    {
+        stats.hits++;
+    }
+    else if (which == 1)
+    {
+        stats.misses++;
+    }
+    else
+    {
+        stats.uncacheable++;
+    }
+    UnlockStats(file, &stats);
+}
+
+static CacheFile * sFiles;
+static size_t sNumFiles;
+static size_t sFilesCapacity;
+
+static int CollectFile(const char * path, const struct stat * st, int type, struct FTW * ftw)
+{
+    // Entries live at <cache>/xx/<rest of key>.ext. Skip the stats file, the
+    // preprocessor's scratch files in tmp/ and half-written .tmp files.
+    if (type != FTW_F || ftw->level != 2 || strncmp(path + strlen(sCacheDir), "/tmp/", 5) == 0
+        || strstr(path + ftw->base, ".tmp") != NULL)
+    {
+        return 0;
+    }
+    if (sNumFiles == sFilesCapacity)
+    {
+        sFilesCapacity = sFilesCapacity ? 2 * sFilesCapacity : 1024;
+        sFiles = realloc(sFiles, sFilesCapacity * sizeof(CacheFile));
+    }
+    sFiles[sNumFiles].path = strdup(path);
+    sFiles[sNumFiles].mtime = st->st_mtim;
+    sFiles[sNumFiles].size = st->st_size;
+    sNumFiles++;
+    return 0;
+}
+
+static int CompareFileAge(const void * a, const void * b)
+{
+    const CacheFile * fa = a;
+    const CacheFile * fb = b;
+
+    if (fa->mtime.tv_sec != fb->mtime.tv_sec)
+    {
+        return fa->mtime.tv_sec < fb->mtime.tv_sec ? -1 : 1;
+    }
+    if (fa->mtime.tv_nsec != fb->mtime.tv_nsec)
+    {
+        return fa->mtime.tv_nsec < fb->mtime.tv_nsec ? -1 : 1;
+    }
+    return strcmp(fa->path, fb->path);
+}
+
+// Removes the least recently used files until the cache is at 80% of
+// sMaxSize, so that it does not have to prune again on the next store. A hit
+// touches its files, so mtime order is use order. Returns the size left.
+static unsigned long long Prune(void)
+{
+    unsigned long long total = 0;
+    unsigned long long target = sMaxSize / 10 * 8;
+    size_t removed = 0;
+
+    sNumFiles = 0;
+    nftw(sCacheDir, CollectFile, 16, FTW_PHYS);
+    qsort(sFiles, sNumFiles, sizeof(CacheFile), CompareFileAge);
+    for (size_t i = 0; i < sNumFiles; i++)
+    {
+        total += sFiles[i].size;
+    }
+    for (size_t i = 0; i < sNumFiles && total > target; i++)
+    {
+        if (unlink(sFiles[i].path) == 0)
+        {
+            total -= sFiles[i].size;
+            removed++;
+        }
+    }
+    if (sVerbose)
+    {
+        fprintf(stderr, "mwcache: pruned %zu files, %.1f MiB left\n", removed, total / (1024.0 * 1024.0));
+    }
+    for (size_t i = 0; i < sNumFiles; i++)
+    {
+        free(sFiles[i].path);
+    }
+    return total;
+}
+
+// Counts SIZE newly stored bytes, and prunes once the cache is over its limit
+static void AddStoredBytes(unsigned long long size)
+{
+    Stats stats;
+    FILE * file = LockStats(&stats);
+
+    if (file == NULL)
+    {
+        return;
+    }
+    stats.bytes += size;
+    if (sMaxSize != 0 && stats.bytes > sMaxSize)
+    {
+        stats.bytes = Prune();
+    }
+    UnlockStats(file, &stats);
+}
+
+// Marks an entry file as just used, for Prune
+static void TouchEntry(const char * key, const char * ext)
+{
+    char path[4096];
+
+    EntryPath(path, sizeof(path), key, ext);
+    utimensat(AT_FDCWD, path, NULL, 0);
+}
+
+static unsigned long long sTotalBytes;
+static unsigned long long sTotalEntries;
+
+static int SumEntry(const char * path, const struct stat * st, int type, struct FTW * ftw)
+{
+    (void)ftw;
+    if (type == FTW_F)
+    {
+        sTotalBytes += st->st_size;
+        size_t len = strlen(path);
+        if (len > 2 && strcmp(path + len - 2, ".o") == 0)
+        {
+            sTotalEntries++;
+        }
+    }
+    return 0;
+}
+
+static int RemoveEntry(const char * path, const struct stat * st, int type, struct FTW * ftw)
+{
+    (void)st;
+    if (ftw->level == 0)
+    {
+        return 0;
+    }
+    if (type == FTW_DP)
+    {
+        rmdir(path);
+    }
+    else
+    {
+        unlink(path);
+    }
+    return 0;
+}
+
+static void PrintStats(void)
+{
+    char path[4096];
+    Stats stats = { 0 };
+    FILE * file;
+    unsigned long long lookups;
+
+    snprintf(path, sizeof(path), "%s/stats", sCacheDir);
+    file = fopen(path, "r");
+    if (file != NULL)
+    {
+        if (fscanf(file, "%llu %llu %llu", &stats.hits, &stats.misses, &stats.uncacheable) != 3)
+        {
+            memset(&stats, 0, sizeof(stats));
+        }
+        fclose(file);
+    }
+    nftw(sCacheDir, SumEntry, 16, FTW_PHYS);
+
+    lookups = stats.hits + stats.misses;
+    printf("cache directory  %s\n", sCacheDir);
+    printf("hits             %llu\n", stats.hits);
+    printf("misses           %llu\n", stats.misses);
+    printf("uncacheable      %llu\n", stats.uncacheable);
+    printf("hit rate         %.1f%%\n", lookups ? 100.0 * stats.hits / lookups : 0.0);
+    printf("entries          %llu\n", sTotalEntries);
+    printf("size             %.1f MiB\n", sTotalBytes / (1024.0 * 1024.0));
+    if (sMaxSize != 0)
+    {
+        printf("max size         %.1f MiB\n", sMaxSize / (1024.0 * 1024.0));
+    }
+    else
+    {
+        printf("max size         unlimited\n");
+    }
+}
+
+static const char * BaseName(const char * path)
+{
+    const char * slash = strrchr(path, '/');
+    const char * backslash = strrchr(path, '\\');
+    if (backslash != NULL && (slash == NULL || backslash > slash))
+    {
+        slash = backslash;
+    }
+    return slash != NULL ? slash + 1 : path;
+}
+
+static int HasSuffix(const char * str, const char * suffix)
+{
+    size_t len = strlen(str), suffixLen = strlen(suffix);
+    return len >= suffixLen && strcmp(str + len - suffixLen, suffix) == 0;
+}
+
+// Options whose next argument is a value rather than a file to compile
+static int TakesValue(const char * arg)
+{
+    static const char * const sOptions[] = {
+        "-o", "-i", "-I", "-D", "-U", "-include", "-prefix", "-proc", "-lang", "-enum",
+        "-msgstyle", "-ipa", "-inline", "-char", "-W", "-Cpp_exceptions", "-sym", "-opt",
+    };
+    for (size_t i = 0; i < sizeof(sOptions) / sizeof(sOptions[0]); i++)
+    {
+        if (strcmp(arg, sOptions[i]) == 0)
+        {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static int ParseInvocation(int argc, char ** argv, Invocation * inv)
+{
+    int hasMD = 0;
+
+    memset(inv, 0, sizeof(*inv));
+    inv->argv = argv;
+    inv->compilerIdx = -1;
+    for (int i = 0; i < argc; i++)
+    {
+        const char * base = BaseName(argv[i]);
+        if (strncmp(base, "mwccarm", 7) == 0 || strncmp(base, "mwasmarm", 8) == 0)
+        {
+            inv->compilerIdx = i;
+            inv->isAssembler = base[2] == 'a';
+            break;
+        }
+    }
+    if (inv->compilerIdx < 0)
+    {
+        return 0;
+    }
+
+    for (int i = inv->compilerIdx + 1; i < argc; i++)
+    {
+        const char * arg = argv[i];
+        if (strcmp(arg, "-o") == 0 && i + 1 < argc)
+        {
+            inv->objPath = argv[++i];
+        }
+        else if (strcmp(arg, "-MD") == 0)
+        {
+            hasMD = 1;
+        }
+        else if (strcmp(arg, "-E") == 0 || strcmp(arg, "-M") == 0 || strcmp(arg, "-MM") == 0 || strcmp(arg, "-P") == 0)
+        {
+            // Not producing an object
+            return 0;
+        }
+        else if (TakesValue(arg))
+        {
+            i++;
+        }
+        else if (arg[0] != '-')
+        {
+            if (inv->srcPath != NULL)
+            {
+                return 0; // more than one input
+            }
+            inv->srcPath = arg;
+        }
+    }
+    if (inv->objPath == NULL || inv->srcPath == NULL || !HasSuffix(inv->objPath, ".o"))
+    {
+        return 0;
+    }
+    if (!HasSuffix(inv->srcPath, inv->isAssembler ? ".s" : ".c"))
+    {
+        return 0;
+    }
+    if (hasMD)
+    {
+        size_t len = strlen(inv->objPath);
+        inv->depPath = malloc(len + 1);
+        strcpy(inv->depPath, inv->objPath);
+        inv->depPath[len - 1] = 'd';
+    }
+    return 1;
+}
+
+static int ParseDepFile(const char * contents, Buffer * manifest);
+
+static void AppendArg(char *** list, int * count, const char * arg)
+{
+    *list = realloc(*list, (*count + 2) * sizeof(char *));
+    (*list)[(*count)++] = (char *)arg;
+    (*list)[*count] = NULL;
+}
+
+// C sources are keyed on their preprocessed text rather than on the -D and -I
+// options, so heartgold and soulsilver share every translation unit whose
+// expansion does not depend on the game version. The host preprocessor is run
+// with no builtin macros, so conditionals see only what mwcc would be given.
+// Pragmas pass through it into the text, and mwcc-only conditionals such as
+// #if __option(...) make it fail, which leaves the file uncached. It does not
+// know mwcc's predefined macros, so the full contents of every file it read
+// are keyed too: a change in a branch it skipped but mwcc compiled still
+// misses. FILES receives that list, to be checked against mwcc's own.
+static int ComputeCKey(const Invocation * inv, const char * compilerHash, char * key, Buffer * files)
+{
+    char ** cpp = NULL;
+    int cppArgc = 0;
+    Buffer preprocessed = { 0 }, deps = { 0 };
+    Sha256 ctx;
+    uint8_t digest[SHA256_DIGEST_SIZE];
+    const char * mwcIncludes = getenv("MWCIncludes");
+    char * includes = NULL;
+    char depPath[4096];
+    int fd;
+
+    snprintf(depPath, sizeof(depPath), "%s/tmp", sCacheDir);
+    MakeDirs(depPath);
+    snprintf(depPath, sizeof(depPath), "%s/tmp/cpp-XXXXXX", sCacheDir);
+    fd = mkstemp(depPath);
+    if (fd < 0)
+    {
+        return 0;
+    }
+    close(fd);
+
+    AppendArg(&cpp, &cppArgc, "cpp");
+    AppendArg(&cpp, &cppArgc, "-undef");
+    AppendArg(&cpp, &cppArgc, "-nostdinc");
+    AppendArg(&cpp, &cppArgc, "-std=gnu99");
+    AppendArg(&cpp, &cppArgc, "-D__MWERKS__");
+    AppendArg(&cpp, &cppArgc, "-D__arm");
+    AppendArg(&cpp, &cppArgc, "-MD");
+    AppendArg(&cpp, &cppArgc, "-MF");
+    AppendArg(&cpp, &cppArgc, depPath);
+
+    Sha256_Init(&ctx);
+    HashString(&ctx, CACHE_VERSION " C");
+    HashString(&ctx, compilerHash);
+
+    for (char ** argp = inv->argv + inv->compilerIdx + 1; *argp != NULL; argp++)
+    {
+        const char * arg = *argp;
+        if (strcmp(arg, "-o") == 0)
+        {
+            argp++;
+        }
+        else if (arg == inv->srcPath)
+        {
+            continue;
+        }
+        else if ((strcmp(arg, "-D") == 0 || strcmp(arg, "-U") == 0 || strcmp(arg, "-I") == 0
+                  || strcmp(arg, "-include") == 0) && argp[1] != NULL)
+        {
+            AppendArg(&cpp, &cppArgc, arg);
+            AppendArg(&cpp, &cppArgc, *++argp);
+        }
+        else if (strcmp(arg, "-i") == 0 && argp[1] != NULL)
+        {
+            AppendArg(&cpp, &cppArgc, "-I");
+            AppendArg(&cpp, &cppArgc, *++argp);
+        }
+        else if (strcmp(arg, "-prefix") == 0 && argp[1] != NULL)
+        {
+            AppendArg(&cpp, &cppArgc, "-include");
+            AppendArg(&cpp, &cppArgc, *++argp);
+        }
+        else if (strncmp(arg, "-D", 2) == 0 || strncmp(arg, "-U", 2) == 0 || strncmp(arg, "-I", 2) == 0)
+        {
+            if (strcmp(arg, "-I-") == 0)
+            {
+                // Splits the include path in a way cpp does not model
+                free(cpp);
+                unlink(depPath);
+                return 0;
+            }
+            AppendArg(&cpp, &cppArgc, arg);
+        }
+        else
+        {
+            HashString(&ctx, arg);
+        }
+    }
+
+    // mwcc also searches the directories in MWCIncludes
+    if (mwcIncludes != NULL)
+    {
+        includes = strdup(mwcIncludes);
+        for (char * dir = strtok(includes, ":;"); dir != NULL; dir = strtok(NULL, ":;"))
+        {
+            AppendArg(&cpp, &cppArgc, "-I");
+            AppendArg(&cpp, &cppArgc, dir);
+        }
+    }
+    AppendArg(&cpp, &cppArgc, inv->srcPath);
+
+    int ret = RunCommand(cpp, &preprocessed);
+    free(cpp);
+    free(includes);
+    if (ret != 0 || !ReadWholeFile(depPath, &deps) || !ParseDepFile(deps.data, files))
+    {
+        unlink(depPath);
+        free(preprocessed.data);
+        free(deps.data);
+        return 0;
+    }
+    unlink(depPath);
+    free(deps.data);
+    HashString(&ctx, "--");
+    Sha256_Update(&ctx, preprocessed.data, preprocessed.size);
+    free(preprocessed.data);
+
+    char * copy = strdup(files->data);
+    for (char * line = strtok(copy, "\n"); line != NULL; line = strtok(NULL, "\n"))
+    {
+        char hash[2 * SHA256_DIGEST_SIZE + 1];
+        if (!HashFile(line, hash))
+        {
+            free(copy);
+            return 0;
+        }
+        HashString(&ctx, line);
+        HashString(&ctx, hash);
+    }
+    free(copy);
+    Sha256_Final(&ctx, digest);
+    DigestToHex(digest, key);
+    return 1;
+}
+
+// Assembly goes through mwasm's own .include handling as well as cpp, so it
+// cannot be preprocessed on the host. It is keyed on the exact command line
+// and source instead, plus the contents of every file the assembler's
+// dependency file listed the last time it ran (a manifest).
+static int ComputeAsmBaseKey(const Invocation * inv, const char * compilerHash, char * key)
+{
+    char srcHash[2 * SHA256_DIGEST_SIZE + 1];
+    Sha256 ctx;
+    uint8_t digest[SHA256_DIGEST_SIZE];
+
+    if (inv->depPath == NULL || !HashFile(inv->srcPath, srcHash))
+    {
+        return 0;
+    }
+    Sha256_Init(&ctx);
+    HashString(&ctx, CACHE_VERSION " S");
+    HashString(&ctx, compilerHash);
+    for (char ** argp = inv->argv + inv->compilerIdx + 1; *argp != NULL; argp++)
+    {
+        if (strcmp(*argp, "-o") == 0)
+        {
+            argp++;
+            continue;
+        }
+        HashString(&ctx, *argp);
+    }
+    HashString(&ctx, srcHash);
+    Sha256_Final(&ctx, digest);
+    DigestToHex(digest, key);
+    return 1;
+}
+
+// Combines the base key with the hashes of the files in a manifest. Returns 0
+// if any of them is missing.
+static int ManifestKey(const char * baseKey, const char * manifest, char * key)
+{
+    Sha256 ctx;
+    uint8_t digest[SHA256_DIGEST_SIZE];
+    char * copy = strdup(manifest);
+    int ok = 1;
+
+    Sha256_Init(&ctx);
+    HashString(&ctx, baseKey);
+    for (char * line = strtok(copy, "\n"); line != NULL; line = strtok(NULL, "\n"))
+    {
+        char hash[2 * SHA256_DIGEST_SIZE + 1];
+        if (!HashFile(line, hash))
+        {
+            ok = 0;
+            break;
+        }
+        HashString(&ctx, line);
+        HashString(&ctx, hash);
+    }
+    free(copy);
+    Sha256_Final(&ctx, digest);
+    DigestToHex(digest, key);
+    return ok;
+}
+
+// Turns a gcc-style dependency file as written by mwcc/mwasm into a list of
+// prerequisite paths, one per line
+static int ParseDepFile(const char * contents, Buffer * manifest)
+{
+    const char * p = strchr(contents, ':');
+    // Skip a drive letter in the target ("Z:\...")
+    if (p != NULL && p - contents == 1)
+    {
+        p = strchr(p + 1, ':');
+    }
+    if (p == NULL)
+    {
+        return 0;
+    }
+    p++;
+
+    manifest->size = 0;
+    Buffer_Append(manifest, "", 0);
+    while (*p != '\0')
+    {
+        char path[4096];
+        size_t len = 0;
+
+        while (*p == ' ' || *p == '\t' || *p == '\r' || *p == '\n' || (*p == '\\' && (p[1] == '\r' || p[1] == '\n')))
+        {
+            p++;
+        }
+        if (*p == '\0')
+        {
+            break;
+        }
+        while (*p != '\0' && *p != ' ' && *p != '\t' && *p != '\r' && *p != '\n' && len < sizeof(path) - 1)
+        {
+            if (*p == '\\' && (p[1] == '\r' || p[1] == '\n' || p[1] == '\0'))
+            {
+                break;
+            }
+            path[len++] = *p == '\\' ? '/' : *p;
+            p++;
+        }
+        path[len] = '\0';
+        if (len == 0)
+        {
+            continue;
+        }
+        // Wine reports absolute paths with a drive letter
+        const char * hostPath = path;
+        if (len > 2 && path[1] == ':' && path[2] == '/')
+        {
+            hostPath = path + 2;
+        }
+        Buffer_AppendStr(manifest, hostPath);
+        Buffer_AppendStr(manifest, "\n");
+    }
+    return 1;
+}
+
+// Replaces each occurrence of from with to
+static void Substitute(const char * src, const char * from, const char * to, Buffer * out)
+{
+    size_t fromLen = strlen(from);
+    const char * hit;
+
+    out->size = 0;
+    Buffer_Append(out, "", 0);
+    while ((hit = strstr(src, from)) != NULL)
+    {
+        Buffer_Append(out, src, hit - src);
+        Buffer_AppendStr(out, to);
+        src = hit + fromLen;
+    }
+    Buffer_AppendStr(out, src);
+}
+
+static int TryRestore(const Invocation * inv, const char * key)
+{
+    char path[4096];
+    Buffer obj = { 0 }, dep = { 0 }, fixed = { 0 };
+    int ok = 0;
+
+    EntryPath(path, sizeof(path), key, ".o");
+    if (!ReadWholeFile(path, &obj))
+    {
+        return 0;
+    }
+    if (inv->depPath != NULL)
+    {
+        EntryPath(path, sizeof(path), key, ".d");
+        if (!ReadWholeFile(path, &dep))
+        {
+            goto done;
+        }
+        Substitute(dep.data, OBJ_PLACEHOLDER, inv->objPath, &fixed);
+        if (!WriteFileAtomic(inv->depPath, fixed.data, fixed.size))
+        {
+            goto done;
+        }
+    }
+    ok = WriteFileAtomic(inv->objPath, obj.data, obj.size);
+    if (ok)
+    {
+        TouchEntry(key, ".o");
+        if (inv->depPath != NULL)
+        {
+            TouchEntry(key, ".d");
+        }
+    }
+
+done:
+    free(obj.data);
+    free(dep.data);
+    free(fixed.data);
+    return ok;
+}
+
+// Reads the dependency file the compiler just wrote, with the object path
+// replaced by OBJ_PLACEHOLDER. Returns 0 if it does not name the object.
+static int ReadGenericDepFile(const Invocation * inv, Buffer * generic)
+{
+    Buffer dep = { 0 };
+    char * winObj;
+
+    if (!ReadWholeFile(inv->depPath, &dep))
+    {
+        return 0;
+    }
+    Substitute(dep.data, inv->objPath, OBJ_PLACEHOLDER, generic);
+    if (generic->size == dep.size)
+    {
+        // The compiler may have written the target with backslashes
+        winObj = strdup(inv->objPath);
+        for (char * c = winObj; *c != '\0'; c++)
+        {
+            if (*c == '/')
+            {
+                *c = '\\';
+            }
+        }
+        Substitute(dep.data, winObj, OBJ_PLACEHOLDER, generic);
+        free(winObj);
+    }
+    free(dep.data);
+    return strstr(generic->data, OBJ_PLACEHOLDER) != NULL;
+}
+
+// The C key covers the files the host preprocessor read. Returns 0 unless
+// every file in mwcc's dependency file is one of them: if mwcc resolved an
+// #include elsewhere, for instance because it searches the -i and system
+// paths in another order, an edit to the file it used would not change the
+// key.
+static int CheckKeyCoversDeps(const Invocation * inv, const char * files)
+{
+    Buffer dep = { 0 }, used = { 0 }, keyed = { 0 };
+    int ok = 1;
+
+    if (inv->depPath == NULL || !ReadWholeFile(inv->depPath, &dep) || !ParseDepFile(dep.data, &used))
+    {
+        free(dep.data);
+        free(used.data);
+        return 0;
+    }
+    // Compare canonical paths, one per line and each followed by a newline
+    Buffer_Append(&keyed, "\n", 1);
+    char * copy = strdup(files);
+    for (char * line = strtok(copy, "\n"); line != NULL; line = strtok(NULL, "\n"))
+    {
+        char * real = realpath(line, NULL);
+        if (real != NULL)
+        {
+            Buffer_AppendStr(&keyed, real);
+            Buffer_Append(&keyed, "\n", 1);
+            free(real);
+        }
+    }
+    free(copy);
+    for (char * line = strtok(used.data, "\n"); line != NULL && ok; line = strtok(NULL, "\n"))
+    {
+        char * real = realpath(line, NULL);
+        size_t len = real != NULL ? strlen(real) : 0;
+        char * entry = NULL;
+        if (real != NULL)
+        {
+            entry = malloc(len + 3);
+            sprintf(entry, "\n%s\n", real);
+        }
+        if (entry == NULL || strstr(keyed.data, entry) == NULL)
+        {
+            if (sVerbose)
+            {
+                fprintf(stderr, "mwcache: %s read %s, which the key does not cover\n", inv->srcPath, line);
+            }
+            ok = 0;
+        }
+        free(entry);
+        free(real);
+    }
+    free(dep.data);
+    free(used.data);
+    free(keyed.data);
+    return ok;
+}
+
+// Whether the entry for key holds exactly what the compiler just wrote
+static int MatchesEntry(const Invocation * inv, const char * key)
+{
+    char path[4096];
+    Buffer cached = { 0 }, fresh = { 0 };
+    int ok;
+
+    EntryPath(path, sizeof(path), key, ".o");
+    ok = ReadWholeFile(path, &cached) && ReadWholeFile(inv->objPath, &fresh)
+        && cached.size == fresh.size && memcmp(cached.data, fresh.data, cached.size) == 0;
+    if (ok && inv->depPath != NULL)
+    {
+        EntryPath(path, sizeof(path), key, ".d");
+        ok = ReadWholeFile(path, &cached) && ReadGenericDepFile(inv, &fresh)
+            && strcmp(cached.data, fresh.data) == 0;
+    }
+    free(cached.data);
+    free(fresh.data);
+    return ok;
+}
+
+static int HasEntry(const char * key)
+{
+    char path[4096];
+
+    EntryPath(path, sizeof(path), key, ".o");
+    return access(path, F_OK) == 0;
+}
+
+// Compiles anyway on a hit and compares, to catch a key that missed an input
+static int CompileAndVerify(const Invocation * inv, const char * key)
+{
+    int ret = RunCommand(inv->argv, NULL);
+
+    if (ret != 0)
+    {
+        return ret < 0 ? EXIT_FAILURE : ret;
+    }
+    if (!MatchesEntry(inv, key))
+    {
+        fprintf(stderr, "mwcache: stale entry %s for %s\n", key, inv->srcPath);
+        return EXIT_FAILURE;
+    }
+    CountStat(0);
+    return EXIT_SUCCESS;
+}
+
+static void Store(const Invocation * inv, const char * key)
+{
+    char path[4096];
+    Buffer obj = { 0 }, generic = { 0 };
+
+    if (!ReadWholeFile(inv->objPath, &obj))
+    {
+        return;
+    }
+    if (inv->depPath != NULL && !ReadGenericDepFile(inv, &generic))
+    {
+        goto done; // cannot be relocated, so don't cache it
+    }
+
+    EntryPath(path, sizeof(path), key, "");
+    *strrchr(path, '/') = '\0';
+    MakeDirs(path);
+    if (inv->depPath != NULL)
+    {
+        EntryPath(path, sizeof(path), key, ".d");
+        if (!WriteFileAtomic(path, generic.data, generic.size))
+        {
+            goto done;
+        }
+    }
+    // The object goes last: its presence marks the entry complete
+    EntryPath(path, sizeof(path), key, ".o");
+    if (WriteFileAtomic(path, obj.data, obj.size))
+    {
+        AddStoredBytes(obj.size + generic.size);
+    }
+
+done:
+    free(obj.data);
+    free(generic.data);
+}
+
+static int CompileCached(const Invocation * inv)
+{
+    char compilerHash[2 * SHA256_DIGEST_SIZE + 1];
+    char key[2 * SHA256_DIGEST_SIZE + 1];
+    char baseKey[2 * SHA256_DIGEST_SIZE + 1];
+    char path[4096];
+    Buffer manifest = { 0 };
+    int haveKey = 0;
+    int ret;
+
+    if (!HashFile(inv->argv[inv->compilerIdx], compilerHash))
+    {
+        CountStat(2);
+        ExecCommand(inv->argv);
+    }
+
+    if (!inv->isAssembler)
+    {
+        if (!ComputeCKey(inv, compilerHash, key, &manifest))
+        {
+            CountStat(2);
+            ExecCommand(inv->argv);
+        }
+        haveKey = 1;
+    }
+    else
+    {
+        if (!ComputeAsmBaseKey(inv, compilerHash, baseKey))
+        {
+            CountStat(2);
+            ExecCommand(inv->argv);
+        }
+        EntryPath(path, sizeof(path), baseKey, ".manifest");
+        if (ReadWholeFile(path, &manifest))
+        {
+            haveKey = ManifestKey(baseKey, manifest.data, key);
+        }
+    }
+
+    if (haveKey && sVerify && HasEntry(key))
+    {
+        free(manifest.data);
+        return CompileAndVerify(inv, key);
+    }
+    if (haveKey && TryRestore(inv, key))
+    {
+        if (inv->isAssembler)
+        {
+            TouchEntry(baseKey, ".manifest");
+        }
+        if (sVerbose)
+        {
+            fprintf(stderr, "mwcache: hit %s\n", inv->srcPath);
+        }
+        CountStat(0);
+        free(manifest.data);
+        return EXIT_SUCCESS;
+    }
+
+    if (sVerbose)
+    {
+        fprintf(stderr, "mwcache: miss %s\n", inv->srcPath);
+    }
+    CountStat(1);
+    ret = RunCommand(inv->argv, NULL);
+    if (ret != 0)
+    {
+        free(manifest.data);
+        return ret < 0 ? EXIT_FAILURE : ret;
+    }
+
+    if (inv->isAssembler)
+    {
+        Buffer dep = { 0 };
+        if (!ReadWholeFile(inv->depPath, &dep) || !ParseDepFile(dep.data, &manifest)
+            || !ManifestKey(baseKey, manifest.data, key))
+        {
+            free(dep.data);
+            free(manifest.data);
+            return EXIT_SUCCESS;
+        }
+        free(dep.data);
+        EntryPath(path, sizeof(path), baseKey, "");
+        *strrchr(path, '/') = '\0';
+        MakeDirs(path);
+        EntryPath(path, sizeof(path), baseKey, ".manifest");
+        if (WriteFileAtomic(path, manifest.data, manifest.size))
+        {
+            AddStoredBytes(manifest.size);
+        }
+    }
+    else if (!CheckKeyCoversDeps(inv, manifest.data))
+    {
+        CountStat(2);
+        free(manifest.data);
+        return EXIT_SUCCESS;
+    }
+    Store(inv, key);
+    free(manifest.data);
+    return EXIT_SUCCESS;
+}
+
+// Parses MWCACHE_MAXSIZE
+static unsigned long long ParseSize(const char * str)
+{
+    char * end;
+    unsigned long long size;
+
+    if (str == NULL || str[0] == '\0')
+    {
+        return DEFAULT_MAX_SIZE;
+    }
+    size = strtoull(str, &end, 10);
+    switch (*end)
+    {
+    case 'G':
+    case 'g':
+        size <<= 10;
+        // fallthrough
+    case 'M':
+    case 'm':
+        size <<= 10;
+        // fallthrough
+    case 'K':
+    case 'k':
+        size <<= 10;
+        end++;
+        break;
+    }
+    if (end == str || *end != '\0')
+    {
+        fatal_error("bad MWCACHE_MAXSIZE %s", str);
+    }
+    return size;
+}
+
+static noreturn void Usage(void)
+{
+    fputs("Usage: mwcache [wine] mwccarm.exe|mwasmarm.exe ARGS...\n"
+          "       mwcache --stats | --zero-stats | --clear\n"
+          "\n"
+          "Environment:\n"
+          "  MWCACHE_DIR       cache location (default: ~/.cache/pokeheartgold-mwcache)\n"
+          "  MWCACHE_MAXSIZE   size the cache is pruned back from, least recently used\n"
+          "                    first: bytes, or with a K, M or G suffix; 0 for no limit\n"
+          "                    (default: 1G)\n"
+          "  MWCACHE_DISABLE   run the command without caching\n"
+          "  MWCACHE_VERBOSE   report hits and misses on stderr\n"
+          "  MWCACHE_VERIFY    compile on a hit as well, and fail if the entry differs\n",
+          stderr);
+    exit(EXIT_FAILURE);
+}
+
+int main(int argc, char ** argv)
+{
+    static char defaultDir[4096];
+    Invocation inv;
+
+    if (argc < 2)
+    {
+        Usage();
+    }
+
+    sCacheDir = getenv("MWCACHE_DIR");
+    if (sCacheDir == NULL || sCacheDir[0] == '\0')
+    {
+        const char * home = getenv("HOME");
+        snprintf(defaultDir, sizeof(defaultDir), "%s/.cache/pokeheartgold-mwcache", home != NULL ? home : ".");
+        sCacheDir = defaultDir;
+    }
+    sVerbose = getenv("MWCACHE_VERBOSE") != NULL;
+    sMaxSize = ParseSize(getenv("MWCACHE_MAXSIZE"));
+    sVerify = getenv("MWCACHE_VERIFY") != NULL;
+
+    if (strcmp(argv[1], "--stats") == 0)
+    {
+        PrintStats();
+        return EXIT_SUCCESS;
+    }
+    if (strcmp(argv[1], "--zero-stats") == 0)
+    {
+        Stats stats;
+        FILE * file;
+
+        MakeDirs(sCacheDir);
+        file = LockStats(&stats);
+        if (file != NULL)
+        {
+            stats.hits = stats.misses = stats.uncacheable = 0;
+            UnlockStats(file, &stats);
+        }
+        return EXIT_SUCCESS;
+    }
+    if (strcmp(argv[1], "--clear") == 0)
+    {
+        nftw(sCacheDir, RemoveEntry, 16, FTW_DEPTH | FTW_PHYS);
+        return EXIT_SUCCESS;
+    }
+    if (argv[1][0] == '-' && argv[1][1] == '-')
+    {
+        Usage();
+    }
+
+    if (getenv("MWCACHE_DISABLE") != NULL || !ParseInvocation(argc - 1, argv + 1, &inv))
+    {
+        ExecCommand(argv + 1);
+    }
+    MakeDirs(sCacheDir);
+    return CompileCached(&inv);
+}
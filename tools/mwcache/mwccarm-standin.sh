@@ -0,0 +1,54 @@
+#!/usr/bin/env bash
+
+# Stands in for mwccarm.exe in check.sh and bench.sh, which cannot assume
+# Wine and the real compiler. Its object is its options plus its preprocessed
+# output, so any change to what it reads changes the object. It parts from the
+# host cpp that mwcache keys on the way mwcc does: it predefines __CWCC__ and
+# understands __option(), and it searches the system paths in MWCIncludes
+# before the -i paths for #include <...>. Its dependency file has backslashes
+# and CRLF line endings, as mwcc's does under Wine.
+
+OBJ=
+SRC=
+DEP=0
+USER_DIRS=()
+OPTIONS=()
+CPP_ARGS=()
+
+while [ $# -gt 0 ]; do
+  case "$1" in
+    -o) OBJ="$2"; shift ;;
+    -MD) DEP=1 ;;
+    -gccdep) ;;
+    -i|-I) USER_DIRS+=("$2"); shift ;;
+    -I*) USER_DIRS+=("${1#-I}") ;;
+    -D|-U|-include) CPP_ARGS+=("$1" "$2"); shift ;;
+    -prefix) CPP_ARGS+=(-include "$2"); shift ;;
+    -D*|-U*) CPP_ARGS+=("$1") ;;
+    -*) OPTIONS+=("$1") ;;
+    *) SRC="$1" ;;
+  esac
+  shift
+done
+
+QUOTE_DIRS=()
+ANGLE_DIRS=()
+IFS=':;' read -r -a SYS_DIRS <<< "$MWCIncludes"
+for dir in "${USER_DIRS[@]}"; do
+  QUOTE_DIRS+=(-iquote "$dir")
+done
+for dir in "${SYS_DIRS[@]}" "${USER_DIRS[@]}"; do
+  ANGLE_DIRS+=(-I "$dir")
+done
+
+DEPTMP="${OBJ}.standin.d"
+{
+  printf '%s\n' "${OPTIONS[*]}"
+  cpp -undef -nostdinc -std=gnu99 -D__MWERKS__=0x2020 -D__CWCC__ -D__arm '-D__option(x)=1' \
+    "${QUOTE_DIRS[@]}" "${ANGLE_DIRS[@]}" "${CPP_ARGS[@]}" -MD -MF "$DEPTMP" -MT "$OBJ" "$SRC"
+} > "$OBJ" || { rm -f "$OBJ" "$DEPTMP"; exit 1; }
+
+if [ $DEP = 1 ]; then
+  sed -e 's#/#\\#g' -e 's/$/\r/' "$DEPTMP" > "${OBJ%.o}.d"
+fi
+rm -f "$DEPTMP"
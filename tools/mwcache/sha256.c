@@ -0,0 +1,110 @@
+#include <string.h>
+#include "sha256.h"
+
+static const uint32_t sRoundConstants[64] = {
+    0x428A2F98, 0x71374491, 0xB5C0FBCF, 0xE9B5DBA5, 0x3956C25B, 0x59F111F1, 0x923F82A4, 0xAB1C5ED5,
+    0xD807AA98, 0x12835B01, 0x243185BE, 0x550C7DC3, 0x72BE5D74, 0x80DEB1FE, 0x9BDC06A7, 0xC19BF174,
+    0xE49B69C1, 0xEFBE4786, 0x0FC19DC6, 0x240CA1CC, 0x2DE92C6F, 0x4A7484AA, 0x5CB0A9DC, 0x76F988DA,
+    0x983E5152, 0xA831C66D, 0xB00327C8, 0xBF597FC7, 0xC6E00BF3, 0xD5A79147, 0x06CA6351, 0x14292967,
+    0x27B70A85, 0x2E1B2138, 0x4D2C6DFC, 0x53380D13, 0x650A7354, 0x766A0ABB, 0x81C2C92E, 0x92722C85,
+    0xA2BFE8A1, 0xA81A664B, 0xC24B8B70, 0xC76C51A3, 0xD192E819, 0xD6990624, 0xF40E3585, 0x106AA070,
+    0x19A4C116, 0x1E376C08, 0x2748774C, 0x34B0BCB5, 0x391C0CB3, 0x4ED8AA4A, 0x5B9CCA4F, 0x682E6FF3,
+    0x748F82EE, 0x78A5636F, 0x84C87814, 0x8CC70208, 0x90BEFFFA, 0xA4506CEB, 0xBEF9A3F7, 0xC67178F2,
+};
+
+static inline uint32_t Ror(uint32_t x, int n)
+{
+    return (x >> n) | (x << (32 - n));
+}
+
+static void Sha256_Block(Sha256 * ctx, const uint8_t * p)
+{
+    uint32_t w[64];
+    uint32_t a, b, c, d, e, f, g, h;
+
+    for (int i = 0; i < 16; i++)
+    {
+        w[i] = ((uint32_t)p[4 * i] << 24) | ((uint32_t)p[4 * i + 1] << 16) | ((uint32_t)p[4 * i + 2] << 8) | p[4 * i + 3];
+    }
+    for (int i = 16; i < 64; i++)
+    {
+        uint32_t s0 = Ror(w[i - 15], 7) ^ Ror(w[i - 15], 18) ^ (w[i - 15] >> 3);
+        uint32_t s1 = Ror(w[i - 2], 17) ^ Ror(w[i - 2], 19) ^ (w[i - 2] >> 10);
+        w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+    }
+
+    a = ctx->state[0]; b = ctx->state[1]; c = ctx->state[2]; d = ctx->state[3];
+    e = ctx->state[4]; f = ctx->state[5]; g = ctx->state[6]; h = ctx->state[7];
+    for (int i = 0; i < 64; i++)
+    {
+        uint32_t t1 = h + (Ror(e, 6) ^ Ror(e, 11) ^ Ror(e, 25)) + ((e & f) ^ (~e & g)) + sRoundConstants[i] + w[i];
+        uint32_t t2 = (Ror(a, 2) ^ Ror(a, 13) ^ Ror(a, 22)) + ((a & b) ^ (a & c) ^ (b & c));
+        h = g; g = f; f = e; e = d + t1;
+        d = c; c = b; b = a; a = t1 + t2;
+    }
+    ctx->state[0] += a; ctx->state[1] += b; ctx->state[2] += c; ctx->state[3] += d;
+    ctx->state[4] += e; ctx->state[5] += f; ctx->state[6] += g; ctx->state[7] += h;
+}
+
+void Sha256_Init(Sha256 * ctx)
+{
+    static const uint32_t sInitialState[8] = {
+        0x6A09E667, 0xBB67AE85, 0x3C6EF372, 0xA54FF53A, 0x510E527F, 0x9B05688C, 0x1F83D9AB, 0x5BE0CD19,
+    };
+    memcpy(ctx->state, sInitialState, sizeof(sInitialState));
+    ctx->length = 0;
+    ctx->blockLen = 0;
+}
+
+void Sha256_Update(Sha256 * ctx, const void * data, size_t size)
+{
+    const uint8_t * p = data;
+
+    ctx->length += size;
+    if (ctx->blockLen != 0)
+    {
+        size_t n = 64 - ctx->blockLen < size ? 64 - ctx->blockLen : size;
+        memcpy(ctx->block + ctx->blockLen, p, n);
+        ctx->blockLen += n;
+        p += n;
+        size -= n;
+        if (ctx->blockLen < 64)
+        {
+            return;
+        }
+        Sha256_Block(ctx, ctx->block);
+        ctx->blockLen = 0;
+    }
+    for (; size >= 64; p += 64, size -= 64)
+    {
+        Sha256_Block(ctx, p);
+    }
+    memcpy(ctx->block, p, size);
+    ctx->blockLen = size;
+}
+
+void Sha256_Final(Sha256 * ctx, uint8_t * digest)
+{
+    uint64_t bits = ctx->length * 8;
+    uint8_t pad = 0x80;
+    uint8_t lenBytes[8];
+
+    Sha256_Update(ctx, &pad, 1);
+    pad = 0;
+    while (ctx->blockLen != 56)
+    {
+        Sha256_Update(ctx, &pad, 1);
+    }
+    for (int i = 0; i < 8; i++)
+    {
+        lenBytes[i] = bits >> (56 - 8 * i);
+    }
+    Sha256_Update(ctx, lenBytes, 8);
+    for (int i = 0; i < 8; i++)
+    {
+        digest[4 * i] = ctx->state[i] >> 24;
+        digest[4 * i + 1] = ctx->state[i] >> 16;
+        digest[4 * i + 2] = ctx->state[i] >> 8;
+        digest[4 * i + 3] = ctx->state[i];
+    }
+}
@@ -0,0 +1,21 @@
+#ifndef GUARD_MWCACHE_SHA256_H
+#define GUARD_MWCACHE_SHA256_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define SHA256_DIGEST_SIZE 32
+
+typedef struct Sha256
+{
+    uint32_t state[8];
+    uint64_t length;
+    uint8_t block[64];
+    size_t blockLen;
+} Sha256;
+
+void Sha256_Init(Sha256 * ctx);
+void Sha256_Update(Sha256 * ctx, const void * data, size_t size);
+void Sha256_Final(Sha256 * ctx, uint8_t * digest);
+
+#endif //GUARD_MWCACHE_SHA256_H
@@ -8,6 +8,7 @@
 #include "global.h"
 #include "gfx.h"
 #include "util.h"
+#include "swizzle.h"
 
 #define GET_GBA_PAL_RED(x)   (((x) >>  0) & 0x1F)
 #define GET_GBA_PAL_GREEN(x) (((x) >>  5) & 0x1F)
@@ -36,6 +37,47 @@ static void AdvanceMetatilePosition(int *subTileX, int *subTileY, int *metatileX
 	}
 }
 
+// Tiles are stored metatile by metatile, and each row of sub-tiles within a
+// metatile is a run of horizontally adjacent tiles. With metatiles one tile
+// high, a run is a whole row of the image.
+struct TileRunIterator {
+	int metatilesWide;
+	int metatileWidth;
+	int metatileHeight;
+	int remaining;
+	int metatileX;
+	int metatileY;
+	int subTileY;
+};
+
+static bool NextTileRun(struct TileRunIterator *it, int *tileX, int *tileY, int *count)
+{
+	if (it->remaining <= 0)
+		return false;
+
+	int runLength = it->metatileWidth;
+
+	if (it->metatileHeight == 1)
+		runLength *= it->metatilesWide;
+
+	*tileX = it->metatileX * it->metatileWidth;
+	*tileY = it->metatileY * it->metatileHeight + it->subTileY;
+	*count = runLength < it->remaining ? runLength : it->remaining;
+	it->remaining -= *count;
+
+	if (it->metatileHeight == 1) {
+		it->metatileY++;
+	} else if (++it->subTileY == it->metatileHeight) {
+		it->subTileY = 0;
+		if (++it->metatileX == it->metatilesWide) {
+			it->metatileX = 0;
+			it->metatileY++;
+		}
+	}
+
+	return true;
+}
+
 static void ConvertFromTiles1Bpp(unsigned char *src, unsigned char *dest, int numTiles, int metatilesWide, int metatileWidth, int metatileHeight, bool invertColors)
 {
 	int subTileX = 0;
@@ -64,32 +106,13 @@ static void ConvertFromTiles1Bpp(unsigned char *src, unsigned char *dest, int nu
 
 static void ConvertFromTiles4Bpp(unsigned char *src, unsigned char *dest, int numTiles, int metatilesWide, int metatileWidth, int metatileHeight, bool invertColors)
 {
-	int subTileX = 0;
-	int subTileY = 0;
-	int metatileX = 0;
-	int metatileY = 0;
+	struct TileRunIterator it = { metatilesWide, metatileWidth, metatileHeight, numTiles, 0, 0, 0 };
 	int pitch = (metatilesWide * metatileWidth) * 4;
+	int tileX, tileY, count;
 
-	for (int i = 0; i < numTiles; i++) {
-		for (int j = 0; j < 8; j++) {
-			int destY = (metatileY * metatileHeight + subTileY) * 8 + j;
-
-			for (int k = 0; k < 4; k++) {
-				int destX = (metatileX * metatileWidth + subTileX) * 4 + k;
-				unsigned char srcPixelPair = *src++;
-				unsigned char leftPixel = srcPixelPair & 0xF;
-				unsigned char rightPixel = srcPixelPair >> 4;
-
-				if (invertColors) {
-					leftPixel = 15 - leftPixel;
-					rightPixel = 15 - rightPixel;
-				}
-
-				dest[destY * pitch + destX] = (leftPixel << 4) | rightPixel;
-			}
-		}
-
-		AdvanceMetatilePosition(&subTileX, &subTileY, &metatileX, &metatileY, metatilesWide, metatileWidth, metatileHeight);
+	while (NextTileRun(&it, &tileX, &tileY, &count)) {
+		TilesToLinear4Bpp(src, &dest[tileY * 8 * pitch + tileX * 4], pitch, count, invertColors);
+		src += count * 32;
 	}
 }
 
@@ -98,67 +121,24 @@ static uint32_t ConvertFromScanned4Bpp(unsigned char *src, unsigned char *dest,
     uint32_t encValue = 0;
     if (scanFrontToBack) {
         encValue = (src[1] << 8) | src[0];
-        for (int i = 0; i < fileSize; i += 2)
-        {
-            uint16_t val = src[i] | (src[i + 1] << 8);
-            val ^= (encValue & 0xFFFF);
-            src[i] = val;
-            src[i + 1] = val >> 8;
-            encValue = encValue * 1103515245;
-            encValue = encValue + 24691;
-        }
+        encValue = XorLcgKeystream(src, fileSize / 2, encValue, 1103515245, 24691, false);
     } else {
         encValue = (src[fileSize - 1] << 8) | src[fileSize - 2];
-        for (int i = fileSize; i > 0; i -= 2)
-        {
-            uint16_t val = (src[i - 1] << 8) | src[i - 2];
-            val ^= (encValue & 0xFFFF);
-            src[i - 1] = (val >> 8);
-            src[i - 2] = val;
-            encValue = encValue * 1103515245;
-            encValue = encValue + 24691;
-        }
-    }
-    for (int i = 0; i < fileSize; i++)
-    {
-        unsigned char srcPixelPair = src[i];
-        unsigned char leftPixel = srcPixelPair & 0xF;
-        unsigned char rightPixel = srcPixelPair >> 4;
-
-        if (invertColours) {
-            leftPixel = 15 - leftPixel;
-            rightPixel = 15 - rightPixel;
-        }
-
-        dest[i] = (leftPixel << 4) | rightPixel;
+        encValue = XorLcgKeystream(src + (fileSize & 1), fileSize / 2, encValue, 1103515245, 24691, true);
     }
+    SwapPixelPairs(src, dest, fileSize, invertColours);
     return encValue;
 }
 
 static void ConvertFromTiles8Bpp(unsigned char *src, unsigned char *dest, int numTiles, int metatilesWide, int metatileWidth, int metatileHeight, bool invertColors)
 {
-	int subTileX = 0;
-	int subTileY = 0;
-	int metatileX = 0;
-	int metatileY = 0;
+	struct TileRunIterator it = { metatilesWide, metatileWidth, metatileHeight, numTiles, 0, 0, 0 };
 	int pitch = (metatilesWide * metatileWidth) * 8;
+	int tileX, tileY, count;
 
-	for (int i = 0; i < numTiles; i++) {
-		for (int j = 0; j < 8; j++) {
-			int destY = (metatileY * metatileHeight + subTileY) * 8 + j;
-
-			for (int k = 0; k < 8; k++) {
-				int destX = (metatileX * metatileWidth + subTileX) * 8 + k;
-				unsigned char srcPixel = *src++;
-
-				if (invertColors)
-					srcPixel = 255 - srcPixel;
-
-				dest[destY * pitch + destX] = srcPixel;
-			}
-		}
-
-		AdvanceMetatilePosition(&subTileX, &subTileY, &metatileX, &metatileY, metatilesWide, metatileWidth, metatileHeight);
+	while (NextTileRun(&it, &tileX, &tileY, &count)) {
+		TilesToLinear8Bpp(src, &dest[tileY * 8 * pitch + tileX * 8], pitch, count, invertColors);
+		src += count * 64;
 	}
 }
 
@@ -190,95 +170,42 @@ static void ConvertToTiles1Bpp(unsigned char *src, unsigned char *dest, int numT
 
 static void ConvertToTiles4Bpp(unsigned char *src, unsigned char *dest, int numTiles, int metatilesWide, int metatileWidth, int metatileHeight, bool invertColors)
 {
-	int subTileX = 0;
-	int subTileY = 0;
-	int metatileX = 0;
-	int metatileY = 0;
+	struct TileRunIterator it = { metatilesWide, metatileWidth, metatileHeight, numTiles, 0, 0, 0 };
 	int pitch = (metatilesWide * metatileWidth) * 4;
+	int tileX, tileY, count;
 
-	for (int i = 0; i < numTiles; i++) {
-		for (int j = 0; j < 8; j++) {
-			int srcY = (metatileY * metatileHeight + subTileY) * 8 + j;
-
-			for (int k = 0; k < 4; k++) {
-				int srcX = (metatileX * metatileWidth + subTileX) * 4 + k;
-				unsigned char srcPixelPair = src[srcY * pitch + srcX];
-				unsigned char leftPixel = srcPixelPair >> 4;
-				unsigned char rightPixel = srcPixelPair & 0xF;
-
-				if (invertColors) {
-					leftPixel = 15 - leftPixel;
-					rightPixel = 15 - rightPixel;
-				}
-
-				*dest++ = (rightPixel << 4) | leftPixel;
-			}
-		}
-
-		AdvanceMetatilePosition(&subTileX, &subTileY, &metatileX, &metatileY, metatilesWide, metatileWidth, metatileHeight);
+	while (NextTileRun(&it, &tileX, &tileY, &count)) {
+		LinearToTiles4Bpp(&src[tileY * 8 * pitch + tileX * 4], pitch, dest, count, invertColors);
+		dest += count * 32;
 	}
 }
 
 static void ConvertToScanned4Bpp(unsigned char *src, unsigned char *dest, int fileSize, bool invertColours, uint32_t encValue, uint32_t scanMode)
 {
-    for (int i = 0; i < fileSize; i++)
-    {
-        unsigned char srcPixelPair = src[i];
-        unsigned char leftPixel = srcPixelPair & 0xF;
-        unsigned char rightPixel = srcPixelPair >> 4;
-        if (invertColours) {
-            leftPixel = 15 - leftPixel;
-            rightPixel = 15 - rightPixel;
-        }
-        dest[i] = (leftPixel << 4) | rightPixel;
-    }
+    // Encoding runs the decoder's LCG backwards, starting one step before the key
+    uint32_t mul = 4005161829u;
+    uint32_t add = 0u - 24691u * 4005161829u;
+
+    SwapPixelPairs(src, dest, fileSize, invertColours);
+    encValue = encValue * mul + add;
 
     if (scanMode == 2) { // front to back
-        for (int i = fileSize - 1; i > 0; i -= 2)
-        {
-            uint16_t val = dest[i - 1] | (dest[i] << 8);
-            encValue = (encValue - 24691) * 4005161829;
-            val ^= (encValue & 0xFFFF);
-            dest[i] = (val >> 8);
-            dest[i - 1] = val;
-        }
+        XorLcgKeystream(dest + (fileSize & 1), fileSize / 2, encValue, mul, add, true);
     }
     else if (scanMode == 1) {
-        for (int i = 1; i < fileSize; i += 2)
-        {
-            uint16_t val = (dest[i] << 8) | dest[i - 1];
-            encValue = (encValue - 24691) * 4005161829;
-            val ^= (encValue & 0xFFFF);
-            dest[i] = (val >> 8);
-            dest[i - 1] = val;
-        }
+        XorLcgKeystream(dest, fileSize / 2, encValue, mul, add, false);
     }
 }
 
 static void ConvertToTiles8Bpp(unsigned char *src, unsigned char *dest, int numTiles, int metatilesWide, int metatileWidth, int metatileHeight, bool invertColors)
 {
-	int subTileX = 0;
-	int subTileY = 0;
-	int metatileX = 0;
-	int metatileY = 0;
+	struct TileRunIterator it = { metatilesWide, metatileWidth, metatileHeight, numTiles, 0, 0, 0 };
 	int pitch = (metatilesWide * metatileWidth) * 8;
+	int tileX, tileY, count;
 
-	for (int i = 0; i < numTiles; i++) {
-		for (int j = 0; j < 8; j++) {
-			int srcY = (metatileY * metatileHeight + subTileY) * 8 + j;
-
-			for (int k = 0; k < 8; k++) {
-				int srcX = (metatileX * metatileWidth + subTileX) * 8 + k;
-				unsigned char srcPixel = src[srcY * pitch + srcX];
-
-				if (invertColors)
-					srcPixel = 255 - srcPixel;
-
-				*dest++ = srcPixel;
-			}
-		}
-
-		AdvanceMetatilePosition(&subTileX, &subTileY, &metatileX, &metatileY, metatilesWide, metatileWidth, metatileHeight);
+	while (NextTileRun(&it, &tileX, &tileY, &count)) {
+		LinearToTiles8Bpp(&src[tileY * 8 * pitch + tileX * 8], pitch, dest, count, invertColors);
+		dest += count * 64;
 	}
 }
 
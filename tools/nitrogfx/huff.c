@@ -6,150 +6,98 @@
 #include "global.h"
 #include "huff.h"
 
+// Number of bits the decoder looks up at once, and how many symbols one
+// lookup can produce.
+#define HUFF_LOOKUP_BITS 11
+#define HUFF_LOOKUP_MAX_SYMBOLS 8
+
 static int cmp_tree(const void * a0, const void * b0) {
-    return ((struct HuffData *)a0)->value - ((struct HuffData *)b0)->value;
-}
+    const struct HuffLeaf * a = a0;
+    const struct HuffLeaf * b = b0;
 
-typedef int (*cmpfun)(const void *, const void *);
+    // Ties go to the lower key, which is the order the leaves start in.
+    if (a->header.value != b->header.value)
+        return a->header.value < b->header.value ? -1 : 1;
+    return a->key - b->key;
+}
 
-int msort_r(void * data, size_t count, size_t size, cmpfun cmp, void * buffer) {
+static void build_tree(HuffNode_t * leaves, int nitems, HuffNode_t * tree, HuffNode_t * merged) {
     /*
-     * Out-of-place mergesort (stable sort)
-     * Returns 1 on success, 0 on failure
+     * Two-queue Huffman construction. The leaves are sorted by weight and the
+     * merged nodes come out in non-decreasing weight, so the lightest node is
+     * always at the head of one of the two queues. On equal weights a leaf is
+     * taken before a merged node, and merged nodes in the order they were
+     * made, which is what re-sorting the whole list stably after appending
+     * each merged node to it would give.
      */
-    void * leftPtr;
-    void * rightPtr;
-    void * leftEnd;
-    void * rightEnd;
-    int i;
-
-    switch (count) {
-    case 0:
-        // Should never be here
-        return 0;
-
-    case 1:
-        // Nothing to do here
-        break;
-
-    case 2:
-        // Swap the two entries if the right one compares higher.
-        if (cmp(data, data + size) > 0) {
-            memcpy(buffer, data, size);
-            memcpy(data, data + size, size);
-            memcpy(data + size, buffer, size);
-        }
-        break;
-    default:
-        // Merge sort out-of-place.
-        leftPtr = data;
-        leftEnd = rightPtr = data + count / 2 * size;
-        rightEnd = data + count * size;
-
-        // Sort the left half
-        if (!msort_r(leftPtr, count / 2, size, cmp, buffer))
-            return 0;
-
-        // Sort the right half
-        if (!msort_r(rightPtr, count / 2 + (count & 1), size, cmp, buffer))
-            return 0;
-
-        // Merge the sorted halves out of place
-        i = 0;
-        do {
-            if (cmp(leftPtr, rightPtr) <= 0) {
-                memcpy(buffer + i * size, leftPtr, size);
-                leftPtr += size;
-            } else {
-                memcpy(buffer + i * size, rightPtr, size);
-                rightPtr += size;
-            }
 
-        } while (++i < count && leftPtr < leftEnd && rightPtr < rightEnd);
+    int leafHead = 0;
+    int mergedHead = 0;
 
-        // Copy the remainder
-        if (i < count) {
-            if (leftPtr < leftEnd) {
-                memcpy(buffer + i * size, leftPtr, leftEnd - leftPtr);
-            }
-            else {
-                memcpy(buffer + i * size, rightPtr, rightEnd - rightPtr);
-            }
+    for (int i = 0; i < nitems - 1; i++) {
+        HuffNode_t * pick[2];
+
+        for (int j = 0; j < 2; j++) {
+            if (mergedHead == i
+             || (leafHead < nitems && leaves[leafHead].header.value <= merged[mergedHead].header.value))
+                pick[j] = &leaves[leafHead++];
+            else
+                pick[j] = &merged[mergedHead++];
         }
 
-        // Copy the merged data back
-        memcpy(data, buffer, count * size);
-        break;
+        // The heavier of the pair goes on the left.
+        tree[i * 2] = *pick[1];
+        tree[i * 2 + 1] = *pick[0];
+        merged[i].header.isLeaf = 0;
+        merged[i].header.value = pick[0]->header.value + pick[1]->header.value;
+        merged[i].branch.left = tree + i * 2;
+        merged[i].branch.right = tree + i * 2 + 1;
     }
-
-    return 1;
-}
-
-int msort(void * data, size_t count, size_t size, cmpfun cmp) {
-    void * buffer = malloc(count * size);
-    if (buffer == NULL) return 0;
-    int result = msort_r(data, count, size, cmp, buffer);
-    free(buffer);
-    return result;
 }
 
 static void write_tree(unsigned char * dest, HuffNode_t * tree, int nitems, struct BitEncoding * encoding) {
     /*
      * The example used to guide this function encodes the tree in a
-     * breadth-first manner.  We attempt to emulate that here.
+     * breadth-first manner, left child before right. The same queue gives
+     * each leaf's path from the root, which is its code.
      */
 
-    int i, j, k;
+    int head, i;
+    int nnodes = 2 * nitems - 1;
 
-    // There are (2 * nitems - 1) nodes in the binary tree.  Allocate that.
-    HuffNode_t * traversal = calloc(2 * nitems - 1, sizeof(HuffNode_t));
-    if (traversal == NULL)
+    HuffNode_t * traversal = calloc(nnodes, sizeof(HuffNode_t));
+    struct BitEncoding * paths = calloc(nnodes, sizeof(struct BitEncoding));
+    if (traversal == NULL || paths == NULL)
         FATAL_ERROR("Fatal error while compressing Huff file.\n");
 
     // The first node is the root of the tree.
     traversal[0] = *tree;
     i = 1;
 
-    // Copy the tree into a breadth-first ordering using brute force.
-    for (int depth = 1; i < 2 * nitems - 1; depth++) {
-        // Consider every possible path up to the current depth.
-        for (j = 0; i < 2 * nitems - 1 && j < 1 << depth; j++) {
-            // The index of the path is used to encode the path itself.
-            // Start from the most significant relevant bit and work our way down.
-            // Keep track of the current and previous nodes.
-            HuffNode_t * currNode = traversal;
-            HuffNode_t * parent = NULL;
-            for (k = 0; k < depth; k++) {
-                if (currNode->header.isLeaf)
-                    break;
-                parent = currNode;
-                if ((j >> (depth - k - 1)) & 1)
-                    currNode = currNode->branch.right;
-                else
-                    currNode = currNode->branch.left;
-            }
-            // Check that the length of the current path equals the current depth.
-            if (k == depth) {
-                // Make sure we can encode the current branch.
-                // Bail here if we cannot.
-                // This is only applicable for 8-bit encodings.
-                if (traversal + i - parent > 128)
-                    FATAL_ERROR("Fatal error while compressing Huff file: unable to encode binary tree.\n");
-                // Copy the current node, and update its parent.
-                traversal[i] = *currNode;
-                if (parent != NULL) {
-                    if ((j & 1) == 1)
-                        parent->branch.right = traversal + i;
-                    else
-                        parent->branch.left = traversal + i;
-                }
-                // Encode the path through the tree in the lookup table
-                if (traversal[i].header.isLeaf) {
-                    encoding[traversal[i].leaf.key].nbits = depth;
-                    encoding[traversal[i].leaf.key].bitstring = j;
-                }
-                i++;
-            }
+    for (head = 0; head < i; head++) {
+        HuffNode_t * currNode = traversal + head;
+
+        if (currNode->header.isLeaf) {
+            encoding[currNode->leaf.key] = paths[head];
+            continue;
+        }
+
+        // Branch offsets are stored in 6 bits, and codes are emitted through a
+        // 32-bit window.
+        if (i + 1 - head > 128 || paths[head].nbits >= 32)
+            FATAL_ERROR("Fatal error while compressing Huff file: unable to encode binary tree.\n");
+
+        for (int bit = 0; bit < 2; bit++) {
+            HuffNode_t * child = bit ? currNode->branch.right : currNode->branch.left;
+
+            if (bit)
+                currNode->branch.right = traversal + i;
+            else
+                currNode->branch.left = traversal + i;
+            traversal[i] = *child;
+            paths[i].nbits = paths[head].nbits + 1;
+            paths[i].bitstring = (paths[head].bitstring << 1) | bit;
+            i++;
         }
     }
 
@@ -158,7 +106,7 @@ static void write_tree(unsigned char * dest, HuffNode_t * tree, int nitems, stru
     dest[4] = nitems - 1;
 
     // Encode each node in the tree.
-    for (i = 0; i < 2 * nitems - 1; i++) {
+    for (i = 0; i < nnodes; i++) {
         HuffNode_t * currNode = traversal + i;
         if (currNode->header.isLeaf) {
             dest[5 + i] = traversal[i].leaf.key;
@@ -171,6 +119,7 @@ static void write_tree(unsigned char * dest, HuffNode_t * tree, int nitems, stru
         }
     }
 
+    free(paths);
     free(traversal);
 }
 
@@ -184,31 +133,42 @@ static inline void write_32_le(unsigned char * dest, int * destPos, uint32_t * b
     *buffPos = 0;
 }
 
-static inline void read_32_le(unsigned char * src, int * srcPos, uint32_t * buff) {
-    uint32_t tmp = src[*srcPos];
-    tmp |= src[*srcPos + 1] << 8;
-    tmp |= src[*srcPos + 2] << 16;
-    tmp |= src[*srcPos + 3] << 24;
-    *srcPos += 4;
-    *buff = tmp;
+static inline uint32_t read_32_le_bounded(const unsigned char * src, int srcPos, int srcSize) {
+    uint32_t tmp = 0;
+
+    for (int i = 0; i < 4 && srcPos + i < srcSize; i++)
+        tmp |= (uint32_t)src[srcPos + i] << (8 * i);
+    return tmp;
 }
 
-static void write_bits(unsigned char * dest, int * destPos, struct BitEncoding * encoding, int value, uint32_t * buff, int * buffBits) {
-    int nbits = encoding[value].nbits;
-    uint32_t bitstring = encoding[value].bitstring;
-
-    if (*buffBits + nbits >= 32) {
-        int diff = *buffBits + nbits - 32;
-        *buff <<= nbits - diff;
-        *buff |= bitstring >> diff;
-        bitstring &= ~(1 << diff);
-        nbits = diff;
-        write_32_le(dest, destPos, buff, buffBits);
+struct BitWriter {
+    unsigned char * dest;
+    int destPos;
+    uint64_t buff;      // pending bits, right-aligned
+    int buffBits;
+};
+
+static inline void bit_writer_put(struct BitWriter * w, uint32_t code, int nbits) {
+    w->buff = (w->buff << nbits) | code;
+    w->buffBits += nbits;
+    if (w->buffBits >= 32) {
+        int diff = w->buffBits - 32;
+        uint32_t word = w->buff >> diff;
+        int buffPos;
+
+        write_32_le(w->dest, &w->destPos, &word, &buffPos);
+        w->buff &= (1ULL << diff) - 1;
+        w->buffBits = diff;
     }
-    if (nbits != 0) {
-        *buff <<= nbits;
-        *buff |= bitstring;
-        *buffBits += nbits;
+}
+
+static void bit_writer_flush(struct BitWriter * w) {
+    // The decoder reads every word from its top bit, the final partial one too.
+    if (w->buffBits != 0) {
+        uint32_t word = w->buff << (32 - w->buffBits);
+        int buffPos;
+
+        write_32_le(w->dest, &w->destPos, &word, &buffPos);
     }
 }
 
@@ -262,16 +222,16 @@ unsigned char * HuffCompress(unsigned char * src, int srcSize, int * compressedS
 #endif // DEBUG
 
     // Sort the frequency table.
-    if (!msort(freqs, nitems, sizeof(HuffNode_t), cmp_tree))
-        goto fail;
+    qsort(freqs, nitems, sizeof(HuffNode_t), cmp_tree);
 
-    // Prune zero-frequency values.
+    // Prune zero-frequency values. The root must be a branch, so when only one
+    // value occurs an unused one is kept beside it to give it a 1-bit code.
     for (int i = 0; i < nitems; i++) {
         if (freqs[i].header.value != 0) {
+            if (i == nitems - 1)
+                i--;
             if (i > 0) {
-                for (int j = i; j < nitems; j++) {
-                    freqs[j - i] = freqs[j];
-                }
+                memmove(freqs, freqs + i, (nitems - i) * sizeof(HuffNode_t));
                 nitems -= i;
             }
             break;
@@ -282,51 +242,37 @@ unsigned char * HuffCompress(unsigned char * src, int srcSize, int * compressedS
     }
 
     HuffNode_t * tree = calloc(nitems * 2 - 1, sizeof(HuffNode_t));
-    if (tree == NULL)
+    HuffNode_t * merged = calloc(nitems, sizeof(HuffNode_t));
+    if (tree == NULL || merged == NULL)
         goto fail;
 
-    // Iteratively collapse the two least frequent nodes.
-    HuffNode_t * endptr = freqs + nitems - 2;
-
-    for (int i = 0; i < nitems - 1; i++) {
-        HuffNode_t * left = freqs;
-        HuffNode_t * right = freqs + 1;
-        tree[i * 2] = *right;
-        tree[i * 2 + 1] = *left;
-        for (int j = 0; j < nitems - i - 2; j++)
-            freqs[j] = freqs[j + 2];
-        endptr->header.isLeaf = 0;
-        endptr->header.value = tree[i * 2].header.value + tree[i * 2 + 1].header.value;
-        endptr->branch.left = tree + i * 2;
-        endptr->branch.right = tree + i * 2 + 1;
-        endptr--;
-        if (i < nitems - 2 && !msort(freqs, nitems - i - 1, sizeof(HuffNode_t), cmp_tree))
-            goto fail;
-    }
+    build_tree(freqs, nitems, tree, merged);
 
     // Write the tree breadth-first, and create the path lookup table.
-    write_tree(dest, freqs, nitems, encoding);
+    write_tree(dest, &merged[nitems - 2], nitems, encoding);
 
+    free(merged);
     free(tree);
     free(freqs);
 
-    // Encode the data itself.
-    int destPos = 4 + nitems * 2;
-    uint32_t destBuf = 0;
-    uint32_t srcBuf = 0;
-    int destBitPos = 0;
+    // Encode the data itself. Input past the end of a partial last word reads as zero.
+    struct BitWriter writer = { dest, 4 + nitems * 2, 0, 0 };
+    uint32_t symbolMask = 0xFF >> (8 - bitDepth);
 
-    for (int srcPos = 0; srcPos < srcSize;) {
-        read_32_le(src, &srcPos, &srcBuf);
+    for (int srcPos = 0; srcPos < srcSize; srcPos += 4) {
+        uint32_t srcBuf = read_32_le_bounded(src, srcPos, srcSize);
         for (int i = 0; i < 32 / bitDepth; i++) {
-            write_bits(dest, &destPos, encoding, srcBuf & (0xFF >> (8 - bitDepth)), &destBuf, &destBitPos);
+            struct BitEncoding code = encoding[srcBuf & symbolMask];
+            bit_writer_put(&writer, code.bitstring, code.nbits);
             srcBuf >>= bitDepth;
         }
     }
 
-    if (destBitPos != 0) {
-        write_32_le(dest, &destPos, &destBuf, &destBitPos);
-    }
+    bit_writer_flush(&writer);
+
+    // The tree can leave the stream two bytes short of word alignment.
+    int compressedSize = (writer.destPos + 3) & ~3;
+    memset(dest + writer.destPos, 0, compressedSize - writer.destPos);
 
     free(encoding);
 
@@ -335,13 +281,68 @@ unsigned char * HuffCompress(unsigned char * src, int srcSize, int * compressedS
     dest[1] = srcSize;
     dest[2] = srcSize >> 8;
     dest[3] = srcSize >> 16;
-    *compressedSize_p = (destPos + 3) & ~3;
+    *compressedSize_p = compressedSize;
     return dest;
 
 fail:
     FATAL_ERROR("Fatal error while compressing Huff file.\n");
 }
 
+// Takes one step down the tree from treePos along bit. Returns 1 and sets
+// *symbol on reaching a leaf (treePos goes back to the root), 0 on reaching
+// a branch, and -1 if the tree points outside the file.
+static inline int huff_step(const unsigned char * src, int srcSize, int * treePos, int bit, unsigned char * symbol) {
+    if (*treePos >= srcSize)
+        return -1;
+
+    unsigned char treeView = src[*treePos];
+    bool isLeaf = ((treeView << bit) & 0x80) != 0;
+    int next = (*treePos & ~1) + ((treeView & 0x3F) + 1) * 2 + bit;
+
+    if (next >= srcSize)
+        return -1;
+    if (isLeaf) {
+        *symbol = src[next];
+        *treePos = 5;
+        return 1;
+    }
+    *treePos = next;
+    return 0;
+}
+
+struct HuffLookup {
+    unsigned char nsymbols; // 0: the first code is longer than the lookup, walk it bit by bit
+    unsigned char nbits;
+    unsigned char symbols[HUFF_LOOKUP_MAX_SYMBOLS];
+};
+
+// For every HUFF_LOOKUP_BITS-bit pattern, decode as many whole codes from the
+// root as fit.
+static struct HuffLookup * build_lookup(const unsigned char * src, int srcSize) {
+    struct HuffLookup * table = calloc(1 << HUFF_LOOKUP_BITS, sizeof(struct HuffLookup));
+    if (table == NULL)
+        return NULL;
+
+    for (int pattern = 0; pattern < 1 << HUFF_LOOKUP_BITS; pattern++) {
+        struct HuffLookup * entry = &table[pattern];
+        int treePos = 5;
+
+        for (int i = 0; i < HUFF_LOOKUP_BITS && entry->nsymbols < HUFF_LOOKUP_MAX_SYMBOLS; i++) {
+            int bit = (pattern >> (HUFF_LOOKUP_BITS - 1 - i)) & 1;
+            int result = huff_step(src, srcSize, &treePos, bit, &entry->symbols[entry->nsymbols]);
+
+            if (result < 0)
+                break;
+            if (result > 0) {
+                entry->nsymbols++;
+                entry->nbits = i + 1;
+            }
+        }
+    }
+
+    return table;
+}
+
 unsigned char * HuffDecompress(unsigned char * src, int srcSize, int * uncompressedSize_p) {
     if (srcSize < 4)
         goto fail;
@@ -352,44 +353,75 @@ unsigned char * HuffDecompress(unsigned char * src, int srcSize, int * uncompres
 
     int destSize = (src[3] << 16) | (src[2] << 8) | src[1];
 
+    // Output is produced a word at a time and must end exactly on destSize.
+    if (destSize == 0 || (destSize & 3) != 0)
+        goto fail;
+
     unsigned char *dest = malloc(destSize);
 
     if (dest == NULL)
         goto fail;
 
-    int treePos = 5;
+    struct HuffLookup * table = build_lookup(src, srcSize);
+
+    if (table == NULL)
+        goto fail;
+
     int treeSize = (src[4] + 1) * 2;
     int srcPos = 4 + treeSize;
     int destPos = 0;
     int curValPos = 0;
     uint32_t destTmp = 0;
-    uint32_t window;
+    uint64_t window = 0; // left-aligned
+    int windowBits = 0;
 
     for (;;)
     {
-        if (srcPos >= srcSize)
-            goto fail;
-        read_32_le(src, &srcPos, &window);
-        for (int i = 0; i < 32; i++) {
-            int curBit = (window >> 31) & 1;
-            unsigned char treeView = src[treePos];
-            bool isLeaf = ((treeView << curBit) & 0x80) != 0;
-            treePos &= ~1; // align
-            treePos += ((treeView & 0x3F) + 1) * 2 + curBit;
-            if (isLeaf) {
-                destTmp >>= bitDepth;
-                destTmp |= (src[treePos] << (32 - bitDepth));
-                curValPos++;
-                if (curValPos == 32 / bitDepth) {
-                    write_32_le(dest, &destPos, &destTmp, &curValPos);
-                    if (destPos == destSize) {
-                        *uncompressedSize_p = destSize;
-                        return dest;
-                    }
+        // Words are read only once they are within reach, and running out is
+        // only an error once a bit is actually needed.
+        while (windowBits <= 32 && srcPos < srcSize) {
+            window |= (uint64_t)read_32_le_bounded(src, srcPos, srcSize) << (32 - windowBits);
+            windowBits += 32;
+            srcPos += 4;
+        }
+
+        unsigned char symbols[HUFF_LOOKUP_MAX_SYMBOLS];
+        int nsymbols = 0;
+        const struct HuffLookup * entry = &table[window >> (64 - HUFF_LOOKUP_BITS)];
+
+        if (windowBits >= HUFF_LOOKUP_BITS && entry->nsymbols != 0) {
+            memcpy(symbols, entry->symbols, entry->nsymbols);
+            nsymbols = entry->nsymbols;
+            window <<= entry->nbits;
+            windowBits -= entry->nbits;
+        } else {
+            int treePos = 5;
+            int result;
+
+            do {
+                if (windowBits == 0)
+                    goto fail;
+                result = huff_step(src, srcSize, &treePos, window >> 63, &symbols[0]);
+                if (result < 0)
+                    goto fail;
+                window <<= 1;
+                windowBits--;
+            } while (result == 0);
+            nsymbols = 1;
+        }
+
+        for (int i = 0; i < nsymbols; i++) {
+            destTmp >>= bitDepth;
+            destTmp |= (uint32_t)symbols[i] << (32 - bitDepth);
+            curValPos++;
+            if (curValPos == 32 / bitDepth) {
+                write_32_le(dest, &destPos, &destTmp, &curValPos);
+                if (destPos == destSize) {
+                    free(table);
+                    *uncompressedSize_p = destSize;
+                    return dest;
                 }
-                treePos = 5;
             }
-            window <<= 1;
         }
     }
 
@@ -0,0 +1,417 @@
+// Fuzzes and times the Huffman coder in huff.c.
+//
+//   fuzz [CASES] [SEED]  round-trips random, skewed and degenerate inputs at
+//                        both symbol widths, feeds the decoder corrupted and
+//                        truncated streams, and checks a fixed corpus against
+//                        the output of the coder before the table decoder
+//   bench                compression and decompression MB/s
+//   golden               prints the corpus sums for the current coder
+
+// clock_gettime, fork
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#include "global.h"
+#include "huff.h"
+
+enum InputKind {
+    INPUT_UNIFORM,
+    INPUT_SKEWED,
+    INPUT_TWO_SYMBOLS,
+    INPUT_ONE_SYMBOL,
+    INPUT_KIND_COUNT,
+};
+
+static const char * const sInputKindNames[] = { "uniform", "skewed", "two symbols", "one symbol" };
+
+static uint64_t sRandomState;
+
+static uint32_t Random(void)
+{
+    sRandomState ^= sRandomState << 13;
+    sRandomState ^= sRandomState >> 7;
+    sRandomState ^= sRandomState << 17;
+    return sRandomState >> 32;
+}
+
+static double Now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static uint64_t Fnv1a(const unsigned char *data, int size)
+{
+    uint64_t hash = 0xCBF29CE484222325ULL;
+    for (int i = 0; i < size; i++) {
+        hash ^= data[i];
+        hash *= 0x100000001B3ULL;
+    }
+    return hash;
+}
+
+// The decoder only accepts whole words, so sizes are multiples of 4
+static unsigned char *MakeInput(enum InputKind kind, int size, int bitDepth)
+{
+    unsigned char *data = malloc(size);
+    unsigned char a = Random(), b = Random();
+
+    if (data == NULL)
+        FATAL_ERROR("Out of memory\n");
+    for (int i = 0; i < size; i++) {
+        switch (kind) {
+        case INPUT_UNIFORM:
+            data[i] = Random();
+            break;
+        case INPUT_SKEWED:
+            // Symbol n about twice as likely as n + 1, giving long codes
+            if (bitDepth == 4)
+                data[i] = (__builtin_ctz(Random() | 0x8000) & 0xF) | ((__builtin_ctz(Random() | 0x8000) & 0xF) << 4);
+            else
+                data[i] = __builtin_ctz(Random() | 0x80000000) * 7;
+            break;
+        case INPUT_TWO_SYMBOLS:
+            data[i] = Random() & 1 ? a : b;
+            break;
+        default:
+            data[i] = a;
+            break;
+        }
+    }
+    return data;
+}
+
+// The stream is words from 4 + tree size; when the tree ends halfway through
+// a word the coder before the table decoder left the two bytes after the
+// stream uninitialised, so they are not part of the sum. Neither is the last
+// word of the stream, which that coder wrote right-aligned when it was only
+// partly filled.
+static uint64_t CompressedSum(const unsigned char *compressed, int size)
+{
+    int treeSize = (compressed[4] + 1) * 2;
+    return Fnv1a(compressed, size - treeSize % 4 - 4);
+}
+
+#define EXIT_UNENCODABLE 1  // FATAL_ERROR while compressing
+#define EXIT_MISMATCH 2
+#define EXIT_DECODE_ERROR 3 // FATAL_ERROR while decompressing a valid stream
+#define EXIT_CORRUPTED 4    // crashed or hung on a corrupted stream
+#define EXIT_TRUNCATED 5    // crashed or hung on a truncated stream
+
+// Some inputs cannot be coded at all: a tree whose branches lie more than 63
+// entries ahead of their parent has no encoding, and both coders stop with
+// FATAL_ERROR. Compression therefore runs in a child. Returns false if it
+// failed; *sum is then 0.
+static bool CompressedSumInChild(const unsigned char *input, int size, int bitDepth, uint64_t *sum)
+{
+    int fds[2];
+    pid_t pid;
+    int status;
+
+    *sum = 0;
+    fflush(stdout);
+    if (pipe(fds) != 0 || (pid = fork()) < 0)
+        FATAL_ERROR("Cannot fork\n");
+    if (pid == 0) {
+        int compressedSize;
+        unsigned char *compressed;
+
+        close(fds[0]);
+        freopen("/dev/null", "w", stderr);
+        compressed = HuffCompress((unsigned char *)input, size, &compressedSize, bitDepth);
+        *sum = CompressedSum(compressed, compressedSize);
+        if (write(fds[1], sum, sizeof(*sum)) != sizeof(*sum))
+            _exit(EXIT_MISMATCH);
+        _exit(0);
+    }
+    close(fds[1]);
+    if (read(fds[0], sum, sizeof(*sum)) != sizeof(*sum))
+        *sum = 0;
+    close(fds[0]);
+    waitpid(pid, &status, 0);
+    return WIFEXITED(status) && WEXITSTATUS(status) == 0;
+}
+
+#define CORPUS_CASES 48
+#define CORPUS_SEED 0x5EED
+
+// Case i of the corpus, from its own seed
+static unsigned char *MakeCorpusInput(int i, int *size, int *bitDepth)
+{
+    sRandomState = CORPUS_SEED + i * 0x9E3779B97F4A7C15ULL;
+    *bitDepth = i & 1 ? 8 : 4;
+    *size = 4 * (1 + Random() % 2048);
+    return MakeInput((i / 2) % INPUT_KIND_COUNT, *size, *bitDepth);
+}
+
+// From huff_bench golden, run against huff.c as of the commit before the
+// two-queue tree and the table decoder; 0 where compression fails. Inputs of
+// a single value are CORPUS_NOT_COMPARED: that coder gave them a zero-length
+// code, which nothing can decode.
+#define CORPUS_NOT_COMPARED 1
+static const uint64_t sCorpusSums[CORPUS_CASES] = {
+#include "huff_bench_golden.h"
+};
+
+static int sFailures;
+static int sUnencodable;
+
+// What a child was doing when it exited through FATAL_ERROR
+enum Stage {
+    STAGE_NONE,
+    STAGE_COMPRESS,
+    STAGE_DECOMPRESS,
+};
+
+static enum Stage sStage;
+
+static void OnExit(void)
+{
+    if (sStage == STAGE_DECOMPRESS)
+        _exit(EXIT_DECODE_ERROR);
+}
+
+// Walks the tree one bit at a time, reading each word from its top bit as
+// the hardware does. Returns false where the stream runs out or the tree
+// points outside the file.
+static bool ReferenceDecode(const unsigned char *src, int srcSize, unsigned char *dest, int destSize)
+{
+    int bitDepth = src[0] & 15;
+    int srcPos = 4 + (src[4] + 1) * 2;
+    int treePos = 5, destPos = 0, nsymbols = 0, bits = 0;
+    uint32_t word = 0, destWord = 0;
+
+    while (destPos < destSize) {
+        unsigned char view;
+        int bit, next;
+
+        if (bits == 0) {
+            if (srcPos + 4 > srcSize)
+                return false;
+            word = src[srcPos] | (src[srcPos + 1] << 8) | (src[srcPos + 2] << 16) | ((uint32_t)src[srcPos + 3] << 24);
+            srcPos += 4;
+            bits = 32;
+        }
+        bit = word >> 31;
+        word <<= 1;
+        bits--;
+        if (treePos >= srcSize)
+            return false;
+        view = src[treePos];
+        next = (treePos & ~1) + ((view & 0x3F) + 1) * 2 + bit;
+        if (next >= srcSize)
+            return false;
+        if (((view << bit) & 0x80) == 0) {
+            treePos = next;
+            continue;
+        }
+        destWord = (destWord >> bitDepth) | ((uint32_t)src[next] << (32 - bitDepth));
+        treePos = 5;
+        if (++nsymbols == 32 / bitDepth) {
+            for (int i = 0; i < 4; i++)
+                dest[destPos++] = destWord >> (8 * i);
+            nsymbols = 0;
+        }
+    }
+    return true;
+}
+
+static void Fail(const char *what, enum InputKind kind, int size, int bitDepth)
+{
+    fprintf(stderr, "FAIL %s: %s input, %d bytes, %d-bit symbols\n", what, sInputKindNames[kind], size, bitDepth);
+    sFailures++;
+}
+
+// Decompresses in a child, which may exit through FATAL_ERROR but must not
+// crash or hang
+static bool DecodesSafely(const unsigned char *compressed, int size)
+{
+    pid_t pid = fork();
+    int status;
+
+    if (pid < 0)
+        FATAL_ERROR("Cannot fork\n");
+    if (pid == 0) {
+        int decompressedSize;
+        alarm(10);
+        freopen("/dev/null", "w", stderr);
+        free(HuffDecompress((unsigned char *)compressed, size, &decompressedSize));
+        _exit(0);
+    }
+    waitpid(pid, &status, 0);
+    return WIFEXITED(status);
+}
+
+// The table decoder must give back the input and agree with the reference
+static int FuzzOneInChild(enum InputKind kind, int size, int bitDepth, bool corrupt)
+{
+    unsigned char *input = MakeInput(kind, size, bitDepth);
+    unsigned char *reference = malloc(size);
+    int compressedSize, decompressedSize;
+    unsigned char *compressed, *decompressed;
+
+    sStage = STAGE_COMPRESS;
+    compressed = HuffCompress(input, size, &compressedSize, bitDepth);
+    sStage = STAGE_NONE;
+    if (!ReferenceDecode(compressed, compressedSize, reference, size) || memcmp(reference, input, size) != 0)
+        return EXIT_MISMATCH;
+    sStage = STAGE_DECOMPRESS;
+    decompressed = HuffDecompress(compressed, compressedSize, &decompressedSize);
+    sStage = STAGE_NONE;
+    if (decompressedSize != size || memcmp(decompressed, input, size) != 0)
+        return EXIT_MISMATCH;
+
+    if (corrupt) {
+        // A flipped bit in the tree or the stream, then a truncated stream
+        int bit = Random() % (compressedSize * 8 - 32) + 32;
+        compressed[bit / 8] ^= 1 << (bit % 8);
+        if (!DecodesSafely(compressed, compressedSize))
+            return EXIT_CORRUPTED;
+        compressed[bit / 8] ^= 1 << (bit % 8);
+        if (!DecodesSafely(compressed, 4 + Random() % (compressedSize - 4)))
+            return EXIT_TRUNCATED;
+    }
+    return 0;
+}
+
+static void FuzzOne(enum InputKind kind, int size, int bitDepth, bool corrupt)
+{
+    pid_t pid;
+    int status;
+
+    fflush(stdout);
+    pid = fork();
+
+    if (pid < 0)
+        FATAL_ERROR("Cannot fork\n");
+    if (pid == 0) {
+        freopen("/dev/null", "w", stdout);
+        freopen("/dev/null", "w", stderr);
+        atexit(OnExit);
+        _exit(FuzzOneInChild(kind, size, bitDepth, corrupt));
+    }
+    waitpid(pid, &status, 0);
+    if (!WIFEXITED(status))
+        Fail("crashed", kind, size, bitDepth);
+    else if (WEXITSTATUS(status) == EXIT_UNENCODABLE)
+        sUnencodable++;
+    else if (WEXITSTATUS(status) == EXIT_DECODE_ERROR)
+        Fail("decoder rejected its own output", kind, size, bitDepth);
+    else if (WEXITSTATUS(status) == EXIT_CORRUPTED)
+        Fail("corrupted stream", kind, size, bitDepth);
+    else if (WEXITSTATUS(status) == EXIT_TRUNCATED)
+        Fail("truncated stream", kind, size, bitDepth);
+    else if (WEXITSTATUS(status) != 0)
+        Fail("round trip", kind, size, bitDepth);
+}
+
+static void Fuzz(int cases, uint64_t seed)
+{
+    for (int i = 0; i < CORPUS_CASES; i++) {
+        int size, bitDepth;
+        uint64_t sum;
+        unsigned char *input = MakeCorpusInput(i, &size, &bitDepth);
+
+        CompressedSumInChild(input, size, bitDepth, &sum);
+        if (sCorpusSums[i] != CORPUS_NOT_COMPARED && sum != sCorpusSums[i])
+            Fail("corpus output changed", (i / 2) % INPUT_KIND_COUNT, size, bitDepth);
+        free(input);
+    }
+
+    sRandomState = seed | 1;
+    for (int i = 0; i < cases; i++) {
+        // Mostly small inputs, where the edge cases are, and every 16th large
+        int size = 4 * (1 + Random() % (i % 16 == 15 ? 65536 : 64));
+        FuzzOne(i % INPUT_KIND_COUNT, size, (i / INPUT_KIND_COUNT) & 1 ? 8 : 4, i % 8 == 0);
+    }
+    printf("%d corpus cases, %d fuzz cases (%d unencodable): %s\n", CORPUS_CASES, cases, sUnencodable,
+           sFailures ? "FAILED" : "ok");
+}
+
+static void Golden(void)
+{
+    for (int i = 0; i < CORPUS_CASES; i++) {
+        int size, bitDepth;
+        uint64_t sum;
+        unsigned char *input = MakeCorpusInput(i, &size, &bitDepth);
+
+        CompressedSumInChild(input, size, bitDepth, &sum);
+        if ((i / 2) % INPUT_KIND_COUNT == INPUT_ONE_SYMBOL)
+            sum = CORPUS_NOT_COMPARED;
+        printf("0x%016llXULL,\n", (unsigned long long)sum);
+        free(input);
+    }
+}
+
+// The header holds the size in 24 bits
+#define BENCH_SIZE (8 << 20)
+#define BENCH_SECONDS 0.5
+
+static void Bench(void)
+{
+    printf("%-12s %5s %8s %14s %14s\n", "input", "depth", "ratio", "compress MB/s", "decompress MB/s");
+    sRandomState = 1;
+    for (int kind = INPUT_UNIFORM; kind <= INPUT_SKEWED; kind++) {
+        for (int bitDepth = 4; bitDepth <= 8; bitDepth += 4) {
+            unsigned char *input = MakeInput(kind, BENCH_SIZE, bitDepth);
+            unsigned char *compressed = NULL, *decompressed;
+            int compressedSize, decompressedSize, runs = 0;
+            double start, compressTime, decompressTime;
+            uint64_t sum;
+
+            if (!CompressedSumInChild(input, BENCH_SIZE, bitDepth, &sum)) {
+                printf("%-12s %5d %8s\n", sInputKindNames[kind], bitDepth, "unencodable");
+                free(input);
+                continue;
+            }
+            start = Now();
+            do {
+                free(compressed);
+                compressed = HuffCompress(input, BENCH_SIZE, &compressedSize, bitDepth);
+                runs++;
+            } while (Now() - start < BENCH_SECONDS);
+            compressTime = (Now() - start) / runs;
+
+            runs = 0;
+            start = Now();
+            do {
+                decompressed = HuffDecompress(compressed, compressedSize, &decompressedSize);
+                free(decompressed);
+                runs++;
+            } while (Now() - start < BENCH_SECONDS);
+            decompressTime = (Now() - start) / runs;
+
+            printf("%-12s %5d %8.3f %14.0f %14.0f\n", sInputKindNames[kind], bitDepth,
+                   (double)compressedSize / BENCH_SIZE, BENCH_SIZE / compressTime / 1e6,
+                   BENCH_SIZE / decompressTime / 1e6);
+            free(compressed);
+            free(input);
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    if (argc >= 2 && strcmp(argv[1], "fuzz") == 0) {
+        Fuzz(argc >= 3 ? atoi(argv[2]) : 2000, argc >= 4 ? strtoull(argv[3], NULL, 0) : 1);
+        return sFailures != 0;
+    }
+    if (argc == 2 && strcmp(argv[1], "bench") == 0) {
+        Bench();
+        return 0;
+    }
+    if (argc == 2 && strcmp(argv[1], "golden") == 0) {
+        Golden();
+        return 0;
+    }
+    fprintf(stderr, "Usage: huff_bench fuzz [CASES] [SEED] | bench | golden\n");
+    return 1;
+}
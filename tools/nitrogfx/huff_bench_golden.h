@@ -0,0 +1,48 @@
+0xE1861E24CA08F475ULL,
+0x0000000000000000ULL,
+0xF59156901CFDE5E4ULL,
+0x054E3AD6B15EE84DULL,
+0x8D734BE36D0EA8BFULL,
+0x80CA54D09EF7969DULL,
+0x0000000000000001ULL,
+0x0000000000000001ULL,
+0x2054CF0BCC8686E3ULL,
+0x9521DAFDFF77EF18ULL,
+0x118AAB8378BFA821ULL,
+0x03796FABA5606EA1ULL,
+0xE77AA7260F9503A0ULL,
+0x4097CB2D1A4A7575ULL,
+0x0000000000000001ULL,
+0x0000000000000001ULL,
+0x5E57DD9B7AA8327CULL,
+0x0000000000000000ULL,
+0x1F779D2F27688CBFULL,
+0x3D1FE39EF43EDF1DULL,
+0x844F75D5700676F5ULL,
+0x10B4427891AE0613ULL,
+0x0000000000000001ULL,
+0x0000000000000001ULL,
+0xD3887DA5DED3672AULL,
+0x0000000000000000ULL,
+0x43B0EDF5B96A6CA8ULL,
+0xEA7F930CB50A61C2ULL,
+0x048A5BA726CB9CB1ULL,
+0x0BBCBDD58497C2EDULL,
+0x0000000000000001ULL,
+0x0000000000000001ULL,
+0x64308BF185605830ULL,
+0x0000000000000000ULL,
+0x852A9DC0CB27263EULL,
+0xEC685E3AC9A12ADBULL,
+0x91845B70324242CEULL,
+0x92E046B765491187ULL,
+0x0000000000000001ULL,
+0x0000000000000001ULL,
+0xB1E7E145513176F6ULL,
+0x0000000000000000ULL,
+0x96F06108D08801D1ULL,
+0x936DA814EF1FB459ULL,
+0xF14686FD8708400FULL,
+0xDC1150DDF362135AULL,
+0x0000000000000001ULL,
+0x0000000000000001ULL,
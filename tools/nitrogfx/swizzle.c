@@ -0,0 +1,611 @@
+#include <string.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "global.h"
+#include "swizzle.h"
+
+struct SwizzleKernels {
+    const char *name;
+    void (*linearToTiles4Bpp)(const unsigned char *linear, int pitch, unsigned char *tiles, int numTiles, bool invert);
+    void (*tilesToLinear4Bpp)(const unsigned char *tiles, unsigned char *linear, int pitch, int numTiles, bool invert);
+    void (*linearToTiles8Bpp)(const unsigned char *linear, int pitch, unsigned char *tiles, int numTiles, bool invert);
+    void (*tilesToLinear8Bpp)(const unsigned char *tiles, unsigned char *linear, int pitch, int numTiles, bool invert);
+    void (*swapPixelPairs)(const unsigned char *src, unsigned char *dest, int size, bool invert);
+    uint32_t (*xorLcgKeystream)(unsigned char *data, int numPairs, uint32_t state, uint32_t mul, uint32_t add, bool fromEnd);
+};
+
+void LcgJumpAhead(uint32_t mul, uint32_t add, uint32_t steps, uint32_t *jumpMul, uint32_t *jumpAdd)
+{
+    uint32_t accMul = 1;
+    uint32_t accAdd = 0;
+
+    // Square-and-multiply over affine maps; powers of one map commute, so the
+    // order the factors are applied in does not matter.
+    while (steps != 0) {
+        if (steps & 1) {
+            accMul *= mul;
+            accAdd = accAdd * mul + add;
+        }
+        add = add * mul + add;
+        mul *= mul;
+        steps >>= 1;
+    }
+
+    *jumpMul = accMul;
+    *jumpAdd = accAdd;
+}
+
+// Scalar kernels. Rows are moved a word at a time and the pixel swap is done
+// on all bytes of the word at once.
+
+static inline uint32_t Load32(const unsigned char *p)
+{
+    uint32_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+static inline uint64_t Load64(const unsigned char *p)
+{
+    uint64_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+static inline void Store32(unsigned char *p, uint32_t v)
+{
+    memcpy(p, &v, sizeof(v));
+}
+
+static inline void Store64(unsigned char *p, uint64_t v)
+{
+    memcpy(p, &v, sizeof(v));
+}
+
+static inline uint64_t SwapNibbles64(uint64_t v)
+{
+    return ((v & 0x0F0F0F0F0F0F0F0FULL) << 4) | ((v >> 4) & 0x0F0F0F0F0F0F0F0FULL);
+}
+
+static inline uint32_t SwapNibbles32(uint32_t v)
+{
+    return ((v & 0x0F0F0F0F) << 4) | ((v >> 4) & 0x0F0F0F0F);
+}
+
+static void LinearToTiles4Bpp_Scalar(const unsigned char *linear, int pitch, unsigned char *tiles, int numTiles, bool invert)
+{
+    uint32_t flip = invert ? 0xFFFFFFFF : 0;
+
+    for (int t = 0; t < numTiles; t++) {
+        for (int j = 0; j < 8; j++) {
+            Store32(tiles, SwapNibbles32(Load32(&linear[j * pitch + t * 4])) ^ flip);
+            tiles += 4;
+        }
+    }
+}
+
+static void TilesToLinear4Bpp_Scalar(const unsigned char *tiles, unsigned char *linear, int pitch, int numTiles, bool invert)
+{
+    uint32_t flip = invert ? 0xFFFFFFFF : 0;
+
+    for (int t = 0; t < numTiles; t++) {
+        for (int j = 0; j < 8; j++) {
+            Store32(&linear[j * pitch + t * 4], SwapNibbles32(Load32(tiles)) ^ flip);
+            tiles += 4;
+        }
+    }
+}
+
+static void LinearToTiles8Bpp_Scalar(const unsigned char *linear, int pitch, unsigned char *tiles, int numTiles, bool invert)
+{
+    uint64_t flip = invert ? ~0ULL : 0;
+
+    for (int t = 0; t < numTiles; t++) {
+        for (int j = 0; j < 8; j++) {
+            Store64(tiles, Load64(&linear[j * pitch + t * 8]) ^ flip);
+            tiles += 8;
+        }
+    }
+}
+
+static void TilesToLinear8Bpp_Scalar(const unsigned char *tiles, unsigned char *linear, int pitch, int numTiles, bool invert)
+{
+    uint64_t flip = invert ? ~0ULL : 0;
+
+    for (int t = 0; t < numTiles; t++) {
+        for (int j = 0; j < 8; j++) {
+            Store64(&linear[j * pitch + t * 8], Load64(tiles) ^ flip);
+            tiles += 8;
+        }
+    }
+}
+
+static void SwapPixelPairs_Scalar(const unsigned char *src, unsigned char *dest, int size, bool invert)
+{
+    uint64_t flip = invert ? ~0ULL : 0;
+    int i = 0;
+
+    for (; i + 8 <= size; i += 8)
+        Store64(&dest[i], SwapNibbles64(Load64(&src[i])) ^ flip);
+
+    for (; i < size; i++)
+        dest[i] = (((src[i] & 0xF) << 4) | (src[i] >> 4)) ^ (unsigned char)flip;
+}
+
+static uint32_t XorLcgKeystream_Scalar(unsigned char *data, int numPairs, uint32_t state, uint32_t mul, uint32_t add, bool fromEnd)
+{
+    for (int k = 0; k < numPairs; k++) {
+        unsigned char *pair = &data[2 * (fromEnd ? numPairs - 1 - k : k)];
+
+        pair[0] ^= state;
+        pair[1] ^= state >> 8;
+        state = state * mul + add;
+    }
+
+    return state;
+}
+
+static const struct SwizzleKernels sScalarKernels = {
+    "scalar",
+    LinearToTiles4Bpp_Scalar,
+    TilesToLinear4Bpp_Scalar,
+    LinearToTiles8Bpp_Scalar,
+    TilesToLinear8Bpp_Scalar,
+    SwapPixelPairs_Scalar,
+    XorLcgKeystream_Scalar,
+};
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define SWIZZLE_X86
+
+#include <immintrin.h>
+
+#define TARGET_SSE2 __attribute__((target("sse2")))
+#define TARGET_AVX2 __attribute__((target("avx2")))
+
+// SSE2 kernels. A 4bpp tile row is 4 bytes, so four adjacent tiles are moved
+// with two 4x4 transposes of 32-bit words; 8bpp rows are 8 bytes, so two tiles
+// at a time with 64-bit unpacks.
+
+TARGET_SSE2 static inline __m128i SwapNibbles_SSE2(__m128i v, __m128i flip)
+{
+    __m128i lo = _mm_set1_epi8(0x0F);
+
+    return _mm_xor_si128(_mm_or_si128(_mm_slli_epi16(_mm_and_si128(v, lo), 4), _mm_and_si128(_mm_srli_epi16(v, 4), lo)), flip);
+}
+
+TARGET_SSE2 static inline void Transpose4x32_SSE2(__m128i *r)
+{
+    __m128i t0 = _mm_unpacklo_epi32(r[0], r[1]);
+    __m128i t1 = _mm_unpackhi_epi32(r[0], r[1]);
+    __m128i t2 = _mm_unpacklo_epi32(r[2], r[3]);
+    __m128i t3 = _mm_unpackhi_epi32(r[2], r[3]);
+
+    r[0] = _mm_unpacklo_epi64(t0, t2);
+    r[1] = _mm_unpackhi_epi64(t0, t2);
+    r[2] = _mm_unpacklo_epi64(t1, t3);
+    r[3] = _mm_unpackhi_epi64(t1, t3);
+}
+
+TARGET_SSE2 static void LinearToTiles4Bpp_SSE2(const unsigned char *linear, int pitch, unsigned char *tiles, int numTiles, bool invert)
+{
+    __m128i flip = _mm_set1_epi8(invert ? -1 : 0);
+    int t = 0;
+
+    for (; t + 4 <= numTiles; t += 4) {
+        __m128i r[8];
+
+        for (int j = 0; j < 8; j++)
+            r[j] = _mm_loadu_si128((const __m128i *)&linear[j * pitch + t * 4]);
+
+        Transpose4x32_SSE2(&r[0]);
+        Transpose4x32_SSE2(&r[4]);
+
+        for (int i = 0; i < 4; i++) {
+            _mm_storeu_si128((__m128i *)&tiles[(t + i) * 32], SwapNibbles_SSE2(r[i], flip));
+            _mm_storeu_si128((__m128i *)&tiles[(t + i) * 32 + 16], SwapNibbles_SSE2(r[4 + i], flip));
+        }
+    }
+
+    LinearToTiles4Bpp_Scalar(&linear[t * 4], pitch, &tiles[t * 32], numTiles - t, invert);
+}
+
+TARGET_SSE2 static void TilesToLinear4Bpp_SSE2(const unsigned char *tiles, unsigned char *linear, int pitch, int numTiles, bool invert)
+{
+    __m128i flip = _mm_set1_epi8(invert ? -1 : 0);
+    int t = 0;
+
+    for (; t + 4 <= numTiles; t += 4) {
+        __m128i r[8];
+
+        for (int i = 0; i < 4; i++) {
+            r[i] = SwapNibbles_SSE2(_mm_loadu_si128((const __m128i *)&tiles[(t + i) * 32]), flip);
+            r[4 + i] = SwapNibbles_SSE2(_mm_loadu_si128((const __m128i *)&tiles[(t + i) * 32 + 16]), flip);
+        }
+
+        Transpose4x32_SSE2(&r[0]);
+        Transpose4x32_SSE2(&r[4]);
+
+        for (int j = 0; j < 8; j++)
+            _mm_storeu_si128((__m128i *)&linear[j * pitch + t * 4], r[j]);
+    }
+
+    TilesToLinear4Bpp_Scalar(&tiles[t * 32], &linear[t * 4], pitch, numTiles - t, invert);
+}
+
+TARGET_SSE2 static void LinearToTiles8Bpp_SSE2(const unsigned char *linear, int pitch, unsigned char *tiles, int numTiles, bool invert)
+{
+    __m128i flip = _mm_set1_epi8(invert ? -1 : 0);
+    int t = 0;
+
+    for (; t + 2 <= numTiles; t += 2) {
+        for (int j = 0; j < 8; j += 2) {
+            __m128i a = _mm_loadu_si128((const __m128i *)&linear[j * pitch + t * 8]);
+            __m128i b = _mm_loadu_si128((const __m128i *)&linear[(j + 1) * pitch + t * 8]);
+
+            _mm_storeu_si128((__m128i *)&tiles[t * 64 + j * 8], _mm_xor_si128(_mm_unpacklo_epi64(a, b), flip));
+            _mm_storeu_si128((__m128i *)&tiles[(t + 1) * 64 + j * 8], _mm_xor_si128(_mm_unpackhi_epi64(a, b), flip));
+        }
+    }
+
+    LinearToTiles8Bpp_Scalar(&linear[t * 8], pitch, &tiles[t * 64], numTiles - t, invert);
+}
+
+TARGET_SSE2 static void TilesToLinear8Bpp_SSE2(const unsigned char *tiles, unsigned char *linear, int pitch, int numTiles, bool invert)
+{
+    __m128i flip = _mm_set1_epi8(invert ? -1 : 0);
+    int t = 0;
+
+    for (; t + 2 <= numTiles; t += 2) {
+        for (int j = 0; j < 8; j += 2) {
+            __m128i a = _mm_loadu_si128((const __m128i *)&tiles[t * 64 + j * 8]);
+            __m128i b = _mm_loadu_si128((const __m128i *)&tiles[(t + 1) * 64 + j * 8]);
+
+            _mm_storeu_si128((__m128i *)&linear[j * pitch + t * 8], _mm_xor_si128(_mm_unpacklo_epi64(a, b), flip));
+            _mm_storeu_si128((__m128i *)&linear[(j + 1) * pitch + t * 8], _mm_xor_si128(_mm_unpackhi_epi64(a, b), flip));
+        }
+    }
+
+    TilesToLinear8Bpp_Scalar(&tiles[t * 64], &linear[t * 8], pitch, numTiles - t, invert);
+}
+
+TARGET_SSE2 static void SwapPixelPairs_SSE2(const unsigned char *src, unsigned char *dest, int size, bool invert)
+{
+    __m128i flip = _mm_set1_epi8(invert ? -1 : 0);
+    int i = 0;
+
+    for (; i + 16 <= size; i += 16)
+        _mm_storeu_si128((__m128i *)&dest[i], SwapNibbles_SSE2(_mm_loadu_si128((const __m128i *)&src[i]), flip));
+
+    SwapPixelPairs_Scalar(&src[i], &dest[i], size - i, invert);
+}
+
+// SSE2 has no 32-bit low multiply; build one from the two 32x32->64 multiplies
+TARGET_SSE2 static inline __m128i MulLo32_SSE2(__m128i a, __m128i b)
+{
+    __m128i even = _mm_mul_epu32(a, b);
+    __m128i odd = _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+
+    return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)), _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+}
+
+// Low halves of eight 32-bit lanes, in lane order
+TARGET_SSE2 static inline __m128i PackLow16_SSE2(__m128i a, __m128i b)
+{
+    return _mm_packs_epi32(_mm_srai_epi32(_mm_slli_epi32(a, 16), 16), _mm_srai_epi32(_mm_slli_epi32(b, 16), 16));
+}
+
+// The keystream is generated in eight lanes: lane i holds state k + i, and
+// every lane jumps eight steps at a time.
+TARGET_SSE2 static uint32_t XorLcgKeystream_SSE2(unsigned char *data, int numPairs, uint32_t state, uint32_t mul, uint32_t add, bool fromEnd)
+{
+    uint32_t lanes[8];
+    uint32_t jumpMul, jumpAdd;
+    int k = 0;
+
+    if (numPairs < 8)
+        return XorLcgKeystream_Scalar(data, numPairs, state, mul, add, fromEnd);
+
+    for (int i = 0; i < 8; i++) {
+        lanes[i] = state;
+        state = state * mul + add;
+    }
+    LcgJumpAhead(mul, add, 8, &jumpMul, &jumpAdd);
+
+    __m128i a = _mm_loadu_si128((const __m128i *)&lanes[0]);
+    __m128i b = _mm_loadu_si128((const __m128i *)&lanes[4]);
+    __m128i vmul = _mm_set1_epi32(jumpMul);
+    __m128i vadd = _mm_set1_epi32(jumpAdd);
+
+    for (; k + 8 <= numPairs; k += 8) {
+        __m128i keys = PackLow16_SSE2(a, b);
+        __m128i *block;
+
+        if (fromEnd) {
+            keys = _mm_shufflelo_epi16(keys, _MM_SHUFFLE(0, 1, 2, 3));
+            keys = _mm_shufflehi_epi16(keys, _MM_SHUFFLE(0, 1, 2, 3));
+            keys = _mm_shuffle_epi32(keys, _MM_SHUFFLE(1, 0, 3, 2));
+            block = (__m128i *)&data[2 * (numPairs - 8 - k)];
+        } else {
+            block = (__m128i *)&data[2 * k];
+        }
+        _mm_storeu_si128(block, _mm_xor_si128(_mm_loadu_si128(block), keys));
+
+        a = _mm_add_epi32(MulLo32_SSE2(a, vmul), vadd);
+        b = _mm_add_epi32(MulLo32_SSE2(b, vmul), vadd);
+    }
+
+    state = _mm_cvtsi128_si32(a);
+    if (fromEnd)
+        return XorLcgKeystream_Scalar(data, numPairs - k, state, mul, add, true);
+    return XorLcgKeystream_Scalar(&data[2 * k], numPairs - k, state, mul, add, false);
+}
+
+static const struct SwizzleKernels sSSE2Kernels = {
+    "sse2",
+    LinearToTiles4Bpp_SSE2,
+    TilesToLinear4Bpp_SSE2,
+    LinearToTiles8Bpp_SSE2,
+    TilesToLinear8Bpp_SSE2,
+    SwapPixelPairs_SSE2,
+    XorLcgKeystream_SSE2,
+};
+
+// AVX2 kernels. Eight 4bpp tiles are one 8x8 transpose of 32-bit words; four
+// 8bpp tiles are two 4x4 transposes of 64-bit words.
+
+TARGET_AVX2 static inline __m256i SwapNibbles_AVX2(__m256i v, __m256i flip)
+{
+    __m256i lo = _mm256_set1_epi8(0x0F);
+
+    return _mm256_xor_si256(_mm256_or_si256(_mm256_slli_epi16(_mm256_and_si256(v, lo), 4), _mm256_and_si256(_mm256_srli_epi16(v, 4), lo)), flip);
+}
+
+TARGET_AVX2 static inline void Transpose8x32_AVX2(__m256i *r)
+{
+    __m256i t[8];
+    __m256i u[8];
+
+    for (int i = 0; i < 8; i += 4) {
+        t[i + 0] = _mm256_unpacklo_epi32(r[i + 0], r[i + 1]);
+        t[i + 1] = _mm256_unpackhi_epi32(r[i + 0], r[i + 1]);
+        t[i + 2] = _mm256_unpacklo_epi32(r[i + 2], r[i + 3]);
+        t[i + 3] = _mm256_unpackhi_epi32(r[i + 2], r[i + 3]);
+        u[i + 0] = _mm256_unpacklo_epi64(t[i + 0], t[i + 2]);
+        u[i + 1] = _mm256_unpackhi_epi64(t[i + 0], t[i + 2]);
+        u[i + 2] = _mm256_unpacklo_epi64(t[i + 1], t[i + 3]);
+        u[i + 3] = _mm256_unpackhi_epi64(t[i + 1], t[i + 3]);
+    }
+
+    for (int i = 0; i < 4; i++) {
+        r[i] = _mm256_permute2x128_si256(u[i], u[i + 4], 0x20);
+        r[i + 4] = _mm256_permute2x128_si256(u[i], u[i + 4], 0x31);
+    }
+}
+
+TARGET_AVX2 static void LinearToTiles4Bpp_AVX2(const unsigned char *linear, int pitch, unsigned char *tiles, int numTiles, bool invert)
+{
+    __m256i flip = _mm256_set1_epi8(invert ? -1 : 0);
+    int t = 0;
+
+    for (; t + 8 <= numTiles; t += 8) {
+        __m256i r[8];
+
+        for (int j = 0; j < 8; j++)
+            r[j] = _mm256_loadu_si256((const __m256i *)&linear[j * pitch + t * 4]);
+
+        Transpose8x32_AVX2(r);
+
+        for (int i = 0; i < 8; i++)
+            _mm256_storeu_si256((__m256i *)&tiles[(t + i) * 32], SwapNibbles_AVX2(r[i], flip));
+    }
+
+    LinearToTiles4Bpp_SSE2(&linear[t * 4], pitch, &tiles[t * 32], numTiles - t, invert);
+}
+
+TARGET_AVX2 static void TilesToLinear4Bpp_AVX2(const unsigned char *tiles, unsigned char *linear, int pitch, int numTiles, bool invert)
+{
+    __m256i flip = _mm256_set1_epi8(invert ? -1 : 0);
+    int t = 0;
+
+    for (; t + 8 <= numTiles; t += 8) {
+        __m256i r[8];
+
+        for (int i = 0; i < 8; i++)
+            r[i] = SwapNibbles_AVX2(_mm256_loadu_si256((const __m256i *)&tiles[(t + i) * 32]), flip);
+
+        Transpose8x32_AVX2(r);
+
+        for (int j = 0; j < 8; j++)
+            _mm256_storeu_si256((__m256i *)&linear[j * pitch + t * 4], r[j]);
+    }
+
+    TilesToLinear4Bpp_SSE2(&tiles[t * 32], &linear[t * 4], pitch, numTiles - t, invert);
+}
+
+TARGET_AVX2 static void LinearToTiles8Bpp_AVX2(const unsigned char *linear, int pitch, unsigned char *tiles, int numTiles, bool invert)
+{
+    __m256i flip = _mm256_set1_epi8(invert ? -1 : 0);
+    int t = 0;
+
+    for (; t + 4 <= numTiles; t += 4) {
+        for (int j = 0; j < 8; j += 4) {
+            __m256i r0 = _mm256_loadu_si256((const __m256i *)&linear[(j + 0) * pitch + t * 8]);
+            __m256i r1 = _mm256_loadu_si256((const __m256i *)&linear[(j + 1) * pitch + t * 8]);
+            __m256i r2 = _mm256_loadu_si256((const __m256i *)&linear[(j + 2) * pitch + t * 8]);
+            __m256i r3 = _mm256_loadu_si256((const __m256i *)&linear[(j + 3) * pitch + t * 8]);
+            __m256i t0 = _mm256_unpacklo_epi64(r0, r1);
+            __m256i t1 = _mm256_unpackhi_epi64(r0, r1);
+            __m256i t2 = _mm256_unpacklo_epi64(r2, r3);
+            __m256i t3 = _mm256_unpackhi_epi64(r2, r3);
+
+            _mm256_storeu_si256((__m256i *)&tiles[(t + 0) * 64 + j * 8], _mm256_xor_si256(_mm256_permute2x128_si256(t0, t2, 0x20), flip));
+            _mm256_storeu_si256((__m256i *)&tiles[(t + 1) * 64 + j * 8], _mm256_xor_si256(_mm256_permute2x128_si256(t1, t3, 0x20), flip));
+            _mm256_storeu_si256((__m256i *)&tiles[(t + 2) * 64 + j * 8], _mm256_xor_si256(_mm256_permute2x128_si256(t0, t2, 0x31), flip));
+            _mm256_storeu_si256((__m256i *)&tiles[(t + 3) * 64 + j * 8], _mm256_xor_si256(_mm256_permute2x128_si256(t1, t3, 0x31), flip));
+        }
+    }
+
+    LinearToTiles8Bpp_SSE2(&linear[t * 8], pitch, &tiles[t * 64], numTiles - t, invert);
+}
+
+TARGET_AVX2 static void TilesToLinear8Bpp_AVX2(const unsigned char *tiles, unsigned char *linear, int pitch, int numTiles, bool invert)
+{
+    __m256i flip = _mm256_set1_epi8(invert ? -1 : 0);
+    int t = 0;
+
+    for (; t + 4 <= numTiles; t += 4) {
+        for (int j = 0; j < 8; j += 4) {
+            __m256i a0 = _mm256_loadu_si256((const __m256i *)&tiles[(t + 0) * 64 + j * 8]);
+            __m256i a1 = _mm256_loadu_si256((const __m256i *)&tiles[(t + 1) * 64 + j * 8]);
+            __m256i a2 = _mm256_loadu_si256((const __m256i *)&tiles[(t + 2) * 64 + j * 8]);
+            __m256i a3 = _mm256_loadu_si256((const __m256i *)&tiles[(t + 3) * 64 + j * 8]);
+            __m256i u0 = _mm256_permute2x128_si256(a0, a2, 0x20);
+            __m256i u1 = _mm256_permute2x128_si256(a1, a3, 0x20);
+            __m256i u2 = _mm256_permute2x128_si256(a0, a2, 0x31);
+            __m256i u3 = _mm256_permute2x128_si256(a1, a3, 0x31);
+
+            _mm256_storeu_si256((__m256i *)&linear[(j + 0) * pitch + t * 8], _mm256_xor_si256(_mm256_unpacklo_epi64(u0, u1), flip));
+            _mm256_storeu_si256((__m256i *)&linear[(j + 1) * pitch + t * 8], _mm256_xor_si256(_mm256_unpackhi_epi64(u0, u1), flip));
+            _mm256_storeu_si256((__m256i *)&linear[(j + 2) * pitch + t * 8], _mm256_xor_si256(_mm256_unpacklo_epi64(u2, u3), flip));
+            _mm256_storeu_si256((__m256i *)&linear[(j + 3) * pitch + t * 8], _mm256_xor_si256(_mm256_unpackhi_epi64(u2, u3), flip));
+        }
+    }
+
+    TilesToLinear8Bpp_SSE2(&tiles[t * 64], &linear[t * 8], pitch, numTiles - t, invert);
+}
+
+TARGET_AVX2 static void SwapPixelPairs_AVX2(const unsigned char *src, unsigned char *dest, int size, bool invert)
+{
+    __m256i flip = _mm256_set1_epi8(invert ? -1 : 0);
+    int i = 0;
+
+    for (; i + 32 <= size; i += 32)
+        _mm256_storeu_si256((__m256i *)&dest[i], SwapNibbles_AVX2(_mm256_loadu_si256((const __m256i *)&src[i]), flip));
+
+    SwapPixelPairs_SSE2(&src[i], &dest[i], size - i, invert);
+}
+
+// As the SSE2 version, but with sixteen lanes in two registers
+TARGET_AVX2 static uint32_t XorLcgKeystream_AVX2(unsigned char *data, int numPairs, uint32_t state, uint32_t mul, uint32_t add, bool fromEnd)
+{
+    uint32_t lanes[16];
+    uint32_t jumpMul, jumpAdd;
+    int k = 0;
+
+    if (numPairs < 16)
+        return XorLcgKeystream_SSE2(data, numPairs, state, mul, add, fromEnd);
+
+    for (int i = 0; i < 16; i++) {
+        lanes[i] = state;
+        state = state * mul + add;
+    }
+    LcgJumpAhead(mul, add, 16, &jumpMul, &jumpAdd);
+
+    __m256i a = _mm256_loadu_si256((const __m256i *)&lanes[0]);
+    __m256i b = _mm256_loadu_si256((const __m256i *)&lanes[8]);
+    __m256i vmul = _mm256_set1_epi32(jumpMul);
+    __m256i vadd = _mm256_set1_epi32(jumpAdd);
+    __m256i low16 = _mm256_set1_epi32(0xFFFF);
+    __m256i reverse = _mm256_setr_epi8(14, 15, 12, 13, 10, 11, 8, 9, 6, 7, 4, 5, 2, 3, 0, 1,
+                                       14, 15, 12, 13, 10, 11, 8, 9, 6, 7, 4, 5, 2, 3, 0, 1);
+
+    for (; k + 16 <= numPairs; k += 16) {
+        // packus interleaves the 128-bit halves of a and b; put them back in order
+        __m256i keys = _mm256_packus_epi32(_mm256_and_si256(a, low16), _mm256_and_si256(b, low16));
+        __m256i *block;
+
+        keys = _mm256_permute4x64_epi64(keys, _MM_SHUFFLE(3, 1, 2, 0));
+        if (fromEnd) {
+            keys = _mm256_permute4x64_epi64(_mm256_shuffle_epi8(keys, reverse), _MM_SHUFFLE(1, 0, 3, 2));
+            block = (__m256i *)&data[2 * (numPairs - 16 - k)];
+        } else {
+            block = (__m256i *)&data[2 * k];
+        }
+        _mm256_storeu_si256(block, _mm256_xor_si256(_mm256_loadu_si256(block), keys));
+
+        a = _mm256_add_epi32(_mm256_mullo_epi32(a, vmul), vadd);
+        b = _mm256_add_epi32(_mm256_mullo_epi32(b, vmul), vadd);
+    }
+
+    state = _mm_cvtsi128_si32(_mm256_castsi256_si128(a));
+    if (fromEnd)
+        return XorLcgKeystream_SSE2(data, numPairs - k, state, mul, add, true);
+    return XorLcgKeystream_SSE2(&data[2 * k], numPairs - k, state, mul, add, false);
+}
+
+static const struct SwizzleKernels sAVX2Kernels = {
+    "avx2",
+    LinearToTiles4Bpp_AVX2,
+    TilesToLinear4Bpp_AVX2,
+    LinearToTiles8Bpp_AVX2,
+    TilesToLinear8Bpp_AVX2,
+    SwapPixelPairs_AVX2,
+    XorLcgKeystream_AVX2,
+};
+
+#endif // x86
+
+static const struct SwizzleKernels *sKernels;
+
+static const struct SwizzleKernels *GetKernels(void)
+{
+    if (sKernels != NULL)
+        return sKernels;
+
+    const char *request = getenv("NITROGFX_SIMD");
+    const struct SwizzleKernels *candidates[3];
+    int numCandidates = 0;
+
+#ifdef SWIZZLE_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+        candidates[numCandidates++] = &sAVX2Kernels;
+    if (__builtin_cpu_supports("sse2"))
+        candidates[numCandidates++] = &sSSE2Kernels;
+#endif
+    candidates[numCandidates++] = &sScalarKernels;
+
+    sKernels = candidates[0];
+    if (request != NULL && request[0] != '\0') {
+        for (int i = 0; i < numCandidates; i++) {
+            if (strcmp(request, candidates[i]->name) == 0)
+                sKernels = candidates[i];
+        }
+        if (strcmp(request, sKernels->name) != 0)
+            FATAL_ERROR("NITROGFX_SIMD=%s is not supported on this machine.\n", request);
+    }
+
+    return sKernels;
+}
+
+void LinearToTiles4Bpp(const unsigned char *linear, int pitch, unsigned char *tiles, int numTiles, bool invert)
+{
+    GetKernels()->linearToTiles4Bpp(linear, pitch, tiles, numTiles, invert);
+}
+
+void TilesToLinear4Bpp(const unsigned char *tiles, unsigned char *linear, int pitch, int numTiles, bool invert)
+{
+    GetKernels()->tilesToLinear4Bpp(tiles, linear, pitch, numTiles, invert);
+}
+
+void LinearToTiles8Bpp(const unsigned char *linear, int pitch, unsigned char *tiles, int numTiles, bool invert)
+{
+    GetKernels()->linearToTiles8Bpp(linear, pitch, tiles, numTiles, invert);
+}
+
+void TilesToLinear8Bpp(const unsigned char *tiles, unsigned char *linear, int pitch, int numTiles, bool invert)
+{
+    GetKernels()->tilesToLinear8Bpp(tiles, linear, pitch, numTiles, invert);
+}
+
+void SwapPixelPairs(const unsigned char *src, unsigned char *dest, int size, bool invert)
+{
+    GetKernels()->swapPixelPairs(src, dest, size, invert);
+}
+
+uint32_t XorLcgKeystream(unsigned char *data, int numPairs, uint32_t state, uint32_t mul, uint32_t add, bool fromEnd)
+{
+    return GetKernels()->xorLcgKeystream(data, numPairs, state, mul, add, fromEnd);
+}
@@ -0,0 +1,32 @@
+#ifndef SWIZZLE_H
+#define SWIZZLE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Pixel kernels for converting between linear images and NCGR character data.
+// Each kernel has a scalar version and, on x86, SSE2 and AVX2 versions that are
+// picked at run time. Setting NITROGFX_SIMD=scalar|sse2|avx2 overrides the
+// choice, which is handy when comparing outputs.
+
+// Copies a run of horizontally adjacent tiles between a linear image (rows
+// pitch bytes apart, starting at the tile run's top-left corner) and packed
+// tile data. 4bpp kernels also swap the two pixels of every byte; invert
+// flips every pixel value.
+void LinearToTiles4Bpp(const unsigned char *linear, int pitch, unsigned char *tiles, int numTiles, bool invert);
+void TilesToLinear4Bpp(const unsigned char *tiles, unsigned char *linear, int pitch, int numTiles, bool invert);
+void LinearToTiles8Bpp(const unsigned char *linear, int pitch, unsigned char *tiles, int numTiles, bool invert);
+void TilesToLinear8Bpp(const unsigned char *tiles, unsigned char *linear, int pitch, int numTiles, bool invert);
+
+// Swaps the two 4bpp pixels in each of size bytes, optionally inverting them.
+void SwapPixelPairs(const unsigned char *src, unsigned char *dest, int size, bool invert);
+
+// XORs numPairs little-endian u16s with the low halves of the LCG sequence
+// state, mul * state + add, ... starting at the first pair or, if fromEnd, at
+// the last one. Returns the state following the last one used.
+uint32_t XorLcgKeystream(unsigned char *data, int numPairs, uint32_t state, uint32_t mul, uint32_t add, bool fromEnd);
+
+// Composes the LCG step x -> mul * x + add with itself steps times.
+void LcgJumpAhead(uint32_t mul, uint32_t add, uint32_t steps, uint32_t *jumpMul, uint32_t *jumpAdd);
+
+#endif // SWIZZLE_H
@@ -0,0 +1,290 @@
+// Checks the pixel kernels in swizzle.c against byte-at-a-time versions of
+// the loops they replaced, and measures their throughput. The kernel set is
+// the one nitrogfx would pick, so run it under each NITROGFX_SIMD setting.
+
+// clock_gettime
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <time.h>
+#include "global.h"
+#include "swizzle.h"
+
+#define SCAN_MUL 1103515245
+#define SCAN_ADD 24691
+
+static uint32_t sRandomState = 0x12345678;
+
+static uint32_t Random(void)
+{
+    sRandomState ^= sRandomState << 13;
+    sRandomState ^= sRandomState >> 17;
+    sRandomState ^= sRandomState << 5;
+    return sRandomState;
+}
+
+static void FillRandom(unsigned char *buf, int size)
+{
+    for (int i = 0; i < size; i++)
+        buf[i] = Random();
+}
+
+static double Now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Reference kernels, one byte per step as gfx.c used to convert
+
+static unsigned char Ref4BppByte(unsigned char pair, bool invert)
+{
+    unsigned char left = pair & 0xF;
+    unsigned char right = pair >> 4;
+
+    if (invert) {
+        left = 15 - left;
+        right = 15 - right;
+    }
+    return (left << 4) | right;
+}
+
+static void RefLinearToTiles4Bpp(const unsigned char *linear, int pitch, unsigned char *tiles, int numTiles, bool invert)
+{
+    for (int t = 0; t < numTiles; t++)
+        for (int j = 0; j < 8; j++)
+            for (int k = 0; k < 4; k++)
+                *tiles++ = Ref4BppByte(linear[j * pitch + t * 4 + k], invert);
+}
+
+static void RefTilesToLinear4Bpp(const unsigned char *tiles, unsigned char *linear, int pitch, int numTiles, bool invert)
+{
+    for (int t = 0; t < numTiles; t++)
+        for (int j = 0; j < 8; j++)
+            for (int k = 0; k < 4; k++)
+                linear[j * pitch + t * 4 + k] = Ref4BppByte(*tiles++, invert);
+}
+
+static void RefLinearToTiles8Bpp(const unsigned char *linear, int pitch, unsigned char *tiles, int numTiles, bool invert)
+{
+    for (int t = 0; t < numTiles; t++)
+        for (int j = 0; j < 8; j++)
+            for (int k = 0; k < 8; k++) {
+                unsigned char pixel = linear[j * pitch + t * 8 + k];
+                *tiles++ = invert ? 255 - pixel : pixel;
+            }
+}
+
+static void RefTilesToLinear8Bpp(const unsigned char *tiles, unsigned char *linear, int pitch, int numTiles, bool invert)
+{
+    for (int t = 0; t < numTiles; t++)
+        for (int j = 0; j < 8; j++)
+            for (int k = 0; k < 8; k++) {
+                unsigned char pixel = *tiles++;
+                linear[j * pitch + t * 8 + k] = invert ? 255 - pixel : pixel;
+            }
+}
+
+static void RefSwapPixelPairs(const unsigned char *src, unsigned char *dest, int size, bool invert)
+{
+    for (int i = 0; i < size; i++)
+        dest[i] = Ref4BppByte(src[i], invert);
+}
+
+static uint32_t RefXorLcgKeystream(unsigned char *data, int numPairs, uint32_t state, uint32_t mul, uint32_t add, bool fromEnd)
+{
+    for (int n = 0; n < numPairs; n++) {
+        int i = fromEnd ? 2 * (numPairs - 1 - n) : 2 * n;
+        uint16_t val = data[i] | (data[i + 1] << 8);
+        val ^= state & 0xFFFF;
+        data[i] = val;
+        data[i + 1] = val >> 8;
+        state = state * mul + add;
+    }
+    return state;
+}
+
+typedef void (*LinearToTilesFunc)(const unsigned char *linear, int pitch, unsigned char *tiles, int numTiles, bool invert);
+typedef void (*TilesToLinearFunc)(const unsigned char *tiles, unsigned char *linear, int pitch, int numTiles, bool invert);
+
+static const struct TileKernel {
+    const char *name;
+    int tileSize;
+    LinearToTilesFunc toTiles, refToTiles;
+    TilesToLinearFunc toLinear, refToLinear;
+} sTileKernels[] = {
+    { "4bpp", 32, LinearToTiles4Bpp, RefLinearToTiles4Bpp, TilesToLinear4Bpp, RefTilesToLinear4Bpp },
+    { "8bpp", 64, LinearToTiles8Bpp, RefLinearToTiles8Bpp, TilesToLinear8Bpp, RefTilesToLinear8Bpp },
+};
+
+#define MAX_CHECK_TILES 67
+#define MAX_CHECK_PAIRS 1027
+
+static int sFailures;
+
+static void Expect(bool ok, const char *what, int size, bool flag)
+{
+    if (!ok) {
+        fprintf(stderr, "FAIL %s, size %d, %s\n", what, size, flag ? "set" : "clear");
+        sFailures++;
+    }
+}
+
+// Every run length up to MAX_CHECK_TILES, which covers each vector width's
+// remainder, with padding around the row so overruns show up
+static void Check(void)
+{
+    static unsigned char linear[8 * (MAX_CHECK_TILES + 4) * 8];
+    static unsigned char expected[8 * (MAX_CHECK_TILES + 4) * 8];
+    static unsigned char tiles[(MAX_CHECK_TILES + 4) * 64];
+    static unsigned char expectedTiles[(MAX_CHECK_TILES + 4) * 64];
+    static unsigned char data[2 * MAX_CHECK_PAIRS], expectedData[2 * MAX_CHECK_PAIRS];
+    static unsigned char swapped[2 * MAX_CHECK_PAIRS], expectedSwapped[2 * MAX_CHECK_PAIRS];
+
+    for (int k = 0; k < 2; k++) {
+        const struct TileKernel *kernel = &sTileKernels[k];
+        int bytesPerRow = kernel->tileSize / 8;
+        char what[64];
+
+        for (int numTiles = 1; numTiles <= MAX_CHECK_TILES; numTiles++) {
+            // A row wider than the run, as for a metatile inside an image
+            int pitch = (numTiles + 3) * bytesPerRow;
+            for (int invert = 0; invert < 2; invert++) {
+                FillRandom(linear, sizeof(linear));
+                FillRandom(tiles, sizeof(tiles));
+                memcpy(expectedTiles, tiles, sizeof(tiles));
+                kernel->toTiles(linear + bytesPerRow, pitch, tiles, numTiles, invert);
+                kernel->refToTiles(linear + bytesPerRow, pitch, expectedTiles, numTiles, invert);
+                snprintf(what, sizeof(what), "LinearToTiles%s", kernel->name);
+                Expect(memcmp(tiles, expectedTiles, sizeof(tiles)) == 0, what, numTiles, invert);
+
+                FillRandom(tiles, sizeof(tiles));
+                FillRandom(linear, sizeof(linear));
+                memcpy(expected, linear, sizeof(linear));
+                kernel->toLinear(tiles, linear + bytesPerRow, pitch, numTiles, invert);
+                kernel->refToLinear(tiles, expected + bytesPerRow, pitch, numTiles, invert);
+                snprintf(what, sizeof(what), "TilesToLinear%s", kernel->name);
+                Expect(memcmp(linear, expected, sizeof(linear)) == 0, what, numTiles, invert);
+            }
+        }
+    }
+
+    for (int size = 1; size <= 2 * MAX_CHECK_PAIRS; size++) {
+        for (int invert = 0; invert < 2; invert++) {
+            FillRandom(data, sizeof(data));
+            FillRandom(swapped, sizeof(swapped));
+            memcpy(expectedSwapped, swapped, sizeof(swapped));
+            SwapPixelPairs(data, swapped, size, invert);
+            RefSwapPixelPairs(data, expectedSwapped, size, invert);
+            Expect(memcmp(swapped, expectedSwapped, sizeof(swapped)) == 0, "SwapPixelPairs", size, invert);
+        }
+    }
+
+    for (int numPairs = 1; numPairs <= MAX_CHECK_PAIRS; numPairs++) {
+        for (int fromEnd = 0; fromEnd < 2; fromEnd++) {
+            uint32_t seed = Random();
+            FillRandom(data, sizeof(data));
+            memcpy(expectedData, data, sizeof(data));
+            uint32_t state = XorLcgKeystream(data, numPairs, seed, SCAN_MUL, SCAN_ADD, fromEnd);
+            uint32_t expectedState = RefXorLcgKeystream(expectedData, numPairs, seed, SCAN_MUL, SCAN_ADD, fromEnd);
+            Expect(memcmp(data, expectedData, sizeof(data)) == 0 && state == expectedState, "XorLcgKeystream", numPairs, fromEnd);
+        }
+    }
+}
+
+// One image row of BENCH_TILES tiles, converted repeatedly for BENCH_SECONDS
+#define BENCH_TILES 512
+#define BENCH_SECONDS 0.2
+
+enum BenchOp {
+    BENCH_TO_TILES,
+    BENCH_TO_LINEAR,
+    BENCH_SWAP,
+    BENCH_XOR,
+};
+
+static void RunOnce(enum BenchOp op, const struct TileKernel *kernel, bool reference, unsigned char *linear, unsigned char *tiles, int size)
+{
+    int pitch = BENCH_TILES * kernel->tileSize / 8;
+
+    switch (op) {
+    case BENCH_TO_TILES:
+        (reference ? kernel->refToTiles : kernel->toTiles)(linear, pitch, tiles, BENCH_TILES, false);
+        break;
+    case BENCH_TO_LINEAR:
+        (reference ? kernel->refToLinear : kernel->toLinear)(tiles, linear, pitch, BENCH_TILES, false);
+        break;
+    case BENCH_SWAP:
+        (reference ? RefSwapPixelPairs : SwapPixelPairs)(linear, tiles, size, false);
+        break;
+    case BENCH_XOR:
+        (reference ? RefXorLcgKeystream : XorLcgKeystream)(tiles, size / 2, 1, SCAN_MUL, SCAN_ADD, false);
+        break;
+    }
+}
+
+// Returns MB/s
+static double Measure(enum BenchOp op, const struct TileKernel *kernel, bool reference)
+{
+    static unsigned char linear[BENCH_TILES * 64], tiles[BENCH_TILES * 64];
+    int size = BENCH_TILES * kernel->tileSize;
+    long iterations = 0;
+    double start, elapsed;
+
+    FillRandom(linear, sizeof(linear));
+    FillRandom(tiles, sizeof(tiles));
+    start = Now();
+    do {
+        for (int i = 0; i < 16; i++)
+            RunOnce(op, kernel, reference, linear, tiles, size);
+        iterations += 16;
+        elapsed = Now() - start;
+    } while (elapsed < BENCH_SECONDS);
+    return (double)size * iterations / elapsed / 1e6;
+}
+
+static void Bench(void)
+{
+    static const struct {
+        const char *name;
+        enum BenchOp op;
+        int kernel;
+    } sOps[] = {
+        { "LinearToTiles4Bpp", BENCH_TO_TILES, 0 },
+        { "TilesToLinear4Bpp", BENCH_TO_LINEAR, 0 },
+        { "LinearToTiles8Bpp", BENCH_TO_TILES, 1 },
+        { "TilesToLinear8Bpp", BENCH_TO_LINEAR, 1 },
+        { "SwapPixelPairs", BENCH_SWAP, 0 },
+        { "XorLcgKeystream", BENCH_XOR, 0 },
+    };
+
+    printf("%-20s %12s %12s %8s\n", "kernel", "MB/s", "bytewise", "speedup");
+    for (size_t i = 0; i < sizeof(sOps) / sizeof(sOps[0]); i++) {
+        double fast = Measure(sOps[i].op, &sTileKernels[sOps[i].kernel], false);
+        double ref = Measure(sOps[i].op, &sTileKernels[sOps[i].kernel], true);
+        printf("%-20s %12.0f %12.0f %7.1fx\n", sOps[i].name, fast, ref, fast / ref);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    const char *simd = getenv("NITROGFX_SIMD");
+
+    if (argc != 2 || (strcmp(argv[1], "check") != 0 && strcmp(argv[1], "bench") != 0)) {
+        fprintf(stderr, "Usage: swizzle_bench check|bench\n");
+        return 1;
+    }
+    if (strcmp(argv[1], "check") == 0) {
+        Check();
+        printf("%s: %s\n", simd != NULL && simd[0] != '\0' ? simd : "default", sFailures ? "FAILED" : "ok");
+        return sFailures != 0;
+    }
+    printf("NITROGFX_SIMD=%s\n", simd != NULL ? simd : "");
+    Bench();
+    return 0;
+}
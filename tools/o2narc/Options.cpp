@@ -2,39 +2,105 @@
 #include <vector>
 #include <cstring>
 #include <algorithm>
+#include <atomic>
+#include <sstream>
+#include <thread>
 #include "Options.h"
 #include "Narc.h"
 #include "RelocElfReader.h"
 
+bool Options::ParseFlag(const vector<string> &args, size_t &i, ConvertJob &job) {
+    const string &arg = args[i];
+    if (arg == "-f" || arg == "--flatten") {
+        job.flatten = true;
+    } else if (arg == "-p" || arg == "--padding") {
+        if (i + 1 >= args.size()) {
+            throw command_error("missing value for " + arg);
+        }
+        int padval_i = stoi(args[++i]);
+        if (padval_i < 0 || padval_i > 255) {
+            throw command_error("invalid 8-bit value " + args[i] + " for " + arg);
+        }
+        job.padval = static_cast<char>(padval_i);
+    } else if (arg == "-n" || arg == "--naix") {
+        job.naix = true;
+    } else if (arg[0] == '-') {
+        throw command_error("unrecognized option flag: " + arg);
+    } else {
+        return false;
+    }
+    return true;
+}
+
+// Each non-empty line of a response file is "[options] infile outfile".
+// Options on the line add to the ones given on the command line.
+void Options::ReadResponseFile(const string &filename, const ConvertJob &defaults) {
+    ifstream rsp(filename);
+    if (!rsp.good()) {
+        throw command_error("unable to open response file " + filename);
+    }
+    string line;
+    while (getline(rsp, line)) {
+        vector<string> args;
+        istringstream iss(line);
+        for (string arg; iss >> arg; ) {
+            args.emplace_back(arg);
+        }
+        if (args.empty() || args[0][0] == '#') {
+            continue;
+        }
+        ConvertJob job = defaults;
+        vector<string> posargs;
+        for (size_t i = 0; i < args.size(); i++) {
+            if (!ParseFlag(args, i, job)) {
+                posargs.emplace_back(args[i]);
+            }
+        }
+        if (posargs.size() != 2) {
+            throw command_error("expected infile and outfile in " + filename + ": " + line);
+        }
+        job.infile = posargs[0];
+        job.outfile = posargs[1];
+        jobs.emplace_back(job);
+    }
+}
+
 Options::Options(int argc, char **argv) {
-    for (int i = 1; i < argc; i++) {
-        string arg{argv[i]};
-        if (arg == "-f" || arg == "--flatten") {
-            flatten = true;
-        } else if (arg == "-p" || arg == "--padding") {
-            int padval_i = stoi(argv[++i]);
-            if (padval_i < 0 || padval_i > 255) {
-                throw command_error(string{"invalid 8-bit value "} + argv[i] + " for " + arg);
+    vector<string> args(argv + 1, argv + argc);
+    vector<string> posargs;
+    vector<string> rspfiles;
+    ConvertJob defaults;
+
+    for (size_t i = 0; i < args.size(); i++) {
+        if (args[i] == "-j" || args[i] == "--jobs") {
+            if (i + 1 >= args.size()) {
+                throw command_error("missing value for " + args[i]);
             }
-            padval = static_cast<char>(padval_i);
-        } else if (arg == "-n" || arg == "--naix") {
-            naix = true;
-        } else if (arg[0] == '-') {
-            throw command_error("unrecognized option flag: " + arg);
-        } else if (posargs.size() >= 2) {
-            throw command_error("unrecognized positional argument: " + arg);
-        } else {
-            posargs.emplace_back(arg);
+            nthreads = stoul(args[++i]);
+        } else if (args[i][0] == '@') {
+            rspfiles.emplace_back(args[i].substr(1));
+        } else if (!ParseFlag(args, i, defaults)) {
+            posargs.emplace_back(args[i]);
         }
     }
-    if (posargs.size() < 2) {
+    if (posargs.size() % 2 != 0) {
+        throw command_error("unpaired positional argument: " + posargs.back());
+    }
+    if (posargs.empty() && rspfiles.empty()) {
         throw command_error("missing positional arg");
     }
-    objfile.open(posargs[0], ios::in | ios::binary);
-    narcfile.open(posargs[1], ios::out | ios::binary);
+    for (size_t i = 0; i < posargs.size(); i += 2) {
+        ConvertJob job = defaults;
+        job.infile = posargs[i];
+        job.outfile = posargs[i + 1];
+        jobs.emplace_back(job);
+    }
+    for (const auto &rspfile : rspfiles) {
+        ReadResponseFile(rspfile, defaults);
+    }
 }
 
-void Options::ReadObjectFile(vector<unsigned char> &rodata, vector<uint32_t> &sizes) {
+void Converter::ReadObjectFile(vector<unsigned char> &rodata, vector<uint32_t> &sizes) {
     ELF_ASSERT(objfile.HasSection(".rodata"));
     rodata.resize(objfile.GetSectionHeader(".rodata").sh_size);
     objfile.ReadSectionData(objfile.GetSectionHeader(".rodata"), rodata.data());
@@ -68,18 +134,18 @@ void Options::ReadObjectFile(vector<unsigned char> &rodata, vector<uint32_t> &si
     }
 }
 
-void Options::OverwritePadding(vector<unsigned char> &rodata, vector<uint32_t> &sizes) const {
+void Converter::OverwritePadding(vector<unsigned char> &rodata, vector<uint32_t> &sizes) const {
     uint32_t end = 0;
     for (auto & size : sizes) {
         end += size;
         uint32_t pad_end = (end + 3) & ~3;
-        memset(&rodata[end], padval, pad_end - end);
+        memset(&rodata[end], job.padval, pad_end - end);
         end = pad_end;
     }
 }
 
-void Options::WriteNarc(vector<unsigned char> &rodata, vector<uint32_t> &sizes) {
-    if (!flatten) {
+void Converter::WriteNarc(vector<unsigned char> &rodata, vector<uint32_t> &sizes) {
+    if (!job.flatten) {
         FileImages fimg(rodata);
         FileNameTableEntry fntent;
         FileNameTable fnt;
@@ -96,9 +162,9 @@ void Options::WriteNarc(vector<unsigned char> &rodata, vector<uint32_t> &sizes)
     narcfile.write((char *)rodata.data(), rodata.size());
 }
 
-void Options::WriteNaix(vector<uint32_t> &sizes) {
-    if (naix) {
-        string naixname = posargs[1].substr(0, posargs[1].find_last_of('.')) + ".naix";
+void Converter::WriteNaix(vector<uint32_t> &sizes) {
+    if (job.naix) {
+        string naixname = job.outfile.substr(0, job.outfile.find_last_of('.')) + ".naix";
         string stem = naixname.substr(naixname.find_last_of('/') + 1, naixname.find_last_of('.') - naixname.find_last_of('/') - 1);
         string stem_upper = stem;
         for (auto &c : stem_upper) { c = toupper(c); }
@@ -129,13 +195,52 @@ void Options::WriteNaix(vector<uint32_t> &sizes) {
     }
 }
 
-int Options::main() {
+void Converter::Run() {
     vector<uint32_t> sizes;
     vector<unsigned char> rodata;
 
+    objfile.open(job.infile);
     ReadObjectFile(rodata, sizes);
     OverwritePadding(rodata, sizes);
+    narcfile.open(job.outfile, ios::out | ios::binary);
     WriteNarc(rodata, sizes);
     WriteNaix(sizes);
-    return 0;
+}
+
+int Options::main() {
+    if (nthreads == 0) {
+        nthreads = max(1u, thread::hardware_concurrency());
+    }
+    nthreads = min<size_t>(nthreads, jobs.size());
+
+    // Objects are independent, so hand them out to workers one at a time.
+    // Failures are collected per object and reported in command line order.
+    vector<string> errors(jobs.size());
+    atomic<size_t> next(0);
+    auto worker = [&]() {
+        for (size_t i = next++; i < jobs.size(); i = next++) {
+            try {
+                Converter(jobs[i]).Run();
+            } catch (const exception &e) {
+                errors[i] = jobs[i].infile + ": " + e.what();
+            }
+        }
+    };
+    vector<thread> threads;
+    for (unsigned i = 1; i < nthreads; i++) {
+        threads.emplace_back(worker);
+    }
+    worker();
+    for (auto &t : threads) {
+        t.join();
+    }
+
+    int ret = 0;
+    for (const auto &error : errors) {
+        if (!error.empty()) {
+            cerr << error << endl;
+            ret = 1;
+        }
+    }
+    return ret;
 }
@@ -1,24 +1,31 @@
 #ifndef GUARD_OPTIONS_H
 #define GUARD_OPTIONS_H
 
+#include <fstream>
 #include <string>
+#include <vector>
 #include "RelocElfReader.h"
 
 using namespace std;
 
 class command_error : public exception {
-    const char *_what;
+    string _what;
 public:
-    explicit command_error(const char *s) {_what = s;}
-    explicit command_error(const string &s) {_what = s.c_str();}
-    const char *what() const noexcept override { return _what; }
+    explicit command_error(const char *s) : _what(s) {}
+    explicit command_error(const string &s) : _what(s) {}
+    const char *what() const noexcept override { return _what.c_str(); }
 };
 
-class Options {
-    vector<string> posargs;
+struct ConvertJob {
+    string infile;
+    string outfile;
     bool flatten = false;
     bool naix = false;
     char padval = '\xFF';
+};
+
+class Converter {
+    const ConvertJob &job;
     Elf objfile;
     ofstream narcfile;
 
@@ -26,6 +33,17 @@ class Options {
     void OverwritePadding(vector<unsigned char> &rodata, vector<uint32_t> &sizes) const;
     void WriteNarc(vector<unsigned char> &rodata, vector<uint32_t> &sizes);
     void WriteNaix(vector<uint32_t> &sizes);
+public:
+    explicit Converter(const ConvertJob &job) : job(job) {}
+    void Run();
+};
+
+class Options {
+    vector<ConvertJob> jobs;
+    unsigned nthreads = 0;
+
+    bool ParseFlag(const vector<string> &args, size_t &i, ConvertJob &job);
+    void ReadResponseFile(const string &filename, const ConvertJob &defaults);
 public:
     Options(int argc, char ** argv);
     int main();
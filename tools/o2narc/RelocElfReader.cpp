@@ -1,68 +1,148 @@
 #include <cstring>
-#include <algorithm>
+#include <fstream>
 #include "RelocElfReader.h"
 
-Elf::Elf(const string &filename, ios::openmode openmode) {
-    open(filename, openmode);
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+Elf::Elf(const string &filename) {
+    open(filename);
 }
 
-void Elf::open(const string &filename, ios::openmode openmode) {
-    handle.open(filename, openmode);
-    ELF_ASSERT(handle.good());
-    handle.read((char *)&ehdr, sizeof(Elf32_Ehdr));
+void Elf::open(const string &filename) {
+    close();
+#ifndef _WIN32
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    ELF_ASSERT(fd >= 0);
+    struct stat st;
+    if (fstat(fd, &st) == 0 && st.st_size != 0) {
+        void *p = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (p != MAP_FAILED) {
+            image = static_cast<const unsigned char *>(p);
+            image_size = st.st_size;
+            mapped = true;
+        }
+    }
+    ::close(fd);
+#endif
+    if (!mapped) {
+        ifstream handle(filename, ios::in | ios::binary | ios::ate);
+        ELF_ASSERT(handle.good());
+        buffer.resize(handle.tellg());
+        handle.seekg(0);
+        handle.read((char *)buffer.data(), buffer.size());
+        ELF_ASSERT(handle.good());
+        image = buffer.data();
+        image_size = buffer.size();
+    }
+
+    memcpy(&ehdr, FileData(0, sizeof(Elf32_Ehdr)), sizeof(Elf32_Ehdr));
     ELF_ASSERT(memcmp(ehdr.e_ident, ELFMAG, SELFMAG) == 0);
     ELF_ASSERT(ehdr.e_ident[EI_CLASS] == ELFCLASS32);
     ELF_ASSERT(ehdr.e_ident[EI_DATA] == ELFDATA2LSB);
     ELF_ASSERT(ehdr.e_ident[EI_VERSION] == EV_CURRENT);
     ELF_ASSERT(ehdr.e_ehsize == sizeof(Elf32_Ehdr));
     shdr.resize(ehdr.e_shnum);
-    handle.seekg(ehdr.e_shoff);
-    handle.read((char *)shdr.data(), static_cast<streamsize>(ehdr.e_shnum * sizeof(Elf32_Shdr)));
+    memcpy(shdr.data(), FileData(ehdr.e_shoff, ehdr.e_shnum * sizeof(Elf32_Shdr)), ehdr.e_shnum * sizeof(Elf32_Shdr));
+    uint32_t strtab_size = 0, shstrtab_size = 0;
     for (const auto & sec : shdr) {
         switch (sec.sh_type) {
         case SHT_STRTAB: {
-            char *&_strtab = (&sec - shdr.data() == ehdr.e_shstrndx) ? shstrtab : strtab;
+            bool is_shstrtab = &sec - shdr.data() == ehdr.e_shstrndx;
+            const char *&_strtab = is_shstrtab ? shstrtab : strtab;
             ELF_ASSERT(_strtab == nullptr);
-            _strtab = new char[sec.sh_size];
-            handle.seekg(sec.sh_offset);
-            handle.read(_strtab, sec.sh_size);
+            _strtab = (const char *)SectionData(sec);
+            (is_shstrtab ? shstrtab_size : strtab_size) = sec.sh_size;
+            // Every name must terminate inside the table
+            ELF_ASSERT(sec.sh_size != 0 && _strtab[sec.sh_size - 1] == '\0');
             break;
         }
         case SHT_SYMTAB:
             ELF_ASSERT(sym.empty());
             sym.resize(sec.sh_size / sizeof(Elf32_Sym));
-            handle.seekg(sec.sh_offset);
-            handle.read((char *)sym.data(), sec.sh_size);
+            memcpy(sym.data(), SectionData(sec), sym.size() * sizeof(Elf32_Sym));
             break;
         }
     }
+    ELF_ASSERT(shstrtab != nullptr);
+
+    // First definition wins, matching a linear search from the start
+    section_index.reserve(shdr.size());
+    for (size_t i = 0; i < shdr.size(); i++) {
+        ELF_ASSERT(shdr[i].sh_name < shstrtab_size);
+        section_index.emplace(GetSectionName(shdr[i]), i);
+    }
+    if (!sym.empty()) {
+        ELF_ASSERT(strtab != nullptr);
+        symbol_index.reserve(sym.size());
+        for (size_t i = 0; i < sym.size(); i++) {
+            ELF_ASSERT(sym[i].st_name < strtab_size);
+            symbol_index.emplace(GetSymbolName(sym[i]), i);
+        }
+    }
+}
+
+void Elf::close() {
+#ifndef _WIN32
+    if (mapped) {
+        munmap(const_cast<unsigned char *>(image), image_size);
+    }
+#endif
+    buffer.clear();
+    image = nullptr;
+    image_size = 0;
+    mapped = false;
+    shdr.clear();
+    sym.clear();
+    strtab = nullptr;
+    shstrtab = nullptr;
+    section_index.clear();
+    symbol_index.clear();
 }
 
 Elf::~Elf() {
-    delete[] strtab;
-    delete[] shstrtab;
+    close();
+}
+
+const unsigned char *Elf::FileData(size_t offset, size_t size) const {
+    ELF_ASSERT(offset <= image_size && size <= image_size - offset);
+    return image + offset;
+}
+
+const unsigned char *Elf::SectionData(const Elf32_Shdr &sec) const {
+    if (sec.sh_type == SHT_NOBITS) {
+        return nullptr;
+    }
+    return FileData(sec.sh_offset, sec.sh_size);
+}
+
+const unsigned char *Elf::SymbolData(const Elf32_Sym &symbol) const {
+    ELF_ASSERT(symbol.st_shndx < shdr.size());
+    const Elf32_Shdr &sec = shdr[symbol.st_shndx];
+    ELF_ASSERT(symbol.st_value >= sec.sh_addr && symbol.st_value - sec.sh_addr + symbol.st_size <= sec.sh_size);
+    return FileData(symbol.st_value - sec.sh_addr + sec.sh_offset, symbol.st_size);
 }
 
 Elf32_Shdr &Elf::GetSectionHeader(const char *name) {
-    return *find_if(shdr.begin(), shdr.end(), [=](const Elf32_Shdr &sec) {
-        return strcmp(shstrtab + sec.sh_name, name) == 0;
-    } );
+    auto it = section_index.find(name);
+    ELF_ASSERT(it != section_index.end());
+    return shdr[it->second];
 }
 
-bool Elf::HasSection(const char *name) {
-    return any_of(shdr.begin(), shdr.end(), [=](const Elf32_Shdr &sec) {
-        return strcmp(shstrtab + sec.sh_name, name) == 0;
-    } );
+bool Elf::HasSection(const char *name) const {
+    return section_index.count(name) != 0;
 }
 
 Elf32_Sym &Elf::GetSymbol(const char *name) {
-    return *find_if(sym.begin(), sym.end(), [=](const Elf32_Sym &symbol) {
-        return strcmp(strtab + symbol.st_name, name) == 0;
-    });
+    auto it = symbol_index.find(name);
+    ELF_ASSERT(it != symbol_index.end());
+    return sym[it->second];
 }
 
-bool Elf::HasSymbol(const char *name) {
-    return any_of(sym.begin(), sym.end(), [=](const Elf32_Sym &symbol) {
-        return strcmp(strtab + symbol.st_name, name) == 0;
-    });
+bool Elf::HasSymbol(const char *name) const {
+    return symbol_index.count(name) != 0;
 }
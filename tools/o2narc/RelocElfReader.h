@@ -1,7 +1,9 @@
 #ifndef GUARD_RELOCELFREADER_H
 #define GUARD_RELOCELFREADER_H
 
-#include <fstream>
+#include <cstring>
+#include <string>
+#include <unordered_map>
 #include <vector>
 #include "elf.h"
 
@@ -9,38 +11,72 @@ using namespace std;
 
 
 class elf_exception : public exception {
-    const char *_what;
+    string _what;
 public:
-    explicit elf_exception(const char *s) {_what = s;}
-    explicit elf_exception(const string &s) {_what = s.c_str();}
-    const char *what() const noexcept override { return _what; }
+    explicit elf_exception(const char *s) : _what(s) {}
+    explicit elf_exception(const string &s) : _what(s) {}
+    const char *what() const noexcept override { return _what.c_str(); }
 };
 
 #define ELF_ASSERT(expr) do {if(!(expr)) {throw elf_exception("ELF_ASSERT(" #expr ") failed");}} while (0)
 
+// Hash and compare NUL-terminated names in place, so the indices below can key
+// straight into the string tables of the mapped file.
+struct CStrHash {
+    size_t operator()(const char *s) const {
+        uint32_t h = 2166136261u;
+        for (; *s != '\0'; s++) {
+            h = (h ^ static_cast<unsigned char>(*s)) * 16777619u;
+        }
+        return h;
+    }
+};
+
+struct CStrEqual {
+    bool operator()(const char *a, const char *b) const { return strcmp(a, b) == 0; }
+};
+
 class Elf {
-    fstream handle;
+    // The whole object file, mapped read-only (or read into buffer where
+    // mmap is not available). Headers and tables are views into it.
+    const unsigned char *image = nullptr;
+    size_t image_size = 0;
+    bool mapped = false;
+    vector<unsigned char> buffer;
+
     Elf32_Ehdr ehdr {};
     vector<Elf32_Shdr> shdr;
     vector<Elf32_Sym> sym;
-    char *strtab = nullptr;
-    char *shstrtab = nullptr;
+    const char *strtab = nullptr;
+    const char *shstrtab = nullptr;
+    unordered_map<const char *, size_t, CStrHash, CStrEqual> section_index;
+    unordered_map<const char *, size_t, CStrHash, CStrEqual> symbol_index;
+
+    void close();
+    const unsigned char *FileData(size_t offset, size_t size) const;
 public:
     Elf() = default;
-    explicit Elf(const string &filename, ios::openmode openmode = ios::in | ios::binary);
-    void open(const string &filename, ios::openmode openmode = ios::in | ios::binary);
+    explicit Elf(const string &filename);
+    void open(const string &filename);
     ~Elf();
+    Elf(const Elf &) = delete;
+    Elf &operator=(const Elf &) = delete;
     bool is_open() const {
-        return handle.is_open();
+        return image != nullptr;
     }
     Elf32_Shdr &GetSectionHeader(const char *name);
     Elf32_Shdr &GetSectionHeader(const string &name) { return GetSectionHeader(name.c_str()); }
-    bool HasSection(const char *name);
-    bool HasSection(const string &name) { return HasSection(name.c_str()); }
+    bool HasSection(const char *name) const;
+    bool HasSection(const string &name) const { return HasSection(name.c_str()); }
     Elf32_Sym &GetSymbol(const char *name);
     Elf32_Sym &GetSymbol(const string &name) { return GetSymbol(name.c_str()); }
-    bool HasSymbol(const char *name);
-    bool HasSymbol(const string &name) { return HasSymbol(name.c_str()); }
+    bool HasSymbol(const char *name) const;
+    bool HasSymbol(const string &name) const { return HasSymbol(name.c_str()); }
+
+    // Pointers into the mapped image; valid until the Elf is closed
+    const unsigned char *SectionData(const Elf32_Shdr &sec) const;
+    const unsigned char *SymbolData(const Elf32_Sym &symbol) const;
+
     template <typename T>
     T *ReadSectionData(const Elf32_Shdr &sec, T *dest = nullptr) {
         if (dest == nullptr) {
@@ -49,8 +85,7 @@ public:
             }
             dest = new T[sec.sh_size];
         }
-        handle.seekg(sec.sh_offset);
-        handle.read((char *)dest, sec.sh_size);
+        memcpy(dest, SectionData(sec), sec.sh_size);
         return dest;
     }
 
@@ -62,8 +97,7 @@ public:
             }
             dest = new T[symbol.st_size];
         }
-        handle.seekg(symbol.st_value - shdr[symbol.st_shndx].sh_addr + shdr[symbol.st_shndx].sh_offset);
-        handle.read((char *)dest, symbol.st_size);
+        memcpy(dest, SymbolData(symbol), symbol.st_size);
         return dest;
     }
 
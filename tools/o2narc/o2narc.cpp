@@ -10,15 +10,17 @@
 using namespace std;
 
 static inline void usage() {
-    cout << "Usage: o2narc [-f|--flatten] infile outfile" << endl;
+    cout << "Usage: o2narc [-f|--flatten] infile outfile [infile outfile...] [@rspfile...]" << endl;
     cout << endl;
     cout << "Arguments:" << endl;
     cout << "\tinfile\tELF object file with symbols __size and __data" << endl;
     cout << "\toutfile\tOutput NARC file" << endl;
+    cout << "\t@rspfile\tFile with one \"[options] infile outfile\" conversion per line" << endl;
     cout << "Options:" << endl;
     cout << "\t-f|--flatten\tDon't generate NARC headers" << endl;
     cout << "\t-n|--naix\tCreate a NARC index header" << endl;
     cout << "\t-p PAD|--padding PAD\tPad with byte value (default: 255)" << endl;
+    cout << "\t-j N|--jobs N\tConvert up to N objects at once (default: all cores)" << endl;
 }
 
 int main(int argc, char ** argv) {
@@ -0,0 +1,54 @@
+// poke_overlay.c as the game builds it, with or without
+// OPTIMIZE_OVERLAY_PREFETCH. The Makefile compiles this file once per
+// variant with OVY_PREFIX set and hides everything but the functions below,
+// so that both copies of poke_overlay.c can be linked into one program.
+
+// HW_DTCM is a linker symbol on the DS; only the overlay loader reads it here
+#undef HW_DTCM
+#define HW_DTCM 0x027E0000
+
+#include "../../src/poke_overlay.c"
+
+#pragma GCC visibility push(default)
+#include "ovyreplay.h"
+
+#define OVY_CAT_(a, b) a##b
+#define OVY_CAT(a, b) OVY_CAT_(a, b)
+#define OVY_FUNC(name) OVY_CAT(OVY_PREFIX, name)
+
+void OVY_FUNC(Reset)(void) {
+    MI_CpuClear8(sOverlayRegions, sizeof(sOverlayRegions));
+#ifdef OPTIMIZE_OVERLAY_PREFETCH
+    MI_CpuClear8(sLearnedTransitions, sizeof(sLearnedTransitions));
+    sNumLearnedTransitions = 0;
+    sLearnedTransitionsPos = 0;
+    sLastLoadedOverlay = FS_OVERLAY_ID_NONE;
+    MI_CpuClear8(&sOverlayPrefetch, sizeof(sOverlayPrefetch));
+    MI_CpuClear8(&sOverlayLoadStats, sizeof(sOverlayLoadStats));
+#endif //OPTIMIZE_OVERLAY_PREFETCH
+}
+
+int OVY_FUNC(Load)(uint32_t id, int loadType) {
+    return HandleLoadOverlay(id, (PMOverlayLoadType)loadType);
+}
+
+void OVY_FUNC(Unload)(uint32_t id) {
+    UnloadOverlayByID(id);
+}
+
+void OVY_FUNC(Prefetch)(void) {
+#ifdef OPTIMIZE_OVERLAY_PREFETCH
+    HandleOverlayPrefetch();
+#endif //OPTIMIZE_OVERLAY_PREFETCH
+}
+
+void OVY_FUNC(GetPrefetchStats)(uint32_t *hits, uint32_t *drops) {
+#ifdef OPTIMIZE_OVERLAY_PREFETCH
+    *hits = sOverlayLoadStats.prefetchHits;
+    *drops = sOverlayLoadStats.prefetchDrops;
+#else
+    *hits = 0;
+    *drops = 0;
+#endif //OPTIMIZE_OVERLAY_PREFETCH
+}
+#pragma GCC visibility pop
@@ -0,0 +1,14 @@
+#ifndef GUARD_OVYREPLAY_HOST32_OVERLAY_H
+#define GUARD_OVYREPLAY_HOST32_OVERLAY_H
+
+// The game's FS_OVERLAY_ID is the address of a symbol the linker sets to the
+// overlay's number, which a 64-bit host cannot truncate in a constant
+// initializer. Take the numbers from overlay_ids.h, made from main.lsf.
+#include_next <nitro/fs/overlay.h>
+#include "overlay_ids.h"
+#undef FS_EXTERN_OVERLAY
+#undef FS_OVERLAY_ID
+#define FS_EXTERN_OVERLAY(name) extern char SDK_OVERLAY_ ## name ## _DECLARED
+#define FS_OVERLAY_ID(name) ((u32)SDK_OVERLAY_ ## name ## _NUM)
+
+#endif //GUARD_OVYREPLAY_HOST32_OVERLAY_H
@@ -0,0 +1,262 @@
+#include "global.h"
+#include "ovyreplay.h"
+
+// The parts of the NitroSDK overlay loader and file system that
+// poke_overlay.c calls, over a model of the card and of main RAM. Every
+// overlay image is a byte pattern of its own, so a started overlay whose RAM
+// was written by something else is caught. Reads queue on the card one at a
+// time; an async read fills its RAM when it finishes, and the RAM it will
+// fill must not be written while it is in flight.
+
+#define HOST_RAM_START      0x02000000
+#define HOST_RAM_SIZE       0x00400000
+#define HOST_MAX_READS      4
+
+typedef struct HostRead {
+    FSFile *file;
+    u32 id;
+    u64 endTick;
+} HostRead;
+
+static OvyImage sImages[OVY_MAX];
+static int sNumImages;
+static double sOpenUs;
+static double sCardMBps;
+static u8 sRam[HOST_RAM_SIZE];
+static BOOL sStarted[OVY_MAX];
+static HostRead sReads[HOST_MAX_READS];
+static int sNumReads;
+static u64 sTicks;
+static u64 sCardFreeTick;
+static OvyIo sIo;
+
+static u8 ImageByte(u32 id, u32 offset) {
+    u32 x = (offset + 1) * 0x9E3779B1 ^ (id + 1) * 0x85EBCA6B;
+    x ^= x >> 15;
+    return (u8)(x * 0x2C1B3C6D >> 24);
+}
+
+static BOOL Overlaps(u32 id1, u32 id2) {
+    const OvyImage *a = &sImages[id1];
+    const OvyImage *b = &sImages[id2];
+    return a->ramAddress < b->ramAddress + b->ramSize + b->bssSize && b->ramAddress < a->ramAddress + a->ramSize + a->bssSize;
+}
+
+void Ovy_SetLayout(const OvyImage *images, int count) {
+    int i;
+
+    GF_ASSERT(count <= OVY_MAX);
+    for (i = 0; i < count; i++) {
+        GF_ASSERT(images[i].ramAddress >= HOST_RAM_START);
+        GF_ASSERT(images[i].ramAddress + images[i].ramSize + images[i].bssSize <= HOST_RAM_START + HOST_RAM_SIZE);
+        sImages[i] = images[i];
+    }
+    sNumImages = count;
+}
+
+void Ovy_SetCard(double openUs, double cardMBps) {
+    sOpenUs = openUs;
+    sCardMBps = cardMBps;
+}
+
+void Ovy_Reset(void) {
+    MI_CpuFill8(sRam, 0, sizeof(sRam));
+    MI_CpuFill8(sStarted, 0, sizeof(sStarted));
+    MI_CpuFill8(&sIo, 0, sizeof(sIo));
+    sNumReads = 0;
+    sTicks = 0;
+    sCardFreeTick = 0;
+}
+
+uint64_t Ovy_GetTicks(void) {
+    return sTicks;
+}
+
+void Ovy_GetIo(OvyIo *io) {
+    *io = sIo;
+}
+
+OSTick OS_GetTick(void) {
+    return sTicks;
+}
+
+// Writing an overlay's RAM, to clear it or to fill it with its image
+static void WriteRam(u32 id, BOOL image) {
+    const OvyImage *ovy = &sImages[id];
+    u8 *ram = sRam + (ovy->ramAddress - HOST_RAM_START);
+    u32 i;
+
+    for (i = 0; i < (u32)sNumImages; i++) {
+        if (i != id && sStarted[i] && Overlaps(i, id)) {
+            sIo.clobbers++;
+        }
+    }
+    for (i = 0; i < ovy->ramSize; i++) {
+        ram[i] = image ? ImageByte(id, i) : 0;
+    }
+    MI_CpuFill8(ram + ovy->ramSize, 0, ovy->bssSize);
+}
+
+// Writing RAM that an async read in flight is going to fill
+static void CheckRace(u32 id) {
+    int i;
+
+    for (i = 0; i < sNumReads; i++) {
+        if (Overlaps(sReads[i].id, id)) {
+            sIo.races++;
+        }
+    }
+}
+
+static void FinishRead(int i) {
+    HostRead read = sReads[i];
+
+    sReads[i] = sReads[--sNumReads];
+    WriteRam(read.id, TRUE);
+    read.file->stat &= ~FS_FILE_STATUS_BUSY;
+}
+
+// Finishes every async read that is done by the clock, in the order the card
+// does them
+static void FinishReadsDue(void) {
+    int i, first;
+
+    for (;;) {
+        first = -1;
+        for (i = 0; i < sNumReads; i++) {
+            if (sReads[i].endTick <= sTicks && (first < 0 || sReads[i].endTick < sReads[first].endTick)) {
+                first = i;
+            }
+        }
+        if (first < 0) {
+            return;
+        }
+        FinishRead(first);
+    }
+}
+
+void Ovy_AdvanceFrame(void) {
+    sTicks += (u64)(OVY_TICKS_PER_US * 1000000 / 60);
+    FinishReadsDue();
+}
+
+// Queues an image read on the card and returns when it will be done
+static u64 QueueRead(u32 id) {
+    u64 start = sCardFreeTick > sTicks ? sCardFreeTick : sTicks;
+
+    sCardFreeTick = start + (u64)(OVY_TICKS_PER_US * (sOpenUs + sImages[id].ramSize / sCardMBps));
+    sIo.reads++;
+    sIo.bytesRead += sImages[id].ramSize;
+    return sCardFreeTick;
+}
+
+BOOL FS_LoadOverlayInfo(FSOverlayInfo *p_ovi, MIProcessor target, FSOverlayID id) {
+    GF_ASSERT(target == MI_PROCESSOR_ARM9);
+    if (id >= (u32)sNumImages) {
+        return FALSE;
+    }
+    MI_CpuFill8(p_ovi, 0, sizeof(FSOverlayInfo));
+    p_ovi->header.id = id;
+    p_ovi->header.ram_address = (u8 *)(uintptr_t)sImages[id].ramAddress;
+    p_ovi->header.ram_size = sImages[id].ramSize;
+    p_ovi->header.bss_size = sImages[id].bssSize;
+    p_ovi->target = target;
+    return TRUE;
+}
+
+// The SDK clears the overlay's RAM before it starts the read
+BOOL FS_LoadOverlayImage(FSOverlayInfo *p_ovi) {
+    u32 id = p_ovi->header.id;
+
+    CheckRace(id);
+    WriteRam(id, FALSE);
+    sTicks = QueueRead(id);
+    FinishReadsDue();
+    WriteRam(id, TRUE);
+    return TRUE;
+}
+
+BOOL FS_LoadOverlayImageAsync(FSOverlayInfo *p_ovi, FSFile *p_file) {
+    u32 id = p_ovi->header.id;
+
+    GF_ASSERT(sNumReads < HOST_MAX_READS);
+    CheckRace(id);
+    WriteRam(id, FALSE);
+    sReads[sNumReads].file = p_file;
+    sReads[sNumReads].id = id;
+    sReads[sNumReads].endTick = QueueRead(id);
+    sNumReads++;
+    sIo.asyncReads++;
+    p_file->stat |= FS_FILE_STATUS_BUSY;
+    return TRUE;
+}
+
+void FS_StartOverlay(FSOverlayInfo *p_ovi) {
+    u32 id = p_ovi->header.id;
+    const u8 *ram = sRam + (sImages[id].ramAddress - HOST_RAM_START);
+    u32 i;
+
+    for (i = 0; i < sImages[id].ramSize; i++) {
+        if (ram[i] != ImageByte(id, i)) {
+            sIo.badStarts++;
+            break;
+        }
+    }
+    sStarted[id] = TRUE;
+}
+
+BOOL FS_LoadOverlay(MIProcessor target, FSOverlayID id) {
+    FSOverlayInfo info;
+
+    if (!FS_LoadOverlayInfo(&info, target, id) || !FS_LoadOverlayImage(&info)) {
+        return FALSE;
+    }
+    FS_StartOverlay(&info);
+    return TRUE;
+}
+
+BOOL FS_UnloadOverlay(MIProcessor target, FSOverlayID id) {
+    GF_ASSERT(target == MI_PROCESSOR_ARM9 && id < (u32)sNumImages);
+    sStarted[id] = FALSE;
+    return TRUE;
+}
+
+int Ovy_LoadDirect(uint32_t id) {
+    return FS_LoadOverlay(MI_PROCESSOR_ARM9, id);
+}
+
+void Ovy_UnloadDirect(uint32_t id) {
+    FS_UnloadOverlay(MI_PROCESSOR_ARM9, id);
+}
+
+void FS_InitFile(FSFile *p_file) {
+    MI_CpuFill8(p_file, 0, sizeof(FSFile));
+}
+
+BOOL FS_CloseFile(FSFile *p_file) {
+    GF_ASSERT(!(p_file->stat & FS_FILE_STATUS_BUSY));
+    return TRUE;
+}
+
+BOOL FS_WaitAsync(FSFile *p_file) {
+    int i;
+
+    for (i = 0; i < sNumReads; i++) {
+        if (sReads[i].file == p_file) {
+            if (sReads[i].endTick > sTicks) {
+                sTicks = sReads[i].endTick;
+            }
+            FinishReadsDue();
+            break;
+        }
+    }
+    return TRUE;
+}
+
+u32 FS_SetDefaultDMA(u32 dma_no) {
+    return FS_DMA_NOT_USE;
+}
+
+void MI_CpuFill8(void *dest, u8 data, u32 size) {
+    __builtin_memset(dest, data, size);
+}
@@ -0,0 +1,1475 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stdnoreturn.h>
+#include <stdarg.h>
+#include <ctype.h>
+#include <errno.h>
+#include <unistd.h>
+#include "ovyreplay.h"
+
+// Where the layout and the call sites are read from, relative to the
+// repository root
+#define LSF_PATH            "main.lsf"
+#define TABLE_PATH          "src/data/overlay_transitions.h"
+#define PREFETCH_SOURCE     "src/poke_overlay.c"
+
+#define MAX_OBJECTS         256
+#define MAX_NAME            32
+#define MAX_EVENTS          (1 << 20)
+#define OVY_STATIC          (-1)
+
+#define RAM_START           0x02000000
+#define RAM_END             0x02400000
+#define OVERLAY_ALIGN       32
+
+#define DEFAULT_STEPS       20000
+#define DEFAULT_OPEN_US     200.0
+#define DEFAULT_CARD_MBPS   4.0
+
+// OVY_LOAD_ in poke_overlay.h
+enum
+{
+    LOAD_NORMAL,
+    LOAD_NOINIT,
+    LOAD_ASYNC,
+};
+
+typedef struct Overlay
+{
+    char name[MAX_NAME];
+    int after;                // OVY_STATIC for main
+    int numObjects;
+    char * objects[MAX_OBJECTS];
+    uint32_t size;            // estimated from the sources
+    uint32_t bssSize;
+    uint32_t address;
+} Overlay;
+
+// What each overlay's code loads: sites[from][to] call sites load or
+// register overlay to from overlay from, directSites load it with
+// FS_LoadOverlay
+typedef struct CallSites
+{
+    uint16_t sites[OVY_MAX][OVY_MAX];
+    uint16_t directSites[OVY_MAX][OVY_MAX];
+    uint32_t staticSites;
+    uint32_t unloadSites;
+} CallSites;
+
+typedef enum EventType
+{
+    EVENT_LOAD,
+    EVENT_UNLOAD,
+    EVENT_DIRECT,
+    EVENT_UNDIRECT,
+    EVENT_FRAMES,
+} EventType;
+
+typedef struct Event
+{
+    uint8_t type;
+    uint8_t loadType;
+    uint16_t arg;             // overlay, or frame count
+} Event;
+
+typedef struct Trace
+{
+    int numEvents;
+    Event * events;
+} Trace;
+
+typedef struct Variant
+{
+    const char * name;
+    void (*reset)(void);
+    int (*load)(uint32_t id, int loadType);
+    void (*unload)(uint32_t id);
+    void (*prefetch)(void);
+    void (*getPrefetchStats)(uint32_t * hits, uint32_t * drops);
+} Variant;
+
+typedef struct ReplayResult
+{
+    uint32_t loads;
+    uint32_t failedLoads;
+    uint32_t prefetchHits;
+    uint32_t prefetchDrops;
+    uint64_t stallTicks;
+    uint64_t ticks;
+    OvyIo io;
+    uint8_t * loadResults;
+} ReplayResult;
+
+static const Variant kVariants[] = {
+    { "as shipped", OvyBase_Reset, OvyBase_Load, OvyBase_Unload, OvyBase_Prefetch, OvyBase_GetPrefetchStats },
+    { "prefetch", OvyPrefetch_Reset, OvyPrefetch_Load, OvyPrefetch_Unload, OvyPrefetch_Prefetch, OvyPrefetch_GetPrefetchStats },
+};
+
+static int sNumOverlays;
+static Overlay sOverlays[OVY_MAX];
+static uint32_t sStaticSize;
+static CallSites sCallSites;
+
+static inline noreturn __attribute__((format(printf, 1, 2))) void fatal_error(const char * message, ...)
+{
+    va_list va_args;
+    va_start(va_args, message);
+    fputs("Error: ", stderr);
+    vfprintf(stderr, message, va_args);
+    fputc('\n', stderr);
+    va_end(va_args);
+    exit(EXIT_FAILURE);
+}
+
+// GF_ASSERT in the game objects, which are built with PM_KEEP_ASSERTS
+void GF_AssertFail(void)
+{
+    fatal_error("GF_ASSERT failed in the game code");
+}
+
+static uint32_t ParseU32(const char * arg)
+{
+    char * end;
+    unsigned long long val = strtoull(arg, &end, 0);
+    if (*arg == '\0' || *end != '\0' || val > 0xFFFFFFFFull)
+    {
+        fatal_error("invalid number: %s", arg);
+    }
+    return (uint32_t)val;
+}
+
+static double ParseDouble(const char * arg)
+{
+    char * end;
+    double val = strtod(arg, &end);
+    if (*arg == '\0' || *end != '\0' || !(val > 0))
+    {
+        fatal_error("invalid number: %s", arg);
+    }
+    return val;
+}
+
+static uint32_t Random(uint32_t * state)
+{
+    uint32_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return *state = x;
+}
+
+// ---------------------------------------------------------------------------
+// Layout
+
+static char * ReadWholeFile(const char * root, const char * relPath, size_t * size, bool mustExist)
+{
+    char path[4096];
+    snprintf(path, sizeof(path), "%s/%s", root, relPath);
+    FILE * file = fopen(path, "rb");
+    if (file == NULL)
+    {
+        if (!mustExist)
+        {
+            return NULL;
+        }
+        fatal_error("%s: %s", path, strerror(errno));
+    }
+    fseek(file, 0, SEEK_END);
+    long length = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    char * buffer = malloc(length + 1);
+    if (buffer == NULL)
+    {
+        fatal_error("out of memory reading %s", path);
+    }
+    if (fread(buffer, 1, length, file) != (size_t)length)
+    {
+        fatal_error("%s: short read", path);
+    }
+    fclose(file);
+    buffer[length] = '\0';
+    *size = length;
+    return buffer;
+}
+
+static const char * FindRoot(void)
+{
+    static const char * const candidates[] = { ".", "..", "../.." };
+    for (size_t i = 0; i < sizeof(candidates) / sizeof(candidates[0]); i++)
+    {
+        char path[4096];
+        snprintf(path, sizeof(path), "%s/%s", candidates[i], PREFETCH_SOURCE);
+        if (access(path, R_OK) == 0)
+        {
+            return candidates[i];
+        }
+    }
+    return NULL;
+}
+
+static int FindOverlay(const char * name)
+{
+    char * end;
+    long id = strtol(name, &end, 0);
+    if (*name != '\0' && *end == '\0')
+    {
+        return id >= 0 && id < sNumOverlays ? (int)id : -1;
+    }
+    for (int i = 0; i < sNumOverlays; i++)
+    {
+        if (strcmp(sOverlays[i].name, name) == 0)
+        {
+            return i;
+        }
+    }
+    return -1;
+}
+
+// The source an object in main.lsf is built from, or NULL if the tree does
+// not have it
+static char * ReadObjectSource(const char * root, const char * object, bool * isAsm)
+{
+    static const char * const kExtensions[] = { ".s", ".c" };
+    char path[4096];
+    size_t size;
+    size_t len = strlen(object);
+    if (len < 2 || strcmp(object + len - 2, ".o") != 0)
+    {
+        return NULL;
+    }
+    for (int i = 0; i < 2; i++)
+    {
+        snprintf(path, sizeof(path), "%.*s%s", (int)(len - 2), object, kExtensions[i]);
+        char * text = ReadWholeFile(root, path, &size, false);
+        if (text != NULL)
+        {
+            *isAsm = i == 0;
+            return text;
+        }
+    }
+    return NULL;
+}
+
+static uint32_t CountItems(const char * args)
+{
+    uint32_t count = 1;
+    bool quoted = false;
+    for (const char * p = args; *p != '\0' && (quoted || *p != ';'); p++)
+    {
+        if (*p == '"')
+        {
+            quoted = !quoted;
+        }
+        else if (*p == ',' && !quoted)
+        {
+            count++;
+        }
+    }
+    return count;
+}
+
+static uint32_t StringLength(const char * args)
+{
+    const char * start = strchr(args, '"');
+    uint32_t length = 0;
+    if (start == NULL)
+    {
+        return 0;
+    }
+    for (const char * p = start + 1; *p != '\0' && *p != '"'; p++)
+    {
+        if (*p == '\\')
+        {
+            p++;
+        }
+        length++;
+    }
+    return length;
+}
+
+// What an assembly file puts in the overlay: instructions by their mode,
+// data directives by their item counts. The ROM is not built here, so this
+// stands in for the overlay table's sizes; the layout is still placed the
+// way main.lsf places it.
+static void EstimateAsmSize(const char * text, uint32_t * size, uint32_t * bssSize)
+{
+    bool thumb = true;
+    bool bss = false;
+    uint32_t offset[2] = { 0, 0 };
+
+    for (const char * line = text; line != NULL && *line != '\0';)
+    {
+        const char * next = strchr(line, '\n');
+        size_t lineLen = next != NULL ? (size_t)(next - line) : strlen(line);
+        char buffer[1024];
+        char token[64];
+        int len = 0;
+
+        snprintf(buffer, sizeof(buffer), "%.*s", (int)(lineLen < sizeof(buffer) - 1 ? lineLen : sizeof(buffer) - 1), line);
+        line = buffer;
+        const char * p = line;
+
+        // Skip a label at the start of the line
+        while (!isspace((unsigned char)*p) && *p != '\0' && *p != '\n' && *p != ';')
+        {
+            p++;
+        }
+        if (p == line || p[-1] != ':')
+        {
+            p = line;
+        }
+        while (*p == ' ' || *p == '\t')
+        {
+            p++;
+        }
+        while ((isalnum((unsigned char)p[len]) || p[len] == '_' || p[len] == '.') && len < 63)
+        {
+            token[len] = p[len];
+            len++;
+        }
+        token[len] = '\0';
+        const char * args = p + len;
+        uint32_t * at = &offset[bss];
+
+        if (len == 0 || (p == line && token[0] != '.'))
+        {
+            // A blank line, a comment or a label alone
+        }
+        else if (strcmp(token, "thumb_func_start") == 0 || strcmp(token, ".thumb") == 0)
+        {
+            thumb = true;
+        }
+        else if (strcmp(token, "arm_func_start") == 0 || strcmp(token, ".arm") == 0)
+        {
+            thumb = false;
+        }
+        else if (strcmp(token, ".text") == 0 || strcmp(token, ".data") == 0 || strcmp(token, ".rodata") == 0)
+        {
+            bss = false;
+        }
+        else if (strcmp(token, ".bss") == 0)
+        {
+            bss = true;
+        }
+        else if (strcmp(token, ".section") == 0)
+        {
+            bss = strstr(args, "bss") != NULL;
+        }
+        else if (strcmp(token, ".word") == 0 || strcmp(token, ".4byte") == 0)
+        {
+            *at += 4 * CountItems(args);
+        }
+        else if (strcmp(token, ".short") == 0 || strcmp(token, ".hword") == 0 || strcmp(token, ".2byte") == 0)
+        {
+            *at += 2 * CountItems(args);
+        }
+        else if (strcmp(token, ".byte") == 0)
+        {
+            *at += CountItems(args);
+        }
+        else if (strcmp(token, ".space") == 0 || strcmp(token, ".skip") == 0)
+        {
+            *at += strtoul(args, NULL, 0);
+        }
+        else if (strcmp(token, ".ascii") == 0)
+        {
+            *at += StringLength(args);
+        }
+        else if (strcmp(token, ".asciz") == 0)
+        {
+            *at += StringLength(args) + 1;
+        }
+        else if (strcmp(token, ".balign") == 0 || strcmp(token, ".align") == 0)
+        {
+            uint32_t align = strtoul(args, NULL, 0);
+            if (token[1] == 'a')
+            {
+                align = 1u << align;
+            }
+            if (align != 0)
+            {
+                *at = (*at + align - 1) / align * align;
+            }
+        }
+        else if (token[0] != '.' && strstr(token, "_func_") == NULL && strcmp(token, "glob_asm") != 0)
+        {
+            *at += !thumb || strcmp(token, "bl") == 0 || strcmp(token, "blx") == 0 ? 4 : 2;
+        }
+        line = next != NULL ? next + 1 : NULL;
+    }
+    *size += offset[0];
+    *bssSize += offset[1];
+}
+
+// mwcc's output is not at hand either; a statement is counted as six bytes
+// of Thumb
+static void EstimateCSize(const char * text, uint32_t * size)
+{
+    for (const char * p = text; *p != '\0'; p++)
+    {
+        if (*p == ';')
+        {
+            *size += 6;
+        }
+    }
+}
+
+static void EstimateSizes(const char * root, char ** objects, int numObjects, uint32_t * size, uint32_t * bssSize)
+{
+    *size = 0;
+    *bssSize = 0;
+    for (int i = 0; i < numObjects; i++)
+    {
+        bool isAsm;
+        char * text = ReadObjectSource(root, objects[i], &isAsm);
+        if (text == NULL)
+        {
+            continue;
+        }
+        if (isAsm)
+        {
+            EstimateAsmSize(text, size, bssSize);
+        }
+        else
+        {
+            EstimateCSize(text, size);
+        }
+        free(text);
+        *size = (*size + 3) & ~3u;
+    }
+}
+
+// main.lsf numbers the overlays in the order it lists them, and places each
+// after the static module or another overlay
+static void LoadLayout(const char * root)
+{
+    size_t size;
+    char * text = ReadWholeFile(root, LSF_PATH, &size, true);
+    char * staticObjects[4096];
+    int numStaticObjects = 0;
+    char afterNames[OVY_MAX][MAX_NAME];
+    enum { BLOCK_NONE, BLOCK_STATIC, BLOCK_OVERLAY } block = BLOCK_NONE;
+
+    for (char * line = strtok(text, "\n"); line != NULL; line = strtok(NULL, "\n"))
+    {
+        char word[64], arg[256];
+        int n = sscanf(line, " %63s %255s", word, arg);
+        if (n == 2 && strcmp(word, "Static") == 0)
+        {
+            block = BLOCK_STATIC;
+        }
+        else if (n == 2 && strcmp(word, "Autoload") == 0)
+        {
+            block = BLOCK_NONE;
+        }
+        else if (n == 2 && strcmp(word, "Overlay") == 0)
+        {
+            if (sNumOverlays >= OVY_MAX)
+            {
+                fatal_error("%s: more than %d overlays", LSF_PATH, OVY_MAX);
+            }
+            snprintf(sOverlays[sNumOverlays].name, MAX_NAME, "%.31s", arg);
+            afterNames[sNumOverlays][0] = '\0';
+            sNumOverlays++;
+            block = BLOCK_OVERLAY;
+        }
+        else if (n == 2 && strcmp(word, "After") == 0 && block == BLOCK_OVERLAY)
+        {
+            snprintf(afterNames[sNumOverlays - 1], MAX_NAME, "%.31s", arg);
+        }
+        else if (n == 2 && strcmp(word, "Address") == 0 && block == BLOCK_OVERLAY)
+        {
+            fatal_error("%s: %s has a fixed address, which ovyreplay does not place", LSF_PATH, sOverlays[sNumOverlays - 1].name);
+        }
+        else if (n == 2 && strcmp(word, "Object") == 0 && strchr(line, '(') == NULL)
+        {
+            if (block == BLOCK_STATIC && numStaticObjects < 4096)
+            {
+                staticObjects[numStaticObjects++] = strdup(arg);
+            }
+            else if (block == BLOCK_OVERLAY)
+            {
+                Overlay * ovy = &sOverlays[sNumOverlays - 1];
+                if (ovy->numObjects >= MAX_OBJECTS)
+                {
+                    fatal_error("%s: %s has more than %d objects", LSF_PATH, ovy->name, MAX_OBJECTS);
+                }
+                ovy->objects[ovy->numObjects++] = strdup(arg);
+            }
+        }
+    }
+    free(text);
+
+    uint32_t staticBss;
+    EstimateSizes(root, staticObjects, numStaticObjects, &sStaticSize, &staticBss);
+    sStaticSize += staticBss;
+    for (int i = 0; i < numStaticObjects; i++)
+    {
+        free(staticObjects[i]);
+    }
+
+    // main.lsf lists every overlay after the one it follows
+    for (int i = 0; i < sNumOverlays; i++)
+    {
+        Overlay * ovy = &sOverlays[i];
+        uint32_t start;
+        EstimateSizes(root, ovy->objects, ovy->numObjects, &ovy->size, &ovy->bssSize);
+        if (strcmp(afterNames[i], "main") == 0)
+        {
+            ovy->after = OVY_STATIC;
+            start = RAM_START + sStaticSize;
+        }
+        else
+        {
+            ovy->after = FindOverlay(afterNames[i]);
+            if (ovy->after < 0 || ovy->after >= i)
+            {
+                fatal_error("%s: %s is after %s, which is not listed before it", LSF_PATH, ovy->name, afterNames[i]);
+            }
+            const Overlay * prev = &sOverlays[ovy->after];
+            start = prev->address + prev->size + prev->bssSize;
+        }
+        ovy->address = (start + OVERLAY_ALIGN - 1) & ~(OVERLAY_ALIGN - 1);
+        if (ovy->address + ovy->size + ovy->bssSize > RAM_END)
+        {
+            fatal_error("%s does not fit in main RAM as estimated", ovy->name);
+        }
+    }
+}
+
+static bool OverlaysOverlap(int a, int b)
+{
+    const Overlay * x = &sOverlays[a];
+    const Overlay * y = &sOverlays[b];
+    return x->address < y->address + y->size + y->bssSize && y->address < x->address + x->size + x->bssSize;
+}
+
+// ---------------------------------------------------------------------------
+// Call sites
+
+// The overlay named in FS_OVERLAY_ID(name) at p
+static int OverlayAt(const char * p)
+{
+    char name[MAX_NAME];
+    if (sscanf(p, "FS_OVERLAY_ID(%31[A-Za-z0-9_])", name) != 1)
+    {
+        return -1;
+    }
+    int id = FindOverlay(name);
+    if (id < 0)
+    {
+        fatal_error("FS_OVERLAY_ID(%s) names no overlay in %s", name, LSF_PATH);
+    }
+    return id;
+}
+
+typedef enum SiteKind
+{
+    SITE_LOAD,
+    SITE_DIRECT,
+    SITE_UNLOAD,
+} SiteKind;
+
+static void AddSite(int from, int to, SiteKind kind)
+{
+    if (kind == SITE_UNLOAD)
+    {
+        sCallSites.unloadSites++;
+    }
+    else if (from == OVY_STATIC)
+    {
+        sCallSites.staticSites++;
+    }
+    else if (kind == SITE_DIRECT)
+    {
+        sCallSites.directSites[from][to]++;
+    }
+    else
+    {
+        sCallSites.sites[from][to]++;
+    }
+}
+
+static SiteKind KindOfCall(const char * callee)
+{
+    if (strncmp(callee, "FS_LoadOverlay", 14) == 0 && !isalnum((unsigned char)callee[14]) && callee[14] != '_')
+    {
+        return SITE_DIRECT;
+    }
+    if (strncmp(callee, "UnloadOverlayByID", 17) == 0 || strncmp(callee, "FS_UnloadOverlay", 16) == 0)
+    {
+        return SITE_UNLOAD;
+    }
+    return SITE_LOAD;
+}
+
+// A literal pool entry is loaded with "ldr rN, label ; =FS_OVERLAY_ID(name)",
+// and what the code does with it is the next function it calls. An overlay id
+// in a data table, such as an OVY_MGR_TEMPLATE, is a program that is started
+// from here. The pool entries themselves, "label: .word FS_OVERLAY_ID(name)",
+// are counted at their ldr.
+static void ScanAsm(int from, const char * text)
+{
+    const char * line = text;
+    while (line != NULL && *line != '\0')
+    {
+        const char * next = strchr(line, '\n');
+        const char * end = next != NULL ? next : line + strlen(line);
+        const char * ref = strstr(line, "FS_OVERLAY_ID(");
+        const char * p = line;
+        while (*p == ' ' || *p == '\t')
+        {
+            p++;
+        }
+        if (ref == NULL || ref >= end)
+        {
+            // Nothing on this line
+        }
+        else if (strncmp(p, "ldr", 3) == 0 && ref >= p + 3 && strncmp(ref - 3, "; =", 3) == 0)
+        {
+            SiteKind kind = SITE_LOAD;
+            const char * call = next;
+            for (int i = 0; i < 10 && call != NULL; i++)
+            {
+                const char * q = call + 1;
+                while (*q == ' ' || *q == '\t')
+                {
+                    q++;
+                }
+                if (strncmp(q, "bl ", 3) == 0 || strncmp(q, "bl\t", 3) == 0 || strncmp(q, "blx ", 4) == 0)
+                {
+                    kind = KindOfCall(q + (q[2] == 'x' ? 4 : 3));
+                    break;
+                }
+                call = strchr(q, '\n');
+            }
+            AddSite(from, OverlayAt(ref), kind);
+        }
+        else if (strncmp(p, ".word", 5) == 0)
+        {
+            for (; ref != NULL && ref < end; ref = strstr(ref + 1, "FS_OVERLAY_ID("))
+            {
+                AddSite(from, OverlayAt(ref), SITE_LOAD);
+            }
+        }
+        line = next != NULL ? next + 1 : NULL;
+    }
+}
+
+// In C the call and the id are on one line, or the id is in an initializer
+static void ScanC(int from, const char * text)
+{
+    const char * line = text;
+    while (line != NULL && *line != '\0')
+    {
+        const char * next = strchr(line, '\n');
+        size_t len = next != NULL ? (size_t)(next - line) : strlen(line);
+        char buffer[1024];
+        snprintf(buffer, sizeof(buffer), "%.*s", (int)(len < sizeof(buffer) - 1 ? len : sizeof(buffer) - 1), line);
+        if (strstr(buffer, "FS_EXTERN_OVERLAY") == NULL)
+        {
+            SiteKind kind = SITE_LOAD;
+            if (strstr(buffer, "UnloadOverlayByID(") != NULL || strstr(buffer, "FS_UnloadOverlay(") != NULL)
+            {
+                kind = SITE_UNLOAD;
+            }
+            else if (strstr(buffer, "FS_LoadOverlay(") != NULL)
+            {
+                kind = SITE_DIRECT;
+            }
+            for (const char * ref = strstr(buffer, "FS_OVERLAY_ID("); ref != NULL; ref = strstr(ref + 1, "FS_OVERLAY_ID("))
+            {
+                if (strncmp(ref, "FS_OVERLAY_ID(name)", 19) != 0)
+                {
+                    AddSite(from, OverlayAt(ref), kind);
+                }
+            }
+        }
+        line = next != NULL ? next + 1 : NULL;
+    }
+}
+
+static void ScanObjects(const char * root, int from, char ** objects, int numObjects)
+{
+    for (int i = 0; i < numObjects; i++)
+    {
+        bool isAsm;
+        if (strcmp(objects[i], "src/poke_overlay.o") == 0)
+        {
+            // The loader itself, and the table this derives
+            continue;
+        }
+        char * text = ReadObjectSource(root, objects[i], &isAsm);
+        if (text == NULL)
+        {
+            continue;
+        }
+        if (isAsm)
+        {
+            ScanAsm(from, text);
+        }
+        else
+        {
+            ScanC(from, text);
+        }
+        free(text);
+    }
+}
+
+static void LoadCallSites(const char * root)
+{
+    size_t size;
+    char * text = ReadWholeFile(root, LSF_PATH, &size, true);
+    char * objects[4096];
+    int numObjects = 0;
+    bool inStatic = false;
+
+    // Static code has no overlay of its own to predict from, but its sites
+    // are counted
+    for (char * line = strtok(text, "\n"); line != NULL; line = strtok(NULL, "\n"))
+    {
+        char word[64], arg[256];
+        int n = sscanf(line, " %63s %255s", word, arg);
+        if (n == 2 && (strcmp(word, "Static") == 0 || strcmp(word, "Autoload") == 0 || strcmp(word, "Overlay") == 0))
+        {
+            inStatic = strcmp(word, "Static") == 0;
+        }
+        else if (inStatic && n == 2 && strcmp(word, "Object") == 0 && numObjects < 4096)
+        {
+            objects[numObjects++] = strdup(arg);
+        }
+    }
+    free(text);
+    ScanObjects(root, OVY_STATIC, objects, numObjects);
+    for (int i = 0; i < numObjects; i++)
+    {
+        free(objects[i]);
+    }
+    for (int i = 0; i < sNumOverlays; i++)
+    {
+        ScanObjects(root, i, sOverlays[i].objects, sOverlays[i].numObjects);
+    }
+}
+
+static bool IsLoadedDirectly(int id)
+{
+    for (int from = 0; from < sNumOverlays; from++)
+    {
+        if (sCallSites.directSites[from][id] != 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+// The overlay from's code loads at the most call sites, leaving out itself
+// and the overlays that are loaded directly, which are never prefetched
+static int BestSuccessor(int from, uint32_t * sites, uint32_t * total)
+{
+    int best = -1;
+    *sites = 0;
+    *total = 0;
+    for (int to = 0; to < sNumOverlays; to++)
+    {
+        uint32_t count = sCallSites.sites[from][to];
+        if (to == from || count == 0 || IsLoadedDirectly(to))
+        {
+            continue;
+        }
+        *total += count;
+        if (count > *sites)
+        {
+            best = to;
+            *sites = count;
+        }
+    }
+    return best;
+}
+
+static void PrintTable(FILE * out)
+{
+    bool declared[OVY_MAX] = { false };
+    uint32_t sites, total;
+
+    for (int from = 0; from < sNumOverlays; from++)
+    {
+        int to = BestSuccessor(from, &sites, &total);
+        if (to >= 0)
+        {
+            declared[from] = declared[to] = true;
+        }
+        if (IsLoadedDirectly(from))
+        {
+            declared[from] = true;
+        }
+    }
+
+    fprintf(out, "#ifndef POKEHEARTGOLD_DATA_OVERLAY_TRANSITIONS_H\n");
+    fprintf(out, "#define POKEHEARTGOLD_DATA_OVERLAY_TRANSITIONS_H\n\n");
+    fprintf(out, "// Generated by tools/ovyreplay (\"ovyreplay graph\") from the overlay ids that\n");
+    fprintf(out, "// the code in each overlay loads, registers or starts, in asm/ and src/. Do\n");
+    fprintf(out, "// not edit; \"ovyreplay selftest\" fails when this is out of date.\n\n");
+    for (int i = 0; i < sNumOverlays; i++)
+    {
+        if (declared[i])
+        {
+            fprintf(out, "FS_EXTERN_OVERLAY(%s);\n", sOverlays[i].name);
+        }
+    }
+    fprintf(out, "\n// Loaded with FS_LoadOverlay rather than HandleLoadOverlay\n");
+    fprintf(out, "static const FSOverlayID sOverlaysLoadedDirectly[] = {\n");
+    for (int to = 0; to < sNumOverlays; to++)
+    {
+        if (IsLoadedDirectly(to))
+        {
+            fprintf(out, "    FS_OVERLAY_ID(%s),\n", sOverlays[to].name);
+        }
+    }
+    fprintf(out, "};\n\n");
+    fprintf(out, "// For each overlay, the one its code loads at the most call sites\n");
+    fprintf(out, "static const PMiOverlayTransition sOverlayTransitionGraph[] = {\n");
+    for (int from = 0; from < sNumOverlays; from++)
+    {
+        int to = BestSuccessor(from, &sites, &total);
+        if (to >= 0)
+        {
+            char edge[128];
+            snprintf(edge, sizeof(edge), "{ FS_OVERLAY_ID(%.31s), FS_OVERLAY_ID(%.31s) },", sOverlays[from].name, sOverlays[to].name);
+            fprintf(out, "    %-68s // %u of %u\n", edge, sites, total);
+        }
+    }
+    fprintf(out, "};\n\n");
+    fprintf(out, "#endif //POKEHEARTGOLD_DATA_OVERLAY_TRANSITIONS_H\n");
+}
+
+static int CommandGraph(bool all)
+{
+    if (!all)
+    {
+        PrintTable(stdout);
+        return EXIT_SUCCESS;
+    }
+    for (int from = 0; from < sNumOverlays; from++)
+    {
+        for (int to = 0; to < sNumOverlays; to++)
+        {
+            if (sCallSites.sites[from][to] != 0)
+            {
+                printf("%s -> %s %u\n", sOverlays[from].name, sOverlays[to].name, sCallSites.sites[from][to]);
+            }
+            if (sCallSites.directSites[from][to] != 0)
+            {
+                printf("%s -> %s %u direct\n", sOverlays[from].name, sOverlays[to].name, sCallSites.directSites[from][to]);
+            }
+        }
+    }
+    printf("%u sites in static code, %u unloads\n", sCallSites.staticSites, sCallSites.unloadSites);
+    return EXIT_SUCCESS;
+}
+
+static void LoadGameData(const char * root, double openUs, double cardMBps)
+{
+    OvyImage images[OVY_MAX];
+
+    LoadLayout(root);
+    LoadCallSites(root);
+    for (int i = 0; i < sNumOverlays; i++)
+    {
+        images[i].ramAddress = sOverlays[i].address;
+        images[i].ramSize = sOverlays[i].size;
+        images[i].bssSize = sOverlays[i].bssSize;
+    }
+    Ovy_SetLayout(images, sNumOverlays);
+    Ovy_SetCard(openUs, cardMBps);
+}
+
+// ---------------------------------------------------------------------------
+// Traces
+
+static void AddEvent(Trace * trace, EventType type, int arg, int loadType)
+{
+    if (trace->events == NULL)
+    {
+        trace->events = malloc(MAX_EVENTS * sizeof(Event));
+        if (trace->events == NULL)
+        {
+            fatal_error("out of memory");
+        }
+    }
+    if (trace->numEvents >= MAX_EVENTS)
+    {
+        fatal_error("more than %d events", MAX_EVENTS);
+    }
+    trace->events[trace->numEvents].type = type;
+    trace->events[trace->numEvents].loadType = loadType;
+    trace->events[trace->numEvents].arg = arg;
+    trace->numEvents++;
+}
+
+// One event per line:
+//   load OVERLAY [normal|noinit|async]   HandleLoadOverlay
+//   unload OVERLAY                       UnloadOverlayByID
+//   direct OVERLAY                       FS_LoadOverlay
+//   undirect OVERLAY                     FS_UnloadOverlay
+//   frames N                             N frames of the main loop
+// OVERLAY is a name from main.lsf or a number. '#' starts a comment.
+static void ReadTrace(const char * path, Trace * trace)
+{
+    FILE * file = fopen(path, "r");
+    char line[256];
+    int lineNo = 0;
+    if (file == NULL)
+    {
+        fatal_error("%s: %s", path, strerror(errno));
+    }
+    while (fgets(line, sizeof(line), file) != NULL)
+    {
+        char word[32], arg[64], type[32];
+        lineNo++;
+        char * comment = strchr(line, '#');
+        if (comment != NULL)
+        {
+            *comment = '\0';
+        }
+        int n = sscanf(line, "%31s %63s %31s", word, arg, type);
+        if (n <= 0)
+        {
+            continue;
+        }
+        if (n >= 2 && strcmp(word, "frames") == 0)
+        {
+            uint32_t frames = ParseU32(arg);
+            while (frames > 0)
+            {
+                uint32_t chunk = frames > 0xFFFF ? 0xFFFF : frames;
+                AddEvent(trace, EVENT_FRAMES, chunk, 0);
+                frames -= chunk;
+            }
+            continue;
+        }
+        int id = n >= 2 ? FindOverlay(arg) : -1;
+        if (id < 0)
+        {
+            fatal_error("%s:%d: expected an overlay", path, lineNo);
+        }
+        if (strcmp(word, "load") == 0)
+        {
+            int loadType = LOAD_NORMAL;
+            if (n == 3)
+            {
+                loadType = strcmp(type, "noinit") == 0 ? LOAD_NOINIT : strcmp(type, "async") == 0 ? LOAD_ASYNC : strcmp(type, "normal") == 0 ? LOAD_NORMAL : -1;
+                if (loadType < 0)
+                {
+                    fatal_error("%s:%d: unknown load type %s", path, lineNo, type);
+                }
+            }
+            AddEvent(trace, EVENT_LOAD, id, loadType);
+        }
+        else if (strcmp(word, "unload") == 0)
+        {
+            AddEvent(trace, EVENT_UNLOAD, id, 0);
+        }
+        else if (strcmp(word, "direct") == 0)
+        {
+            AddEvent(trace, EVENT_DIRECT, id, 0);
+        }
+        else if (strcmp(word, "undirect") == 0)
+        {
+            AddEvent(trace, EVENT_UNDIRECT, id, 0);
+        }
+        else
+        {
+            fatal_error("%s:%d: unknown event %s", path, lineNo, word);
+        }
+    }
+    fclose(file);
+}
+
+static void PrintTrace(const Trace * trace)
+{
+    static const char * const kEvents[] = { "load", "unload", "direct", "undirect", "frames" };
+    for (int i = 0; i < trace->numEvents; i++)
+    {
+        const Event * event = &trace->events[i];
+        if (event->type == EVENT_FRAMES)
+        {
+            printf("frames %u\n", event->arg);
+        }
+        else
+        {
+            printf("%s %s\n", kEvents[event->type], sOverlays[event->arg].name);
+        }
+    }
+}
+
+typedef struct WalkState
+{
+    bool tracked[OVY_MAX];
+    bool direct[OVY_MAX];
+    int directOwner[OVY_MAX];
+    int stack[OVY_MAX];
+    int depth;
+} WalkState;
+
+static uint32_t RandomFrames(uint32_t * rng)
+{
+    // Mostly a program's first few frames, where the next load comes soonest
+    return Random(rng) % 2 ? 1 + Random(rng) % 4 : 1 + Random(rng) % 240;
+}
+
+static void WalkUnload(Trace * trace, WalkState * state, int id)
+{
+    for (int i = 0; i < sNumOverlays; i++)
+    {
+        if (state->direct[i] && state->directOwner[i] == id)
+        {
+            AddEvent(trace, EVENT_UNDIRECT, i, 0);
+            state->direct[i] = false;
+        }
+    }
+    AddEvent(trace, EVENT_UNLOAD, id, 0);
+    state->tracked[id] = false;
+    for (int i = 0; i < state->depth; i++)
+    {
+        if (state->stack[i] == id)
+        {
+            memmove(&state->stack[i], &state->stack[i + 1], (state->depth - i - 1) * sizeof(int));
+            state->depth--;
+            break;
+        }
+    }
+}
+
+// Makes room for id as the game does before it loads: the programs whose RAM
+// it needs end first
+static void WalkMakeRoom(Trace * trace, WalkState * state, int id)
+{
+    for (int i = 0; i < sNumOverlays; i++)
+    {
+        if (state->direct[i] && OverlaysOverlap(i, id))
+        {
+            AddEvent(trace, EVENT_UNDIRECT, i, 0);
+            state->direct[i] = false;
+        }
+    }
+    for (int i = state->depth - 1; i >= 0; i--)
+    {
+        if (i < state->depth && OverlaysOverlap(state->stack[i], id))
+        {
+            WalkUnload(trace, state, state->stack[i]);
+        }
+    }
+}
+
+static void WalkLoad(Trace * trace, WalkState * state, int id)
+{
+    WalkMakeRoom(trace, state, id);
+    AddEvent(trace, EVENT_LOAD, id, LOAD_NORMAL);
+    state->tracked[id] = true;
+    state->stack[state->depth++] = id;
+}
+
+// A random walk over the call-site graph, from the field overlay: each step
+// runs the program on top for some frames, then loads one of the overlays its
+// code loads, weighted by call sites, or ends it. While an overlay whose code
+// loads another with FS_LoadOverlay is on top, it sometimes does so.
+static void GenerateWalk(Trace * trace, uint32_t steps, uint32_t seed)
+{
+    WalkState state;
+    uint32_t rng = seed ? seed : 1;
+    int field = FindOverlay("field");
+
+    memset(&state, 0, sizeof(state));
+    if (field < 0)
+    {
+        fatal_error("%s has no field overlay", LSF_PATH);
+    }
+    WalkLoad(trace, &state, field);
+    for (uint32_t step = 0; step < steps; step++)
+    {
+        AddEvent(trace, EVENT_FRAMES, RandomFrames(&rng), 0);
+        if (state.depth == 0)
+        {
+            WalkLoad(trace, &state, field);
+            continue;
+        }
+        int top = state.stack[state.depth - 1];
+
+        // A direct load by the program on top, if nothing is in its way
+        for (int d = 0; d < sNumOverlays; d++)
+        {
+            if (sCallSites.directSites[top][d] == 0 || state.direct[d] || state.tracked[d] || Random(&rng) % 3 != 0)
+            {
+                continue;
+            }
+            bool blocked = false;
+            for (int i = 0; i < sNumOverlays; i++)
+            {
+                blocked |= (state.tracked[i] || state.direct[i]) && OverlaysOverlap(i, d);
+            }
+            if (!blocked)
+            {
+                AddEvent(trace, EVENT_DIRECT, d, 0);
+                state.direct[d] = true;
+                state.directOwner[d] = top;
+                AddEvent(trace, EVENT_FRAMES, RandomFrames(&rng), 0);
+            }
+        }
+
+        uint32_t total = 0;
+        for (int to = 0; to < sNumOverlays; to++)
+        {
+            if (!IsLoadedDirectly(to) && !state.tracked[to])
+            {
+                total += sCallSites.sites[top][to];
+            }
+        }
+        if (total == 0 || Random(&rng) % 4 == 0)
+        {
+            WalkUnload(trace, &state, top);
+            continue;
+        }
+        uint32_t pick = Random(&rng) % total;
+        for (int to = 0; to < sNumOverlays; to++)
+        {
+            if (IsLoadedDirectly(to) || state.tracked[to])
+            {
+                continue;
+            }
+            if (pick < sCallSites.sites[top][to])
+            {
+                WalkLoad(trace, &state, to);
+                break;
+            }
+            pick -= sCallSites.sites[top][to];
+        }
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Replay
+
+// Runs a trace through one build. Each frame ends the way NitroMain's does,
+// with HandleOverlayPrefetch after the overlay manager.
+static void RunTrace(const Variant * variant, const Trace * trace, ReplayResult * result)
+{
+    uint8_t * loadResults = result->loadResults;
+
+    memset(result, 0, sizeof(*result));
+    result->loadResults = loadResults;
+    Ovy_Reset();
+    variant->reset();
+    for (int i = 0; i < trace->numEvents; i++)
+    {
+        const Event * event = &trace->events[i];
+        uint64_t start = Ovy_GetTicks();
+        switch (event->type)
+        {
+        case EVENT_LOAD:
+        {
+            int ok = variant->load(event->arg, event->loadType);
+            if (loadResults != NULL)
+            {
+                loadResults[result->loads] = ok;
+            }
+            result->loads++;
+            result->failedLoads += !ok;
+            result->stallTicks += Ovy_GetTicks() - start;
+            variant->prefetch();
+            break;
+        }
+        case EVENT_UNLOAD:
+            variant->unload(event->arg);
+            break;
+        case EVENT_DIRECT:
+            Ovy_LoadDirect(event->arg);
+            result->stallTicks += Ovy_GetTicks() - start;
+            break;
+        case EVENT_UNDIRECT:
+            Ovy_UnloadDirect(event->arg);
+            break;
+        case EVENT_FRAMES:
+            for (uint32_t f = 0; f < event->arg; f++)
+            {
+                variant->prefetch();
+                Ovy_AdvanceFrame();
+            }
+            break;
+        }
+    }
+    variant->getPrefetchStats(&result->prefetchHits, &result->prefetchDrops);
+    result->ticks = Ovy_GetTicks();
+    Ovy_GetIo(&result->io);
+}
+
+static double TicksToMs(uint64_t ticks)
+{
+    return ticks / OVY_TICKS_PER_US / 1000.0;
+}
+
+static void PrintResults(const ReplayResult * results)
+{
+    printf("%-11s %7s %7s %7s %7s %9s %9s %6s %6s %6s\n",
+           "", "loads", "hits", "drops", "reads", "MB read", "stall ms", "races", "bad", "clobb");
+    for (int v = 0; v < 2; v++)
+    {
+        const ReplayResult * r = &results[v];
+        printf("%-11s %7u %7u %7u %7u %9.2f %9.1f %6u %6u %6u\n",
+               kVariants[v].name, r->loads, r->prefetchHits, r->prefetchDrops, r->io.reads,
+               r->io.bytesRead / 1048576.0, TicksToMs(r->stallTicks), r->io.races, r->io.badStarts, r->io.clobbers);
+    }
+    printf("\nstall saved: %.1f%%\n", results[0].stallTicks == 0 ? 0.0
+           : 100.0 * (1.0 - (double)results[1].stallTicks / results[0].stallTicks));
+}
+
+static int CommandReplay(const char * tracePath, uint32_t steps, uint32_t seed, bool dump)
+{
+    Trace trace = { 0 };
+    ReplayResult results[2] = { 0 };
+
+    if (tracePath != NULL)
+    {
+        ReadTrace(tracePath, &trace);
+    }
+    else
+    {
+        GenerateWalk(&trace, steps, seed);
+    }
+    if (dump)
+    {
+        PrintTrace(&trace);
+        return EXIT_SUCCESS;
+    }
+    printf("%d overlays, %d events%s\n\n", sNumOverlays, trace.numEvents, tracePath != NULL ? "" : " from the call-site walk");
+    for (int v = 0; v < 2; v++)
+    {
+        RunTrace(&kVariants[v], &trace, &results[v]);
+    }
+    PrintResults(results);
+    free(trace.events);
+    return results[1].io.races + results[1].io.badStarts + results[1].io.clobbers == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+// ---------------------------------------------------------------------------
+// Self-test
+
+static int CheckTable(const char * root)
+{
+    size_t size;
+    char * committed = ReadWholeFile(root, TABLE_PATH, &size, true);
+    char * generated = NULL;
+    size_t generatedSize = 0;
+    FILE * out = open_memstream(&generated, &generatedSize);
+    PrintTable(out);
+    fclose(out);
+    bool same = size == generatedSize && memcmp(committed, generated, size) == 0;
+    printf("%s: %s\n", TABLE_PATH, same ? "matches the call sites" : "OUT OF DATE, run ovyreplay graph");
+    free(committed);
+    free(generated);
+    return !same;
+}
+
+// For each overlay Y whose code loads D directly and each X that shares D's
+// RAM but not Y's: teach the predictor Y -> X, come back to Y, and load D
+// directly while the prediction would be read in. Then end D and start X.
+static int CheckDirectLoads(void)
+{
+    Trace trace = { 0 };
+    int scenarios = 0;
+
+    for (int y = 0; y < sNumOverlays; y++)
+    {
+        for (int d = 0; d < sNumOverlays; d++)
+        {
+            if (sCallSites.directSites[y][d] == 0 || OverlaysOverlap(y, d))
+            {
+                continue;
+            }
+            for (int x = 0; x < sNumOverlays; x++)
+            {
+                if (x == y || x == d || !OverlaysOverlap(x, d) || OverlaysOverlap(x, y))
+                {
+                    continue;
+                }
+                AddEvent(&trace, EVENT_LOAD, y, LOAD_NORMAL);
+                AddEvent(&trace, EVENT_LOAD, x, LOAD_NORMAL);
+                AddEvent(&trace, EVENT_UNLOAD, x, 0);
+                AddEvent(&trace, EVENT_UNLOAD, y, 0);
+                AddEvent(&trace, EVENT_LOAD, y, LOAD_NORMAL);
+                AddEvent(&trace, EVENT_FRAMES, 1, 0);
+                AddEvent(&trace, EVENT_DIRECT, d, 0);
+                AddEvent(&trace, EVENT_FRAMES, 30, 0);
+                AddEvent(&trace, EVENT_UNDIRECT, d, 0);
+                AddEvent(&trace, EVENT_LOAD, x, LOAD_NORMAL);
+                AddEvent(&trace, EVENT_UNLOAD, x, 0);
+                AddEvent(&trace, EVENT_UNLOAD, y, 0);
+                scenarios++;
+            }
+        }
+    }
+
+    ReplayResult result = { 0 };
+    RunTrace(&kVariants[1], &trace, &result);
+    bool ok = scenarios > 0 && result.failedLoads == 0 && result.io.races + result.io.badStarts + result.io.clobbers == 0;
+    printf("direct loads: %d overlays share RAM with one, %u races, %u bad starts, %u clobbered%s\n",
+           scenarios, result.io.races, result.io.badStarts, result.io.clobbers, ok ? "" : ", FAILED");
+    free(trace.events);
+    return !ok;
+}
+
+static int CheckWalk(uint32_t steps, uint32_t seed)
+{
+    Trace trace = { 0 };
+    ReplayResult results[2] = { 0 };
+    int failed = 0;
+
+    GenerateWalk(&trace, steps, seed);
+    for (int v = 0; v < 2; v++)
+    {
+        results[v].loadResults = malloc(trace.numEvents);
+        RunTrace(&kVariants[v], &trace, &results[v]);
+    }
+    PrintResults(results);
+    bool same = results[0].loads == results[1].loads && memcmp(results[0].loadResults, results[1].loadResults, results[0].loads) == 0;
+    printf("walk: loads %s in both builds\n", same ? "succeed or fail the same" : "DIFFER");
+    failed += !same;
+    for (int v = 0; v < 2; v++)
+    {
+        const OvyIo * io = &results[v].io;
+        if (io->races + io->badStarts + io->clobbers != 0)
+        {
+            printf("walk: %s: RAM written under a load\n", kVariants[v].name);
+            failed++;
+        }
+        free(results[v].loadResults);
+    }
+    if (results[1].prefetchHits == 0 || results[1].stallTicks >= results[0].stallTicks)
+    {
+        printf("walk: prefetching did not cut the stall\n");
+        failed++;
+    }
+    free(trace.events);
+    return failed;
+}
+
+static int CommandSelfTest(const char * root, uint32_t steps, uint32_t seed)
+{
+    int failed = 0;
+
+    failed += CheckTable(root);
+    failed += CheckDirectLoads();
+    failed += CheckWalk(steps, seed);
+    printf("%d checks failed\n", failed);
+    return failed == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+// ---------------------------------------------------------------------------
+
+static noreturn void Usage(const char * prog)
+{
+    fprintf(stderr,
+        "Usage: %s COMMAND [options]\n"
+        "Runs src/poke_overlay.c on the host, with and without\n"
+        "OPTIMIZE_OVERLAY_PREFETCH, over a model of the card and of main RAM\n"
+        "laid out from main.lsf.\n"
+        "Commands:\n"
+        "  graph [--all]         print src/data/overlay_transitions.h as the call\n"
+        "                        sites give it, or with --all every edge\n"
+        "  replay [TRACE]        replay a trace of loads, or a walk over the call\n"
+        "                        sites, and compare stalls and card reads\n"
+        "  selftest              check that the table is up to date and that no\n"
+        "                        load writes RAM that another is using\n"
+        "Options:\n"
+        "  --steps N             steps of the walk (default %d)\n"
+        "  --seed N              walk seed\n"
+        "  --dump                print the trace instead of replaying it\n"
+        "  --open-us X           modelled cost of opening a file (default %g)\n"
+        "  --card-mbps X         modelled card throughput (default %g)\n",
+        prog, DEFAULT_STEPS, DEFAULT_OPEN_US, DEFAULT_CARD_MBPS);
+    exit(EXIT_FAILURE);
+}
+
+int main(int argc, char ** argv)
+{
+    if (argc < 2)
+    {
+        Usage(argv[0]);
+    }
+    const char * command = argv[1];
+    const char * tracePath = NULL;
+    uint32_t steps = DEFAULT_STEPS;
+    uint32_t seed = 1;
+    double openUs = DEFAULT_OPEN_US;
+    double cardMBps = DEFAULT_CARD_MBPS;
+    bool all = false;
+    bool dump = false;
+
+    for (int i = 2; i < argc; i++)
+    {
+        const char * opt = argv[i];
+        if (strcmp(opt, "--all") == 0)
+        {
+            all = true;
+            continue;
+        }
+        if (strcmp(opt, "--dump") == 0)
+        {
+            dump = true;
+            continue;
+        }
+        if (opt[0] != '-' && tracePath == NULL)
+        {
+            tracePath = opt;
+            continue;
+        }
+        if (i + 1 >= argc)
+        {
+            Usage(argv[0]);
+        }
+        if (strcmp(opt, "--steps") == 0)
+        {
+            steps = ParseU32(argv[++i]);
+        }
+        else if (strcmp(opt, "--seed") == 0)
+        {
+            seed = ParseU32(argv[++i]);
+        }
+        else if (strcmp(opt, "--open-us") == 0)
+        {
+            openUs = ParseDouble(argv[++i]);
+        }
+        else if (strcmp(opt, "--card-mbps") == 0)
+        {
+            cardMBps = ParseDouble(argv[++i]);
+        }
+        else
+        {
+            Usage(argv[0]);
+        }
+    }
+
+    const char * root = FindRoot();
+    if (root == NULL)
+    {
+        fatal_error("run ovyreplay from the repository or tools/ovyreplay");
+    }
+    LoadGameData(root, openUs, cardMBps);
+
+    if (strcmp(command, "graph") == 0)
+    {
+        return CommandGraph(all);
+    }
+    if (strcmp(command, "replay") == 0)
+    {
+        return CommandReplay(tracePath, steps, seed, dump);
+    }
+    if (strcmp(command, "selftest") == 0)
+    {
+        return CommandSelfTest(root, steps, seed);
+    }
+    Usage(argv[0]);
+}
@@ -0,0 +1,60 @@
+#ifndef GUARD_OVYREPLAY_OVYREPLAY_H
+#define GUARD_OVYREPLAY_OVYREPLAY_H
+
+// The boundary between the host side (main.c) and the objects built from the
+// game's sources (game.c, hostovy.c and src/). Plain C types only, so that
+// both sides can include it with their own headers.
+
+#include <stdint.h>
+
+#define OVY_MAX             160
+#define OVY_TICKS_PER_US    (33.513982 / 64)    // OS_GetTick runs at the bus clock over 64
+
+// Where each overlay sits in RAM, as FS_LoadOverlayInfo reports it
+typedef struct OvyImage
+{
+    uint32_t ramAddress;
+    uint32_t ramSize;
+    uint32_t bssSize;
+} OvyImage;
+
+// The card, the RAM the overlays are read into and what went wrong there
+typedef struct OvyIo
+{
+    uint32_t reads;           // overlay images read, sync or async
+    uint32_t asyncReads;
+    uint32_t bytesRead;
+    uint32_t races;           // RAM written while an async read was still filling it
+    uint32_t badStarts;       // FS_StartOverlay on RAM that did not hold the image
+    uint32_t clobbers;        // a started overlay's RAM written by another load
+} OvyIo;
+
+void Ovy_SetLayout(const OvyImage * images, int count);
+void Ovy_SetCard(double openUs, double cardMBps);
+// Clears RAM, the clock, the counters and every resident overlay
+void Ovy_Reset(void);
+uint64_t Ovy_GetTicks(void);
+// Runs the clock on by one 60 Hz frame, finishing the async reads that are due
+void Ovy_AdvanceFrame(void);
+void Ovy_GetIo(OvyIo * io);
+// FS_LoadOverlay and FS_UnloadOverlay, as the game calls them for overlays it
+// does not load through HandleLoadOverlay
+int Ovy_LoadDirect(uint32_t id);
+void Ovy_UnloadDirect(uint32_t id);
+
+// poke_overlay.c is built twice, as it ships (OvyBase_) and with
+// OPTIMIZE_OVERLAY_PREFETCH (OvyPrefetch_). Load, Unload and Prefetch are
+// HandleLoadOverlay, UnloadOverlayByID and HandleOverlayPrefetch.
+#define OVY_DECLARE_VARIANT(prefix)                                          \
+    /* Forgets every loaded overlay and everything learned */                \
+    void prefix##Reset(void);                                                \
+    int prefix##Load(uint32_t id, int loadType);                             \
+    void prefix##Unload(uint32_t id);                                        \
+    void prefix##Prefetch(void);                                             \
+    /* Prefetched loads and dropped prefetches, or zeros without them */     \
+    void prefix##GetPrefetchStats(uint32_t * hits, uint32_t * drops);
+
+OVY_DECLARE_VARIANT(OvyBase_)
+OVY_DECLARE_VARIANT(OvyPrefetch_)
+
+#endif //GUARD_OVYREPLAY_OVYREPLAY_H
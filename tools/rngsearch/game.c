@@ -0,0 +1,49 @@
+// pokemon.c as the game builds it, for CreateBoxMon. math_util.c goes in
+// unchanged as its own object; hostmon.c stands in for the species data and
+// the rest of the game CreateBoxMon reaches.
+#include "../../src/pokemon.c"
+#include "rngsearch.h"
+
+void GameRng_SetLCRNGSeed(uint32_t seed) {
+    SetLCRNGSeed(seed);
+}
+
+uint32_t GameRng_GetLCRNGSeed(void) {
+    return GetLCRNGSeed();
+}
+
+uint16_t GameRng_LCRandom(void) {
+    return LCRandom();
+}
+
+uint32_t GameRng_PRandom(uint32_t seed) {
+    return PRandom(seed);
+}
+
+void GameRng_SetMTRNGSeed(uint32_t seed) {
+    SetMTRNGSeed(seed);
+}
+
+uint32_t GameRng_MTRandom(void) {
+    return MTRandom();
+}
+
+void GameRng_CreateBoxMon(uint32_t state, uint32_t otId, uint32_t *personality, uint8_t *ivs) {
+    static const int sIvAttrs[] = {
+        MON_DATA_HP_IV,
+        MON_DATA_ATK_IV,
+        MON_DATA_DEF_IV,
+        MON_DATA_SPEED_IV,
+        MON_DATA_SPATK_IV,
+        MON_DATA_SPDEF_IV,
+    };
+    BoxPokemon boxMon;
+    int i;
+
+    SetLCRNGSeed(state);
+    CreateBoxMon(&boxMon, SPECIES_BULBASAUR, 5, 32, FALSE, 0, OT_ID_PRESET, otId);
+    *personality = GetBoxMonData(&boxMon, MON_DATA_PERSONALITY, NULL);
+    for (i = 0; i < NELEMS(sIvAttrs); i++) {
+        ivs[i] = GetBoxMonData(&boxMon, sIvAttrs[i], NULL);
+    }
+}
@@ -0,0 +1,592 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdnoreturn.h>
+#include <stdarg.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+#include "rng.h"
+#include "rngsearch.h"
+
+// Seeds handed to a worker at a time
+#define SEED_BLOCK 0x10000u
+
+static const char * const sStatNames[NUM_STATS] = { "HP", "Atk", "Def", "Spe", "SpA", "SpD" };
+
+typedef struct SearchParams
+{
+    uint32_t seedMin;
+    uint32_t seedMax;
+    uint32_t advMin;
+    uint32_t advMax;
+    int nature; // -1 = any
+    uint8_t minIvs[NUM_STATS];
+    uint8_t maxIvs[NUM_STATS];
+    int shinyOnly;
+    uint32_t otId;
+    int countOnly;
+    int numThreads;
+} SearchParams;
+
+typedef struct SearchState
+{
+    const SearchParams * params;
+    AffineStep jump;    // advMin steps ahead
+    _Atomic uint64_t nextBlock;
+    uint64_t numBlocks;
+    _Atomic uint64_t numMatches;
+    pthread_mutex_t outputLock;
+} SearchState;
+
+static inline noreturn __attribute__((format(printf, 1, 2))) void fatal_error(const char * message, ...)
+{
+    va_list va_args;
+    va_start(va_args, message);
+    fputs("Error: ", stderr);
+    vfprintf(stderr, message, va_args);
+    fputc('\n', stderr);
+    va_end(va_args);
+    exit(EXIT_FAILURE);
+}
+
+void GF_AssertFail(void)
+{
+    fatal_error("GF_ASSERT failed in the game code");
+}
+
+static uint32_t ParseU32(const char * arg)
+{
+    char * end;
+    unsigned long long val = strtoull(arg, &end, 0);
+    if (*arg == '\0' || *end != '\0' || val > 0xFFFFFFFFull)
+    {
+        fatal_error("invalid number: %s", arg);
+    }
+    return (uint32_t)val;
+}
+
+// Parses "a" or "a-b"
+static void ParseRange(const char * arg, uint32_t * lo, uint32_t * hi)
+{
+    char buf[64];
+    char * dash;
+
+    if (strlen(arg) >= sizeof(buf))
+    {
+        fatal_error("invalid range: %s", arg);
+    }
+    strcpy(buf, arg);
+    dash = strchr(buf + 1, '-');
+    if (dash != NULL)
+    {
+        *dash = '\0';
+        *lo = ParseU32(buf);
+        *hi = ParseU32(dash + 1);
+    }
+    else
+    {
+        *lo = *hi = ParseU32(buf);
+    }
+    if (*lo > *hi)
+    {
+        fatal_error("empty range: %s", arg);
+    }
+}
+
+// Parses six comma-separated IVs in HP/Atk/Def/SpA/SpD/Spe order, the order
+// the summary screen shows them, into the stored order.
+static void ParseIvs(const char * arg, uint8_t * ivs)
+{
+    static const int sDisplayToStored[NUM_STATS] = { 0, 1, 2, 4, 5, 3 };
+    const char * p = arg;
+
+    for (int i = 0; i < NUM_STATS; i++)
+    {
+        char * end;
+        long val = strtol(p, &end, 10);
+        if (end == p || val < 0 || val > 31 || (i < NUM_STATS - 1 ? *end != ',' : *end != '\0'))
+        {
+            fatal_error("invalid IV list: %s", arg);
+        }
+        ivs[sDisplayToStored[i]] = val;
+        p = end + 1;
+    }
+}
+
+static void PrintRoll(FILE * out, uint32_t seed, uint32_t adv, const BoxMonRoll * roll, uint32_t otId, int haveOtId)
+{
+    fprintf(out, "%08X %u %08X %2u %2u/%2u/%2u/%2u/%2u/%2u%s\n",
+        seed, adv, roll->personality, roll->nature,
+        roll->ivs[0], roll->ivs[1], roll->ivs[2], roll->ivs[4], roll->ivs[5], roll->ivs[3],
+        haveOtId && IsShiny(otId, roll->personality) ? " shiny" : "");
+}
+
+static inline int RollMatches(const SearchParams * params, uint32_t personality, uint32_t ivWord)
+{
+    for (int i = 0; i < NUM_STATS; i++)
+    {
+        uint32_t iv = (ivWord >> (5 * i)) & 0x1F;
+        if (iv < params->minIvs[i] || iv > params->maxIvs[i])
+        {
+            return 0;
+        }
+    }
+    if (params->nature >= 0 && personality % NUM_NATURES != (uint32_t)params->nature)
+    {
+        return 0;
+    }
+    if (params->shinyOnly && !IsShiny(params->otId, personality))
+    {
+        return 0;
+    }
+    return 1;
+}
+
+// Lanes are consecutive seeds at the same advance. Seed s at advance a has
+// state jump_a(s), and jump_a is affine, so the eight lanes are
+// jump_a.mul * (s + i) + jump_a.add.
+static void * SearchWorker(void * arg)
+{
+    SearchState * search = arg;
+    const SearchParams * params = search->params;
+    uint32_t states[ROLL_BATCH], personalities[ROLL_BATCH], ivWords[ROLL_BATCH];
+    uint64_t matches = 0;
+    uint64_t block;
+
+    while ((block = atomic_fetch_add(&search->nextBlock, 1)) < search->numBlocks)
+    {
+        uint64_t first = params->seedMin + block * SEED_BLOCK;
+        uint64_t last = first + SEED_BLOCK - 1;
+        if (last > params->seedMax)
+        {
+            last = params->seedMax;
+        }
+
+        AffineStep jump = search->jump;
+        for (uint64_t adv = params->advMin; adv <= params->advMax; adv++)
+        {
+            for (uint64_t seed = first; seed <= last; seed += ROLL_BATCH)
+            {
+                int lanes = last - seed + 1 < ROLL_BATCH ? (int)(last - seed + 1) : ROLL_BATCH;
+                for (int i = 0; i < ROLL_BATCH; i++)
+                {
+                    states[i] = Affine_Apply(jump, (uint32_t)(seed + i));
+                }
+                BoxMon_RollBatch(states, personalities, ivWords);
+                for (int i = 0; i < lanes; i++)
+                {
+                    if (!RollMatches(params, personalities[i], ivWords[i]))
+                    {
+                        continue;
+                    }
+                    matches++;
+                    if (!params->countOnly)
+                    {
+                        BoxMonRoll roll;
+                        roll.personality = personalities[i];
+                        roll.nature = personalities[i] % NUM_NATURES;
+                        BoxMon_UnpackIVs(ivWords[i], roll.ivs);
+                        pthread_mutex_lock(&search->outputLock);
+                        PrintRoll(stdout, (uint32_t)(seed + i), (uint32_t)adv, &roll, params->otId, params->shinyOnly);
+                        pthread_mutex_unlock(&search->outputLock);
+                    }
+                }
+            }
+            jump = Affine_Compose(jump, kLCRandomStep);
+        }
+    }
+
+    atomic_fetch_add(&search->numMatches, matches);
+    return NULL;
+}
+
+static double Now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void RunSearch(const SearchParams * params)
+{
+    SearchState search;
+    pthread_t * threads;
+    double start, elapsed;
+    uint64_t numRolls;
+
+    search.params = params;
+    search.jump = Affine_Pow(kLCRandomStep, params->advMin);
+    search.nextBlock = 0;
+    search.numBlocks = ((uint64_t)params->seedMax - params->seedMin) / SEED_BLOCK + 1;
+    search.numMatches = 0;
+    pthread_mutex_init(&search.outputLock, NULL);
+
+    threads = malloc(params->numThreads * sizeof(pthread_t));
+    if (threads == NULL)
+    {
+        fatal_error("out of memory");
+    }
+
+    start = Now();
+    for (int i = 0; i < params->numThreads; i++)
+    {
+        if (pthread_create(&threads[i], NULL, SearchWorker, &search) != 0)
+        {
+            fatal_error("could not start worker thread");
+        }
+    }
+    for (int i = 0; i < params->numThreads; i++)
+    {
+        pthread_join(threads[i], NULL);
+    }
+    elapsed = Now() - start;
+
+    numRolls = ((uint64_t)params->seedMax - params->seedMin + 1) * ((uint64_t)params->advMax - params->advMin + 1);
+    if (params->countOnly)
+    {
+        printf("%llu\n", (unsigned long long)search.numMatches);
+    }
+    fprintf(stderr, "%llu matches in %llu rolls, %.3fs, %.1fM rolls/s on %d threads\n",
+        (unsigned long long)search.numMatches, (unsigned long long)numRolls,
+        elapsed, elapsed > 0 ? numRolls / elapsed / 1e6 : 0.0, params->numThreads);
+
+    pthread_mutex_destroy(&search.outputLock);
+    free(threads);
+}
+
+// Runs the plain stepping in rng.c against math_util.c and CreateBoxMon as the
+// game builds them. Must come first: it relies on MTRandom not having been
+// called yet.
+static int CheckAgainstGame(void)
+{
+    static const uint32_t sSeeds[] = { 0, 1, 5489, 0x12345678, 0x80000000, 0xFFFFFFFF };
+    MTRNG mt;
+    uint32_t state, personality;
+    uint8_t ivs[NUM_STATS];
+    int failed = 0;
+
+    MTRNG_Seed(&mt, MTRNG_DEFAULT_SEED);
+    for (int i = 0; i < 2 * MTRNG_N; i++)
+    {
+        if (GameRng_MTRandom() != MTRNG_Next(&mt))
+        {
+            fprintf(stderr, "MTRandom without a seed: output %d mismatch\n", i);
+            failed = 1;
+            break;
+        }
+    }
+
+    for (size_t s = 0; s < sizeof(sSeeds) / sizeof(sSeeds[0]); s++)
+    {
+        GameRng_SetMTRNGSeed(sSeeds[s]);
+        MTRNG_Seed(&mt, sSeeds[s]);
+        for (int i = 0; i < 3 * MTRNG_N; i++)
+        {
+            if (GameRng_MTRandom() != MTRNG_Next(&mt))
+            {
+                fprintf(stderr, "MTRandom from seed %08X: output %d mismatch\n", sSeeds[s], i);
+                failed = 1;
+                break;
+            }
+        }
+
+        GameRng_SetLCRNGSeed(sSeeds[s]);
+        state = sSeeds[s];
+        for (uint32_t n = 1; n <= 5000; n++)
+        {
+            if (GameRng_LCRandom() != LCRandom(&state) || GameRng_GetLCRNGSeed() != state)
+            {
+                fprintf(stderr, "LCRandom from seed %08X: call %u mismatch\n", sSeeds[s], n);
+                failed = 1;
+                break;
+            }
+        }
+        if (GameRng_GetLCRNGSeed() != LCRandom_Advance(sSeeds[s], 5000))
+        {
+            fprintf(stderr, "LCRandom jump from seed %08X mismatch\n", sSeeds[s]);
+            failed = 1;
+        }
+
+        state = sSeeds[s];
+        for (uint32_t n = 1; n <= 5000; n++)
+        {
+            state = GameRng_PRandom(state);
+            if (state != PRandom_Advance(sSeeds[s], n))
+            {
+                fprintf(stderr, "PRandom from seed %08X: call %u mismatch\n", sSeeds[s], n);
+                failed = 1;
+                break;
+            }
+        }
+    }
+
+    for (uint32_t base = 0; base < 0x100000; base += 0x1357)
+    {
+        BoxMonRoll roll;
+        uint32_t otId = base * 0x9E3779B9u;
+
+        state = base * 2654435761u;
+        BoxMon_Roll(state, &roll);
+        GameRng_CreateBoxMon(state, otId, &personality, ivs);
+        if (personality != roll.personality || memcmp(ivs, roll.ivs, NUM_STATS) != 0)
+        {
+            fprintf(stderr, "CreateBoxMon roll mismatch at state %08X\n", state);
+            failed = 1;
+        }
+        if (GameRng_GetLCRNGSeed() != LCRandom_Advance(state, 4))
+        {
+            fprintf(stderr, "CreateBoxMon did not make four LCRandom calls at state %08X\n", state);
+            failed = 1;
+        }
+    }
+
+    return failed;
+}
+
+// Cross-checks rng.c against the game, then the batched and jump-ahead paths
+// against plain stepping
+static int SelfTest(void)
+{
+    MTRNG mt;
+    uint32_t state, stepped;
+    int failed = CheckAgainstGame();
+
+    MTRNG_Seed(&mt, MTRNG_DEFAULT_SEED);
+    if (MTRNG_Next(&mt) != 3499211612u)
+    {
+        fprintf(stderr, "MT19937 first output mismatch\n");
+        failed = 1;
+    }
+    for (int i = 1; i < 9999; i++)
+    {
+        MTRNG_Next(&mt);
+    }
+    if (MTRNG_Next(&mt) != 4123659995u)
+    {
+        fprintf(stderr, "MT19937 10000th output mismatch\n");
+        failed = 1;
+    }
+
+    state = stepped = 0x12345678;
+    for (uint32_t n = 0; n < 5000; n++)
+    {
+        if (LCRandom_Advance(state, n) != stepped)
+        {
+            fprintf(stderr, "LCRandom jump of %u mismatch\n", n);
+            failed = 1;
+            break;
+        }
+        if (LCRandom_Advance(stepped, -(int64_t)n) != state)
+        {
+            fprintf(stderr, "LCRandom jump of -%u mismatch\n", n);
+            failed = 1;
+            break;
+        }
+        LCRandom(&stepped);
+    }
+    if (LCRandom_Advance(state, 0x100000000ll) != state)
+    {
+        fprintf(stderr, "LCRandom period mismatch\n");
+        failed = 1;
+    }
+
+    stepped = 0;
+    for (uint32_t n = 0; n < 5000; n++)
+    {
+        if (PRandom_Advance(0, n) != stepped)
+        {
+            fprintf(stderr, "PRandom jump of %u mismatch\n", n);
+            failed = 1;
+            break;
+        }
+        stepped = PRandom(stepped);
+    }
+
+    for (uint32_t base = 0; base < 0x100000; base += 0x1357)
+    {
+        uint32_t states[ROLL_BATCH], personalities[ROLL_BATCH], ivWords[ROLL_BATCH];
+        for (int i = 0; i < ROLL_BATCH; i++)
+        {
+            states[i] = base * 2654435761u + i;
+        }
+        BoxMon_RollBatch(states, personalities, ivWords);
+        for (int i = 0; i < ROLL_BATCH; i++)
+        {
+            BoxMonRoll roll;
+            uint8_t ivs[NUM_STATS];
+            BoxMon_Roll(states[i], &roll);
+            BoxMon_UnpackIVs(ivWords[i], ivs);
+            if (roll.personality != personalities[i] || memcmp(roll.ivs, ivs, NUM_STATS) != 0)
+            {
+                fprintf(stderr, "batched roll mismatch at state %08X\n", states[i]);
+                failed = 1;
+            }
+        }
+    }
+
+    puts(failed ? "FAIL" : "OK");
+    return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+static noreturn void Usage(const char * prog)
+{
+    fprintf(stderr,
+        "Usage:\n"
+        "  %s search [options]   find CreateBoxMon rolls matching a filter\n"
+        "  %s roll SEED ADV      show the roll ADV LCRandom calls after SEED\n"
+        "  %s advance SEED N     LCRandom state N calls after SEED (N may be negative)\n"
+        "  %s mt SEED [SKIP [COUNT]]  MTRandom outputs after SetMTRNGSeed(SEED)\n"
+        "  %s selftest           check the generators against the game's and the fast paths\n"
+        "                        against plain stepping\n"
+        "\n"
+        "search options:\n"
+        "  --seeds A[-B]         LCRandom states to start from (default 0-0xFFFFFFFF)\n"
+        "  --advances A[-B]      LCRandom calls before CreateBoxMon (default 0)\n"
+        "  --nature N            nature index 0-24\n"
+        "  --min-ivs H,A,B,C,D,S minimum IVs (summary screen order)\n"
+        "  --max-ivs H,A,B,C,D,S maximum IVs\n"
+        "  --shiny OTID          only rolls that are shiny for this 32-bit OT id\n"
+        "  --count               print the number of matches only\n"
+        "  --threads N           worker threads (default: all cores)\n"
+        "\n"
+        "Matches print as: seed advance personality nature H/A/B/C/D/S\n",
+        prog, prog, prog, prog, prog);
+    exit(EXIT_FAILURE);
+}
+
+int main(int argc, char ** argv)
+{
+    if (argc < 2)
+    {
+        Usage(argv[0]);
+    }
+
+    if (strcmp(argv[1], "selftest") == 0)
+    {
+        return SelfTest();
+    }
+    else if (strcmp(argv[1], "advance") == 0)
+    {
+        if (argc != 4)
+        {
+            Usage(argv[0]);
+        }
+        long long n = strtoll(argv[3], NULL, 0);
+        printf("%08X\n", LCRandom_Advance(ParseU32(argv[2]), n));
+    }
+    else if (strcmp(argv[1], "roll") == 0)
+    {
+        BoxMonRoll roll;
+        if (argc != 4)
+        {
+            Usage(argv[0]);
+        }
+        uint32_t seed = ParseU32(argv[2]);
+        uint32_t adv = ParseU32(argv[3]);
+        BoxMon_Roll(LCRandom_Advance(seed, adv), &roll);
+        PrintRoll(stdout, seed, adv, &roll, 0, 0);
+    }
+    else if (strcmp(argv[1], "mt") == 0)
+    {
+        MTRNG mt;
+        if (argc < 3 || argc > 5)
+        {
+            Usage(argv[0]);
+        }
+        uint32_t skip = argc > 3 ? ParseU32(argv[3]) : 0;
+        uint32_t count = argc > 4 ? ParseU32(argv[4]) : 1;
+        MTRNG_Seed(&mt, ParseU32(argv[2]));
+        for (uint32_t i = 0; i < skip; i++)
+        {
+            MTRNG_Next(&mt);
+        }
+        for (uint32_t i = 0; i < count; i++)
+        {
+            printf("%08X\n", MTRNG_Next(&mt));
+        }
+    }
+    else if (strcmp(argv[1], "search") == 0)
+    {
+        SearchParams params;
+        long nproc = sysconf(_SC_NPROCESSORS_ONLN);
+
+        memset(&params, 0, sizeof(params));
+        params.seedMax = 0xFFFFFFFF;
+        params.nature = -1;
+        memset(params.maxIvs, 31, NUM_STATS);
+        params.numThreads = nproc > 0 ? (int)nproc : 1;
+
+        for (int i = 2; i < argc; i++)
+        {
+            const char * opt = argv[i];
+            if (strcmp(opt, "--count") == 0)
+            {
+                params.countOnly = 1;
+                continue;
+            }
+            if (i + 1 >= argc)
+            {
+                Usage(argv[0]);
+            }
+            const char * val = argv[++i];
+            if (strcmp(opt, "--seeds") == 0)
+            {
+                ParseRange(val, &params.seedMin, &params.seedMax);
+            }
+            else if (strcmp(opt, "--advances") == 0)
+            {
+                ParseRange(val, &params.advMin, &params.advMax);
+            }
+            else if (strcmp(opt, "--nature") == 0)
+            {
+                params.nature = ParseU32(val);
+                if (params.nature >= NUM_NATURES)
+                {
+                    fatal_error("nature must be 0-%d", NUM_NATURES - 1);
+                }
+            }
+            else if (strcmp(opt, "--min-ivs") == 0)
+            {
+                ParseIvs(val, params.minIvs);
+            }
+            else if (strcmp(opt, "--max-ivs") == 0)
+            {
+                ParseIvs(val, params.maxIvs);
+            }
+            else if (strcmp(opt, "--shiny") == 0)
+            {
+                params.shinyOnly = 1;
+                params.otId = ParseU32(val);
+            }
+            else if (strcmp(opt, "--threads") == 0)
+            {
+                params.numThreads = ParseU32(val);
+                if (params.numThreads < 1)
+                {
+                    fatal_error("need at least one thread");
+                }
+            }
+            else
+            {
+                Usage(argv[0]);
+            }
+        }
+        for (int i = 0; i < NUM_STATS; i++)
+        {
+            if (params.minIvs[i] > params.maxIvs[i])
+            {
+                fatal_error("%s IV range is empty", sStatNames[i]);
+            }
+        }
+        RunSearch(&params);
+    }
+    else
+    {
+        Usage(argv[0]);
+    }
+
+    return EXIT_SUCCESS;
+}
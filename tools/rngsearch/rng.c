@@ -0,0 +1,156 @@
+#include <string.h>
+#include "rng.h"
+
+const AffineStep kLCRandomStep = { LCRNG_MUL, LCRNG_ADD };
+const AffineStep kPRandomStep = { PRNG_MUL, PRNG_ADD };
+
+// GCC/Clang vector extensions: these lower to SSE2/AVX2/NEON when the target
+// has them and to plain scalar code when it does not.
+typedef uint32_t u32x8 __attribute__((vector_size(32)));
+typedef uint32_t u32x4 __attribute__((vector_size(16)));
+
+AffineStep Affine_Compose(AffineStep first, AffineStep second)
+{
+    // second(first(x)) = second.mul * (first.mul * x + first.add) + second.add
+    AffineStep ret;
+    ret.mul = second.mul * first.mul;
+    ret.add = second.mul * first.add + second.add;
+    return ret;
+}
+
+AffineStep Affine_Pow(AffineStep step, uint64_t n)
+{
+    AffineStep ret = { 1, 0 };
+    while (n != 0)
+    {
+        if (n & 1)
+        {
+            ret = Affine_Compose(ret, step);
+        }
+        step = Affine_Compose(step, step);
+        n >>= 1;
+    }
+    return ret;
+}
+
+uint32_t LCRandom_Advance(uint32_t state, int64_t n)
+{
+    // The multiplier is odd, so the generator has period 2^32 and stepping
+    // back n is the same as stepping forward 2^32 - n.
+    return Affine_Apply(Affine_Pow(kLCRandomStep, (uint64_t)n & 0xFFFFFFFFu), state);
+}
+
+uint32_t PRandom_Advance(uint32_t seed, uint64_t n)
+{
+    return Affine_Apply(Affine_Pow(kPRandomStep, n), seed);
+}
+
+void MTRNG_Seed(MTRNG * mt, uint32_t seed)
+{
+    mt->state[0] = seed;
+    for (int i = 1; i < MTRNG_N; i++)
+    {
+        mt->state[i] = PRNG_MUL * (mt->state[i - 1] ^ (mt->state[i - 1] >> 30)) + i;
+    }
+    mt->index = MTRNG_N;
+}
+
+static inline u32x4 LoadU32x4(const uint32_t * p)
+{
+    u32x4 v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+static inline void StoreU32x4(uint32_t * p, u32x4 v)
+{
+    memcpy(p, &v, sizeof(v));
+}
+
+static inline u32x4 TwistU32x4(u32x4 cur, u32x4 next, u32x4 far)
+{
+    u32x4 y = (cur & 0x80000000u) | (next & 0x7FFFFFFFu);
+    u32x4 mag = -(y & 1u) & MTRNG_MATRIX;
+    return far ^ (y >> 1) ^ mag;
+}
+
+static inline uint32_t TwistU32(uint32_t cur, uint32_t next, uint32_t far)
+{
+    uint32_t y = (cur & 0x80000000u) | (next & 0x7FFFFFFFu);
+    return far ^ (y >> 1) ^ (-(y & 1u) & MTRNG_MATRIX);
+}
+
+void MTRNG_Twist(MTRNG * mt)
+{
+    uint32_t * s = mt->state;
+    int i;
+
+    // Same recurrence as MTRandom, four words at a time. Every word read in
+    // a block is either ahead of the block (not yet rewritten) or at least
+    // N - M = 227 words behind it (already rewritten), as the serial loop sees.
+    for (i = 0; i + 4 <= MTRNG_N - MTRNG_M; i += 4)
+    {
+        StoreU32x4(s + i, TwistU32x4(LoadU32x4(s + i), LoadU32x4(s + i + 1), LoadU32x4(s + i + MTRNG_M)));
+    }
+    for (; i < MTRNG_N - MTRNG_M; i++)
+    {
+        s[i] = TwistU32(s[i], s[i + 1], s[i + MTRNG_M]);
+    }
+    for (; i + 4 <= MTRNG_N - 1; i += 4)
+    {
+        StoreU32x4(s + i, TwistU32x4(LoadU32x4(s + i), LoadU32x4(s + i + 1), LoadU32x4(s + i + MTRNG_M - MTRNG_N)));
+    }
+    for (; i < MTRNG_N - 1; i++)
+    {
+        s[i] = TwistU32(s[i], s[i + 1], s[i + MTRNG_M - MTRNG_N]);
+    }
+    s[MTRNG_N - 1] = TwistU32(s[MTRNG_N - 1], s[0], s[MTRNG_M - 1]);
+    mt->index = 0;
+}
+
+uint32_t MTRNG_Next(MTRNG * mt)
+{
+    if (mt->index >= MTRNG_N)
+    {
+        MTRNG_Twist(mt);
+    }
+
+    uint32_t val = mt->state[mt->index++];
+    val ^= val >> 11;
+    val ^= (val << 7) & 0x9D2C5680u;
+    val ^= (val << 15) & 0xEFC60000u;
+    val ^= val >> 18;
+    return val;
+}
+
+void BoxMon_Roll(uint32_t state, BoxMonRoll * roll)
+{
+    uint32_t lo = LCRandom(&state);
+    uint32_t hi = LCRandom(&state);
+    uint32_t iv1 = LCRandom(&state);
+    uint32_t iv2 = LCRandom(&state);
+
+    roll->personality = lo | (hi << 16);
+    roll->nature = roll->personality % NUM_NATURES;
+    BoxMon_UnpackIVs((iv1 & 0x7FFF) | ((iv2 & 0x7FFF) << 15), roll->ivs);
+}
+
+void BoxMon_RollBatch(const uint32_t * states, uint32_t * personalities, uint32_t * ivWords)
+{
+    u32x8 s, lo, hi, iv1, iv2;
+
+    memcpy(&s, states, sizeof(s));
+    s = s * LCRNG_MUL + LCRNG_ADD;
+    lo = s >> 16;
+    s = s * LCRNG_MUL + LCRNG_ADD;
+    hi = s >> 16;
+    s = s * LCRNG_MUL + LCRNG_ADD;
+    iv1 = (s >> 16) & 0x7FFFu;
+    s = s * LCRNG_MUL + LCRNG_ADD;
+    iv2 = (s >> 16) & 0x7FFFu;
+
+    lo |= hi << 16;
+    iv1 |= iv2 << 15;
+    memcpy(personalities, &lo, sizeof(lo));
+    memcpy(ivWords, &iv1, sizeof(iv1));
+}
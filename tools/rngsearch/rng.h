@@ -0,0 +1,97 @@
+#ifndef GUARD_RNGSEARCH_RNG_H
+#define GUARD_RNGSEARCH_RNG_H
+
+#include <stdint.h>
+
+// The generators in src/math_util.c. The fast paths need the constants at
+// compile time; selftest runs the plain stepping below against math_util.c
+// as the game builds it, so a wrong copy here fails the check.
+#define LCRNG_MUL     1103515245u // LCRandom
+#define LCRNG_ADD     24691u
+#define PRNG_MUL      1812433253u // PRandom, also the MT seeding recurrence
+#define PRNG_ADD      1u
+#define MTRNG_N       624
+#define MTRNG_M       397
+#define MTRNG_MATRIX  0x9908B0DFu
+#define MTRNG_DEFAULT_SEED 5489u
+
+#define NUM_NATURES   25
+#define NUM_STATS     6
+
+// x -> mul * x + add (mod 2^32). Composing these gives the generator state
+// any number of steps ahead in O(log n).
+typedef struct AffineStep
+{
+    uint32_t mul;
+    uint32_t add;
+} AffineStep;
+
+extern const AffineStep kLCRandomStep;
+extern const AffineStep kPRandomStep;
+
+AffineStep Affine_Compose(AffineStep first, AffineStep second);
+AffineStep Affine_Pow(AffineStep step, uint64_t n);
+
+static inline uint32_t Affine_Apply(AffineStep step, uint32_t x)
+{
+    return step.mul * x + step.add;
+}
+
+static inline uint16_t LCRandom(uint32_t * state)
+{
+    *state = *state * LCRNG_MUL + LCRNG_ADD;
+    return *state >> 16;
+}
+
+static inline uint32_t PRandom(uint32_t seed)
+{
+    return seed * PRNG_MUL + PRNG_ADD;
+}
+
+uint32_t LCRandom_Advance(uint32_t state, int64_t n);
+uint32_t PRandom_Advance(uint32_t seed, uint64_t n);
+
+typedef struct MTRNG
+{
+    uint32_t state[MTRNG_N];
+    int index;
+} MTRNG;
+
+void MTRNG_Seed(MTRNG * mt, uint32_t seed);
+void MTRNG_Twist(MTRNG * mt);
+uint32_t MTRNG_Next(MTRNG * mt);
+
+// What CreateBoxMon rolls when it is asked for a random personality and IVs
+// and a fixed OT id: two LCRandom calls for the personality, then two for the
+// IVs (HP/Atk/Def, then Spe/SpA/SpD). selftest checks this against
+// CreateBoxMon from src/pokemon.c.
+typedef struct BoxMonRoll
+{
+    uint32_t personality;
+    uint8_t ivs[NUM_STATS]; // HP, Atk, Def, Spe, SpA, SpD as stored by CreateBoxMon
+    uint8_t nature;
+} BoxMonRoll;
+
+void BoxMon_Roll(uint32_t state, BoxMonRoll * roll);
+
+#define ROLL_BATCH 8
+
+// Rolls ROLL_BATCH consecutive LC states at once. states[i] is the state
+// before the first LCRandom call of lane i.
+void BoxMon_RollBatch(const uint32_t * states, uint32_t * personalities, uint32_t * ivWords);
+
+static inline void BoxMon_UnpackIVs(uint32_t ivWord, uint8_t * ivs)
+{
+    for (int i = 0; i < NUM_STATS; i++)
+    {
+        ivs[i] = (ivWord >> (5 * i)) & 0x1F;
+    }
+}
+
+static inline int IsShiny(uint32_t otId, uint32_t personality)
+{
+    uint32_t x = (otId >> 16) ^ (otId & 0xFFFF) ^ (personality >> 16) ^ (personality & 0xFFFF);
+    return x < 8;
+}
+
+#endif //GUARD_RNGSEARCH_RNG_H
@@ -0,0 +1,26 @@
+#ifndef GUARD_RNGSEARCH_RNGSEARCH_H
+#define GUARD_RNGSEARCH_RNGSEARCH_H
+
+// The boundary between the host side (main.c and rng.c) and the objects built
+// from the game's sources (game.c, hostmon.c and src/). Plain C types only,
+// so that both sides can include it with their own headers.
+
+#include <stdint.h>
+
+// math_util.c's generators, as the game builds them, on their own global
+// state. MTRandom seeds itself with 5489 if it is called before
+// SetMTRNGSeed.
+void GameRng_SetLCRNGSeed(uint32_t seed);
+uint32_t GameRng_GetLCRNGSeed(void);
+uint16_t GameRng_LCRandom(void);
+uint32_t GameRng_PRandom(uint32_t seed);
+void GameRng_SetMTRNGSeed(uint32_t seed);
+uint32_t GameRng_MTRandom(void);
+
+// pokemon.c's CreateBoxMon from LC state STATE, with a random personality
+// and IVs and OT id OTID. IVS gets HP, Atk, Def, Spe, SpA, SpD, as
+// GetBoxMonData reads them back; the LC state is left where CreateBoxMon
+// left it.
+void GameRng_CreateBoxMon(uint32_t state, uint32_t otId, uint32_t * personality, uint8_t * ivs);
+
+#endif //GUARD_RNGSEARCH_RNGSEARCH_H
@@ -0,0 +1,136 @@
+// save.c as the game builds it, with or without OPTIMIZE_SAVE_DIRTY_CHUNKS.
+// The Makefile compiles this file once per variant with SAVE_PREFIX set and
+// hides everything but the functions below, so that both copies of save.c,
+// and of sSaveDataPtr, can be linked into one program.
+#include "../../src/save.c"
+
+// The save array owners that reach into SaveData, whose layout differs
+// between the two builds, so they are built with each
+u32 Save_GetPCBoxModifiedFlags(SaveData *saveData) {
+    PC_STORAGE *pcStorage = SaveArray_Get(saveData, SAVE_PCSTORAGE);
+    return pcStorage->boxModifiedFlag;
+}
+
+void Save_ResetPCBoxModifiedFlags(SaveData *saveData) {
+    PC_STORAGE *pcStorage = SaveArray_Get(saveData, SAVE_PCSTORAGE);
+    pcStorage->boxModifiedFlag = 0;
+}
+
+void Save_SetAllPCBoxesModified(SaveData *saveData) {
+    PC_STORAGE *pcStorage = SaveArray_Get(saveData, SAVE_PCSTORAGE);
+    pcStorage->boxModifiedFlag = BOX_ALL_MODIFIED_FLAG;
+}
+
+void sub_020271A0(SaveData *saveData) {
+}
+
+SAVE_MISC_DATA *Save_Misc_Get(SaveData *saveData) {
+    return SaveArray_Get(saveData, SAVE_MISC);
+}
+
+// These copy SAVE_UNK_19 and SAVE_UNK_25 to and from RAM mirrors that only
+// the rest of the game reads; the mirrors are not modelled
+void sub_020310A0(SaveData *saveData) {
+}
+
+void sub_02031084(SaveData *saveData) {
+}
+
+void sub_0202C6FC(SaveData *saveData) {
+}
+
+void sub_0202C714(SaveData *saveData) {
+}
+
+#pragma GCC visibility push(default)
+#include "savesim.h"
+
+#define SAVE_CAT_(a, b) a##b
+#define SAVE_CAT(a, b) SAVE_CAT_(a, b)
+#define SAVE_FUNC(name) SAVE_CAT(SAVE_PREFIX, name)
+
+_Static_assert(sizeof(struct SaveChunkFooter) == 16, "host32 must keep the footer at its ARM size");
+_Static_assert(sizeof(PC_BOX) == SAVE_PC_BOX_SIZE && offsetof(PC_STORAGE, boxModifiedFlag) == SAVE_PC_FLAGS_OFFSET, "host32 must keep the PC layout");
+
+int SAVE_FUNC(Boot)(void) {
+    SaveData *saveData = SaveData_New();
+
+    // SaveData_New keeps the status only as these flags
+    if (saveData->statusFlags & 2) {
+        return LOAD_STATUS_TOTAL_FAIL;
+    }
+    if (saveData->statusFlags & 1) {
+        return LOAD_STATUS_SLOT_FAIL;
+    }
+    return saveData->saveFileExists ? LOAD_STATUS_IS_GOOD : LOAD_STATUS_NOT_EXIST;
+}
+
+void SAVE_FUNC(Shutdown)(void) {
+    FreeToHeap(sSaveDataPtr);
+    sSaveDataPtr = NULL;
+}
+
+int SAVE_FUNC(Save)(void) {
+    return SaveGameNormal(sSaveDataPtr);
+}
+
+int SAVE_FUNC(SaveAsync)(int cancelAfter) {
+    int ret;
+    int steps = 0;
+
+    Save_PrepareForAsyncWrite(sSaveDataPtr, 0);
+    do {
+        if (cancelAfter >= 0 && steps++ == cancelAfter) {
+            Save_Cancel(sSaveDataPtr);
+            return SAVE_WRITE_CANCELLED;
+        }
+        ret = Save_WriteFileAsync(sSaveDataPtr);
+    } while (ret == WRITE_STATUS_CONTINUE || ret == WRITE_STATUS_NEXT);
+    return ret;
+}
+
+uint8_t *SAVE_FUNC(Region)(void) {
+    return sSaveDataPtr->dynamic_region;
+}
+
+void SAVE_FUNC(GetLayout)(SaveLayoutView *layout) {
+    int i;
+
+    for (i = 0; i < SAVE_BLOCK_NUM; i++) {
+        layout->arrayOffset[i] = sSaveDataPtr->arrayHeaders[i].offset;
+        layout->arraySize[i] = sSaveDataPtr->arrayHeaders[i].size;
+    }
+    for (i = 0; i < 2; i++) {
+        layout->blockOffset[i] = sSaveDataPtr->saveSlotSpecs[i].offset;
+        layout->blockSize[i] = sSaveDataPtr->saveSlotSpecs[i].size;
+    }
+}
+
+uint32_t SAVE_FUNC(StateSize)(void) {
+    return sizeof(SaveData);
+}
+
+void SAVE_FUNC(GetState)(void *state) {
+    MI_CpuCopy8(sSaveDataPtr, state, sizeof(SaveData));
+}
+
+void SAVE_FUNC(SetState)(const void *state) {
+    if (sSaveDataPtr == NULL) {
+        sSaveDataPtr = AllocFromHeap(HEAP_ID_1, sizeof(SaveData));
+    }
+    MI_CpuCopy8(state, sSaveDataPtr, sizeof(SaveData));
+}
+
+void SAVE_FUNC(GetStats)(SaveChunkStats *stats) {
+#ifdef OPTIMIZE_SAVE_DIRTY_CHUNKS
+    struct SaveDirtyChunkStats dirtyStats;
+
+    Save_GetDirtyChunkStats(sSaveDataPtr, &dirtyStats);
+    stats->bytesWritten = dirtyStats.bytesWritten;
+    stats->bytesSkipped = dirtyStats.bytesSkipped;
+    stats->bytesCrced = dirtyStats.bytesCrced;
+#else
+    MI_CpuClear8(stats, sizeof(SaveChunkStats));
+#endif //OPTIMIZE_SAVE_DIRTY_CHUNKS
+}
+#pragma GCC visibility pop
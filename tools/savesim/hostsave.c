@@ -0,0 +1,358 @@
+#include "global.h"
+#include "heap.h"
+#include "math_util.h"
+#include "pokemon_storage_system.h"
+#include "save.h"
+#include "save_arrays.h"
+#include "save_data_read_error.h"
+#include "save_data_write_error.h"
+#include "save_misc_data.h"
+#include "system.h"
+#include "unk_0202C034.h"
+#include "unk_02030A98.h"
+#include "savesim.h"
+
+// The parts of the NitroSDK card library, heap.c, save_arrays.c and the
+// save array owners that save.c reaches, less those that take a SaveData,
+// which game.c builds with each variant. The CARD calls go to a flash image
+// the host owns, one page program at a time, so that the power can be cut
+// between any two of them.
+
+_Static_assert(SAVE_BLOCK_NUM == SAVE_NUM_ARRAYS, "SAVE_NUM_ARRAYS must match SAVE_BLOCK_NUM");
+_Static_assert(SAVE_PCSTORAGE == SAVE_ARRAY_PCSTORAGE, "SAVE_ARRAY_PCSTORAGE must match SAVE_PCSTORAGE");
+_Static_assert(NUM_BOXES == SAVE_PC_NUM_BOXES, "SAVE_PC_NUM_BOXES must match NUM_BOXES");
+_Static_assert(sizeof(PC_BOX) == SAVE_PC_BOX_SIZE, "SAVE_PC_BOX_SIZE must match sizeof(PC_BOX)");
+_Static_assert(offsetof(PC_STORAGE, boxModifiedFlag) == SAVE_PC_FLAGS_OFFSET, "SAVE_PC_FLAGS_OFFSET must match PC_STORAGE");
+
+static u8 *sFlash;
+static SaveFlashIo sIo;
+static BOOL sPowerOn = TRUE;
+static int64_t sPagesLeft = -1;
+static int sTear;
+static int sLiveBlocks;
+
+void Host_Init(void) {
+    GF_CRC16Init(HEAP_ID_3);
+    sLiveBlocks = 0;
+}
+
+void Flash_Attach(u8 *image) {
+    sFlash = image;
+}
+
+void Flash_ResetIo(void) {
+    MI_CpuFill8(&sIo, 0, sizeof(SaveFlashIo));
+}
+
+void Flash_GetIo(SaveFlashIo *io) {
+    *io = sIo;
+}
+
+void Flash_CutPowerAfter(int64_t pages, int tear) {
+    sPagesLeft = pages;
+    sTear = tear;
+}
+
+void Flash_PowerOn(void) {
+    sPowerOn = TRUE;
+    sPagesLeft = -1;
+}
+
+int Flash_PowerIsOn(void) {
+    return sPowerOn;
+}
+
+int Host_LiveBlocks(void) {
+    return sLiveBlocks;
+}
+
+// One page program: the flash takes a write a page at a time, so a write
+// that crosses a page boundary is two programs
+static void Flash_Program(u32 dst, const u8 *src, u32 len) {
+    u32 n;
+
+    GF_ASSERT(dst + len <= SAVE_FLASH_SIZE);
+    while (len != 0) {
+        n = SAVE_FLASH_PAGE - dst % SAVE_FLASH_PAGE;
+        if (n > len) {
+            n = len;
+        }
+        if (sPowerOn && sPagesLeft == 0) {
+            if (sTear == SAVE_TEAR_HALF) {
+                __builtin_memcpy(sFlash + dst, src, n / 2);
+            } else if (sTear == SAVE_TEAR_ERASED) {
+                __builtin_memset(sFlash + dst, 0xFF, n);
+            }
+            sPowerOn = FALSE;
+        }
+        if (sPowerOn) {
+            __builtin_memcpy(sFlash + dst, src, n);
+            if (sPagesLeft > 0) {
+                sPagesLeft--;
+            }
+            sIo.pages++;
+            sIo.bytesWritten += n;
+        }
+        dst += n;
+        src += n;
+        len -= n;
+    }
+}
+
+BOOL CARD_IdentifyBackup(CARDBackupType type) {
+    return type == CARD_BACKUP_TYPE_FLASH_4MBITS_EX;
+}
+
+void CARD_LockBackup(u16 lock_id) {
+}
+
+void CARD_UnlockBackup(u16 lock_id) {
+}
+
+s32 OS_GetLockID(void) {
+    return 0x40;
+}
+
+void OS_ReleaseLockID(register u16 lockID) {
+}
+
+void CARD_ReadBackupAsync(u32 src, void *dst, u32 len, MIDmaCallback callback, void *arg) {
+    CARD_ReadBackup(src, dst, len);
+    if (callback != NULL) {
+        callback(arg);
+    }
+}
+
+BOOL CARD_ReadBackup(u32 src, void *dst, u32 len) {
+    GF_ASSERT(src + len <= SAVE_FLASH_SIZE);
+    __builtin_memcpy(dst, sFlash + src, len);
+    sIo.reads++;
+    sIo.bytesRead += len;
+    return TRUE;
+}
+
+// Writes complete before the call returns; the game still waits for the
+// callback and the result code as it does on the card
+void CARD_WriteAndVerifyBackupAsync(u32 dst, const void *src, u32 len, MIDmaCallback callback, void *arg) {
+    Flash_Program(dst, src, len);
+    sIo.writes++;
+    if (callback != NULL) {
+        callback(arg);
+    }
+}
+
+BOOL CARD_WaitBackupAsync(void) {
+    return TRUE;
+}
+
+BOOL CARD_TryWaitBackupAsync(void) {
+    return TRUE;
+}
+
+void CARD_CancelBackupAsync(void) {
+}
+
+CARDResult CARD_GetResultCode(void) {
+    return CARD_RESULT_SUCCESS;
+}
+
+// The selftest CRCs the whole card at every boot and replays every save many
+// times over, so the table is extended to take eight bytes a step. The
+// result is the SDK's bytewise CRC-16/CCITT.
+static u16 sCRC16Slices[8][256];
+
+void MATHi_CRC16InitTable(MATHCRC16Table *table, u16 poly) {
+    int i;
+    int j;
+    u16 r;
+
+    for (i = 0; i < 256; i++) {
+        r = i << 8;
+        for (j = 0; j < 8; j++) {
+            r = (r & 0x8000) ? (r << 1) ^ poly : r << 1;
+        }
+        table->table[i] = r;
+        sCRC16Slices[0][i] = r;
+    }
+    for (i = 0; i < 256; i++) {
+        for (j = 1; j < 8; j++) {
+            sCRC16Slices[j][i] = (sCRC16Slices[j - 1][i] << 8) ^ sCRC16Slices[0][sCRC16Slices[j - 1][i] >> 8];
+        }
+    }
+}
+
+u16 MATH_CalcCRC16CCITT(const MATHCRC16Table *table, const void *input, u32 length) {
+    const u8 *data = input;
+    u16 crc = MATH_CRC16_CCITT_INIT;
+    u32 i = 0;
+
+    for (; i + 8 <= length; i += 8) {
+        crc = sCRC16Slices[7][data[i] ^ (crc >> 8)] ^ sCRC16Slices[6][data[i + 1] ^ (crc & 0xFF)]
+            ^ sCRC16Slices[5][data[i + 2]] ^ sCRC16Slices[4][data[i + 3]]
+            ^ sCRC16Slices[3][data[i + 4]] ^ sCRC16Slices[2][data[i + 5]]
+            ^ sCRC16Slices[1][data[i + 6]] ^ sCRC16Slices[0][data[i + 7]];
+    }
+    for (; i < length; i++) {
+        crc = (crc << 8) ^ table->table[(crc >> 8) ^ data[i]];
+    }
+    return crc;
+}
+
+void *AllocFromHeap(HeapID heap_id, u32 size) {
+    void *ptr = __builtin_malloc(size);
+
+    GF_ASSERT(ptr != NULL);
+    // Fresh blocks hold garbage, as the game's heap does
+    __builtin_memset(ptr, 0xA5, size);
+    sLiveBlocks++;
+    return ptr;
+}
+
+void *AllocFromHeapAtEnd(HeapID heap_id, u32 size) {
+    return AllocFromHeap(heap_id, size);
+}
+
+void FreeToHeap(void *ptr) {
+    GF_ASSERT(ptr != NULL);
+    __builtin_free(ptr);
+    sLiveBlocks--;
+}
+
+void MI_CpuCopy8(const void *src, void *dest, u32 size) {
+    __builtin_memcpy(dest, src, size);
+}
+
+void MI_CpuFill8(void *dest, u8 data, u32 size) {
+    __builtin_memset(dest, data, size);
+}
+
+void MIi_CpuClearFast(u32 value, u32 *dst, u32 size) {
+    u32 i;
+
+    for (i = 0; i < size / 4; i++) {
+        dst[i] = value;
+    }
+}
+
+void Sys_SetSleepDisableFlag(int a0) {
+}
+
+void Sys_ClearSleepDisableFlag(int a0) {
+}
+
+// Any read or write error would have the game put up its error screen
+void ShowSaveDataReadError(HeapID heapId) {
+    GF_ASSERT(FALSE);
+}
+
+void ShowSaveDataWriteError(HeapID heapId, int code) {
+    GF_ASSERT(FALSE);
+}
+
+// The normal data arrays. Their sizes come from sizeof()s all over the game
+// that the host cannot take without building it, so these stand in for them:
+// a spread of small and large arrays whose sizes, with the CRC word save.c
+// adds to each, come to the retail block size of 0xF628 with the footer. The
+// two the asm gives a size for, SAVE_UNK_19 and SAVE_UNK_25, are exact.
+#define HOST_CHUNK(id, size)                                                \
+    static u32 HostChunk##id##_sizeof(void) {                               \
+        return size;                                                        \
+    }
+
+HOST_CHUNK(0, 0x5C)
+HOST_CHUNK(1, 0x9C)
+HOST_CHUNK(2, 0x5A4)
+HOST_CHUNK(3, 0x774)
+HOST_CHUNK(4, 0xE00)
+HOST_CHUNK(5, 0x98)
+HOST_CHUNK(6, 0x340)
+HOST_CHUNK(7, 0x1D4)
+HOST_CHUNK(8, 0x720)
+HOST_CHUNK(9, 0x2C4)
+HOST_CHUNK(10, 0x2260)
+HOST_CHUNK(11, 0x8)
+HOST_CHUNK(12, 0x3E0)
+HOST_CHUNK(13, 0x354)
+HOST_CHUNK(14, 0x1EC)
+HOST_CHUNK(15, 0x148)
+HOST_CHUNK(16, 0x1C8)
+HOST_CHUNK(17, 0xC4)
+HOST_CHUNK(18, 0x7F0)
+HOST_CHUNK(19, 0x1628)
+HOST_CHUNK(20, 0x12C)
+HOST_CHUNK(21, 0x5C)
+HOST_CHUNK(22, 0x8)
+HOST_CHUNK(23, 0x18)
+HOST_CHUNK(24, 0x88)
+HOST_CHUNK(25, 0x8C0)
+HOST_CHUNK(26, 0x9C0)
+HOST_CHUNK(27, 0x1680)
+HOST_CHUNK(28, 0x1C)
+HOST_CHUNK(29, 0x50)
+HOST_CHUNK(30, 0x34)
+HOST_CHUNK(31, 0x454)
+HOST_CHUNK(32, 0x24)
+HOST_CHUNK(33, 0x34)
+HOST_CHUNK(34, 0x2C0)
+HOST_CHUNK(35, 0x8)
+HOST_CHUNK(36, 0x2AFC)
+HOST_CHUNK(37, 0x2F8)
+HOST_CHUNK(38, 0x78)
+HOST_CHUNK(39, 0x1DC)
+HOST_CHUNK(40, 0x18D4)
+
+static u32 HostPCStorage_sizeof(void) {
+    return sizeof(PC_STORAGE);
+}
+
+// The region is cleared before every init; the host fills it in itself
+static void HostChunk_Init(void *data) {
+}
+
+#define HOST_CHUNK_HEADER(id) { id, 0, HostChunk##id##_sizeof, HostChunk_Init }
+
+const struct SaveChunkHeader gSaveChunkHeaders[] = {
+    HOST_CHUNK_HEADER(0), HOST_CHUNK_HEADER(1), HOST_CHUNK_HEADER(2), HOST_CHUNK_HEADER(3),
+    HOST_CHUNK_HEADER(4), HOST_CHUNK_HEADER(5), HOST_CHUNK_HEADER(6), HOST_CHUNK_HEADER(7),
+    HOST_CHUNK_HEADER(8), HOST_CHUNK_HEADER(9), HOST_CHUNK_HEADER(10), HOST_CHUNK_HEADER(11),
+    HOST_CHUNK_HEADER(12), HOST_CHUNK_HEADER(13), HOST_CHUNK_HEADER(14), HOST_CHUNK_HEADER(15),
+    HOST_CHUNK_HEADER(16), HOST_CHUNK_HEADER(17), HOST_CHUNK_HEADER(18), HOST_CHUNK_HEADER(19),
+    HOST_CHUNK_HEADER(20), HOST_CHUNK_HEADER(21), HOST_CHUNK_HEADER(22), HOST_CHUNK_HEADER(23),
+    HOST_CHUNK_HEADER(24), HOST_CHUNK_HEADER(25), HOST_CHUNK_HEADER(26), HOST_CHUNK_HEADER(27),
+    HOST_CHUNK_HEADER(28), HOST_CHUNK_HEADER(29), HOST_CHUNK_HEADER(30), HOST_CHUNK_HEADER(31),
+    HOST_CHUNK_HEADER(32), HOST_CHUNK_HEADER(33), HOST_CHUNK_HEADER(34), HOST_CHUNK_HEADER(35),
+    HOST_CHUNK_HEADER(36), HOST_CHUNK_HEADER(37), HOST_CHUNK_HEADER(38), HOST_CHUNK_HEADER(39),
+    HOST_CHUNK_HEADER(40),
+    { SAVE_PCSTORAGE, 1, HostPCStorage_sizeof, HostChunk_Init },
+};
+const int gNumSaveChunkHeaders = NELEMS(gSaveChunkHeaders);
+
+// Extra chunks never exist here, see SaveMisc_CheckExtraChunksExist
+const struct ExtraSaveChunkHeader gExtraSaveChunkHeaders[] = {
+    { 0, SAVE_PAGE_MAX, HostChunk0_sizeof, HostChunk_Init },
+};
+const int gNumExtraSaveChunkHeaders = NELEMS(gExtraSaveChunkHeaders);
+
+u32 PCStorage_GetSizeOfBox(void) {
+    return sizeof(PC_BOX);
+}
+
+u32 PCStorage_GetNumBoxes(void) {
+    return NUM_BOXES;
+}
+
+BOOL SaveMisc_CheckExtraChunksExist(SAVE_MISC_DATA *saveMiscData) {
+    return FALSE;
+}
+
+void SaveMisc_SetExtraChunksExist(SAVE_MISC_DATA *saveMiscData) {
+    GF_ASSERT(FALSE);
+}
+
+void sub_0202AC38(SAVE_MISC_DATA *saveMiscData, int a1, u32 *a2, u32 *a3, u8 *a4) {
+    GF_ASSERT(FALSE);
+}
+
+void sub_0202AC60(SAVE_MISC_DATA *saveMiscData, int a1, u32 a2, u32 a3, u8 a4) {
+    GF_ASSERT(FALSE);
+}
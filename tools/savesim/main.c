@@ -0,0 +1,863 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stdnoreturn.h>
+#include <stdarg.h>
+#include <time.h>
+#include "savesim.h"
+
+#define MAX_SAVES           100000
+#define MAX_EDITS           64
+#define FOOTER_SIZE         16          // struct SaveChunkFooter
+#define NORMAL_BLOCK_SIZE   0xF628      // retail, as savetool selftest checks
+#define PC_BLOCK_SIZE       0x12310
+
+#define DEFAULT_SAVES       12
+#define DEFAULT_BENCH_SAVES 400
+
+// Arrays by what the workload does to them, from include/constants/save_arrays.h
+#define ARRAY_PLAYERDATA        1
+#define ARRAY_PARTY             2
+#define ARRAY_BAG               3
+#define ARRAY_FLAGS             4
+#define ARRAY_LOCAL_FIELD_DATA  5
+#define ARRAY_POKEDEX           6
+#define ARRAY_MISC              9
+#define ARRAY_MAP_OBJECTS       10
+#define ARRAY_GAMESTATS         16
+
+enum
+{
+    STEP_SAVE,          // SaveGameNormal
+    STEP_SAVE_ASYNC,    // Save_WriteFileAsync until it is done
+    STEP_CANCEL,        // Save_WriteFileAsync, then Save_Cancel part way
+    STEP_REBOOT,
+};
+
+typedef struct Edit
+{
+    uint8_t array;
+    uint32_t offset;
+    uint32_t size;
+    uint32_t seed;
+} Edit;
+
+typedef struct Step
+{
+    uint8_t kind;
+    int cancelAfter;
+    int numEdits;
+    Edit edits[MAX_EDITS];
+} Step;
+
+typedef struct Script
+{
+    int numSteps;
+    Step * steps;
+} Script;
+
+typedef struct Variant
+{
+    const char * name;
+    int (*boot)(void);
+    void (*shutdown)(void);
+    int (*save)(void);
+    int (*saveAsync)(int cancelAfter);
+    uint8_t * (*region)(void);
+    void (*getLayout)(SaveLayoutView * layout);
+    uint32_t (*stateSize)(void);
+    void (*getState)(void * state);
+    void (*setState)(const void * state);
+    void (*getStats)(SaveChunkStats * stats);
+} Variant;
+
+// One build and the flash it saves to
+typedef struct Sim
+{
+    const Variant * variant;
+    uint8_t * flash;
+    uint8_t * flashBefore;      // the flash and SaveData before the save
+    uint8_t * stateBefore;      // being checked, to rewind to
+    uint8_t * flashAfter;
+    uint8_t * stateAfter;
+    uint8_t * pending;          // the region the save being checked writes
+    uint8_t * committed;        // the region as of the last good save
+    bool hasCommitted;
+    bool cancelled;             // a save was cancelled part way since the last good one
+} Sim;
+
+typedef struct CutResult
+{
+    uint32_t cuts;
+    uint32_t loadedNew;
+    uint32_t loadedOld;
+    uint32_t loadedNone;        // first save only: nothing on flash before it
+} CutResult;
+
+static const Variant kVariants[] = {
+    { "base", SaveBase_Boot, SaveBase_Shutdown, SaveBase_Save, SaveBase_SaveAsync, SaveBase_Region,
+      SaveBase_GetLayout, SaveBase_StateSize, SaveBase_GetState, SaveBase_SetState, SaveBase_GetStats },
+    { "delta", SaveDelta_Boot, SaveDelta_Shutdown, SaveDelta_Save, SaveDelta_SaveAsync, SaveDelta_Region,
+      SaveDelta_GetLayout, SaveDelta_StateSize, SaveDelta_GetState, SaveDelta_SetState, SaveDelta_GetStats },
+};
+
+#define NUM_VARIANTS        (int)(sizeof(kVariants) / sizeof(kVariants[0]))
+
+static const char * const kLoadNames[] = { "not exist", "good", "slot fail", "total fail" };
+static const char * const kTearNames[] = { "clean", "half page", "erased page" };
+
+static SaveLayoutView sLayout;
+static uint32_t sRegionSize;
+static int sReported;
+
+static inline noreturn __attribute__((format(printf, 1, 2))) void fatal_error(const char * message, ...)
+{
+    va_list va_args;
+    va_start(va_args, message);
+    fputs("Error: ", stderr);
+    vfprintf(stderr, message, va_args);
+    fputc('\n', stderr);
+    va_end(va_args);
+    exit(EXIT_FAILURE);
+}
+
+// GF_ASSERT in the game objects, which are built with PM_KEEP_ASSERTS
+void GF_AssertFail(void)
+{
+    fatal_error("GF_ASSERT failed in the game code");
+}
+
+static uint32_t ParseU32(const char * arg)
+{
+    char * end;
+    unsigned long long val = strtoull(arg, &end, 0);
+    if (*arg == '\0' || *end != '\0' || val > 0xFFFFFFFFull)
+    {
+        fatal_error("invalid number: %s", arg);
+    }
+    return (uint32_t)val;
+}
+
+static double Now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static uint32_t Random(uint32_t * state)
+{
+    uint32_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return *state = x;
+}
+
+static uint32_t RandomRange(uint32_t * state, uint32_t min, uint32_t max)
+{
+    return min + Random(state) % (max - min + 1);
+}
+
+static void * Alloc(size_t size)
+{
+    void * ptr = malloc(size);
+    if (ptr == NULL)
+    {
+        fatal_error("out of memory");
+    }
+    return ptr;
+}
+
+// ---------------------------------------------------------------------------
+// Workload
+
+// What a stretch of play between two saves touches: the player, the flags,
+// the field state and the stats every time, the party and the bag most of
+// the time, and now and then the dex, the PC or anything else
+static void AddEdit(Step * step, uint32_t * rng, int array)
+{
+    Edit * edit;
+    uint32_t size = sLayout.arraySize[array];
+
+    if (step->numEdits == MAX_EDITS)
+    {
+        return;
+    }
+    edit = &step->edits[step->numEdits++];
+    edit->array = (uint8_t)array;
+    edit->seed = Random(rng);
+    if (array == SAVE_ARRAY_PCSTORAGE)
+    {
+        // A few words inside one box, which the game marks as modified
+        uint32_t box = RandomRange(rng, 0, SAVE_PC_NUM_BOXES - 1);
+        edit->size = 4 * RandomRange(rng, 1, 34);
+        edit->offset = box * SAVE_PC_BOX_SIZE + 4 * RandomRange(rng, 0, (SAVE_PC_BOX_SIZE - edit->size) / 4);
+        return;
+    }
+    edit->size = 4 * RandomRange(rng, 1, 8);
+    if (edit->size > size)
+    {
+        edit->size = size;
+    }
+    edit->offset = 4 * RandomRange(rng, 0, (size - edit->size) / 4);
+}
+
+static void MakeEdits(Step * step, uint32_t * rng)
+{
+    static const int kAlways[] = { ARRAY_PLAYERDATA, ARRAY_FLAGS, ARRAY_LOCAL_FIELD_DATA, ARRAY_MAP_OBJECTS, ARRAY_GAMESTATS };
+
+    step->numEdits = 0;
+    for (size_t i = 0; i < sizeof(kAlways) / sizeof(kAlways[0]); i++)
+    {
+        AddEdit(step, rng, kAlways[i]);
+    }
+    if (Random(rng) % 10 < 7)
+    {
+        AddEdit(step, rng, ARRAY_PARTY);
+    }
+    if (Random(rng) % 10 < 6)
+    {
+        AddEdit(step, rng, ARRAY_BAG);
+    }
+    if (Random(rng) % 10 < 3)
+    {
+        AddEdit(step, rng, ARRAY_POKEDEX);
+    }
+    if (Random(rng) % 10 < 3)
+    {
+        AddEdit(step, rng, ARRAY_MISC);
+    }
+    if (Random(rng) % 10 < 3)
+    {
+        AddEdit(step, rng, SAVE_ARRAY_PCSTORAGE);
+    }
+    for (int array = 0; array < SAVE_ARRAY_PCSTORAGE; array++)
+    {
+        if (Random(rng) % 100 < 4)
+        {
+            AddEdit(step, rng, array);
+        }
+    }
+}
+
+// A new game: every array gets content, and every box is written
+static void MakeNewGame(Step * step, uint32_t * rng)
+{
+    step->numEdits = 0;
+    for (int array = 0; array < SAVE_NUM_ARRAYS; array++)
+    {
+        Edit * edit = &step->edits[step->numEdits++];
+        edit->array = (uint8_t)array;
+        edit->offset = 0;
+        edit->size = array == SAVE_ARRAY_PCSTORAGE ? SAVE_PC_NUM_BOXES * SAVE_PC_BOX_SIZE : sLayout.arraySize[array];
+        edit->seed = Random(rng);
+    }
+}
+
+static void ApplyEdits(uint8_t * region, const Step * step)
+{
+    for (int i = 0; i < step->numEdits; i++)
+    {
+        const Edit * edit = &step->edits[i];
+        uint8_t * array = region + sLayout.arrayOffset[edit->array];
+        uint32_t x = edit->seed | 1;
+
+        for (uint32_t j = 0; j < edit->size; j++)
+        {
+            array[edit->offset + j] = (uint8_t)Random(&x);
+        }
+        if (edit->array == SAVE_ARRAY_PCSTORAGE)
+        {
+            uint32_t flags;
+            memcpy(&flags, array + SAVE_PC_FLAGS_OFFSET, sizeof(flags));
+            for (uint32_t box = edit->offset / SAVE_PC_BOX_SIZE; box * SAVE_PC_BOX_SIZE < edit->offset + edit->size; box++)
+            {
+                flags |= 1u << box;
+            }
+            memcpy(array + SAVE_PC_FLAGS_OFFSET, &flags, sizeof(flags));
+        }
+    }
+}
+
+static void BuildScript(Script * script, int saves, uint32_t seed, bool allKinds)
+{
+    uint32_t rng = seed;
+
+    script->numSteps = 0;
+    script->steps = Alloc(sizeof(Step) * (saves * 2 + 1));
+    for (int i = 0; i < saves; i++)
+    {
+        Step * step = &script->steps[script->numSteps++];
+
+        step->kind = STEP_SAVE;
+        step->cancelAfter = -1;
+        if (i == 0)
+        {
+            MakeNewGame(step, &rng);
+            continue;
+        }
+        MakeEdits(step, &rng);
+        if (!allKinds)
+        {
+            continue;
+        }
+        uint32_t pick = Random(&rng) % 10;
+        if (pick < 3)
+        {
+            step->kind = STEP_SAVE_ASYNC;
+        }
+        else if (pick < 4)
+        {
+            step->kind = STEP_CANCEL;
+            step->cancelAfter = (int)RandomRange(&rng, 1, 3);
+        }
+        else if (pick < 5)
+        {
+            // Power off and on between two sessions, with no save lost
+            Step * reboot = &script->steps[script->numSteps++];
+            *reboot = *step;
+            *step = (Step){ .kind = STEP_REBOOT, .cancelAfter = -1 };
+        }
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Running the two builds
+
+static void Use(const Sim * sim)
+{
+    Flash_Attach(sim->flash);
+}
+
+static void InitSim(Sim * sim, const Variant * variant)
+{
+    sim->variant = variant;
+    sim->flash = Alloc(SAVE_FLASH_SIZE);
+    sim->flashBefore = Alloc(SAVE_FLASH_SIZE);
+    sim->flashAfter = Alloc(SAVE_FLASH_SIZE);
+    sim->stateBefore = Alloc(variant->stateSize());
+    sim->stateAfter = Alloc(variant->stateSize());
+    sim->pending = Alloc(sRegionSize);
+    sim->committed = Alloc(sRegionSize);
+    sim->hasCommitted = false;
+    sim->cancelled = false;
+}
+
+static void FreeSim(Sim * sim)
+{
+    free(sim->flash);
+    free(sim->flashBefore);
+    free(sim->flashAfter);
+    free(sim->stateBefore);
+    free(sim->stateAfter);
+    free(sim->pending);
+    free(sim->committed);
+}
+
+// A blank card: the flash is erased, and SaveData_New finds nothing
+static int NewCard(Sim * sim)
+{
+    memset(sim->flash, 0xFF, SAVE_FLASH_SIZE);
+    sim->hasCommitted = false;
+    Use(sim);
+    return sim->variant->boot();
+}
+
+static void Reboot(Sim * sim, int * status)
+{
+    Use(sim);
+    sim->variant->shutdown();
+    *status = sim->variant->boot();
+}
+
+// The two blocks as far as the footers, which is what a load must restore.
+// The PC's box modified flags are left out: the flash keeps them as they
+// were when saved, and RAM clears them once a save is done.
+static bool SameContent(const uint8_t * a, const uint8_t * b)
+{
+    uint32_t flags = sLayout.arrayOffset[SAVE_ARRAY_PCSTORAGE] + SAVE_PC_FLAGS_OFFSET;
+    uint32_t pcEnd = sLayout.blockOffset[1] + sLayout.blockSize[1] - FOOTER_SIZE;
+    uint32_t normal = sLayout.blockOffset[0];
+
+    return memcmp(a + normal, b + normal, sLayout.blockSize[0] - FOOTER_SIZE) == 0
+        && memcmp(a + sLayout.blockOffset[1], b + sLayout.blockOffset[1], flags - sLayout.blockOffset[1]) == 0
+        && memcmp(a + flags + 4, b + flags + 4, pcEnd - flags - 4) == 0;
+}
+
+static int RunSave(Sim * sim, const Step * step)
+{
+    Use(sim);
+    switch (step->kind)
+    {
+    case STEP_SAVE:
+        return sim->variant->save();
+    case STEP_SAVE_ASYNC:
+        return sim->variant->saveAsync(-1);
+    case STEP_CANCEL:
+        return sim->variant->saveAsync(step->cancelAfter);
+    }
+    fatal_error("not a save step");
+}
+
+static void Snapshot(const Sim * sim, uint8_t * flash, uint8_t * state)
+{
+    memcpy(flash, sim->flash, SAVE_FLASH_SIZE);
+    sim->variant->getState(state);
+}
+
+static void Rewind(Sim * sim, const uint8_t * flash, const uint8_t * state)
+{
+    memcpy(sim->flash, flash, SAVE_FLASH_SIZE);
+    sim->variant->setState(state);
+}
+
+static bool Report(const Sim * sim, int stepNo, const char * what)
+{
+    if (sReported++ < 5)
+    {
+        printf("%s, step %d: %s\n", sim->variant->name, stepNo, what);
+    }
+    return false;
+}
+
+// Rewinds to before the save of step stepNo, cuts the power after pages page
+// programs, and boots from what is on the flash. The load must give back
+// either the last good save or the one in progress, and the next save after
+// it must load back whole.
+static bool CheckCut(Sim * sim, const Step * step, int stepNo, int64_t pages, int tear, int liveBlocks, CutResult * result)
+{
+    static const Step kRecovery = { .kind = STEP_SAVE, .numEdits = 1, .edits = { { ARRAY_FLAGS, 0, 16, 0xC0FFEE } } };
+    const Variant * variant = sim->variant;
+    uint8_t * region;
+    int status;
+    char what[160];
+
+    Use(sim);
+    Rewind(sim, sim->flashBefore, sim->stateBefore);
+    Flash_CutPowerAfter(pages, tear);
+    RunSave(sim, step);
+    bool cut = !Flash_PowerIsOn();
+    Flash_PowerOn();
+    if (!cut)
+    {
+        return true;
+    }
+    result->cuts++;
+    Reboot(sim, &status);
+    region = variant->region();
+    if (status == SAVE_LOAD_IS_GOOD || status == SAVE_LOAD_SLOT_FAIL)
+    {
+        if (SameContent(region, sim->pending))
+        {
+            result->loadedNew++;
+        }
+        else if (sim->hasCommitted && SameContent(region, sim->committed))
+        {
+            result->loadedOld++;
+        }
+        else
+        {
+            snprintf(what, sizeof(what), "cut after %lld pages (%s): loaded (%s) neither the old nor the new save",
+                (long long)pages, kTearNames[tear], kLoadNames[status]);
+            return Report(sim, stepNo, what);
+        }
+    }
+    else if (sim->hasCommitted)
+    {
+        snprintf(what, sizeof(what), "cut after %lld pages (%s): %s with a good save on the flash",
+            (long long)pages, kTearNames[tear], kLoadNames[status]);
+        return Report(sim, stepNo, what);
+    }
+    else
+    {
+        result->loadedNone++;
+    }
+
+    // The session goes on from whatever was loaded
+    ApplyEdits(region, &kRecovery);
+    uint8_t * expected = Alloc(sRegionSize);
+    memcpy(expected, region, sRegionSize);
+    int ret = RunSave(sim, &kRecovery);
+    Reboot(sim, &status);
+    bool ok = ret == SAVE_WRITE_SUCCESS && status == SAVE_LOAD_IS_GOOD && SameContent(variant->region(), expected);
+    free(expected);
+    if (!ok)
+    {
+        snprintf(what, sizeof(what), "cut after %lld pages (%s): the next save wrote %d and loaded back %s%s",
+            (long long)pages, kTearNames[tear], ret, kLoadNames[status], status == SAVE_LOAD_IS_GOOD ? ", different" : "");
+        return Report(sim, stepNo, what);
+    }
+    if (Host_LiveBlocks() != liveBlocks)
+    {
+        return Report(sim, stepNo, "heap blocks leaked across the cut");
+    }
+    return true;
+}
+
+// Runs one step on one build. With cuts, every save is also replayed from
+// the same starting point with the power cut at each page program it makes,
+// and each of the three ways the page in flight can be left.
+static bool RunStep(Sim * sim, const Step * step, int stepNo, bool cuts, CutResult * result, SaveFlashIo * io, SaveChunkStats * stats)
+{
+    const Variant * variant = sim->variant;
+    char what[160];
+    int status;
+    bool ok = true;
+
+    Use(sim);
+    if (step->kind == STEP_REBOOT)
+    {
+        // A cancelled save can leave the other sector with its normal data
+        // written and its PC block not, which loads as a slot failure
+        Reboot(sim, &status);
+        bool loaded = status == SAVE_LOAD_IS_GOOD || (sim->cancelled && status == SAVE_LOAD_SLOT_FAIL);
+        if (!loaded || !SameContent(variant->region(), sim->committed))
+        {
+            snprintf(what, sizeof(what), "reboot loaded %s%s", kLoadNames[status], loaded ? ", different" : "");
+            return Report(sim, stepNo, what);
+        }
+        return true;
+    }
+
+    ApplyEdits(variant->region(), step);
+    memcpy(sim->pending, variant->region(), sRegionSize);
+    Snapshot(sim, sim->flashBefore, sim->stateBefore);
+    Flash_ResetIo();
+    int ret = RunSave(sim, step);
+    Flash_GetIo(io);
+    variant->getStats(stats);
+    Snapshot(sim, sim->flashAfter, sim->stateAfter);
+
+    int expected = step->kind == STEP_CANCEL ? SAVE_WRITE_CANCELLED : SAVE_WRITE_SUCCESS;
+    if (ret != expected)
+    {
+        snprintf(what, sizeof(what), "save returned %d", ret);
+        return Report(sim, stepNo, what);
+    }
+    if (cuts && step->kind != STEP_CANCEL)
+    {
+        int liveBlocks = Host_LiveBlocks();
+        for (int64_t pages = 0; pages < io->pages; pages++)
+        {
+            for (int tear = SAVE_TEAR_NONE; tear <= SAVE_TEAR_ERASED; tear++)
+            {
+                ok &= CheckCut(sim, step, stepNo, pages, tear, liveBlocks, result);
+            }
+        }
+        Rewind(sim, sim->flashAfter, sim->stateAfter);
+    }
+    sim->cancelled = step->kind == STEP_CANCEL;
+    if (!sim->cancelled)
+    {
+        memcpy(sim->committed, variant->region(), sRegionSize);
+        sim->hasCommitted = true;
+    }
+    return ok;
+}
+
+static void GetLayout(void)
+{
+    Sim sim;
+
+    InitSim(&sim, &kVariants[0]);
+    NewCard(&sim);
+    kVariants[0].getLayout(&sLayout);
+    kVariants[0].shutdown();
+    FreeSim(&sim);
+    if (sLayout.blockSize[0] != NORMAL_BLOCK_SIZE || sLayout.blockSize[1] != PC_BLOCK_SIZE)
+    {
+        fatal_error("blocks are 0x%X and 0x%X bytes, not the retail 0x%X and 0x%X",
+            sLayout.blockSize[0], sLayout.blockSize[1], NORMAL_BLOCK_SIZE, PC_BLOCK_SIZE);
+    }
+    sRegionSize = sLayout.blockOffset[1] + sLayout.blockSize[1];
+}
+
+// ---------------------------------------------------------------------------
+// Self-test
+
+// Both builds through the same session in lockstep. After every save that
+// completes they must have put the same bytes on the flash: the delta build
+// skips only what the target sector already holds. With cuts, every save
+// is also cut short at each of its page programs.
+static int CheckSession(int saves, uint32_t seed, bool cuts)
+{
+    Script script;
+    Sim sims[NUM_VARIANTS];
+    CutResult results[NUM_VARIANTS] = { 0 };
+    uint64_t pages[NUM_VARIANTS] = { 0 };
+    int failed = 0;
+
+    BuildScript(&script, saves, seed, true);
+    for (int v = 0; v < NUM_VARIANTS; v++)
+    {
+        InitSim(&sims[v], &kVariants[v]);
+        if (NewCard(&sims[v]) != SAVE_LOAD_NOT_EXIST)
+        {
+            fatal_error("%s: a blank card did not load as empty", kVariants[v].name);
+        }
+    }
+    for (int i = 0; i < script.numSteps; i++)
+    {
+        const Step * step = &script.steps[i];
+
+        for (int v = 0; v < NUM_VARIANTS; v++)
+        {
+            SaveFlashIo io = { 0 };
+            SaveChunkStats stats;
+            failed += !RunStep(&sims[v], step, i, cuts, &results[v], &io, &stats);
+            pages[v] += io.pages;
+        }
+        // A cancel stops each build at a different point in its writes
+        if (!sims[0].cancelled && memcmp(sims[0].flash, sims[1].flash, SAVE_FLASH_SIZE) != 0)
+        {
+            failed += Report(&sims[1], i, "the flash differs from the base build's") ? 0 : 1;
+        }
+    }
+    for (int v = 0; v < NUM_VARIANTS; v++)
+    {
+        printf("%-5s %d steps, %llu pages written", kVariants[v].name, script.numSteps, (unsigned long long)pages[v]);
+        if (cuts)
+        {
+            printf(", %u cuts: %u loaded the new save, %u the old one, %u found none",
+                results[v].cuts, results[v].loadedNew, results[v].loadedOld, results[v].loadedNone);
+        }
+        printf("\n");
+        Use(&sims[v]);
+        kVariants[v].shutdown();
+        FreeSim(&sims[v]);
+    }
+    free(script.steps);
+    return failed;
+}
+
+// The delta build's counters over saves whose changes are known
+static int CheckStats(void)
+{
+    static const struct
+    {
+        const char * name;
+        int editArray;          // -1: nothing changes before the save
+        bool reboot;
+        int written;            // arrays written: 0, 1 (the one edited), or -1 all
+        int crced;
+    } kCases[] = {
+        { "nothing changed", -1, false, 0, 0 },
+        { "one array changed", ARRAY_FLAGS, false, 1, 1 },
+        { "the other sector catches up", -1, false, 1, 0 },
+        { "both sectors current", -1, false, 0, 0 },
+        { "after a reboot", -1, true, 0, 0 },
+        { "one array after a reboot", ARRAY_BAG, false, 1, 1 },
+    };
+    Script script;
+    Sim sims[NUM_VARIANTS];
+    int failed = 0;
+    uint32_t normalSize = sLayout.blockSize[0] - FOOTER_SIZE;
+
+    // A new game, saved once into each sector
+    BuildScript(&script, 2, 7, false);
+    for (int v = 0; v < NUM_VARIANTS; v++)
+    {
+        CutResult result = { 0 };
+        SaveFlashIo io;
+        SaveChunkStats stats;
+
+        InitSim(&sims[v], &kVariants[v]);
+        NewCard(&sims[v]);
+        for (int i = 0; i < script.numSteps; i++)
+        {
+            script.steps[i].numEdits = i == 0 ? script.steps[i].numEdits : 0;
+            failed += !RunStep(&sims[v], &script.steps[i], i, false, &result, &io, &stats);
+            // Neither sector has been saved to by this SaveData yet
+            if (v == 1 && stats.bytesWritten != normalSize)
+            {
+                printf("full save %d: %u bytes written, expected %u\n", i, stats.bytesWritten, normalSize);
+                failed++;
+            }
+        }
+    }
+    for (size_t c = 0; c < sizeof(kCases) / sizeof(kCases[0]); c++)
+    {
+        Step step = { .kind = STEP_SAVE, .cancelAfter = -1 };
+        SaveFlashIo io[NUM_VARIANTS];
+        SaveChunkStats stats[NUM_VARIANTS];
+        CutResult result = { 0 };
+
+        if (kCases[c].editArray >= 0)
+        {
+            step.numEdits = 1;
+            step.edits[0] = (Edit){ (uint8_t)kCases[c].editArray, 8, 4, 0x5EED + (uint32_t)c };
+        }
+        for (int v = 0; v < NUM_VARIANTS; v++)
+        {
+            if (kCases[c].reboot)
+            {
+                Step reboot = { .kind = STEP_REBOOT };
+                failed += !RunStep(&sims[v], &reboot, (int)c, false, &result, &io[v], &stats[v]);
+            }
+            failed += !RunStep(&sims[v], &step, (int)c, false, &result, &io[v], &stats[v]);
+        }
+        uint32_t arraySize = kCases[c].editArray >= 0 ? sLayout.arraySize[kCases[c].editArray] : sLayout.arraySize[ARRAY_FLAGS];
+        uint32_t wantWritten = kCases[c].written * arraySize;
+        uint32_t wantCrced = kCases[c].crced * arraySize;
+        bool ok = stats[1].bytesWritten == wantWritten && stats[1].bytesCrced == wantCrced
+            && stats[1].bytesWritten + stats[1].bytesSkipped == normalSize
+            && memcmp(sims[0].flash, sims[1].flash, SAVE_FLASH_SIZE) == 0;
+        printf("%-28s %6u bytes written, %6u skipped, %6u CRCed; base build %6u bytes: %s\n",
+            kCases[c].name, stats[1].bytesWritten, stats[1].bytesSkipped, stats[1].bytesCrced, io[0].bytesWritten,
+            ok ? "ok" : "FAILED");
+        failed += !ok;
+    }
+    for (int v = 0; v < NUM_VARIANTS; v++)
+    {
+        Use(&sims[v]);
+        kVariants[v].shutdown();
+        FreeSim(&sims[v]);
+    }
+    free(script.steps);
+    return failed;
+}
+
+static int CommandSelfTest(int saves, uint32_t seed)
+{
+    int failed = 0;
+
+    failed += CheckStats();
+    failed += CheckSession(saves, seed, true);
+    failed += CheckSession(saves * 20, seed + 1, false);
+    printf("%d checks failed\n", failed);
+    return failed == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+// ---------------------------------------------------------------------------
+// Bench
+
+// The same session through each build on its own: what reaches the flash
+// and how long a save takes, the first, full save apart from the rest
+static int CommandBench(int saves, uint32_t seed)
+{
+    Script script;
+
+    BuildScript(&script, saves, seed, false);
+    for (int v = 0; v < NUM_VARIANTS; v++)
+    {
+        const Variant * variant = &kVariants[v];
+        Sim sim;
+        SaveFlashIo io;
+        SaveChunkStats stats;
+        uint64_t pages = 0, bytes = 0, crced = 0;
+        double seconds = 0;
+
+        InitSim(&sim, variant);
+        NewCard(&sim);
+        for (int i = 0; i < script.numSteps; i++)
+        {
+            const Step * step = &script.steps[i];
+            ApplyEdits(variant->region(), step);
+            Flash_ResetIo();
+            double start = Now();
+            if (variant->save() != SAVE_WRITE_SUCCESS)
+            {
+                fatal_error("%s: save %d failed", variant->name, i);
+            }
+            double elapsed = Now() - start;
+            Flash_GetIo(&io);
+            variant->getStats(&stats);
+            if (i == 0)
+            {
+                printf("%-5s first save: %u pages, %u bytes, %.0f us\n", variant->name, io.pages, io.bytesWritten, elapsed * 1e6);
+                continue;
+            }
+            pages += io.pages;
+            bytes += io.bytesWritten;
+            crced += stats.bytesCrced;
+            seconds += elapsed;
+        }
+        int n = script.numSteps - 1;
+        printf("%-5s %d saves after it: %.1f pages, %.0f bytes written", variant->name, n, (double)pages / n, (double)bytes / n);
+        if (v == 1)
+        {
+            printf(", %.0f bytes re-CRCed", (double)crced / n);
+        }
+        printf(", %.1f us per save\n", seconds * 1e6 / n);
+        variant->shutdown();
+        FreeSim(&sim);
+    }
+    free(script.steps);
+    return EXIT_SUCCESS;
+}
+
+// ---------------------------------------------------------------------------
+
+static noreturn void Usage(const char * prog)
+{
+    fprintf(stderr,
+        "Usage: %s COMMAND [options]\n"
+        "Runs the save path of src/save.c on the host, with and without\n"
+        "OPTIMIZE_SAVE_DIRTY_CHUNKS, over a model of the 4 Mbit backup flash.\n"
+        "Commands:\n"
+        "  selftest              check the delta build's write and CRC counters\n"
+        "                        on known changes; run both builds through a\n"
+        "                        session of saves, async saves, cancelled saves\n"
+        "                        and reboots, with the same flash after every\n"
+        "                        save, cutting the power at every page program\n"
+        "                        of every save; then a longer session uncut\n"
+        "  bench                 pages and bytes written and host time per save\n"
+        "                        for each build over the same session\n"
+        "Options:\n"
+        "  --saves N             saves in the session (default %d, bench %d)\n"
+        "  --seed N              session seed\n",
+        prog, DEFAULT_SAVES, DEFAULT_BENCH_SAVES);
+    exit(EXIT_FAILURE);
+}
+
+int main(int argc, char ** argv)
+{
+    if (argc < 2)
+    {
+        Usage(argv[0]);
+    }
+    const char * command = argv[1];
+    uint32_t saves = 0;
+    uint32_t seed = 1;
+
+    for (int i = 2; i < argc; i++)
+    {
+        const char * opt = argv[i];
+        if (i + 1 >= argc)
+        {
+            Usage(argv[0]);
+        }
+        if (strcmp(opt, "--saves") == 0)
+        {
+            saves = ParseU32(argv[++i]);
+        }
+        else if (strcmp(opt, "--seed") == 0)
+        {
+            seed = ParseU32(argv[++i]);
+        }
+        else
+        {
+            Usage(argv[0]);
+        }
+    }
+    if (saves > MAX_SAVES || seed == 0)
+    {
+        Usage(argv[0]);
+    }
+
+    Host_Init();
+    GetLayout();
+
+    if (strcmp(command, "selftest") == 0)
+    {
+        return CommandSelfTest(saves != 0 ? (int)saves : DEFAULT_SAVES, seed);
+    }
+    if (strcmp(command, "bench") == 0)
+    {
+        return CommandBench(saves != 0 ? (int)saves : DEFAULT_BENCH_SAVES, seed);
+    }
+    Usage(argv[0]);
+}
@@ -0,0 +1,109 @@
+#ifndef GUARD_SAVESIM_SAVESIM_H
+#define GUARD_SAVESIM_SAVESIM_H
+
+// The boundary between the host side (main.c) and the objects built from the
+// game's sources (game.c, hostsave.c, src/save.c and src/math_util.c). Plain
+// C types only, so that both sides can include it with their own headers.
+
+#include <stdint.h>
+
+#define SAVE_FLASH_SIZE         0x80000     // CARD_BACKUP_TYPE_FLASH_4MBITS
+#define SAVE_FLASH_PAGE         0x100       // what one program operation covers
+#define SAVE_NUM_ARRAYS         42          // SAVE_BLOCK_NUM
+#define SAVE_ARRAY_PCSTORAGE    41          // SAVE_PCSTORAGE
+#define SAVE_PC_NUM_BOXES       18          // NUM_BOXES
+#define SAVE_PC_BOX_SIZE        0x1000      // sizeof(PC_BOX)
+#define SAVE_PC_FLAGS_OFFSET    0x12004     // offsetof(PC_STORAGE, boxModifiedFlag)
+
+// LOAD_STATUS_* and WRITE_STATUS_* from include/save.h
+enum
+{
+    SAVE_LOAD_NOT_EXIST,
+    SAVE_LOAD_IS_GOOD,
+    SAVE_LOAD_SLOT_FAIL,
+    SAVE_LOAD_TOTAL_FAIL,
+};
+
+enum
+{
+    SAVE_WRITE_CONTINUE,
+    SAVE_WRITE_NEXT,
+    SAVE_WRITE_SUCCESS,
+    SAVE_WRITE_TOTAL_FAIL,
+    SAVE_WRITE_CANCELLED,       // SaveAsync only: Save_Cancel was called
+};
+
+// What the page in flight holds when the power goes
+enum
+{
+    SAVE_TEAR_NONE,             // untouched: the cut falls between two pages
+    SAVE_TEAR_HALF,             // its first half programmed, the rest old
+    SAVE_TEAR_ERASED,           // erased to 0xFF and never programmed
+};
+
+// What reached the flash since the last Flash_ResetIo
+typedef struct SaveFlashIo
+{
+    uint32_t writes;            // CARD_WriteAndVerifyBackupAsync calls
+    uint32_t pages;             // page programs, counting partial pages
+    uint32_t bytesWritten;
+    uint32_t reads;
+    uint32_t bytesRead;
+} SaveFlashIo;
+
+// Where each array and the two blocks sit in SaveData.dynamic_region, and
+// so in each half of the flash. Block sizes include the footer.
+typedef struct SaveLayoutView
+{
+    uint32_t arrayOffset[SAVE_NUM_ARRAYS];
+    uint32_t arraySize[SAVE_NUM_ARRAYS];
+    uint32_t blockOffset[2];
+    uint32_t blockSize[2];
+} SaveLayoutView;
+
+// struct SaveDirtyChunkStats; all zero without OPTIMIZE_SAVE_DIRTY_CHUNKS
+typedef struct SaveChunkStats
+{
+    uint32_t bytesWritten;
+    uint32_t bytesSkipped;
+    uint32_t bytesCrced;
+} SaveChunkStats;
+
+// The flash and heap models in hostsave.c. Host_Init sets up the CRC table
+// once. image is SAVE_FLASH_SIZE bytes that the CARD calls read and write.
+void Host_Init(void);
+void Flash_Attach(uint8_t * image);
+void Flash_ResetIo(void);
+void Flash_GetIo(SaveFlashIo * io);
+// After pages more page programs the power goes, leaving the next page as
+// tear says, and nothing reaches the flash until Flash_PowerOn. The game
+// code keeps running and sees every write succeed. pages < 0 never cuts.
+void Flash_CutPowerAfter(int64_t pages, int tear);
+void Flash_PowerOn(void);
+int Flash_PowerIsOn(void);
+int Host_LiveBlocks(void);
+
+// save.c is built twice, as it ships (SaveBase_) and with
+// OPTIMIZE_SAVE_DIRTY_CHUNKS (SaveDelta_). Boot is SaveData_New over the
+// attached flash and returns the LOAD_STATUS_* it acted on; Shutdown frees
+// the SaveData. Save is SaveGameNormal. SaveAsync drives
+// Save_PrepareForAsyncWrite and Save_WriteFileAsync, and calls Save_Cancel
+// instead after cancelAfter steps if that is not negative. Region is
+// SaveData.dynamic_region. GetState and SetState copy the whole SaveData,
+// StateSize bytes, so that a session can be rewound.
+#define SAVE_DECLARE_VARIANT(prefix)                                        \
+    int prefix##Boot(void);                                                 \
+    void prefix##Shutdown(void);                                            \
+    int prefix##Save(void);                                                 \
+    int prefix##SaveAsync(int cancelAfter);                                 \
+    uint8_t * prefix##Region(void);                                         \
+    void prefix##GetLayout(SaveLayoutView * layout);                        \
+    uint32_t prefix##StateSize(void);                                       \
+    void prefix##GetState(void * state);                                    \
+    void prefix##SetState(const void * state);                              \
+    void prefix##GetStats(SaveChunkStats * stats);
+
+SAVE_DECLARE_VARIANT(SaveBase_)
+SAVE_DECLARE_VARIANT(SaveDelta_)
+
+#endif //GUARD_SAVESIM_SAVESIM_H
@@ -0,0 +1,134 @@
+// save.c as the game builds it, for the boot-time checks, the footers and the
+// layout they assume. save_arrays.c and the save array owners the host can
+// build are linked in unchanged, so the block sizes come from the game's own
+// sizeof()s; hostsave.c has the rest.
+#include "../../src/save.c"
+
+#include "savetool.h"
+
+// The SaveData that SaveData_New has set up by the time it reads the flash,
+// shared read-only by every thread. Calls that change a SaveData get a copy.
+static SaveData *sLayoutData;
+
+static SaveData *SaveTool_CopySaveData(void) {
+    SaveData *saveData = AllocFromHeap(HEAP_ID_3, sizeof(SaveData));
+
+    MI_CpuCopy8(sLayoutData, saveData, sizeof(SaveData));
+    return saveData;
+}
+
+void SaveTool_Init(void) {
+    GF_CRC16Init(HEAP_ID_3);
+    sLayoutData = AllocFromHeap(HEAP_ID_1, sizeof(SaveData));
+    MI_CpuClearFast(sLayoutData, sizeof(SaveData));
+    sLayoutData->sectorCleanFlag[0] = 1;
+    sLayoutData->sectorCleanFlag[1] = 1;
+    SaveData_InitSubstructs(sLayoutData->arrayHeaders);
+    SaveData_InitSlotSpecs(sLayoutData->saveSlotSpecs, sLayoutData->arrayHeaders);
+}
+
+void SaveTool_GetLayout(SaveLayoutView *layout) {
+    struct SaveSlotSpec *spec;
+    int i;
+
+    GF_ASSERT(gNumExtraSaveChunkHeaders <= SAVE_MAX_EXTRA_CHUNKS);
+    layout->regionSize = SAVE_PAGE_MAX * SAVE_SECTOR_SIZE;
+    for (i = 0; i < 2; i++) {
+        spec = &sLayoutData->saveSlotSpecs[i];
+        layout->sectorOffset[i] = GetChunkOffsetFromCurrentSaveSlot(i, spec) - spec->offset;
+        layout->blockOffset[i] = spec->offset;
+        layout->blockSize[i] = spec->size;
+    }
+    layout->footerSize = sizeof(struct SaveChunkFooter);
+    layout->numExtraChunks = gNumExtraSaveChunkHeaders;
+    for (i = 0; i < gNumExtraSaveChunkHeaders; i++) {
+        // The two copies ReadExtraSaveChunk reads
+        layout->extraOffset[i][0] = gExtraSaveChunkHeaders[i].sector * SAVE_SECTOR_SIZE;
+        layout->extraOffset[i][1] = (gExtraSaveChunkHeaders[i].sector + 64) * SAVE_SECTOR_SIZE;
+        layout->extraSize[i] = gExtraSaveChunkHeaders[i].sizeFunc();
+    }
+    layout->extraFooterSize = sizeof(struct SaveArrayFooter);
+}
+
+uint16_t SaveTool_CalcCRC16(const void *data, uint32_t size) {
+    return GF_CalcCRC16(data, size);
+}
+
+void SaveTool_CheckBlock(const uint8_t *region, int idx, SaveBlockCheck *check) {
+    struct SaveSlotCheck slotCheck;
+    struct SaveChunkFooter *footer;
+
+    footer = GetSaveSectorFooterPtr(sLayoutData, (void *)region, idx);
+    SaveSlotCheck_InitFromSavedat(&slotCheck, sLayoutData, (void *)region, idx);
+    check->valid = slotCheck.valid;
+    check->count = slotCheck.count;
+    check->footerCount = footer->count;
+    if (slotCheck.valid) {
+        check->problem = SAVE_BLOCK_OK;
+    } else if (footer->magic != SAVE_CHUNK_MAGIC) {
+        check->problem = SAVE_BLOCK_NO_FOOTER;
+    } else if (footer->size != sLayoutData->saveSlotSpecs[idx].size) {
+        check->problem = SAVE_BLOCK_WRONG_SIZE;
+    } else if (footer->slot != idx) {
+        check->problem = SAVE_BLOCK_WRONG_ID;
+    } else {
+        check->problem = SAVE_BLOCK_BAD_CRC;
+    }
+}
+
+void SaveTool_GetStatus(SaveBootStatus *status) {
+    SaveData *saveData = SaveTool_CopySaveData();
+
+    status->status = Save_GetSaveFilesStatus(saveData);
+    if (status->status == LOAD_STATUS_IS_GOOD || status->status == LOAD_STATUS_SLOT_FAIL) {
+        status->sector = saveData->lastGoodSector;
+        status->count = saveData->saveCounter;
+    } else {
+        status->sector = -1;
+        status->count = 0;
+    }
+    FreeToHeap(saveData);
+}
+
+void SaveTool_CheckExtraChunk(int idx, SaveExtraCheck *check) {
+    const struct ExtraSaveChunkHeader *hdr = &gExtraSaveChunkHeaders[idx];
+    SaveData *saveData = SaveTool_CopySaveData();
+    u32 size = hdr->sizeFunc();
+    u8 *data;
+    int ret;
+    int i;
+
+    data = AllocFromHeap(HEAP_ID_3, size + sizeof(struct SaveArrayFooter));
+    for (i = 0; i < 2; i++) {
+        FlashLoadChunk((hdr->sector + 64 * i) * SAVE_SECTOR_SIZE, data, size + sizeof(struct SaveArrayFooter));
+        check->present[i] = ((struct SaveArrayFooter *)(data + size))->magic == SAVE_CHUNK_MAGIC;
+        check->valid[i] = ValidateChunk(saveData, data, idx, size);
+        check->saveno[i] = SaveArray_GetFooterSaveNo(data, size);
+    }
+    FreeToHeap(data);
+
+    data = ReadExtraSaveChunk(saveData, HEAP_ID_3, idx, &ret);
+    check->loaded = ret == 1 ? (int)saveData->lastGoodSaveSlot : -1;
+    FreeToHeap(data);
+    FreeToHeap(saveData);
+}
+
+int SaveTool_CompareCount(uint32_t a, uint32_t b) {
+    return SaveCounterCompare(a, b);
+}
+
+void SaveTool_BuildFooter(uint8_t *region, int idx, uint32_t count) {
+    SaveData *saveData = SaveTool_CopySaveData();
+
+    saveData->saveCounter = count;
+    SaveSlot_BuildFooter(saveData, region, idx);
+    FreeToHeap(saveData);
+}
+
+void SaveTool_BuildChunkFooter(uint8_t *data, int idx, uint32_t saveno) {
+    SaveData *saveData = SaveTool_CopySaveData();
+
+    saveData->lastGoodSaveNo = saveno - 1;
+    CreateChunkFooter(saveData, data, idx, gExtraSaveChunkHeaders[idx].sizeFunc());
+    FreeToHeap(saveData);
+}
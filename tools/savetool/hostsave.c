@@ -0,0 +1,395 @@
+#include "global.h"
+#include "apricorn_tree.h"
+#include "bag.h"
+#include "coins.h"
+#include "field_player_avatar.h"
+#include "gf_rtc.h"
+#include "gymmick.h"
+#include "heap.h"
+#include "igt.h"
+#include "mail_message.h"
+#include "math_util.h"
+#include "msgdata.h"
+#include "options.h"
+#include "pokedex.h"
+#include "pokemon.h"
+#include "sav_system_info.h"
+#include "save.h"
+#include "save_arrays.h"
+#include "save_data_read_error.h"
+#include "string_util.h"
+#include "unk_0203BA5C.h"
+#include "savetool.h"
+
+// The parts of the NitroSDK card library, heap.c and the save array owners
+// that save.c and save_arrays.c reach and the host does not build. The CARD
+// calls read the image the calling thread attached, so that each of the
+// host's worker threads can look at a file of its own. Nothing here writes to
+// the flash: the host edits its own copy and writes the file itself.
+
+#define HOST_CRC_MEMO_MAX 16
+
+typedef struct HostCrcMemo {
+    const u8 *data;
+    u32 length;
+    u16 crc;
+} HostCrcMemo;
+
+static __thread const u8 *sFlash;
+
+static u16 sCRC16Poly;
+static u16 sCRC16Slices[8][256];
+static __thread HostCrcMemo sCrcMemo[HOST_CRC_MEMO_MAX];
+static __thread int sNumCrcMemos;
+static __thread int sCrcMode;
+static __thread const u8 *sFlipPos;
+static __thread u8 sFlipXor;
+
+void Flash_Attach(const uint8_t *image) {
+    sFlash = image;
+}
+
+void CARD_LockBackup(u16 lock_id) {
+}
+
+void CARD_UnlockBackup(u16 lock_id) {
+}
+
+s32 OS_GetLockID(void) {
+    return 0x40;
+}
+
+void OS_ReleaseLockID(register u16 lockID) {
+}
+
+BOOL CARD_ReadBackup(u32 src, void *dst, u32 len) {
+    GF_ASSERT(src + len <= SAVE_FILE_SIZE);
+    __builtin_memcpy(dst, sFlash + src, len);
+    return TRUE;
+}
+
+void CARD_ReadBackupAsync(u32 src, void *dst, u32 len, MIDmaCallback callback, void *arg) {
+    CARD_ReadBackup(src, dst, len);
+    if (callback != NULL) {
+        callback(arg);
+    }
+}
+
+BOOL CARD_WaitBackupAsync(void) {
+    return TRUE;
+}
+
+// A failed read would have the game put up its error screen
+void ShowSaveDataReadError(HeapID heapId) {
+    GF_ASSERT(FALSE);
+}
+
+// The table is extended to take eight bytes a step, since check and fuzz CRC
+// every block of every file they are given. The result is the SDK's bytewise
+// CRC-16/CCITT.
+void MATHi_CRC16InitTable(MATHCRC16Table *table, u16 poly) {
+    int i;
+    int j;
+    u16 r;
+
+    sCRC16Poly = poly;
+    for (i = 0; i < 256; i++) {
+        r = i << 8;
+        for (j = 0; j < 8; j++) {
+            r = (r & 0x8000) ? (r << 1) ^ poly : r << 1;
+        }
+        table->table[i] = r;
+        sCRC16Slices[0][i] = r;
+    }
+    for (i = 0; i < 256; i++) {
+        for (j = 1; j < 8; j++) {
+            sCRC16Slices[j][i] = (sCRC16Slices[j - 1][i] << 8) ^ sCRC16Slices[0][sCRC16Slices[j - 1][i] >> 8];
+        }
+    }
+}
+
+static u16 HostCrc_Calc(const MATHCRC16Table *table, const u8 *data, u32 length) {
+    u16 crc = MATH_CRC16_CCITT_INIT;
+    u32 i = 0;
+
+    for (; i + 8 <= length; i += 8) {
+        crc = sCRC16Slices[7][data[i] ^ (crc >> 8)] ^ sCRC16Slices[6][data[i + 1] ^ (crc & 0xFF)]
+            ^ sCRC16Slices[5][data[i + 2]] ^ sCRC16Slices[4][data[i + 3]]
+            ^ sCRC16Slices[3][data[i + 4]] ^ sCRC16Slices[2][data[i + 5]]
+            ^ sCRC16Slices[1][data[i + 6]] ^ sCRC16Slices[0][data[i + 7]];
+    }
+    for (; i < length; i++) {
+        crc = (crc << 8) ^ table->table[(crc >> 8) ^ data[i]];
+    }
+    return crc;
+}
+
+// Product of two polynomials mod the CRC polynomial
+static u16 HostCrc_MulMod(u16 a, u16 b) {
+    u16 ret = 0;
+    int i;
+
+    for (i = 15; i >= 0; i--) {
+        ret = (ret & 0x8000) ? (ret << 1) ^ sCRC16Poly : ret << 1;
+        if (b & (1 << i)) {
+            ret ^= a;
+        }
+    }
+    return ret;
+}
+
+// What n zero bytes do to the register: x^(8n) mod the CRC polynomial
+static u16 HostCrc_ZeroShift(u32 n) {
+    u16 ret = 1;
+    u16 base = 1 << 8;
+
+    for (; n != 0; n >>= 1) {
+        if (n & 1) {
+            ret = HostCrc_MulMod(ret, base);
+        }
+        base = HostCrc_MulMod(base, base);
+    }
+    return ret;
+}
+
+// The CRC is linear in the data, so a byte XORed with x moves it by the CRC
+// of x alone followed by as many zeros as come after it in the range
+u16 MATH_CalcCRC16CCITT(const MATHCRC16Table *table, const void *input, u32 length) {
+    const u8 *data = input;
+    HostCrcMemo *memo;
+    u16 crc;
+    int i;
+
+    if (sCrcMode == CRC_RECALL) {
+        for (i = 0; i < sNumCrcMemos; i++) {
+            memo = &sCrcMemo[i];
+            if (memo->data == data && memo->length == length) {
+                crc = memo->crc;
+                if (sFlipPos >= data && sFlipPos < data + length) {
+                    crc ^= HostCrc_MulMod(table->table[sFlipXor], HostCrc_ZeroShift(data + length - 1 - sFlipPos));
+                }
+                return crc;
+            }
+        }
+    }
+    crc = HostCrc_Calc(table, data, length);
+    if (sCrcMode == CRC_RECORD) {
+        GF_ASSERT(sNumCrcMemos < HOST_CRC_MEMO_MAX);
+        memo = &sCrcMemo[sNumCrcMemos++];
+        memo->data = data;
+        memo->length = length;
+        memo->crc = crc;
+    }
+    return crc;
+}
+
+void Crc_SetMode(int mode) {
+    sCrcMode = mode;
+}
+
+void Crc_Forget(void) {
+    sNumCrcMemos = 0;
+    sCrcMode = CRC_PLAIN;
+    sFlipPos = NULL;
+}
+
+void Crc_SetFlip(const void *pos, uint8_t xor) {
+    sFlipPos = pos;
+    sFlipXor = xor;
+}
+
+void *AllocFromHeap(HeapID heap_id, u32 size) {
+    void *ptr = __builtin_malloc(size);
+
+    GF_ASSERT(ptr != NULL);
+    // Fresh blocks hold garbage, as the game's heap does
+    __builtin_memset(ptr, 0xA5, size);
+    return ptr;
+}
+
+void *AllocFromHeapAtEnd(HeapID heap_id, u32 size) {
+    return AllocFromHeap(heap_id, size);
+}
+
+void FreeToHeap(void *ptr) {
+    GF_ASSERT(ptr != NULL);
+    __builtin_free(ptr);
+}
+
+void MI_CpuCopy8(const void *src, void *dest, u32 size) {
+    __builtin_memcpy(dest, src, size);
+}
+
+void MI_CpuFill8(void *dest, u8 data, u32 size) {
+    __builtin_memset(dest, data, size);
+}
+
+void MIi_CpuClearFast(u32 value, u32 *dst, u32 size) {
+    u32 i;
+
+    for (i = 0; i < size / 4; i++) {
+        dst[i] = value;
+    }
+}
+
+// The owners the host does not build. bag.c and pokedex.c each declare a
+// function static after their header has declared it extern, which gcc will
+// not take, so their sizes are taken here from the same types.
+u32 BagSizeof(void) {
+    return sizeof(Bag);
+}
+
+u32 Save_Pokedex_sizeof(void) {
+    return sizeof(POKEDEX);
+}
+
+// SYSINFO holds a pointer, which is 4 bytes on the ARM and 8 (and 8-aligned)
+// on the host, so sav_system_info.c's sizeof(SYSINFO) would be too big here.
+// On the ARM, unk48 is padded to 4 bytes and the pointer takes 4 more.
+u32 Save_SysInfo_sizeof(void) {
+    return offsetof(SYSINFO, unk48) + 4 + sizeof(u32) + sizeof(((SYSINFO *)NULL)->unk50);
+}
+
+// The owners that are still asm return their size as a constant
+#define HOST_ASM_SIZEOF(func, size)                                         \
+    u32 func(void) {                                                        \
+        return size;                                                        \
+    }
+
+HOST_ASM_SIZEOF(sub_020290B8, 0x20)             // asm/unk_020290B4.s
+HOST_ASM_SIZEOF(Save_DressupData_sizeof, 0x834) // asm/unk_0202B614.s
+HOST_ASM_SIZEOF(sub_0202C034, 0x8C0)            // asm/unk_0202C034.s
+HOST_ASM_SIZEOF(Save_FriendGroup_sizeof, 0x108) // asm/unk_0202C730.s
+HOST_ASM_SIZEOF(sub_0202CA24, 0xFF8)            // asm/unk_0202CA24.s
+HOST_ASM_SIZEOF(GameStats_sizeof, 0x1C0)        // asm/unk_0202CF1C.s
+HOST_ASM_SIZEOF(sub_0202DB40, 0xF8)             // asm/unk_0202DB34.s
+HOST_ASM_SIZEOF(Save_MysteryGift_sizeof, 0x1680) // asm/unk_0202DBA8.s
+HOST_ASM_SIZEOF(sub_0202E41C, 0xBC8)            // asm/unk_0202E41C.s
+HOST_ASM_SIZEOF(sub_0202E4F4, 0xEA0)            // asm/unk_0202E4B0.s
+HOST_ASM_SIZEOF(sub_0202EB30, 0x688)            // asm/unk_0202EB30.s
+HOST_ASM_SIZEOF(Save_FollowPoke_sizeof, 8)      // asm/unk_0202ED18.s
+HOST_ASM_SIZEOF(sub_0202FBCC, 0x1D50)           // asm/unk_0202FBCC.s
+HOST_ASM_SIZEOF(sub_02031000, 0x1628)           // asm/unk_02030A98.s
+HOST_ASM_SIZEOF(sub_020312A4, 0xBA0)            // asm/unk_02030A98.s
+HOST_ASM_SIZEOF(sub_020318C8, 8)                // asm/unk_020318C8.s
+HOST_ASM_SIZEOF(Save_Pokeathlon_sizeof, 0xB80)  // asm/unk_02031904.s
+HOST_ASM_SIZEOF(Save_ApricornBox_sizeof, 0x80)  // asm/unk_02031B0C.s
+
+// Nothing here initialises a save array: the tool only reads what the game
+// wrote. These are the init functions gSaveChunkHeaders and
+// gExtraSaveChunkHeaders point at that the host does not build, and what the
+// ones it does build call into.
+void BagInit(Bag *bag) {
+    GF_ASSERT(FALSE);
+}
+
+void Save_Pokedex_Init(POKEDEX *pokedex) {
+    GF_ASSERT(FALSE);
+}
+
+void Save_SysInfo_Init(SYSINFO *sysInfo) {
+    GF_ASSERT(FALSE);
+}
+
+void Save_MysteryGift_Init(MYSTERY_GIFT_SAVE *mg) {
+    GF_ASSERT(FALSE);
+}
+
+#define HOST_NO_INIT(func)                                                  \
+    void func(void *data) {                                                 \
+        GF_ASSERT(FALSE);                                                   \
+    }
+
+HOST_NO_INIT(sub_020290C8)
+HOST_NO_INIT(Save_DressupData_Init)
+HOST_NO_INIT(sub_0202C03C)
+HOST_NO_INIT(Save_FriendGroup_Init)
+HOST_NO_INIT(sub_0202CA2C)
+HOST_NO_INIT(GameStats_Init)
+HOST_NO_INIT(sub_0202DB44)
+HOST_NO_INIT(sub_0202E424)
+HOST_NO_INIT(sub_0202E4FC)
+HOST_NO_INIT(sub_0202EB38)
+HOST_NO_INIT(Save_FollowPoke_Init)
+HOST_NO_INIT(sub_0202FBD4)
+HOST_NO_INIT(sub_02031008)
+HOST_NO_INIT(sub_020312AC)
+HOST_NO_INIT(sub_020318CC)
+HOST_NO_INIT(Save_Pokeathlon_Init)
+HOST_NO_INIT(Save_ApricornBox_Init)
+
+// The init functions the host does build reach these
+void ApricornTrees_Init(APRICORN_TREE *trees) {
+    GF_ASSERT(FALSE);
+}
+
+void DestroyMsgData(MSGDATA *msgData) {
+    GF_ASSERT(FALSE);
+}
+
+void GF_RTC_CopyDateTime(RTCDate *date, RTCTime *time) {
+    GF_ASSERT(FALSE);
+}
+
+u16 GetMomSpawnId(void) {
+    GF_ASSERT(FALSE);
+    return 0;
+}
+
+void InitCoins(u16 *coins) {
+    GF_ASSERT(FALSE);
+}
+
+void InitIGT(IGT *igt) {
+    GF_ASSERT(FALSE);
+}
+
+void MailMsg_Init(MAIL_MESSAGE *msg) {
+    GF_ASSERT(FALSE);
+}
+
+void MailMsg_Init_WithBank(MAIL_MESSAGE *mailMessage, u16 msgBank) {
+    GF_ASSERT(FALSE);
+}
+
+void MIi_CpuClear16(u16 value, u16 *dst, u32 size) {
+    GF_ASSERT(FALSE);
+}
+
+void MIi_CpuClear32(u32 value, u32 *dst, u32 size) {
+    GF_ASSERT(FALSE);
+}
+
+MSGDATA *NewMsgDataFromNarc(MsgDataLoadType type, NarcId narc, s32 fileId, HeapID heap_id) {
+    GF_ASSERT(FALSE);
+    return NULL;
+}
+
+void Options_Init(OPTIONS *options) {
+    GF_ASSERT(FALSE);
+}
+
+void PlayerSaveData_Init(struct PlayerSaveData *playerSaveData) {
+    GF_ASSERT(FALSE);
+}
+
+void ReadMsgDataIntoU16Array(MSGDATA *msgData, u32 msgno, u16 *dest) {
+    GF_ASSERT(FALSE);
+}
+
+void SavGymmick_Clear(struct Gymmick *gymmick) {
+    GF_ASSERT(FALSE);
+}
+
+u16 *StringFillEOS(u16 *s, u32 n) {
+    GF_ASSERT(FALSE);
+    return s;
+}
+
+void ZeroBoxMonData(BoxPokemon *boxMon) {
+    GF_ASSERT(FALSE);
+}
+
+void ZeroMonData(Pokemon *mon) {
+    GF_ASSERT(FALSE);
+}
@@ -0,0 +1,1311 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stdnoreturn.h>
+#include <stdarg.h>
+#include <stdatomic.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "savetool.h"
+
+// Corruption offsets handed to a fuzz worker at a time
+#define FUZZ_BLOCK 0x1000u
+// Boot check outcomes a fuzz worker keeps, by what the four blocks look like
+#define FUZZ_MEMO_MAX 64
+
+static const char * const sBlockNames[2] = { "main", "boxes" };
+
+static const char * const sLoadStatusNames[SAVE_NUM_LOAD_STATUSES] = {
+    "NOT_EXIST", "IS_GOOD", "SLOT_FAIL", "TOTAL_FAIL",
+};
+
+static const char * const sBlockProblems[] = {
+    [SAVE_BLOCK_OK]         = "ok",
+    [SAVE_BLOCK_NO_FOOTER]  = "no footer",
+    [SAVE_BLOCK_WRONG_SIZE] = "wrong size",
+    [SAVE_BLOCK_WRONG_ID]   = "wrong block id",
+    [SAVE_BLOCK_BAD_CRC]    = "bad CRC",
+};
+
+// Where the game puts everything, worked out once by save.c itself
+static SaveLayoutView sLayout;
+
+// The game's GF_ASSERTs go on after they fail, so the boot check is run to the
+// end and the failures counted, for the thread that ran it
+static _Thread_local int sNumAsserts;
+
+typedef struct Options
+{
+    int numThreads;
+    int verbose;
+} Options;
+
+typedef struct MappedFile
+{
+    const uint8_t * data;
+    size_t size;
+} MappedFile;
+
+// Save_GetSaveFilesStatus's verdict and the GF_ASSERTs it tripped on the way
+typedef struct BootResult
+{
+    SaveBootStatus boot;
+    int asserts;
+} BootResult;
+
+void GF_AssertFail(void)
+{
+    sNumAsserts++;
+}
+
+static inline noreturn __attribute__((format(printf, 1, 2))) void fatal_error(const char * message, ...)
+{
+    va_list va_args;
+    va_start(va_args, message);
+    fputs("Error: ", stderr);
+    vfprintf(stderr, message, va_args);
+    fputc('\n', stderr);
+    va_end(va_args);
+    exit(EXIT_FAILURE);
+}
+
+static uint32_t ParseU32(const char * arg)
+{
+    char * end;
+    unsigned long long val = strtoull(arg, &end, 0);
+    if (*arg == '\0' || *end != '\0' || val > 0xFFFFFFFFull)
+    {
+        fatal_error("invalid number: %s", arg);
+    }
+    return (uint32_t)val;
+}
+
+static double Now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// Returns false and leaves errno set on failure
+static bool MapFile(const char * path, MappedFile * file)
+{
+    struct stat st;
+    int fd = open(path, O_RDONLY);
+    if (fd < 0)
+    {
+        return false;
+    }
+    if (fstat(fd, &st) != 0)
+    {
+        close(fd);
+        return false;
+    }
+    file->size = st.st_size;
+    file->data = NULL;
+    if (file->size != 0)
+    {
+        void * data = mmap(NULL, file->size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data == MAP_FAILED)
+        {
+            close(fd);
+            return false;
+        }
+        file->data = data;
+    }
+    close(fd);
+    return true;
+}
+
+static void UnmapFile(MappedFile * file)
+{
+    if (file->data != NULL)
+    {
+        munmap((void *)file->data, file->size);
+    }
+}
+
+static void MapSaveFile(const char * path, MappedFile * file)
+{
+    if (!MapFile(path, file))
+    {
+        fatal_error("%s: %s", path, strerror(errno));
+    }
+    if (file->size < SAVE_FILE_SIZE)
+    {
+        fatal_error("%s: %zu bytes is too small for a save file", path, file->size);
+    }
+}
+
+// Runs the boot check on the flash the calling thread has attached
+static void GetBootResult(BootResult * result)
+{
+    int before = sNumAsserts;
+
+    SaveTool_GetStatus(&result->boot);
+    result->asserts = sNumAsserts - before;
+}
+
+static bool BootResultsEqual(const BootResult * a, const BootResult * b)
+{
+    return a->boot.status == b->boot.status && a->boot.sector == b->boot.sector
+        && a->boot.count == b->boot.count && a->asserts == b->asserts;
+}
+
+static void CheckBlocks(const uint8_t * file, SaveBlockCheck checks[2][2])
+{
+    for (int sector = 0; sector < 2; sector++)
+    {
+        for (int idx = 0; idx < 2; idx++)
+        {
+            SaveTool_CheckBlock(file + sLayout.sectorOffset[sector], idx, &checks[sector][idx]);
+        }
+    }
+}
+
+// Writes the check report for one file. Returns true if the game would load
+// it cleanly.
+static bool ReportFile(FILE * out, const char * path, const Options * options)
+{
+    MappedFile file;
+    SaveBlockCheck checks[2][2];
+    BootResult result;
+    int extraAsserts;
+    bool good;
+
+    if (!MapFile(path, &file))
+    {
+        fprintf(out, "%s: %s\n", path, strerror(errno));
+        return false;
+    }
+    if (file.size < SAVE_FILE_SIZE)
+    {
+        fprintf(out, "%s: %zu bytes is too small for a save file\n", path, file.size);
+        UnmapFile(&file);
+        return false;
+    }
+
+    Flash_Attach(file.data);
+    CheckBlocks(file.data, checks);
+    GetBootResult(&result);
+
+    fprintf(out, "%s: %s", path, sLoadStatusNames[result.boot.status]);
+    if (result.boot.sector >= 0)
+    {
+        fprintf(out, ", loads sector %d (save %u)", result.boot.sector, result.boot.count);
+    }
+    if (result.asserts != 0)
+    {
+        fprintf(out, ", trips %d GF_ASSERT", result.asserts);
+    }
+    fputc('\n', out);
+
+    for (int sector = 0; sector < 2; sector++)
+    {
+        for (int idx = 0; idx < 2; idx++)
+        {
+            const SaveBlockCheck * check = &checks[sector][idx];
+            if (check->valid)
+            {
+                if (options->verbose)
+                {
+                    fprintf(out, "  sector %d %-5s ok, save %u\n", sector, sBlockNames[idx], check->count);
+                }
+            }
+            else
+            {
+                fprintf(out, "  sector %d %-5s %s\n", sector, sBlockNames[idx], sBlockProblems[check->problem]);
+            }
+        }
+    }
+
+    extraAsserts = sNumAsserts;
+    for (int idx = 0; idx < sLayout.numExtraChunks; idx++)
+    {
+        SaveExtraCheck chunk;
+        SaveTool_CheckExtraChunk(idx, &chunk);
+        if (!chunk.present[0] && !chunk.present[1])
+        {
+            if (options->verbose)
+            {
+                fprintf(out, "  extra %d       empty\n", idx);
+            }
+            continue;
+        }
+        for (int copy = 0; copy < 2; copy++)
+        {
+            if (chunk.valid[copy])
+            {
+                if (options->verbose)
+                {
+                    fprintf(out, "  extra %d/%d     ok, save %u, %u bytes%s\n", idx, copy, chunk.saveno[copy], sLayout.extraSize[idx], chunk.loaded == copy ? ", loaded" : "");
+                }
+            }
+            else
+            {
+                fprintf(out, "  extra %d/%d     %s\n", idx, copy, chunk.present[copy] ? "bad CRC" : "no footer");
+            }
+        }
+    }
+    extraAsserts = sNumAsserts - extraAsserts;
+    if (extraAsserts != 0)
+    {
+        fprintf(out, "  extra chunks trip %d GF_ASSERT\n", extraAsserts);
+    }
+
+    good = result.boot.status == SAVE_LOAD_IS_GOOD && result.asserts == 0 && extraAsserts == 0;
+    Flash_Attach(NULL);
+    UnmapFile(&file);
+    return good;
+}
+
+typedef struct CheckState
+{
+    char ** paths;
+    int numPaths;
+    const Options * options;
+    char ** reports;
+    bool * good;
+    _Atomic int next;
+} CheckState;
+
+static void * CheckWorker(void * arg)
+{
+    CheckState * state = arg;
+    int i;
+
+    while ((i = atomic_fetch_add(&state->next, 1)) < state->numPaths)
+    {
+        size_t size;
+        FILE * out = open_memstream(&state->reports[i], &size);
+        if (out == NULL)
+        {
+            fatal_error("out of memory");
+        }
+        state->good[i] = ReportFile(out, state->paths[i], state->options);
+        fclose(out);
+    }
+    return NULL;
+}
+
+static void RunWorkers(int numThreads, void * (*worker)(void *), void * arg)
+{
+    pthread_t * threads = malloc(numThreads * sizeof(pthread_t));
+    if (threads == NULL)
+    {
+        fatal_error("out of memory");
+    }
+    for (int i = 0; i < numThreads; i++)
+    {
+        if (pthread_create(&threads[i], NULL, worker, arg) != 0)
+        {
+            fatal_error("could not start worker thread");
+        }
+    }
+    for (int i = 0; i < numThreads; i++)
+    {
+        pthread_join(threads[i], NULL);
+    }
+    free(threads);
+}
+
+static int CommandCheck(char ** paths, int numPaths, const Options * options)
+{
+    CheckState state;
+    int numBad = 0;
+    int numThreads = options->numThreads < numPaths ? options->numThreads : numPaths;
+    double start = Now();
+
+    state.paths = paths;
+    state.numPaths = numPaths;
+    state.options = options;
+    state.reports = calloc(numPaths, sizeof(char *));
+    state.good = calloc(numPaths, sizeof(bool));
+    atomic_init(&state.next, 0);
+    if (state.reports == NULL || state.good == NULL)
+    {
+        fatal_error("out of memory");
+    }
+
+    RunWorkers(numThreads, CheckWorker, &state);
+
+    // Reports come out in argument order whichever worker produced them
+    for (int i = 0; i < numPaths; i++)
+    {
+        if (!state.good[i])
+        {
+            numBad++;
+        }
+        if (!state.good[i] || options->verbose || numPaths == 1)
+        {
+            fputs(state.reports[i], stdout);
+        }
+        free(state.reports[i]);
+    }
+    if (numPaths > 1)
+    {
+        fprintf(stderr, "%d of %d files load cleanly (%.2fs)\n", numPaths - numBad, numPaths, Now() - start);
+    }
+    free(state.reports);
+    free(state.good);
+    return numBad == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+// Prints the differing runs of two equally long buffers. Returns the number
+// of differing bytes.
+static uint32_t DiffBytes(const char * name, const uint8_t * a, const uint8_t * b, uint32_t size)
+{
+    uint32_t total = 0;
+    uint32_t i = 0;
+
+    while (i < size)
+    {
+        uint32_t start;
+        if (a[i] == b[i])
+        {
+            i++;
+            continue;
+        }
+        start = i;
+        while (i < size && a[i] != b[i])
+        {
+            i++;
+        }
+        printf("%-8s 0x%05X-0x%05X %6u bytes\n", name, start, i - 1, i - start);
+        total += i - start;
+    }
+    return total;
+}
+
+static int CommandDiff(const char * pathA, const char * pathB)
+{
+    MappedFile files[2];
+    SaveBootStatus status[2];
+    const char * paths[2] = { pathA, pathB };
+    uint32_t total = 0;
+
+    for (int i = 0; i < 2; i++)
+    {
+        MapSaveFile(paths[i], &files[i]);
+        Flash_Attach(files[i].data);
+        SaveTool_GetStatus(&status[i]);
+        if (status[i].sector < 0)
+        {
+            fatal_error("%s: %s, nothing to compare", paths[i], sLoadStatusNames[status[i].status]);
+        }
+        printf("%s: sector %d, save %u\n", paths[i], status[i].sector, status[i].count);
+    }
+
+    // Compare what the game would load from each, footers excluded
+    for (int idx = 0; idx < 2; idx++)
+    {
+        const uint8_t * blocks[2];
+        for (int i = 0; i < 2; i++)
+        {
+            blocks[i] = files[i].data + sLayout.sectorOffset[status[i].sector] + sLayout.blockOffset[idx];
+        }
+        total += DiffBytes(sBlockNames[idx], blocks[0], blocks[1], sLayout.blockSize[idx] - sLayout.footerSize);
+    }
+    for (int idx = 0; idx < sLayout.numExtraChunks; idx++)
+    {
+        SaveExtraCheck chunks[2];
+        char name[24];
+        for (int i = 0; i < 2; i++)
+        {
+            Flash_Attach(files[i].data);
+            SaveTool_CheckExtraChunk(idx, &chunks[i]);
+        }
+        snprintf(name, sizeof(name), "extra %d", idx);
+        if (chunks[0].loaded < 0 || chunks[1].loaded < 0)
+        {
+            if ((chunks[0].loaded < 0) != (chunks[1].loaded < 0))
+            {
+                printf("%-8s only valid in %s\n", name, chunks[0].loaded >= 0 ? pathA : pathB);
+                total++;
+            }
+            continue;
+        }
+        total += DiffBytes(name,
+            files[0].data + sLayout.extraOffset[idx][chunks[0].loaded],
+            files[1].data + sLayout.extraOffset[idx][chunks[1].loaded],
+            sLayout.extraSize[idx]);
+    }
+
+    printf("%u bytes differ\n", total);
+    Flash_Attach(NULL);
+    UnmapFile(&files[0]);
+    UnmapFile(&files[1]);
+    return total == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+static int CommandRepair(const char * inPath, const char * outPath, bool recrc, bool mirror)
+{
+    MappedFile in;
+    uint8_t * file;
+    SaveBlockCheck checks[2][2];
+    SaveBootStatus status;
+    FILE * out;
+
+    MapSaveFile(inPath, &in);
+    file = malloc(in.size);
+    if (file == NULL)
+    {
+        fatal_error("out of memory");
+    }
+    memcpy(file, in.data, in.size);
+    Flash_Attach(file);
+
+    if (recrc)
+    {
+        // Blocks whose footer is intact but whose CRC no longer matches,
+        // which is what hand edits leave behind. The footer is rebuilt as the
+        // game builds it, keeping the save count it had.
+        CheckBlocks(file, checks);
+        for (int sector = 0; sector < 2; sector++)
+        {
+            for (int idx = 0; idx < 2; idx++)
+            {
+                if (checks[sector][idx].problem == SAVE_BLOCK_BAD_CRC)
+                {
+                    SaveTool_BuildFooter(file + sLayout.sectorOffset[sector], idx, checks[sector][idx].footerCount);
+                    printf("sector %d %-5s CRC recomputed\n", sector, sBlockNames[idx]);
+                }
+            }
+        }
+        for (int idx = 0; idx < sLayout.numExtraChunks; idx++)
+        {
+            SaveExtraCheck chunk;
+            SaveTool_CheckExtraChunk(idx, &chunk);
+            for (int copy = 0; copy < 2; copy++)
+            {
+                if (chunk.present[copy] && !chunk.valid[copy])
+                {
+                    SaveTool_BuildChunkFooter(file + sLayout.extraOffset[idx][copy], idx, chunk.saveno[copy]);
+                    printf("extra %d/%d     CRC recomputed\n", idx, copy);
+                }
+            }
+        }
+    }
+
+    SaveTool_GetStatus(&status);
+    if (status.sector < 0)
+    {
+        fatal_error("%s: %s, nothing to repair from", inPath, sLoadStatusNames[status.status]);
+    }
+
+    if (mirror)
+    {
+        int other = status.sector ^ 1;
+        CheckBlocks(file, checks);
+        if (!checks[other][0].valid || !checks[other][1].valid || checks[other][0].count != checks[other][1].count)
+        {
+            // Rebuild the other sector as the save before this one, so the
+            // game still prefers the sector it loads now
+            uint8_t * dest = file + sLayout.sectorOffset[other];
+            memcpy(dest, file + sLayout.sectorOffset[status.sector], sLayout.regionSize);
+            for (int idx = 0; idx < 2; idx++)
+            {
+                SaveTool_BuildFooter(dest, idx, status.count - 1);
+            }
+            printf("sector %d rebuilt from sector %d\n", other, status.sector);
+        }
+        for (int idx = 0; idx < sLayout.numExtraChunks; idx++)
+        {
+            SaveExtraCheck chunk;
+            SaveTool_CheckExtraChunk(idx, &chunk);
+            if (chunk.loaded >= 0 && !chunk.valid[chunk.loaded ^ 1])
+            {
+                memcpy(file + sLayout.extraOffset[idx][chunk.loaded ^ 1],
+                    file + sLayout.extraOffset[idx][chunk.loaded],
+                    sLayout.extraSize[idx] + sLayout.extraFooterSize);
+                printf("extra %d/%d     rebuilt from copy %d\n", idx, chunk.loaded ^ 1, chunk.loaded);
+            }
+        }
+    }
+
+    out = fopen(outPath, "wb");
+    if (out == NULL || fwrite(file, 1, in.size, out) != in.size || fclose(out) != 0)
+    {
+        fatal_error("%s: could not write", outPath);
+    }
+    SaveTool_GetStatus(&status);
+    printf("%s: %s, loads sector %d (save %u)\n", outPath, sLoadStatusNames[status.status], status.sector, status.count);
+
+    Flash_Attach(NULL);
+    free(file);
+    UnmapFile(&in);
+    return status.status == SAVE_LOAD_IS_GOOD ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+// Where a corrupted byte lands
+enum
+{
+    REGION_OUTSIDE,
+    REGION_MAIN_DATA,
+    REGION_MAIN_FOOTER,
+    REGION_BOXES_DATA,
+    REGION_BOXES_FOOTER,
+    NUM_REGIONS
+};
+
+static const char * const sRegionNames[NUM_REGIONS] = {
+    "padding", "main", "main footer", "boxes", "boxes footer",
+};
+
+typedef struct FuzzTally
+{
+    uint64_t results[NUM_REGIONS][SAVE_NUM_LOAD_STATUSES];
+    uint64_t rolledBack[NUM_REGIONS];
+    uint64_t violations[NUM_REGIONS];
+} FuzzTally;
+
+typedef struct FuzzReport
+{
+    uint32_t offset;
+    uint8_t xor;
+    const char * what;
+    BootResult result;
+} FuzzReport;
+
+typedef struct FuzzState
+{
+    const uint8_t * file;
+    SaveBlockCheck checks[2][2];
+    BootResult baseline;
+    bool redundant;           // both sectors load on their own
+    uint32_t begin;
+    uint32_t end;
+    uint8_t xor;              // 0: derive from seed
+    uint32_t seed;
+    uint32_t checkEvery;
+    _Atomic uint32_t nextBlock;
+    pthread_mutex_t lock;
+    FuzzTally tally;
+    FuzzReport * reports;
+    int numReports;
+    int maxReports;
+    uint64_t numViolations;
+} FuzzState;
+
+// The boot check only looks at whether each block validates and its save
+// count, so a worker remembers its outcome for each combination it has seen
+typedef struct FuzzMemo
+{
+    int valid[2][2];
+    uint32_t count[2][2];
+    BootResult result;
+} FuzzMemo;
+
+typedef struct FuzzWorkerState
+{
+    uint8_t * image;
+    FuzzMemo memo[FUZZ_MEMO_MAX];
+    int numMemos;
+    int nextMemo;
+} FuzzWorkerState;
+
+static uint8_t FuzzXor(const FuzzState * state, uint32_t offset)
+{
+    uint32_t h;
+
+    if (state->xor != 0)
+    {
+        return state->xor;
+    }
+    h = (offset ^ state->seed) * 0x9E3779B1u;
+    h ^= h >> 15;
+    h *= 0x85EBCA77u;
+    h ^= h >> 13;
+    return (uint8_t)(h % 255 + 1);
+}
+
+// Which sector and block an offset falls in, or REGION_OUTSIDE. Sets *sector
+// to -1 outside the two sector regions the boot check reads.
+static int FuzzRegion(uint32_t offset, int * sector, int * idx)
+{
+    *sector = -1;
+    *idx = -1;
+    for (int s = 0; s < 2; s++)
+    {
+        if (offset >= sLayout.sectorOffset[s] && offset - sLayout.sectorOffset[s] < sLayout.regionSize)
+        {
+            uint32_t rel = offset - sLayout.sectorOffset[s];
+            *sector = s;
+            for (int i = 0; i < 2; i++)
+            {
+                if (rel >= sLayout.blockOffset[i] && rel - sLayout.blockOffset[i] < sLayout.blockSize[i])
+                {
+                    bool footer = rel - sLayout.blockOffset[i] >= sLayout.blockSize[i] - sLayout.footerSize;
+                    *idx = i;
+                    return i == 0 ? (footer ? REGION_MAIN_FOOTER : REGION_MAIN_DATA) : (footer ? REGION_BOXES_FOOTER : REGION_BOXES_DATA);
+                }
+            }
+        }
+    }
+    return REGION_OUTSIDE;
+}
+
+// Save_GetSaveFilesStatus on the worker's image as it is, from memory if the
+// blocks look like they did for an earlier corruption
+static void FuzzBootResult(FuzzWorkerState * worker, const SaveBlockCheck checks[2][2], BootResult * result)
+{
+    FuzzMemo * memo;
+
+    for (int i = 0; i < worker->numMemos; i++)
+    {
+        bool same = true;
+        memo = &worker->memo[i];
+        for (int sector = 0; sector < 2 && same; sector++)
+        {
+            for (int idx = 0; idx < 2 && same; idx++)
+            {
+                same = memo->valid[sector][idx] == checks[sector][idx].valid && memo->count[sector][idx] == checks[sector][idx].count;
+            }
+        }
+        if (same)
+        {
+            *result = memo->result;
+            return;
+        }
+    }
+
+    GetBootResult(result);
+    memo = &worker->memo[worker->nextMemo];
+    worker->nextMemo = (worker->nextMemo + 1) % FUZZ_MEMO_MAX;
+    if (worker->numMemos < FUZZ_MEMO_MAX)
+    {
+        worker->numMemos++;
+    }
+    for (int sector = 0; sector < 2; sector++)
+    {
+        for (int idx = 0; idx < 2; idx++)
+        {
+            memo->valid[sector][idx] = checks[sector][idx].valid;
+            memo->count[sector][idx] = checks[sector][idx].count;
+        }
+    }
+    memo->result = *result;
+}
+
+// Redoes a corruption without the remembered CRCs or outcomes
+static void FuzzCrossCheck(const FuzzWorkerState * worker, uint32_t offset, const SaveBlockCheck checks[2][2], const BootResult * result)
+{
+    SaveBlockCheck full[2][2];
+    BootResult fullResult;
+
+    Crc_SetMode(CRC_PLAIN);
+    CheckBlocks(worker->image, full);
+    GetBootResult(&fullResult);
+    Crc_SetMode(CRC_RECALL);
+    for (int sector = 0; sector < 2; sector++)
+    {
+        for (int idx = 0; idx < 2; idx++)
+        {
+            if (full[sector][idx].valid != checks[sector][idx].valid || full[sector][idx].count != checks[sector][idx].count)
+            {
+                fatal_error("fast path disagrees with a full check at 0x%05X", offset);
+            }
+        }
+    }
+    if (!BootResultsEqual(&fullResult, result))
+    {
+        fatal_error("remembered boot check disagrees with a full one at 0x%05X", offset);
+    }
+}
+
+static void FuzzRecord(FuzzState * state, uint32_t offset, uint8_t xor, const char * what, const BootResult * result)
+{
+    pthread_mutex_lock(&state->lock);
+    state->numViolations++;
+    if (state->numReports < state->maxReports)
+    {
+        FuzzReport * report = &state->reports[state->numReports++];
+        report->offset = offset;
+        report->xor = xor;
+        report->what = what;
+        report->result = *result;
+    }
+    pthread_mutex_unlock(&state->lock);
+}
+
+// Each worker corrupts its own copy of the file a byte at a time. Only the
+// block holding the byte is checked again, and its CRC comes from the one
+// worked out before any corruption, moved by the corrupted byte.
+static void * FuzzWorker(void * arg)
+{
+    FuzzState * state = arg;
+    FuzzWorkerState * worker = calloc(1, sizeof(FuzzWorkerState));
+    SaveBlockCheck base[2][2];
+    FuzzTally tally;
+    uint32_t block;
+
+    if (worker == NULL || (worker->image = malloc(SAVE_FILE_SIZE)) == NULL)
+    {
+        fatal_error("out of memory");
+    }
+    memcpy(worker->image, state->file, SAVE_FILE_SIZE);
+    memset(&tally, 0, sizeof(tally));
+    Flash_Attach(worker->image);
+    Crc_SetMode(CRC_RECORD);
+    CheckBlocks(worker->image, base);
+    Crc_SetMode(CRC_RECALL);
+
+    while ((block = atomic_fetch_add(&state->nextBlock, 1)) < (state->end - state->begin + FUZZ_BLOCK - 1) / FUZZ_BLOCK)
+    {
+        uint32_t first = state->begin + block * FUZZ_BLOCK;
+        uint32_t last = first + FUZZ_BLOCK < state->end ? first + FUZZ_BLOCK : state->end;
+        for (uint32_t offset = first; offset < last; offset++)
+        {
+            SaveBlockCheck checks[2][2];
+            BootResult result;
+            const SaveBootStatus * status = &result.boot;
+            uint8_t xor;
+            int region;
+            int sector;
+            int idx;
+            const char * violation = NULL;
+
+            // Only the two sector regions feed Save_GetSaveFilesStatus
+            region = FuzzRegion(offset, &sector, &idx);
+            if (sector < 0)
+            {
+                continue;
+            }
+            xor = FuzzXor(state, offset);
+            memcpy(checks, base, sizeof(checks));
+            worker->image[offset] ^= xor;
+            Crc_SetFlip(&worker->image[offset], xor);
+            if (idx >= 0)
+            {
+                SaveTool_CheckBlock(worker->image + sLayout.sectorOffset[sector], idx, &checks[sector][idx]);
+            }
+            FuzzBootResult(worker, checks, &result);
+            if (state->checkEvery != 0 && offset % state->checkEvery == 0)
+            {
+                FuzzCrossCheck(worker, offset, checks, &result);
+            }
+            Crc_SetFlip(NULL, 0);
+            worker->image[offset] ^= xor;
+
+            tally.results[region][status->status]++;
+            if (status->sector >= 0 && state->baseline.boot.sector >= 0 && SaveTool_CompareCount(status->count, state->baseline.boot.count) < 0)
+            {
+                tally.rolledBack[region]++;
+            }
+
+            if (result.asserts != 0)
+            {
+                violation = "trips a GF_ASSERT";
+            }
+            else if (region == REGION_OUTSIDE && !BootResultsEqual(&result, &state->baseline))
+            {
+                violation = "padding byte changed the outcome";
+            }
+            else if ((region == REGION_MAIN_DATA || region == REGION_BOXES_DATA) && checks[sector][idx].valid)
+            {
+                violation = "corrupted block still validates";
+            }
+            else if (status->sector >= 0 && (!checks[status->sector][0].valid || !checks[status->sector][1].valid))
+            {
+                violation = "loads a sector with a bad block";
+            }
+            else if (state->redundant && status->sector < 0)
+            {
+                violation = "one bad byte lost both copies";
+            }
+            if (violation != NULL)
+            {
+                tally.violations[region]++;
+                FuzzRecord(state, offset, xor, violation, &result);
+            }
+        }
+    }
+
+    pthread_mutex_lock(&state->lock);
+    for (int i = 0; i < NUM_REGIONS; i++)
+    {
+        for (int j = 0; j < SAVE_NUM_LOAD_STATUSES; j++)
+        {
+            state->tally.results[i][j] += tally.results[i][j];
+        }
+        state->tally.rolledBack[i] += tally.rolledBack[i];
+        state->tally.violations[i] += tally.violations[i];
+    }
+    pthread_mutex_unlock(&state->lock);
+    Crc_Forget();
+    Flash_Attach(NULL);
+    free(worker->image);
+    free(worker);
+    return NULL;
+}
+
+// Works out the baseline for state->file and corrupts every offset in
+// [begin, end) across numThreads workers
+static void FuzzRun(FuzzState * state, int numThreads)
+{
+    Flash_Attach(state->file);
+    CheckBlocks(state->file, state->checks);
+    GetBootResult(&state->baseline);
+    Flash_Attach(NULL);
+    state->redundant = true;
+    for (int sector = 0; sector < 2; sector++)
+    {
+        state->redundant = state->redundant && state->checks[sector][0].valid && state->checks[sector][1].valid
+            && state->checks[sector][0].count == state->checks[sector][1].count;
+    }
+    atomic_init(&state->nextBlock, 0);
+    pthread_mutex_init(&state->lock, NULL);
+    RunWorkers(numThreads, FuzzWorker, state);
+    pthread_mutex_destroy(&state->lock);
+}
+
+static int CompareReports(const void * a, const void * b)
+{
+    const FuzzReport * ra = a;
+    const FuzzReport * rb = b;
+    return (ra->offset > rb->offset) - (ra->offset < rb->offset);
+}
+
+static int CommandFuzz(const char * path, uint32_t begin, uint32_t end, uint8_t xor, uint32_t seed, uint32_t checkEvery, int maxReports, const Options * options)
+{
+    MappedFile file;
+    FuzzState state;
+    uint64_t numOffsets;
+    double start, elapsed;
+
+    MapSaveFile(path, &file);
+    memset(&state, 0, sizeof(state));
+    state.file = file.data;
+    state.begin = begin;
+    state.end = end < SAVE_FILE_SIZE ? end : SAVE_FILE_SIZE;
+    state.xor = xor;
+    state.seed = seed;
+    state.checkEvery = checkEvery;
+    state.maxReports = maxReports;
+    state.reports = calloc(maxReports > 0 ? maxReports : 1, sizeof(FuzzReport));
+    if (state.reports == NULL)
+    {
+        fatal_error("out of memory");
+    }
+
+    start = Now();
+    FuzzRun(&state, options->numThreads);
+    elapsed = Now() - start;
+
+    printf("%s: baseline %s", path, sLoadStatusNames[state.baseline.boot.status]);
+    if (state.baseline.boot.sector >= 0)
+    {
+        printf(", sector %d (save %u)", state.baseline.boot.sector, state.baseline.boot.count);
+    }
+    printf("%s\n", state.redundant ? ", both sectors intact" : "");
+
+    numOffsets = 0;
+    printf("%-13s %10s %10s %10s %10s %10s %10s\n", "corrupted", "NOT_EXIST", "IS_GOOD", "SLOT_FAIL", "TOTAL_FAIL", "rollback", "violation");
+    for (int i = 0; i < NUM_REGIONS; i++)
+    {
+        printf("%-13s", sRegionNames[i]);
+        for (int j = 0; j < SAVE_NUM_LOAD_STATUSES; j++)
+        {
+            printf(" %10llu", (unsigned long long)state.tally.results[i][j]);
+            numOffsets += state.tally.results[i][j];
+        }
+        printf(" %10llu %10llu\n", (unsigned long long)state.tally.rolledBack[i], (unsigned long long)state.tally.violations[i]);
+    }
+
+    qsort(state.reports, state.numReports, sizeof(FuzzReport), CompareReports);
+    for (int i = 0; i < state.numReports; i++)
+    {
+        const FuzzReport * report = &state.reports[i];
+        printf("0x%05X ^ 0x%02X: %s (%s, sector %d)\n", report->offset, report->xor, report->what, sLoadStatusNames[report->result.boot.status], report->result.boot.sector);
+    }
+    if (state.numViolations > (uint64_t)state.numReports)
+    {
+        printf("... %llu more\n", (unsigned long long)(state.numViolations - state.numReports));
+    }
+    fprintf(stderr, "%llu offsets in %.3fs (%.0f/s)\n", (unsigned long long)numOffsets, elapsed, numOffsets / elapsed);
+
+    free(state.reports);
+    UnmapFile(&file);
+    return state.numViolations == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+// Fills a file with noise and gives both sectors and every extra chunk a
+// valid footer, sector 0 holding save 5 and sector 1 save 4
+static void SelfTest_MakeSave(uint8_t * file)
+{
+    uint32_t x = 7;
+
+    for (uint32_t i = 0; i < SAVE_FILE_SIZE; i++)
+    {
+        x = x * 1103515245u + 24691u;
+        file[i] = (uint8_t)(x >> 16);
+    }
+    for (int sector = 0; sector < 2; sector++)
+    {
+        for (int idx = 0; idx < 2; idx++)
+        {
+            SaveTool_BuildFooter(file + sLayout.sectorOffset[sector], idx, 5 - sector);
+        }
+    }
+    for (int idx = 0; idx < sLayout.numExtraChunks; idx++)
+    {
+        for (int copy = 0; copy < 2; copy++)
+        {
+            SaveTool_BuildChunkFooter(file + sLayout.extraOffset[idx][copy], idx, 3 - copy);
+        }
+    }
+}
+
+static int SelfTest_ExpectStatus(const char * what, int status, int sector, uint32_t count)
+{
+    BootResult result;
+
+    GetBootResult(&result);
+    if (result.boot.status != status || result.boot.sector != sector || result.boot.count != count || result.asserts != 0)
+    {
+        printf("%s: %s, sector %d (save %u), %d GF_ASSERT; expected %s, sector %d (save %u)\n", what,
+            sLoadStatusNames[result.boot.status], result.boot.sector, result.boot.count, result.asserts,
+            sLoadStatusNames[status], sector, count);
+        return 1;
+    }
+    return 0;
+}
+
+static int SelfTest(void)
+{
+    static uint8_t buf[0x12000];
+    uint8_t * file;
+    FuzzState state;
+    uint32_t x = 1;
+    uint64_t numOffsets;
+    int failures = 0;
+
+    // The sizes SaveData_InitSlotSpecs comes to with the host's stand-ins
+    // for the owners it does not build, against the retail footers
+    if (sLayout.blockSize[0] != 0xF628 || sLayout.blockSize[1] != 0x12310)
+    {
+        printf("block sizes 0x%X and 0x%X, expected 0xF628 and 0x12310\n", sLayout.blockSize[0], sLayout.blockSize[1]);
+        failures++;
+    }
+
+    for (size_t i = 0; i < sizeof(buf); i++)
+    {
+        x = x * 1103515245u + 24691u;
+        buf[i] = (uint8_t)(x >> 16);
+    }
+    for (size_t size = 0; size < sizeof(buf); size = size * 2 + 3)
+    {
+        // Plain byte at a time, as MATHi_CRC16Update does it
+        uint16_t slow = 0xFFFF;
+        for (size_t i = 0; i < size; i++)
+        {
+            uint16_t r = (uint16_t)(((slow >> 8) ^ buf[i]) << 8);
+            for (int j = 0; j < 8; j++)
+            {
+                r = (r & 0x8000) ? (uint16_t)((r << 1) ^ 0x1021) : (uint16_t)(r << 1);
+            }
+            slow = (uint16_t)((slow << 8) ^ r);
+        }
+        if (SaveTool_CalcCRC16(buf, size) != slow)
+        {
+            printf("CRC of %zu bytes: %04X, expected %04X\n", size, SaveTool_CalcCRC16(buf, size), slow);
+            failures++;
+        }
+    }
+    // The fuzzer's shortcut: a remembered CRC moved by one flipped byte
+    Crc_SetMode(CRC_RECORD);
+    SaveTool_CalcCRC16(buf, 0x1000);
+    for (uint32_t pos = 0; pos < 0x1000; pos += 97)
+    {
+        uint16_t recalled;
+        buf[pos] ^= 0x5A;
+        Crc_SetMode(CRC_RECALL);
+        Crc_SetFlip(&buf[pos], 0x5A);
+        recalled = SaveTool_CalcCRC16(buf, 0x1000);
+        Crc_SetMode(CRC_PLAIN);
+        if (recalled != SaveTool_CalcCRC16(buf, 0x1000))
+        {
+            printf("CRC delta at %u is wrong\n", pos);
+            failures++;
+        }
+        buf[pos] ^= 0x5A;
+    }
+    Crc_Forget();
+
+    // The boot check and the extra chunks on a file whose footers save.c built
+    file = malloc(SAVE_FILE_SIZE);
+    if (file == NULL)
+    {
+        fatal_error("out of memory");
+    }
+    SelfTest_MakeSave(file);
+    Flash_Attach(file);
+    failures += SelfTest_ExpectStatus("synthetic save", SAVE_LOAD_IS_GOOD, 0, 5);
+    for (int idx = 0; idx < sLayout.numExtraChunks; idx++)
+    {
+        SaveExtraCheck chunk;
+        SaveTool_CheckExtraChunk(idx, &chunk);
+        if (!chunk.valid[0] || !chunk.valid[1] || chunk.loaded != 0 || chunk.saveno[0] != 3)
+        {
+            printf("extra chunk %d: valid %d/%d, loaded %d, save %u\n", idx, chunk.valid[0], chunk.valid[1], chunk.loaded, chunk.saveno[0]);
+            failures++;
+        }
+    }
+    file[sLayout.sectorOffset[0] + sLayout.blockOffset[1] + 0x100] ^= 1;
+    failures += SelfTest_ExpectStatus("sector 0 boxes corrupted", SAVE_LOAD_SLOT_FAIL, 1, 4);
+    SaveTool_BuildFooter(file + sLayout.sectorOffset[0], 1, 5);
+    failures += SelfTest_ExpectStatus("sector 0 boxes footer rebuilt", SAVE_LOAD_IS_GOOD, 0, 5);
+    Flash_Attach(NULL);
+
+    // Every byte of the main footer and the start of the boxes, each redone
+    // the slow way
+    memset(&state, 0, sizeof(state));
+    state.file = file;
+    state.begin = sLayout.blockOffset[0] + sLayout.blockSize[0] - sLayout.footerSize - 0x40;
+    state.end = sLayout.blockOffset[1] + 0x40;
+    state.xor = 0xFF;
+    state.checkEvery = 1;
+    state.reports = calloc(1, sizeof(FuzzReport));
+    if (state.reports == NULL)
+    {
+        fatal_error("out of memory");
+    }
+    FuzzRun(&state, 2);
+    numOffsets = 0;
+    for (int i = 0; i < NUM_REGIONS; i++)
+    {
+        for (int j = 0; j < SAVE_NUM_LOAD_STATUSES; j++)
+        {
+            numOffsets += state.tally.results[i][j];
+        }
+    }
+    if (numOffsets != state.end - state.begin || state.numViolations != 0)
+    {
+        printf("fuzz: %llu offsets, %llu violations\n", (unsigned long long)numOffsets, (unsigned long long)state.numViolations);
+        failures++;
+    }
+    free(state.reports);
+    free(file);
+
+    printf(failures == 0 ? "ok\n" : "%d failures\n", failures);
+    return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+static noreturn void Usage(const char * prog)
+{
+    fprintf(stderr,
+        "Usage:\n"
+        "  %s check [options] FILE...    run the boot-time save checks on each file\n"
+        "  %s diff [options] A B         compare the data the game would load from two files\n"
+        "  %s repair [options] IN OUT    fix what can be fixed and write the result\n"
+        "  %s fuzz [options] FILE...     corrupt every byte in turn and rerun the boot check\n"
+        "  %s selftest                   check the layout, the CRC fast paths and the checks on a made-up save\n"
+        "\n"
+        "The block layout is the one src/save.c builds; there is nothing to set.\n"
+        "\n"
+        "common options:\n"
+        "  --threads N           worker threads (default: all cores)\n"
+        "check options:\n"
+        "  -v                    list every block, not just the bad ones\n"
+        "repair options (default: both):\n"
+        "  --recrc               recompute CRCs of blocks whose footer is otherwise intact\n"
+        "  --mirror              rebuild a bad sector or chunk copy from the good one\n"
+        "fuzz options:\n"
+        "  --range A-B           file offsets to corrupt (default: the whole file)\n"
+        "  --xor N               value to XOR into each byte (default 0xFF)\n"
+        "  --seed N              XOR a pseudo-random nonzero value derived from N instead\n"
+        "  --check-every N       redo every Nth corruption the slow way (default 1021, 0: never)\n"
+        "  --max-reports N       violations to list (default 50)\n"
+        "\n"
+        "check exits with 1 if any file does not load as IS_GOOD. fuzz exits with 1 on\n"
+        "any violation: a GF_ASSERT, an undetected corruption, a sector loaded with a bad\n"
+        "block, or a single byte taking out both copies of an intact save.\n",
+        prog, prog, prog, prog, prog);
+    exit(EXIT_FAILURE);
+}
+
+static void ParseRange(const char * arg, uint32_t * lo, uint32_t * hi)
+{
+    char buf[64];
+    char * dash;
+
+    if (strlen(arg) >= sizeof(buf))
+    {
+        fatal_error("invalid range: %s", arg);
+    }
+    strcpy(buf, arg);
+    dash = strchr(buf + 1, '-');
+    if (dash == NULL)
+    {
+        fatal_error("invalid range: %s", arg);
+    }
+    *dash = '\0';
+    *lo = ParseU32(buf);
+    *hi = ParseU32(dash + 1);
+    if (*lo > *hi)
+    {
+        fatal_error("invalid range: %s", arg);
+    }
+}
+
+int main(int argc, char ** argv)
+{
+    Options options;
+    long nproc = sysconf(_SC_NPROCESSORS_ONLN);
+    char ** args;
+    int numArgs = 0;
+    bool recrc = false;
+    bool mirror = false;
+    uint32_t begin = 0;
+    uint32_t end = SAVE_FILE_SIZE;
+    uint8_t xor = 0xFF;
+    uint32_t seed = 0;
+    uint32_t checkEvery = 1021;
+    int maxReports = 50;
+    int status;
+
+    if (argc < 2)
+    {
+        Usage(argv[0]);
+    }
+    SaveTool_Init();
+    SaveTool_GetLayout(&sLayout);
+    if (strcmp(argv[1], "selftest") == 0)
+    {
+        return SelfTest();
+    }
+
+    memset(&options, 0, sizeof(options));
+    options.numThreads = nproc > 0 ? (int)nproc : 1;
+    args = malloc(argc * sizeof(char *));
+    if (args == NULL)
+    {
+        fatal_error("out of memory");
+    }
+    for (int i = 2; i < argc; i++)
+    {
+        const char * opt = argv[i];
+        if (opt[0] != '-')
+        {
+            args[numArgs++] = argv[i];
+            continue;
+        }
+        if (strcmp(opt, "-v") == 0)
+        {
+            options.verbose = 1;
+            continue;
+        }
+        if (strcmp(opt, "--recrc") == 0)
+        {
+            recrc = true;
+            continue;
+        }
+        if (strcmp(opt, "--mirror") == 0)
+        {
+            mirror = true;
+            continue;
+        }
+        if (i + 1 >= argc)
+        {
+            Usage(argv[0]);
+        }
+        const char * val = argv[++i];
+        if (strcmp(opt, "--threads") == 0)
+        {
+            options.numThreads = ParseU32(val);
+            if (options.numThreads < 1)
+            {
+                fatal_error("need at least one thread");
+            }
+        }
+        else if (strcmp(opt, "--range") == 0)
+        {
+            ParseRange(val, &begin, &end);
+            end++;
+        }
+        else if (strcmp(opt, "--xor") == 0)
+        {
+            uint32_t val32 = ParseU32(val);
+            if (val32 == 0 || val32 > 0xFF)
+            {
+                fatal_error("--xor must be 1-255");
+            }
+            xor = (uint8_t)val32;
+        }
+        else if (strcmp(opt, "--seed") == 0)
+        {
+            seed = ParseU32(val);
+            xor = 0;
+        }
+        else if (strcmp(opt, "--check-every") == 0)
+        {
+            checkEvery = ParseU32(val);
+        }
+        else if (strcmp(opt, "--max-reports") == 0)
+        {
+            maxReports = ParseU32(val);
+        }
+        else
+        {
+            Usage(argv[0]);
+        }
+    }
+
+    if (strcmp(argv[1], "check") == 0)
+    {
+        if (numArgs < 1)
+        {
+            Usage(argv[0]);
+        }
+        status = CommandCheck(args, numArgs, &options);
+    }
+    else if (strcmp(argv[1], "diff") == 0)
+    {
+        if (numArgs != 2)
+        {
+            Usage(argv[0]);
+        }
+        status = CommandDiff(args[0], args[1]);
+    }
+    else if (strcmp(argv[1], "repair") == 0)
+    {
+        if (numArgs != 2)
+        {
+            Usage(argv[0]);
+        }
+        if (!recrc && !mirror)
+        {
+            recrc = mirror = true;
+        }
+        status = CommandRepair(args[0], args[1], recrc, mirror);
+    }
+    else if (strcmp(argv[1], "fuzz") == 0)
+    {
+        if (numArgs < 1)
+        {
+            Usage(argv[0]);
+        }
+        status = EXIT_SUCCESS;
+        for (int i = 0; i < numArgs; i++)
+        {
+            if (CommandFuzz(args[i], begin, end, xor, seed, checkEvery, maxReports, &options) != EXIT_SUCCESS)
+            {
+                status = EXIT_FAILURE;
+            }
+        }
+    }
+    else
+    {
+        Usage(argv[0]);
+    }
+
+    free(args);
+    return status;
+}
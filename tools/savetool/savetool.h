@@ -0,0 +1,113 @@
+#ifndef GUARD_SAVETOOL_SAVETOOL_H
+#define GUARD_SAVETOOL_SAVETOOL_H
+
+// The boundary between the host side (main.c) and the objects built from the
+// game's sources (game.c, hostsave.c, src/save.c, src/save_arrays.c and the
+// save array owners). Plain C types only, so that both sides can include it
+// with their own headers.
+
+#include <stdint.h>
+
+#define SAVE_FILE_SIZE          0x80000     // CARD_BACKUP_TYPE_FLASH_4MBITS
+#define SAVE_MAX_EXTRA_CHUNKS   8           // room for gNumExtraSaveChunkHeaders
+
+// LOAD_STATUS_* from include/save.h
+enum
+{
+    SAVE_LOAD_NOT_EXIST,
+    SAVE_LOAD_IS_GOOD,
+    SAVE_LOAD_SLOT_FAIL,
+    SAVE_LOAD_TOTAL_FAIL,
+    SAVE_NUM_LOAD_STATUSES,
+};
+
+// Why ValidateSaveSectorFooter turns a block down
+enum
+{
+    SAVE_BLOCK_OK,
+    SAVE_BLOCK_NO_FOOTER,       // the magic is wrong, so there is no footer to speak of
+    SAVE_BLOCK_WRONG_SIZE,
+    SAVE_BLOCK_WRONG_ID,
+    SAVE_BLOCK_BAD_CRC,
+};
+
+// Where SaveData_InitSubstructs and SaveData_InitSlotSpecs put the two blocks
+// and where gExtraSaveChunkHeaders puts the extra chunks
+typedef struct SaveLayoutView
+{
+    uint32_t regionSize;        // what Save_GetSaveFilesStatus reads per sector
+    uint32_t sectorOffset[2];   // GetChunkOffsetFromCurrentSaveSlot
+    uint32_t blockOffset[2];    // saveSlotSpecs, within a sector
+    uint32_t blockSize[2];      // including the footer
+    uint32_t footerSize;        // struct SaveChunkFooter
+    int numExtraChunks;
+    uint32_t extraOffset[SAVE_MAX_EXTRA_CHUNKS][2]; // each copy, in the flash
+    uint32_t extraSize[SAVE_MAX_EXTRA_CHUNKS];      // sizeFunc(), footer excluded
+    uint32_t extraFooterSize;   // struct SaveArrayFooter
+} SaveLayoutView;
+
+// SaveSlotCheck_InitFromSavedat on one block
+typedef struct SaveBlockCheck
+{
+    int valid;
+    uint32_t count;             // 0 unless valid, as the game keeps it
+    uint32_t footerCount;       // what the footer says either way
+    int problem;                // SAVE_BLOCK_*
+} SaveBlockCheck;
+
+// What Save_GetSaveFilesStatus decided
+typedef struct SaveBootStatus
+{
+    int status;                 // SAVE_LOAD_*
+    int sector;                 // lastGoodSector, -1 unless IS_GOOD or SLOT_FAIL
+    uint32_t count;             // saveCounter, 0 if no sector
+} SaveBootStatus;
+
+// Both copies of an extra chunk, as ReadExtraSaveChunk sees them
+typedef struct SaveExtraCheck
+{
+    int present[2];             // the footer magic is there
+    int valid[2];               // ValidateChunk
+    uint32_t saveno[2];         // SaveArray_GetFooterSaveNo, valid or not
+    int loaded;                 // the copy ReadExtraSaveChunk returns, -1 if neither
+} SaveExtraCheck;
+
+// The flash and CRC models in hostsave.c. Flash_Attach gives the calling
+// thread a SAVE_FILE_SIZE image for the CARD calls to read.
+void Flash_Attach(const uint8_t * image);
+
+// In CRC_RECORD, GF_CalcCRC16 remembers every range it works out, for the
+// calling thread. In CRC_RECALL, a range it has seen comes back from memory,
+// adjusted for the one byte Crc_SetFlip says was XORed since; the caller
+// promises that nothing else in a remembered range changes. CRC_PLAIN works
+// everything out and leaves the memory alone.
+enum
+{
+    CRC_PLAIN,
+    CRC_RECORD,
+    CRC_RECALL,
+};
+
+void Crc_SetMode(int mode);
+void Crc_Forget(void);
+void Crc_SetFlip(const void * pos, uint8_t xor);
+
+// save.c as it ships. Init builds the CRC table and the layout; everything
+// after it may be called from any thread. Region is one sector's regionSize
+// bytes, as Save_GetSaveFilesStatus reads it. GetStatus and CheckExtraChunk
+// read the calling thread's attached flash.
+void SaveTool_Init(void);
+void SaveTool_GetLayout(SaveLayoutView * layout);
+uint16_t SaveTool_CalcCRC16(const void * data, uint32_t size);
+void SaveTool_CheckBlock(const uint8_t * region, int idx, SaveBlockCheck * check);
+void SaveTool_GetStatus(SaveBootStatus * status);
+void SaveTool_CheckExtraChunk(int idx, SaveExtraCheck * check);
+// SaveCounterCompare: 1 if a is the later save, -1 if b is, 0 if equal
+int SaveTool_CompareCount(uint32_t a, uint32_t b);
+// SaveSlot_BuildFooter with saveCounter set to count
+void SaveTool_BuildFooter(uint8_t * region, int idx, uint32_t count);
+// CreateChunkFooter for a chunk whose footer should read saveno; data is the
+// copy's first byte
+void SaveTool_BuildChunkFooter(uint8_t * data, int idx, uint32_t saveno);
+
+#endif //GUARD_SAVETOOL_SAVETOOL_H
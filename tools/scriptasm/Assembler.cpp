@@ -0,0 +1,364 @@
+#include <stdexcept>
+#include "Assembler.h"
+#include "Expression.h"
+
+static string Trim(const string & s) {
+    size_t start = s.find_first_not_of(" \t\r");
+    if (start == string::npos) {
+        return "";
+    }
+    size_t end = s.find_last_not_of(" \t\r");
+    return s.substr(start, end - start + 1);
+}
+
+// Splits on commas outside parentheses and strings
+static vector<string> SplitArgs(const string & s) {
+    vector<string> args;
+    string cur;
+    int depth = 0;
+    bool inString = false;
+
+    for (char c : s) {
+        if (c == '"') {
+            inString = !inString;
+        } else if (!inString && c == '(') {
+            depth++;
+        } else if (!inString && c == ')') {
+            depth--;
+        } else if (!inString && c == ',' && depth == 0) {
+            args.push_back(Trim(cur));
+            cur.clear();
+            continue;
+        }
+        cur += c;
+    }
+    if (!Trim(cur).empty() || !args.empty()) {
+        args.push_back(Trim(cur));
+    }
+    return args;
+}
+
+static string Lower(string s) {
+    for (char & c : s) {
+        if (c >= 'A' && c <= 'Z') {
+            c += 'a' - 'A';
+        }
+    }
+    return s;
+}
+
+static void Fail(const SourceLocation & loc, const string & message) {
+    throw runtime_error(loc.Describe() + ": " + message);
+}
+
+void Assembler::AssembleFile(const string & path) {
+    pp.Process(path, [this](const string & line, const SourceLocation & loc) {
+        Statement(line, loc);
+    });
+    if (defining != nullptr) {
+        throw runtime_error(path + ": missing .endm");
+    }
+    if (!conds.empty()) {
+        throw runtime_error(path + ": missing .endif");
+    }
+
+    for (const Fixup & fixup : fixups) {
+        size_t offset = fixup.offset;
+        optional<int64_t> value = EvaluateExpression(fixup.expr, [this](const string & name) -> optional<int64_t> {
+            auto it = symbols.find(name);
+            if (it == symbols.end()) {
+                return nullopt;
+            }
+            return it->second;
+        }, offset);
+        if (!value) {
+            Fail(fixup.loc, "undefined symbol in '" + fixup.expr + "'");
+        }
+        for (int i = 0; i < fixup.size; i++) {
+            output[offset + i] = (uint8_t)(*value >> (8 * i));
+        }
+    }
+}
+
+int64_t Assembler::Evaluate(const string & expr, const SourceLocation & loc) {
+    optional<int64_t> value;
+    try {
+        value = EvaluateExpression(expr, [this](const string & name) -> optional<int64_t> {
+            auto it = symbols.find(name);
+            if (it == symbols.end()) {
+                return nullopt;
+            }
+            return it->second;
+        }, output.size());
+    } catch (runtime_error & e) {
+        Fail(loc, e.what());
+    }
+    if (!value) {
+        Fail(loc, "expression '" + expr + "' must be constant here");
+    }
+    return *value;
+}
+
+void Assembler::Emit(int64_t value, int size) {
+    for (int i = 0; i < size; i++) {
+        output.push_back((uint8_t)(value >> (8 * i)));
+    }
+}
+
+// Values that use labels not yet seen are left as zeroes and patched once the
+// whole file has been read
+void Assembler::EmitData(const string & args, int size, const SourceLocation & loc) {
+    for (const string & arg : SplitArgs(args)) {
+        optional<int64_t> value;
+        try {
+            value = EvaluateExpression(arg, [this](const string & name) -> optional<int64_t> {
+                auto it = symbols.find(name);
+                if (it == symbols.end()) {
+                    return nullopt;
+                }
+                return it->second;
+            }, output.size());
+        } catch (runtime_error & e) {
+            Fail(loc, e.what());
+        }
+        if (!value) {
+            fixups.push_back({ output.size(), size, arg, loc });
+            value = 0;
+        }
+        Emit(*value, size);
+    }
+}
+
+void Assembler::Statement(string line, const SourceLocation & loc) {
+    line = Trim(line);
+    if (line.empty()) {
+        return;
+    }
+
+    size_t wordEnd = 0;
+    while (wordEnd < line.size() && (IsIdentChar(line[wordEnd]) || line[wordEnd] == '.')) {
+        wordEnd++;
+    }
+    string word = Lower(line.substr(0, wordEnd));
+    string rest = Trim(line.substr(wordEnd));
+
+    if (defining != nullptr) {
+        if (word == ".macro") {
+            defineDepth++;
+        } else if (word == ".endm") {
+            if (defineDepth-- == 0) {
+                defining = nullptr;
+                return;
+            }
+        }
+        defining->body.emplace_back(line, loc);
+        return;
+    }
+
+    // Conditionals are tracked even inside skipped blocks
+    bool active = conds.empty() || conds.back().active;
+    if (word == ".if" || word == ".ifdef" || word == ".ifndef" || word == ".ifb" || word == ".ifnb") {
+        bool value = false;
+        if (active) {
+            if (word == ".if") {
+                value = Evaluate(rest, loc) != 0;
+            } else if (word == ".ifdef" || word == ".ifndef") {
+                value = (symbols.count(rest) != 0) == (word == ".ifdef");
+            } else {
+                value = rest.empty() == (word == ".ifb");
+            }
+        }
+        conds.push_back({ active && value, value, active });
+        return;
+    }
+    if (word == ".elseif" || word == ".else" || word == ".endif") {
+        if (conds.empty()) {
+            Fail(loc, word + " without .if");
+        }
+        Conditional & cond = conds.back();
+        if (word == ".endif") {
+            conds.pop_back();
+        } else if (word == ".else") {
+            cond.active = cond.parentActive && !cond.taken;
+            cond.taken = true;
+        } else {
+            bool value = cond.parentActive && !cond.taken && Evaluate(rest, loc) != 0;
+            cond.active = value;
+            cond.taken = cond.taken || value;
+        }
+        return;
+    }
+    if (!active) {
+        return;
+    }
+
+    // Label definition
+    if (wordEnd < line.size() && line[wordEnd] == ':' && wordEnd > 0 && word[0] != '.') {
+        string label = line.substr(0, wordEnd);
+        if (symbols.count(label)) {
+            Fail(loc, "symbol " + label + " redefined");
+        }
+        symbols[label] = output.size();
+        Statement(line.substr(wordEnd + 1), loc);
+        return;
+    }
+
+    if (!word.empty() && word[0] == '.') {
+        Directive(word, rest, loc);
+        return;
+    }
+
+    string name = line.substr(0, wordEnd);
+    auto it = macros.find(name);
+    if (it == macros.end()) {
+        Fail(loc, "unknown instruction '" + name + "'");
+    }
+    ExpandMacro(it->second, rest, loc);
+}
+
+void Assembler::Directive(const string & name, const string & args, const SourceLocation & loc) {
+    if (name == ".byte") {
+        EmitData(args, 1, loc);
+    } else if (name == ".short" || name == ".hword" || name == ".2byte") {
+        EmitData(args, 2, loc);
+    } else if (name == ".word" || name == ".long" || name == ".4byte" || name == ".int") {
+        EmitData(args, 4, loc);
+    } else if (name == ".balign" || name == ".align") {
+        vector<string> parts = SplitArgs(args);
+        if (parts.empty()) {
+            Fail(loc, name + " needs an alignment");
+        }
+        int64_t align = Evaluate(parts[0], loc);
+        int64_t fill = parts.size() > 1 && !parts[1].empty() ? Evaluate(parts[1], loc) : 0;
+        if (align <= 0 || (align & (align - 1)) != 0) {
+            Fail(loc, "alignment must be a power of two");
+        }
+        while (output.size() % align != 0) {
+            Emit(fill, 1);
+        }
+    } else if (name == ".space" || name == ".skip") {
+        vector<string> parts = SplitArgs(args);
+        if (parts.empty()) {
+            Fail(loc, name + " needs a size");
+        }
+        int64_t size = Evaluate(parts[0], loc);
+        int64_t fill = parts.size() > 1 ? Evaluate(parts[1], loc) : 0;
+        for (int64_t i = 0; i < size; i++) {
+            Emit(fill, 1);
+        }
+    } else if (name == ".set" || name == ".equ") {
+        vector<string> parts = SplitArgs(args);
+        if (parts.size() != 2) {
+            Fail(loc, name + " needs a name and a value");
+        }
+        symbols[parts[0]] = Evaluate(parts[1], loc);
+    } else if (name == ".include") {
+        string file = Trim(args);
+        if (file.size() < 2 || file.front() != '"' || file.back() != '"') {
+            Fail(loc, "bad .include");
+        }
+        pp.Process(pp.Resolve(file.substr(1, file.size() - 2), true, loc.file, loc), [this](const string & line, const SourceLocation & innerLoc) {
+            Statement(line, innerLoc);
+        });
+    } else if (name == ".macro") {
+        vector<string> parts;
+        string cur;
+        for (char c : args) {
+            if (c == ',' || c == ' ' || c == '\t') {
+                if (!cur.empty()) {
+                    parts.push_back(cur);
+                }
+                cur.clear();
+            } else {
+                cur += c;
+            }
+        }
+        if (!cur.empty()) {
+            parts.push_back(cur);
+        }
+        if (parts.empty()) {
+            Fail(loc, ".macro needs a name");
+        }
+        MacroDef & macro = macros[parts[0]];
+        macro = MacroDef();
+        for (size_t i = 1; i < parts.size(); i++) {
+            string param = parts[i];
+            string def;
+            size_t eq = param.find('=');
+            if (eq != string::npos) {
+                def = param.substr(eq + 1);
+                param.erase(eq);
+            }
+            size_t colon = param.find(':');
+            if (colon != string::npos) {
+                param.erase(colon);
+            }
+            macro.params.push_back(param);
+            macro.defaults.push_back(def);
+        }
+        defining = &macro;
+        defineDepth = 0;
+    } else if (name == ".endm") {
+        Fail(loc, ".endm without .macro");
+    } else if (name == ".rodata" || name == ".text" || name == ".data" || name == ".section"
+               || name == ".option" || name == ".global" || name == ".globl" || name == ".public"
+               || name == ".extern" || name == ".type" || name == ".size") {
+        // Single flat section; nothing to do
+    } else {
+        Fail(loc, "unsupported directive " + name);
+    }
+}
+
+void Assembler::ExpandMacro(const MacroDef & macro, const string & argText, const SourceLocation & loc) {
+    vector<string> args = SplitArgs(argText);
+    if (args.size() > macro.params.size()) {
+        Fail(loc, "too many macro arguments");
+    }
+    args.resize(macro.params.size());
+    for (size_t i = 0; i < args.size(); i++) {
+        if (args[i].empty()) {
+            args[i] = macro.defaults[i];
+        }
+    }
+    if (++expansionDepth > 100) {
+        Fail(loc, "macro expansion too deep");
+    }
+    int unique = uniqueCounter++;
+
+    for (const auto & bodyLine : macro.body) {
+        const string & src = bodyLine.first;
+        string line;
+        for (size_t i = 0; i < src.size();) {
+            if (src[i] != '\\') {
+                line += src[i++];
+                continue;
+            }
+            if (src.compare(i, 3, "\\()") == 0) {
+                i += 3;
+                continue;
+            }
+            if (src.compare(i, 2, "\\@") == 0) {
+                line += to_string(unique);
+                i += 2;
+                continue;
+            }
+            size_t end = i + 1;
+            while (end < src.size() && IsIdentChar(src[end])) {
+                end++;
+            }
+            string id = src.substr(i + 1, end - i - 1);
+            size_t p = 0;
+            while (p < macro.params.size() && macro.params[p] != id) {
+                p++;
+            }
+            if (p < macro.params.size()) {
+                line += args[p];
+            } else {
+                line.append(src, i, end - i);
+            }
+            i = end;
+        }
+        Statement(line, loc);
+    }
+    expansionDepth--;
+}
@@ -0,0 +1,59 @@
+#ifndef GUARD_ASSEMBLER_H
+#define GUARD_ASSEMBLER_H
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "Preprocessor.h"
+
+using namespace std;
+
+// Assembles one script source into the flat bytes objcopy would have pulled
+// out of mwasm's object. Scripts live in a single section and only refer to
+// their own labels, so there is nothing to relocate.
+class Assembler {
+    struct MacroDef {
+        vector<string> params;
+        vector<string> defaults;
+        vector<pair<string, SourceLocation>> body;
+    };
+    struct Fixup {
+        size_t offset;
+        int size;
+        string expr;
+        SourceLocation loc;
+    };
+    struct Conditional {
+        bool active;
+        bool taken;
+        bool parentActive;
+    };
+
+    Preprocessor & pp;
+    vector<uint8_t> output;
+    unordered_map<string, int64_t> symbols;
+    unordered_map<string, MacroDef> macros;
+    vector<Fixup> fixups;
+    vector<Conditional> conds;
+
+    MacroDef * defining = nullptr;
+    int defineDepth = 0;
+    int expansionDepth = 0;
+    int uniqueCounter = 0;
+
+    void Statement(string line, const SourceLocation & loc);
+    void Directive(const string & name, const string & args, const SourceLocation & loc);
+    void ExpandMacro(const MacroDef & macro, const string & args, const SourceLocation & loc);
+    int64_t Evaluate(const string & expr, const SourceLocation & loc);
+    void Emit(int64_t value, int size);
+    void EmitData(const string & args, int size, const SourceLocation & loc);
+
+public:
+    explicit Assembler(Preprocessor & pp_) : pp(pp_) {}
+
+    void AssembleFile(const string & path);
+    const vector<uint8_t> & GetOutput() const { return output; }
+};
+
+#endif //GUARD_ASSEMBLER_H
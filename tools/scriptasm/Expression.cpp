@@ -0,0 +1,222 @@
+#include <stdexcept>
+#include "Expression.h"
+
+namespace {
+
+// Precedence climbing over the C binary operators. Unresolved symbols
+// propagate as nullopt rather than failing, so that callers can retry once
+// every label is known.
+class ExpressionParser {
+    const string & text;
+    const SymbolLookup & lookup;
+    int64_t dot;
+    size_t pos = 0;
+
+    [[noreturn]] void Fail(const string & message) {
+        throw runtime_error(message + " in expression '" + text + "'");
+    }
+
+    void SkipSpace() {
+        while (pos < text.size() && (text[pos] == ' ' || text[pos] == '\t')) {
+            pos++;
+        }
+    }
+
+    bool Accept(const char * op) {
+        SkipSpace();
+        size_t len = char_traits<char>::length(op);
+        if (text.compare(pos, len, op) != 0) {
+            return false;
+        }
+        // Don't mistake "<<" for "<" or "&&" for "&"
+        if (len == 1 && pos + 1 < text.size()) {
+            char next = text[pos + 1];
+            if ((op[0] == '<' || op[0] == '>') && (next == op[0] || next == '=')) {
+                return false;
+            }
+            if ((op[0] == '&' || op[0] == '|') && next == op[0]) {
+                return false;
+            }
+            if ((op[0] == '=' || op[0] == '!') && next == '=') {
+                return false;
+            }
+        }
+        pos += len;
+        return true;
+    }
+
+    int64_t ParseNumber() {
+        size_t start = pos;
+        int base = 10;
+        int64_t value = 0;
+
+        if (text[pos] == '0' && pos + 1 < text.size() && (text[pos + 1] == 'x' || text[pos + 1] == 'X')) {
+            base = 16;
+            pos += 2;
+        } else if (text[pos] == '0' && pos + 1 < text.size() && (text[pos + 1] == 'b' || text[pos + 1] == 'B')) {
+            base = 2;
+            pos += 2;
+        } else if (text[pos] == '0') {
+            base = 8;
+        }
+        for (; pos < text.size(); pos++) {
+            char c = text[pos];
+            int digit;
+            if (c >= '0' && c <= '9') {
+                digit = c - '0';
+            } else if (c >= 'a' && c <= 'f') {
+                digit = c - 'a' + 10;
+            } else if (c >= 'A' && c <= 'F') {
+                digit = c - 'A' + 10;
+            } else {
+                break;
+            }
+            if (digit >= base) {
+                if (base == 16 || !(c == 'b' || c == 'B' || c == 'f' || c == 'F')) {
+                    Fail("bad digit");
+                }
+                break;
+            }
+            value = value * base + digit;
+        }
+        while (pos < text.size() && (text[pos] == 'u' || text[pos] == 'U' || text[pos] == 'l' || text[pos] == 'L')) {
+            pos++;
+        }
+        if (pos < text.size() && IsIdentChar(text[pos])) {
+            Fail("bad number '" + text.substr(start, pos - start + 1) + "'");
+        }
+        return value;
+    }
+
+    optional<int64_t> ParsePrimary() {
+        SkipSpace();
+        if (pos >= text.size()) {
+            Fail("unexpected end");
+        }
+        char c = text[pos];
+        if (c == '(') {
+            pos++;
+            optional<int64_t> value = ParseBinary(0);
+            if (!Accept(")")) {
+                Fail("missing ')'");
+            }
+            return value;
+        }
+        if (c == '-' || c == '+' || c == '~' || c == '!') {
+            pos++;
+            optional<int64_t> value = ParsePrimary();
+            if (!value) {
+                return value;
+            }
+            switch (c) {
+            case '-': return -*value;
+            case '~': return ~*value;
+            case '!': return !*value;
+            default: return *value;
+            }
+        }
+        if (c >= '0' && c <= '9') {
+            return ParseNumber();
+        }
+        if (c == '\'' && pos + 2 < text.size() && text[pos + 2] == '\'') {
+            pos += 3;
+            return (unsigned char)text[pos - 2];
+        }
+        if (c == '.' && (pos + 1 >= text.size() || !IsIdentChar(text[pos + 1]))) {
+            pos++;
+            return dot;
+        }
+        if (IsIdentStart(c)) {
+            size_t start = pos;
+            while (pos < text.size() && IsIdentChar(text[pos])) {
+                pos++;
+            }
+            return lookup(text.substr(start, pos - start));
+        }
+        Fail(string("unexpected '") + c + "'");
+    }
+
+    // Binary operator levels, loosest first
+    int MatchOperator(int level, string & op) {
+        static const char * const sLevels[][4] = {
+            { "||" },
+            { "&&" },
+            { "|" },
+            { "^" },
+            { "&" },
+            { "==", "!=" },
+            { "<=", ">=", "<", ">" },
+            { "<<", ">>" },
+            { "+", "-" },
+            { "*", "/", "%" },
+        };
+        for (const char * candidate : sLevels[level]) {
+            if (candidate != nullptr && Accept(candidate)) {
+                op = candidate;
+                return 1;
+            }
+        }
+        return 0;
+    }
+
+    static constexpr int kNumLevels = 10;
+
+    optional<int64_t> ParseBinary(int level) {
+        if (level == kNumLevels) {
+            return ParsePrimary();
+        }
+        optional<int64_t> lhs = ParseBinary(level + 1);
+        string op;
+        while (MatchOperator(level, op)) {
+            optional<int64_t> rhs = ParseBinary(level + 1);
+            if (!lhs || !rhs) {
+                lhs.reset();
+                continue;
+            }
+            int64_t a = *lhs, b = *rhs;
+            if (op == "||") a = a || b;
+            else if (op == "&&") a = a && b;
+            else if (op == "|") a |= b;
+            else if (op == "^") a ^= b;
+            else if (op == "&") a &= b;
+            else if (op == "==") a = a == b;
+            else if (op == "!=") a = a != b;
+            else if (op == "<=") a = a <= b;
+            else if (op == ">=") a = a >= b;
+            else if (op == "<") a = a < b;
+            else if (op == ">") a = a > b;
+            else if (op == "<<") a <<= b;
+            else if (op == ">>") a >>= b;
+            else if (op == "+") a += b;
+            else if (op == "-") a -= b;
+            else if (op == "*") a *= b;
+            else {
+                if (b == 0) {
+                    Fail("division by zero");
+                }
+                a = op == "/" ? a / b : a % b;
+            }
+            lhs = a;
+        }
+        return lhs;
+    }
+
+public:
+    ExpressionParser(const string & text_, const SymbolLookup & lookup_, int64_t dot_)
+        : text(text_), lookup(lookup_), dot(dot_) {}
+
+    optional<int64_t> Parse() {
+        optional<int64_t> value = ParseBinary(0);
+        SkipSpace();
+        if (pos != text.size()) {
+            Fail("trailing characters");
+        }
+        return value;
+    }
+};
+
+}
+
+optional<int64_t> EvaluateExpression(const string & expr, const SymbolLookup & lookup, int64_t dot) {
+    return ExpressionParser(expr, lookup, dot).Parse();
+}
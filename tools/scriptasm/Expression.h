@@ -0,0 +1,27 @@
+#ifndef GUARD_EXPRESSION_H
+#define GUARD_EXPRESSION_H
+
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <string>
+
+using namespace std;
+
+// Looks up a symbol; returns nullopt if it is not (yet) defined
+typedef function<optional<int64_t>(const string &)> SymbolLookup;
+
+// Evaluates a C-style integer expression. "." stands for dot. Returns nullopt
+// if the expression refers to an undefined symbol; throws runtime_error on a
+// syntax error.
+optional<int64_t> EvaluateExpression(const string & expr, const SymbolLookup & lookup, int64_t dot);
+
+static inline bool IsIdentStart(char c) {
+    return (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') || c == '_';
+}
+
+static inline bool IsIdentChar(char c) {
+    return IsIdentStart(c) || (c >= '0' && c <= '9');
+}
+
+#endif //GUARD_EXPRESSION_H
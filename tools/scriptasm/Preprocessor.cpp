@@ -0,0 +1,498 @@
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include "Expression.h"
+#include "Preprocessor.h"
+
+shared_ptr<const string> FileCache::Get(const string & path) {
+    {
+        lock_guard<mutex> guard(lock);
+        auto it = files.find(path);
+        if (it != files.end()) {
+            return it->second;
+        }
+    }
+    ifstream file(path, ios::binary);
+    if (!file.good()) {
+        return nullptr;
+    }
+    ostringstream contents;
+    contents << file.rdbuf();
+    auto data = make_shared<const string>(contents.str());
+    lock_guard<mutex> guard(lock);
+    return files.emplace(path, data).first->second;
+}
+
+shared_ptr<const HeaderSnapshot> FileCache::GetSnapshot(const string & path) {
+    lock_guard<mutex> guard(lock);
+    auto it = snapshots.find(path);
+    return it != snapshots.end() ? it->second : nullptr;
+}
+
+void FileCache::PutSnapshot(const string & path, shared_ptr<const HeaderSnapshot> snapshot) {
+    lock_guard<mutex> guard(lock);
+    snapshots.emplace(path, snapshot);
+}
+
+static string Trim(const string & s) {
+    size_t start = s.find_first_not_of(" \t\r");
+    if (start == string::npos) {
+        return "";
+    }
+    size_t end = s.find_last_not_of(" \t\r");
+    return s.substr(start, end - start + 1);
+}
+
+static string NormalizePath(const string & path) {
+    string normal = filesystem::path(path).lexically_normal().generic_string();
+    return normal;
+}
+
+static bool FileExists(const string & path) {
+    error_code ec;
+    return filesystem::is_regular_file(path, ec);
+}
+
+static size_t FindAsmComment(const string & line) {
+    bool inString = false;
+    for (size_t i = 0; i < line.size(); i++) {
+        if (line[i] == '"') {
+            inString = !inString;
+        } else if (line[i] == ';' && !inString) {
+            return i;
+        }
+    }
+    return string::npos;
+}
+
+void Preprocessor::Define(const string & name, const string & value) {
+    Macro macro;
+    macro.body = value;
+    macros[name] = macro;
+}
+
+bool Preprocessor::IsDisabled(const vector<string> & disabled, const string & name) const {
+    for (const string & d : disabled) {
+        if (d == name) {
+            return true;
+        }
+    }
+    return false;
+}
+
+string Preprocessor::Expand(const string & text) const {
+    vector<string> disabled;
+    return Expand(text, disabled);
+}
+
+// Macro expansion with the usual rule that a macro is not expanded again
+// inside its own replacement. Arguments are expanded before substitution.
+string Preprocessor::Expand(const string & text, vector<string> & disabled) const {
+    string out;
+    size_t i = 0;
+
+    out.reserve(text.size());
+    while (i < text.size()) {
+        char c = text[i];
+        if (c == '"') {
+            size_t end = i + 1;
+            while (end < text.size() && text[end] != '"') {
+                end += text[end] == '\\' ? 2 : 1;
+            }
+            end = min(end + 1, text.size());
+            out.append(text, i, end - i);
+            i = end;
+            continue;
+        }
+        if (c >= '0' && c <= '9') {
+            // pp-number: 0x4000u and friends are one token
+            size_t end = i + 1;
+            while (end < text.size() && (IsIdentChar(text[end]) || text[end] == '.')) {
+                end++;
+            }
+            out.append(text, i, end - i);
+            i = end;
+            continue;
+        }
+        if (!IsIdentStart(c)) {
+            out += c;
+            i++;
+            continue;
+        }
+
+        size_t end = i + 1;
+        while (end < text.size() && IsIdentChar(text[end])) {
+            end++;
+        }
+        string name = text.substr(i, end - i);
+        auto it = macros.find(name);
+        if (it == macros.end() || IsDisabled(disabled, name)) {
+            out += name;
+            i = end;
+            continue;
+        }
+
+        const Macro & macro = it->second;
+        if (!macro.isFunction) {
+            disabled.push_back(name);
+            out += Expand(macro.body, disabled);
+            disabled.pop_back();
+            i = end;
+            continue;
+        }
+
+        // Function-like: only a call if followed by '('
+        size_t open = end;
+        while (open < text.size() && (text[open] == ' ' || text[open] == '\t')) {
+            open++;
+        }
+        if (open >= text.size() || text[open] != '(') {
+            out += name;
+            i = end;
+            continue;
+        }
+        vector<string> args;
+        string arg;
+        int depth = 0;
+        size_t j = open + 1;
+        for (; j < text.size(); j++) {
+            char ch = text[j];
+            if (ch == '(') {
+                depth++;
+            } else if (ch == ')') {
+                if (depth == 0) {
+                    break;
+                }
+                depth--;
+            } else if (ch == ',' && depth == 0) {
+                args.push_back(Trim(arg));
+                arg.clear();
+                continue;
+            }
+            arg += ch;
+        }
+        if (j >= text.size()) {
+            out += name;
+            i = end;
+            continue;
+        }
+        if (!Trim(arg).empty() || !args.empty() || !macro.params.empty()) {
+            args.push_back(Trim(arg));
+        }
+        if (args.size() != macro.params.size()) {
+            throw runtime_error("macro " + name + " expects " + to_string(macro.params.size()) + " arguments");
+        }
+        for (string & a : args) {
+            a = Expand(a, disabled);
+        }
+
+        string body;
+        const string & src = macro.body;
+        for (size_t k = 0; k < src.size();) {
+            if (!IsIdentStart(src[k])) {
+                body += src[k++];
+                continue;
+            }
+            size_t idEnd = k + 1;
+            while (idEnd < src.size() && IsIdentChar(src[idEnd])) {
+                idEnd++;
+            }
+            string id = src.substr(k, idEnd - k);
+            size_t p = 0;
+            while (p < macro.params.size() && macro.params[p] != id) {
+                p++;
+            }
+            body += p < macro.params.size() ? args[p] : id;
+            k = idEnd;
+        }
+        disabled.push_back(name);
+        out += Expand(body, disabled);
+        disabled.pop_back();
+        i = j + 1;
+    }
+    return out;
+}
+
+void Preprocessor::HandleDefine(const string & rest, const SourceLocation & loc) {
+    size_t end = 0;
+    while (end < rest.size() && IsIdentChar(rest[end])) {
+        end++;
+    }
+    if (end == 0) {
+        throw runtime_error(loc.Describe() + ": bad #define");
+    }
+    string name = rest.substr(0, end);
+    Macro macro;
+    if (end < rest.size() && rest[end] == '(') {
+        size_t close = rest.find(')', end);
+        if (close == string::npos) {
+            throw runtime_error(loc.Describe() + ": bad #define parameter list");
+        }
+        macro.isFunction = true;
+        stringstream params(rest.substr(end + 1, close - end - 1));
+        string param;
+        while (getline(params, param, ',')) {
+            param = Trim(param);
+            if (!param.empty()) {
+                macro.params.push_back(param);
+            }
+        }
+        end = close + 1;
+    }
+    macro.body = Trim(rest.substr(end));
+    macros[name] = macro;
+}
+
+bool Preprocessor::EvaluateCondition(const string & rest, const SourceLocation & loc) {
+    // Resolve defined() before expansion, as cpp does
+    string text;
+    for (size_t i = 0; i < rest.size();) {
+        if (rest.compare(i, 7, "defined") == 0 && (i == 0 || !IsIdentChar(rest[i - 1]))
+            && (i + 7 >= rest.size() || !IsIdentChar(rest[i + 7]))) {
+            size_t j = i + 7;
+            while (j < rest.size() && (rest[j] == ' ' || rest[j] == '(')) {
+                j++;
+            }
+            size_t start = j;
+            while (j < rest.size() && IsIdentChar(rest[j])) {
+                j++;
+            }
+            string name = rest.substr(start, j - start);
+            while (j < rest.size() && (rest[j] == ' ' || rest[j] == ')')) {
+                j++;
+            }
+            text += macros.count(name) ? " 1 " : " 0 ";
+            i = j;
+        } else {
+            text += rest[i++];
+        }
+    }
+    try {
+        optional<int64_t> value = EvaluateExpression(Expand(text), [](const string &) { return optional<int64_t>(0); }, 0);
+        return *value != 0;
+    } catch (runtime_error & e) {
+        throw runtime_error(loc.Describe() + ": " + e.what());
+    }
+}
+
+string Preprocessor::Resolve(const string & name, bool quoted, const string & fromFile, const SourceLocation & loc) const {
+    if (quoted) {
+        string local = NormalizePath((filesystem::path(fromFile).parent_path() / name).generic_string());
+        if (FileExists(local)) {
+            return local;
+        }
+    }
+    for (const string & dir : includeDirs) {
+        string candidate = NormalizePath(dir + "/" + name);
+        if (FileExists(candidate)) {
+            return candidate;
+        }
+    }
+    throw runtime_error(loc.Describe() + ": cannot find include file " + name);
+}
+
+// The first header a script includes is normally the same big one, and with
+// the same command-line macros it always leaves the same state behind. Reuse
+// that state when the header produced no lines for the assembler.
+void Preprocessor::Include(const string & file, const LineSink & sink) {
+    if (!pristine || depth != 1) {
+        Process(file, sink);
+        return;
+    }
+    pristine = false;
+
+    shared_ptr<const HeaderSnapshot> snapshot = cache.GetSnapshot(file);
+    if (snapshot != nullptr) {
+        macros = snapshot->macros;
+        onceFiles.insert(snapshot->onceFiles.begin(), snapshot->onceFiles.end());
+        for (const string & dep : snapshot->dependencies) {
+            if (seenFiles.insert(dep).second) {
+                dependencies.push_back(dep);
+            }
+        }
+        return;
+    }
+
+    size_t firstDep = dependencies.size();
+    bool emitted = false;
+    Process(file, [&](const string & line, const SourceLocation & loc) {
+        emitted = true;
+        sink(line, loc);
+    });
+    if (!emitted) {
+        auto made = make_shared<HeaderSnapshot>();
+        made->macros = macros;
+        made->onceFiles = onceFiles;
+        made->dependencies.assign(dependencies.begin() + firstDep, dependencies.end());
+        cache.PutSnapshot(file, made);
+    }
+}
+
+void Preprocessor::Process(const string & path, const LineSink & sink) {
+    struct DepthGuard {
+        int & d;
+        DepthGuard(int & d_) : d(d_) { d++; }
+        ~DepthGuard() { d--; }
+    } depthGuard(depth);
+
+    shared_ptr<const string> contents = cache.Get(path);
+    if (contents == nullptr) {
+        throw runtime_error("cannot open " + path);
+    }
+    if (seenFiles.insert(path).second) {
+        dependencies.push_back(path);
+    }
+
+    const string & src = *contents;
+    vector<Conditional> conds;
+    bool inComment = false;
+    SourceLocation loc { path, 0 };
+    size_t pos = 0;
+    int nextLine = 1;
+
+    while (pos < src.size()) {
+        // Gather one logical line, joining backslash continuations and
+        // dropping comments
+        string line;
+        loc.line = nextLine;
+        bool inString = false;
+        while (pos < src.size()) {
+            char c = src[pos];
+            if (c == '\n') {
+                nextLine++;
+                pos++;
+                break;
+            }
+            if (c == '\\' && (src.compare(pos, 2, "\\\n") == 0 || src.compare(pos, 3, "\\\r\n") == 0)) {
+                pos += src[pos + 1] == '\r' ? 3 : 2;
+                nextLine++;
+                continue;
+            }
+            if (inComment) {
+                if (src.compare(pos, 2, "*/") == 0) {
+                    inComment = false;
+                    line += ' ';
+                    pos += 2;
+                } else {
+                    pos++;
+                }
+                continue;
+            }
+            if (inString) {
+                if (c == '\\' && pos + 1 < src.size() && src[pos + 1] != '\n') {
+                    line += c;
+                    c = src[++pos];
+                } else if (c == '"') {
+                    inString = false;
+                }
+                line += c;
+                pos++;
+                continue;
+            }
+            if (c == '"') {
+                inString = true;
+            } else if (src.compare(pos, 2, "/*") == 0) {
+                inComment = true;
+                pos += 2;
+                continue;
+            } else if (src.compare(pos, 2, "//") == 0) {
+                while (pos < src.size() && src[pos] != '\n') {
+                    pos++;
+                }
+                continue;
+            }
+            line += c;
+            pos++;
+        }
+
+        bool active = conds.empty() || conds.back().active;
+        string trimmed = Trim(line);
+        if (trimmed.empty() || trimmed[0] != '#') {
+            if (active && !trimmed.empty()) {
+                // Assembler comments are not for the preprocessor to expand
+                size_t comment = FindAsmComment(line);
+                if (comment != string::npos) {
+                    line.erase(comment);
+                }
+                sink(Expand(line), loc);
+            }
+            continue;
+        }
+
+        string directive = Trim(trimmed.substr(1));
+        size_t nameEnd = 0;
+        while (nameEnd < directive.size() && IsIdentChar(directive[nameEnd])) {
+            nameEnd++;
+        }
+        string name = directive.substr(0, nameEnd);
+        string rest = Trim(directive.substr(nameEnd));
+
+        if (name == "if" || name == "ifdef" || name == "ifndef") {
+            bool value = false;
+            if (active) {
+                if (name == "if") {
+                    value = EvaluateCondition(rest, loc);
+                } else {
+                    value = (macros.count(rest) != 0) == (name == "ifdef");
+                }
+            }
+            conds.push_back({ active && value, value, active });
+        } else if (name == "elif") {
+            if (conds.empty()) {
+                throw runtime_error(loc.Describe() + ": #elif without #if");
+            }
+            Conditional & cond = conds.back();
+            bool value = cond.parentActive && !cond.taken && EvaluateCondition(rest, loc);
+            cond.active = value;
+            cond.taken = cond.taken || value;
+        } else if (name == "else") {
+            if (conds.empty()) {
+                throw runtime_error(loc.Describe() + ": #else without #if");
+            }
+            Conditional & cond = conds.back();
+            cond.active = cond.parentActive && !cond.taken;
+            cond.taken = true;
+        } else if (name == "endif") {
+            if (conds.empty()) {
+                throw runtime_error(loc.Describe() + ": #endif without #if");
+            }
+            conds.pop_back();
+        } else if (!active) {
+            continue;
+        } else if (name == "include") {
+            string target = rest;
+            if (target.empty() || (target[0] != '"' && target[0] != '<')) {
+                target = Trim(Expand(target));
+            }
+            char close = target.empty() ? 0 : (target[0] == '"' ? '"' : '>');
+            size_t closePos = target.find(close, 1);
+            if (close == 0 || closePos == string::npos) {
+                throw runtime_error(loc.Describe() + ": bad #include");
+            }
+            string file = Resolve(target.substr(1, closePos - 1), close == '"', path, loc);
+            if (!onceFiles.count(file)) {
+                Include(file, sink);
+            }
+        } else if (name == "define") {
+            pristine = false;
+            HandleDefine(rest, loc);
+        } else if (name == "undef") {
+            pristine = false;
+            macros.erase(rest);
+        } else if (name == "pragma") {
+            if (rest == "once") {
+                onceFiles.insert(path);
+            }
+        } else if (name == "error") {
+            throw runtime_error(loc.Describe() + ": #error " + rest);
+        } else if (name == "warning" || name == "line" || name.empty()) {
+            // nothing to do
+        } else {
+            throw runtime_error(loc.Describe() + ": unknown directive #" + name);
+        }
+    }
+    if (!conds.empty()) {
+        throw runtime_error(path + ": unterminated conditional");
+    }
+}
@@ -0,0 +1,93 @@
+#ifndef GUARD_PREPROCESSOR_H
+#define GUARD_PREPROCESSOR_H
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace std;
+
+struct SourceLocation {
+    string file;
+    int line;
+    string Describe() const { return file + ":" + to_string(line); }
+};
+
+struct PreprocessorMacro {
+    bool isFunction = false;
+    vector<string> params;
+    string body;
+};
+
+// What including a header leaves behind, starting from a fresh preprocessor
+struct HeaderSnapshot {
+    unordered_map<string, PreprocessorMacro> macros;
+    set<string> onceFiles;
+    vector<string> dependencies;
+};
+
+// Source files are read once and shared by every job. Headers such as
+// constants/scrcmd.h are included first by every script, so the macro table
+// they produce is kept too and copied instead of being parsed again.
+class FileCache {
+    mutex lock;
+    unordered_map<string, shared_ptr<const string>> files;
+    unordered_map<string, shared_ptr<const HeaderSnapshot>> snapshots;
+public:
+    shared_ptr<const string> Get(const string & path);
+    shared_ptr<const HeaderSnapshot> GetSnapshot(const string & path);
+    void PutSnapshot(const string & path, shared_ptr<const HeaderSnapshot> snapshot);
+};
+
+// The subset of the C preprocessor that the assembler runs over script
+// sources and the headers they pull in: #include, object- and function-like
+// #define, #undef, conditionals and #pragma once.
+class Preprocessor {
+public:
+    typedef function<void(const string &, const SourceLocation &)> LineSink;
+
+private:
+    typedef PreprocessorMacro Macro;
+    struct Conditional {
+        bool active;        // lines are being emitted
+        bool taken;         // some branch of this group has been taken
+        bool parentActive;
+    };
+
+    FileCache & cache;
+    const vector<string> & includeDirs;
+    unordered_map<string, Macro> macros;
+    set<string> onceFiles;
+    set<string> seenFiles;
+    vector<string> dependencies;
+    bool pristine = true;   // nothing but command-line macros defined yet
+    int depth = 0;
+
+    void Include(const string & file, const LineSink & sink);
+    string Expand(const string & text, vector<string> & disabled) const;
+    bool IsDisabled(const vector<string> & disabled, const string & name) const;
+    void HandleDefine(const string & rest, const SourceLocation & loc);
+    bool EvaluateCondition(const string & rest, const SourceLocation & loc);
+
+public:
+    Preprocessor(FileCache & cache_, const vector<string> & includeDirs_) : cache(cache_), includeDirs(includeDirs_) {}
+
+    void Define(const string & name, const string & value);
+    string Expand(const string & text) const;
+
+    // Finds an included file: next to the including file first for quoted
+    // names, then on the include path. Throws if it does not exist.
+    string Resolve(const string & name, bool quoted, const string & fromFile, const SourceLocation & loc) const;
+
+    // Runs path through the preprocessor, passing every surviving line to sink
+    void Process(const string & path, const LineSink & sink);
+
+    // Every file read so far, in the order first read
+    const vector<string> & GetDependencies() const { return dependencies; }
+};
+
+#endif //GUARD_PREPROCESSOR_H
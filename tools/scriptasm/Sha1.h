@@ -0,0 +1,13 @@
+#ifndef GUARD_SHA1_H
+#define GUARD_SHA1_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+using namespace std;
+
+// Lower-case hex digest, as printed by sha1sum
+string Sha1Hex(const void * data, size_t size);
+
+#endif //GUARD_SHA1_H
@@ -0,0 +1,347 @@
+/*
+ * SCRIPTASM: Assembles field scripts (the scr_seq sources) straight to the raw
+ * bytecode that mwasmarm + objcopy -O binary would produce, many at once.
+ *
+ * Usage:
+ *     scriptasm [MWASFLAGS] [-MD] [-j N] [-f] [--stamp FILE] [--verify SHA1FILE] FILE.s...
+ */
+
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <set>
+#include <sstream>
+#include <thread>
+#include "Assembler.h"
+#include "Preprocessor.h"
+#include "Sha1.h"
+
+static const char* progname = "scriptasm";
+
+struct Options {
+    vector<string> includeDirs;
+    vector<pair<string, string>> defines;
+    vector<string> undefines;
+    vector<string> preincludes;
+    vector<string> inputs;
+    string verifyFile;
+    string stampFile;
+    bool writeDeps = false;
+    bool force = false;
+    bool verbose = false;
+    unsigned numThreads = 0;
+};
+
+static inline void usage() {
+    cout << "Usage: " << progname << " [OPTIONS] FILE.s..." << endl;
+    cout << endl;
+    cout << "Writes FILE.bin for each FILE.s, skipping those that are up to date." << endl;
+    cout << endl;
+    cout << "-i DIR, -I DIR    Add DIR to the include path" << endl;
+    cout << "-D NAME[=VALUE]   Define a preprocessor macro" << endl;
+    cout << "-U NAME           Undefine a preprocessor macro" << endl;
+    cout << "-include FILE     Preprocess FILE before each source" << endl;
+    cout << "-MD               Also write FILE.d listing the files FILE.bin depends on" << endl;
+    cout << "-j N              Use N threads (default: all cores)" << endl;
+    cout << "-f                Assemble everything, even if up to date" << endl;
+    cout << "-v                Report what was assembled and how long it took" << endl;
+    cout << "--stamp FILE      Write FILE once every output is current; with -MD, also" << endl;
+    cout << "                  write FILE.d listing every file the outputs depend on" << endl;
+    cout << "--verify SHA1FILE Check outputs against a sha1sum listing" << endl;
+    cout << endl;
+    cout << "mwasmarm options that do not affect scripts (-proc, -gccinc, ...) are accepted and ignored." << endl;
+}
+
+static Options ParseOptions(int argc, char ** argv) {
+    Options options;
+
+    for (int i = 1; i < argc; i++) {
+        string arg = argv[i];
+        auto value = [&](size_t prefixLen) -> string {
+            if (arg.size() > prefixLen) {
+                return arg.substr(prefixLen);
+            }
+            if (i + 1 >= argc) {
+                throw invalid_argument("missing value for " + arg);
+            }
+            return argv[++i];
+        };
+
+        if (arg == "-h" || arg == "--help") {
+            usage();
+            exit(0);
+        } else if (arg == "-include") {
+            options.preincludes.push_back(value(arg.size()));
+        } else if (arg.compare(0, 2, "-i") == 0 || arg.compare(0, 2, "-I") == 0) {
+            options.includeDirs.push_back(value(2));
+        } else if (arg.compare(0, 2, "-D") == 0) {
+            string def = value(2);
+            size_t eq = def.find('=');
+            if (eq == string::npos) {
+                options.defines.emplace_back(def, "1");
+            } else {
+                options.defines.emplace_back(def.substr(0, eq), def.substr(eq + 1));
+            }
+        } else if (arg.compare(0, 2, "-U") == 0) {
+            options.undefines.push_back(value(2));
+        } else if (arg == "-MD") {
+            options.writeDeps = true;
+        } else if (arg.compare(0, 2, "-j") == 0) {
+            options.numThreads = stoul(value(2));
+        } else if (arg == "-f") {
+            options.force = true;
+        } else if (arg == "-v") {
+            options.verbose = true;
+        } else if (arg == "--stamp") {
+            options.stampFile = value(arg.size());
+        } else if (arg == "--verify") {
+            options.verifyFile = value(arg.size());
+        } else if (arg == "-proc" || arg == "-msgstyle") {
+            i++;
+        } else if (arg == "-gccinc" || arg == "-gccdep") {
+            // mwasm search-order and dependency-format switches; scriptasm
+            // always behaves as if both were given
+        } else if (arg[0] == '-') {
+            throw invalid_argument("unknown option " + arg);
+        } else {
+            options.inputs.push_back(arg);
+        }
+    }
+    if (options.numThreads == 0) {
+        options.numThreads = max(1u, thread::hardware_concurrency());
+    }
+    return options;
+}
+
+static string ReplaceExtension(const string & path, const string & ext) {
+    return filesystem::path(path).replace_extension(ext).generic_string();
+}
+
+static void WriteFile(const string & path, const void * data, size_t size) {
+    ofstream file(path, ios::binary | ios::trunc);
+    file.write((const char *)data, size);
+    if (!file.good()) {
+        throw runtime_error("cannot write " + path);
+    }
+}
+
+// The same layout mwasm -gccdep -MD produces once fixdep has run over it and
+// the target has been renamed from .o to .bin
+static string FormatDepFile(const string & target, const vector<string> & deps) {
+    string out = target + ": ";
+    for (size_t i = 0; i < deps.size(); i++) {
+        out += deps[i];
+        out += i + 1 < deps.size() ? " \\\n\t" : "\n";
+    }
+    return out;
+}
+
+// Reads the prerequisites out of a file FormatDepFile wrote
+static bool ReadDepFile(const string & dep, vector<string> & deps) {
+    ifstream depFile(dep);
+    if (!depFile.good()) {
+        return false;
+    }
+    stringstream contents;
+    contents << depFile.rdbuf();
+    string text = contents.str();
+    size_t colon = text.find(": ");
+    if (colon == string::npos) {
+        return false;
+    }
+    stringstream tokens(text.substr(colon + 2));
+    string token;
+    while (tokens >> token) {
+        if (token != "\\") {
+            deps.push_back(token);
+        }
+    }
+    return true;
+}
+
+// Mirrors make's view: FILE.bin is current if it is newer than FILE.s and
+// every file listed in FILE.d
+static bool IsUpToDate(const string & src, const string & bin, const string & dep, bool needDep) {
+    error_code ec;
+    auto binTime = filesystem::last_write_time(bin, ec);
+    if (ec) {
+        return false;
+    }
+    auto newer = [&](const string & path) {
+        error_code ec2;
+        auto t = filesystem::last_write_time(path, ec2);
+        return ec2 || t > binTime;
+    };
+    if (newer(src)) {
+        return false;
+    }
+    vector<string> deps;
+    if (!ReadDepFile(dep, deps)) {
+        return !needDep && !filesystem::exists(dep);
+    }
+    for (const string & path : deps) {
+        if (newer(path)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// The stamp make hangs the .bin files and the narc off. Its .d file is the
+// union of the scripts' own, with an empty rule for each prerequisite the way
+// gcc -MP writes them, so that deleting a header or a script doesn't stop make.
+static void WriteStamp(const Options & options) {
+    if (options.writeDeps) {
+        set<string> all;
+        for (const string & src : options.inputs) {
+            vector<string> deps;
+            if (!ReadDepFile(ReplaceExtension(src, ".d"), deps)) {
+                throw runtime_error("cannot read " + ReplaceExtension(src, ".d"));
+            }
+            all.insert(deps.begin(), deps.end());
+        }
+        vector<string> sorted(all.begin(), all.end());
+        string out = FormatDepFile(options.stampFile, sorted);
+        for (const string & path : sorted) {
+            out += "\n" + path + ":\n";
+        }
+        WriteFile(options.stampFile + ".d", out.data(), out.size());
+    }
+    WriteFile(options.stampFile, nullptr, 0);
+}
+
+static void AssembleOne(const Options & options, FileCache & cache, const string & src) {
+    Preprocessor pp(cache, options.includeDirs);
+    for (const auto & def : options.defines) {
+        pp.Define(def.first, def.second);
+    }
+    Assembler assembler(pp);
+    for (const string & file : options.preincludes) {
+        SourceLocation loc { "<command line>", 0 };
+        assembler.AssembleFile(pp.Resolve(file, false, ".", loc));
+    }
+    assembler.AssembleFile(src);
+
+    string bin = ReplaceExtension(src, ".bin");
+    const vector<uint8_t> & output = assembler.GetOutput();
+    WriteFile(bin, output.data(), output.size());
+    if (options.writeDeps) {
+        string deps = FormatDepFile(bin, pp.GetDependencies());
+        WriteFile(ReplaceExtension(src, ".d"), deps.data(), deps.size());
+    }
+}
+
+static bool Verify(const string & listPath) {
+    ifstream list(listPath);
+    if (!list.good()) {
+        throw runtime_error("cannot open " + listPath);
+    }
+    string line;
+    int failures = 0;
+    while (getline(list, line)) {
+        if (line.size() < 42) {
+            continue;
+        }
+        string expected = line.substr(0, 40);
+        string path = line.substr(41);
+        if (!path.empty() && path[0] == '*') {
+            path.erase(0, 1);
+        }
+        ifstream file(path, ios::binary);
+        if (!file.good()) {
+            cerr << path << ": FAILED open or read" << endl;
+            failures++;
+            continue;
+        }
+        stringstream contents;
+        contents << file.rdbuf();
+        string data = contents.str();
+        if (Sha1Hex(data.data(), data.size()) != expected) {
+            cerr << path << ": FAILED" << endl;
+            failures++;
+        }
+    }
+    if (failures != 0) {
+        cerr << progname << ": WARNING: " << failures << " computed checksum" << (failures == 1 ? " did" : "s did") << " NOT match" << endl;
+    }
+    return failures == 0;
+}
+
+int main(int argc, char ** argv) {
+    Options options;
+    try {
+        options = ParseOptions(argc, argv);
+    } catch (exception & e) {
+        cerr << "Invalid Argument: " << e.what() << endl;
+        usage();
+        return 1;
+    }
+    if (options.inputs.empty() && options.verifyFile.empty()) {
+        usage();
+        return 1;
+    }
+
+    auto start = chrono::steady_clock::now();
+    vector<string> stale;
+    for (const string & src : options.inputs) {
+        if (options.force || !IsUpToDate(src, ReplaceExtension(src, ".bin"), ReplaceExtension(src, ".d"), options.writeDeps)) {
+            stale.push_back(src);
+        }
+    }
+
+    FileCache cache;
+    atomic<size_t> next(0);
+    atomic<int> failures(0);
+    mutex errorLock;
+    vector<thread> workers;
+    unsigned numThreads = min<size_t>(options.numThreads, max<size_t>(stale.size(), 1));
+    for (unsigned t = 0; t < numThreads; t++) {
+        workers.emplace_back([&]() {
+            size_t i;
+            while ((i = next++) < stale.size()) {
+                try {
+                    AssembleOne(options, cache, stale[i]);
+                } catch (exception & e) {
+                    // Don't leave an output behind that make would think is current
+                    remove(ReplaceExtension(stale[i], ".bin").c_str());
+                    lock_guard<mutex> guard(errorLock);
+                    cerr << "Error: " << e.what() << endl;
+                    failures++;
+                }
+            }
+        });
+    }
+    for (thread & worker : workers) {
+        worker.join();
+    }
+
+    if (options.verbose) {
+        auto ms = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - start).count();
+        cerr << progname << ": assembled " << stale.size() << " of " << options.inputs.size() << " scripts in " << ms << " ms on " << numThreads << " threads" << endl;
+    }
+    if (failures != 0) {
+        return 1;
+    }
+    if (!options.verifyFile.empty()) {
+        try {
+            if (!Verify(options.verifyFile)) {
+                return 1;
+            }
+        } catch (exception & e) {
+            cerr << "Error: " << e.what() << endl;
+            return 1;
+        }
+    }
+    if (!options.stampFile.empty()) {
+        try {
+            WriteStamp(options);
+        } catch (exception & e) {
+            cerr << "Error: " << e.what() << endl;
+            return 1;
+        }
+    }
+    return 0;
+}
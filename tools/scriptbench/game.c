@@ -0,0 +1,72 @@
+// fieldmap.c as the game builds it, with or without OPTIMIZE_SCRIPT_BANK_PREFETCH.
+// The Makefile compiles this file once per variant with SCRIPT_PREFIX set and
+// hides everything but the functions below, so that both copies of
+// fieldmap.c can be linked into one program.
+#include "../../src/fieldmap.c"
+
+#pragma GCC visibility push(default)
+#include "scriptbench.h"
+
+#define SCRIPT_CAT_(a, b) a##b
+#define SCRIPT_CAT(a, b) SCRIPT_CAT_(a, b)
+#define SCRIPT_FUNC(name) SCRIPT_CAT(SCRIPT_PREFIX, name)
+
+static Location sLocation;
+static FieldSystem sFieldSystem = { .location = &sLocation };
+static ScriptContext *sContexts[SCRIPT_MAX_CONTEXTS];
+static u16 sIndices[SCRIPT_MAX_CONTEXTS];
+
+// sub_02053284, after MapMatrix_Load
+void SCRIPT_FUNC(Warp)(uint32_t mapNo) {
+    sLocation.mapId = mapNo;
+#ifdef OPTIMIZE_SCRIPT_BANK_PREFETCH
+    FieldSys_PrefetchMapScripts(mapNo);
+#endif //OPTIMIZE_SCRIPT_BANK_PREFETCH
+}
+
+// CreateScriptContext, up to the point where the bytecode starts running
+void SCRIPT_FUNC(Start)(int slot, uint16_t scriptId) {
+    ScriptContext *ctx;
+
+    GF_ASSERT(sContexts[slot] == NULL);
+    ctx = AllocFromHeap(HEAP_ID_FIELD, sizeof(ScriptContext));
+    MI_CpuFill8(ctx, 0, sizeof(ScriptContext));
+    ctx->fsys = &sFieldSystem;
+    sIndices[slot] = LoadScriptsAndMessagesByMapId(&sFieldSystem, ctx, scriptId);
+    sContexts[slot] = ctx;
+}
+
+void SCRIPT_FUNC(Get)(int slot, ScriptLoad *dest) {
+    ScriptContext *ctx = sContexts[slot];
+
+    dest->scripts = ctx->mapScripts;
+    dest->size = Script_GetMemberSize(ctx->mapScripts);
+    dest->index = sIndices[slot];
+    dest->msgBank = ctx->msgdata->file_id;
+#ifdef OPTIMIZE_SCRIPT_BANK_PREFETCH
+    dest->shared = ctx->mapScriptsShared;
+#else
+    dest->shared = FALSE;
+#endif //OPTIMIZE_SCRIPT_BANK_PREFETCH
+}
+
+void SCRIPT_FUNC(Stop)(int slot) {
+    DestroyScriptContext(sContexts[slot]);
+    sContexts[slot] = NULL;
+}
+
+// FieldSys_Delete
+void SCRIPT_FUNC(Close)(void) {
+#ifdef OPTIMIZE_SCRIPT_BANK_PREFETCH
+    FieldSys_FreeScriptPrefetch();
+#endif //OPTIMIZE_SCRIPT_BANK_PREFETCH
+}
+
+const void *SCRIPT_FUNC(GetPrefetch)(void) {
+#ifdef OPTIMIZE_SCRIPT_BANK_PREFETCH
+    return sScriptBankPrefetch.buffer;
+#else
+    return NULL;
+#endif //OPTIMIZE_SCRIPT_BANK_PREFETCH
+}
+#pragma GCC visibility pop
@@ -0,0 +1,319 @@
+#include "global.h"
+#include "filesystem.h"
+#include "heap.h"
+#include "map_header.h"
+#include "msgdata.h"
+#include "scriptbench.h"
+
+// The parts of heap.c, msgdata.c, map_header.c and the NitroSDK file system
+// that fieldmap.c and filesystem.c call. filesystem.c itself is built
+// unchanged, so every script bank is read through the same FS_OpenFile,
+// FS_SeekFile and FS_ReadFile calls as on the card; here they read the
+// scr_seq NARC the top-level build made. FS_ReadFileAsync only copies the
+// data in FS_WaitAsync, so a bank used before its read is finished shows up
+// as garbage.
+//
+// HEAP_ID_FIELD is modelled as one expanded heap: allocations from the front
+// take the lowest gap that fits and allocations from the end the highest, as
+// NNS_FndAllocFromExpHeapEx does, so the free blocks a sequence of warps and
+// scripts leaves behind are the ones the game would see.
+
+#define HOST_HEAP_MAX       0x100000
+#define HOST_MAX_BLOCKS     64
+
+typedef struct HostBlock {
+    u32 offset;
+    u32 size;
+    BOOL atEnd;
+    // The scr_seq member read into the block, if any
+    u32 memberOffset;
+    u32 memberSize;
+} HostBlock;
+
+typedef struct HostAsyncRead {
+    FSFile *file;
+    void *dst;
+    u32 pos;
+    s32 len;
+} HostAsyncRead;
+
+static const ScriptTables *sTables;
+static u8 sHeap[HOST_HEAP_MAX];
+static u32 sHeapSize;
+// Live blocks, sorted by offset
+static HostBlock sBlocks[HOST_MAX_BLOCKS];
+static int sNumBlocks;
+static HostAsyncRead sAsyncRead;
+static ScriptIo sIo;
+
+void Script_SetTables(const ScriptTables *tables) {
+    sTables = tables;
+}
+
+void Script_ResetHeap(uint32_t size) {
+    GF_ASSERT(size <= HOST_HEAP_MAX);
+    GF_ASSERT(sAsyncRead.file == NULL);
+    sHeapSize = size;
+    sNumBlocks = 0;
+    MI_CpuFill8(&sIo, 0, sizeof(ScriptIo));
+}
+
+void Script_GetIo(ScriptIo *io) {
+    u32 start = 0;
+    int i;
+
+    *io = sIo;
+    io->liveBlocks = sNumBlocks;
+    io->freeBlocks = 0;
+    io->largestFree = 0;
+    for (i = 0; i <= sNumBlocks; i++) {
+        u32 end = i < sNumBlocks ? sBlocks[i].offset : sHeapSize;
+        if (end > start) {
+            io->freeBlocks++;
+            if (end - start > io->largestFree) {
+                io->largestFree = end - start;
+            }
+        }
+        if (i < sNumBlocks) {
+            start = sBlocks[i].offset + sBlocks[i].size;
+        }
+    }
+}
+
+static int FindBlock(const void *ptr) {
+    u32 offset = (const u8 *)ptr - sHeap;
+    int i;
+
+    for (i = 0; i < sNumBlocks; i++) {
+        if (offset >= sBlocks[i].offset && offset < sBlocks[i].offset + sBlocks[i].size) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+int Script_FromHeapEnd(const void *ptr) {
+    int i = FindBlock(ptr);
+
+    return i >= 0 && sBlocks[i].atEnd;
+}
+
+uint32_t Script_GetMemberSize(const void *ptr) {
+    int i = FindBlock(ptr);
+
+    if (i < 0 || (const u8 *)ptr - sHeap != sBlocks[i].memberOffset) {
+        return 0;
+    }
+    return sBlocks[i].memberSize;
+}
+
+static void *HostHeap_Alloc(u32 size, BOOL atEnd) {
+    u32 start, end, offset = 0;
+    int i, slot = -1;
+
+    size = (size + 3) & ~3;
+    GF_ASSERT(sNumBlocks < HOST_MAX_BLOCKS);
+    // Gap i lies between block i - 1 and block i
+    for (i = 0; i <= sNumBlocks; i++) {
+        int gap = atEnd ? sNumBlocks - i : i;
+        start = gap > 0 ? sBlocks[gap - 1].offset + sBlocks[gap - 1].size : 0;
+        end = gap < sNumBlocks ? sBlocks[gap].offset : sHeapSize;
+        if (end - start >= size) {
+            slot = gap;
+            offset = atEnd ? end - size : start;
+            break;
+        }
+    }
+    GF_ASSERT(slot >= 0);
+
+    for (i = sNumBlocks; i > slot; i--) {
+        sBlocks[i] = sBlocks[i - 1];
+    }
+    sBlocks[slot].offset = offset;
+    sBlocks[slot].size = size;
+    sBlocks[slot].atEnd = atEnd;
+    sBlocks[slot].memberOffset = 0;
+    sBlocks[slot].memberSize = 0;
+    sNumBlocks++;
+    // Fresh blocks hold garbage, as the game's heap does
+    __builtin_memset(sHeap + offset, 0xA5, size);
+
+    end = 0;
+    for (i = 0; i < sNumBlocks; i++) {
+        end += sBlocks[i].size;
+    }
+    if (end > sIo.peakUsed) {
+        sIo.peakUsed = end;
+    }
+    return sHeap + offset;
+}
+
+void *AllocFromHeap(HeapID heap_id, u32 size) {
+    GF_ASSERT(heap_id == HEAP_ID_FIELD);
+    return HostHeap_Alloc(size, FALSE);
+}
+
+void *AllocFromHeapAtEnd(HeapID heap_id, u32 size) {
+    GF_ASSERT(heap_id == HEAP_ID_FIELD);
+    return HostHeap_Alloc(size, TRUE);
+}
+
+void FreeToHeap(void *ptr) {
+    u32 offset = (u8 *)ptr - sHeap;
+    int i;
+
+    for (i = 0; i < sNumBlocks; i++) {
+        if (sBlocks[i].offset == offset) {
+            break;
+        }
+    }
+    GF_ASSERT(i < sNumBlocks);
+    // Freeing a buffer the card is still writing to
+    GF_ASSERT(sAsyncRead.file == NULL || FindBlock(sAsyncRead.dst) != i);
+    for (; i < sNumBlocks - 1; i++) {
+        sBlocks[i] = sBlocks[i + 1];
+    }
+    sNumBlocks--;
+}
+
+void *Script_AllocFront(uint32_t size) {
+    return HostHeap_Alloc(size, FALSE);
+}
+
+void Script_Free(void *ptr) {
+    FreeToHeap(ptr);
+}
+
+// sNarcFileList names every archive a/X/Y/Z after its NarcId
+void FS_InitFile(FSFile *p_file) {
+    MI_CpuFill8(p_file, 0, sizeof(FSFile));
+}
+
+BOOL FS_OpenFile(FSFile *p_file, const char *path) {
+    u32 narcId;
+
+    GF_ASSERT(path[0] == 'a' && path[1] == '/' && path[3] == '/' && path[5] == '/' && path[7] == '\0');
+    narcId = (path[2] - '0') * 100 + (path[4] - '0') * 10 + (path[6] - '0');
+    GF_ASSERT(narcId == NARC_fielddata_script_scr_seq);
+    p_file->prop.file.own_id = narcId;
+    p_file->prop.file.top = 0;
+    p_file->prop.file.bottom = sTables->narcSize;
+    p_file->prop.file.pos = 0;
+    return TRUE;
+}
+
+BOOL FS_CloseFile(FSFile *p_file) {
+    GF_ASSERT(sAsyncRead.file != p_file);
+    p_file->prop.file.own_id = 0;
+    return TRUE;
+}
+
+BOOL FS_SeekFile(FSFile *p_file, s32 offset, FSSeekFileMode origin) {
+    GF_ASSERT(origin == FS_SEEK_SET);
+    GF_ASSERT(offset >= 0 && (u32)offset <= p_file->prop.file.bottom);
+    p_file->prop.file.pos = offset;
+    return TRUE;
+}
+
+// Whether LEN bytes at POS are a whole member of the archive, so that
+// Script_GetMemberSize can tell how much of the destination to compare
+static BOOL IsWholeMember(u32 pos, s32 len) {
+    const u8 *narc = sTables->narc;
+    u32 btafStart = narc[12] | (narc[13] << 8);
+    u32 btafSize = narc[btafStart + 4] | (narc[btafStart + 5] << 8) | (narc[btafStart + 6] << 16) | (narc[btafStart + 7] << 24);
+    u32 numFiles = narc[btafStart + 8] | (narc[btafStart + 9] << 8);
+    u32 btnfStart = btafStart + btafSize;
+    u32 btnfSize = narc[btnfStart + 4] | (narc[btnfStart + 5] << 8) | (narc[btnfStart + 6] << 16) | (narc[btnfStart + 7] << 24);
+    u32 image = btnfStart + btnfSize + 8;
+    u32 i;
+
+    for (i = 0; i < numFiles; i++) {
+        const u8 *entry = narc + btafStart + 12 + 8 * i;
+        u32 start = entry[0] | (entry[1] << 8) | (entry[2] << 16) | (entry[3] << 24);
+        u32 end = entry[4] | (entry[5] << 8) | (entry[6] << 16) | (entry[7] << 24);
+        if (image + start == pos && end - start == (u32)len) {
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
+
+static void CountRead(void *dst, u32 pos, s32 len) {
+    int i = FindBlock(dst);
+
+    sIo.reads++;
+    sIo.bytesRead += len;
+    if (i >= 0 && IsWholeMember(pos, len)) {
+        sBlocks[i].memberOffset = (u8 *)dst - sHeap;
+        sBlocks[i].memberSize = len;
+        if (!sBlocks[i].atEnd) {
+            sIo.frontBytes += len;
+        }
+    }
+}
+
+int FS_ReadFile(FSFile *p_file, void *dst, s32 len) {
+    GF_ASSERT(sAsyncRead.file != p_file);
+    GF_ASSERT(len >= 0 && p_file->prop.file.pos + len <= p_file->prop.file.bottom);
+    __builtin_memcpy(dst, sTables->narc + p_file->prop.file.pos, len);
+    CountRead(dst, p_file->prop.file.pos, len);
+    p_file->prop.file.pos += len;
+    return len;
+}
+
+int FS_ReadFileAsync(FSFile *p_file, void *dst, s32 len) {
+    GF_ASSERT(sAsyncRead.file == NULL);
+    GF_ASSERT(len >= 0 && p_file->prop.file.pos + len <= p_file->prop.file.bottom);
+    sAsyncRead.file = p_file;
+    sAsyncRead.dst = dst;
+    sAsyncRead.pos = p_file->prop.file.pos;
+    sAsyncRead.len = len;
+    CountRead(dst, sAsyncRead.pos, len);
+    sIo.asyncReads++;
+    p_file->prop.file.pos += len;
+    return len;
+}
+
+BOOL FS_WaitAsync(FSFile *p_file) {
+    if (sAsyncRead.file == p_file) {
+        __builtin_memcpy(sAsyncRead.dst, sTables->narc + sAsyncRead.pos, sAsyncRead.len);
+        sAsyncRead.file = NULL;
+    }
+    return TRUE;
+}
+
+// The lazy MSGDATA and the NARC it keeps open, without reading anything
+MSGDATA *NewMsgDataFromNarc(MsgDataLoadType type, NarcId narc, s32 fileId, HeapID heap_id) {
+    MSGDATA *msgData = AllocFromHeap(heap_id, sizeof(MSGDATA));
+
+    GF_ASSERT(type == MSGDATA_LOAD_LAZY && narc == NARC_msgdata_msg);
+    msgData->type = type;
+    msgData->heap_id = heap_id;
+    msgData->narc_id = narc;
+    msgData->file_id = fileId;
+    msgData->lazy = AllocFromHeap(heap_id, sizeof(NARC));
+    return msgData;
+}
+
+void DestroyMsgData(MSGDATA *msgData) {
+    FreeToHeap(msgData->lazy);
+    FreeToHeap(msgData);
+}
+
+u16 MapHeader_GetScriptsBank(u32 map_no) {
+    GF_ASSERT(map_no < (u32)sTables->numMaps);
+    return sTables->scriptBanks[map_no];
+}
+
+u16 MapHeader_GetMsgBank(u32 map_no) {
+    GF_ASSERT(map_no < (u32)sTables->numMaps);
+    return sTables->msgBanks[map_no];
+}
+
+void MI_CpuCopy8(const void *src, void *dest, u32 size) {
+    __builtin_memcpy(dest, src, size);
+}
+
+void MI_CpuFill8(void *dest, u8 data, u32 size) {
+    __builtin_memset(dest, data, size);
+}
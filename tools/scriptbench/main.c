@@ -0,0 +1,715 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stdnoreturn.h>
+#include <stdarg.h>
+#include <ctype.h>
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
+#include "scriptbench.h"
+
+// Where the tables are read from, relative to the repository root
+#define NARC_PATH           "files/fielddata/script/scr_seq.narc"
+#define MAPS_PATH           "include/constants/maps.h"
+#define MAP_HEADERS_PATH    "src/data/map_headers.h"
+
+#define MAX_MAPS            1024
+#define MAX_NAME            32
+
+// Script numbers as the game hands them to LoadScriptsAndMessagesByMapId:
+// below _std_misc they are the map's own, numbered from 1; 0 is the empty
+// script; the rest are shared banks
+#define STD_SCRIPT_FIRST    2000    // _std_misc
+#define STD_SCRIPT_END      11000   // past _std_scratch_card
+#define MAP_SCRIPTS_USED    8
+
+#define DEFAULT_VISITS      20000
+#define DEFAULT_SCRIPTS     3
+#define DEFAULT_SEED        1
+#define DEFAULT_HEAP_SIZE   0x1C000 // CreateHeap(3, HEAP_ID_FIELD, ...) in field_system.c
+#define DEFAULT_MAP_ALLOC   0x8000
+#define DEFAULT_OPEN_US     200.0
+#define DEFAULT_CARD_MBPS   4.0
+
+typedef struct GameData
+{
+    uint8_t * narc;
+    uint32_t narcSize;
+    int numMaps;
+    char mapNames[MAX_MAPS][MAX_NAME];
+    uint16_t scriptBanks[MAX_MAPS];
+    uint16_t msgBanks[MAX_MAPS];
+} GameData;
+
+typedef struct Variant
+{
+    const char * name;
+    void (*warp)(uint32_t mapNo);
+    void (*start)(int slot, uint16_t scriptId);
+    void (*get)(int slot, ScriptLoad * dest);
+    void (*stop)(int slot);
+    void (*close)(void);
+    const void * (*getPrefetch)(void);
+} Variant;
+
+typedef struct StormConfig
+{
+    uint32_t visits;
+    uint32_t scripts;
+    uint32_t seed;
+    uint32_t heapSize;
+    uint32_t mapAlloc;
+    double openUs;
+    double cardMBps;
+} StormConfig;
+
+// What happens on one visit to a map: the scripts started there, in order,
+// and whether the last of them is still running when the player warps out
+typedef struct Visit
+{
+    uint32_t mapNo;
+    uint16_t scriptIds[SCRIPT_MAX_CONTEXTS];
+    uint32_t numScripts;
+    bool nested;   // the second script starts before the first ends
+    bool carried;  // the last script ends after the next warp
+} Visit;
+
+typedef struct StormResult
+{
+    uint32_t starts;
+    uint32_t shared;
+    uint32_t startReads;      // card reads made while a script was starting
+    uint32_t startBytes;
+    ScriptIo io;
+    uint32_t misplaced;       // prefetched banks not at the heap end
+    uint32_t minLargestFree;
+    uint32_t maxFreeBlocks;
+    double seconds;
+} StormResult;
+
+static const Variant kVariants[] = {
+    { "shipped", ScriptBase_Warp, ScriptBase_Start, ScriptBase_Get, ScriptBase_Stop, ScriptBase_Close, ScriptBase_GetPrefetch },
+    { "prefetch", ScriptPrefetch_Warp, ScriptPrefetch_Start, ScriptPrefetch_Get, ScriptPrefetch_Stop, ScriptPrefetch_Close, ScriptPrefetch_GetPrefetch },
+};
+
+static GameData sData;
+
+static inline noreturn __attribute__((format(printf, 1, 2))) void fatal_error(const char * message, ...)
+{
+    va_list va_args;
+    va_start(va_args, message);
+    fputs("Error: ", stderr);
+    vfprintf(stderr, message, va_args);
+    fputc('\n', stderr);
+    va_end(va_args);
+    exit(EXIT_FAILURE);
+}
+
+// GF_ASSERT in the game objects, which are built with PM_KEEP_ASSERTS
+void GF_AssertFail(void)
+{
+    fatal_error("GF_ASSERT failed in the game code");
+}
+
+static uint32_t ParseU32(const char * arg)
+{
+    char * end;
+    unsigned long long val = strtoull(arg, &end, 0);
+    if (*arg == '\0' || *end != '\0' || val > 0xFFFFFFFFull)
+    {
+        fatal_error("invalid number: %s", arg);
+    }
+    return (uint32_t)val;
+}
+
+static double ParseDouble(const char * arg)
+{
+    char * end;
+    double val = strtod(arg, &end);
+    if (*arg == '\0' || *end != '\0' || !(val > 0))
+    {
+        fatal_error("invalid number: %s", arg);
+    }
+    return val;
+}
+
+static double Now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static uint32_t Random(uint32_t * state)
+{
+    uint32_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return *state = x;
+}
+
+// ---------------------------------------------------------------------------
+// Game data
+
+static void * ReadWholeFile(const char * root, const char * relPath, size_t * size)
+{
+    char path[4096];
+    snprintf(path, sizeof(path), "%s/%s", root, relPath);
+    FILE * file = fopen(path, "rb");
+    if (file == NULL)
+    {
+        fatal_error("%s: %s", path, strerror(errno));
+    }
+    fseek(file, 0, SEEK_END);
+    long length = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    uint8_t * buffer = malloc(length + 1);
+    if (buffer == NULL)
+    {
+        fatal_error("out of memory reading %s", path);
+    }
+    if (fread(buffer, 1, length, file) != (size_t)length)
+    {
+        fatal_error("%s: short read", path);
+    }
+    fclose(file);
+    buffer[length] = '\0';
+    *size = length;
+    return buffer;
+}
+
+static const char * FindRoot(void)
+{
+    static const char * const candidates[] = { ".", "..", "../.." };
+    for (size_t i = 0; i < sizeof(candidates) / sizeof(candidates[0]); i++)
+    {
+        char path[4096];
+        snprintf(path, sizeof(path), "%s/%s", candidates[i], MAP_HEADERS_PATH);
+        if (access(path, R_OK) == 0)
+        {
+            return candidates[i];
+        }
+    }
+    return NULL;
+}
+
+static void LoadNarc(const char * root)
+{
+    size_t size;
+    sData.narc = ReadWholeFile(root, NARC_PATH, &size);
+    sData.narcSize = size;
+    if (size < 16 || memcmp(sData.narc, "NARC", 4) != 0)
+    {
+        fatal_error("%s: not a NARC", NARC_PATH);
+    }
+}
+
+static int FindMap(const char * name)
+{
+    for (int i = 0; i < sData.numMaps; i++)
+    {
+        if (strcmp(sData.mapNames[i], name) == 0)
+        {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static void LoadMaps(const char * root)
+{
+    size_t size;
+    char * text = ReadWholeFile(root, MAPS_PATH, &size);
+    char * line = text;
+
+    while (line != NULL && *line != '\0')
+    {
+        char * next = strchr(line, '\n');
+        char name[MAX_NAME + 8];
+        int value;
+        if (sscanf(line, "#define MAP_%39s %d", name, &value) == 2 && value >= 0 && value < MAX_MAPS && strlen(name) < MAX_NAME)
+        {
+            strcpy(sData.mapNames[value], name);
+            if (value >= sData.numMaps)
+            {
+                sData.numMaps = value + 1;
+            }
+        }
+        line = next != NULL ? next + 1 : NULL;
+    }
+    free(text);
+
+    // [MAP_NAME] = { ... .scripts_bank = NARC_scr_seq_scr_seq_NNNN_..., ...
+    //                    .msg_bank = NARC_msg_msg_NNNN_..., ... }
+    text = ReadWholeFile(root, MAP_HEADERS_PATH, &size);
+    int map = -1;
+    int numFound = 0;
+    bool haveScripts = false;
+    for (line = text; line != NULL && *line != '\0';)
+    {
+        char * next = strchr(line, '\n');
+        char name[MAX_NAME + 8];
+        int bank;
+        while (isspace((unsigned char)*line))
+        {
+            line++;
+        }
+        if (sscanf(line, "[MAP_%39[A-Z0-9_]]", name) == 1)
+        {
+            map = FindMap(name);
+            haveScripts = false;
+            if (map < 0)
+            {
+                fatal_error("%s: unknown map MAP_%s", MAP_HEADERS_PATH, name);
+            }
+        }
+        else if (sscanf(line, ".scripts_bank = NARC_scr_seq_scr_seq_%4d", &bank) == 1 && map >= 0)
+        {
+            sData.scriptBanks[map] = bank;
+            haveScripts = true;
+        }
+        else if (sscanf(line, ".msg_bank = NARC_msg_msg_%4d", &bank) == 1 && map >= 0 && haveScripts)
+        {
+            sData.msgBanks[map] = bank;
+            numFound++;
+            map = -1;
+        }
+        line = next != NULL ? next + 1 : NULL;
+    }
+    free(text);
+    if (numFound != sData.numMaps)
+    {
+        fatal_error("%s: found %d of %d maps", MAP_HEADERS_PATH, numFound, sData.numMaps);
+    }
+}
+
+static void LoadGameData(const char * root)
+{
+    static ScriptTables tables;
+
+    LoadNarc(root);
+    LoadMaps(root);
+    tables.narc = sData.narc;
+    tables.narcSize = sData.narcSize;
+    tables.numMaps = sData.numMaps;
+    tables.scriptBanks = sData.scriptBanks;
+    tables.msgBanks = sData.msgBanks;
+    Script_SetTables(&tables);
+}
+
+// ---------------------------------------------------------------------------
+// Storms
+
+// Mostly the map's own scripts, as people are talked to and signs read, with
+// a shared script now and then
+static uint16_t RandomScript(uint32_t * state)
+{
+    if (Random(state) % 4 != 0)
+    {
+        return 1 + Random(state) % MAP_SCRIPTS_USED;
+    }
+    return STD_SCRIPT_FIRST + Random(state) % (STD_SCRIPT_END - STD_SCRIPT_FIRST);
+}
+
+static Visit * MakeStorm(const StormConfig * config)
+{
+    Visit * visits = calloc(config->visits, sizeof(Visit));
+    uint32_t state = config->seed ? config->seed : 1;
+    if (visits == NULL)
+    {
+        fatal_error("out of memory");
+    }
+    for (uint32_t i = 0; i < config->visits; i++)
+    {
+        Visit * visit = &visits[i];
+        visit->mapNo = Random(&state) % sData.numMaps;
+        visit->numScripts = config->scripts;
+        for (uint32_t j = 0; j < visit->numScripts; j++)
+        {
+            visit->scriptIds[j] = RandomScript(&state);
+        }
+        visit->nested = visit->numScripts >= 2 && Random(&state) % 4 == 0;
+        visit->carried = visit->numScripts >= 1 && Random(&state) % 8 == 0;
+    }
+    return visits;
+}
+
+static void CountStart(const Variant * variant, int slot, StormResult * result)
+{
+    ScriptLoad load;
+
+    variant->get(slot, &load);
+    result->starts++;
+    result->shared += load.shared;
+}
+
+// Plays VISITS through one variant: on each map the field takes its own
+// memory from the heap front, then the scripts run one after another, or the
+// first two at once, and the last may still be running at the next warp
+static void RunStorm(const Variant * variant, const StormConfig * config, const Visit * visits, StormResult * result)
+{
+    void * mapAlloc = NULL;
+    int carriedSlot = -1;
+    ScriptIo before, after;
+
+    Script_ResetHeap(config->heapSize);
+    memset(result, 0, sizeof(*result));
+    result->minLargestFree = config->heapSize;
+
+    double start = Now();
+    for (uint32_t i = 0; i < config->visits; i++)
+    {
+        const Visit * visit = &visits[i];
+        if (mapAlloc != NULL)
+        {
+            Script_Free(mapAlloc);
+            mapAlloc = NULL;
+        }
+        variant->warp(visit->mapNo);
+        if (variant->getPrefetch() != NULL && !Script_FromHeapEnd(variant->getPrefetch()))
+        {
+            result->misplaced++;
+        }
+        if (carriedSlot >= 0)
+        {
+            variant->stop(carriedSlot);
+            carriedSlot = -1;
+        }
+        if (config->mapAlloc != 0)
+        {
+            mapAlloc = Script_AllocFront(config->mapAlloc);
+        }
+        for (uint32_t j = 0; j < visit->numScripts; j++)
+        {
+            int slot = visit->nested && j == 1 ? 1 : 0;
+            Script_GetIo(&before);
+            variant->start(slot, visit->scriptIds[j]);
+            Script_GetIo(&after);
+            result->startReads += after.reads - before.reads;
+            result->startBytes += after.bytesRead - before.bytesRead;
+            CountStart(variant, slot, result);
+            if (after.largestFree < result->minLargestFree)
+            {
+                result->minLargestFree = after.largestFree;
+            }
+            if (after.freeBlocks > result->maxFreeBlocks)
+            {
+                result->maxFreeBlocks = after.freeBlocks;
+            }
+            if (visit->nested && j == 0)
+            {
+                continue;
+            }
+            if (visit->nested && j == 1)
+            {
+                variant->stop(0);
+            }
+            if (visit->carried && j == visit->numScripts - 1)
+            {
+                carriedSlot = slot;
+            }
+            else
+            {
+                variant->stop(slot);
+            }
+        }
+    }
+    if (carriedSlot >= 0)
+    {
+        variant->stop(carriedSlot);
+    }
+    if (mapAlloc != NULL)
+    {
+        Script_Free(mapAlloc);
+    }
+    variant->close();
+    result->seconds = Now() - start;
+    Script_GetIo(&result->io);
+}
+
+static double CardMs(const StormConfig * config, uint32_t reads, uint32_t bytes)
+{
+    return (reads * config->openUs + bytes / config->cardMBps) / 1000.0;
+}
+
+static int CommandStorm(const StormConfig * config)
+{
+    Visit * visits = MakeStorm(config);
+    StormResult results[2];
+
+    printf("%u map visits, %u scripts each, seed %u\n", config->visits, config->scripts, config->seed);
+    printf("field heap 0x%X, 0x%X of it per map; card modelled at %.0f us per read and %.1f MB/s\n\n",
+           config->heapSize, config->mapAlloc, config->openUs, config->cardMBps);
+    printf("%-10s %8s %10s %12s %12s %10s %12s %11s\n",
+           "", "starts", "shared", "start reads", "start ms", "host us", "min free", "max holes");
+    for (int v = 0; v < 2; v++)
+    {
+        RunStorm(&kVariants[v], config, visits, &results[v]);
+        const StormResult * r = &results[v];
+        printf("%-10s %8u %10u %12u %12.1f %10.1f %#12x %11u\n",
+               kVariants[v].name, r->starts, r->shared, r->startReads, CardMs(config, r->startReads, r->startBytes),
+               r->seconds * 1e6, r->minLargestFree, r->maxFreeBlocks);
+        if (r->io.liveBlocks != 0)
+        {
+            fatal_error("%s: %u blocks still allocated after FieldSys_Delete", kVariants[v].name, r->io.liveBlocks);
+        }
+    }
+    printf("\ncard time at script start saved: %.1f%%\n",
+           100.0 * (1.0 - CardMs(config, results[1].startReads, results[1].startBytes) / CardMs(config, results[0].startReads, results[0].startBytes)));
+    free(visits);
+    return EXIT_SUCCESS;
+}
+
+// ---------------------------------------------------------------------------
+// Self-test
+
+// Both variants must hand the script the same bank, bytes, index and
+// messages
+static bool SameLoad(int slot)
+{
+    ScriptLoad base, prefetch;
+    ScriptBase_Get(slot, &base);
+    ScriptPrefetch_Get(slot, &prefetch);
+    return base.size != 0
+        && base.size == prefetch.size
+        && base.index == prefetch.index
+        && base.msgBank == prefetch.msgBank
+        && memcmp(base.scripts, prefetch.scripts, base.size) == 0;
+}
+
+static void StartBoth(int slot, uint16_t scriptId)
+{
+    ScriptBase_Start(slot, scriptId);
+    ScriptPrefetch_Start(slot, scriptId);
+}
+
+static void StopBoth(int slot)
+{
+    ScriptBase_Stop(slot);
+    ScriptPrefetch_Stop(slot);
+}
+
+// Runs both variants side by side through the visits and checks that every
+// script starts from the same bytes
+static int CheckEquivalence(const char * name, const Visit * visits, uint32_t numVisits)
+{
+    int failures = 0;
+    int carriedSlot = -1;
+    uint32_t starts = 0;
+
+    Script_ResetHeap(0x100000);
+    for (uint32_t i = 0; i < numVisits; i++)
+    {
+        const Visit * visit = &visits[i];
+        ScriptBase_Warp(visit->mapNo);
+        ScriptPrefetch_Warp(visit->mapNo);
+        if (carriedSlot >= 0)
+        {
+            StopBoth(carriedSlot);
+            carriedSlot = -1;
+        }
+        for (uint32_t j = 0; j < visit->numScripts; j++)
+        {
+            int slot = visit->nested && j == 1 ? 1 : 0;
+            StartBoth(slot, visit->scriptIds[j]);
+            starts++;
+            if (!SameLoad(slot) && failures++ < 5)
+            {
+                printf("  MAP_%s, script %u: loads differ\n", sData.mapNames[visit->mapNo], visit->scriptIds[j]);
+            }
+            if (visit->nested && j == 0)
+            {
+                continue;
+            }
+            if (visit->nested && j == 1)
+            {
+                StopBoth(0);
+            }
+            if (visit->carried && j == visit->numScripts - 1)
+            {
+                carriedSlot = slot;
+            }
+            else
+            {
+                StopBoth(slot);
+            }
+        }
+    }
+    if (carriedSlot >= 0)
+    {
+        StopBoth(carriedSlot);
+    }
+    ScriptBase_Close();
+    ScriptPrefetch_Close();
+
+    ScriptIo io;
+    Script_GetIo(&io);
+    bool leaked = io.liveBlocks != 0;
+    printf("%s: %u visits, %u script starts, %s%s\n", name, numVisits, starts,
+           failures ? "MISMATCH" : "same",
+           leaked ? ", LEAKED" : "");
+    return failures + leaked;
+}
+
+static int CommandSelfTest(void)
+{
+    int failed = 0;
+    uint32_t numMaps = sData.numMaps;
+    Visit * visits = calloc(numMaps, sizeof(Visit));
+    if (visits == NULL)
+    {
+        fatal_error("out of memory");
+    }
+
+    // Every map with its first script, the empty script and a shared one
+    for (uint32_t i = 0; i < numMaps; i++)
+    {
+        visits[i].mapNo = i;
+        visits[i].numScripts = 3;
+        visits[i].scriptIds[0] = 1;
+        visits[i].scriptIds[1] = 0;
+        visits[i].scriptIds[2] = STD_SCRIPT_FIRST + i * 7 % (STD_SCRIPT_END - STD_SCRIPT_FIRST);
+        visits[i].nested = i % 3 == 0;
+        visits[i].carried = i % 5 == 0;
+    }
+    failed += CheckEquivalence("every map", visits, numMaps) != 0;
+    free(visits);
+
+    StormConfig config = {
+        .visits = 4000, .scripts = DEFAULT_SCRIPTS, .seed = 0x5EED, .heapSize = DEFAULT_HEAP_SIZE,
+        .mapAlloc = DEFAULT_MAP_ALLOC, .openUs = DEFAULT_OPEN_US, .cardMBps = DEFAULT_CARD_MBPS,
+    };
+    visits = MakeStorm(&config);
+    failed += CheckEquivalence("storm", visits, config.visits) != 0;
+
+    // The prefetch must serve the map's own scripts, block on the card less
+    // at script start, keep its bank at the heap end and give back
+    // everything it took
+    StormResult base, prefetch;
+    RunStorm(&kVariants[0], &config, visits, &base);
+    RunStorm(&kVariants[1], &config, visits, &prefetch);
+    bool served = prefetch.shared > prefetch.starts / 2 && base.shared == 0;
+    double baseMs = CardMs(&config, base.startReads, base.startBytes);
+    double prefetchMs = CardMs(&config, prefetch.startReads, prefetch.startBytes);
+    bool fewer = prefetchMs < baseMs / 2;
+    bool atEnd = prefetch.misplaced == 0;
+    bool freed = base.io.liveBlocks == 0 && prefetch.io.liveBlocks == 0;
+    printf("storm: %u of %u script starts served by the prefetch%s\n", prefetch.shared, prefetch.starts, served ? "" : ", TOO FEW");
+    printf("storm: %.1f ms on the card at script start as shipped, %.1f prefetched%s\n", baseMs, prefetchMs, fewer ? "" : ", NOT HALVED");
+    printf("storm: %u prefetched banks away from the heap end%s\n", prefetch.misplaced, atEnd ? "" : ", WRONG END");
+    printf("storm: heap %s after FieldSys_Delete\n", freed ? "empty" : "NOT EMPTY");
+    failed += !served + !fewer + !atEnd + !freed;
+    free(visits);
+
+    printf("%d checks failed\n", failed);
+    return failed == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+// ---------------------------------------------------------------------------
+
+static noreturn void Usage(const char * prog)
+{
+    fprintf(stderr,
+        "Usage: %s COMMAND [options]\n"
+        "Runs the script loading in src/fieldmap.c on the host, with and\n"
+        "without OPTIMIZE_SCRIPT_BANK_PREFETCH, over the scr_seq NARC.\n"
+        "Commands:\n"
+        "  storm                 visit maps and start scripts on them, and\n"
+        "                        compare card reads at script start and field\n"
+        "                        heap fragmentation\n"
+        "  selftest              check that both builds start every script from\n"
+        "                        the same bytes and that the prefetch blocks\n"
+        "                        less, from the heap end, without leaking\n"
+        "Options:\n"
+        "  --visits N            map visits in the storm (default %d)\n"
+        "  --scripts N           scripts started per visit, up to %d\n"
+        "                        (default %d)\n"
+        "  --seed N              storm seed\n"
+        "  --heap N              field heap size (default %#x)\n"
+        "  --map-alloc N         bytes the field takes from the heap front for\n"
+        "                        each map (default %#x)\n"
+        "  --open-us X           modelled cost of a card read (default %g)\n"
+        "  --card-mbps X         modelled card throughput (default %g)\n",
+        prog, DEFAULT_VISITS, SCRIPT_MAX_CONTEXTS, DEFAULT_SCRIPTS, DEFAULT_HEAP_SIZE, DEFAULT_MAP_ALLOC,
+        DEFAULT_OPEN_US, DEFAULT_CARD_MBPS);
+    exit(EXIT_FAILURE);
+}
+
+int main(int argc, char ** argv)
+{
+    if (argc < 2)
+    {
+        Usage(argv[0]);
+    }
+    const char * command = argv[1];
+    StormConfig config = {
+        .visits = DEFAULT_VISITS, .scripts = DEFAULT_SCRIPTS, .seed = DEFAULT_SEED, .heapSize = DEFAULT_HEAP_SIZE,
+        .mapAlloc = DEFAULT_MAP_ALLOC, .openUs = DEFAULT_OPEN_US, .cardMBps = DEFAULT_CARD_MBPS,
+    };
+
+    for (int i = 2; i < argc; i++)
+    {
+        const char * opt = argv[i];
+        if (i + 1 >= argc)
+        {
+            Usage(argv[0]);
+        }
+        if (strcmp(opt, "--visits") == 0)
+        {
+            config.visits = ParseU32(argv[++i]);
+        }
+        else if (strcmp(opt, "--scripts") == 0)
+        {
+            config.scripts = ParseU32(argv[++i]);
+        }
+        else if (strcmp(opt, "--seed") == 0)
+        {
+            config.seed = ParseU32(argv[++i]);
+        }
+        else if (strcmp(opt, "--heap") == 0)
+        {
+            config.heapSize = ParseU32(argv[++i]);
+        }
+        else if (strcmp(opt, "--map-alloc") == 0)
+        {
+            config.mapAlloc = ParseU32(argv[++i]);
+        }
+        else if (strcmp(opt, "--open-us") == 0)
+        {
+            config.openUs = ParseDouble(argv[++i]);
+        }
+        else if (strcmp(opt, "--card-mbps") == 0)
+        {
+            config.cardMBps = ParseDouble(argv[++i]);
+        }
+        else
+        {
+            Usage(argv[0]);
+        }
+    }
+    if (config.visits == 0 || config.scripts == 0 || config.scripts > SCRIPT_MAX_CONTEXTS)
+    {
+        Usage(argv[0]);
+    }
+
+    const char * root = FindRoot();
+    if (root == NULL)
+    {
+        fatal_error("run scriptbench from the repository or tools/scriptbench");
+    }
+    LoadGameData(root);
+
+    if (strcmp(command, "storm") == 0)
+    {
+        return CommandStorm(&config);
+    }
+    if (strcmp(command, "selftest") == 0)
+    {
+        return CommandSelfTest();
+    }
+    Usage(argv[0]);
+}
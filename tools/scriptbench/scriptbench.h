@@ -0,0 +1,74 @@
+#ifndef GUARD_SCRIPTBENCH_SCRIPTBENCH_H
+#define GUARD_SCRIPTBENCH_SCRIPTBENCH_H
+
+// The boundary between the host side (main.c) and the objects built from the
+// game's sources (game.c, hostfs.c and src/). Plain C types only, so that
+// both sides can include it with their own headers.
+
+#include <stdint.h>
+
+#define SCRIPT_MAX_CONTEXTS 3 // ScriptEnvironment.scriptContexts
+
+// What the stand-ins for the file system and map_header.c read instead of
+// the ROM. The host owns the memory; it must outlive every call below.
+typedef struct ScriptTables
+{
+    const uint8_t * narc;        // scr_seq.narc, the whole archive image
+    uint32_t narcSize;
+    int numMaps;
+    const uint16_t * scriptBanks; // sMapHeaders[map].scripts_bank
+    const uint16_t * msgBanks;    // sMapHeaders[map].msg_bank
+} ScriptTables;
+
+// HEAP_ID_FIELD and the card, as seen by the game code
+typedef struct ScriptIo
+{
+    uint32_t reads;           // FS_ReadFile and FS_ReadFileAsync calls
+    uint32_t bytesRead;
+    uint32_t asyncReads;
+    uint32_t frontBytes;      // whole banks read into blocks from the heap front
+    uint32_t liveBlocks;
+    uint32_t freeBlocks;      // holes between live blocks, and the two ends
+    uint32_t largestFree;
+    uint32_t peakUsed;
+} ScriptIo;
+
+// What LoadScriptsAndMessagesByMapId left in a script context
+typedef struct ScriptLoad
+{
+    const uint8_t * scripts;  // ctx->mapScripts
+    uint32_t size;            // of the member it holds, from the NARC
+    uint16_t index;           // the script within the bank
+    uint16_t msgBank;
+    uint8_t shared;           // read from the prefetched bank
+} ScriptLoad;
+
+void Script_SetTables(const ScriptTables * tables);
+// Empties HEAP_ID_FIELD, gives it SIZE bytes and clears the counters
+void Script_ResetHeap(uint32_t size);
+void Script_GetIo(ScriptIo * io);
+// Whether PTR lies inside a live block taken from the heap end
+int Script_FromHeapEnd(const void * ptr);
+// The size of the scr_seq member that starts at PTR, or 0
+uint32_t Script_GetMemberSize(const void * ptr);
+// Stand-ins for the field's own allocations, which live for one map
+void * Script_AllocFront(uint32_t size);
+void Script_Free(void * ptr);
+
+// fieldmap.c is built twice, as it ships (ScriptBase_) and with
+// OPTIMIZE_SCRIPT_BANK_PREFETCH (ScriptPrefetch_). Warp is what the warp
+// task does on arriving at MAPNO; Start and Stop are CreateScriptContext and
+// DestroyScriptContext in context SLOT; Close is FieldSys_Delete.
+#define SCRIPT_DECLARE_VARIANT(prefix)                                       \
+    void prefix##Warp(uint32_t mapNo);                                       \
+    void prefix##Start(int slot, uint16_t scriptId);                         \
+    void prefix##Get(int slot, ScriptLoad * dest);                           \
+    void prefix##Stop(int slot);                                             \
+    void prefix##Close(void);                                                \
+    /* The prefetched bank, or NULL without the prefetch */                  \
+    const void * prefix##GetPrefetch(void);
+
+SCRIPT_DECLARE_VARIANT(ScriptBase_)
+SCRIPT_DECLARE_VARIANT(ScriptPrefetch_)
+
+#endif //GUARD_SCRIPTBENCH_SCRIPTBENCH_H
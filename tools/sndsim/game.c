@@ -0,0 +1,69 @@
+// sound.c as the game builds it, with or without
+// OPTIMIZE_SOUND_HEAP_RESIDENCY. The Makefile compiles this file once per
+// variant with SND_PREFIX set and hides everything but the functions below,
+// so that both copies of sound.c, and of sSoundWork, can be linked into one
+// program.
+#include "../../src/sound.c"
+
+#pragma GCC visibility push(default)
+#include "sndsim.h"
+
+#define SND_CAT_(a, b) a##b
+#define SND_CAT(a, b) SND_CAT_(a, b)
+#define SND_FUNC(name) SND_CAT(SND_PREFIX, name)
+
+void SND_FUNC(Init)(void) {
+    static OPTIONS options;
+
+    InitSoundData(NULL, &options);
+}
+
+void SND_FUNC(Frame)(void) {
+    DoSoundUpdateFrame();
+}
+
+void SND_FUNC(SaveState)(int slot) {
+    GF_Snd_SaveState(&GetSoundDataPointer()->stateSaveDepth[slot]);
+}
+
+void SND_FUNC(LoadState)(int slot) {
+    GF_Snd_LoadState(GetSoundDataPointer()->stateSaveDepth[slot]);
+}
+
+int SND_FUNC(Load)(int type, int no, uint32_t loadFlag) {
+    switch (type) {
+    case SND_FILE_GROUP:
+        return GF_Snd_LoadGroup(no);
+    case SND_FILE_SEQ:
+        return GF_Snd_LoadSeq(no);
+    case SND_FILE_SEQ_EX:
+        return GF_Snd_LoadSeqEx(no, loadFlag);
+    case SND_FILE_BANK:
+        return GF_Snd_LoadBank(no);
+    case SND_FILE_WAVE_ARC:
+        return GF_Snd_LoadWaveArc(no);
+    }
+    GF_ASSERT(FALSE);
+    return FALSE;
+}
+
+int SND_FUNC(StartSeq)(int seqNo) {
+    return Snd_IsSeqLoaded(GetSoundDataPointer()->heap, seqNo);
+}
+
+const void *SND_FUNC(Heap)(void) {
+    return GetSoundDataPointer()->heap;
+}
+
+void SND_FUNC(GetPlannerStats)(SndPlannerStats *stats) {
+#ifdef OPTIMIZE_SOUND_HEAP_RESIDENCY
+    stats->loads = sSndHeapPlanner.loads;
+    stats->skips = sSndHeapPlanner.skips;
+    stats->keptStates = sSndHeapPlanner.keptStates;
+    stats->pendingLevel = sSndHeapPlanner.pendingLevel;
+#else
+    MI_CpuClear8(stats, sizeof(SndPlannerStats));
+    stats->pendingLevel = -1;
+#endif //OPTIMIZE_SOUND_HEAP_RESIDENCY
+}
+#pragma GCC visibility pop
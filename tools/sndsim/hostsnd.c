@@ -0,0 +1,367 @@
+#include "global.h"
+#include "options.h"
+#include "sound.h"
+#include "sound_02004A44.h"
+#include "sound_chatot.h"
+#include "sound_radio.h"
+#include "system.h"
+#include "sndsim.h"
+
+// The parts of the NitroSystem sound library that sound.c reaches, and the
+// few game functions DoSoundUpdateFrame calls. The heap keeps a stack of
+// sections the way NNS_SndHeapSaveState and NNS_SndHeapLoadState do: a
+// restore to level L frees every block allocated since the save that returned
+// L, and the archive loader forgets the files those blocks held. The loader
+// loads a file only if it is not already on the heap, and a sequence's bank
+// and wave archives before the sequence, as NNS_SndArcLoadSeqEx does.
+
+#define HOST_BLOCK_ALIGN    32
+#define HOST_BLOCK_HEADER   32      // NNS_SndHeapAlloc's block header, as modelled here
+#define HOST_MAX_HEAPS      2
+#define SND_RADIO_HEAP_SIZE 0x2EE0  // SndRadio_Init
+
+struct NNSSndHeap {
+    const void *buf;
+    u32 size;
+    u32 used;
+    int numSections;
+    u32 sectionStart[SND_MAX_SECTIONS];
+    int numBlocks;
+    SndHeapBlock blocks[SND_MAX_BLOCKS];
+    u8 seqLoaded[SND_MAX_SEQS];
+    u8 bankLoaded[SND_MAX_BANKS];
+    u8 waveArcLoaded[SND_MAX_WAVE_ARCS];
+    SndIo io;
+};
+
+static const SndArchive *sArchive;
+static struct NNSSndHeap sHeaps[HOST_MAX_HEAPS];
+static int sNumHeaps;
+
+struct System gSystem;
+
+void Snd_SetArchive(const SndArchive *archive) {
+    sArchive = archive;
+}
+
+void Snd_ResetIo(const void *heap) {
+    struct NNSSndHeap *host = (struct NNSSndHeap *)heap;
+
+    MI_CpuFill8(&host->io, 0, sizeof(SndIo));
+    host->io.minFreeSize = host->size - host->used;
+}
+
+void Snd_GetIo(const void *heap, SndIo *io) {
+    *io = ((const struct NNSSndHeap *)heap)->io;
+}
+
+void Snd_GetHeap(const void *heap, SndHeapView *view) {
+    const struct NNSSndHeap *host = heap;
+
+    view->numSections = host->numSections;
+    view->freeSize = host->size - host->used;
+    view->numBlocks = host->numBlocks;
+    MI_CpuCopy8(host->blocks, view->blocks, host->numBlocks * sizeof(SndHeapBlock));
+}
+
+int Snd_IsSeqLoaded(const void *heap, int seqNo) {
+    return ((const struct NNSSndHeap *)heap)->seqLoaded[seqNo];
+}
+
+static u8 *HostHeap_LoadedFlag(struct NNSSndHeap *heap, int type, int no) {
+    switch (type) {
+    case SND_FILE_SEQ:
+        return &heap->seqLoaded[no];
+    case SND_FILE_BANK:
+        return &heap->bankLoaded[no];
+    case SND_FILE_WAVE_ARC:
+        return &heap->waveArcLoaded[no];
+    }
+    return NULL;
+}
+
+static BOOL HostHeap_Alloc(struct NNSSndHeap *heap, int type, int no, u32 size) {
+    SndHeapBlock *block;
+    u32 blockSize = HOST_BLOCK_HEADER + ((size + HOST_BLOCK_ALIGN - 1) & ~(HOST_BLOCK_ALIGN - 1));
+
+    if (heap->used + blockSize > heap->size) {
+        return FALSE;
+    }
+    GF_ASSERT(heap->numBlocks < SND_MAX_BLOCKS);
+    block = &heap->blocks[heap->numBlocks++];
+    block->type = type;
+    block->section = heap->numSections - 1;
+    block->no = no;
+    block->offset = heap->used;
+    block->size = blockSize;
+    heap->used += blockSize;
+    if (heap->size - heap->used < heap->io.minFreeSize) {
+        heap->io.minFreeSize = heap->size - heap->used;
+    }
+    return TRUE;
+}
+
+NNSSndHeapHandle NNS_SndHeapCreate(void *buf, u32 maxsize) {
+    struct NNSSndHeap *heap;
+    int i;
+
+    for (i = 0; i < sNumHeaps; i++) {
+        if (sHeaps[i].buf == buf) {
+            break;
+        }
+    }
+    if (i == sNumHeaps) {
+        GF_ASSERT(sNumHeaps < HOST_MAX_HEAPS);
+        sNumHeaps++;
+    }
+    heap = &sHeaps[i];
+    MI_CpuFill8(heap, 0, sizeof(struct NNSSndHeap));
+    heap->buf = buf;
+    heap->size = maxsize;
+    heap->numSections = 1;
+    heap->io.minFreeSize = maxsize;
+    return heap;
+}
+
+int NNS_SndHeapSaveState(NNSSndHeapHandle heap) {
+    if (heap->numSections >= SND_MAX_SECTIONS) {
+        return -1;
+    }
+    heap->sectionStart[heap->numSections] = heap->used;
+    heap->io.saves++;
+    return heap->numSections++;
+}
+
+int NNS_SndHeapLoadState(NNSSndHeapHandle heap, int level) {
+    GF_ASSERT(level >= 0 && level < heap->numSections);
+    while (heap->numBlocks != 0 && heap->blocks[heap->numBlocks - 1].section >= level) {
+        SndHeapBlock *block = &heap->blocks[--heap->numBlocks];
+        u8 *loaded = HostHeap_LoadedFlag(heap, block->type, block->no);
+
+        if (loaded != NULL) {
+            *loaded = FALSE;
+        }
+    }
+    heap->numSections = level + 1;
+    heap->used = heap->sectionStart[level];
+    heap->io.restores++;
+    return TRUE;
+}
+
+u32 NNS_SndHeapGetSize(NNSSndHeapHandle heap) {
+    return heap->size;
+}
+
+u32 NNS_SndHeapGetFreeSize(NNSSndHeapHandle heap) {
+    return heap->size - heap->used;
+}
+
+static BOOL HostArc_LoadFile(struct NNSSndHeap *heap, int type, int no, u32 size) {
+    u8 *loaded = HostHeap_LoadedFlag(heap, type, no);
+
+    if (size == 0) {
+        return FALSE;
+    }
+    if (*loaded) {
+        return TRUE;
+    }
+    if (!HostHeap_Alloc(heap, type, no, size)) {
+        return FALSE;
+    }
+    *loaded = TRUE;
+    heap->io.fileReads++;
+    heap->io.bytesRead += size;
+    return TRUE;
+}
+
+static BOOL HostArc_LoadWaveArc(struct NNSSndHeap *heap, int waveArcNo) {
+    GF_ASSERT(waveArcNo >= 0 && waveArcNo < SND_MAX_WAVE_ARCS);
+    return HostArc_LoadFile(heap, SND_FILE_WAVE_ARC, waveArcNo, sArchive->waveArcSizes[waveArcNo]);
+}
+
+static BOOL HostArc_LoadBank(struct NNSSndHeap *heap, int bankNo, u32 loadFlag) {
+    const SndBankInfo *bank;
+    int i;
+
+    GF_ASSERT(bankNo >= 0 && bankNo < SND_MAX_BANKS);
+    bank = &sArchive->banks[bankNo];
+    if (bank->size == 0) {
+        return FALSE;
+    }
+    if (loadFlag & SND_LOAD_WAVE) {
+        for (i = 0; i < bank->numWaveArcs; i++) {
+            if (!HostArc_LoadWaveArc(heap, bank->waveArcs[i])) {
+                return FALSE;
+            }
+        }
+    }
+    if (loadFlag & SND_LOAD_BANK) {
+        return HostArc_LoadFile(heap, SND_FILE_BANK, bankNo, bank->size);
+    }
+    return TRUE;
+}
+
+static BOOL HostArc_LoadSeq(struct NNSSndHeap *heap, int seqNo, u32 loadFlag) {
+    const SndSeqInfo *seq;
+
+    GF_ASSERT(seqNo >= 0 && seqNo < SND_MAX_SEQS);
+    seq = &sArchive->seqs[seqNo];
+    if (seq->size == 0) {
+        return FALSE;
+    }
+    if (loadFlag & (SND_LOAD_BANK | SND_LOAD_WAVE)) {
+        if (!HostArc_LoadBank(heap, seq->bank, loadFlag)) {
+            return FALSE;
+        }
+    }
+    if (loadFlag & SND_LOAD_SEQ) {
+        return HostArc_LoadFile(heap, SND_FILE_SEQ, seqNo, seq->size);
+    }
+    return TRUE;
+}
+
+static BOOL HostArc_Result(struct NNSSndHeap *heap, BOOL result) {
+    heap->io.loadCalls++;
+    if (!result) {
+        heap->io.failedLoads++;
+    }
+    return result;
+}
+
+BOOL NNS_SndArcLoadGroup(int groupNo, NNSSndHeapHandle heap) {
+    const SndGroupInfo *group;
+    BOOL result = TRUE;
+    int i;
+
+    GF_ASSERT(groupNo >= 0 && groupNo < SND_MAX_GROUPS);
+    group = &sArchive->groups[groupNo];
+    for (i = 0; i < group->numItems && result; i++) {
+        const SndGroupItem *item = &group->items[i];
+
+        switch (item->type) {
+        case SND_FILE_SEQ:
+            result = HostArc_LoadSeq(heap, item->no, item->loadFlag);
+            break;
+        case SND_FILE_BANK:
+            result = HostArc_LoadBank(heap, item->no, item->loadFlag);
+            break;
+        case SND_FILE_WAVE_ARC:
+            result = HostArc_LoadWaveArc(heap, item->no);
+            break;
+        }
+    }
+    return HostArc_Result(heap, group->numItems != 0 && result);
+}
+
+BOOL NNS_SndArcLoadSeq(int seqNo, NNSSndHeapHandle heap) {
+    return HostArc_Result(heap, HostArc_LoadSeq(heap, seqNo, SND_LOAD_ALL));
+}
+
+BOOL NNS_SndArcLoadSeqEx(int seqNo, u32 loadFlag, NNSSndHeapHandle heap) {
+    return HostArc_Result(heap, HostArc_LoadSeq(heap, seqNo, loadFlag));
+}
+
+BOOL NNS_SndArcLoadBank(int bankNo, NNSSndHeapHandle heap) {
+    return HostArc_Result(heap, HostArc_LoadBank(heap, bankNo, SND_LOAD_ALL));
+}
+
+BOOL NNS_SndArcLoadWaveArc(int waveArcNo, NNSSndHeapHandle heap) {
+    return HostArc_Result(heap, HostArc_LoadWaveArc(heap, waveArcNo));
+}
+
+// The player heaps NNS_SndArcPlayerSetup makes are sized by the archive's
+// player table, which is not in the tree; only the radio's is modelled
+BOOL NNS_SndArcPlayerSetup(NNSSndHeapHandle heap) {
+    return TRUE;
+}
+
+void SndRadio_Init(NNSSndHeapHandle *heap_p) {
+    GF_ASSERT(HostHeap_Alloc(*heap_p, SND_FILE_PLAYER_HEAP, PLAYER_RADIO, SND_RADIO_HEAP_SIZE));
+}
+
+void NNS_SndArcInit(NNSSndArc *arc, const char *filePath, NNSSndHeapHandle heap, BOOL symbolLoadFlag) {
+}
+
+void NNS_SndInit(void) {
+}
+
+void NNS_SndMain(void) {
+}
+
+BOOL NNS_SndUpdateDriverInfo(void) {
+    return TRUE;
+}
+
+void NNS_SndHandleInit(NNSSndHandle *handle) {
+}
+
+void MIC_Init(void) {
+}
+
+u32 PM_SetAmp(PMAmpSwitch sw) {
+    return 0;
+}
+
+u32 PM_SetAmpGain(PMAmpGain gain) {
+    return 0;
+}
+
+void GF_SndSetMonoFlag(int flag) {
+}
+
+BOOL ChatotSoundMain(void) {
+    return FALSE;
+}
+
+// Nothing is playing: no fanfare, no fade, no queued cry
+u32 GF_SndPlayerCountPlayingSeqByPlayerNo(u32 playerno) {
+    return 0;
+}
+
+BOOL GF_SndGetFadeTimer(void) {
+    return FALSE;
+}
+
+BOOL GF_SndGetAfterFadeDelayTimer(void) {
+    return FALSE;
+}
+
+void MI_CpuCopy8(const void *src, void *dest, u32 size) {
+    __builtin_memcpy(dest, src, size);
+}
+
+void MI_CpuFill8(void *dest, u8 data, u32 size) {
+    __builtin_memset(dest, data, size);
+}
+
+// DoSoundUpdateFrame reaches these only with a sequence playing or the debug
+// button held, which sndsim never has
+void PlayBGM(u16 seqno) {
+    GF_ASSERT(FALSE);
+}
+
+void GF_SndStartFadeInBGM(u32 a0, u32 a1, u32 a2) {
+    GF_ASSERT(FALSE);
+}
+
+void PlayCryEx(int a0, int a1, int a2, int a3, int a4, int a5) {
+    GF_ASSERT(FALSE);
+}
+
+void NNS_SndPlayerStopSeqByPlayerNo(int playerNo, int fadeFrame) {
+    GF_ASSERT(FALSE);
+}
+
+void NNS_SndHandleReleaseSeq(NNSSndHandle *handle) {
+    GF_ASSERT(FALSE);
+}
+
+BOOL NNS_SndReadDriverChannelInfo(int chNo, SNDChannelInfo *info) {
+    GF_ASSERT(FALSE);
+    return FALSE;
+}
+
+BOOL NNS_SndPlayerReadDriverTrackInfo(NNSSndHandle *handle, int trackNo, struct SNDTrackInfo *info) {
+    GF_ASSERT(FALSE);
+    return FALSE;
+}
@@ -0,0 +1,1092 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stdnoreturn.h>
+#include <stdarg.h>
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
+#include "sndsim.h"
+
+// Where the ids are read from, relative to the repository root
+#define SNDSEQ_PATH         "include/constants/sndseq.h"
+
+#define MAX_DEFINES         4096
+#define MAX_NAME            64
+#define MAX_LIST            1024
+#define MAX_STEPS           (1 << 21)
+#define NUM_SLOTS           7           // SND_WORK.stateSaveDepth
+#define AREA_BGMS           4
+
+#define DEFAULT_ROUTINES    20000
+
+// The stateSaveDepth slots, by what the callers keep at each
+enum
+{
+    SLOT_BOOT,          // sub_02004898
+    SLOT_GLOBAL,        // GROUP_GLOBAL and BANK_GAMEBOY
+    SLOT_SCENE,         // sub_02005060, before the scene's sound effects
+    SLOT_BGM,           // before the BGM
+    SLOT_FIELD_BGM,     // sub_020051A4 and sub_02005150, after the field BGM
+    SLOT_SUB_SCENE,     // sub_020052C8
+    SLOT_FANFARE,       // PlayFanfare
+};
+
+enum
+{
+    STEP_SAVE_STATE,
+    STEP_LOAD_STATE,
+    STEP_LOAD,
+    STEP_START_SEQ,
+    STEP_FRAME,
+};
+
+typedef struct Define
+{
+    char name[MAX_NAME];
+    int value;
+} Define;
+
+typedef struct Step
+{
+    uint8_t kind;
+    uint8_t type;       // STEP_LOAD: SND_FILE_*
+    uint16_t no;        // the slot, or the group, sequence, bank or wave archive
+    uint32_t loadFlag;
+} Step;
+
+typedef struct Script
+{
+    int numSteps;
+    int numRoutines;
+    Step * steps;
+} Script;
+
+// One GF_Snd_Load* call sub_02004B24 makes for a scene
+typedef struct SceneLoad
+{
+    int scene;
+    int type;
+    const char * name;
+    uint32_t loadFlag;
+} SceneLoad;
+
+typedef struct Variant
+{
+    const char * name;
+    void (*init)(void);
+    void (*frame)(void);
+    void (*saveState)(int slot);
+    void (*loadState)(int slot);
+    int (*load)(int type, int no, uint32_t loadFlag);
+    int (*startSeq)(int seqNo);
+    const void * (*heap)(void);
+    void (*getPlannerStats)(SndPlannerStats * stats);
+} Variant;
+
+static const Variant kVariants[] = {
+    { "base", SndBase_Init, SndBase_Frame, SndBase_SaveState, SndBase_LoadState, SndBase_Load, SndBase_StartSeq,
+      SndBase_Heap, SndBase_GetPlannerStats },
+    { "plan", SndPlan_Init, SndPlan_Frame, SndPlan_SaveState, SndPlan_LoadState, SndPlan_Load, SndPlan_StartSeq,
+      SndPlan_Heap, SndPlan_GetPlannerStats },
+};
+
+// sub_02004B24 in asm/unk_02004A44.s, case by case; the cases that only
+// assert are left out
+static const SceneLoad kSceneLoads[] = {
+    { 1, SND_FILE_GROUP, "GROUP_SE_FIELD" },
+    { 2, SND_FILE_GROUP, "GROUP_SE_BATTLE" },
+    { 3, SND_FILE_GROUP, "GROUP_SE_TRADE" },
+    { 4, SND_FILE_GROUP, "GROUP_SE_FIELD" },
+    { 5, SND_FILE_GROUP, "GROUP_SE_BATTLE" },
+    { 6, SND_FILE_GROUP, "GROUP_SE_CONTEST" },
+    { 7, SND_FILE_GROUP, "GROUP_SE_IMAGE" },
+    { 8, SND_FILE_GROUP, "GROUP_SE_FIELD" },
+    { 9, SND_FILE_GROUP, "GROUP_SE_FIELD" },
+    { 10, SND_FILE_GROUP, "GROUP_SE_FIELD" },
+    { 11, SND_FILE_GROUP, "GROUP_SE_FIELD" },
+    { 12, SND_FILE_GROUP, "GROUP_SE_NUTMIXER" },
+    { 13, SND_FILE_GROUP, "GROUP_SE_BATTLE" },
+    { 14, SND_FILE_GROUP, "GROUP_SE_NUTMIXER" },
+    { 15, SND_FILE_GROUP, "GROUP_SE_FIELD" },
+    { 16, SND_FILE_GROUP, "GROUP_SE_FIELD" },
+    { 16, SND_FILE_GROUP, "GROUP_SE_DIG" },
+    { 17, SND_FILE_GROUP, "GROUP_SE_FIELD" },
+    { 19, SND_FILE_GROUP, "GROUP_SE_FIELD" },
+    { 19, SND_FILE_SEQ_EX, "SEQ_SE_PL_BALLOON02", SND_LOAD_SEQ },
+    { 19, SND_FILE_SEQ_EX, "SEQ_SE_PL_BALLOON03_2", SND_LOAD_SEQ },
+    { 19, SND_FILE_SEQ_EX, "SEQ_SE_PL_BALLOON05", SND_LOAD_SEQ },
+    { 19, SND_FILE_SEQ_EX, "SEQ_SE_PL_BALLOON01", SND_LOAD_SEQ },
+    { 19, SND_FILE_SEQ_EX, "SEQ_SE_PL_BALLOON07", SND_LOAD_SEQ },
+    { 19, SND_FILE_SEQ_EX, "SEQ_SE_PL_ALERT4", SND_LOAD_SEQ },
+    { 19, SND_FILE_SEQ_EX, "SEQ_SE_DP_FW104", SND_LOAD_SEQ },
+    { 19, SND_FILE_SEQ_EX, "SEQ_SE_PL_NOMI02", SND_LOAD_SEQ },
+    { 19, SND_FILE_SEQ_EX, "SEQ_SE_DP_023", SND_LOAD_SEQ },
+    { 19, SND_FILE_SEQ_EX, "SEQ_SE_PL_POINT1", SND_LOAD_SEQ },
+    { 19, SND_FILE_SEQ_EX, "SEQ_SE_PL_POINT2", SND_LOAD_SEQ },
+    { 19, SND_FILE_SEQ_EX, "SEQ_SE_PL_POINT3", SND_LOAD_SEQ },
+    { 19, SND_FILE_SEQ_EX, "SEQ_SE_PL_BALLOON05_2", SND_LOAD_SEQ },
+    { 19, SND_FILE_SEQ_EX, "SEQ_SE_DP_HAMARU", SND_LOAD_SEQ },
+    { 19, SND_FILE_SEQ_EX, "SEQ_SE_DP_CON_016", SND_LOAD_SEQ },
+    { 19, SND_FILE_SEQ_EX, "SEQ_SE_PL_KIRAKIRA", SND_LOAD_SEQ },
+    { 19, SND_FILE_SEQ_EX, "SEQ_SE_PL_FCALL", SND_LOAD_SEQ },
+    { 20, SND_FILE_GROUP, "GROUP_SE_FIELD" },
+    { 21, SND_FILE_BANK, "BANK_SE_HIROBA" },
+    { 21, SND_FILE_WAVE_ARC, "WAVE_ARC_SE_HIROBA" },
+    { 22, SND_FILE_GROUP, "GROUP_SE_FIELD" },
+    { 23, SND_FILE_GROUP, "GROUP_SE_FIELD" },
+    { 24, SND_FILE_BANK, "BANK_SE_THLON" },
+    { 24, SND_FILE_WAVE_ARC, "WAVE_ARC_SE_THLON" },
+    { 25, SND_FILE_BANK, "BANK_SE_THLON_OPED" },
+    { 25, SND_FILE_WAVE_ARC, "WAVE_ARC_SE_THLON_OPED" },
+    { 51, SND_FILE_GROUP, "GROUP_SE_BAG" },
+    { 52, SND_FILE_GROUP, "GROUP_SE_NAMEIN" },
+    { 53, SND_FILE_GROUP, "GROUP_SE_IMAGE" },
+    { 54, SND_FILE_GROUP, "GROUP_SE_ZUKAN" },
+    { 55, SND_FILE_BANK, "BANK_SE_TOWNMAP" },
+    { 55, SND_FILE_WAVE_ARC, "WAVE_ARC_SE_TOWNMAP" },
+    { 56, SND_FILE_GROUP, "GROUP_SE_TRCARD" },
+    { 57, SND_FILE_GROUP, "GROUP_SE_POKELIST" },
+    { 58, SND_FILE_GROUP, "GROUP_SE_DIG" },
+    { 59, SND_FILE_GROUP, "GROUP_SE_CUSTOM" },
+    { 60, SND_FILE_GROUP, "GROUP_SE_BAG" },
+    { 61, SND_FILE_GROUP, "GROUP_SE_NAMEIN" },
+    { 62, SND_FILE_GROUP, "GROUP_SE_CUSTOM" },
+    { 63, SND_FILE_GROUP, "GROUP_SE_CLIMAX" },
+    { 64, SND_FILE_GROUP, "GROUP_SE_SLOT" },
+    { 65, SND_FILE_BANK, "BANK_SE_TOWNMAP" },
+    { 65, SND_FILE_WAVE_ARC, "WAVE_ARC_SE_TOWNMAP" },
+    { 66, SND_FILE_BANK, "BANK_SE_SCRATCH" },
+    { 66, SND_FILE_WAVE_ARC, "WAVE_ARC_SE_SCRATCH" },
+    { 67, SND_FILE_GROUP, "GROUP_SE_NAMEIN" },
+    { 68, SND_FILE_BANK, "BANK_SE_LINEAR" },
+    { 68, SND_FILE_WAVE_ARC, "WAVE_ARC_SE_LINEAR" },
+    { 69, SND_FILE_BANK, "BANK_SE_PLANTER" },
+    { 69, SND_FILE_WAVE_ARC, "WAVE_ARC_SE_PLANTER" },
+    { 70, SND_FILE_BANK, "BANK_SE_COIN" },
+    { 70, SND_FILE_WAVE_ARC, "WAVE_ARC_SE_COIN" },
+    { 71, SND_FILE_BANK, "BANK_SE_DENDO" },
+    { 71, SND_FILE_WAVE_ARC, "WAVE_ARC_SE_DENDO" },
+    { 72, SND_FILE_BANK, "BANK_SE_JUICE" },
+    { 72, SND_FILE_WAVE_ARC, "WAVE_ARC_SE_JUICE" },
+    { 73, SND_FILE_BANK, "BANK_SE_PHC" },
+    { 73, SND_FILE_WAVE_ARC, "WAVE_ARC_SE_PHC" },
+    { 74, SND_FILE_BANK, "BANK_SE_SEKIBAN" },
+    { 74, SND_FILE_WAVE_ARC, "WAVE_ARC_SE_SEKIBAN" },
+    { 75, SND_FILE_BANK, "BANK_SE_EVENT" },
+    { 75, SND_FILE_WAVE_ARC, "WAVE_ARC_SE_EVENT" },
+};
+
+#define NUM_SCENE_LOADS     (int)(sizeof(kSceneLoads) / sizeof(kSceneLoads[0]))
+
+static int sNumDefines;
+static Define sDefines[MAX_DEFINES];
+static int sSceneNos[NUM_SCENE_LOADS];
+static int sNumScenes;
+static int sSceneLoadNos[NUM_SCENE_LOADS];
+
+// The archive model, and the ids the replay picks from
+static SndSeqInfo sSeqs[SND_MAX_SEQS];
+static SndBankInfo sBanks[SND_MAX_BANKS];
+static uint32_t sWaveArcSizes[SND_MAX_WAVE_ARCS];
+static SndGroupInfo sGroups[SND_MAX_GROUPS];
+static SndArchive sArchive;
+static int sNumFieldBgms, sFieldBgms[MAX_LIST];
+static int sNumBattleBgms, sBattleBgms[MAX_LIST];
+static int sNumFanfares, sFanfares[MAX_LIST];
+static int sNumSe, sSe[MAX_LIST * 2];
+
+static inline noreturn __attribute__((format(printf, 1, 2))) void fatal_error(const char * message, ...)
+{
+    va_list va_args;
+    va_start(va_args, message);
+    fputs("Error: ", stderr);
+    vfprintf(stderr, message, va_args);
+    fputc('\n', stderr);
+    va_end(va_args);
+    exit(EXIT_FAILURE);
+}
+
+// GF_ASSERT in the game objects, which are built with PM_KEEP_ASSERTS
+void GF_AssertFail(void)
+{
+    fatal_error("GF_ASSERT failed in the game code");
+}
+
+static uint32_t ParseU32(const char * arg)
+{
+    char * end;
+    unsigned long long val = strtoull(arg, &end, 0);
+    if (*arg == '\0' || *end != '\0' || val > 0xFFFFFFFFull)
+    {
+        fatal_error("invalid number: %s", arg);
+    }
+    return (uint32_t)val;
+}
+
+static double Now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static uint32_t Random(uint32_t * state)
+{
+    uint32_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return *state = x;
+}
+
+// A fixed pseudo-random number for an id, so the archive is the same every run
+static uint32_t Hash(uint32_t value, uint32_t salt)
+{
+    uint32_t x = value * 0x9E3779B1u ^ salt * 0x85EBCA77u;
+    x ^= x >> 15;
+    x *= 0x2C1B3C6Du;
+    x ^= x >> 12;
+    return x;
+}
+
+static uint32_t HashRange(uint32_t value, uint32_t salt, uint32_t min, uint32_t max)
+{
+    return min + Hash(value, salt) % (max - min + 1);
+}
+
+// ---------------------------------------------------------------------------
+// Sound archive
+
+static void * ReadWholeFile(const char * root, const char * relPath, size_t * size)
+{
+    char path[4096];
+    snprintf(path, sizeof(path), "%s/%s", root, relPath);
+    FILE * file = fopen(path, "rb");
+    if (file == NULL)
+    {
+        fatal_error("%s: %s", path, strerror(errno));
+    }
+    fseek(file, 0, SEEK_END);
+    long length = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    uint8_t * buffer = malloc(length + 1);
+    if (buffer == NULL)
+    {
+        fatal_error("out of memory reading %s", path);
+    }
+    if (fread(buffer, 1, length, file) != (size_t)length)
+    {
+        fatal_error("%s: short read", path);
+    }
+    fclose(file);
+    buffer[length] = '\0';
+    *size = length;
+    return buffer;
+}
+
+static const char * FindRoot(void)
+{
+    static const char * const candidates[] = { ".", "..", "../.." };
+    for (size_t i = 0; i < sizeof(candidates) / sizeof(candidates[0]); i++)
+    {
+        char path[4096];
+        snprintf(path, sizeof(path), "%s/%s", candidates[i], SNDSEQ_PATH);
+        if (access(path, R_OK) == 0)
+        {
+            return candidates[i];
+        }
+    }
+    return NULL;
+}
+
+static int CompareDefines(const void * a, const void * b)
+{
+    return strcmp(((const Define *)a)->name, ((const Define *)b)->name);
+}
+
+// Every "#define NAME NUMBER" in sndseq.h
+static void LoadDefines(const char * root)
+{
+    size_t size;
+    char * text = ReadWholeFile(root, SNDSEQ_PATH, &size);
+    for (char * line = text; line != NULL && *line != '\0';)
+    {
+        char * next = strchr(line, '\n');
+        char name[MAX_NAME];
+        int value;
+        if (sscanf(line, "#define %63s %i", name, &value) == 2)
+        {
+            if (sNumDefines >= MAX_DEFINES)
+            {
+                fatal_error("more than %d constants", MAX_DEFINES);
+            }
+            strcpy(sDefines[sNumDefines].name, name);
+            sDefines[sNumDefines].value = value;
+            sNumDefines++;
+        }
+        line = next != NULL ? next + 1 : NULL;
+    }
+    free(text);
+    qsort(sDefines, sNumDefines, sizeof(Define), CompareDefines);
+}
+
+static const Define * Find(const char * name)
+{
+    Define key;
+    if (strlen(name) >= MAX_NAME)
+    {
+        return NULL;
+    }
+    strcpy(key.name, name);
+    return bsearch(&key, sDefines, sNumDefines, sizeof(Define), CompareDefines);
+}
+
+static int LookUp(const char * name)
+{
+    const Define * found = Find(name);
+    if (found == NULL)
+    {
+        fatal_error("unknown constant %s", name);
+    }
+    return found->value;
+}
+
+static bool StartsWith(const char * name, const char * prefix)
+{
+    return strncmp(name, prefix, strlen(prefix)) == 0;
+}
+
+// The ids of every constant whose name starts with prefix
+static int Collect(const char * prefix, int * list, int max)
+{
+    int count = 0;
+    for (int i = 0; i < sNumDefines; i++)
+    {
+        if (StartsWith(sDefines[i].name, prefix) && count < max)
+        {
+            list[count++] = sDefines[i].value;
+        }
+    }
+    return count;
+}
+
+static void AddGroupItem(SndGroupInfo * group, int type, int no, uint32_t loadFlag)
+{
+    if (group->numItems >= SND_MAX_GROUP_ITEMS)
+    {
+        fatal_error("group too big");
+    }
+    group->items[group->numItems].type = type;
+    group->items[group->numItems].no = no;
+    group->items[group->numItems].loadFlag = loadFlag;
+    group->numItems++;
+}
+
+// gs_sound_data.sdat is not in the tree, so its info block is modelled: the
+// ids and names are the real ones from sndseq.h, and what each sequence,
+// bank and group holds and how big each file is are fixed by hashing the id.
+// A BANK_X plays from WAVE_ARC_X, a SEQ_PVnnn from BANK_PVnnn, battle BGMs
+// from the battle banks, other BGMs and fanfares from the field and dungeon
+// banks, and sound effects from BANK_BASIC or the SE banks.
+static void BuildArchive(void)
+{
+    static int fieldBanks[MAX_LIST], battleBanks[MAX_LIST], seBanks[MAX_LIST];
+    int numFieldBanks = Collect("BANK_BGM_FIELD", fieldBanks, MAX_LIST);
+    numFieldBanks += Collect("BANK_BGM_DUNGEON", fieldBanks + numFieldBanks, MAX_LIST - numFieldBanks);
+    int numBattleBanks = Collect("BANK_BGM_BATTLE", battleBanks, MAX_LIST);
+    int numSeBanks = Collect("BANK_SE_", seBanks, MAX_LIST);
+    int bankBasic = LookUp("BANK_BASIC");
+
+    if (numFieldBanks == 0 || numBattleBanks == 0 || numSeBanks == 0)
+    {
+        fatal_error("%s: no BGM or SE banks", SNDSEQ_PATH);
+    }
+    for (int i = 0; i < sNumDefines; i++)
+    {
+        const char * name = sDefines[i].name;
+        int no = sDefines[i].value;
+        if (StartsWith(name, "WAVE_ARC_") && no < SND_MAX_WAVE_ARCS)
+        {
+            bool bgm = StartsWith(name, "WAVE_ARC_BGM_");
+            bool pv = StartsWith(name, "WAVE_ARC_PV");
+            sWaveArcSizes[no] = bgm ? HashRange(no, 1, 24000, 96000) : pv ? HashRange(no, 1, 3000, 12000) : HashRange(no, 1, 4000, 24000);
+        }
+    }
+    for (int i = 0; i < sNumDefines; i++)
+    {
+        const char * name = sDefines[i].name;
+        int no = sDefines[i].value;
+        if (StartsWith(name, "BANK_") && no < SND_MAX_BANKS)
+        {
+            char waveArc[MAX_NAME + 8];
+            snprintf(waveArc, sizeof(waveArc), "WAVE_ARC_%s", name + strlen("BANK_"));
+            const Define * found = Find(waveArc);
+            sBanks[no].size = HashRange(no, 2, 600, 6000);
+            if (found != NULL && found->value < SND_MAX_WAVE_ARCS)
+            {
+                sBanks[no].waveArcs[sBanks[no].numWaveArcs++] = found->value;
+            }
+        }
+    }
+    for (int i = 0; i < sNumDefines; i++)
+    {
+        const char * name = sDefines[i].name;
+        int no = sDefines[i].value;
+        if (!StartsWith(name, "SEQ_") || no >= SND_MAX_SEQS)
+        {
+            continue;
+        }
+        SndSeqInfo * seq = &sSeqs[no];
+        if (StartsWith(name, "SEQ_PV"))
+        {
+            char bank[MAX_NAME + 8];
+            snprintf(bank, sizeof(bank), "BANK_%s", name + strlen("SEQ_"));
+            const Define * found = Find(bank);
+            seq->bank = found != NULL ? found->value : LookUp("BANK_PV001");
+            seq->size = HashRange(no, 3, 64, 256);
+        }
+        else if (StartsWith(name, "SEQ_SE_"))
+        {
+            seq->bank = Hash(no, 4) % 8 != 0 ? bankBasic : seBanks[Hash(no, 5) % numSeBanks];
+            seq->size = HashRange(no, 3, 128, 2048);
+            if (sNumSe < MAX_LIST * 2)
+            {
+                sSe[sNumSe++] = no;
+            }
+        }
+        else if (StartsWith(name, "SEQ_GS_VS_"))
+        {
+            seq->bank = battleBanks[Hash(no, 5) % numBattleBanks];
+            seq->size = HashRange(no, 3, 6000, 20000);
+            sBattleBgms[sNumBattleBgms++] = no;
+        }
+        else
+        {
+            seq->bank = fieldBanks[Hash(no, 5) % numFieldBanks];
+            seq->size = HashRange(no, 3, 3000, 16000);
+            if (StartsWith(name, "SEQ_ME_"))
+            {
+                sFanfares[sNumFanfares++] = no;
+            }
+            else if (StartsWith(name, "SEQ_GS_"))
+            {
+                sFieldBgms[sNumFieldBgms++] = no;
+            }
+        }
+    }
+    if (sNumSe == 0 || sNumBattleBgms == 0 || sNumFanfares == 0 || sNumFieldBgms < AREA_BGMS)
+    {
+        fatal_error("%s: missing sequences", SNDSEQ_PATH);
+    }
+
+    // GROUP_GLOBAL holds the common sound effects; each other group a few
+    // dozen more
+    for (int i = 0; i < sNumDefines; i++)
+    {
+        const char * name = sDefines[i].name;
+        int no = sDefines[i].value;
+        if (!StartsWith(name, "GROUP_") || no >= SND_MAX_GROUPS)
+        {
+            continue;
+        }
+        SndGroupInfo * group = &sGroups[no];
+        int count = no == LookUp("GROUP_GLOBAL") ? 40 : HashRange(no, 6, 8, 32);
+        AddGroupItem(group, SND_FILE_BANK, bankBasic, SND_LOAD_ALL);
+        for (int j = 0; j < count; j++)
+        {
+            AddGroupItem(group, SND_FILE_SEQ, sSe[Hash(no * 64 + j, 7) % sNumSe], SND_LOAD_ALL);
+        }
+    }
+
+    sArchive.seqs = sSeqs;
+    sArchive.banks = sBanks;
+    sArchive.waveArcSizes = sWaveArcSizes;
+    sArchive.groups = sGroups;
+    Snd_SetArchive(&sArchive);
+
+    for (int i = 0; i < NUM_SCENE_LOADS; i++)
+    {
+        sSceneLoadNos[i] = LookUp(kSceneLoads[i].name);
+        if (i == 0 || kSceneLoads[i].scene != kSceneLoads[i - 1].scene)
+        {
+            sSceneNos[sNumScenes++] = kSceneLoads[i].scene;
+        }
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Replay
+//
+// The callers of GF_Snd_SaveState, GF_Snd_LoadState and GF_Snd_Load* in
+// asm/unk_02004A44.s and asm/unk_02005D10.s, step by step. The walk keeps
+// the levels the slots hold, as sound.c would, so that it only restores a
+// slot that was saved since the heap last went below it.
+
+typedef struct Walk
+{
+    Script * script;
+    uint32_t state;
+    int numSections;
+    int slotLevels[NUM_SLOTS];
+    int area[AREA_BGMS];
+    int bgm;
+} Walk;
+
+static void Emit(Walk * walk, int kind, int type, int no, uint32_t loadFlag)
+{
+    Script * script = walk->script;
+    if (script->numSteps >= MAX_STEPS)
+    {
+        fatal_error("more than %d steps", MAX_STEPS);
+    }
+    Step * step = &script->steps[script->numSteps++];
+    step->kind = kind;
+    step->type = type;
+    step->no = no;
+    step->loadFlag = loadFlag;
+}
+
+static void EmitSave(Walk * walk, int slot)
+{
+    walk->slotLevels[slot] = walk->numSections++;
+    Emit(walk, STEP_SAVE_STATE, 0, slot, 0);
+}
+
+static bool CanRestore(const Walk * walk, int slot)
+{
+    return walk->slotLevels[slot] > 0 && walk->slotLevels[slot] < walk->numSections;
+}
+
+static void EmitRestore(Walk * walk, int slot)
+{
+    if (!CanRestore(walk, slot))
+    {
+        fatal_error("replay restores slot %d, which is not saved", slot);
+    }
+    walk->numSections = walk->slotLevels[slot] + 1;
+    Emit(walk, STEP_LOAD_STATE, 0, slot, 0);
+}
+
+// sub_02004B24
+static void EmitScene(Walk * walk, int scene)
+{
+    for (int i = 0; i < NUM_SCENE_LOADS; i++)
+    {
+        if (kSceneLoads[i].scene == scene)
+        {
+            Emit(walk, STEP_LOAD, kSceneLoads[i].type, sSceneLoadNos[i], kSceneLoads[i].loadFlag);
+        }
+    }
+}
+
+// PlayBGM on the BGM player: sub_02005DC4
+static void EmitPlayBgm(Walk * walk, int seqNo)
+{
+    EmitRestore(walk, SLOT_BGM);
+    Emit(walk, STEP_LOAD, SND_FILE_SEQ, seqNo, 0);
+    Emit(walk, STEP_START_SEQ, 0, seqNo, 0);
+    walk->bgm = seqNo;
+}
+
+// sub_020052E4 and sub_02005060: a new scene's sound effects, then its BGM
+static void EmitSceneChange(Walk * walk, int scene, int seqNo)
+{
+    EmitRestore(walk, SLOT_GLOBAL);
+    EmitSave(walk, SLOT_SCENE);
+    EmitScene(walk, scene);
+    EmitSave(walk, SLOT_BGM);
+    EmitPlayBgm(walk, seqNo);
+}
+
+// sub_02005228: the battle's sound effects and BGM
+static void EmitBattle(Walk * walk, int seqNo)
+{
+    EmitRestore(walk, SLOT_SCENE);
+    EmitScene(walk, 5);
+    EmitSave(walk, SLOT_BGM);
+    EmitPlayBgm(walk, seqNo);
+}
+
+// sub_020051A4: the field BGM's bank, the field sound effects, then its wave
+// archives
+static void EmitFieldBgm(Walk * walk, int seqNo)
+{
+    EmitRestore(walk, SLOT_GLOBAL);
+    Emit(walk, STEP_LOAD, SND_FILE_SEQ_EX, seqNo, SND_LOAD_BANK);
+    EmitSave(walk, SLOT_SCENE);
+    EmitScene(walk, 4);
+    EmitSave(walk, SLOT_BGM);
+    Emit(walk, STEP_LOAD, SND_FILE_SEQ_EX, seqNo, SND_LOAD_WAVE);
+    EmitSave(walk, SLOT_FIELD_BGM);
+    Emit(walk, STEP_START_SEQ, 0, seqNo, 0);
+}
+
+// sub_020052C8: a menu's sound effects over the field
+static void EmitSubScene(Walk * walk, int scene)
+{
+    EmitRestore(walk, SLOT_FIELD_BGM);
+    EmitScene(walk, scene);
+    EmitSave(walk, SLOT_SUB_SCENE);
+}
+
+// PlayFanfare, a few frames of it, then IsFanfarePlaying's sub_02006BB0
+static void EmitFanfare(Walk * walk, int seqNo, int frames)
+{
+    EmitSave(walk, SLOT_FANFARE);
+    Emit(walk, STEP_LOAD, SND_FILE_SEQ_EX, seqNo, SND_LOAD_SEQ | SND_LOAD_BANK);
+    Emit(walk, STEP_START_SEQ, 0, seqNo, 0);
+    for (int i = 0; i < frames; i++)
+    {
+        Emit(walk, STEP_FRAME, 0, 0, 0);
+    }
+    EmitRestore(walk, SLOT_FANFARE);
+}
+
+// sub_02005E44: a sequence on the BGM player over what is loaded
+static void EmitBgmPlayerSeq(Walk * walk, int seqNo)
+{
+    Emit(walk, STEP_LOAD, SND_FILE_SEQ_EX, seqNo, SND_LOAD_SEQ);
+    Emit(walk, STEP_START_SEQ, 0, seqNo, 0);
+}
+
+static void NewArea(Walk * walk)
+{
+    for (int i = 0; i < AREA_BGMS; i++)
+    {
+        walk->area[i] = sFieldBgms[Random(&walk->state) % sNumFieldBgms];
+    }
+}
+
+static int AreaBgm(Walk * walk)
+{
+    // Mostly the BGM already playing: the next map of the same town
+    if (walk->bgm != 0 && Random(&walk->state) % 2 == 0)
+    {
+        return walk->bgm;
+    }
+    return walk->area[Random(&walk->state) % AREA_BGMS];
+}
+
+// A boot, then a seeded walk over the routines above with 0 to 3 frames
+// after each, so that some follow one another within a frame
+static void BuildScript(Script * script, int routines, uint32_t seed)
+{
+    Walk walk;
+
+    memset(&walk, 0, sizeof(walk));
+    memset(script, 0, sizeof(Script));
+    script->steps = malloc(sizeof(Step) * MAX_STEPS);
+    if (script->steps == NULL)
+    {
+        fatal_error("out of memory");
+    }
+    walk.script = script;
+    walk.state = seed;
+    // InitSoundData's sub_02004898 saved slots 0 and 1
+    walk.numSections = 3;
+    walk.slotLevels[SLOT_BOOT] = 1;
+    walk.slotLevels[SLOT_GLOBAL] = 2;
+    NewArea(&walk);
+    EmitSceneChange(&walk, 1, AreaBgm(&walk));
+    for (script->numRoutines = 0; script->numRoutines < routines; script->numRoutines++)
+    {
+        uint32_t pick = Random(&walk.state) % 100;
+        if (pick < 35)
+        {
+            EmitPlayBgm(&walk, AreaBgm(&walk));
+        }
+        else if (pick < 50)
+        {
+            EmitFanfare(&walk, sFanfares[Random(&walk.state) % sNumFanfares], Random(&walk.state) % 3);
+        }
+        else if (pick < 60)
+        {
+            NewArea(&walk);
+            EmitSceneChange(&walk, sSceneNos[Random(&walk.state) % sNumScenes], AreaBgm(&walk));
+        }
+        else if (pick < 70)
+        {
+            EmitBattle(&walk, sBattleBgms[Random(&walk.state) % sNumBattleBgms]);
+        }
+        else if (pick < 80)
+        {
+            EmitFieldBgm(&walk, AreaBgm(&walk));
+        }
+        else if (pick < 92 && CanRestore(&walk, SLOT_FIELD_BGM))
+        {
+            EmitSubScene(&walk, sSceneNos[Random(&walk.state) % sNumScenes]);
+        }
+        else
+        {
+            EmitBgmPlayerSeq(&walk, Random(&walk.state) % 2 ? sFanfares[Random(&walk.state) % sNumFanfares] : walk.bgm);
+        }
+        int frames = Random(&walk.state) % 4;
+        for (int i = 0; i < frames; i++)
+        {
+            Emit(&walk, STEP_FRAME, 0, 0, 0);
+        }
+    }
+}
+
+static int RunStep(const Variant * variant, const Step * step)
+{
+    switch (step->kind)
+    {
+    case STEP_SAVE_STATE:
+        variant->saveState(step->no);
+        return 0;
+    case STEP_LOAD_STATE:
+        variant->loadState(step->no);
+        return 0;
+    case STEP_LOAD:
+        return variant->load(step->type, step->no, step->loadFlag);
+    case STEP_START_SEQ:
+        return variant->startSeq(step->no);
+    case STEP_FRAME:
+        variant->frame();
+        return 0;
+    }
+    fatal_error("bad step");
+}
+
+static const char * const kStepNames[] = { "save", "restore", "load", "start", "frame" };
+
+// ---------------------------------------------------------------------------
+// Self-test
+
+typedef struct ReplayResult
+{
+    uint32_t steps;
+    uint32_t compares;      // heap comparisons made
+    uint32_t resultMismatches;
+    uint32_t heapMismatches;
+    uint32_t pendingAtFrame;
+} ReplayResult;
+
+static int sReported;
+
+static bool SameHeap(void)
+{
+    static SndHeapView base, plan;
+
+    Snd_GetHeap(SndBase_Heap(), &base);
+    Snd_GetHeap(SndPlan_Heap(), &plan);
+    return base.numSections == plan.numSections && base.freeSize == plan.freeSize && base.numBlocks == plan.numBlocks
+        && memcmp(base.blocks, plan.blocks, base.numBlocks * sizeof(SndHeapBlock)) == 0;
+}
+
+static int PendingLevel(void)
+{
+    SndPlannerStats stats;
+
+    SndPlan_GetPlannerStats(&stats);
+    return stats.pendingLevel;
+}
+
+// Each step goes to both builds. Loads and starts must give the same answer;
+// whenever the planner holds no restore back, and after every frame, the
+// heaps must be block for block the same.
+static void Replay(const Script * script, ReplayResult * result)
+{
+    for (int i = 0; i < script->numSteps; i++)
+    {
+        const Step * step = &script->steps[i];
+        int base = RunStep(&kVariants[0], step);
+        int plan = RunStep(&kVariants[1], step);
+        int pending = PendingLevel();
+
+        result->steps++;
+        if (base != plan)
+        {
+            result->resultMismatches++;
+            if (sReported++ < 5)
+            {
+                printf("  step %d, %s %u: %d from the base build, %d with the planner\n",
+                    i, kStepNames[step->kind], step->no, base, plan);
+            }
+        }
+        if (step->kind == STEP_FRAME && pending >= 0)
+        {
+            result->pendingAtFrame++;
+        }
+        if (pending < 0)
+        {
+            result->compares++;
+            if (!SameHeap())
+            {
+                result->heapMismatches++;
+                if (sReported++ < 5)
+                {
+                    printf("  step %d, %s %u: heaps differ\n", i, kStepNames[step->kind], step->no);
+                }
+            }
+        }
+    }
+}
+
+static void InitBoth(void)
+{
+    SndBase_Init();
+    SndPlan_Init();
+    Snd_ResetIo(SndBase_Heap());
+    Snd_ResetIo(SndPlan_Heap());
+}
+
+static int CheckReplay(int routines, uint32_t seed)
+{
+    Script script;
+    ReplayResult result = { 0 };
+    SndIo base, plan;
+    SndPlannerStats stats;
+    int failed = 0;
+
+    BuildScript(&script, routines, seed);
+    InitBoth();
+    Replay(&script, &result);
+    Snd_GetIo(SndBase_Heap(), &base);
+    Snd_GetIo(SndPlan_Heap(), &plan);
+    SndPlan_GetPlannerStats(&stats);
+    bool same = result.resultMismatches == 0 && result.heapMismatches == 0 && result.pendingAtFrame == 0;
+    printf("replay: %d routines, %u steps, %u heap comparisons, %s\n",
+        script.numRoutines, result.steps, result.compares, same ? "same" : "DIFFERENT");
+    failed += !same;
+    printf("replay: %u restores kept, %u loads skipped; %u of %u bytes read, lowest free %u of %u\n",
+        stats.keptStates, stats.skips, plan.bytesRead, base.bytesRead, plan.minFreeSize, base.minFreeSize);
+    // The planner must actually hold restores back, must never read more,
+    // and must never leave less of the heap free than the base build
+    failed += stats.keptStates == 0 || plan.bytesRead > base.bytesRead || plan.minFreeSize < base.minFreeSize;
+    failed += base.failedLoads != 0;
+    free(script.steps);
+    return failed;
+}
+
+static void RunBoth(const Step * steps, int numSteps)
+{
+    for (int i = 0; i < numSteps; i++)
+    {
+        RunStep(&kVariants[0], &steps[i]);
+        RunStep(&kVariants[1], &steps[i]);
+    }
+}
+
+// The cases the deferred GF_Snd_LoadState changes, one at a time
+static int CheckDeferral(void)
+{
+    Script script = { 0 };
+    Walk walk;
+    SndIo base, plan;
+    SndPlannerStats before, after;
+    int failed = 0;
+    int first = sFieldBgms[0], second = sFieldBgms[1], fanfare = sFanfares[0];
+
+    script.steps = malloc(sizeof(Step) * 64);
+    memset(&walk, 0, sizeof(walk));
+    walk.script = &script;
+    walk.numSections = 3;
+    walk.slotLevels[SLOT_BOOT] = 1;
+    walk.slotLevels[SLOT_GLOBAL] = 2;
+    InitBoth();
+    EmitSceneChange(&walk, 1, first);
+    RunBoth(script.steps, script.numSteps);
+
+    // The same BGM again: the restore is held back, the load finds the BGM
+    // still there, and the heap ends as the base build's does after freeing
+    // and reading it again
+    script.numSteps = 0;
+    EmitPlayBgm(&walk, first);
+    Snd_ResetIo(SndBase_Heap());
+    Snd_ResetIo(SndPlan_Heap());
+    SndPlan_GetPlannerStats(&before);
+    RunBoth(script.steps, script.numSteps);
+    SndPlan_GetPlannerStats(&after);
+    Snd_GetIo(SndBase_Heap(), &base);
+    Snd_GetIo(SndPlan_Heap(), &plan);
+    bool ok = after.keptStates == before.keptStates + 1 && plan.fileReads == 0 && plan.restores == 0
+        && base.fileReads != 0 && SameHeap();
+    printf("same BGM: %u files read by the base build, %u with the planner, restore %s\n",
+        base.fileReads, plan.fileReads, ok ? "kept" : "NOT KEPT");
+    failed += !ok;
+
+    // A different BGM: the held restore goes through before the load, and
+    // both builds read the same
+    script.numSteps = 0;
+    EmitPlayBgm(&walk, second);
+    Snd_ResetIo(SndBase_Heap());
+    Snd_ResetIo(SndPlan_Heap());
+    RunBoth(script.steps, script.numSteps);
+    Snd_GetIo(SndBase_Heap(), &base);
+    Snd_GetIo(SndPlan_Heap(), &plan);
+    ok = base.fileReads == plan.fileReads && base.bytesRead == plan.bytesRead && plan.restores == 1 && SameHeap();
+    printf("other BGM: %u files read by both builds, restore %s\n", plan.fileReads, ok ? "applied first" : "NOT APPLIED");
+    failed += !ok;
+
+    // A restore nothing claims, at the end of a fanfare: until the next frame
+    // the fanfare stays on the planner's heap, where a start would still find
+    // it; the frame frees it
+    script.numSteps = 0;
+    EmitFanfare(&walk, fanfare, 0);
+    RunBoth(script.steps, script.numSteps);
+    int pending = PendingLevel();
+    int baseSees = SndBase_StartSeq(fanfare);
+    int planSees = SndPlan_StartSeq(fanfare);
+    SndBase_Frame();
+    SndPlan_Frame();
+    ok = pending >= 0 && !baseSees && planSees && PendingLevel() < 0 && !SndPlan_StartSeq(fanfare) && SameHeap();
+    printf("unclaimed restore: fanfare %s until the frame, %s after it\n",
+        planSees ? "resident" : "freed", PendingLevel() < 0 && !SndPlan_StartSeq(fanfare) ? "freed" : "STILL RESIDENT");
+    failed += !ok;
+
+    // A save right after the restore applies it first
+    script.numSteps = 0;
+    EmitFanfare(&walk, fanfare, 0);
+    EmitFanfare(&walk, fanfare, 1);
+    RunBoth(script.steps, script.numSteps);
+    SndBase_Frame();
+    SndPlan_Frame();
+    ok = SameHeap();
+    printf("save after a held restore: heaps %s\n", ok ? "same" : "DIFFERENT");
+    failed += !ok;
+
+    // More loads above a level than the planner records: it stops holding
+    // restores back until that level is freed
+    script.numSteps = 0;
+    EmitRestore(&walk, SLOT_BGM);
+    for (int i = 0; i < 40; i++)
+    {
+        Emit(&walk, STEP_LOAD, SND_FILE_SEQ_EX, sSe[i], SND_LOAD_SEQ);
+    }
+    EmitRestore(&walk, SLOT_BGM);
+    RunBoth(script.steps, script.numSteps);
+    ok = PendingLevel() < 0 && SameHeap();
+    printf("overflow: restore %s\n", ok ? "applied at once" : "HELD BACK");
+    failed += !ok;
+
+    free(script.steps);
+    return failed;
+}
+
+static int CommandSelfTest(int routines, uint32_t seed)
+{
+    int failed = 0;
+
+    failed += CheckReplay(routines, seed);
+    failed += CheckDeferral();
+    printf("%d checks failed\n", failed);
+    return failed == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+// ---------------------------------------------------------------------------
+// Bench
+
+// The same walk through each build on its own: what reaches the card and how
+// low the heap gets
+static int CommandBench(int routines, uint32_t seed)
+{
+    Script script;
+
+    BuildScript(&script, routines, seed);
+    for (size_t v = 0; v < sizeof(kVariants) / sizeof(kVariants[0]); v++)
+    {
+        const Variant * variant = &kVariants[v];
+        SndIo io;
+        SndPlannerStats stats;
+
+        variant->init();
+        Snd_ResetIo(variant->heap());
+        double start = Now();
+        for (int i = 0; i < script.numSteps; i++)
+        {
+            RunStep(variant, &script.steps[i]);
+        }
+        double seconds = Now() - start;
+        Snd_GetIo(variant->heap(), &io);
+        variant->getPlannerStats(&stats);
+        printf("%-5s %d routines: %u loads, %u files, %u bytes read, %u restores, lowest free %u, "
+            "%u restores kept, %u loads skipped, %.0f ns/step\n",
+            variant->name, script.numRoutines, io.loadCalls, io.fileReads, io.bytesRead, io.restores, io.minFreeSize,
+            stats.keptStates, stats.skips, seconds * 1e9 / script.numSteps);
+    }
+    free(script.steps);
+    return EXIT_SUCCESS;
+}
+
+// ---------------------------------------------------------------------------
+
+static noreturn void Usage(const char * prog)
+{
+    fprintf(stderr,
+        "Usage: %s COMMAND [options]\n"
+        "Runs the GF_Snd_* heap calls from src/sound.c on the host, with and\n"
+        "without OPTIMIZE_SOUND_HEAP_RESIDENCY, over a model of the sound heap\n"
+        "and of the archive loader, replaying the call patterns of the BGM,\n"
+        "fanfare, scene and battle code in asm/.\n"
+        "Commands:\n"
+        "  selftest              check that both builds load the same, and leave\n"
+        "                        the same heap whenever no restore is held back\n"
+        "                        and after every frame; then the same BGM, other\n"
+        "                        BGM, unclaimed restore and overflow cases\n"
+        "  bench                 what each build reads from the card and how low\n"
+        "                        the heap gets over the same walk\n"
+        "Options:\n"
+        "  --routines N          routines in the walk (default %d)\n"
+        "  --seed N              walk seed\n",
+        prog, DEFAULT_ROUTINES);
+    exit(EXIT_FAILURE);
+}
+
+int main(int argc, char ** argv)
+{
+    if (argc < 2)
+    {
+        Usage(argv[0]);
+    }
+    const char * command = argv[1];
+    uint32_t routines = DEFAULT_ROUTINES;
+    uint32_t seed = 1;
+
+    for (int i = 2; i < argc; i++)
+    {
+        const char * opt = argv[i];
+        if (i + 1 >= argc)
+        {
+            Usage(argv[0]);
+        }
+        if (strcmp(opt, "--routines") == 0)
+        {
+            routines = ParseU32(argv[++i]);
+        }
+        else if (strcmp(opt, "--seed") == 0)
+        {
+            seed = ParseU32(argv[++i]);
+        }
+        else
+        {
+            Usage(argv[0]);
+        }
+    }
+    if (routines == 0 || routines > MAX_STEPS / 64 || seed == 0)
+    {
+        Usage(argv[0]);
+    }
+
+    const char * root = FindRoot();
+    if (root == NULL)
+    {
+        fatal_error("run sndsim from the repository or tools/sndsim");
+    }
+    LoadDefines(root);
+    BuildArchive();
+
+    if (strcmp(command, "selftest") == 0)
+    {
+        return CommandSelfTest(routines, seed);
+    }
+    if (strcmp(command, "bench") == 0)
+    {
+        return CommandBench(routines, seed);
+    }
+    Usage(argv[0]);
+}
@@ -0,0 +1,139 @@
+#ifndef GUARD_SNDSIM_SNDSIM_H
+#define GUARD_SNDSIM_SNDSIM_H
+
+// The boundary between the host side (main.c) and the objects built from the
+// game's sources (game.c, hostsnd.c and src/sound.c). Plain C types only, so
+// that both sides can include it with their own headers.
+
+#include <stdint.h>
+
+#define SND_MAX_SEQS            2560
+#define SND_MAX_BANKS           1024
+#define SND_MAX_WAVE_ARCS       1024
+#define SND_MAX_GROUPS          32
+#define SND_MAX_GROUP_ITEMS     48
+#define SND_MAX_WAVE_ARCS_PER_BANK 4
+#define SND_MAX_SECTIONS        16
+#define SND_MAX_BLOCKS          512
+
+// NNS_SND_ARC_LOAD_*, the loadFlag of NNS_SndArcLoadSeqEx
+#define SND_LOAD_SEQ            (1 << 0)
+#define SND_LOAD_BANK           (1 << 1)
+#define SND_LOAD_WAVE           (1 << 2)
+#define SND_LOAD_ALL            (SND_LOAD_SEQ | SND_LOAD_BANK | SND_LOAD_WAVE)
+
+// What a heap block holds, and the GF_Snd_Load* call a replay step makes
+enum
+{
+    SND_FILE_SEQ,
+    SND_FILE_BANK,
+    SND_FILE_WAVE_ARC,
+    SND_FILE_GROUP,         // a load step only; groups are not files
+    SND_FILE_PLAYER_HEAP,   // a heap block only
+    SND_FILE_SEQ_EX,        // a load step only: GF_Snd_LoadSeqEx
+};
+
+typedef struct SndSeqInfo
+{
+    uint32_t size;
+    uint16_t bank;
+} SndSeqInfo;
+
+typedef struct SndBankInfo
+{
+    uint32_t size;
+    int numWaveArcs;
+    uint16_t waveArcs[SND_MAX_WAVE_ARCS_PER_BANK];
+} SndBankInfo;
+
+typedef struct SndGroupItem
+{
+    uint8_t type;           // SND_FILE_SEQ, SND_FILE_BANK or SND_FILE_WAVE_ARC
+    uint16_t no;
+    uint32_t loadFlag;
+} SndGroupItem;
+
+typedef struct SndGroupInfo
+{
+    int numItems;
+    SndGroupItem items[SND_MAX_GROUP_ITEMS];
+} SndGroupInfo;
+
+// The sound archive's info block: which files there are, how big they are
+// and what each one needs loaded with it. A size of 0 means no such file.
+// The host owns the memory; it must outlive every call below.
+typedef struct SndArchive
+{
+    const SndSeqInfo * seqs;            // SND_MAX_SEQS entries
+    const SndBankInfo * banks;          // SND_MAX_BANKS entries
+    const uint32_t * waveArcSizes;      // SND_MAX_WAVE_ARCS entries
+    const SndGroupInfo * groups;        // SND_MAX_GROUPS entries
+} SndArchive;
+
+typedef struct SndHeapBlock
+{
+    uint8_t type;
+    uint8_t section;
+    uint16_t no;
+    uint32_t offset;
+    uint32_t size;
+} SndHeapBlock;
+
+// The sound heap as NNS_SndHeap* and the archive loader leave it
+typedef struct SndHeapView
+{
+    int numSections;
+    uint32_t freeSize;
+    int numBlocks;
+    SndHeapBlock blocks[SND_MAX_BLOCKS];
+} SndHeapView;
+
+// What reached the card and the heap since the last Snd_ResetIo
+typedef struct SndIo
+{
+    uint32_t loadCalls;         // NNS_SndArcLoad*
+    uint32_t fileReads;
+    uint32_t bytesRead;
+    uint32_t failedLoads;
+    uint32_t saves;             // NNS_SndHeapSaveState
+    uint32_t restores;          // NNS_SndHeapLoadState
+    uint32_t minFreeSize;
+} SndIo;
+
+// The residency planner's counters; all zero without it
+typedef struct SndPlannerStats
+{
+    uint32_t loads;
+    uint32_t skips;
+    uint32_t keptStates;
+    int pendingLevel;           // -1 if no restore is held back
+} SndPlannerStats;
+
+void Snd_SetArchive(const SndArchive * archive);
+
+// The heap and loader model in hostsnd.c; heap is the game's NNSSndHeapHandle
+void Snd_ResetIo(const void * heap);
+void Snd_GetIo(const void * heap, SndIo * io);
+void Snd_GetHeap(const void * heap, SndHeapView * view);
+int Snd_IsSeqLoaded(const void * heap, int seqNo);
+
+// sound.c is built twice, as it ships (SndBase_) and with
+// OPTIMIZE_SOUND_HEAP_RESIDENCY (SndPlan_). Init is InitSoundData and Frame
+// DoSoundUpdateFrame. SaveState and LoadState take the stateSaveDepth slot
+// the callers in asm/unk_02004A44.s and asm/unk_02005D10.s pass, and Load
+// makes one GF_Snd_Load* call. StartSeq is what NNS_SndArcPlayerStartSeqEx
+// finds: whether the sequence is on the sound heap.
+#define SND_DECLARE_VARIANT(prefix)                                         \
+    void prefix##Init(void);                                                \
+    void prefix##Frame(void);                                               \
+    void prefix##SaveState(int slot);                                       \
+    void prefix##LoadState(int slot);                                       \
+    int prefix##Load(int type, int no, uint32_t loadFlag);                  \
+    int prefix##StartSeq(int seqNo);                                        \
+    const void * prefix##Heap(void);                                        \
+    void prefix##GetPlannerStats(SndPlannerStats * stats);
+
+SND_DECLARE_VARIANT(SndBase_)
+SND_DECLARE_VARIANT(SndPlan_)
+
+#endif //GUARD_SNDSIM_SNDSIM_H
@@ -0,0 +1,48 @@
+// trainer_data.c as the game builds it, with or without
+// OPTIMIZE_TRAINER_DATA_CACHE. The Makefile compiles this file once per
+// variant with TRAINER_PREFIX set and hides everything but the functions
+// below, so that both copies of trainer_data.c can be linked into one
+// program.
+#include "../../src/trainer_data.c"
+
+#pragma GCC visibility push(default)
+#include "trainerbench.h"
+
+#define TRAINER_CAT_(a, b) a##b
+#define TRAINER_CAT(a, b) TRAINER_CAT_(a, b)
+#define TRAINER_FUNC(name) TRAINER_CAT(TRAINER_PREFIX, name)
+
+void TRAINER_FUNC(Open)(void) {
+#ifdef OPTIMIZE_TRAINER_DATA_CACHE
+    TrainerDataCache_Init(HEAP_ID_FIELD);
+#endif //OPTIMIZE_TRAINER_DATA_CACHE
+}
+
+void TRAINER_FUNC(Close)(void) {
+#ifdef OPTIMIZE_TRAINER_DATA_CACHE
+    TrainerDataCache_Free();
+#endif //OPTIMIZE_TRAINER_DATA_CACHE
+}
+
+void TRAINER_FUNC(ReadTrData)(uint32_t idx, void *dest) {
+    TrainerData_ReadTrData(idx, dest);
+}
+
+void TRAINER_FUNC(ReadTrPoke)(uint32_t idx, void *dest) {
+    TrainerData_ReadTrPoke(idx, dest);
+}
+
+int TRAINER_FUNC(GetAttr)(uint32_t idx, int attr) {
+    return TrainerData_GetAttr(idx, (TrainerAttr)attr);
+}
+
+void TRAINER_FUNC(GetCacheStats)(uint32_t *hits, uint32_t *misses) {
+#ifdef OPTIMIZE_TRAINER_DATA_CACHE
+    *hits = sTrainerDataCache != NULL ? sTrainerDataCache->hits : 0;
+    *misses = sTrainerDataCache != NULL ? sTrainerDataCache->misses : 0;
+#else
+    *hits = 0;
+    *misses = 0;
+#endif //OPTIMIZE_TRAINER_DATA_CACHE
+}
+#pragma GCC visibility pop
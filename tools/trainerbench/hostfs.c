@@ -0,0 +1,125 @@
+#include "global.h"
+#include "filesystem.h"
+#include "heap.h"
+#include "trainerbench.h"
+
+// The parts of heap.c and the NitroSDK file system that trainer_data.c and
+// filesystem.c call. filesystem.c itself is built unchanged, so every NARC
+// access goes through the same FS_OpenFile, FS_SeekFile and FS_ReadFile calls
+// as on the card; here they read the archive images the host built.
+
+#define HOST_MAX_BLOCKS     64
+
+typedef struct HostBlock {
+    void *ptr;
+    u32 size;
+} HostBlock;
+
+static const TrainerNarcs *sNarcs;
+static HostBlock sBlocks[HOST_MAX_BLOCKS];
+static int sNumBlocks;
+static u32 sUsed;
+static TrainerIo sIo;
+
+void Trainer_SetNarcs(const TrainerNarcs *narcs) {
+    sNarcs = narcs;
+}
+
+void Trainer_ResetIo(void) {
+    int i;
+
+    for (i = 0; i < sNumBlocks; i++) {
+        __builtin_free(sBlocks[i].ptr);
+    }
+    sNumBlocks = 0;
+    sUsed = 0;
+    MI_CpuFill8(&sIo, 0, sizeof(TrainerIo));
+}
+
+void Trainer_GetIo(TrainerIo *io) {
+    *io = sIo;
+    io->liveBlocks = sNumBlocks;
+}
+
+void *AllocFromHeap(HeapID heap_id, u32 size) {
+    void *ptr;
+
+    GF_ASSERT(heap_id == HEAP_ID_FIELD);
+    GF_ASSERT(sNumBlocks < HOST_MAX_BLOCKS);
+    ptr = __builtin_malloc(size);
+    GF_ASSERT(ptr != NULL);
+    // Fresh blocks hold garbage, as the game's heap does
+    __builtin_memset(ptr, 0xA5, size);
+    sBlocks[sNumBlocks].ptr = ptr;
+    sBlocks[sNumBlocks].size = size;
+    sNumBlocks++;
+    sUsed += size;
+    if (sUsed > sIo.peakUsed) {
+        sIo.peakUsed = sUsed;
+    }
+    return ptr;
+}
+
+void FreeToHeap(void *ptr) {
+    int i;
+
+    for (i = 0; i < sNumBlocks; i++) {
+        if (sBlocks[i].ptr == ptr) {
+            break;
+        }
+    }
+    GF_ASSERT(i < sNumBlocks);
+    sUsed -= sBlocks[i].size;
+    __builtin_free(ptr);
+    sBlocks[i] = sBlocks[--sNumBlocks];
+}
+
+// sNarcFileList names every archive a/X/Y/Z after its NarcId
+void FS_InitFile(FSFile *p_file) {
+    MI_CpuFill8(p_file, 0, sizeof(FSFile));
+}
+
+BOOL FS_OpenFile(FSFile *p_file, const char *path) {
+    u32 narcId;
+
+    GF_ASSERT(path[0] == 'a' && path[1] == '/' && path[3] == '/' && path[5] == '/' && path[7] == '\0');
+    narcId = (path[2] - '0') * 100 + (path[4] - '0') * 10 + (path[6] - '0');
+    GF_ASSERT(narcId == NARC_poketool_trainer_trdata || narcId == NARC_poketool_trainer_trpoke);
+    p_file->prop.file.own_id = narcId;
+    p_file->prop.file.top = 0;
+    p_file->prop.file.bottom = narcId == NARC_poketool_trainer_trdata ? sNarcs->trdataSize : sNarcs->trpokeSize;
+    p_file->prop.file.pos = 0;
+    sIo.opens++;
+    return TRUE;
+}
+
+BOOL FS_CloseFile(FSFile *p_file) {
+    p_file->prop.file.own_id = 0;
+    return TRUE;
+}
+
+BOOL FS_SeekFile(FSFile *p_file, s32 offset, FSSeekFileMode origin) {
+    GF_ASSERT(origin == FS_SEEK_SET);
+    GF_ASSERT(offset >= 0 && (u32)offset <= p_file->prop.file.bottom);
+    p_file->prop.file.pos = offset;
+    return TRUE;
+}
+
+int FS_ReadFile(FSFile *p_file, void *dst, s32 len) {
+    const u8 *image = p_file->prop.file.own_id == NARC_poketool_trainer_trdata ? sNarcs->trdata : sNarcs->trpoke;
+
+    GF_ASSERT(len >= 0 && p_file->prop.file.pos + len <= p_file->prop.file.bottom);
+    __builtin_memcpy(dst, image + p_file->prop.file.pos, len);
+    p_file->prop.file.pos += len;
+    sIo.reads++;
+    sIo.bytesRead += len;
+    return len;
+}
+
+void MI_CpuCopy8(const void *src, void *dest, u32 size) {
+    __builtin_memcpy(dest, src, size);
+}
+
+void MI_CpuFill8(void *dest, u8 data, u32 size) {
+    __builtin_memset(dest, data, size);
+}
@@ -0,0 +1,1031 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stdnoreturn.h>
+#include <stdarg.h>
+#include <ctype.h>
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
+#include <dirent.h>
+#include "trainerbench.h"
+
+// Where the tables are read from, relative to the repository root
+#define TRAINERS_JSON_PATH  "files/poketool/trainer/trainers.json"
+#define ZONE_EVENT_DIR      "files/fielddata/eventdata/zone_event"
+static const char * const kDefinePaths[] = {
+    "include/constants/trainers.h",
+    "include/constants/trainer_class.h",
+    "include/constants/items.h",
+    "include/constants/species.h",
+    "include/constants/moves.h",
+};
+
+#define MAX_TRAINERS        1024
+#define MAX_ROUTES          256
+#define MAX_ROUTE_TRAINERS  64
+#define MAX_DEFINES         8192
+#define MAX_NAME            64
+#define PARTY_SIZE          6
+
+#define DEFAULT_LAPS        4
+#define DEFAULT_TALK_BACK   25
+#define DEFAULT_OPEN_US     200.0
+#define DEFAULT_READ_US     20.0
+#define DEFAULT_CARD_MBPS   4.0
+
+// TrainerAttr in trainer_data.h
+enum
+{
+    TRATTR_TYPE,
+    TRATTR_CLASS,
+    TRATTR_UNK2,
+    TRATTR_NPOKE,
+    TRATTR_ITEM1,
+    TRATTR_ITEM2,
+    TRATTR_ITEM3,
+    TRATTR_ITEM4,
+    TRATTR_AIFLAGS,
+    TRATTR_DOUBLEBTL,
+    TRATTR_COUNT,
+};
+
+typedef struct Define
+{
+    char name[MAX_NAME];
+    int value;
+} Define;
+
+typedef struct TrainerMon
+{
+    int difficulty;
+    int genderOverride;
+    int abilityOverride;
+    int level;
+    int species;
+    bool hasItem;
+    int item;
+    bool hasMoves;
+    int numMoves;
+    int moves[4];
+    int capsule;
+} TrainerMon;
+
+typedef struct Trainer
+{
+    int type;
+    int trainerClass;
+    int numItems;
+    int items[4];
+    uint32_t aiFlags;
+    uint32_t doubleBattle;
+    int numMons;
+    TrainerMon mons[PARTY_SIZE];
+} Trainer;
+
+// The trainers a map's events place, in event order. Double battle partners,
+// which name the same trainer through std_trainer_2, are not repeated.
+typedef struct Route
+{
+    char name[MAX_NAME];
+    int numTrainers;
+    uint16_t trainers[MAX_ROUTE_TRAINERS];
+} Route;
+
+typedef struct Variant
+{
+    const char * name;
+    void (*open)(void);
+    void (*close)(void);
+    void (*readTrData)(uint32_t idx, void * dest);
+    void (*readTrPoke)(uint32_t idx, void * dest);
+    int (*getAttr)(uint32_t idx, int attr);
+    void (*getCacheStats)(uint32_t * hits, uint32_t * misses);
+} Variant;
+
+typedef struct ReplayConfig
+{
+    uint32_t laps;
+    uint32_t talkBack;
+    uint32_t seed;
+    double openUs;
+    double readUs;
+    double cardMBps;
+} ReplayConfig;
+
+typedef struct ReplayResult
+{
+    uint32_t battles;
+    uint32_t queries;
+    TrainerIo io;
+    uint32_t hits;
+    uint32_t misses;
+    double seconds;
+} ReplayResult;
+
+static const Variant kVariants[] = {
+    { "uncached", TrainerBase_Open, TrainerBase_Close, TrainerBase_ReadTrData, TrainerBase_ReadTrPoke, TrainerBase_GetAttr, TrainerBase_GetCacheStats },
+    { "cached", TrainerCache_Open, TrainerCache_Close, TrainerCache_ReadTrData, TrainerCache_ReadTrPoke, TrainerCache_GetAttr, TrainerCache_GetCacheStats },
+};
+
+static int sNumDefines;
+static Define sDefines[MAX_DEFINES];
+static int sNumTrainers;
+static Trainer sTrainers[MAX_TRAINERS];
+static int sNumRoutes;
+static Route sRoutes[MAX_ROUTES];
+static TrainerNarcs sNarcs;
+
+static inline noreturn __attribute__((format(printf, 1, 2))) void fatal_error(const char * message, ...)
+{
+    va_list va_args;
+    va_start(va_args, message);
+    fputs("Error: ", stderr);
+    vfprintf(stderr, message, va_args);
+    fputc('\n', stderr);
+    va_end(va_args);
+    exit(EXIT_FAILURE);
+}
+
+// GF_ASSERT in the game objects, which are built with PM_KEEP_ASSERTS
+void GF_AssertFail(void)
+{
+    fatal_error("GF_ASSERT failed in the game code");
+}
+
+static uint32_t ParseU32(const char * arg)
+{
+    char * end;
+    unsigned long long val = strtoull(arg, &end, 0);
+    if (*arg == '\0' || *end != '\0' || val > 0xFFFFFFFFull)
+    {
+        fatal_error("invalid number: %s", arg);
+    }
+    return (uint32_t)val;
+}
+
+static double ParseDouble(const char * arg)
+{
+    char * end;
+    double val = strtod(arg, &end);
+    if (*arg == '\0' || *end != '\0' || !(val > 0))
+    {
+        fatal_error("invalid number: %s", arg);
+    }
+    return val;
+}
+
+static double Now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static uint32_t Random(uint32_t * state)
+{
+    uint32_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return *state = x;
+}
+
+// ---------------------------------------------------------------------------
+// Game data
+
+static void * ReadWholeFile(const char * root, const char * relPath, size_t * size)
+{
+    char path[4096];
+    snprintf(path, sizeof(path), "%s/%s", root, relPath);
+    FILE * file = fopen(path, "rb");
+    if (file == NULL)
+    {
+        fatal_error("%s: %s", path, strerror(errno));
+    }
+    fseek(file, 0, SEEK_END);
+    long length = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    uint8_t * buffer = malloc(length + 1);
+    if (buffer == NULL)
+    {
+        fatal_error("out of memory reading %s", path);
+    }
+    if (fread(buffer, 1, length, file) != (size_t)length)
+    {
+        fatal_error("%s: short read", path);
+    }
+    fclose(file);
+    buffer[length] = '\0';
+    *size = length;
+    return buffer;
+}
+
+static const char * FindRoot(void)
+{
+    static const char * const candidates[] = { ".", "..", "../.." };
+    for (size_t i = 0; i < sizeof(candidates) / sizeof(candidates[0]); i++)
+    {
+        char path[4096];
+        snprintf(path, sizeof(path), "%s/%s", candidates[i], TRAINERS_JSON_PATH);
+        if (access(path, R_OK) == 0)
+        {
+            return candidates[i];
+        }
+    }
+    return NULL;
+}
+
+static int CompareDefines(const void * a, const void * b)
+{
+    return strcmp(((const Define *)a)->name, ((const Define *)b)->name);
+}
+
+// Every "#define NAME NUMBER" in the constants headers, where NUMBER may be
+// in parentheses
+static void LoadDefines(const char * root)
+{
+    for (size_t f = 0; f < sizeof(kDefinePaths) / sizeof(kDefinePaths[0]); f++)
+    {
+        size_t size;
+        char * text = ReadWholeFile(root, kDefinePaths[f], &size);
+        for (char * line = text; line != NULL && *line != '\0';)
+        {
+            char * next = strchr(line, '\n');
+            char name[MAX_NAME];
+            char value[MAX_NAME];
+            if (sscanf(line, "#define %63s %63[(0-9a-fA-FxX)]", name, value) == 2)
+            {
+                char * digits = value;
+                char * end;
+                while (*digits == '(')
+                {
+                    digits++;
+                }
+                long val = strtol(digits, &end, 0);
+                while (*end == ')')
+                {
+                    end++;
+                }
+                if (end != digits && *end == '\0')
+                {
+                    if (sNumDefines >= MAX_DEFINES)
+                    {
+                        fatal_error("more than %d constants", MAX_DEFINES);
+                    }
+                    strcpy(sDefines[sNumDefines].name, name);
+                    sDefines[sNumDefines].value = (int)val;
+                    sNumDefines++;
+                }
+            }
+            line = next != NULL ? next + 1 : NULL;
+        }
+        free(text);
+    }
+    qsort(sDefines, sNumDefines, sizeof(Define), CompareDefines);
+}
+
+static int LookUp(const char * name)
+{
+    Define key;
+    if (strlen(name) >= MAX_NAME)
+    {
+        fatal_error("unknown constant %s", name);
+    }
+    strcpy(key.name, name);
+    const Define * found = bsearch(&key, sDefines, sNumDefines, sizeof(Define), CompareDefines);
+    if (found == NULL)
+    {
+        fatal_error("unknown constant %s", name);
+    }
+    return found->value;
+}
+
+// The TRTYPE_ values are expressions of two flags
+static int LookUpTrainerType(const char * name)
+{
+    static const char * const kTypes[] = { "TRTYPE_MON", "TRTYPE_MON_MOVES", "TRTYPE_MON_ITEM", "TRTYPE_MON_ITEM_MOVES" };
+    for (int i = 0; i < 4; i++)
+    {
+        if (strcmp(name, kTypes[i]) == 0)
+        {
+            return i;
+        }
+    }
+    fatal_error("unknown trainer type %s", name);
+}
+
+// A value that is a quoted constant or a number
+static int ParseValue(const char * text)
+{
+    char name[MAX_NAME];
+    int value;
+    if (sscanf(text, " \"%63[A-Z0-9_]\"", name) == 1)
+    {
+        return LookUp(name);
+    }
+    if (sscanf(text, " %d", &value) == 1)
+    {
+        return value;
+    }
+    fatal_error("%s: cannot parse %.20s", TRAINERS_JSON_PATH, text);
+}
+
+// trainers.json as jsonproc sees it. It is generated with one key per line,
+// so this reads it line by line rather than parsing JSON in general.
+static void LoadTrainers(const char * root)
+{
+    size_t size;
+    char * text = ReadWholeFile(root, TRAINERS_JSON_PATH, &size);
+    Trainer * trainer = NULL;
+    TrainerMon * mon = NULL;
+    enum { LIST_NONE, LIST_ITEMS, LIST_MOVES, LIST_MESSAGES } list = LIST_NONE;
+
+    for (char * line = text; line != NULL && *line != '\0';)
+    {
+        char * next = strchr(line, '\n');
+        char key[MAX_NAME];
+        char name[MAX_NAME];
+        int offset = 0;
+        if (next != NULL)
+        {
+            *next = '\0';
+        }
+        while (isspace((unsigned char)*line))
+        {
+            line++;
+        }
+
+        if (list == LIST_ITEMS || list == LIST_MOVES)
+        {
+            if (*line == ']')
+            {
+                list = LIST_NONE;
+            }
+            else if (sscanf(line, "\"%63[A-Z0-9_]\"", name) == 1)
+            {
+                if (list == LIST_ITEMS && trainer->numItems < 4)
+                {
+                    trainer->items[trainer->numItems++] = LookUp(name);
+                }
+                else if (list == LIST_MOVES && mon->numMoves < 4)
+                {
+                    mon->moves[mon->numMoves++] = LookUp(name);
+                }
+                else
+                {
+                    fatal_error("%s: too many items or moves", TRAINERS_JSON_PATH);
+                }
+            }
+        }
+        else if (sscanf(line, "\"%63[a-zA-Z_]\": %n", key, &offset) == 1 && offset != 0)
+        {
+            const char * value = line + offset;
+            if (strcmp(key, "type") == 0 && strncmp(value, "\"TRTYPE_", 8) == 0)
+            {
+                if (sNumTrainers >= MAX_TRAINERS)
+                {
+                    fatal_error("%s: more than %d trainers", TRAINERS_JSON_PATH, MAX_TRAINERS);
+                }
+                trainer = &sTrainers[sNumTrainers++];
+                sscanf(value, "\"%63[A-Z_]\"", name);
+                trainer->type = LookUpTrainerType(name);
+                mon = NULL;
+                list = LIST_NONE;
+            }
+            else if (list == LIST_MESSAGES || trainer == NULL)
+            {
+                // Messages go to the trainer's text bank, not to trdata
+            }
+            else if (strcmp(key, "class") == 0)
+            {
+                trainer->trainerClass = ParseValue(value);
+            }
+            else if (strcmp(key, "items") == 0)
+            {
+                list = *value == '[' && value[1] != ']' ? LIST_ITEMS : LIST_NONE;
+            }
+            else if (strcmp(key, "ai_flags") == 0)
+            {
+                trainer->aiFlags = ParseValue(value);
+            }
+            else if (strcmp(key, "double") == 0)
+            {
+                trainer->doubleBattle = ParseValue(value);
+            }
+            else if (strcmp(key, "messages") == 0)
+            {
+                list = LIST_MESSAGES;
+            }
+            else if (strcmp(key, "difficulty") == 0)
+            {
+                if (trainer->numMons >= PARTY_SIZE)
+                {
+                    fatal_error("%s: trainer %d has more than %d mons", TRAINERS_JSON_PATH, sNumTrainers - 1, PARTY_SIZE);
+                }
+                mon = &trainer->mons[trainer->numMons++];
+                mon->difficulty = ParseValue(value);
+            }
+            else if (mon == NULL)
+            {
+                // name, party
+            }
+            else if (strcmp(key, "genderOverride") == 0)
+            {
+                mon->genderOverride = ParseValue(value);
+            }
+            else if (strcmp(key, "abilityOverride") == 0)
+            {
+                mon->abilityOverride = ParseValue(value);
+            }
+            else if (strcmp(key, "level") == 0)
+            {
+                mon->level = ParseValue(value);
+            }
+            else if (strcmp(key, "species") == 0)
+            {
+                mon->species = ParseValue(value);
+            }
+            else if (strcmp(key, "item") == 0)
+            {
+                mon->hasItem = true;
+                mon->item = ParseValue(value);
+            }
+            else if (strcmp(key, "moves") == 0)
+            {
+                mon->hasMoves = true;
+                list = *value == '[' && value[1] != ']' ? LIST_MOVES : LIST_NONE;
+            }
+            else if (strcmp(key, "capsule") == 0)
+            {
+                mon->capsule = ParseValue(value);
+            }
+        }
+        line = next != NULL ? next + 1 : NULL;
+    }
+    free(text);
+    if (sNumTrainers == 0)
+    {
+        fatal_error("%s: no trainers", TRAINERS_JSON_PATH);
+    }
+}
+
+static int CompareNames(const void * a, const void * b)
+{
+    return strcmp(*(const char * const *)a, *(const char * const *)b);
+}
+
+static void LoadRoutes(const char * root)
+{
+    char path[4096];
+    snprintf(path, sizeof(path), "%s/%s", root, ZONE_EVENT_DIR);
+    DIR * dir = opendir(path);
+    if (dir == NULL)
+    {
+        fatal_error("%s: %s", path, strerror(errno));
+    }
+    char * names[2048];
+    int numNames = 0;
+    struct dirent * entry;
+    while ((entry = readdir(dir)) != NULL)
+    {
+        size_t len = strlen(entry->d_name);
+        if (len > 5 && strcmp(entry->d_name + len - 5, ".json") == 0 && numNames < 2048)
+        {
+            names[numNames++] = strdup(entry->d_name);
+        }
+    }
+    closedir(dir);
+    qsort(names, numNames, sizeof(char *), CompareNames);
+
+    for (int i = 0; i < numNames; i++)
+    {
+        char relPath[4096];
+        size_t size;
+        snprintf(relPath, sizeof(relPath), "%s/%s", ZONE_EVENT_DIR, names[i]);
+        char * text = ReadWholeFile(root, relPath, &size);
+        Route * route = &sRoutes[sNumRoutes];
+        route->numTrainers = 0;
+        for (char * p = strstr(text, "std_trainer(TRAINER_"); p != NULL; p = strstr(p + 1, "std_trainer(TRAINER_"))
+        {
+            char name[MAX_NAME];
+            if (sscanf(p, "std_trainer(%63[A-Z0-9_])", name) == 1 && route->numTrainers < MAX_ROUTE_TRAINERS)
+            {
+                int trainer = LookUp(name);
+                if (trainer <= 0 || trainer >= sNumTrainers)
+                {
+                    fatal_error("%s: %s is not in %s", relPath, name, TRAINERS_JSON_PATH);
+                }
+                route->trainers[route->numTrainers++] = trainer;
+            }
+        }
+        if (route->numTrainers > 0)
+        {
+            snprintf(route->name, sizeof(route->name), "%.*s", (int)(strlen(names[i]) - 5), names[i]);
+            if (++sNumRoutes >= MAX_ROUTES)
+            {
+                fatal_error("more than %d maps with trainers", MAX_ROUTES);
+            }
+        }
+        free(text);
+        free(names[i]);
+    }
+    if (sNumRoutes == 0)
+    {
+        fatal_error("%s: no maps with trainers", ZONE_EVENT_DIR);
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Archives
+
+typedef struct Buffer
+{
+    uint8_t * data;
+    uint32_t size;
+    uint32_t capacity;
+} Buffer;
+
+static void Put(Buffer * buf, const void * data, uint32_t size)
+{
+    if (buf->size + size > buf->capacity)
+    {
+        buf->capacity = (buf->size + size) * 2;
+        buf->data = realloc(buf->data, buf->capacity);
+        if (buf->data == NULL)
+        {
+            fatal_error("out of memory");
+        }
+    }
+    memcpy(buf->data + buf->size, data, size);
+    buf->size += size;
+}
+
+static void Put8(Buffer * buf, uint32_t value)
+{
+    uint8_t bytes[1] = { value };
+    Put(buf, bytes, 1);
+}
+
+static void Put16(Buffer * buf, uint32_t value)
+{
+    uint8_t bytes[2] = { value, value >> 8 };
+    Put(buf, bytes, 2);
+}
+
+static void Put32(Buffer * buf, uint32_t value)
+{
+    uint8_t bytes[4] = { value, value >> 8, value >> 16, value >> 24 };
+    Put(buf, bytes, 4);
+}
+
+// As trdata.json.txt lays out TRAINER_FILE
+static void PutTrData(Buffer * buf, const Trainer * trainer)
+{
+    Put8(buf, trainer->type);
+    Put8(buf, trainer->trainerClass);
+    Put8(buf, 0);
+    Put8(buf, trainer->numMons);
+    for (int i = 0; i < 4; i++)
+    {
+        Put16(buf, i < trainer->numItems ? trainer->items[i] : 0);
+    }
+    Put32(buf, trainer->aiFlags);
+    Put32(buf, trainer->doubleBattle);
+}
+
+// As trpoke.json.txt lays out each mon
+static void PutTrPoke(Buffer * buf, const Trainer * trainer)
+{
+    for (int i = 0; i < trainer->numMons; i++)
+    {
+        const TrainerMon * mon = &trainer->mons[i];
+        Put8(buf, mon->difficulty);
+        Put8(buf, mon->genderOverride | (mon->abilityOverride << 4));
+        Put16(buf, mon->level);
+        Put16(buf, mon->species);
+        if (mon->hasItem)
+        {
+            Put16(buf, mon->item);
+        }
+        if (mon->hasMoves)
+        {
+            for (int j = 0; j < 4; j++)
+            {
+                Put16(buf, j < mon->numMoves ? mon->moves[j] : 0);
+            }
+        }
+        Put16(buf, mon->capsule);
+    }
+    if (trainer->numMons == 0)
+    {
+        Put32(buf, 0);
+        Put32(buf, 0);
+    }
+}
+
+// A NARC as o2narc writes it: members padded to words with 0, no names
+static void BuildNarc(void (*put)(Buffer *, const Trainer *), const uint8_t ** image, uint32_t * imageSize)
+{
+    Buffer members = { 0 };
+    Buffer narc = { 0 };
+    uint32_t * offsets = malloc((sNumTrainers + 1) * sizeof(uint32_t));
+    if (offsets == NULL)
+    {
+        fatal_error("out of memory");
+    }
+    for (int i = 0; i < sNumTrainers; i++)
+    {
+        offsets[i] = members.size;
+        put(&members, &sTrainers[i]);
+        while (members.size % 4 != 0)
+        {
+            Put8(&members, 0);
+        }
+    }
+    offsets[sNumTrainers] = members.size;
+
+    uint32_t btafSize = 12 + 8 * sNumTrainers;
+    uint32_t btnfSize = 16;
+    uint32_t gmifSize = 8 + members.size;
+    Put(&narc, "NARC", 4);
+    Put16(&narc, 0xFFFE);
+    Put16(&narc, 0x0100);
+    Put32(&narc, 16 + btafSize + btnfSize + gmifSize);
+    Put16(&narc, 16);
+    Put16(&narc, 3);
+    Put(&narc, "BTAF", 4);
+    Put32(&narc, btafSize);
+    Put16(&narc, sNumTrainers);
+    Put16(&narc, 0);
+    for (int i = 0; i < sNumTrainers; i++)
+    {
+        Put32(&narc, offsets[i]);
+        Put32(&narc, offsets[i + 1]);
+    }
+    Put(&narc, "BTNF", 4);
+    Put32(&narc, btnfSize);
+    Put32(&narc, 4);
+    Put16(&narc, 0);
+    Put16(&narc, 1);
+    Put(&narc, "GMIF", 4);
+    Put32(&narc, gmifSize);
+    Put(&narc, members.data, members.size);
+
+    free(members.data);
+    free(offsets);
+    *image = narc.data;
+    *imageSize = narc.size;
+}
+
+static void LoadGameData(const char * root)
+{
+    LoadDefines(root);
+    LoadTrainers(root);
+    LoadRoutes(root);
+    BuildNarc(PutTrData, &sNarcs.trdata, &sNarcs.trdataSize);
+    BuildNarc(PutTrPoke, &sNarcs.trpoke, &sNarcs.trpokeSize);
+    Trainer_SetNarcs(&sNarcs);
+}
+
+// ---------------------------------------------------------------------------
+// Replay
+
+// What the game asks of trainer_data.c when the player meets, battles and
+// later talks to a trainer, from the script and field code that call it:
+//   TrainerNumIsDouble, from the sight check in the field
+//   trainer_is_double_battle, encounter_music (TRATTR_CLASS) and
+//     get_trainer_msg_params, from the trainer's script
+//   EnemyTrainerSet_Init and CreateNPCTrainerParty: TrData, then TrPoke
+//   CalcPrizeMoney after the win: TrData, then TrPoke
+// A double battle's partner is a second map object with the same trainer,
+// whose sight check asks again, and ov26 asks once more to find it.
+static uint32_t Meet(const Variant * variant, uint32_t trainer, uint8_t * trData, uint8_t * trPoke)
+{
+    uint32_t queries = 0;
+    bool isDouble = variant->getAttr(trainer, TRATTR_DOUBLEBTL) != 0;
+
+    queries++;
+    if (isDouble)
+    {
+        variant->getAttr(trainer, TRATTR_DOUBLEBTL);
+        variant->getAttr(trainer, TRATTR_DOUBLEBTL);
+        queries += 2;
+    }
+    variant->getAttr(trainer, TRATTR_DOUBLEBTL);
+    variant->getAttr(trainer, TRATTR_CLASS);
+    variant->getAttr(trainer, TRATTR_DOUBLEBTL);
+    variant->readTrData(trainer, trData);
+    variant->readTrPoke(trainer, trPoke);
+    variant->readTrData(trainer, trData);
+    variant->readTrPoke(trainer, trPoke);
+    return queries + 7;
+}
+
+// Every map with trainers, in zone order: battle each trainer in event order,
+// then walk back and talk to TALKBACK percent of them again, which asks
+// get_trainer_msg_params for the after-battle text. The field system, and
+// with it the cache, lives for the whole replay.
+static void RunReplay(const Variant * variant, const ReplayConfig * config, ReplayResult * result)
+{
+    static uint8_t trData[TRAINER_SIZE];
+    static uint8_t trPoke[TRPOKE_BUFFER_SIZE];
+    uint32_t state = config->seed ? config->seed : 1;
+
+    Trainer_ResetIo();
+    memset(result, 0, sizeof(*result));
+
+    double start = Now();
+    variant->open();
+    for (uint32_t lap = 0; lap < config->laps; lap++)
+    {
+        for (int r = 0; r < sNumRoutes; r++)
+        {
+            const Route * route = &sRoutes[r];
+            for (int i = 0; i < route->numTrainers; i++)
+            {
+                result->queries += Meet(variant, route->trainers[i], trData, trPoke);
+                result->battles++;
+            }
+            for (int i = route->numTrainers - 1; i >= 0; i--)
+            {
+                if (Random(&state) % 100 < config->talkBack)
+                {
+                    variant->getAttr(route->trainers[i], TRATTR_DOUBLEBTL);
+                    result->queries++;
+                }
+            }
+        }
+    }
+    variant->getCacheStats(&result->hits, &result->misses);
+    variant->close();
+    result->seconds = Now() - start;
+    Trainer_GetIo(&result->io);
+}
+
+static double CardMs(const ReplayConfig * config, const ReplayResult * result)
+{
+    return (result->io.opens * config->openUs + result->io.reads * config->readUs
+            + result->io.bytesRead / config->cardMBps) / 1000.0;
+}
+
+static int CommandReplay(const ReplayConfig * config)
+{
+    ReplayResult results[2];
+
+    printf("%d maps with trainers, %u laps, %u%% talked to again, seed %u\n",
+           sNumRoutes, config->laps, config->talkBack, config->seed);
+    printf("card modelled at %.0f us per open, %.0f us per read and %.1f MB/s\n\n",
+           config->openUs, config->readUs, config->cardMBps);
+    printf("%-10s %8s %8s %8s %10s %10s %10s %10s %10s\n",
+           "", "battles", "queries", "opens", "reads", "bytes", "card ms", "host us", "peak heap");
+    for (int v = 0; v < 2; v++)
+    {
+        RunReplay(&kVariants[v], config, &results[v]);
+        const ReplayResult * r = &results[v];
+        printf("%-10s %8u %8u %8u %10u %10u %10.1f %10.1f %#10x\n",
+               kVariants[v].name, r->battles, r->queries, r->io.opens, r->io.reads, r->io.bytesRead,
+               CardMs(config, r), r->seconds * 1e6, r->io.peakUsed);
+        if (r->io.liveBlocks != 0)
+        {
+            fatal_error("%s: %u blocks still allocated after the field closed", kVariants[v].name, r->io.liveBlocks);
+        }
+    }
+    printf("\ncache: %u hits, %u misses (16-bit counters)\n", results[1].hits, results[1].misses);
+    printf("card time saved: %.1f%%\n", 100.0 * (1.0 - CardMs(config, &results[1]) / CardMs(config, &results[0])));
+    return EXIT_SUCCESS;
+}
+
+// ---------------------------------------------------------------------------
+// Self-test
+
+// Both variants read into buffers filled with the same guard bytes, so a
+// read that writes more or less of the caller's buffer than the NARC read
+// does shows up as well as one that writes different data
+static int sReported;
+
+static int CompareOne(const char * what, uint32_t trainer)
+{
+    static uint8_t base[TRPOKE_BUFFER_SIZE], cache[TRPOKE_BUFFER_SIZE];
+    int failures = 0;
+
+    memset(base, 0xCD, sizeof(base));
+    memset(cache, 0xCD, sizeof(cache));
+    TrainerBase_ReadTrData(trainer, base);
+    TrainerCache_ReadTrData(trainer, cache);
+    if (memcmp(base, cache, sizeof(base)) != 0)
+    {
+        if (failures++ == 0 && sReported++ < 5)
+        {
+            printf("  %s: trainer %u: TrData differs\n", what, trainer);
+        }
+    }
+    memset(base, 0xCD, sizeof(base));
+    memset(cache, 0xCD, sizeof(cache));
+    TrainerBase_ReadTrPoke(trainer, base);
+    TrainerCache_ReadTrPoke(trainer, cache);
+    if (memcmp(base, cache, sizeof(base)) != 0)
+    {
+        if (failures++ == 0 && sReported++ < 5)
+        {
+            printf("  %s: trainer %u: TrPoke differs\n", what, trainer);
+        }
+    }
+    for (int attr = 0; attr < TRATTR_COUNT; attr++)
+    {
+        if (TrainerBase_GetAttr(trainer, attr) != TrainerCache_GetAttr(trainer, attr))
+        {
+            if (failures++ == 0 && sReported++ < 5)
+            {
+                printf("  %s: trainer %u: attribute %d differs\n", what, trainer, attr);
+            }
+        }
+    }
+    return failures;
+}
+
+static int CheckEquivalence(void)
+{
+    int failed = 0;
+    int failures = 0;
+    uint32_t state = 0x5EED;
+
+    Trainer_ResetIo();
+    TrainerBase_Open();
+    TrainerCache_Open();
+
+    // Every trainer twice, so each is read both fresh and from the cache
+    for (int pass = 0; pass < 2; pass++)
+    {
+        for (int i = 0; i < sNumTrainers; i++)
+        {
+            failures += CompareOne("every trainer", i);
+        }
+    }
+    printf("every trainer: %d trainers, %s\n", sNumTrainers, failures ? "MISMATCH" : "same");
+    failed += failures != 0;
+
+    // Mostly a few trainers, so the cache both hits and evicts
+    failures = 0;
+    for (int i = 0; i < 20000; i++)
+    {
+        uint32_t trainer = Random(&state) % 8 != 0 ? Random(&state) % 6 + 100 : Random(&state) % sNumTrainers;
+        failures += CompareOne("random", trainer);
+    }
+    uint32_t hits, misses;
+    TrainerCache_GetCacheStats(&hits, &misses);
+    printf("random: 20000 lookups, %u hits, %u misses, %s\n", hits, misses, failures ? "MISMATCH" : "same");
+    failed += failures != 0 || hits == 0;
+
+    TrainerCache_Close();
+    TrainerBase_Close();
+    TrainerIo io;
+    Trainer_GetIo(&io);
+    printf("heap %s after the field closed\n", io.liveBlocks == 0 ? "empty" : "NOT EMPTY");
+    failed += io.liveBlocks != 0;
+    return failed;
+}
+
+// Without a field system the cache is not there, and reads go to the NARC
+static int CheckOutsideField(void)
+{
+    TrainerIo base, cache;
+    uint8_t buf[TRPOKE_BUFFER_SIZE];
+
+    Trainer_ResetIo();
+    TrainerBase_ReadTrData(8, buf);
+    TrainerBase_ReadTrPoke(8, buf);
+    Trainer_GetIo(&base);
+    Trainer_ResetIo();
+    TrainerCache_ReadTrData(8, buf);
+    TrainerCache_ReadTrPoke(8, buf);
+    Trainer_GetIo(&cache);
+
+    bool same = base.opens == cache.opens && base.reads == cache.reads && cache.liveBlocks == 0;
+    printf("outside the field: %u reads uncached, %u cached%s\n", base.reads, cache.reads, same ? "" : ", DIFFERENT");
+    return !same;
+}
+
+static int CommandSelfTest(void)
+{
+    int failed = 0;
+
+    failed += CheckEquivalence();
+    failed += CheckOutsideField();
+
+    ReplayConfig config = {
+        .laps = 1, .talkBack = DEFAULT_TALK_BACK, .seed = 0x5EED,
+        .openUs = DEFAULT_OPEN_US, .readUs = DEFAULT_READ_US, .cardMBps = DEFAULT_CARD_MBPS,
+    };
+    ReplayResult base, cache;
+    RunReplay(&kVariants[0], &config, &base);
+    RunReplay(&kVariants[1], &config, &cache);
+    bool fewer = cache.io.opens * 2 < base.io.opens;
+    bool freed = base.io.liveBlocks == 0 && cache.io.liveBlocks == 0;
+    printf("replay: %u opens uncached, %u cached%s\n", base.io.opens, cache.io.opens, fewer ? "" : ", NOT FEWER");
+    printf("replay: heap %s after the field closed\n", freed ? "empty" : "NOT EMPTY");
+    failed += !fewer + !freed;
+
+    printf("%d checks failed\n", failed);
+    return failed == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+// ---------------------------------------------------------------------------
+
+static noreturn void Usage(const char * prog)
+{
+    fprintf(stderr,
+        "Usage: %s COMMAND [options]\n"
+        "Runs src/trainer_data.c and src/filesystem.c on the host, with and\n"
+        "without OPTIMIZE_TRAINER_DATA_CACHE, over trdata and trpoke archives\n"
+        "built from trainers.json.\n"
+        "Commands:\n"
+        "  replay                battle every trainer on every map, in event\n"
+        "                        order, and compare card opens, reads and bytes\n"
+        "  selftest              check that both builds return the same bytes for\n"
+        "                        every trainer and that the cache reads less,\n"
+        "                        only while the field exists, without leaking\n"
+        "Options:\n"
+        "  --laps N              times round every map (default %d)\n"
+        "  --talk-back N         percent of trainers talked to again after the\n"
+        "                        battles on a map (default %d)\n"
+        "  --seed N              talk-back seed\n"
+        "  --open-us X           modelled cost of opening a file (default %g)\n"
+        "  --read-us X           modelled cost of starting a read (default %g)\n"
+        "  --card-mbps X         modelled card throughput (default %g)\n",
+        prog, DEFAULT_LAPS, DEFAULT_TALK_BACK, DEFAULT_OPEN_US, DEFAULT_READ_US, DEFAULT_CARD_MBPS);
+    exit(EXIT_FAILURE);
+}
+
+int main(int argc, char ** argv)
+{
+    if (argc < 2)
+    {
+        Usage(argv[0]);
+    }
+    const char * command = argv[1];
+    ReplayConfig config = {
+        .laps = DEFAULT_LAPS, .talkBack = DEFAULT_TALK_BACK, .seed = 1,
+        .openUs = DEFAULT_OPEN_US, .readUs = DEFAULT_READ_US, .cardMBps = DEFAULT_CARD_MBPS,
+    };
+
+    for (int i = 2; i < argc; i++)
+    {
+        const char * opt = argv[i];
+        if (i + 1 >= argc)
+        {
+            Usage(argv[0]);
+        }
+        if (strcmp(opt, "--laps") == 0)
+        {
+            config.laps = ParseU32(argv[++i]);
+        }
+        else if (strcmp(opt, "--talk-back") == 0)
+        {
+            config.talkBack = ParseU32(argv[++i]);
+        }
+        else if (strcmp(opt, "--seed") == 0)
+        {
+            config.seed = ParseU32(argv[++i]);
+        }
+        else if (strcmp(opt, "--open-us") == 0)
+        {
+            config.openUs = ParseDouble(argv[++i]);
+        }
+        else if (strcmp(opt, "--read-us") == 0)
+        {
+            config.readUs = ParseDouble(argv[++i]);
+        }
+        else if (strcmp(opt, "--card-mbps") == 0)
+        {
+            config.cardMBps = ParseDouble(argv[++i]);
+        }
+        else
+        {
+            Usage(argv[0]);
+        }
+    }
+    if (config.laps == 0 || config.talkBack > 100)
+    {
+        Usage(argv[0]);
+    }
+
+    const char * root = FindRoot();
+    if (root == NULL)
+    {
+        fatal_error("run trainerbench from the repository or tools/trainerbench");
+    }
+    LoadGameData(root);
+
+    if (strcmp(command, "replay") == 0)
+    {
+        return CommandReplay(&config);
+    }
+    if (strcmp(command, "selftest") == 0)
+    {
+        return CommandSelfTest();
+    }
+    Usage(argv[0]);
+}
@@ -0,0 +1,54 @@
+#ifndef GUARD_TRAINERBENCH_TRAINERBENCH_H
+#define GUARD_TRAINERBENCH_TRAINERBENCH_H
+
+// The boundary between the host side (main.c) and the objects built from the
+// game's sources (game.c, hostfs.c and src/). Plain C types only, so that
+// both sides can include it with their own headers.
+
+#include <stdint.h>
+
+#define TRAINER_SIZE        0x34        // sizeof(TRAINER)
+#define TRPOKE_BUFFER_SIZE  (6 * 18)    // sizeof(TRPOKE) * PARTY_SIZE, what callers allocate
+
+// The trdata and trpoke NARCs, as whole archive images. The host owns the
+// memory; it must outlive every call below.
+typedef struct TrainerNarcs
+{
+    const uint8_t * trdata;
+    uint32_t trdataSize;
+    const uint8_t * trpoke;
+    uint32_t trpokeSize;
+} TrainerNarcs;
+
+// The card and HEAP_ID_FIELD, as seen by the game code
+typedef struct TrainerIo
+{
+    uint32_t opens;           // FS_OpenFile
+    uint32_t reads;           // FS_ReadFile
+    uint32_t bytesRead;
+    uint32_t liveBlocks;
+    uint32_t peakUsed;
+} TrainerIo;
+
+void Trainer_SetNarcs(const TrainerNarcs * narcs);
+// Empties HEAP_ID_FIELD and clears the counters
+void Trainer_ResetIo(void);
+void Trainer_GetIo(TrainerIo * io);
+
+// trainer_data.c is built twice, as it ships (TrainerBase_) and with
+// OPTIMIZE_TRAINER_DATA_CACHE (TrainerCache_). Open and Close are what
+// FieldSys_New and FieldSys_Delete do with the cache; the rest are the
+// game's functions of the same names.
+#define TRAINER_DECLARE_VARIANT(prefix)                                      \
+    void prefix##Open(void);                                                 \
+    void prefix##Close(void);                                                \
+    void prefix##ReadTrData(uint32_t idx, void * dest);                      \
+    void prefix##ReadTrPoke(uint32_t idx, void * dest);                      \
+    int prefix##GetAttr(uint32_t idx, int attr);                             \
+    /* Cache hits and misses, or zeros without the cache */                  \
+    void prefix##GetCacheStats(uint32_t * hits, uint32_t * misses);
+
+TRAINER_DECLARE_VARIANT(TrainerBase_)
+TRAINER_DECLARE_VARIANT(TrainerCache_)
+
+#endif //GUARD_TRAINERBENCH_TRAINERBENCH_H
@@ -0,0 +1,51 @@
+// map_matrix.c as the game builds it, with or without OPTIMIZE_MAP_MATRIX_CACHE.
+// The Makefile compiles this file once per variant with WARP_PREFIX set and
+// hides everything but the functions below, so that both copies of
+// map_matrix.c can be linked into one program.
+#include "../../src/map_matrix.c"
+
+#pragma GCC visibility push(default)
+#include "warpbench.h"
+
+#define WARP_CAT_(a, b) a##b
+#define WARP_CAT(a, b) WARP_CAT_(a, b)
+#define WARP_FUNC(name) WARP_CAT(WARP_PREFIX, name)
+
+static MAPMATRIX *sMapMatrix;
+
+void WARP_FUNC(Open)(void) {
+    sMapMatrix = MapMatrix_New();
+}
+
+void WARP_FUNC(Load)(uint32_t mapNo) {
+    MapMatrix_Load(mapNo, sMapMatrix);
+}
+
+void WARP_FUNC(Get)(WarpMatrix *dest) {
+    s32 size = sMapMatrix->width * sMapMatrix->height;
+
+    MI_CpuFill8(dest, 0, sizeof(WarpMatrix));
+    dest->width = sMapMatrix->width;
+    dest->height = sMapMatrix->height;
+    dest->matrixId = sMapMatrix->matrix_id;
+    MI_CpuCopy8(sMapMatrix->data.name, dest->name, MAP_MATRIX_MAX_NAME_LENGTH);
+    MI_CpuCopy8(sMapMatrix->data.headers, dest->headers, size * sizeof(u16));
+    MI_CpuCopy8(sMapMatrix->data.altitudes, dest->altitudes, size * sizeof(u8));
+    MI_CpuCopy8(sMapMatrix->data.maps.models, dest->models, size * sizeof(u16));
+}
+
+void WARP_FUNC(Close)(void) {
+    MapMatrix_Free(sMapMatrix);
+    sMapMatrix = NULL;
+}
+
+void WARP_FUNC(GetCacheStats)(uint32_t *hits, uint32_t *misses) {
+#ifdef OPTIMIZE_MAP_MATRIX_CACHE
+    *hits = sMapMatrix->cache.hits;
+    *misses = sMapMatrix->cache.misses;
+#else
+    *hits = 0;
+    *misses = 0;
+#endif //OPTIMIZE_MAP_MATRIX_CACHE
+}
+#pragma GCC visibility pop
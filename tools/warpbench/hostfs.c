@@ -0,0 +1,174 @@
+#include "global.h"
+#include "filesystem.h"
+#include "heap.h"
+#include "map_header.h"
+#include "warpbench.h"
+
+// The parts of heap.c, filesystem.c and map_header.c that map_matrix.c calls.
+// HEAP_ID_FIELD is modelled as one expanded heap: allocations from the front
+// take the lowest gap that fits and allocations from the end the highest, as
+// NNS_FndAllocFromExpHeapEx does, so the free blocks a sequence of warps
+// leaves behind are the ones the game would see.
+
+#define HOST_HEAP_MAX       0x100000
+#define HOST_MAX_BLOCKS     64
+
+typedef struct HostBlock {
+    u32 offset;
+    u32 size;
+} HostBlock;
+
+static const WarpTables *sTables;
+static u8 sHeap[HOST_HEAP_MAX];
+static u32 sHeapSize;
+// Live blocks, sorted by offset
+static HostBlock sBlocks[HOST_MAX_BLOCKS];
+static int sNumBlocks;
+static WarpIo sIo;
+
+void Warp_SetTables(const WarpTables *tables) {
+    sTables = tables;
+}
+
+void Warp_ResetHeap(uint32_t size) {
+    GF_ASSERT(size <= HOST_HEAP_MAX);
+    sHeapSize = size;
+    sNumBlocks = 0;
+    MI_CpuFill8(&sIo, 0, sizeof(WarpIo));
+}
+
+void Warp_GetIo(WarpIo *io) {
+    u32 start = 0;
+    int i;
+
+    *io = sIo;
+    io->liveBlocks = sNumBlocks;
+    io->freeBlocks = 0;
+    io->largestFree = 0;
+    for (i = 0; i <= sNumBlocks; i++) {
+        u32 end = i < sNumBlocks ? sBlocks[i].offset : sHeapSize;
+        if (end > start) {
+            io->freeBlocks++;
+            if (end - start > io->largestFree) {
+                io->largestFree = end - start;
+            }
+        }
+        if (i < sNumBlocks) {
+            start = sBlocks[i].offset + sBlocks[i].size;
+        }
+    }
+}
+
+static void *HostHeap_Alloc(u32 size, BOOL atEnd) {
+    u32 start, end, offset = 0;
+    int i, slot = -1;
+
+    size = (size + 3) & ~3;
+    GF_ASSERT(sNumBlocks < HOST_MAX_BLOCKS);
+    // Gap i lies between block i - 1 and block i
+    for (i = 0; i <= sNumBlocks; i++) {
+        int gap = atEnd ? sNumBlocks - i : i;
+        start = gap > 0 ? sBlocks[gap - 1].offset + sBlocks[gap - 1].size : 0;
+        end = gap < sNumBlocks ? sBlocks[gap].offset : sHeapSize;
+        if (end - start >= size) {
+            slot = gap;
+            offset = atEnd ? end - size : start;
+            break;
+        }
+    }
+    GF_ASSERT(slot >= 0);
+
+    for (i = sNumBlocks; i > slot; i--) {
+        sBlocks[i] = sBlocks[i - 1];
+    }
+    sBlocks[slot].offset = offset;
+    sBlocks[slot].size = size;
+    sNumBlocks++;
+
+    end = 0;
+    for (i = 0; i < sNumBlocks; i++) {
+        end += sBlocks[i].size;
+    }
+    if (end > sIo.peakUsed) {
+        sIo.peakUsed = end;
+    }
+    return sHeap + offset;
+}
+
+void *AllocFromHeap(HeapID heap_id, u32 size) {
+    GF_ASSERT(heap_id == HEAP_ID_FIELD);
+    return HostHeap_Alloc(size, FALSE);
+}
+
+void *AllocFromHeapAtEnd(HeapID heap_id, u32 size) {
+    GF_ASSERT(heap_id == HEAP_ID_FIELD);
+    return HostHeap_Alloc(size, TRUE);
+}
+
+void FreeToHeap(void *ptr) {
+    u32 offset = (u8 *)ptr - sHeap;
+    int i;
+
+    for (i = 0; i < sNumBlocks; i++) {
+        if (sBlocks[i].offset == offset) {
+            break;
+        }
+    }
+    GF_ASSERT(i < sNumBlocks);
+    for (; i < sNumBlocks - 1; i++) {
+        sBlocks[i] = sBlocks[i + 1];
+    }
+    sNumBlocks--;
+}
+
+void *Warp_AllocFront(uint32_t size) {
+    return HostHeap_Alloc(size, FALSE);
+}
+
+void Warp_Free(void *ptr) {
+    FreeToHeap(ptr);
+}
+
+static void *ReadMember(NarcId narc_id, s32 file_id, HeapID heap_id, BOOL atEnd) {
+    void *dest;
+
+    GF_ASSERT(narc_id == NARC_fielddata_mapmatrix_map_matrix);
+    GF_ASSERT(file_id >= 0 && file_id < sTables->numMatrices);
+    dest = HostHeap_Alloc(sTables->memberSizes[file_id], atEnd);
+    MI_CpuCopy8(sTables->members[file_id], dest, sTables->memberSizes[file_id]);
+    sIo.reads++;
+    sIo.bytesRead += sTables->memberSizes[file_id];
+    if (!atEnd) {
+        sIo.frontReads++;
+    }
+    return dest;
+}
+
+void *AllocAndReadWholeNarcMemberByIdPair(NarcId narc_id, s32 file_id, HeapID heap_id) {
+    return ReadMember(narc_id, file_id, heap_id, FALSE);
+}
+
+void *AllocAtEndAndReadWholeNarcMemberByIdPair(NarcId narc_id, s32 file_id, HeapID heap_id) {
+    return ReadMember(narc_id, file_id, heap_id, TRUE);
+}
+
+u16 MapHeader_GetMatrixId(u32 map_no) {
+    GF_ASSERT(map_no < (u32)sTables->numMaps);
+    return sTables->matrixIds[map_no];
+}
+
+void MI_CpuCopy8(const void *src, void *dest, u32 size) {
+    __builtin_memcpy(dest, src, size);
+}
+
+void MI_CpuFill8(void *dest, u8 data, u32 size) {
+    __builtin_memset(dest, data, size);
+}
+
+void MIi_CpuClear16(u16 value, u16 *dst, u32 size) {
+    u32 i;
+
+    for (i = 0; i < size / 2; i++) {
+        dst[i] = value;
+    }
+}
@@ -0,0 +1,658 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stdnoreturn.h>
+#include <stdarg.h>
+#include <ctype.h>
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
+#include <dirent.h>
+#include "warpbench.h"
+
+// Where the tables are read from, relative to the repository root
+#define MATRIX_DIR          "files/fielddata/mapmatrix/map_matrix"
+#define MAPS_PATH           "include/constants/maps.h"
+#define MAP_HEADERS_PATH    "src/data/map_headers.h"
+
+#define MAX_MATRICES        1024
+#define MAX_MAPS            1024
+#define MAX_NAME            32
+#define MAX_GROUP           64
+
+#define DEFAULT_WARPS       20000
+#define DEFAULT_BURST       8
+#define DEFAULT_HEAP_SIZE   0x1C000 // CreateHeap(3, HEAP_ID_FIELD, ...) in field_system.c
+#define DEFAULT_MAP_ALLOC   0x8000
+#define DEFAULT_OPEN_US     200.0
+#define DEFAULT_CARD_MBPS   4.0
+
+typedef struct GameData
+{
+    int numMatrices;
+    uint8_t * members[MAX_MATRICES];
+    uint32_t memberSizes[MAX_MATRICES];
+    int numMaps;
+    char mapNames[MAX_MAPS][MAX_NAME];
+    uint16_t matrixIds[MAX_MAPS];
+} GameData;
+
+// A town, route or dungeon and the maps that warp in and out of it
+typedef struct MapGroup
+{
+    int hub;
+    int numRooms;
+    int rooms[MAX_GROUP];
+} MapGroup;
+
+typedef struct Variant
+{
+    const char * name;
+    void (*open)(void);
+    void (*load)(uint32_t mapNo);
+    void (*get)(WarpMatrix * dest);
+    void (*close)(void);
+    void (*getCacheStats)(uint32_t * hits, uint32_t * misses);
+} Variant;
+
+typedef struct StormConfig
+{
+    uint32_t warps;
+    uint32_t burst;
+    uint32_t seed;
+    uint32_t heapSize;
+    uint32_t mapAlloc;
+    double openUs;
+    double cardMBps;
+} StormConfig;
+
+typedef struct StormResult
+{
+    uint32_t loads;
+    WarpIo io;
+    uint32_t minLargestFree;
+    uint32_t maxFreeBlocks;
+    double seconds;
+} StormResult;
+
+static const Variant kVariants[] = {
+    { "uncached", WarpBase_Open, WarpBase_Load, WarpBase_Get, WarpBase_Close, WarpBase_GetCacheStats },
+    { "cached", WarpCache_Open, WarpCache_Load, WarpCache_Get, WarpCache_Close, WarpCache_GetCacheStats },
+};
+
+static GameData sData;
+static int sNumGroups;
+static MapGroup sGroups[MAX_MAPS];
+
+static inline noreturn __attribute__((format(printf, 1, 2))) void fatal_error(const char * message, ...)
+{
+    va_list va_args;
+    va_start(va_args, message);
+    fputs("Error: ", stderr);
+    vfprintf(stderr, message, va_args);
+    fputc('\n', stderr);
+    va_end(va_args);
+    exit(EXIT_FAILURE);
+}
+
+// GF_ASSERT in the game objects, which are built with PM_KEEP_ASSERTS
+void GF_AssertFail(void)
+{
+    fatal_error("GF_ASSERT failed in the game code");
+}
+
+static uint32_t ParseU32(const char * arg)
+{
+    char * end;
+    unsigned long long val = strtoull(arg, &end, 0);
+    if (*arg == '\0' || *end != '\0' || val > 0xFFFFFFFFull)
+    {
+        fatal_error("invalid number: %s", arg);
+    }
+    return (uint32_t)val;
+}
+
+static double ParseDouble(const char * arg)
+{
+    char * end;
+    double val = strtod(arg, &end);
+    if (*arg == '\0' || *end != '\0' || !(val > 0))
+    {
+        fatal_error("invalid number: %s", arg);
+    }
+    return val;
+}
+
+static double Now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static uint32_t Random(uint32_t * state)
+{
+    uint32_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return *state = x;
+}
+
+// ---------------------------------------------------------------------------
+// Game data
+
+static void * ReadWholeFile(const char * root, const char * relPath, size_t * size)
+{
+    char path[4096];
+    snprintf(path, sizeof(path), "%s/%s", root, relPath);
+    FILE * file = fopen(path, "rb");
+    if (file == NULL)
+    {
+        fatal_error("%s: %s", path, strerror(errno));
+    }
+    fseek(file, 0, SEEK_END);
+    long length = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    uint8_t * buffer = malloc(length + 1);
+    if (buffer == NULL)
+    {
+        fatal_error("out of memory reading %s", path);
+    }
+    if (fread(buffer, 1, length, file) != (size_t)length)
+    {
+        fatal_error("%s: short read", path);
+    }
+    fclose(file);
+    buffer[length] = '\0';
+    *size = length;
+    return buffer;
+}
+
+static const char * FindRoot(void)
+{
+    static const char * const candidates[] = { ".", "..", "../.." };
+    for (size_t i = 0; i < sizeof(candidates) / sizeof(candidates[0]); i++)
+    {
+        char path[4096];
+        snprintf(path, sizeof(path), "%s/%s", candidates[i], MAP_HEADERS_PATH);
+        if (access(path, R_OK) == 0)
+        {
+            return candidates[i];
+        }
+    }
+    return NULL;
+}
+
+// The NARC is built from MATRIX_DIR in name order, and every member is named
+// map_matrix_NNNN after its index
+static void LoadMatrices(const char * root)
+{
+    char path[4096];
+    snprintf(path, sizeof(path), "%s/%s", root, MATRIX_DIR);
+    DIR * dir = opendir(path);
+    if (dir == NULL)
+    {
+        fatal_error("%s: %s", path, strerror(errno));
+    }
+    struct dirent * entry;
+    while ((entry = readdir(dir)) != NULL)
+    {
+        int idx;
+        if (sscanf(entry->d_name, "map_matrix_%4d", &idx) != 1)
+        {
+            continue;
+        }
+        if (idx < 0 || idx >= MAX_MATRICES || sData.members[idx] != NULL)
+        {
+            fatal_error("%s/%s: unexpected member", path, entry->d_name);
+        }
+        char relPath[4096];
+        size_t size;
+        snprintf(relPath, sizeof(relPath), "%s/%s", MATRIX_DIR, entry->d_name);
+        sData.members[idx] = ReadWholeFile(root, relPath, &size);
+        sData.memberSizes[idx] = size;
+        if (idx >= sData.numMatrices)
+        {
+            sData.numMatrices = idx + 1;
+        }
+    }
+    closedir(dir);
+    for (int i = 0; i < sData.numMatrices; i++)
+    {
+        if (sData.members[i] == NULL)
+        {
+            fatal_error("%s: member %d is missing", path, i);
+        }
+    }
+}
+
+static int FindMap(const char * name)
+{
+    for (int i = 0; i < sData.numMaps; i++)
+    {
+        if (strcmp(sData.mapNames[i], name) == 0)
+        {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static void LoadMaps(const char * root)
+{
+    size_t size;
+    char * text = ReadWholeFile(root, MAPS_PATH, &size);
+    char * line = text;
+
+    while (line != NULL && *line != '\0')
+    {
+        char * next = strchr(line, '\n');
+        char name[MAX_NAME + 8];
+        int value;
+        if (sscanf(line, "#define MAP_%39s %d", name, &value) == 2 && value >= 0 && value < MAX_MAPS && strlen(name) < MAX_NAME)
+        {
+            strcpy(sData.mapNames[value], name);
+            if (value >= sData.numMaps)
+            {
+                sData.numMaps = value + 1;
+            }
+        }
+        line = next != NULL ? next + 1 : NULL;
+    }
+    free(text);
+
+    // [MAP_NAME] = { ... .matrix_id = NARC_map_matrix_map_matrix_NNNN_..., ... }
+    text = ReadWholeFile(root, MAP_HEADERS_PATH, &size);
+    int map = -1;
+    int numFound = 0;
+    for (line = text; line != NULL && *line != '\0';)
+    {
+        char * next = strchr(line, '\n');
+        char name[MAX_NAME + 8];
+        int matrixId;
+        while (isspace((unsigned char)*line))
+        {
+            line++;
+        }
+        if (sscanf(line, "[MAP_%39[A-Z0-9_]]", name) == 1)
+        {
+            map = FindMap(name);
+            if (map < 0)
+            {
+                fatal_error("%s: unknown map MAP_%s", MAP_HEADERS_PATH, name);
+            }
+        }
+        else if (sscanf(line, ".matrix_id = NARC_map_matrix_map_matrix_%4d", &matrixId) == 1 && map >= 0)
+        {
+            if (matrixId >= sData.numMatrices)
+            {
+                fatal_error("%s: MAP_%s uses matrix %d, which does not exist", MAP_HEADERS_PATH, sData.mapNames[map], matrixId);
+            }
+            sData.matrixIds[map] = matrixId;
+            numFound++;
+            map = -1;
+        }
+        line = next != NULL ? next + 1 : NULL;
+    }
+    free(text);
+    if (numFound != sData.numMaps)
+    {
+        fatal_error("%s: found %d of %d maps", MAP_HEADERS_PATH, numFound, sData.numMaps);
+    }
+}
+
+// Groups each map with the others that share its leading area code, so T20
+// gets T20R0101, T20R0201 and so on
+static void BuildGroups(void)
+{
+    for (int i = 0; i < sData.numMaps; i++)
+    {
+        const char * name = sData.mapNames[i];
+        size_t len = 0;
+        while (isupper((unsigned char)name[len]))
+        {
+            len++;
+        }
+        while (isdigit((unsigned char)name[len]))
+        {
+            len++;
+        }
+        if (name[len] != '\0')
+        {
+            continue;
+        }
+        MapGroup * group = &sGroups[sNumGroups];
+        group->hub = i;
+        group->numRooms = 0;
+        for (int j = 0; j < sData.numMaps && group->numRooms < MAX_GROUP; j++)
+        {
+            if (j != i && strncmp(sData.mapNames[j], name, len) == 0 && isupper((unsigned char)sData.mapNames[j][len]))
+            {
+                group->rooms[group->numRooms++] = j;
+            }
+        }
+        if (group->numRooms > 0)
+        {
+            sNumGroups++;
+        }
+    }
+    if (sNumGroups == 0)
+    {
+        fatal_error("no towns with buildings in %s", MAPS_PATH);
+    }
+}
+
+static void LoadGameData(const char * root)
+{
+    static WarpTables tables;
+
+    LoadMatrices(root);
+    LoadMaps(root);
+    BuildGroups();
+    tables.numMatrices = sData.numMatrices;
+    tables.members = (const uint8_t * const *)sData.members;
+    tables.memberSizes = sData.memberSizes;
+    tables.numMaps = sData.numMaps;
+    tables.matrixIds = sData.matrixIds;
+    Warp_SetTables(&tables);
+}
+
+// ---------------------------------------------------------------------------
+// Storms
+
+// Warps in and out of the buildings of one area BURST times, then moves on to
+// another area, the way a player runs errands around a town
+static uint32_t * MakeStorm(const StormConfig * config)
+{
+    uint32_t * maps = malloc(config->warps * sizeof(uint32_t));
+    uint32_t state = config->seed ? config->seed : 1;
+    const MapGroup * group = NULL;
+    if (maps == NULL)
+    {
+        fatal_error("out of memory");
+    }
+    for (uint32_t i = 0; i < config->warps; i++)
+    {
+        if (i % (2 * config->burst) == 0)
+        {
+            group = &sGroups[Random(&state) % sNumGroups];
+        }
+        maps[i] = i % 2 == 0 ? group->hub : group->rooms[Random(&state) % group->numRooms];
+    }
+    return maps;
+}
+
+static void RunStorm(const Variant * variant, const StormConfig * config, const uint32_t * maps, StormResult * result)
+{
+    void * mapAlloc = NULL;
+
+    Warp_ResetHeap(config->heapSize);
+    memset(result, 0, sizeof(*result));
+    result->minLargestFree = config->heapSize;
+
+    double start = Now();
+    variant->open();
+    for (uint32_t i = 0; i < config->warps; i++)
+    {
+        if (mapAlloc != NULL)
+        {
+            Warp_Free(mapAlloc);
+            mapAlloc = NULL;
+        }
+        variant->load(maps[i]);
+        if (config->mapAlloc != 0)
+        {
+            mapAlloc = Warp_AllocFront(config->mapAlloc);
+        }
+        Warp_GetIo(&result->io);
+        if (result->io.largestFree < result->minLargestFree)
+        {
+            result->minLargestFree = result->io.largestFree;
+        }
+        if (result->io.freeBlocks > result->maxFreeBlocks)
+        {
+            result->maxFreeBlocks = result->io.freeBlocks;
+        }
+    }
+    if (mapAlloc != NULL)
+    {
+        Warp_Free(mapAlloc);
+    }
+    variant->close();
+    result->seconds = Now() - start;
+    result->loads = config->warps;
+    Warp_GetIo(&result->io);
+}
+
+static double CardMs(const StormConfig * config, const StormResult * result)
+{
+    return (result->io.reads * config->openUs + result->io.bytesRead / config->cardMBps) / 1000.0;
+}
+
+static int CommandStorm(const StormConfig * config)
+{
+    uint32_t * maps = MakeStorm(config);
+    StormResult results[2];
+
+    printf("%u warps in bursts of %u across %d areas, seed %u\n", config->warps, config->burst, sNumGroups, config->seed);
+    printf("field heap 0x%X, 0x%X of it per map; card modelled at %.0f us per read and %.1f MB/s\n\n",
+           config->heapSize, config->mapAlloc, config->openUs, config->cardMBps);
+    printf("%-10s %8s %10s %10s %10s %10s %12s %11s\n",
+           "", "reads", "bytes", "card ms", "host us", "reads/warp", "min free", "max holes");
+    for (int v = 0; v < 2; v++)
+    {
+        RunStorm(&kVariants[v], config, maps, &results[v]);
+        const StormResult * r = &results[v];
+        printf("%-10s %8u %10u %10.1f %10.1f %10.3f %#12x %11u\n",
+               kVariants[v].name, r->io.reads, r->io.bytesRead, CardMs(config, r),
+               r->seconds * 1e6, (double)r->io.reads / r->loads, r->minLargestFree, r->maxFreeBlocks);
+        if (r->io.liveBlocks != 0)
+        {
+            fatal_error("%s: %u blocks still allocated after MapMatrix_Free", kVariants[v].name, r->io.liveBlocks);
+        }
+    }
+    printf("\ncard time saved: %.1f%%\n", 100.0 * (1.0 - CardMs(config, &results[1]) / CardMs(config, &results[0])));
+    free(maps);
+    return EXIT_SUCCESS;
+}
+
+// ---------------------------------------------------------------------------
+// Self-test
+
+static bool SameMatrix(const WarpMatrix * a, const WarpMatrix * b)
+{
+    return memcmp(a, b, sizeof(WarpMatrix)) == 0;
+}
+
+// Runs both variants side by side and checks that every warp leaves the same
+// MAPMATRIX behind
+static int CheckEquivalence(const char * name, const uint32_t * maps, uint32_t numWarps)
+{
+    static WarpMatrix base, cache;
+    int failures = 0;
+
+    Warp_ResetHeap(0x100000);
+    WarpBase_Open();
+    WarpCache_Open();
+    for (uint32_t i = 0; i < numWarps; i++)
+    {
+        WarpBase_Load(maps[i]);
+        WarpCache_Load(maps[i]);
+        WarpBase_Get(&base);
+        WarpCache_Get(&cache);
+        if (!SameMatrix(&base, &cache))
+        {
+            if (failures++ < 5)
+            {
+                printf("  warp %u to MAP_%s: matrices differ\n", i, sData.mapNames[maps[i]]);
+            }
+        }
+    }
+
+    uint32_t hits, misses;
+    WarpCache_GetCacheStats(&hits, &misses);
+    WarpCache_Close();
+    WarpBase_Close();
+
+    WarpIo io;
+    Warp_GetIo(&io);
+    bool leaked = io.liveBlocks != 0;
+    bool counted = hits + misses == (numWarps & 0xFFFF);
+    printf("%s: %u warps, %u hits, %u misses, %s%s%s\n", name, numWarps, hits, misses,
+           failures ? "MISMATCH" : "same",
+           leaked ? ", LEAKED" : "",
+           counted ? "" : ", hit count wrong");
+    return failures + leaked + !counted;
+}
+
+static int CommandSelfTest(void)
+{
+    int failed = 0;
+    uint32_t numMaps = sData.numMaps;
+    uint32_t * maps = malloc(2 * numMaps * sizeof(uint32_t));
+    if (maps == NULL)
+    {
+        fatal_error("out of memory");
+    }
+
+    // Every map once forwards and once backwards, so each is loaded both
+    // fresh and from the cache
+    for (uint32_t i = 0; i < numMaps; i++)
+    {
+        maps[i] = i;
+        maps[2 * numMaps - 1 - i] = i;
+    }
+    failed += CheckEquivalence("every map", maps, 2 * numMaps) != 0;
+    free(maps);
+
+    StormConfig config = {
+        .warps = 4000, .burst = DEFAULT_BURST, .seed = 0x5EED, .heapSize = DEFAULT_HEAP_SIZE,
+        .mapAlloc = DEFAULT_MAP_ALLOC, .openUs = DEFAULT_OPEN_US, .cardMBps = DEFAULT_CARD_MBPS,
+    };
+    maps = MakeStorm(&config);
+    failed += CheckEquivalence("storm", maps, config.warps) != 0;
+
+    // The cache must read less, read nothing from the heap front and give
+    // back everything it took
+    StormResult base, cache;
+    RunStorm(&kVariants[0], &config, maps, &base);
+    RunStorm(&kVariants[1], &config, maps, &cache);
+    bool fewer = cache.io.reads < base.io.reads / 2;
+    bool atEnd = cache.io.frontReads == 0;
+    bool freed = base.io.liveBlocks == 0 && cache.io.liveBlocks == 0;
+    printf("storm: %u reads uncached, %u cached%s\n", base.io.reads, cache.io.reads, fewer ? "" : ", NOT FEWER");
+    printf("storm: %u cache reads from the heap front%s\n", cache.io.frontReads, atEnd ? "" : ", WRONG END");
+    printf("storm: heap %s after MapMatrix_Free\n", freed ? "empty" : "NOT EMPTY");
+    failed += !fewer + !atEnd + !freed;
+    free(maps);
+
+    printf("%d checks failed\n", failed);
+    return failed == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+// ---------------------------------------------------------------------------
+
+static noreturn void Usage(const char * prog)
+{
+    fprintf(stderr,
+        "Usage: %s COMMAND [options]\n"
+        "Runs src/map_matrix.c on the host, with and without\n"
+        "OPTIMIZE_MAP_MATRIX_CACHE, through a storm of warps.\n"
+        "Commands:\n"
+        "  storm                 warp in and out of town buildings and compare\n"
+        "                        card reads, bytes and field heap fragmentation\n"
+        "  selftest              check that both builds load every map the same\n"
+        "                        way and that the cache reads less, from the\n"
+        "                        heap end, without leaking\n"
+        "Options:\n"
+        "  --warps N             warps in the storm (default %d)\n"
+        "  --burst N             round trips per area before moving on\n"
+        "                        (default %d)\n"
+        "  --seed N              storm seed\n"
+        "  --heap N              field heap size (default %#x)\n"
+        "  --map-alloc N         bytes the field takes from the heap front for\n"
+        "                        each map (default %#x)\n"
+        "  --open-us X           modelled cost of opening a NARC member\n"
+        "                        (default %g)\n"
+        "  --card-mbps X         modelled card throughput (default %g)\n",
+        prog, DEFAULT_WARPS, DEFAULT_BURST, DEFAULT_HEAP_SIZE, DEFAULT_MAP_ALLOC, DEFAULT_OPEN_US, DEFAULT_CARD_MBPS);
+    exit(EXIT_FAILURE);
+}
+
+int main(int argc, char ** argv)
+{
+    if (argc < 2)
+    {
+        Usage(argv[0]);
+    }
+    const char * command = argv[1];
+    StormConfig config = {
+        .warps = DEFAULT_WARPS, .burst = DEFAULT_BURST, .seed = 1, .heapSize = DEFAULT_HEAP_SIZE,
+        .mapAlloc = DEFAULT_MAP_ALLOC, .openUs = DEFAULT_OPEN_US, .cardMBps = DEFAULT_CARD_MBPS,
+    };
+
+    for (int i = 2; i < argc; i++)
+    {
+        const char * opt = argv[i];
+        if (i + 1 >= argc)
+        {
+            Usage(argv[0]);
+        }
+        if (strcmp(opt, "--warps") == 0)
+        {
+            config.warps = ParseU32(argv[++i]);
+        }
+        else if (strcmp(opt, "--burst") == 0)
+        {
+            config.burst = ParseU32(argv[++i]);
+        }
+        else if (strcmp(opt, "--seed") == 0)
+        {
+            config.seed = ParseU32(argv[++i]);
+        }
+        else if (strcmp(opt, "--heap") == 0)
+        {
+            config.heapSize = ParseU32(argv[++i]);
+        }
+        else if (strcmp(opt, "--map-alloc") == 0)
+        {
+            config.mapAlloc = ParseU32(argv[++i]);
+        }
+        else if (strcmp(opt, "--open-us") == 0)
+        {
+            config.openUs = ParseDouble(argv[++i]);
+        }
+        else if (strcmp(opt, "--card-mbps") == 0)
+        {
+            config.cardMBps = ParseDouble(argv[++i]);
+        }
+        else
+        {
+            Usage(argv[0]);
+        }
+    }
+    if (config.warps == 0 || config.burst == 0)
+    {
+        Usage(argv[0]);
+    }
+
+    const char * root = FindRoot();
+    if (root == NULL)
+    {
+        fatal_error("run warpbench from the repository or tools/warpbench");
+    }
+    LoadGameData(root);
+
+    if (strcmp(command, "storm") == 0)
+    {
+        return CommandStorm(&config);
+    }
+    if (strcmp(command, "selftest") == 0)
+    {
+        return CommandSelfTest();
+    }
+    Usage(argv[0]);
+}
@@ -0,0 +1,70 @@
+#ifndef GUARD_WARPBENCH_WARPBENCH_H
+#define GUARD_WARPBENCH_WARPBENCH_H
+
+// The boundary between the host side (main.c) and the objects built from the
+// game's sources (game.c, hostfs.c and src/). Plain C types only, so that
+// both sides can include it with their own headers.
+
+#include <stdint.h>
+
+#define WARP_MAX_CELLS      799 // MAP_MATRIX_MAX_SIZE
+#define WARP_MAX_NAME       16  // MAP_MATRIX_MAX_NAME_LENGTH
+
+// What MapMatrix_Load left in the MAPMATRIX, over width * height cells
+typedef struct WarpMatrix
+{
+    uint8_t width;
+    uint8_t height;
+    uint8_t matrixId;
+    uint8_t name[WARP_MAX_NAME];
+    uint16_t headers[WARP_MAX_CELLS];
+    uint8_t altitudes[WARP_MAX_CELLS];
+    uint16_t models[WARP_MAX_CELLS];
+} WarpMatrix;
+
+// What the stand-ins for the file system and map_header.c read instead of
+// the ROM. The host owns the memory; it must outlive every call below.
+typedef struct WarpTables
+{
+    int numMatrices;
+    const uint8_t * const * members; // map_matrix NARC members
+    const uint32_t * memberSizes;
+    int numMaps;
+    const uint16_t * matrixIds;      // sMapHeaders[map].matrix_id
+} WarpTables;
+
+// HEAP_ID_FIELD and the card, as seen by the game code
+typedef struct WarpIo
+{
+    uint32_t reads;           // NARC members read
+    uint32_t bytesRead;
+    uint32_t frontReads;      // of those, into memory from the heap front
+    uint32_t liveBlocks;
+    uint32_t freeBlocks;      // holes between live blocks, and the two ends
+    uint32_t largestFree;
+    uint32_t peakUsed;
+} WarpIo;
+
+void Warp_SetTables(const WarpTables * tables);
+// Empties HEAP_ID_FIELD, gives it SIZE bytes and clears the counters
+void Warp_ResetHeap(uint32_t size);
+void Warp_GetIo(WarpIo * io);
+// Stand-ins for the field's own allocations, which live for one map
+void * Warp_AllocFront(uint32_t size);
+void Warp_Free(void * ptr);
+
+// map_matrix.c is built twice, as it ships (WarpBase_) and with
+// OPTIMIZE_MAP_MATRIX_CACHE (WarpCache_). Open and Close are MapMatrix_New
+// and MapMatrix_Free on HEAP_ID_FIELD; Load is a warp to MAPNO.
+#define WARP_DECLARE_VARIANT(prefix)                                         \
+    void prefix##Open(void);                                                 \
+    void prefix##Load(uint32_t mapNo);                                       \
+    void prefix##Get(WarpMatrix * dest);                                     \
+    void prefix##Close(void);                                                \
+    /* Cache hits and misses, or zeros without the cache */                  \
+    void prefix##GetCacheStats(uint32_t * hits, uint32_t * misses);
+
+WARP_DECLARE_VARIANT(WarpBase_)
+WARP_DECLARE_VARIANT(WarpCache_)
+
+#endif //GUARD_WARPBENCH_WARPBENCH_H